@@ -11171,6 +11171,32 @@
 // the C++11 thread parallelization.
 //
 //
+// \n \section cpp_threads_numa NUMA Systems
+// <hr>
+//
+// On systems with several NUMA nodes the memory bandwidth of a parallel operation depends on
+// the placement of the memory pages, which are usually placed on the NUMA node of the thread that
+// first writes to them. For that reason \b Blaze executes the \a i-th part of every parallel dense
+// assignment preferably on the \a i-th thread. Additionally, the threads can be pinned to the
+// available cores (on Linux systems only) via the environment variable \c BLAZE_THREAD_PINNING:
+
+   \code
+   export BLAZE_THREAD_PINNING=1
+   \endcode
+
+// In combination with the \c BLAZE_USE_FIRST_TOUCH_INITIALIZATION switch (see the configuration
+// file <tt><blaze/config/SMP.h></tt>), large numeric dense vectors and matrices are initialized
+// in parallel with the same partitioning as the parallel assignments, such that every thread
+// operates on memory of its own NUMA node:
+
+   \code
+   ... -DBLAZE_USE_CPP_THREADS -DBLAZE_USE_FIRST_TOUCH_INITIALIZATION=1 ...
+   \endcode
+
+// Please note that in this case the elements of large numeric vectors and matrices are default
+// initialized even if the constructors without initial value are used.
+//
+//
 // \n \section cpp_threads_known_issues Known Issues
 // <hr>
 //
@@ -11806,6 +11832,29 @@
 // In case an error is encountered during (de-)serialization, a \c std::runtime_exception is
 // thrown.
 //
+// Vectors and matrices with elements of built-in or complex type are written as contiguous,
+// 64-byte aligned blocks (sparse matrices in compressed row or column format). Therefore large
+// archives can also be mapped into memory via the \c blaze::MappedArchive class, which allows
+// to use the serialized elements without copying them. In this case dense vectors and matrices
+// are reconstituted as unpadded \c CustomVector and \c CustomMatrix of constant element type and
+// sparse matrices as \c MappedCompressedMatrix with the same storage order as the serialized
+// matrix:
+
+   \code
+   blaze::MappedArchive archive( "matrix.blaze" );
+
+   blaze::MappedCompressedMatrix<double,blaze::rowMajor> A;
+   archive >> A;  // No copy of the elements
+
+   blaze::DynamicVector<double> x( A.columns() ), y;
+   // ... Initialization of x
+
+   y = A * x;
+   \endcode
+
+// Note that the reconstituted vectors and matrices must not be used after the destruction of
+// the \c MappedArchive.
+//
 // \n Previous: \ref vector_serialization &nbsp; &nbsp; Next: \ref customization \n
 */
 //*************************************************************************************************
@@ -11992,7 +12041,38 @@
 // \b Blaze kernels for small dense matrix/dense vector multiplications and the BLAS kernels
 // for large multiplications. All thresholds, including the thresholds for the OpenMP- and
 // thread-based parallelization, are contained within the configuration file
-// <tt><blaze/config/Thresholds.h></tt>.
+// <tt><blaze/config/Thresholds.h></tt>. Similarly, the block sizes of the blocked dense matrix
+// multiplication kernels are contained within the configuration file
+// <tt><blaze/config/Blocking.h></tt>.
+//
+//
+// \n \section tuning Machine-Specific Tuning
+// <hr>
+//
+// Since the optimal thresholds and block sizes depend on the target platform, the \b Blaze
+// benchmark suite provides a tuning tool, which measures the crossover points between the
+// serial and the parallel execution and between the individual compute kernels as well as the
+// best block sizes for the dense matrix multiplication on the current machine:
+
+   \code
+   cd blazemark
+   ./tune -o /path/to/BlazeTuning.h
+   \endcode
+
+// The tool uses the compiler settings of the benchmark suite (see <tt>blazemark/Configfile</tt>)
+// and emits a header file that contains the measured settings. This header is consumed by
+// \b Blaze via the \c BLAZE_TUNING_HEADER setting in the configuration file
+// <tt><blaze/config/Tuning.h></tt>, which can also be specified via command line, CMake
+// (\c -DBLAZE_TUNING_HEADER=/path/to/BlazeTuning.h) or by defining the symbol manually before
+// including any \b Blaze header file:
+
+   \code
+   #define BLAZE_TUNING_HEADER "/path/to/BlazeTuning.h"
+   #include <blaze/Blaze.h>
+   \endcode
+
+// All settings of the tuning header take precedence over the default settings, but settings
+// specified via command line still take precedence over the tuning header.
 //
 //
 // \n \section padding Padding
@@ -12022,6 +12102,18 @@
 // If \c BLAZE_USE_PADDING is set to 1 padding is enabled for all dense vectors and matrices, if
 // it is set to 0 padding is disabled. Note however that disabling padding can considerably reduce
 // the performance of all dense vector and matrix operations!
+//
+// For unpadded data structures (as for instance unpadded custom vectors and matrices) and in case
+// padding is disabled, \b Blaze processes the trailing elements behind the last full SIMD vector
+// by means of a single masked SIMD load/store operation instead of a scalar remainder loop, as
+// long as the instruction set provides masked memory accesses for the element type (AVX for
+// \c float and \c double, AVX2 or AVX-512 for 32-bit and 64-bit integral types). This behavior
+// can be (de-)activated via the \c BLAZE_USE_MASKED_TAILS switch in the same configuration file:
+
+   \code
+   #define BLAZE_USE_MASKED_TAILS 1
+   \endcode
+
 //
 //
 // \n \section streaming Streaming (Non-Temporal Stores)
@@ -60,6 +60,7 @@
 #include <blaze/util/InitializerList.h>
 #include <blaze/util/IntegralConstant.h>
 #include <blaze/util/InvalidType.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/Limits.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/MemoryPool.h>
@@ -76,6 +77,7 @@
 #include <blaze/util/SmallArray.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Suffix.h>
+#include <blaze/util/TaskScheduler.h>
 #include <blaze/util/Thread.h>
 #include <blaze/util/ThreadPool.h>
 #include <blaze/util/Time.h>
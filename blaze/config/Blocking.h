@@ -0,0 +1,169 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Blocking.h
+//  \brief Configuration of the block sizes for the blocked compute kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//=================================================================================================
+//
+//  MATRIX MULTIPLICATION BLOCK SIZES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Outer block size of the blocked dense matrix/dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the outer block size of the blocked (non-packed) dense matrix/dense
+// matrix multiplication kernels. The outer block size determines the number of elements along
+// the inner dimension of the multiplication that are processed per block (scaled by the number
+// of elements of the data type within 16 bytes). The block size must be a multiple of 16.
+//
+// The default setting for this block size is 112. Note that in case the Blaze debug mode is
+// active, this block size will be replaced by the blaze::MMM_DEBUG_OUTER_BLOCK_SIZE value.
+//
+// \note It is possible to specify this block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_MMM_OUTER_BLOCK_SIZE 112UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_MMM_OUTER_BLOCK_SIZE
+#define BLAZE_MMM_OUTER_BLOCK_SIZE 112UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inner block size of the blocked dense matrix/dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the inner block size of the blocked (non-packed) dense matrix/dense
+// matrix multiplication kernels. The inner block size determines the number of rows or columns
+// of the target matrix that are processed per block. The block size must be a multiple of 16.
+//
+// The default setting for this block size is 96. Note that in case the Blaze debug mode is
+// active, this block size will be replaced by the blaze::MMM_DEBUG_INNER_BLOCK_SIZE value.
+//
+// \note It is possible to specify this block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_MMM_INNER_BLOCK_SIZE 96UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_MMM_INNER_BLOCK_SIZE
+#define BLAZE_MMM_INNER_BLOCK_SIZE 96UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Row block size of the packed dense matrix/dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the number of rows of the left-hand side operand that are packed into
+// a contiguous block by the packed dense matrix/dense matrix multiplication kernels (see the
+// BLAZE_USE_PACKED_KERNELS switch). The packed block should fit into the L2 cache. The block
+// size must be a multiple of 16.
+//
+// The default setting for this block size is 96. Note that in case the Blaze debug mode is
+// active, this block size will be replaced by the blaze::PMMM_DEBUG_M_BLOCK_SIZE value.
+//
+// \note It is possible to specify this block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_PMMM_M_BLOCK_SIZE 96UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_PMMM_M_BLOCK_SIZE
+#define BLAZE_PMMM_M_BLOCK_SIZE 96UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Column block size of the packed dense matrix/dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the number of columns of the right-hand side operand that are packed
+// into a contiguous block by the packed dense matrix/dense matrix multiplication kernels (see
+// the BLAZE_USE_PACKED_KERNELS switch). The packed block should fit into the L3 cache. The
+// block size must be a multiple of 48.
+//
+// The default setting for this block size is 4032. Note that in case the Blaze debug mode is
+// active, this block size will be replaced by the blaze::PMMM_DEBUG_N_BLOCK_SIZE value.
+//
+// \note It is possible to specify this block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_PMMM_N_BLOCK_SIZE 4032UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_PMMM_N_BLOCK_SIZE
+#define BLAZE_PMMM_N_BLOCK_SIZE 4032UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Depth block size of the packed dense matrix/dense matrix multiplication.
+// \ingroup config
+//
+// This setting specifies the number of elements along the inner dimension of the multiplication
+// that are packed per block by the packed dense matrix/dense matrix multiplication kernels (see
+// the BLAZE_USE_PACKED_KERNELS switch). The given value refers to double precision elements and
+// is scaled accordingly for other data types. A single packed micro-panel should fit into the
+// L1 cache. The block size must be a multiple of 16.
+//
+// The default setting for this block size is 256. Note that in case the Blaze debug mode is
+// active, this block size will be replaced by the blaze::PMMM_DEBUG_K_BLOCK_SIZE value.
+//
+// \note It is possible to specify this block size via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_PMMM_K_BLOCK_SIZE 256UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_PMMM_K_BLOCK_SIZE
+#define BLAZE_PMMM_K_BLOCK_SIZE 256UL
+#endif
+//*************************************************************************************************
@@ -85,3 +85,33 @@
 #define BLAZE_USE_FUNCTION_TRACES 0
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the kernel profiling.
+// \ingroup config
+//
+// This compilation switch triggers the profiling of the computational kernels of the Blaze
+// library. In case the switch is set to 1, the kernel selection points instrumented via the
+// BLAZE_KERNEL_PROFILE macro record the number of calls, the wall clock time, the problem
+// sizes, the estimated number of floating point operations and bytes, and the number of used
+// threads. The results can be queried via the getKernelProfiles() function or written in JSON
+// format via the writeKernelProfiles() function. In case the switch is set to 0, the kernel
+// profiling is completely removed from the code and no overhead results.
+//
+// Possible settings for the kernel profiling switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the kernel profiling via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_KERNEL_PROFILING 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_KERNEL_PROFILING
+#define BLAZE_USE_KERNEL_PROFILING 0
+#endif
+//*************************************************************************************************
@@ -120,3 +120,92 @@
 #define BLAZE_USE_OPTIMIZED_KERNELS 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the packed matrix multiplication kernels.
+// \ingroup config
+//
+// This configuration switch enables/disables the packed dense matrix/dense matrix multiplication
+// kernels. In case the switch is set to \a true, all large dense matrix multiplications that are
+// not computed by means of a BLAS library copy panels of both operands into contiguous, aligned
+// buffers and compute the result by means of a register-blocked, architecture-specific micro
+// kernel. In case the switch is set to \a false the default, unpacked kernels are used.
+//
+// Possible settings for the packed kernels:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the packed kernels via command line or by defining this
+// symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_PACKED_KERNELS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_PACKED_KERNELS
+#define BLAZE_USE_PACKED_KERNELS 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the nonzero-balanced parallel sparse matrix/dense vector
+//        multiplication.
+// \ingroup config
+//
+// This configuration switch enables/disables the nonzero-balanced scheduling of parallel sparse
+// matrix/dense vector multiplications. In case the switch is set to \a true, the rows of a
+// row-major sparse matrix are split among the threads such that each thread processes roughly
+// the same number of non-zero elements. For column-major sparse matrices the columns are split
+// accordingly and each thread accumulates its partial result into a private vector, which are
+// summed up afterwards. In case the switch is set to \a false, the result vector is split into
+// equally sized index ranges, which may leave threads idle for matrices with a very irregular
+// distribution of non-zero elements.
+//
+// Possible settings for the nonzero-balanced scheduling:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the nonzero-balanced scheduling via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_BALANCED_SPMV 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_BALANCED_SPMV
+#define BLAZE_USE_BALANCED_SPMV 1
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Configuration switch for the masked SIMD tails of unpadded dense vectors and matrices.
+// \ingroup config
+//
+// This configuration switch enables/disables the masked processing of the trailing elements of
+// unpadded dense vectors and matrices. In case the switch is set to \a true, the elements behind
+// the last full SIMD vector are processed by a single masked SIMD load/store operation instead
+// of a scalar remainder loop, provided that the instruction set supports masked memory accesses
+// for the element type (see the blaze::HasSIMDMaskedAccess type trait). In case the switch is
+// set to \a false, the trailing elements are processed by the scalar remainder loop.
+//
+// Possible settings for the masked SIMD tails:
+//  - Disabled: \b 0
+//  - Enabled : \b 1
+//
+// \note It is possible to (de-)activate the masked SIMD tails via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_MASKED_TAILS 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_MASKED_TAILS
+#define BLAZE_USE_MASKED_TAILS 1
+#endif
+//*************************************************************************************************
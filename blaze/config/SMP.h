@@ -58,3 +58,38 @@
 #define BLAZE_USE_SHARED_MEMORY_PARALLELIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the parallel first-touch initialization of dense vectors and
+//        matrices.
+// \ingroup config
+//
+// Most operating systems place a newly allocated memory page on the NUMA node of the thread that
+// writes to it first. By default, the memory of dynamic dense vectors and matrices is initialized
+// by the allocating thread and therefore ends up on a single NUMA node. This compilation switch
+// enables/disables the parallel first-touch initialization of dynamic dense vectors and matrices
+// (see blaze::DynamicVector and blaze::DynamicMatrix). In case the switch is set to 1, the memory
+// of vectors and matrices that are large enough to be assigned in parallel is initialized in
+// parallel, using the same partitioning and thread mapping as the shared-memory parallel
+// assignments. Thus in subsequent parallel operations every thread predominantly accesses memory
+// on its own NUMA node. Note that in this case vectors and matrices of numeric element type that
+// are created without initialization are default initialized. In case the switch is set to 0,
+// the memory is initialized by the allocating thread.
+//
+// Possible settings for the first-touch initialization switch:
+//  - Deactivated: \b 0 (default)
+//  - Activated  : \b 1
+//
+// \note It is possible to (de-)activate the first-touch initialization via command line or by
+// defining this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_FIRST_TOUCH_INITIALIZATION 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_FIRST_TOUCH_INITIALIZATION
+#define BLAZE_USE_FIRST_TOUCH_INITIALIZATION 0
+#endif
+//*************************************************************************************************
@@ -375,6 +375,64 @@
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Dense matrix decomposition threshold.
+// \ingroup config
+//
+// This setting specifies the threshold between the application of the native Blaze kernels and
+// the LAPACK kernels for the LU, Cholesky, and QR decomposition of dense matrices (see the
+// BLAZE_LAPACK_MODE switch). In case the number of elements in the dense matrix is equal or
+// higher than this value, the LAPACK kernels are preferred over the native Blaze kernels. In
+// case the number of elements in the dense matrix is smaller, the Blaze kernels are used.
+//
+// The default setting for this threshold is 4096 (which for instance corresponds to a matrix
+// size of \f$ 64 \times 64 \f$). Note that in case the Blaze debug mode is active, this
+// threshold will be replaced by the blaze::DMATDECOMPOSITION_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_DMATDECOMPOSITION_THRESHOLD 4096UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_DMATDECOMPOSITION_THRESHOLD
+#define BLAZE_DMATDECOMPOSITION_THRESHOLD 4096UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix in-place transposition threshold.
+// \ingroup config
+//
+// This setting specifies the threshold between the two algorithms for the in-place transposition
+// of non-square dense matrices (see for instance the DynamicMatrix::transpose() function). In
+// case the number of elements in the dense matrix is equal or higher than this value, the matrix
+// is transposed in-place without allocating a temporary matrix (provided that the capacity of
+// the matrix is sufficient to hold the transposed matrix). In case the number of elements in
+// the dense matrix is smaller, the transpose is assembled in a temporary matrix, which for
+// small matrices is faster.
+//
+// The default setting for this threshold is 250000 (which for instance corresponds to a matrix
+// size of \f$ 500 \times 500 \f$). Note that in case the Blaze debug mode is active, this
+// threshold will be replaced by the blaze::DMATTRANSPOSE_DEBUG_THRESHOLD value.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_DMATTRANSPOSE_THRESHOLD 250000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_DMATTRANSPOSE_THRESHOLD
+#define BLAZE_DMATTRANSPOSE_THRESHOLD 250000UL
+#endif
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -2032,3 +2090,264 @@
 #define BLAZE_SMP_SMATREDUCE_THRESHOLD 180UL
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense vector (as for instance via the
+// sum(), prod(), min(), max(), or reduce() functions) or the computation of a dense vector norm
+// can be executed in parallel. In case the number of elements of the dense vector is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECREDUCE_THRESHOLD
+#define BLAZE_SMP_DVECREDUCE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This threshold specifies when a dense vector/dense vector inner product (scalar product) can
+// be executed in parallel. In case the number of elements of the two dense vectors is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DVECDVECINNER_THRESHOLD
+#define BLAZE_SMP_DVECDVECINNER_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a sparse vector (as for instance via the
+// sum(), prod(), min(), max(), or reduce() functions) or the computation of a sparse vector norm
+// can be executed in parallel. In case the number of non-zero elements of the sparse vector is
+// larger or equal to this threshold, the operation is executed in parallel. If the number of
+// non-zero elements is below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 20000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SVECREDUCE_THRESHOLD 20000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SVECREDUCE_THRESHOLD
+#define BLAZE_SMP_SVECREDUCE_THRESHOLD 20000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This threshold specifies when the total reduction of a dense matrix (as for instance via the
+// sum(), prod(), min(), max(), or reduce() functions) or the computation of a dense matrix norm
+// can be executed in parallel. In case the number of elements of the dense matrix is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 48400. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 48400UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD
+#define BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD 48400UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix decomposition threshold.
+// \ingroup config
+//
+// This threshold specifies when the trailing matrix updates of the native blocked LU, Cholesky,
+// and QR decompositions can be executed in parallel. In case the number of elements of the
+// trailing submatrix is larger or equal to this threshold, the update is executed in parallel.
+// If the number of elements is below this threshold the update is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 40000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATDECOMPOSITION_THRESHOLD 40000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATDECOMPOSITION_THRESHOLD
+#define BLAZE_SMP_DMATDECOMPOSITION_THRESHOLD 40000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched dense matrix operation threshold.
+// \ingroup config
+//
+// This threshold specifies when a batched operation on an array of small dense matrices (as for
+// instance batchInvert() or batchMult()) can be executed in parallel. In case the number of
+// matrices in the batch is larger or equal to this threshold, the batch is split into several
+// parts that are processed in parallel. If the number of matrices is below this threshold the
+// operation is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 4096. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_DMATBATCH_THRESHOLD 4096UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_DMATBATCH_THRESHOLD
+#define BLAZE_SMP_DMATBATCH_THRESHOLD 4096UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP iterative solver update threshold.
+// \ingroup config
+//
+// This threshold specifies when the fused vector update kernels of the iterative solvers (as
+// for instance the combined update of the solution and the residual and the computation of the
+// residual norm of the conjugate gradient method) can be executed in parallel. In case the size
+// of the vectors is larger or equal to this threshold, the update is executed in parallel. If
+// the size of the vectors is below this threshold the update is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 38000. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SOLVERUPDATE_THRESHOLD 38000UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SOLVERUPDATE_THRESHOLD
+#define BLAZE_SMP_SOLVERUPDATE_THRESHOLD 38000UL
+#endif
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assembly threshold.
+// \ingroup config
+//
+// This threshold specifies when the assembly of a sparse matrix from unsorted (row,column,value)
+// triplets via the assemble() function can be executed in parallel. In case the number of
+// triplets is larger or equal to this threshold, the assembly is executed in parallel. If the
+// number of triplets is below this threshold the assembly is executed single-threaded.
+//
+// Please note that this threshold is highly sensitiv to the used system architecture and the
+// shared memory parallelization technique. Therefore the default value cannot guarantee maximum
+// performance for all possible situations and configurations. It merely provides a reasonable
+// standard for the current generation of CPUs and requires individual adaption for the OpenMP,
+// C++11 and Boost thread parallelization or the HPX-based parallelization.
+//
+// The default setting for this threshold is 65536. In case the threshold is set to 0, the
+// operation is unconditionally executed in parallel.
+//
+// \note It is possible to specify this threshold via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_SMP_SMATASSEMBLY_THRESHOLD 65536UL
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_SMP_SMATASSEMBLY_THRESHOLD
+#define BLAZE_SMP_SMATASSEMBLY_THRESHOLD 65536UL
+#endif
+//*************************************************************************************************
@@ -0,0 +1,59 @@
+//=================================================================================================
+/*!
+//  \file blaze/config/Tuning.h
+//  \brief Configuration of the machine-specific tuning header
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+/*!\brief Machine-specific tuning header.
+// \ingroup config
+//
+// This setting specifies an optional header file, which contains machine-specific settings for
+// the thresholds (see <blaze/config/Thresholds.h>) and the block sizes (see
+// <blaze/config/Blocking.h>) of the Blaze library. Such a header can be generated by the tuning
+// tool of the Blaze benchmark suite (see <tt>blazemark/tune</tt>), which measures the crossover
+// points between the individual compute kernels and between the serial and the parallel
+// execution as well as the best block sizes for the matrix multiplication on the current
+// machine. The tuning header is included before the default settings and therefore takes
+// precedence over them. Settings specified via command line still take precedence over the
+// tuning header. By default, no tuning header is used.
+//
+// \note It is possible to specify the tuning header via command line or by defining this symbol
+// manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_TUNING_HEADER "/path/to/BlazeTuning.h"
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+//#define BLAZE_TUNING_HEADER "BlazeTuning.h"
+//*************************************************************************************************
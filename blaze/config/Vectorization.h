@@ -62,3 +62,34 @@
 #define BLAZE_USE_VECTORIZATION 1
 #endif
 //*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch of the compute kernels.
+// \ingroup config
+//
+// This compilation switch enables/disables the runtime selection of the instruction set for
+// the most expensive compute kernels (i.e. dense matrix multiplications, dense matrix/dense
+// vector multiplications, dot products, summations and Euclidean norms). In case the switch
+// is set to 1, these kernels are additionally compiled for all instruction sets beyond the
+// one selected at compile time (AVX2 and AVX-512) and the best instruction set supported by
+// the executing CPU is chosen once at program startup. In case the switch is set to 0, all
+// kernels use the instruction set selected at compile time. The runtime dispatch is only
+// available for GNU and Clang compilers on x86-64 platforms.
+//
+// Possible settings for the runtime dispatch switch:
+//  - Deactivated: \b 0
+//  - Activated  : \b 1 (default)
+//
+// \note It is possible to (de-)activate the runtime dispatch via command line or by defining
+// this symbol manually before including any Blaze header file:
+
+   \code
+   #define BLAZE_USE_DISPATCH 1
+   #include <blaze/Blaze.h>
+   \endcode
+*/
+#ifndef BLAZE_USE_DISPATCH
+#define BLAZE_USE_DISPATCH 1
+#endif
+//*************************************************************************************************
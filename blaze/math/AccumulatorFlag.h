@@ -0,0 +1,78 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/AccumulatorFlag.h
+//  \brief Header file for the accumulator flag enumeration
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ACCUMULATORFLAG_H_
+#define _BLAZE_MATH_ACCUMULATORFLAG_H_
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  ACCUMULATOR FLAG VALUES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Accumulator flag.
+// \ingroup math
+//
+// The AccumulatorFlag type enumeration represents the different types of accumulators that are
+// available for the row-wise (or column-wise) computation of sparse matrix/sparse matrix products
+// (see the symbolicMult() and numericMult() functions). The following flags are available:
+//
+//  - \c denseAccumulator: Each row of the result is accumulated in an array spanning all columns
+//          of the result. The setup cost is independent of the number of non-zero elements of the
+//          row, which makes this accumulator the best choice for rows with many non-zero elements.
+//  - \c hashAccumulator: Each row of the result is accumulated in an open addressing hash table,
+//          whose size is proportional to the number of scalar products of the row. This avoids
+//          touching a large dense array for very sparse rows of wide matrices.
+//  - \c sortAccumulator: All scalar products of a row are expanded into a list, which is sorted
+//          by column index and compressed (ESC: expand, sort, compress). This accumulator works
+//          without any lookup structure and is the best choice for rows with very few products.
+//  - \c adaptiveAccumulator: The accumulator is selected individually for each row based on the
+//          number of scalar products of the row in relation to the number of columns.
+*/
+enum AccumulatorFlag
+{
+   denseAccumulator    = 0,  //!< Flag for the dense array accumulator.
+   hashAccumulator     = 1,  //!< Flag for the hash table accumulator.
+   sortAccumulator     = 2,  //!< Flag for the expand-sort-compress accumulator.
+   adaptiveAccumulator = 3   //!< Flag for the row-wise selection of the accumulator.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -43,6 +43,8 @@
 #include <cmath>
 #include <vector>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/sparse/Assemble.h>
+#include <blaze/math/sparse/SMatSMatMult.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/IdentityMatrix.h>
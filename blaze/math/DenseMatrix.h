@@ -45,6 +45,7 @@
 #include <blaze/math/adaptors/LowerMatrix.h>
 #include <blaze/math/adaptors/SymmetricMatrix.h>
 #include <blaze/math/adaptors/UpperMatrix.h>
+#include <blaze/math/dense/Batched.h>
 #include <blaze/math/dense/DenseMatrix.h>
 #include <blaze/math/dense/Eigen.h>
 #include <blaze/math/dense/Inversion.h>
@@ -91,6 +92,8 @@
 #include <blaze/math/expressions/DMatTSMatMultExpr.h>
 #include <blaze/math/expressions/DMatTSMatSubExpr.h>
 #include <blaze/math/expressions/DVecDVecOuterExpr.h>
+#include <blaze/math/expressions/PMatDMatMultExpr.h>
+#include <blaze/math/expressions/PMatDVecMultExpr.h>
 #include <blaze/math/expressions/SMatDMatMultExpr.h>
 #include <blaze/math/expressions/SMatDMatSubExpr.h>
 #include <blaze/math/expressions/SMatTDMatMultExpr.h>
@@ -42,6 +42,7 @@
 
 #include <blaze/math/simd/BasicTypes.h>
 #include <blaze/math/simd/DerivedTypes.h>
+#include <blaze/math/simd/Dispatch.h>
 #include <blaze/math/simd/Functions.h>
 #include <blaze/math/simd/SIMDTrait.h>
 
@@ -44,6 +44,7 @@
 #include <blaze/math/adaptors/symmetricmatrix/BaseTemplate.h>
 #include <blaze/math/adaptors/symmetricmatrix/DenseNonNumeric.h>
 #include <blaze/math/adaptors/symmetricmatrix/DenseNumeric.h>
+#include <blaze/math/adaptors/symmetricmatrix/Packed.h>
 #include <blaze/math/adaptors/symmetricmatrix/SparseNonNumeric.h>
 #include <blaze/math/adaptors/symmetricmatrix/SparseNumeric.h>
 #include <blaze/math/constraints/BLASCompatible.h>
@@ -73,6 +74,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsIdentity.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRestricted.h>
@@ -91,6 +93,7 @@
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
 #include <blaze/util/typetraits/IsNumeric.h>
@@ -627,7 +630,25 @@ struct IsRestricted< SymmetricMatrix<MT,SO,DF,NF> >
 /*! \cond BLAZE_INTERNAL */
 template< typename MT, bool SO, bool NF >
 struct HasConstDataAccess< SymmetricMatrix<MT,SO,true,NF> >
-   : public TrueType
+   : public BoolConstant< !IsPacked_v<MT> >
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISPACKED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO, bool DF, bool NF >
+struct IsPacked< SymmetricMatrix<MT,SO,DF,NF> >
+   : public IsPacked<MT>
 {};
 /*! \endcond */
 //*************************************************************************************************
@@ -0,0 +1,1559 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/lowermatrix/Packed.h
+//  \brief LowerMatrix specialization for dense matrices with packed storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_ADAPTORS_LOWERMATRIX_PACKED_H_
+#define _BLAZE_MATH_ADAPTORS_LOWERMATRIX_PACKED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <utility>
+#include <blaze/math/adaptors/packed/Pack.h>
+#include <blaze/math/adaptors/packed/PackedIterator.h>
+#include <blaze/math/adaptors/packed/PackedProxy.h>
+#include <blaze/math/adaptors/lowermatrix/BaseTemplate.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/InitializerMatrix.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/InversionFlag.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsSquare.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS TEMPLATE SPECIALIZATION FOR DENSE MATRICES WITH PACKED STORAGE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of LowerMatrix for dense matrices with packed storage.
+// \ingroup lower_matrix
+//
+// This specialization of LowerMatrix stores only the \f$ N(N+1)/2 \f$ elements of the lower
+// triangular part of the lower matrix (see PackedMatrix). The elements of the upper part are
+// implicitly zero and are accessed by means of a PackedProxy, which prevents the assignment of
+// non-zero values. Multiplications with dense vectors and dense matrices are performed by
+// specific kernels operating directly on the packed rows (see PMatDVecMultExpr and
+// PMatDMatMultExpr).
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+class LowerMatrix<PackedMatrix<Type,SO>,SO,true>
+   : public DenseMatrix< LowerMatrix<PackedMatrix<Type,SO>,SO,true>, SO >
+{
+ private:
+   //**Type definitions****************************************************************************
+   using MT = PackedMatrix<Type,SO>;  //!< Type of the packed matrix.
+   using OT = OppositeType_t<MT>;     //!< Opposite type of the packed matrix.
+   using TT = TransposeType_t<MT>;    //!< Transpose type of the packed matrix.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = LowerMatrix<MT,SO,true>;        //!< Type of this LowerMatrix instance.
+   using BaseType       = DenseMatrix<This,SO>;           //!< Base type of this LowerMatrix instance.
+   using ResultType     = This;                           //!< Result type for expression template evaluations.
+   using OppositeType   = LowerMatrix<OT,!SO,true>;       //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = UpperMatrix<TT,!SO,true>;       //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                           //!< Type of the matrix elements.
+   using SIMDType       = SIMDTrait_t<ElementType>;       //!< SIMD type of the matrix elements.
+   using ReturnType     = const Type;                     //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                    //!< Data type for composite expression templates.
+   using Reference      = PackedProxy<Type>;              //!< Reference to a non-constant matrix value.
+   using ConstReference = const Type;                     //!< Reference to a constant matrix value.
+   using Pointer        = Type*;                          //!< Pointer to a non-constant matrix value.
+   using ConstPointer   = const Type*;                    //!< Pointer to a constant matrix value.
+   using Iterator       = PackedIterator<This,SO>;        //!< Iterator over non-constant elements.
+   using ConstIterator  = PackedIterator<const This,SO>;  //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a LowerMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      //! The type of the other LowerMatrix.
+      using Other = LowerMatrix< typename MT::template Rebind<NewType>::Other >;
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a LowerMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      //! The type of the other LowerMatrix.
+      using Other = LowerMatrix< typename MT::template Resize<NewM,NewN>::Other >;
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template evaluation strategy.
+   static constexpr bool simdEnabled = false;
+
+   //! Compilation switch for the expression template assignment strategy.
+   static constexpr bool smpAssignable = false;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline LowerMatrix();
+   explicit inline LowerMatrix( size_t n );
+   explicit inline LowerMatrix( initializer_list< initializer_list<ElementType> > list );
+
+   template< typename Other >
+   explicit inline LowerMatrix( size_t n, const Other* array );
+
+   template< typename Other, size_t N >
+   explicit inline LowerMatrix( const Other (&array)[N][N] );
+
+   inline LowerMatrix( const LowerMatrix& m );
+   inline LowerMatrix( LowerMatrix&& m ) noexcept;
+
+   template< typename MT2, bool SO2 > inline LowerMatrix( const Matrix<MT2,SO2>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j );
+   inline ConstReference operator()( size_t i, size_t j ) const;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstPointer   data  () const noexcept;
+   inline ConstPointer   data  ( size_t i ) const noexcept;
+   inline size_t         spacing() const noexcept;
+   inline Iterator       begin ( size_t i );
+   inline ConstIterator  begin ( size_t i ) const;
+   inline ConstIterator  cbegin( size_t i ) const;
+   inline Iterator       end   ( size_t i );
+   inline ConstIterator  end   ( size_t i ) const;
+   inline ConstIterator  cend  ( size_t i ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline LowerMatrix& operator=( initializer_list< initializer_list<ElementType> > list );
+
+   template< typename Other, size_t N >
+   inline LowerMatrix& operator=( const Other (&array)[N][N] );
+
+   inline LowerMatrix& operator=( const LowerMatrix& rhs );
+   inline LowerMatrix& operator=( LowerMatrix&& rhs ) noexcept;
+
+   template< typename MT2, bool SO2 > inline LowerMatrix& operator= ( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline LowerMatrix& operator+=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline LowerMatrix& operator-=( const Matrix<MT2,SO2>& rhs );
+   template< typename MT2, bool SO2 > inline LowerMatrix& operator%=( const Matrix<MT2,SO2>& rhs );
+
+   template< typename ST >
+   inline auto operator*=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, LowerMatrix& >;
+
+   template< typename ST >
+   inline auto operator/=( ST rhs ) -> EnableIf_t< IsNumeric_v<ST>, LowerMatrix& >;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t n, bool preserve=true );
+   inline void   extend ( size_t n, bool preserve=true );
+   inline void   reserve( size_t elements );
+   inline void   shrinkToFit();
+   inline void   swap( LowerMatrix& m ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline LowerMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Debugging functions*************************************************************************
+   /*!\name Debugging functions */
+   //@{
+   inline bool isIntact() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool isAligned   () const noexcept;
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT2, bool SO2 > inline void assign( const Matrix<MT2,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT matrix_;  //!< The packed dense matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   template< bool RF, typename MT2, bool SO2, bool DF2 >
+   friend bool isDefault( const LowerMatrix<MT2,SO2,DF2>& m );
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE( Type );
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The default constructor for LowerMatrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix()
+   : matrix_()  // The packed dense matrix
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Constructor for a matrix of size \f$ n \times n \f$.
+//
+// \param n The number of rows and columns of the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( size_t n )
+   : matrix_( n, Type() )  // The packed dense matrix
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Invalid setup of lower matrix.
+//
+// The matrix is sized according to the size of the initializer list and all matrix elements are
+// initialized with the values from the given list. Missing values are initialized with default
+// values. In case the given list does not represent a lower matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( initializer_list< initializer_list<ElementType> > list )
+   : matrix_()  // The packed dense matrix
+{
+   const InitializerMatrix<ElementType> tmp( list, list.size() );
+
+   if( !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of lower matrix" );
+   }
+
+   assign( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array initialization of all lower matrix elements.
+//
+// \param n The number of rows and columns of the matrix.
+// \param array Dynamic array for the initialization.
+// \exception std::invalid_argument Invalid setup of lower matrix.
+//
+// The matrix is initialized with the values from the given row-major (in case of a row-major
+// matrix) or column-major (in case of a column-major matrix) \f$ n \times n \f$ array. In case
+// the given array does not represent a lower matrix, a \a std::invalid_argument exception is
+// thrown.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other >  // Data type of the initialization array
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( size_t n, const Other* array )
+   : matrix_( n )  // The packed dense matrix
+{
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=i+1UL; j<n; ++j ) {
+         if( !isDefault( array[i*n+j] ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of lower matrix" );
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         matrix_(i,j) = array[i*n+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array initialization of all lower matrix elements.
+//
+// \param array \f$ N \times N \f$ dimensional array for the initialization.
+// \exception std::invalid_argument Invalid setup of lower matrix.
+//
+// In case the given array does not represent a lower matrix, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other    // Data type of the initialization array
+        , size_t N >        // Number of rows and columns of the initialization array
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( const Other (&array)[N][N] )
+   : LowerMatrix( N, &array[0][0] )  // Delegation to the dynamic array constructor
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The copy constructor for LowerMatrix.
+//
+// \param m The lower matrix to be copied.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( const LowerMatrix& m )
+   : matrix_( m.matrix_ )  // The packed dense matrix
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The move constructor for LowerMatrix.
+//
+// \param m The lower matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( LowerMatrix&& m ) noexcept
+   : matrix_( std::move( m.matrix_ ) )  // The packed dense matrix
+{}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Conversion constructor from different matrices.
+//
+// \param m Matrix to be copied.
+// \exception std::invalid_argument Invalid setup of lower matrix.
+//
+// This constructor initializes the lower matrix as a copy of the given matrix. In case the
+// given matrix is not a lower matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the foreign matrix
+        , bool SO2 >      // Storage order of the foreign matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>::LowerMatrix( const Matrix<MT2,SO2>& m )
+   : matrix_()  // The packed dense matrix
+{
+   CompositeType_t<MT2> tmp( ~m );
+
+   if( !IsLower_v<MT2> && !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid setup of lower matrix" );
+   }
+
+   assign( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// The function call operator provides access to all elements of the lower matrix. The attempt to
+// assign a non-zero value to an element of the upper part of the matrix results in a
+// \a std::invalid_argument exception.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::Reference
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator()( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   return Reference( ( i >= j )?( &matrix_(i,j) ):( nullptr ), false, false );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief 2D-access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return The value of the accessed element.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstReference
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator()( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i<rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j<columns(), "Invalid column access index" );
+
+   return ( i >= j )?( matrix_(i,j) ):( Type() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::Reference
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::at( size_t i, size_t j )
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checked access to the matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..N-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstReference
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::at( size_t i, size_t j ) const
+{
+   if( i >= rows() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= columns() ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the packed matrix elements.
+//
+// \return Pointer to the packed array of \f$ N(N+1)/2 \f$ elements.
+//
+// This function returns a pointer to the internal packed storage of the lower matrix (see
+// PackedMatrix::index() for the layout). Note that in contrast to dense matrices with full
+// storage the elements are not stored with a fixed row/column spacing.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstPointer
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::data() const noexcept
+{
+   return matrix_.data();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Low-level data access to the packed segment \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the first of the \f$ i+1 \f$ contiguously stored elements of segment \a i.
+//
+// This function returns a pointer to the packed segment \a i, which contains the elements
+// \f$ (i,0) \f$ to \f$ (i,i) \f$ of the matrix (see PackedMatrix::index()).
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstPointer
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::data( size_t i ) const noexcept
+{
+   return matrix_.data() + MT::packedSize( i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum spacing between the beginning of two rows/columns.
+//
+// \return The maximum spacing between the beginning of two rows/columns.
+//
+// Since the packed segments are of varying length, this function returns the length of the
+// longest segment, i.e. the number of rows/columns of the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::spacing() const noexcept
+{
+   return matrix_.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::Iterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::begin( size_t i )
+{
+   return ( SO )?( Iterator( *this, 0UL, i ) ):( Iterator( *this, i, 0UL ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstIterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::begin( size_t i ) const
+{
+   return ( SO )?( ConstIterator( *this, 0UL, i ) ):( ConstIterator( *this, i, 0UL ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator to the first element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstIterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::cbegin( size_t i ) const
+{
+   return begin( i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::Iterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::end( size_t i )
+{
+   return ( SO )?( Iterator( *this, rows(), i ) ):( Iterator( *this, i, columns() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstIterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::end( size_t i ) const
+{
+   return ( SO )?( ConstIterator( *this, rows(), i ) ):( ConstIterator( *this, i, columns() ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns an iterator just past the last element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last element of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline typename LowerMatrix<PackedMatrix<Type,SO>,SO,true>::ConstIterator
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::cend( size_t i ) const
+{
+   return end( i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to lower matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator=( initializer_list< initializer_list<ElementType> > list )
+{
+   const InitializerMatrix<ElementType> tmp( list, list.size() );
+
+   if( !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to lower matrix" );
+   }
+
+   assign( tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Array assignment to all lower matrix elements.
+//
+// \param array \f$ N \times N \f$ dimensional array for the assignment.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to lower matrix.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other    // Data type of the initialization array
+        , size_t N >        // Number of rows and columns of the initialization array
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator=( const Other (&array)[N][N] )
+{
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=i+1UL; j<N; ++j ) {
+         if( !isDefault( array[i][j] ) ) {
+            BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to lower matrix" );
+         }
+      }
+   }
+
+   matrix_.resize( N, false );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         matrix_(i,j) = array[i][j];
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copy assignment operator for LowerMatrix.
+//
+// \param rhs Matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator=( const LowerMatrix& rhs )
+{
+   matrix_ = rhs.matrix_;
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Move assignment operator for LowerMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator=( LowerMatrix&& rhs ) noexcept
+{
+   matrix_ = std::move( rhs.matrix_ );
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operator for general matrices.
+//
+// \param rhs The general matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Invalid assignment to lower matrix.
+//
+// The matrix is resized according to the given \f$ N \times N \f$ matrix and initialized as a
+// copy of this matrix. In case the given matrix is not a lower matrix, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator=( const Matrix<MT2,SO2>& rhs )
+{
+   CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsLower_v<MT2> && !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to lower matrix" );
+   }
+
+   assign( tmp );
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Invalid assignment to lower matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix is not a
+// lower matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator+=( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsLower_v<MT2> && !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to lower matrix" );
+   }
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         matrix_(i,j) += tmp(i,j);
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Invalid assignment to lower matrix.
+//
+// In case the current sizes of the two matrices don't match or the given matrix is not a
+// lower matrix, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator-=( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT2> tmp( ~rhs );
+
+   if( !IsLower_v<MT2> && !isLower( tmp ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to lower matrix" );
+   }
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         matrix_(i,j) -= tmp(i,j);
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Schur product assignment operator for the multiplication of a matrix (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side matrix for the Schur product.
+// \return Reference to the matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator%=( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).rows() || columns() != (~rhs).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   CompositeType_t<MT2> tmp( ~rhs );
+
+   for( size_t i=0UL; i<rows(); ++i ) {
+      for( size_t j=0UL; j<=i; ++j ) {
+         matrix_(i,j) *= tmp(i,j);
+      }
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operator for the multiplication between a matrix and
+//        a scalar value (\f$ A*=s \f$).
+//
+// \param rhs The right-hand side scalar value for the multiplication.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator*=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, LowerMatrix& >
+{
+   return scale( rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Division assignment operator for the division of a matrix by a scalar value
+//        (\f$ A/=s \f$).
+//
+// \param rhs The right-hand side scalar value for the division.
+// \return Reference to the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+template< typename ST >  // Data type of the right-hand side scalar
+inline auto LowerMatrix<PackedMatrix<Type,SO>,SO,true>::operator/=( ST rhs )
+   -> EnableIf_t< IsNumeric_v<ST>, LowerMatrix& >
+{
+   BLAZE_USER_ASSERT( !isZero( rhs ), "Division by zero detected" );
+
+   Type* v( matrix_.data() );
+
+   for( size_t k=0UL; k<matrix_.size(); ++k ) {
+      v[k] /= rhs;
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of rows of the matrix.
+//
+// \return The number of rows of the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::rows() const noexcept
+{
+   return matrix_.rows();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the current number of columns of the matrix.
+//
+// \return The number of columns of the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::columns() const noexcept
+{
+   return matrix_.columns();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the maximum capacity of the matrix.
+//
+// \return The capacity of the packed storage of the matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::capacity() const noexcept
+{
+   return matrix_.capacity();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the total number of non-zero elements in the matrix
+//
+// \return The number of non-zero elements in the lower matrix.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   const Type* v( matrix_.data() );
+
+   for( size_t k=0UL; k<matrix_.size(); ++k ) {
+      if( !isDefault( v[k] ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline size_t LowerMatrix<PackedMatrix<Type,SO>,SO,true>::nonZeros( size_t i ) const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t j=0UL; j<columns(); ++j ) {
+      if( !isDefault( SO ? (*this)(j,i) : (*this)(i,j) ) )
+         ++nonzeros;
+   }
+
+   return nonzeros;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::reset()
+{
+   matrix_.reset();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::reset( size_t i )
+{
+   using blaze::reset;
+
+   const size_t jbegin( ( SO == columnMajor )?( i ):( 0UL ) );
+   const size_t jend  ( ( SO == columnMajor )?( columns() ):( i+1UL ) );
+
+   for( size_t j=jbegin; j<jend; ++j ) {
+      reset( matrix_(i,j) );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Clearing the lower matrix.
+//
+// \return void
+//
+// This function clears the lower matrix and returns it to its default state, i.e. the
+// number of rows and columns is set to 0.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::clear()
+{
+   matrix_.clear();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Changing the size of the lower matrix.
+//
+// \param n The new number of rows and columns of the matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+//
+// This function resizes the matrix to \f$ n \times n \f$. During this operation, new dynamic
+// memory may be allocated in case the capacity of the matrix is too small. In case the size of
+// the matrix is increased, new elements are default initialized. Since the layout of the packed
+// array is independent of the size of the matrix, the preserved elements are not moved.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::resize( size_t n, bool preserve )
+{
+   using blaze::reset;
+
+   const size_t first( preserve ? matrix_.size() : 0UL );
+
+   matrix_.resize( n, preserve );
+
+   Type* v( matrix_.data() );
+
+   for( size_t k=first; k<matrix_.size(); ++k ) {
+      reset( v[k] );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extending the size of the matrix.
+//
+// \param n Number of additional rows and columns.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::extend( size_t n, bool preserve )
+{
+   resize( rows() + n, preserve );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Setting the minimum capacity of the matrix.
+//
+// \param elements The new minimum capacity of the packed storage.
+// \return void
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::reserve( size_t elements )
+{
+   matrix_.reserve( elements );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Requesting the removal of unused capacity.
+//
+// \return void
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::shrinkToFit()
+{
+   matrix_.shrinkToFit();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Swapping the contents of two matrices.
+//
+// \param m The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::swap( LowerMatrix& m ) noexcept
+{
+   matrix_.swap( m.matrix_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A*=s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other >  // Data type of the scalar value
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>&
+   LowerMatrix<PackedMatrix<Type,SO>,SO,true>::scale( const Other& scalar )
+{
+   Type* v( matrix_.data() );
+
+   for( size_t k=0UL; k<matrix_.size(); ++k ) {
+      v[k] *= scalar;
+   }
+
+   return *this;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEBUGGING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the invariants of the lower matrix are intact.
+//
+// \return \a true in case the lower matrix's invariants are intact, \a false otherwise.
+//
+// Since the elements of the upper part are not stored explicitly, the invariants of the lower
+// matrix are always intact.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline bool LowerMatrix<PackedMatrix<Type,SO>,SO,true>::isIntact() const noexcept
+{
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool LowerMatrix<PackedMatrix<Type,SO>,SO,true>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias ) ||
+          matrix_.canAlias( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+*/
+template< typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+template< typename Other >  // Data type of the foreign expression
+inline bool LowerMatrix<PackedMatrix<Type,SO>,SO,true>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias ) ||
+          matrix_.isAliased( alias );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix is properly aligned in memory.
+//
+// \return \a false, since the rows/columns of a packed matrix are not aligned.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline bool LowerMatrix<PackedMatrix<Type,SO>,SO,true>::isAligned() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a false, since packed matrices are always assigned serially.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline bool LowerMatrix<PackedMatrix<Type,SO>,SO,true>::canSMPAssign() const noexcept
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies the lower part of the given lower matrix into the packed storage.
+//
+// \param rhs The right-hand side lower matrix.
+// \return void
+//
+// In case the given matrix may alias with this matrix, the elements are packed into a temporary
+// packed matrix first.
+*/
+template< typename Type   // Data type of the packed matrix
+        , bool SO >       // Storage order of the packed matrix
+template< typename MT2    // Type of the right-hand side matrix
+        , bool SO2 >      // Storage order of the right-hand side matrix
+inline void LowerMatrix<PackedMatrix<Type,SO>,SO,true>::assign( const Matrix<MT2,SO2>& rhs )
+{
+   if( rows() != (~rhs).rows() || (~rhs).canAlias( this ) ) {
+      MT tmp( (~rhs).rows() );
+      pack<false>( tmp, ~rhs );
+      matrix_.swap( tmp );
+   }
+   else {
+      pack<false>( matrix_, ~rhs );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place inversion of the given lower matrix with packed storage.
+// \ingroup lower_matrix
+//
+// \param m The lower matrix to be inverted.
+// \return void
+// \exception std::invalid_argument Inversion of singular matrix failed.
+//
+// The inversion is performed on a temporary lower matrix with full storage, whose inverse
+// is packed again afterwards.
+*/
+template< InversionFlag IF  // Inversion algorithm
+        , typename Type     // Data type of the packed matrix
+        , bool SO >         // Storage order of the packed matrix
+inline void invert( LowerMatrix<PackedMatrix<Type,SO>,SO,true>& m )
+{
+   LowerMatrix< ResultType_t< PackedMatrix<Type,SO> >, SO > tmp( m );
+   invert<IF>( tmp );
+   m = tmp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns a reference to the given lower matrix with packed storage.
+// \ingroup lower_matrix
+//
+// \param m The lower matrix to be derestricted.
+// \return Reference to the given lower matrix.
+//
+// In contrast to lower matrices with full storage, the packed storage does not contain the
+// elements of the upper part. Therefore this function returns the given matrix itself, i.e.
+// all accesses remain checked.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in the violation of invariants, erroneous results and/or in compilation errors.
+*/
+template< typename Type  // Data type of the packed matrix
+        , bool SO >      // Storage order of the packed matrix
+inline LowerMatrix<PackedMatrix<Type,SO>,SO,true>& derestrict( LowerMatrix<PackedMatrix<Type,SO>,SO,true>& m )
+{
+   return m;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/packed/Pack.h
+//  \brief Header file for the packing of dense and sparse matrices into packed storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_ADAPTORS_PACKED_PACK_H_
+#define _BLAZE_MATH_ADAPTORS_PACKED_PACK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies one triangular part of the given dense matrix into packed storage.
+// \ingroup adaptors
+//
+// \param lhs The target packed matrix.
+// \param rhs The right-hand side dense matrix to be packed.
+// \return void
+//
+// In case \a UF is \a false, the lower part of \a rhs (including the diagonal) is copied, else
+// the upper part. The elements are written in the order of the packed array. The target matrix
+// is expected to have the same size as \a rhs.
+*/
+template< bool UF        // Upper flag
+        , typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+void pack( PackedMatrix<Type,SO>& lhs, const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( lhs.rows() == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.rows() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t n( lhs.rows() );
+   Type* v( lhs.data() );
+
+   for( size_t p=0UL; p<n; ++p ) {
+      for( size_t q=0UL; q<=p; ++q ) {
+         *v++ = ( UF )?( (~rhs)(q,p) ):( (~rhs)(p,q) );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Copies one triangular part of the given sparse matrix into packed storage.
+// \ingroup adaptors
+//
+// \param lhs The target packed matrix.
+// \param rhs The right-hand side sparse matrix to be packed.
+// \return void
+//
+// In case \a UF is \a false, the lower part of \a rhs (including the diagonal) is copied, else
+// the upper part. All other stored elements are reset to their default value. The target matrix
+// is expected to have the same size as \a rhs.
+*/
+template< bool UF        // Upper flag
+        , typename Type  // Data type of the packed matrix
+        , bool SO        // Storage order of the packed matrix
+        , typename MT    // Type of the right-hand side sparse matrix
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix
+void pack( PackedMatrix<Type,SO>& lhs, const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( lhs.rows() == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( lhs.rows() == (~rhs).columns(), "Invalid number of columns" );
+
+   reset( lhs );
+
+   for( size_t k=0UL; k<lhs.rows(); ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element )
+      {
+         const size_t i( SO2 ? element->index() : k );
+         const size_t j( SO2 ? k : element->index() );
+
+         if( UF ? ( i <= j ) : ( j <= i ) ) {
+            lhs(i,j) = element->value();
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,531 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/packed/PackedIterator.h
+//  \brief Header file for the PackedIterator class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_ADAPTORS_PACKED_PACKEDITERATOR_H_
+#define _BLAZE_MATH_ADAPTORS_PACKED_PACKEDITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConst.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the elements of a single row/column of a matrix with packed storage.
+// \ingroup adaptors
+//
+// The PackedIterator class represents a random access iterator over the elements of a single
+// row (in case of a row-major matrix) or column (in case of a column-major matrix) of a
+// symmetric, Hermitian, lower, or upper matrix with packed storage (see PackedMatrix). Since in
+// packed storage only one of the two triangular parts is stored explicitly, the iterator does
+// not traverse contiguous memory, but accesses the elements via the function call operator of
+// the given matrix. Dereferencing the iterator therefore results in the same value or proxy
+// as the corresponding function call.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+class PackedIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Return type of the function call operator of the matrix.
+   using ReferenceType = decltype( std::declval<MT&>()( 0UL, 0UL ) );
+
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = ElementType_t< RemoveConst_t<MT> >;  //!< Type of the underlying elements.
+   using PointerType      = ReferenceType;  //!< Pointer return type.
+   using DifferenceType   = ptrdiff_t;      //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   inline PackedIterator() noexcept;
+   inline PackedIterator( MT& matrix, size_t row, size_t column ) noexcept;
+
+   template< typename MT2, typename = EnableIf_t< !IsConst_v<MT2> && IsConst_v<MT> > >
+   inline PackedIterator( const PackedIterator<MT2,SO>& it ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+   inline PackedIterator& operator+=( size_t inc ) noexcept;
+   inline PackedIterator& operator-=( size_t dec ) noexcept;
+   inline PackedIterator& operator++() noexcept;
+   inline const PackedIterator operator++( int ) noexcept;
+   inline PackedIterator& operator--() noexcept;
+   inline const PackedIterator operator--( int ) noexcept;
+   inline ReferenceType operator*() const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline MT*    matrix() const noexcept { return matrix_; }
+   inline size_t row   () const noexcept { return row_;    }
+   inline size_t column() const noexcept { return column_; }
+
+   inline size_t position() const noexcept { return ( SO ? row_ : column_ ); }
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t& index() noexcept { return ( SO ? row_ : column_ ); }
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   MT*    matrix_;  //!< Reference to the adapted matrix.
+   size_t row_;     //!< The current row index of the iterator.
+   size_t column_;  //!< The current column index of the iterator.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor of the PackedIterator class.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>::PackedIterator() noexcept
+   : matrix_( nullptr )  // Reference to the adapted matrix
+   , row_   ( 0UL )      // The current row index of the iterator
+   , column_( 0UL )      // The current column index of the iterator
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor of the PackedIterator class.
+//
+// \param matrix The matrix with packed storage.
+// \param row The initial row index.
+// \param column The initial column index.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>::PackedIterator( MT& matrix, size_t row, size_t column ) noexcept
+   : matrix_( &matrix )  // Reference to the adapted matrix
+   , row_   ( row     )  // The current row index of the iterator
+   , column_( column  )  // The current column index of the iterator
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from an iterator over non-constant elements.
+//
+// \param it The iterator to be converted.
+*/
+template< typename MT       // Type of the matrix with packed storage
+        , bool SO >         // Storage order of the matrix
+template< typename MT2      // Type of the foreign matrix
+        , typename >        // SFINAE restriction to non-constant to constant conversions
+inline PackedIterator<MT,SO>::PackedIterator( const PackedIterator<MT2,SO>& it ) noexcept
+   : matrix_( it.matrix() )  // Reference to the adapted matrix
+   , row_   ( it.row()    )  // The current row index of the iterator
+   , column_( it.column() )  // The current column index of the iterator
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator.
+//
+// \param inc The increment of the iterator.
+// \return The incremented iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>& PackedIterator<MT,SO>::operator+=( size_t inc ) noexcept
+{
+   index() += inc;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator.
+//
+// \param dec The decrement of the iterator.
+// \return The decremented iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>& PackedIterator<MT,SO>::operator-=( size_t dec ) noexcept
+{
+   index() -= dec;
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-increment operator.
+//
+// \return Reference to the incremented iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>& PackedIterator<MT,SO>::operator++() noexcept
+{
+   ++index();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-increment operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline const PackedIterator<MT,SO> PackedIterator<MT,SO>::operator++( int ) noexcept
+{
+   const PackedIterator tmp( *this );
+   ++index();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pre-decrement operator.
+//
+// \return Reference to the decremented iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline PackedIterator<MT,SO>& PackedIterator<MT,SO>::operator--() noexcept
+{
+   --index();
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Post-decrement operator.
+//
+// \return The previous position of the iterator.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline const PackedIterator<MT,SO> PackedIterator<MT,SO>::operator--( int ) noexcept
+{
+   const PackedIterator tmp( *this );
+   --index();
+   return tmp;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the element at the current iterator position.
+//
+// \return The value or access proxy of the element at the current iterator position.
+*/
+template< typename MT  // Type of the matrix with packed storage
+        , bool SO >    // Storage order of the matrix
+inline typename PackedIterator<MT,SO>::ReferenceType PackedIterator<MT,SO>::operator*() const
+{
+   BLAZE_INTERNAL_ASSERT( matrix_ != nullptr, "Uninitialized iterator detected" );
+   return (*matrix_)( row_, column_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedIterator operators */
+//@{
+template< typename MT1, typename MT2, bool SO >
+inline bool operator==( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline bool operator!=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline bool operator<( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline bool operator>( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline bool operator<=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline bool operator>=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT1, typename MT2, bool SO >
+inline ptrdiff_t operator-( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept;
+
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator+( const PackedIterator<MT,SO>& it, size_t inc ) noexcept;
+
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator+( size_t inc, const PackedIterator<MT,SO>& it ) noexcept;
+
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator-( const PackedIterator<MT,SO>& it, size_t dec ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Equality comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators refer to the same element, \a false if not.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator==( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() == rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inequality comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the iterators don't refer to the same element, \a false if they do.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator!=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() != rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-than comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller, \a false if not.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator<( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() < rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-than comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater, \a false if not.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator>( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() > rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Less-or-equal-than comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator<=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() <= rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Greater-or-equal-than comparison between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline bool operator>=( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return lhs.position() >= rhs.position();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating the number of elements between two PackedIterator objects.
+// \ingroup adaptors
+//
+// \param lhs The left-hand side iterator.
+// \param rhs The right-hand side iterator.
+// \return The number of elements between the two iterators.
+*/
+template< typename MT1, typename MT2, bool SO >
+inline ptrdiff_t operator-( const PackedIterator<MT1,SO>& lhs, const PackedIterator<MT2,SO>& rhs ) noexcept
+{
+   return static_cast<ptrdiff_t>( lhs.position() ) - static_cast<ptrdiff_t>( rhs.position() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between a PackedIterator and an integral value.
+// \ingroup adaptors
+//
+// \param it The iterator to be incremented.
+// \param inc The number of elements the iterator is incremented.
+// \return The incremented iterator.
+*/
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator+( const PackedIterator<MT,SO>& it, size_t inc ) noexcept
+{
+   PackedIterator<MT,SO> tmp( it );
+   return tmp += inc;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition between an integral value and a PackedIterator.
+// \ingroup adaptors
+//
+// \param inc The number of elements the iterator is incremented.
+// \param it The iterator to be incremented.
+// \return The incremented iterator.
+*/
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator+( size_t inc, const PackedIterator<MT,SO>& it ) noexcept
+{
+   PackedIterator<MT,SO> tmp( it );
+   return tmp += inc;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction between a PackedIterator and an integral value.
+// \ingroup adaptors
+//
+// \param it The iterator to be decremented.
+// \param dec The number of elements the iterator is decremented.
+// \return The decremented iterator.
+*/
+template< typename MT, bool SO >
+inline const PackedIterator<MT,SO> operator-( const PackedIterator<MT,SO>& it, size_t dec ) noexcept
+{
+   PackedIterator<MT,SO> tmp( it );
+   return tmp -= dec;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
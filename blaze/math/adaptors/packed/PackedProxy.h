@@ -0,0 +1,775 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/adaptors/packed/PackedProxy.h
+//  \brief Header file for the PackedProxy class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_ADAPTORS_PACKED_PACKEDPROXY_H_
+#define _BLAZE_MATH_ADAPTORS_PACKED_PACKEDPROXY_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Exception.h>
+#include <blaze/math/proxy/Proxy.h>
+#include <blaze/math/shims/Clear.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/Invert.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsNaN.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/IsReal.h>
+#include <blaze/math/shims/IsZero.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Numeric.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/InvalidType.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsComplex.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Access proxy for the elements of adaptors with packed triangular storage.
+// \ingroup adaptors
+//
+// The PackedProxy provides controlled access to the elements of a symmetric, Hermitian, lower,
+// or upper matrix with packed storage (see PackedMatrix). It represents either an explicitly
+// stored element, optionally in conjugated form (in case the proxy refers to the non-stored
+// triangle of a Hermitian matrix), or an implicitly zero element (in case the proxy refers to
+// the non-stored triangle of a lower or upper matrix). Assigning a non-default value to an
+// implicitly zero element or a complex value with non-zero imaginary part to the diagonal of a
+// Hermitian matrix results in a \a std::invalid_argument exception:
+
+   \code
+   using blaze::PackedMatrix;
+
+   blaze::LowerMatrix< PackedMatrix<double> > L( 3UL );
+
+   L(2,0) = 1.0;  // Writes the element (2,0) in the packed storage
+   L(0,2) = 0.0;  // Valid assignment of the default value to an upper element
+   L(0,2) = 1.0;  // Throws an exception; invalid assignment to upper matrix element
+   \endcode
+*/
+template< typename ET >  // Type of the represented element
+class PackedProxy
+   : public Proxy< PackedProxy<ET> >
+{
+ private:
+   //**struct BuiltinType**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary struct to determine the value type of the represented complex element.
+   */
+   template< typename T >
+   struct BuiltinType { using Type = INVALID_TYPE; };
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**struct ComplexType**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Auxiliary struct to determine the value type of the represented complex element.
+   */
+   template< typename T >
+   struct ComplexType { using Type = typename T::value_type; };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using RepresentedType = ET;                  //!< Type of the represented matrix element.
+   using ConstReference  = const ET;            //!< Reference-to-const to the represented element.
+   using Pointer         = PackedProxy*;        //!< Pointer to the represented element.
+   using ConstPointer    = const PackedProxy*;  //!< Pointer-to-const to the represented element.
+
+   //! Value type of the represented complex element.
+   using ValueType = typename If_t< IsComplex_v<RepresentedType>
+                                  , ComplexType<RepresentedType>
+                                  , BuiltinType<RepresentedType> >::Type;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline PackedProxy( ET* value, bool conjugate, bool real ) noexcept;
+
+   PackedProxy( const PackedProxy& ) = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+   //**Operators***********************************************************************************
+   /*!\name Operators */
+   //@{
+                          inline PackedProxy& operator= ( const PackedProxy& pp );
+   template< typename T > inline PackedProxy& operator= ( const T& value );
+   template< typename T > inline PackedProxy& operator+=( const T& value );
+   template< typename T > inline PackedProxy& operator-=( const T& value );
+   template< typename T > inline PackedProxy& operator*=( const T& value );
+   template< typename T > inline PackedProxy& operator/=( const T& value );
+   template< typename T > inline PackedProxy& operator%=( const T& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Access operators****************************************************************************
+   /*!\name Access operators */
+   //@{
+   inline Pointer      operator->() noexcept;
+   inline ConstPointer operator->() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void reset () const;
+   inline void clear () const;
+   inline void invert() const;
+
+   inline ConstReference get() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Conversion operator*************************************************************************
+   /*!\name Conversion operator */
+   //@{
+   inline operator ConstReference() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Complex data access functions***************************************************************
+   /*!\name Complex data access functions */
+   //@{
+   inline ValueType real() const;
+   inline void      real( ValueType value ) const;
+   inline ValueType imag() const;
+   inline void      imag( ValueType value ) const;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void set( const ET& value ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   ET*   value_;      //!< Pointer to the stored element (\a nullptr for implicit zeros).
+   bool  conjugate_;  //!< Flag for an element stored in conjugated form.
+   bool  real_;       //!< Flag for an element restricted to real values.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( ET );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( ET );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( ET );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( ET );
+   BLAZE_CONSTRAINT_MUST_BE_NUMERIC_TYPE      ( ET );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization constructor for a PackedProxy.
+//
+// \param value Pointer to the stored element (\a nullptr in case of an implicit zero element).
+// \param conjugate \a true in case the element is stored in conjugated form, \a false if not.
+// \param real \a true in case the element is restricted to real values, \a false if not.
+*/
+template< typename ET >  // Type of the represented element
+inline PackedProxy<ET>::PackedProxy( ET* value, bool conjugate, bool real ) noexcept
+   : value_    ( value     )  // Pointer to the stored element
+   , conjugate_( conjugate )  // Flag for an element stored in conjugated form
+   , real_     ( real      )  // Flag for an element restricted to real values
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for PackedProxy.
+//
+// \param pp Packed proxy to be copied.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline PackedProxy<ET>& PackedProxy<ET>::operator=( const PackedProxy& pp )
+{
+   set( pp.get() );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment to the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator=( const T& value )
+{
+   set( value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be added to the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator+=( const T& value )
+{
+   set( get() + value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment to the accessed matrix element.
+//
+// \param value The right-hand side value to be subtracted from the matrix element.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator-=( const T& value )
+{
+   set( get() - value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the multiplication.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator*=( const T& value )
+{
+   set( get() * value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the division.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator/=( const T& value )
+{
+   set( get() / value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Modulo assignment to the accessed matrix element.
+//
+// \param value The right-hand side value for the modulo operation.
+// \return Reference to the assigned proxy.
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+template< typename T >   // Type of the right-hand side value
+inline PackedProxy<ET>& PackedProxy<ET>::operator%=( const T& value )
+{
+   set( get() % value );
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ACCESS OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Direct access to the accessed matrix element.
+//
+// \return Pointer to the accessed matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline typename PackedProxy<ET>::Pointer PackedProxy<ET>::operator->() noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Direct access to the accessed matrix element.
+//
+// \return Pointer to the accessed matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline typename PackedProxy<ET>::ConstPointer PackedProxy<ET>::operator->() const noexcept
+{
+   return this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reset the represented element to its default initial value.
+//
+// \return void
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::reset() const
+{
+   using blaze::reset;
+
+   if( value_ != nullptr )
+      reset( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+//
+// \return void
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::clear() const
+{
+   using blaze::clear;
+
+   if( value_ != nullptr )
+      clear( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the represented element
+//
+// \return void
+// \exception std::invalid_argument Invalid inversion of restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::invert() const
+{
+   using blaze::invert;
+
+   if( value_ == nullptr ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid inversion of restricted matrix element" );
+   }
+
+   invert( *value_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returning the value of the accessed matrix element.
+//
+// \return Copy of the accessed matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline typename PackedProxy<ET>::ConstReference PackedProxy<ET>::get() const noexcept
+{
+   if( value_ == nullptr )
+      return ET();
+   else if( conjugate_ )
+      return conj( *value_ );
+   else return *value_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the value of the accessed matrix element.
+//
+// \param value The new value of the matrix element.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+//
+// Assigning the default value to an implicit zero element is a no-op, any other value results
+// in a \a std::invalid_argument exception. The same exception is thrown in case a complex value
+// with non-zero imaginary part is assigned to the diagonal of a Hermitian matrix.
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::set( const ET& value ) const
+{
+   if( value_ == nullptr ) {
+      if( !isDefault( value ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to restricted matrix element" );
+      }
+      return;
+   }
+
+   if( IsComplex_v<ET> && real_ && !isReal( value ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid assignment to diagonal matrix element" );
+   }
+
+   *value_ = ( conjugate_ )?( conj( value ) ):( value );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONVERSION OPERATOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Conversion to the accessed matrix element.
+//
+// \return Copy of the accessed matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline PackedProxy<ET>::operator ConstReference() const noexcept
+{
+   return get();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPLEX DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the real part of the represented complex number.
+//
+// \return The current real part of the represented complex number.
+*/
+template< typename ET >  // Type of the represented element
+inline typename PackedProxy<ET>::ValueType PackedProxy<ET>::real() const
+{
+   return get().real();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the real part of the represented complex number.
+//
+// \param value The new value for the real part.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::real( ValueType value ) const
+{
+   ET tmp( get() );
+   tmp.real( value );
+   set( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the imaginary part of the represented complex number.
+//
+// \return The current imaginary part of the represented complex number.
+*/
+template< typename ET >  // Type of the represented element
+inline typename PackedProxy<ET>::ValueType PackedProxy<ET>::imag() const
+{
+   return get().imag();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the imaginary part of the represented complex number.
+//
+// \param value The new value for the imaginary part.
+// \return void
+// \exception std::invalid_argument Invalid assignment to restricted matrix element.
+// \exception std::invalid_argument Invalid assignment to diagonal matrix element.
+*/
+template< typename ET >  // Type of the represented element
+inline void PackedProxy<ET>::imag( ValueType value ) const
+{
+   ET tmp( get() );
+   tmp.imag( value );
+   set( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name PackedProxy global functions */
+//@{
+template< typename ET >
+inline void reset( const PackedProxy<ET>& proxy );
+
+template< typename ET >
+inline void clear( const PackedProxy<ET>& proxy );
+
+template< typename ET >
+inline void invert( const PackedProxy<ET>& proxy );
+
+template< bool RF, typename ET >
+inline bool isDefault( const PackedProxy<ET>& proxy );
+
+template< bool RF, typename ET >
+inline bool isReal( const PackedProxy<ET>& proxy );
+
+template< bool RF, typename ET >
+inline bool isZero( const PackedProxy<ET>& proxy );
+
+template< bool RF, typename ET >
+inline bool isOne( const PackedProxy<ET>& proxy );
+
+template< typename ET >
+inline bool isnan( const PackedProxy<ET>& proxy );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the represented element to the default initial values.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return void
+*/
+template< typename ET >
+inline void reset( const PackedProxy<ET>& proxy )
+{
+   proxy.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the represented element.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return void
+*/
+template< typename ET >
+inline void clear( const PackedProxy<ET>& proxy )
+{
+   proxy.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place inversion of the represented element.
+// \ingroup adaptors
+//
+// \param proxy The given proxy instance.
+// \return void
+*/
+template< typename ET >
+inline void invert( const PackedProxy<ET>& proxy )
+{
+   proxy.invert();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is in default state.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy
+// \return \a true in case the represented element is in default state, \a false otherwise.
+*/
+template< bool RF, typename ET >
+inline bool isDefault( const PackedProxy<ET>& proxy )
+{
+   using blaze::isDefault;
+
+   return isDefault<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix element represents a real number.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return \a true in case the matrix element represents a real number, \a false otherwise.
+*/
+template< bool RF, typename ET >
+inline bool isReal( const PackedProxy<ET>& proxy )
+{
+   using blaze::isReal;
+
+   return isReal<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 0.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 0, \a false otherwise.
+*/
+template< bool RF, typename ET >
+inline bool isZero( const PackedProxy<ET>& proxy )
+{
+   using blaze::isZero;
+
+   return isZero<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is 1.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is 1, \a false otherwise.
+*/
+template< bool RF, typename ET >
+inline bool isOne( const PackedProxy<ET>& proxy )
+{
+   using blaze::isOne;
+
+   return isOne<RF>( proxy.get() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the represented element is not a number.
+// \ingroup adaptors
+//
+// \param proxy The given access proxy.
+// \return \a true in case the represented element is in not a number, \a false otherwise.
+*/
+template< typename ET >
+inline bool isnan( const PackedProxy<ET>& proxy )
+{
+   using blaze::isnan;
+
+   return isnan( proxy.get() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
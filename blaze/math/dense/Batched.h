@@ -0,0 +1,873 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Batched.h
+//  \brief Header file for the batched operations on arrays of small dense matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_BATCHED_H_
+#define _BLAZE_MATH_DENSE_BATCHED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <stdexcept>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/dense/Inversion.h>
+#include <blaze/math/dense/NativeDecomposition.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/dense/StaticVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DMatDetExpr.h>
+#include <blaze/math/shims/IsDivisor.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BATCHED DENSE MATRIX FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Batched dense matrix functions */
+//@{
+template< typename Type, size_t N, bool SO >
+void batchInvert( StaticMatrix<Type,N,N,SO>* A, size_t size );
+
+template< typename Type, size_t N, bool SO >
+void batchDet( const StaticMatrix<Type,N,N,SO>* A, Type* dets, size_t size );
+
+template< typename Type, size_t N, bool SO >
+void batchSolve( const StaticMatrix<Type,N,N,SO>* A, StaticVector<Type,N,columnVector>* b, size_t size );
+
+template< typename Type, size_t M, size_t K, size_t N, bool SO1, bool SO2, bool SO3 >
+void batchMult( const StaticMatrix<Type,M,K,SO1>* A, const StaticMatrix<Type,K,N,SO2>* B,
+                StaticMatrix<Type,M,N,SO3>* C, size_t size );
+
+template< typename Type, size_t M, size_t N, bool SO >
+void batchMult( const StaticMatrix<Type,M,N,SO>* A, const StaticVector<Type,N,columnVector>* x,
+                StaticVector<Type,M,columnVector>* y, size_t size );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The number of matrices that are processed simultaneously by a batched operation.
+// \ingroup dense_matrix
+//
+// The batched operations transpose a block of \a batchWidth matrices into a structure-of-arrays
+// layout, where the same element of all matrices of the block is stored contiguously. Thus each
+// SIMD lane handles a separate matrix and the width of a block is a small multiple of the SIMD
+// width of the given element type.
+*/
+template< typename Type >  // Element type of the matrices
+constexpr size_t batchWidth = 4UL * SIMDTrait<Type>::size;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of a batched operation on the matrices \f$ [0..size) \f$.
+// \ingroup dense_matrix
+//
+// \param size The total number of matrices in the batch.
+// \param kernel The serial kernel for a range of matrices.
+// \return void
+//
+// This function calls \c kernel(begin,end) for consecutive ranges of the batch. In case the
+// batch contains at least as many matrices as specified by the SMP_DMATBATCH_THRESHOLD, the
+// batch is split into several ranges (each one a multiple of the batch width) that are
+// processed in parallel. Otherwise the complete batch is processed by a single, serial call.
+*/
+template< typename Type      // Element type of the matrices
+        , typename Kernel >  // Type of the batch kernel
+void batchFor( size_t size, Kernel kernel )
+{
+   constexpr size_t W( batchWidth<Type> );
+
+   if( size == 0UL ) {
+      return;
+   }
+
+   if( size < SMP_DMATBATCH_THRESHOLD ) {
+      kernel( 0UL, size );
+      return;
+   }
+
+   const size_t blocks( ( size - 1UL ) / W + 1UL );
+   const size_t tasks ( min( 4UL*getNumThreads(), blocks ) );
+   const size_t range ( ( ( blocks - 1UL ) / tasks + 1UL ) * W );
+
+   smpFor( tasks, [size,range,&kernel]( size_t task )
+   {
+      const size_t begin( task * range );
+
+      if( begin < size ) {
+         kernel( begin, min( begin + range, size ) );
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a block of dense matrices into the structure-of-arrays layout.
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first matrix of the block.
+// \param lanes The number of matrices in the block \f$[0..W]\f$.
+// \param a The structure-of-arrays representation of the block.
+// \return void
+//
+// The unused lanes of an incomplete block are initialized as identity matrices such that they
+// can be processed like all other lanes without causing floating point exceptions.
+*/
+template< typename Type  // Element type of the matrices
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO        // Storage order
+        , size_t W >     // Width of the block
+void batchGather( const StaticMatrix<Type,M,N,SO>* A, size_t lanes, Type (&a)[M][N][W] )
+{
+   BLAZE_INTERNAL_ASSERT( lanes <= W, "Invalid number of lanes detected" );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t l=0UL; l<lanes; ++l ) {
+            a[i][j][l] = A[l](i,j);
+         }
+      }
+   }
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t l=lanes; l<W; ++l ) {
+            a[i][j][l] = ( i == j ? Type(1) : Type(0) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a block of dense column vectors into the structure-of-arrays layout.
+// \ingroup dense_matrix
+//
+// \param x Pointer to the first vector of the block.
+// \param lanes The number of vectors in the block \f$[0..W]\f$.
+// \param a The structure-of-arrays representation of the block.
+// \return void
+*/
+template< typename Type  // Element type of the vectors
+        , size_t N       // Number of elements
+        , size_t W >     // Width of the block
+void batchGather( const StaticVector<Type,N,columnVector>* x, size_t lanes, Type (&a)[N][1UL][W] )
+{
+   BLAZE_INTERNAL_ASSERT( lanes <= W, "Invalid number of lanes detected" );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t l=0UL; l<lanes; ++l ) {
+         a[i][0UL][l] = x[l][i];
+      }
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t l=lanes; l<W; ++l ) {
+         a[i][0UL][l] = Type(0);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a block of dense matrices back from the structure-of-arrays layout.
+// \ingroup dense_matrix
+//
+// \param a The structure-of-arrays representation of the block.
+// \param lanes The number of matrices in the block \f$[0..W]\f$.
+// \param A Pointer to the first matrix of the block.
+// \return void
+*/
+template< typename Type  // Element type of the matrices
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO        // Storage order
+        , size_t W >     // Width of the block
+void batchScatter( const Type (&a)[M][N][W], size_t lanes, StaticMatrix<Type,M,N,SO>* A )
+{
+   BLAZE_INTERNAL_ASSERT( lanes <= W, "Invalid number of lanes detected" );
+
+   for( size_t i=0UL; i<M; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         for( size_t l=0UL; l<lanes; ++l ) {
+            A[l](i,j) = a[i][j][l];
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a block of dense column vectors back from the structure-of-arrays layout.
+// \ingroup dense_matrix
+//
+// \param a The structure-of-arrays representation of the block.
+// \param lanes The number of vectors in the block \f$[0..W]\f$.
+// \param x Pointer to the first vector of the block.
+// \return void
+*/
+template< typename Type  // Element type of the vectors
+        , size_t N       // Number of elements
+        , size_t W >     // Width of the block
+void batchScatter( const Type (&a)[N][1UL][W], size_t lanes, StaticVector<Type,N,columnVector>* x )
+{
+   BLAZE_INTERNAL_ASSERT( lanes <= W, "Invalid number of lanes detected" );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t l=0UL; l<lanes; ++l ) {
+         x[l][i] = a[i][0UL][l];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check for the vectorization of the batched kernels.
+// \ingroup dense_matrix
+//
+// In case the given element type can be processed by means of SIMD operations (addition,
+// subtraction, and multiplication), the variable will be set to 1, otherwise it will be 0.
+*/
+template< typename Type >  // Element type of the matrices
+constexpr bool UseVectorizedBatchKernel_v =
+   ( IsVectorizable_v<Type> && HasSIMDAdd_v<Type,Type> &&
+     HasSIMDSub_v<Type,Type> && HasSIMDMult_v<Type,Type> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a SIMD vector of lanes of a structure-of-arrays block.
+// \ingroup dense_matrix
+//
+// \param address The aligned address of the first lane.
+// \return The loaded SIMD vector.
+*/
+template< typename Type >  // Element type of the block
+BLAZE_ALWAYS_INLINE EnableIf_t< UseVectorizedBatchKernel_v<Type>, SIMDTrait_t<Type> >
+   batchLoad( const Type* address ) noexcept
+{
+   return loada( address );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads a single lane of a structure-of-arrays block.
+// \ingroup dense_matrix
+//
+// \param address The address of the lane.
+// \return The loaded value.
+*/
+template< typename Type >  // Element type of the block
+BLAZE_ALWAYS_INLINE DisableIf_t< UseVectorizedBatchKernel_v<Type>, Type >
+   batchLoad( const Type* address ) noexcept
+{
+   return *address;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Broadcasts a value to all elements of a SIMD vector of lanes.
+// \ingroup dense_matrix
+//
+// \param value The value to be broadcast.
+// \return The resulting SIMD vector.
+*/
+template< typename Type >  // Element type of the block
+BLAZE_ALWAYS_INLINE EnableIf_t< UseVectorizedBatchKernel_v<Type>, SIMDTrait_t<Type> >
+   batchSet( const Type& value ) noexcept
+{
+   return set( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the given value as a single lane.
+// \ingroup dense_matrix
+//
+// \param value The given value.
+// \return The unmodified value.
+*/
+template< typename Type >  // Element type of the block
+BLAZE_ALWAYS_INLINE DisableIf_t< UseVectorizedBatchKernel_v<Type>, Type >
+   batchSet( const Type& value ) noexcept
+{
+   return value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a SIMD vector to lanes of a structure-of-arrays block.
+// \ingroup dense_matrix
+//
+// \param address The aligned address of the first lane.
+// \param value The SIMD vector to be stored.
+// \return void
+*/
+template< typename Type     // Element type of the block
+        , typename T2 >     // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE EnableIf_t< UseVectorizedBatchKernel_v<Type> >
+   batchStore( Type* address, const SIMDPack<T2>& value ) noexcept
+{
+   storea( address, ~value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Stores a single lane of a structure-of-arrays block.
+// \ingroup dense_matrix
+//
+// \param address The address of the lane.
+// \param value The value to be stored.
+// \return void
+*/
+template< typename Type >  // Element type of the block
+BLAZE_ALWAYS_INLINE DisableIf_t< UseVectorizedBatchKernel_v<Type> >
+   batchStore( Type* address, const Type& value ) noexcept
+{
+   *address = value;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Lane-wise Gaussian elimination with partial pivoting on a block of square matrices.
+// \ingroup dense_matrix
+//
+// \param a The structure-of-arrays representation of the system matrices.
+// \param b The structure-of-arrays representation of the right-hand sides.
+// \param det The resulting determinants of the system matrices.
+// \return void
+//
+// This function performs a Gaussian elimination with partial pivoting on all lanes of the given
+// block at the same time and afterwards solves for the first \a R columns of the right-hand side
+// by backward substitution. All arithmetic operations work on complete SIMD vectors of lanes.
+// The row interchanges are determined separately per lane and are applied by means of a 0/1
+// mask: \f$ x'=m*y+(1-m)*x \f$ and \f$ y'=m*x+(1-m)*y \f$, which is exact for all finite
+// values. In case the system matrix of a lane is singular, its determinant is zero and the
+// according right-hand side is undefined.
+*/
+template< size_t R       // Number of right-hand side columns to be solved for
+        , typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , size_t RB      // Number of columns of the right-hand side
+        , size_t W >     // Width of the block
+void batchEliminate( Type (&a)[N][N][W], Type (&b)[N][RB][W], Type (&det)[W] )
+{
+   BLAZE_STATIC_ASSERT( R <= RB );
+
+   constexpr size_t SIMDSIZE( UseVectorizedBatchKernel_v<Type> ? SIMDTrait<Type>::size : 1UL );
+
+   BLAZE_STATIC_ASSERT( W % SIMDSIZE == 0UL );
+
+   using SIMDType = decltype( batchLoad( det ) );
+
+   const SIMDType one( batchSet( Type(1) ) );
+
+   alignas( AlignmentOf_v<Type> ) Type mask[W];
+
+   for( size_t l=0UL; l<W; ++l ) {
+      det[l] = Type(1);
+   }
+
+   for( size_t k=0UL; k<N; ++k )
+   {
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         for( size_t l=0UL; l<W; ++l ) {
+            const bool swap( nativeAbs1( a[i][k][l] ) > nativeAbs1( a[k][k][l] ) );
+            mask[l] = ( swap ? Type(1) : Type(0) );
+            det[l]  = ( swap ? -det[l] : det[l] );
+         }
+
+         for( size_t l=0UL; l<W; l+=SIMDSIZE )
+         {
+            const SIMDType m1( batchLoad( mask+l ) );
+            const SIMDType m2( one - m1 );
+
+            for( size_t j=k; j<N; ++j ) {
+               const SIMDType x( batchLoad( a[k][j]+l ) );
+               const SIMDType y( batchLoad( a[i][j]+l ) );
+               batchStore( a[k][j]+l, m1*y + m2*x );
+               batchStore( a[i][j]+l, m1*x + m2*y );
+            }
+
+            for( size_t j=0UL; j<R; ++j ) {
+               const SIMDType x( batchLoad( b[k][j]+l ) );
+               const SIMDType y( batchLoad( b[i][j]+l ) );
+               batchStore( b[k][j]+l, m1*y + m2*x );
+               batchStore( b[i][j]+l, m1*x + m2*y );
+            }
+         }
+      }
+
+      for( size_t l=0UL; l<W; ++l ) {
+         const Type pivot( a[k][k][l] );
+         det[l] *= pivot;
+         a[k][k][l] = Type(1) / ( pivot == Type(0) ? Type(1) : pivot );
+      }
+
+      for( size_t i=k+1UL; i<N; ++i )
+      {
+         for( size_t l=0UL; l<W; l+=SIMDSIZE )
+         {
+            const SIMDType factor( batchLoad( a[i][k]+l ) * batchLoad( a[k][k]+l ) );
+
+            for( size_t j=k+1UL; j<N; ++j ) {
+               batchStore( a[i][j]+l, batchLoad( a[i][j]+l ) - factor * batchLoad( a[k][j]+l ) );
+            }
+
+            for( size_t j=0UL; j<R; ++j ) {
+               batchStore( b[i][j]+l, batchLoad( b[i][j]+l ) - factor * batchLoad( b[k][j]+l ) );
+            }
+         }
+      }
+   }
+
+   for( size_t i=N; R > 0UL && i-- > 0UL; )
+   {
+      for( size_t j=0UL; j<R; ++j )
+      {
+         for( size_t l=0UL; l<W; l+=SIMDSIZE )
+         {
+            SIMDType tmp( batchLoad( b[i][j]+l ) );
+
+            for( size_t m=i+1UL; m<N; ++m ) {
+               tmp -= batchLoad( a[i][m]+l ) * batchLoad( b[m][j]+l );
+            }
+
+            batchStore( b[i][j]+l, tmp * batchLoad( a[i][i]+l ) );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*!\brief In-place inversion of an array of small square dense matrices.
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first matrix of the array.
+// \param size The total number of matrices in the array.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function inverts all \a size matrices of the given array. In contrast to calling invert()
+// for each single matrix, matrices larger than \f$ 4 \times 4 \f$ are transposed block-wise
+// into a structure-of-arrays layout such that every SIMD lane works on a separate matrix (see
+// \a batchWidth). The inversion is based on a Gaussian elimination with partial pivoting. Up to
+// \f$ 4 \times 4 \f$ matrices the closed-form kernels of the invert() function are faster than
+// the transposition and are used instead. In case the array contains at least
+// \a BLAZE_SMP_DMATBATCH_THRESHOLD matrices, the work is distributed among all available
+// threads.
+
+   \code
+   blaze::DynamicVector< blaze::StaticMatrix<double,3UL,3UL> > A( 100000UL );
+   // ... Initialization
+
+   blaze::batchInvert( A.data(), A.size() );
+   \endcode
+
+// In case at least one of the matrices is singular, a \a std::runtime_error exception is thrown
+// after all matrices have been processed. The content of the singular matrices is undefined,
+// all other matrices are properly inverted.
+//
+// \note This function can only be used for matrices with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with matrices of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void batchInvert( StaticMatrix<Type,N,N,SO>* A, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   std::atomic<bool> singular( false );
+
+   batchFor<Type>( size, [A,&singular]( size_t begin, size_t end )
+   {
+      // From 2x2 up to 4x4 matrices the closed-form inversion kernels are faster than the
+      // transposition (the 1x1 case is handled by the transposition to detect singularity)
+      if( N > 1UL && N <= 4UL ) {
+         for( size_t i=begin; i<end; ++i ) {
+            try {
+               invert( A[i] );
+            }
+            catch( std::runtime_error& ) {
+               singular = true;
+            }
+         }
+         return;
+      }
+
+      constexpr size_t W( batchWidth<Type> );
+
+      alignas( AlignmentOf_v<Type> ) Type a[N][N][W];
+      alignas( AlignmentOf_v<Type> ) Type b[N][N][W];
+      alignas( AlignmentOf_v<Type> ) Type det[W];
+
+      for( size_t index=begin; index<end; index+=W )
+      {
+         const size_t lanes( min( W, end-index ) );
+
+         batchGather( A+index, lanes, a );
+
+         for( size_t i=0UL; i<N; ++i ) {
+            for( size_t j=0UL; j<N; ++j ) {
+               for( size_t l=0UL; l<W; ++l ) {
+                  b[i][j][l] = ( i == j ? Type(1) : Type(0) );
+               }
+            }
+         }
+
+         batchEliminate<N>( a, b, det );
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            if( !isDivisor( det[l] ) ) {
+               singular = true;
+            }
+         }
+
+         batchScatter( b, lanes, A+index );
+      }
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the determinants of an array of small square dense matrices.
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first matrix of the array.
+// \param dets Pointer to the first element of the resulting array of determinants.
+// \param size The total number of matrices in the array.
+// \return void
+//
+// This function computes the determinant of all \a size matrices of the given array and stores
+// the results in the given array \a dets, which is required to provide space for \a size
+// elements. Up to \f$ 6 \times 6 \f$ matrices the determinants are computed by the closed-form
+// kernels of the det() function, for larger matrices the computation is based on a lane-wise
+// Gaussian elimination with partial pivoting on blocks of matrices in structure-of-arrays
+// layout (see batchInvert()). In case the array contains at least \a BLAZE_SMP_DMATBATCH_THRESHOLD
+// matrices, the computation is distributed among all available threads.
+
+   \code
+   blaze::DynamicVector< blaze::StaticMatrix<double,3UL,3UL> > A( 100000UL );
+   blaze::DynamicVector<double> d( A.size() );
+   // ... Initialization
+
+   blaze::batchDet( A.data(), d.data(), A.size() );
+   \endcode
+
+// \note This function can only be used for matrices with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with matrices of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void batchDet( const StaticMatrix<Type,N,N,SO>* A, Type* dets, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   batchFor<Type>( size, [A,dets]( size_t begin, size_t end )
+   {
+      // Up to 6x6 matrices the closed-form determinant kernels are faster than the transposition
+      if( N <= 6UL ) {
+         for( size_t i=begin; i<end; ++i ) {
+            dets[i] = det( A[i] );
+         }
+         return;
+      }
+
+      constexpr size_t W( batchWidth<Type> );
+
+      alignas( AlignmentOf_v<Type> ) Type a[N][N][W];
+      alignas( AlignmentOf_v<Type> ) Type b[N][1UL][W];
+      alignas( AlignmentOf_v<Type> ) Type d[W];
+
+      for( size_t index=begin; index<end; index+=W )
+      {
+         const size_t lanes( min( W, end-index ) );
+
+         batchGather( A+index, lanes, a );
+         batchEliminate<0UL>( a, b, d );
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            dets[index+l] = d[l];
+         }
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solution of an array of small dense linear systems of equations.
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first system matrix of the array.
+// \param b Pointer to the first right-hand side vector of the array.
+// \param size The total number of linear systems.
+// \return void
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function solves the \a size linear systems of equations \f$ A_i x_i = b_i \f$ and
+// overwrites each right-hand side vector \f$ b_i \f$ with the according solution \f$ x_i \f$.
+// The system matrices are not modified. The computation is based on a lane-wise Gaussian
+// elimination with partial pivoting on blocks of systems in structure-of-arrays layout (see
+// batchInvert()).
+
+   \code
+   blaze::DynamicVector< blaze::StaticMatrix<double,6UL,6UL> > A( 100000UL );
+   blaze::DynamicVector< blaze::StaticVector<double,6UL> > b( A.size() );
+   // ... Initialization
+
+   blaze::batchSolve( A.data(), b.data(), A.size() );
+   \endcode
+
+// In case at least one of the system matrices is singular, a \a std::runtime_error exception is
+// thrown after all systems have been processed. The content of the according right-hand side
+// vectors is undefined, all other systems are properly solved.
+//
+// \note This function can only be used for matrices with \c float, \c double, \c complex<float>
+// or \c complex<double> element type. The attempt to call the function with matrices of any
+// other element type results in a compile time error!
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void batchSolve( const StaticMatrix<Type,N,N,SO>* A, StaticVector<Type,N,columnVector>* b, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( Type );
+
+   std::atomic<bool> singular( false );
+
+   batchFor<Type>( size, [A,b,&singular]( size_t begin, size_t end )
+   {
+      constexpr size_t W( batchWidth<Type> );
+
+      alignas( AlignmentOf_v<Type> ) Type a[N][N][W];
+      alignas( AlignmentOf_v<Type> ) Type x[N][1UL][W];
+      alignas( AlignmentOf_v<Type> ) Type det[W];
+
+      for( size_t index=begin; index<end; index+=W )
+      {
+         const size_t lanes( min( W, end-index ) );
+
+         batchGather( A+index, lanes, a );
+         batchGather( b+index, lanes, x );
+         batchEliminate<1UL>( a, x, det );
+
+         for( size_t l=0UL; l<lanes; ++l ) {
+            if( !isDivisor( det[l] ) ) {
+               singular = true;
+            }
+         }
+
+         batchScatter( x, lanes, b+index );
+      }
+   } );
+
+   if( singular ) {
+      BLAZE_THROW_DIVISION_BY_ZERO( "Inversion of singular matrix failed" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of two arrays of small dense matrices (\f$ C_i=A_i*B_i \f$).
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first left-hand side matrix of the array.
+// \param B Pointer to the first right-hand side matrix of the array.
+// \param C Pointer to the first result matrix of the array.
+// \param size The total number of matrix multiplications.
+// \return void
+//
+// This function computes the \a size matrix products \f$ C_i=A_i*B_i \f$. In case the arrays
+// contain at least \a BLAZE_SMP_DMATBATCH_THRESHOLD matrices, the products are distributed
+// among all available threads. Note that in contrast to batchInvert() the products are not
+// transposed into a structure-of-arrays layout: The (padded) multiplication kernels of the
+// StaticMatrix class template are faster than the transposition of the operands alone. The
+// result array may be identical to one of the operand arrays.
+
+   \code
+   blaze::DynamicVector< blaze::StaticMatrix<double,3UL,3UL> > A( 100000UL ), B( A.size() ), C( A.size() );
+   // ... Initialization
+
+   blaze::batchMult( A.data(), B.data(), C.data(), A.size() );
+   \endcode
+*/
+template< typename Type  // Element type of the matrices
+        , size_t M       // Number of rows of the left-hand side matrices
+        , size_t K       // Number of columns of the left-hand side matrices
+        , size_t N       // Number of columns of the right-hand side matrices
+        , bool SO1       // Storage order of the left-hand side matrices
+        , bool SO2       // Storage order of the right-hand side matrices
+        , bool SO3 >     // Storage order of the result matrices
+void batchMult( const StaticMatrix<Type,M,K,SO1>* A, const StaticMatrix<Type,K,N,SO2>* B,
+                StaticMatrix<Type,M,N,SO3>* C, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   batchFor<Type>( size, [A,B,C]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         C[i] = A[i] * B[i];
+      }
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication of an array of small dense matrices and an array of small dense vectors
+//        (\f$ y_i=A_i*x_i \f$).
+// \ingroup dense_matrix
+//
+// \param A Pointer to the first matrix of the array.
+// \param x Pointer to the first right-hand side vector of the array.
+// \param y Pointer to the first result vector of the array.
+// \param size The total number of matrix/vector multiplications.
+// \return void
+//
+// This function computes the \a size matrix/vector products \f$ y_i=A_i*x_i \f$. In case the
+// arrays contain at least \a BLAZE_SMP_DMATBATCH_THRESHOLD elements, the products are
+// distributed among all available threads (see batchMult() for matrix products). The result
+// array may be identical to the vector operand array.
+
+   \code
+   blaze::DynamicVector< blaze::StaticMatrix<double,3UL,3UL> > A( 100000UL );
+   blaze::DynamicVector< blaze::StaticVector<double,3UL> > x( A.size() ), y( A.size() );
+   // ... Initialization
+
+   blaze::batchMult( A.data(), x.data(), y.data(), A.size() );
+   \endcode
+*/
+template< typename Type  // Element type of the matrices and vectors
+        , size_t M       // Number of rows of the matrices
+        , size_t N       // Number of columns of the matrices
+        , bool SO >      // Storage order of the matrices
+void batchMult( const StaticMatrix<Type,M,N,SO>* A, const StaticVector<Type,N,columnVector>* x,
+                StaticVector<Type,M,columnVector>* y, size_t size )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   batchFor<Type>( size, [A,x,y]( size_t begin, size_t end )
+   {
+      for( size_t i=begin; i<end; ++i ) {
+         y[i] = A[i] * x[i];
+      }
+   } );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
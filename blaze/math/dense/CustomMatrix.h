@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MaskedTail.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -2464,6 +2465,7 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::assign( const DenseMatrix<MT,SO>& rh
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    const size_t jpos( ( remainder )?( n_ & size_t(-SIMDSIZE) ):( n_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( n_ - ( n_ % (SIMDSIZE) ) ) == jpos, "Invalid end calculation" );
@@ -2480,7 +2482,11 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::assign( const DenseMatrix<MT,SO>& rh
          for( ; j<jpos; j+=SIMDSIZE ) {
             left.stream( right.load() ); left += SIMDSIZE, right += SIMDSIZE;
          }
-         for( ; remainder && j<n_; ++j ) {
+         if( masked && j<n_ ) {
+            const size_t n( n_ - j );
+            storem( v_+i*nn_+j, n, loadTail( ~rhs, i, j, n ) );
+         }
+         for( ; !masked && remainder && j<n_; ++j ) {
             *left = *right; ++left; ++right;
          }
       }
@@ -2502,7 +2508,11 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::assign( const DenseMatrix<MT,SO>& rh
          for( ; j<jpos; j+=SIMDSIZE ) {
             left.store( right.load() ); left+=SIMDSIZE, right+=SIMDSIZE;
          }
-         for( ; remainder && j<n_; ++j ) {
+         if( masked && j<n_ ) {
+            const size_t n( n_ - j );
+            storem( v_+i*nn_+j, n, loadTail( ~rhs, i, j, n ) );
+         }
+         for( ; !masked && remainder && j<n_; ++j ) {
             *left = *right; ++left; ++right;
          }
       }
@@ -2693,6 +2703,7 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::addAssign( const DenseMatrix<MT,SO>&
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t i=0UL; i<m_; ++i )
    {
@@ -2720,7 +2731,11 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::addAssign( const DenseMatrix<MT,SO>&
       for( ; j<jpos; j+=SIMDSIZE ) {
          left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && j<jend; ++j ) {
+      if( masked && j<jend ) {
+         const size_t n( jend - j );
+         storem( v_+i*nn_+j, n, loadm( v_+i*nn_+j, n ) + loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && j<jend; ++j ) {
          *left += *right; ++left; ++right;
       }
    }
@@ -2922,6 +2937,7 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::subAssign( const DenseMatrix<MT,SO>&
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t i=0UL; i<m_; ++i )
    {
@@ -2949,7 +2965,11 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::subAssign( const DenseMatrix<MT,SO>&
       for( ; j<jpos; j+=SIMDSIZE ) {
          left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && j<jend; ++j ) {
+      if( masked && j<jend ) {
+         const size_t n( jend - j );
+         storem( v_+i*nn_+j, n, loadm( v_+i*nn_+j, n ) - loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && j<jend; ++j ) {
          *left -= *right; ++left; ++right;
       }
    }
@@ -3135,6 +3155,7 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::schurAssign( const DenseMatrix<MT,SO
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t i=0UL; i<m_; ++i )
    {
@@ -3154,7 +3175,11 @@ inline auto CustomMatrix<Type,AF,PF,SO,RT>::schurAssign( const DenseMatrix<MT,SO
       for( ; j<jpos; j+=SIMDSIZE ) {
          left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && j<n_; ++j ) {
+      if( masked && j<n_ ) {
+         const size_t n( n_ - j );
+         storem( v_+i*nn_+j, n, loadm( v_+i*nn_+j, n ) * loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && j<n_; ++j ) {
          *left *= *right; ++left; ++right;
       }
    }
@@ -5352,6 +5377,7 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::assign( const DenseMatrix<MT,true>
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    const size_t ipos( ( remainder )?( m_ & size_t(-SIMDSIZE) ):( m_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( m_ - ( m_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -5368,7 +5394,11 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::assign( const DenseMatrix<MT,true>
          for( ; i<ipos; i+=SIMDSIZE ) {
             left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
          }
-         for( ; remainder && i<m_; ++i ) {
+         if( masked && i<m_ ) {
+            const size_t n( m_ - i );
+            storem( v_+i+j*mm_, n, loadTail( ~rhs, i, j, n ) );
+         }
+         for( ; !masked && remainder && i<m_; ++i ) {
             *left = *right; ++left; ++right;
          }
       }
@@ -5390,7 +5420,11 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::assign( const DenseMatrix<MT,true>
          for( ; i<ipos; i+=SIMDSIZE ) {
             left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
          }
-         for( ; remainder && i<m_; ++i ) {
+         if( masked && i<m_ ) {
+            const size_t n( m_ - i );
+            storem( v_+i+j*mm_, n, loadTail( ~rhs, i, j, n ) );
+         }
+         for( ; !masked && remainder && i<m_; ++i ) {
             *left = *right; ++left; ++right;
          }
       }
@@ -5586,6 +5620,7 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::addAssign( const DenseMatrix<MT,tr
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t j=0UL; j<n_; ++j )
    {
@@ -5613,7 +5648,11 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::addAssign( const DenseMatrix<MT,tr
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && i<iend; ++i ) {
+      if( masked && i<iend ) {
+         const size_t n( iend - i );
+         storem( v_+i+j*mm_, n, loadm( v_+i+j*mm_, n ) + loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && i<iend; ++i ) {
          *left += *right; ++left; ++right;
       }
    }
@@ -5821,6 +5860,7 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::subAssign( const DenseMatrix<MT,tr
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t j=0UL; j<n_; ++j )
    {
@@ -5848,7 +5888,11 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::subAssign( const DenseMatrix<MT,tr
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && i<iend; ++i ) {
+      if( masked && i<iend ) {
+         const size_t n( iend - i );
+         storem( v_+i+j*mm_, n, loadm( v_+i+j*mm_, n ) - loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && i<iend; ++i ) {
          *left -= *right; ++left; ++right;
       }
    }
@@ -6040,6 +6084,7 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::schurAssign( const DenseMatrix<MT,
    BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
 
    constexpr bool remainder( !PF || !IsPadded_v<MT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<MT> );
 
    for( size_t j=0UL; j<n_; ++j )
    {
@@ -6059,7 +6104,11 @@ inline auto CustomMatrix<Type,AF,PF,true,RT>::schurAssign( const DenseMatrix<MT,
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && i<m_; ++i ) {
+      if( masked && i<m_ ) {
+         const size_t n( m_ - i );
+         storem( v_+i+j*mm_, n, loadm( v_+i+j*mm_, n ) * loadTail( ~rhs, i, j, n ) );
+      }
+      for( ; !masked && remainder && i<m_; ++i ) {
          *left *= *right; ++left; ++right;
       }
    }
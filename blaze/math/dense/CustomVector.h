@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
 #include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/dense/MaskedTail.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -2167,6 +2168,8 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::assign( const DenseVector<VT,TF>& rh
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   constexpr bool masked( HasMaskedTail_v<VT> );
+
    const size_t ipos( size_ & size_t(-SIMDSIZE) );
    BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
@@ -2177,7 +2180,11 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::assign( const DenseVector<VT,TF>& rh
       for( ; i<ipos; i+=SIMDSIZE ) {
          stream( i, (~rhs).load(i) );
       }
-      for( ; i<size_; ++i ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && i<size_; ++i ) {
          v_[i] = (~rhs)[i];
       }
    }
@@ -2199,7 +2206,11 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::assign( const DenseVector<VT,TF>& rh
       for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
          store( i, it.load() );
       }
-      for( ; i<size_; ++i, ++it ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && i<size_; ++i, ++it ) {
          v_[i] = *it;
       }
    }
@@ -2293,6 +2304,8 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::addAssign( const DenseVector<VT,TF>&
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   constexpr bool masked( HasMaskedTail_v<VT> );
+
    const size_t ipos( size_ & size_t(-SIMDSIZE) );
    BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
@@ -2312,7 +2325,11 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::addAssign( const DenseVector<VT,TF>&
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) + it.load() );
    }
-   for( ; i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) + loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && i<size_; ++i, ++it ) {
       v_[i] += *it;
    }
 }
@@ -2405,6 +2422,8 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::subAssign( const DenseVector<VT,TF>&
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   constexpr bool masked( HasMaskedTail_v<VT> );
+
    const size_t ipos( size_ & size_t(-SIMDSIZE) );
    BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
@@ -2424,7 +2443,11 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::subAssign( const DenseVector<VT,TF>&
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) - it.load() );
    }
-   for( ; i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) - loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && i<size_; ++i, ++it ) {
       v_[i] -= *it;
    }
 }
@@ -2517,6 +2540,8 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::multAssign( const DenseVector<VT,TF>
 
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
+   constexpr bool masked( HasMaskedTail_v<VT> );
+
    const size_t ipos( size_ & size_t(-SIMDSIZE) );
    BLAZE_INTERNAL_ASSERT( ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
 
@@ -2536,7 +2561,11 @@ inline auto CustomVector<Type,AF,PF,TF,RT>::multAssign( const DenseVector<VT,TF>
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) * it.load() );
    }
-   for( ; i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) * loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && i<size_; ++i, ++it ) {
       v_[i] *= *it;
    }
 }
@@ -4444,6 +4473,7 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::assign( const DenseVector<VT,TF>
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
@@ -4455,7 +4485,11 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::assign( const DenseVector<VT,TF>
       for( ; i<ipos; i+=SIMDSIZE ) {
          stream( i, (~rhs).load(i) );
       }
-      for( ; remainder && i<size_; ++i ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && remainder && i<size_; ++i ) {
          v_[i] = (~rhs)[i];
       }
    }
@@ -4477,7 +4511,11 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::assign( const DenseVector<VT,TF>
       for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
          store( i, it.load() );
       }
-      for( ; remainder && i<size_; ++i, ++it ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && remainder && i<size_; ++i, ++it ) {
          v_[i] = *it;
       }
    }
@@ -4575,6 +4613,7 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::addAssign( const DenseVector<VT,
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
@@ -4595,7 +4634,11 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::addAssign( const DenseVector<VT,
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) + it.load() );
    }
-   for( ; remainder && i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) + loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i, ++it ) {
       v_[i] += *it;
    }
 }
@@ -4692,6 +4735,7 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::subAssign( const DenseVector<VT,
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
@@ -4712,7 +4756,11 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::subAssign( const DenseVector<VT,
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) - it.load() );
    }
-   for( ; remainder && i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) - loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i, ++it ) {
       v_[i] -= *it;
    }
 }
@@ -4809,6 +4857,7 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::multAssign( const DenseVector<VT
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
@@ -4829,7 +4878,11 @@ inline auto CustomVector<Type,AF,padded,TF,RT>::multAssign( const DenseVector<VT
    for( ; i<ipos; i+=SIMDSIZE, it+=SIMDSIZE ) {
       store( i, load(i) * it.load() );
    }
-   for( ; remainder && i<size_; ++i, ++it ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) * loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i, ++it ) {
       v_[i] *= *it;
    }
 }
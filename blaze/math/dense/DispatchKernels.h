@@ -0,0 +1,1145 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/DispatchKernels.h
+//  \brief Header file for the runtime dispatched dense compute kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_DENSE_DISPATCHKERNELS_H_
+#define _BLAZE_MATH_DENSE_DISPATCHKERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/Pow2.h>
+#include <blaze/math/simd/Dispatch.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  DISPATCH CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the dispatched kernels support the given element type.
+// \ingroup simd
+//
+// This variable template evaluates to \a true in case the runtime dispatch mode is active (see
+// the BLAZE_DISPATCH_MODE switch) and the given type is either \c float or \c double.
+*/
+template< typename T >
+constexpr bool IsDispatchable_v =
+   ( BLAZE_DISPATCH_MODE && ( IsSame_v<T,float> || IsSame_v<T,double> ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Minimum number of elements for the dispatched vector kernels.
+// \ingroup simd
+//
+// Vectors with fewer elements are handled by the kernels selected at compile time, since the
+// selection of the dispatched kernel would dominate the computation.
+*/
+constexpr size_t DISPATCH_MIN_SIZE = 64UL;
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the dispatched kernels are used instead of the compiled kernels.
+// \ingroup simd
+//
+// \return \a true in case the selected instruction set exceeds the compiled one, \a false if not.
+*/
+BLAZE_ALWAYS_INLINE bool isDispatched() noexcept
+{
+   return BLAZE_DISPATCH_MODE && getInstructionSet() > compiledInstructionSet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+#if BLAZE_DISPATCH_MODE
+//=================================================================================================
+//
+//  INSTRUCTION SET SPECIFIC OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#define BLAZE_TARGET_AVX2   __attribute__(( target( "avx2,fma" ) ))
+#define BLAZE_TARGET_AVX512 __attribute__(( target( "avx512f,avx2,fma" ) ))
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD operations of the AVX2 kernels.
+// \ingroup simd
+//
+// The DispatchAVX2 class template wraps the AVX2/FMA intrinsics of the dispatched kernels for
+// \c float and \c double. All functions are compiled for the AVX2 instruction set independent
+// of the instruction set selected at compile time and must only be called from AVX2 kernels.
+*/
+template< typename T >
+struct DispatchAVX2;
+
+template<>
+struct DispatchAVX2<double>
+{
+   using Type = __m256d;
+   static constexpr size_t size = 4UL;
+
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm256_setzero_pd(); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm256_set1_pd( v ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm256_loadu_pd( p ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm256_storeu_pd( p, a ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_pd( a, b ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_fmadd_pd( a, b, c ); }
+
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE double sum( Type a ) noexcept {
+      const __m128d b( _mm_add_pd( _mm256_castpd256_pd128( a ), _mm256_extractf128_pd( a, 1 ) ) );
+      return _mm_cvtsd_f64( _mm_add_sd( b, _mm_unpackhi_pd( b, b ) ) );
+   }
+};
+
+template<>
+struct DispatchAVX2<float>
+{
+   using Type = __m256;
+   static constexpr size_t size = 8UL;
+
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm256_setzero_ps(); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm256_set1_ps( v ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm256_loadu_ps( p ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm256_storeu_ps( p, a ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm256_add_ps( a, b ); }
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm256_fmadd_ps( a, b, c ); }
+
+   BLAZE_TARGET_AVX2 static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept {
+      __m128 b( _mm_add_ps( _mm256_castps256_ps128( a ), _mm256_extractf128_ps( a, 1 ) ) );
+      b = _mm_add_ps( b, _mm_movehl_ps( b, b ) );
+      return _mm_cvtss_f32( _mm_add_ss( b, _mm_movehdup_ps( b ) ) );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD operations of the AVX-512 kernels.
+// \ingroup simd
+//
+// The DispatchAVX512 class template wraps the AVX-512F intrinsics of the dispatched kernels for
+// \c float and \c double. All functions are compiled for the AVX-512F instruction set independent
+// of the instruction set selected at compile time and must only be called from AVX-512 kernels.
+*/
+template< typename T >
+struct DispatchAVX512;
+
+template<>
+struct DispatchAVX512<double>
+{
+   using Type = __m512d;
+   static constexpr size_t size = 8UL;
+
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_pd(); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type set( double v ) noexcept { return _mm512_set1_pd( v ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type load( const double* p ) noexcept { return _mm512_loadu_pd( p ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE void store( double* p, Type a ) noexcept { _mm512_storeu_pd( p, a ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_pd( a, b ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_pd( a, b, c ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE double sum( Type a ) noexcept { return _mm512_reduce_add_pd( a ); }
+};
+
+template<>
+struct DispatchAVX512<float>
+{
+   using Type = __m512;
+   static constexpr size_t size = 16UL;
+
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type zero() noexcept { return _mm512_setzero_ps(); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type set( float v ) noexcept { return _mm512_set1_ps( v ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type load( const float* p ) noexcept { return _mm512_loadu_ps( p ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE void store( float* p, Type a ) noexcept { _mm512_storeu_ps( p, a ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type add( Type a, Type b ) noexcept { return _mm512_add_ps( a, b ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE Type fmadd( Type a, Type b, Type c ) noexcept { return _mm512_fmadd_ps( a, b, c ); }
+   BLAZE_TARGET_AVX512 static BLAZE_ALWAYS_INLINE float sum( Type a ) noexcept { return _mm512_reduce_add_ps( a ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX2 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for the dot product of two arrays.
+// \ingroup dense_vector
+//
+// \param n The number of elements.
+// \param a The first array.
+// \param b The second array.
+// \return The dot product \f$ \sum_i a_i b_i \f$.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX2 T dotAVX2( size_t n, const T* a, const T* b )
+{
+   using Ops = DispatchAVX2<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::fmadd( Ops::load( a+i              ), Ops::load( b+i              ), xmm1 );
+      xmm2 = Ops::fmadd( Ops::load( a+i+SIMDSIZE     ), Ops::load( b+i+SIMDSIZE     ), xmm2 );
+      xmm3 = Ops::fmadd( Ops::load( a+i+SIMDSIZE*2UL ), Ops::load( b+i+SIMDSIZE*2UL ), xmm3 );
+      xmm4 = Ops::fmadd( Ops::load( a+i+SIMDSIZE*3UL ), Ops::load( b+i+SIMDSIZE*3UL ), xmm4 );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::fmadd( Ops::load( a+i ), Ops::load( b+i ), xmm1 );
+   }
+
+   T sp( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      sp += a[i] * b[i];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for the summation of an array.
+// \ingroup dense_vector
+//
+// \param n The number of elements.
+// \param a The array to be summed up.
+// \return The sum \f$ \sum_i a_i \f$.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX2 T sumAVX2( size_t n, const T* a )
+{
+   using Ops = DispatchAVX2<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::add( Ops::load( a+i              ), xmm1 );
+      xmm2 = Ops::add( Ops::load( a+i+SIMDSIZE     ), xmm2 );
+      xmm3 = Ops::add( Ops::load( a+i+SIMDSIZE*2UL ), xmm3 );
+      xmm4 = Ops::add( Ops::load( a+i+SIMDSIZE*3UL ), xmm4 );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::add( Ops::load( a+i ), xmm1 );
+   }
+
+   T redux( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      redux += a[i];
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for a row-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A The row-major matrix.
+// \param lda The spacing between two rows of \a A.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$. In case \a beta is 0, \a y is not read.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX2 void gemvRowAVX2( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops = DispatchAVX2<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE) <= n; j+=SIMDSIZE ) {
+         const typename Ops::Type x1( Ops::load( x+j ) );
+         xmm1 = Ops::fmadd( Ops::load( a1+j ), x1, xmm1 );
+         xmm2 = Ops::fmadd( Ops::load( a2+j ), x1, xmm2 );
+         xmm3 = Ops::fmadd( Ops::load( a3+j ), x1, xmm3 );
+         xmm4 = Ops::fmadd( Ops::load( a4+j ), x1, xmm4 );
+      }
+
+      T y1( Ops::sum( xmm1 ) ), y2( Ops::sum( xmm2 ) ), y3( Ops::sum( xmm3 ) ), y4( Ops::sum( xmm4 ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      if( beta == T(0) ) {
+         y[i    ] = alpha * y1;
+         y[i+1UL] = alpha * y2;
+         y[i+2UL] = alpha * y3;
+         y[i+3UL] = alpha * y4;
+      }
+      else {
+         y[i    ] = alpha * y1 + beta * y[i    ];
+         y[i+1UL] = alpha * y2 + beta * y[i+1UL];
+         y[i+2UL] = alpha * y3 + beta * y[i+2UL];
+         y[i+3UL] = alpha * y4 + beta * y[i+3UL];
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      const T y1( dotAVX2( n, A + i*lda, x ) );
+      y[i] = ( beta == T(0) ) ? alpha * y1 : alpha * y1 + beta * y[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 kernel for a column-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A The column-major matrix.
+// \param lda The spacing between two columns of \a A.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$. In case \a beta is 0, \a y is not read.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX2 void gemvColAVX2( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops = DispatchAVX2<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      y[i] = ( beta == T(0) ) ? T(0) : beta * y[i];
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+4UL) <= n; j+=4UL )
+   {
+      const T* a1( A + j*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      const T s1( alpha * x[j    ] );
+      const T s2( alpha * x[j+1UL] );
+      const T s3( alpha * x[j+2UL] );
+      const T s4( alpha * x[j+3UL] );
+
+      const typename Ops::Type x1( Ops::set( s1 ) ), x2( Ops::set( s2 ) ), x3( Ops::set( s3 ) ), x4( Ops::set( s4 ) );
+      size_t i( 0UL );
+
+      for( ; (i+SIMDSIZE) <= m; i+=SIMDSIZE ) {
+         typename Ops::Type y1( Ops::load( y+i ) );
+         y1 = Ops::fmadd( Ops::load( a1+i ), x1, y1 );
+         y1 = Ops::fmadd( Ops::load( a2+i ), x2, y1 );
+         y1 = Ops::fmadd( Ops::load( a3+i ), x3, y1 );
+         y1 = Ops::fmadd( Ops::load( a4+i ), x4, y1 );
+         Ops::store( y+i, y1 );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * s1 + a2[i] * s2 + a3[i] * s3 + a4[i] * s4;
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+      const T s1( alpha * x[j] );
+      const typename Ops::Type x1( Ops::set( s1 ) );
+      size_t i( 0UL );
+
+      for( ; (i+SIMDSIZE) <= m; i+=SIMDSIZE ) {
+         Ops::store( y+i, Ops::fmadd( Ops::load( a1+i ), x1, Ops::load( y+i ) ) );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * s1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX2 micro kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kc The size of the packed micro panels in the inner dimension.
+// \param a The packed micro panel of the broadcast operand (\a MR elements per step).
+// \param b The packed micro panel of the vectorized operand (\a NV SIMD vectors per step).
+// \param tile The resulting \a MR x \a NV register tile, stored row by row.
+// \return void
+//
+// This function computes the rank-\a kc update of a 6 x 2 register tile (i.e. 6 x 8 \c double
+// or 6 x 16 \c float elements) in 12 of the 16 AVX registers.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX2 void pmmmMicroKernelAVX2( size_t kc, const T* a, const T* b, T* tile )
+{
+   using Ops = DispatchAVX2<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+   constexpr size_t MR( 6UL );
+   constexpr size_t NV( 2UL );
+
+   typename Ops::Type acc[MR][NV];
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         acc[r][v] = Ops::zero();
+      }
+   }
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const typename Ops::Type b1( Ops::load( b          ) );
+      const typename Ops::Type b2( Ops::load( b+SIMDSIZE ) );
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         const typename Ops::Type a1( Ops::set( a[r] ) );
+         acc[r][0] = Ops::fmadd( a1, b1, acc[r][0] );
+         acc[r][1] = Ops::fmadd( a1, b2, acc[r][1] );
+      }
+
+      a += MR;
+      b += NV*SIMDSIZE;
+   }
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         Ops::store( tile + ( r*NV + v )*SIMDSIZE, acc[r][v] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AVX-512 KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 kernel for the dot product of two arrays.
+// \ingroup dense_vector
+//
+// \param n The number of elements.
+// \param a The first array.
+// \param b The second array.
+// \return The dot product \f$ \sum_i a_i b_i \f$.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX512 T dotAVX512( size_t n, const T* a, const T* b )
+{
+   using Ops = DispatchAVX512<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::fmadd( Ops::load( a+i              ), Ops::load( b+i              ), xmm1 );
+      xmm2 = Ops::fmadd( Ops::load( a+i+SIMDSIZE     ), Ops::load( b+i+SIMDSIZE     ), xmm2 );
+      xmm3 = Ops::fmadd( Ops::load( a+i+SIMDSIZE*2UL ), Ops::load( b+i+SIMDSIZE*2UL ), xmm3 );
+      xmm4 = Ops::fmadd( Ops::load( a+i+SIMDSIZE*3UL ), Ops::load( b+i+SIMDSIZE*3UL ), xmm4 );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::fmadd( Ops::load( a+i ), Ops::load( b+i ), xmm1 );
+   }
+
+   T sp( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      sp += a[i] * b[i];
+   }
+
+   return sp;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 kernel for the summation of an array.
+// \ingroup dense_vector
+//
+// \param n The number of elements.
+// \param a The array to be summed up.
+// \return The sum \f$ \sum_i a_i \f$.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX512 T sumAVX512( size_t n, const T* a )
+{
+   using Ops = DispatchAVX512<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+   size_t i( 0UL );
+
+   for( ; (i+SIMDSIZE*4UL) <= n; i+=SIMDSIZE*4UL ) {
+      xmm1 = Ops::add( Ops::load( a+i              ), xmm1 );
+      xmm2 = Ops::add( Ops::load( a+i+SIMDSIZE     ), xmm2 );
+      xmm3 = Ops::add( Ops::load( a+i+SIMDSIZE*2UL ), xmm3 );
+      xmm4 = Ops::add( Ops::load( a+i+SIMDSIZE*3UL ), xmm4 );
+   }
+   for( ; (i+SIMDSIZE) <= n; i+=SIMDSIZE ) {
+      xmm1 = Ops::add( Ops::load( a+i ), xmm1 );
+   }
+
+   T redux( Ops::sum( Ops::add( Ops::add( xmm1, xmm2 ), Ops::add( xmm3, xmm4 ) ) ) );
+
+   for( ; i<n; ++i ) {
+      redux += a[i];
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 kernel for a row-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A The row-major matrix.
+// \param lda The spacing between two rows of \a A.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$. In case \a beta is 0, \a y is not read.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX512 void gemvRowAVX512( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops = DispatchAVX512<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   size_t i( 0UL );
+
+   for( ; (i+4UL) <= m; i+=4UL )
+   {
+      const T* a1( A + i*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      typename Ops::Type xmm1( Ops::zero() ), xmm2( Ops::zero() ), xmm3( Ops::zero() ), xmm4( Ops::zero() );
+      size_t j( 0UL );
+
+      for( ; (j+SIMDSIZE) <= n; j+=SIMDSIZE ) {
+         const typename Ops::Type x1( Ops::load( x+j ) );
+         xmm1 = Ops::fmadd( Ops::load( a1+j ), x1, xmm1 );
+         xmm2 = Ops::fmadd( Ops::load( a2+j ), x1, xmm2 );
+         xmm3 = Ops::fmadd( Ops::load( a3+j ), x1, xmm3 );
+         xmm4 = Ops::fmadd( Ops::load( a4+j ), x1, xmm4 );
+      }
+
+      T y1( Ops::sum( xmm1 ) ), y2( Ops::sum( xmm2 ) ), y3( Ops::sum( xmm3 ) ), y4( Ops::sum( xmm4 ) );
+
+      for( ; j<n; ++j ) {
+         y1 += a1[j] * x[j];
+         y2 += a2[j] * x[j];
+         y3 += a3[j] * x[j];
+         y4 += a4[j] * x[j];
+      }
+
+      if( beta == T(0) ) {
+         y[i    ] = alpha * y1;
+         y[i+1UL] = alpha * y2;
+         y[i+2UL] = alpha * y3;
+         y[i+3UL] = alpha * y4;
+      }
+      else {
+         y[i    ] = alpha * y1 + beta * y[i    ];
+         y[i+1UL] = alpha * y2 + beta * y[i+1UL];
+         y[i+2UL] = alpha * y3 + beta * y[i+2UL];
+         y[i+3UL] = alpha * y4 + beta * y[i+3UL];
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      const T y1( dotAVX512( n, A + i*lda, x ) );
+      y[i] = ( beta == T(0) ) ? alpha * y1 : alpha * y1 + beta * y[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 kernel for a column-major matrix/vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense_matrix
+//
+// \param m The number of rows of \a A.
+// \param n The number of columns of \a A.
+// \param A The column-major matrix.
+// \param lda The spacing between two columns of \a A.
+// \param x The right-hand side vector.
+// \param y The target vector.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$. In case \a beta is 0, \a y is not read.
+// \return void
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX512 void gemvColAVX512( size_t m, size_t n, const T* A, size_t lda, const T* x, T* y, T alpha, T beta )
+{
+   using Ops = DispatchAVX512<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      y[i] = ( beta == T(0) ) ? T(0) : beta * y[i];
+   }
+
+   size_t j( 0UL );
+
+   for( ; (j+4UL) <= n; j+=4UL )
+   {
+      const T* a1( A + j*lda );
+      const T* a2( a1 + lda );
+      const T* a3( a2 + lda );
+      const T* a4( a3 + lda );
+
+      const T s1( alpha * x[j    ] );
+      const T s2( alpha * x[j+1UL] );
+      const T s3( alpha * x[j+2UL] );
+      const T s4( alpha * x[j+3UL] );
+
+      const typename Ops::Type x1( Ops::set( s1 ) ), x2( Ops::set( s2 ) ), x3( Ops::set( s3 ) ), x4( Ops::set( s4 ) );
+      size_t i( 0UL );
+
+      for( ; (i+SIMDSIZE) <= m; i+=SIMDSIZE ) {
+         typename Ops::Type y1( Ops::load( y+i ) );
+         y1 = Ops::fmadd( Ops::load( a1+i ), x1, y1 );
+         y1 = Ops::fmadd( Ops::load( a2+i ), x2, y1 );
+         y1 = Ops::fmadd( Ops::load( a3+i ), x3, y1 );
+         y1 = Ops::fmadd( Ops::load( a4+i ), x4, y1 );
+         Ops::store( y+i, y1 );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * s1 + a2[i] * s2 + a3[i] * s3 + a4[i] * s4;
+      }
+   }
+
+   for( ; j<n; ++j )
+   {
+      const T* a1( A + j*lda );
+      const T s1( alpha * x[j] );
+      const typename Ops::Type x1( Ops::set( s1 ) );
+      size_t i( 0UL );
+
+      for( ; (i+SIMDSIZE) <= m; i+=SIMDSIZE ) {
+         Ops::store( y+i, Ops::fmadd( Ops::load( a1+i ), x1, Ops::load( y+i ) ) );
+      }
+      for( ; i<m; ++i ) {
+         y[i] += a1[i] * s1;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief AVX-512 micro kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kc The size of the packed micro panels in the inner dimension.
+// \param a The packed micro panel of the broadcast operand (\a MR elements per step).
+// \param b The packed micro panel of the vectorized operand (\a NV SIMD vectors per step).
+// \param tile The resulting \a MR x \a NV register tile, stored row by row.
+// \return void
+//
+// This function computes the rank-\a kc update of an 8 x 3 register tile (i.e. 8 x 24 \c double
+// or 8 x 48 \c float elements) in 24 of the 32 AVX-512 registers.
+*/
+template< typename T >  // Element type
+BLAZE_TARGET_AVX512 void pmmmMicroKernelAVX512( size_t kc, const T* a, const T* b, T* tile )
+{
+   using Ops = DispatchAVX512<T>;
+
+   constexpr size_t SIMDSIZE( Ops::size );
+   constexpr size_t MR( 8UL );
+   constexpr size_t NV( 3UL );
+
+   typename Ops::Type acc[MR][NV];
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         acc[r][v] = Ops::zero();
+      }
+   }
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      const typename Ops::Type b1( Ops::load( b              ) );
+      const typename Ops::Type b2( Ops::load( b+SIMDSIZE     ) );
+      const typename Ops::Type b3( Ops::load( b+SIMDSIZE*2UL ) );
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         const typename Ops::Type a1( Ops::set( a[r] ) );
+         acc[r][0] = Ops::fmadd( a1, b1, acc[r][0] );
+         acc[r][1] = Ops::fmadd( a1, b2, acc[r][1] );
+         acc[r][2] = Ops::fmadd( a1, b3, acc[r][2] );
+      }
+
+      a += MR;
+      b += NV*SIMDSIZE;
+   }
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         Ops::store( tile + ( r*NV + v )*SIMDSIZE, acc[r][v] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED DENSE VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the given dense vector can be handled by the dispatched
+//        kernels.
+// \ingroup dense_vector
+*/
+template< typename VT >
+constexpr bool IsDispatchableVector_v =
+   ( IsDispatchable_v< ElementType_t<VT> > && IsContiguous_v<VT> && HasConstDataAccess_v<VT> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched dot product of two dense vectors.
+// \ingroup simd
+//
+// \param lhs The left-hand side dense vector.
+// \param rhs The right-hand side dense vector.
+// \param result The resulting dot product.
+// \return \a true in case the dispatched kernel has been used, \a false if not.
+//
+// This function computes the dot product of the two given dense vectors by means of the
+// dispatched kernel of the selected instruction set. In case the vector types or element types
+// are not supported, the vectors are too small, or no instruction set beyond the compiled one
+// has been selected, the function returns \a false and leaves \a result untouched.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename RT >   // Type of the result
+inline auto dispatchDot( const VT1& lhs, const VT2& rhs, RT& result )
+   -> EnableIf_t< IsDispatchableVector_v<VT1> && IsDispatchableVector_v<VT2> &&
+                  IsSame_v< ElementType_t<VT1>, ElementType_t<VT2> > &&
+                  IsSame_v< ElementType_t<VT1>, RT >, bool >
+{
+#if BLAZE_DISPATCH_MODE
+   const size_t n( lhs.size() );
+
+   if( n < DISPATCH_MIN_SIZE || !isDispatched() )
+      return false;
+
+   result = ( getInstructionSet() == InstructionSet::avx512 )
+            ?( dotAVX512( n, lhs.data(), rhs.data() ) )
+            :( dotAVX2( n, lhs.data(), rhs.data() ) );
+   return true;
+#else
+   UNUSED_PARAMETER( lhs, rhs, result );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the dispatched dot product of unsupported dense vectors.
+// \ingroup dense_vector
+//
+// \return \a false.
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2    // Type of the right-hand side dense vector
+        , typename RT >   // Type of the result
+inline auto dispatchDot( const VT1& /*lhs*/, const VT2& /*rhs*/, RT& /*result*/ )
+   -> EnableIf_t< !( IsDispatchableVector_v<VT1> && IsDispatchableVector_v<VT2> &&
+                     IsSame_v< ElementType_t<VT1>, ElementType_t<VT2> > &&
+                     IsSame_v< ElementType_t<VT1>, RT > ), bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched summation of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be summed up.
+// \param result The resulting sum.
+// \return \a true in case the dispatched kernel has been used, \a false if not.
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Type of the result
+inline auto dispatchSum( const VT& dv, RT& result )
+   -> EnableIf_t< IsDispatchableVector_v<VT> && IsSame_v< ElementType_t<VT>, RT >, bool >
+{
+#if BLAZE_DISPATCH_MODE
+   const size_t n( dv.size() );
+
+   if( n < DISPATCH_MIN_SIZE || !isDispatched() )
+      return false;
+
+   result = ( getInstructionSet() == InstructionSet::avx512 )
+            ?( sumAVX512( n, dv.data() ) )
+            :( sumAVX2( n, dv.data() ) );
+   return true;
+#else
+   UNUSED_PARAMETER( dv, result );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the dispatched summation of unsupported dense vectors.
+// \ingroup dense_vector
+//
+// \return \a false.
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Type of the result
+inline auto dispatchSum( const VT& /*dv*/, RT& /*result*/ )
+   -> EnableIf_t< !( IsDispatchableVector_v<VT> && IsSame_v< ElementType_t<VT>, RT > ), bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched reduction of a dense vector by means of addition.
+// \ingroup dense_vector
+//
+// \param dv The dense vector.
+// \param result The result of the reduction.
+// \return \a true in case the dispatched kernel has been used, \a false if not.
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Type of the result
+inline bool dispatchReduce( const VT& dv, Add, RT& result )
+{
+   return dispatchSum( dv, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the dispatched reduction for all other reduction operations.
+// \ingroup dense_vector
+//
+// \return \a false.
+*/
+template< typename VT    // Type of the dense vector
+        , typename OP    // Type of the reduction operation
+        , typename RT >  // Type of the result
+inline bool dispatchReduce( const VT& /*dv*/, OP /*op*/, RT& /*result*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched squared Euclidean norm of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The dense vector.
+// \param result The resulting squared norm.
+// \return \a true in case the dispatched kernel has been used, \a false if not.
+//
+// This function is selected for the abs operation blaze::Noop and the power operation
+// blaze::Pow2, i.e. for the squared norm and the L2 norm of a dense vector.
+*/
+template< typename VT    // Type of the dense vector
+        , typename RT >  // Type of the result
+inline bool dispatchNorm( const VT& dv, Noop, Pow2, RT& result )
+{
+   return dispatchDot( dv, dv, result );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the dispatched norm for all other abs and power operations.
+// \ingroup dense_vector
+//
+// \return \a false.
+*/
+template< typename VT      // Type of the dense vector
+        , typename Abs     // Type of the abs operation
+        , typename Power   // Type of the power operation
+        , typename RT >    // Type of the result
+inline bool dispatchNorm( const VT& /*dv*/, Abs /*abs*/, Power /*power*/, RT& /*result*/ )
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCHED DENSE MATRIX/DENSE VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the given matrix/vector multiplication can be handled by
+//        the dispatched kernels.
+// \ingroup dense_matrix
+*/
+template< typename VT1, typename MT1, typename VT2, typename ST >
+constexpr bool IsDispatchableGemv_v =
+   ( IsDispatchable_v< ElementType_t<VT1> > &&
+     IsContiguous_v<VT1> && HasMutableDataAccess_v<VT1> &&
+     IsContiguous_v<MT1> && HasConstDataAccess_v<MT1> &&
+     IsContiguous_v<VT2> && HasConstDataAccess_v<VT2> &&
+     !IsLower_v<MT1> && !IsUpper_v<MT1> &&
+     IsSame_v< ElementType_t<VT1>, ElementType_t<MT1> > &&
+     IsSame_v< ElementType_t<VT1>, ElementType_t<VT2> > &&
+     IsBuiltin_v<ST> );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dispatched dense matrix/dense vector multiplication
+//        (\f$ \vec{y}=\alpha*A*\vec{x}+\beta*\vec{y} \f$).
+// \ingroup dense_matrix
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \param beta The scaling factor for \f$ \vec{y} \f$.
+// \return \a true in case the dispatched kernel has been used, \a false if not.
+//
+// This function computes the given matrix/vector multiplication by means of the dispatched
+// kernel of the selected instruction set. In case \a beta is 0, \a y is not read. In case the
+// operand types are not supported or no instruction set beyond the compiled one has been
+// selected, the function returns \a false and leaves \a y untouched.
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename MT1  // Type of the left-hand side matrix operand
+        , bool SO       // Storage order of the matrix operand
+        , typename VT2  // Type of the right-hand side vector operand
+        , typename ST > // Type of the scaling factors
+inline auto dispatchGemv( VT1& y, const DenseMatrix<MT1,SO>& A, const VT2& x, ST alpha, ST beta )
+   -> EnableIf_t< IsDispatchableGemv_v<VT1,MT1,VT2,ST>, bool >
+{
+#if BLAZE_DISPATCH_MODE
+   using ET = ElementType_t<VT1>;
+
+   if( !isDispatched() )
+      return false;
+
+   const size_t m( (~A).rows() );
+   const size_t n( (~A).columns() );
+
+   auto kernel = ( getInstructionSet() == InstructionSet::avx512 )
+                 ?( SO ? &gemvColAVX512<ET> : &gemvRowAVX512<ET> )
+                 :( SO ? &gemvColAVX2<ET> : &gemvRowAVX2<ET> );
+
+   kernel( m, n, (~A).data(), (~A).spacing(), x.data(), y.data(), ET( alpha ), ET( beta ) );
+   return true;
+#else
+   UNUSED_PARAMETER( y, A, x, alpha, beta );
+   return false;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fallback for the dispatched multiplication of unsupported operands.
+// \ingroup dense_matrix
+//
+// \return \a false.
+*/
+template< typename VT1  // Type of the left-hand side target vector
+        , typename MT1  // Type of the left-hand side matrix operand
+        , bool SO       // Storage order of the matrix operand
+        , typename VT2  // Type of the right-hand side vector operand
+        , typename ST > // Type of the scaling factors
+inline auto dispatchGemv( VT1& /*y*/, const DenseMatrix<MT1,SO>& /*A*/, const VT2& /*x*/,
+                          ST /*alpha*/, ST /*beta*/ )
+   -> EnableIf_t< !IsDispatchableGemv_v<VT1,MT1,VT2,ST>, bool >
+{
+   return false;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -58,6 +59,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/DivTrait.h>
@@ -72,6 +74,7 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
 #include <blaze/math/typetraits/HighType.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsColumnVector.h>
@@ -101,6 +104,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/StorageOrder.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
@@ -124,6 +128,7 @@
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/Unused.h>
 
 
@@ -383,6 +388,18 @@ class DynamicMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedTransposeAssign_v =
+      ( useOptimizedKernels &&
+        HasSIMDTranspose_v<Type> &&
+        HasConstDataAccess_v<MT> && IsContiguous_v<MT> &&
+        IsSame_v< Type, RemoveCV_t< ElementType_t<MT> > > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -458,7 +475,12 @@ class DynamicMatrix
    template< typename MT >
    inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,!SO>&  rhs );
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,!SO>& rhs ) -> DisableIf_t< VectorizedTransposeAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,!SO>& rhs ) -> EnableIf_t< VectorizedTransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -564,7 +586,9 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! The only exception is the first-touch initialization
+// (see the \c BLAZE_USE_FIRST_TOUCH_INITIALIZATION switch), which default initializes the
+// elements of large numeric matrices in parallel.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -575,7 +599,10 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
    , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<SO,simdEnabled>( v_, m_, n_, nn_, Type() );
+   }
+   else if( IsVectorizable_v<Type> ) {
       for( size_t i=0UL; i<m_; ++i ) {
          for( size_t j=n_; j<nn_; ++j ) {
             v_[i*nn_+j] = Type();
@@ -600,11 +627,26 @@ inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline DynamicMatrix<Type,SO>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : m_       ( m )                            // The current number of rows of the matrix
+   , n_       ( n )                            // The current number of columns of the matrix
+   , nn_      ( addPadding( n ) )              // The alignment adjusted number of columns
+   , capacity_( m_*nn_ )                       // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t i=0UL; i<m; ++i ) {
-      for( size_t j=0UL; j<n_; ++j ) {
-         v_[i*nn_+j] = init;
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<SO,simdEnabled>( v_, m_, n_, nn_, init );
+   }
+   else {
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            v_[i*nn_+j] = init;
+         }
+
+         if( IsVectorizable_v<Type> ) {
+            for( size_t j=n_; j<nn_; ++j ) {
+               v_[i*nn_+j] = Type();
+            }
+         }
       }
    }
 
@@ -1697,6 +1739,11 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         smpFirstTouch<SO,simdEnabled>( v, m, n, nn, Type() );
+      }
+
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -1710,6 +1757,11 @@ void DynamicMatrix<Type,SO>::resize( size_t m, size_t n, bool preserve )
    }
    else if( m*nn > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( m*nn );
+
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         smpFirstTouch<SO,simdEnabled>( v, m, n, nn, Type() );
+      }
+
       swap( v_, v );
       deallocate( v );
       capacity_ = m*nn;
@@ -1862,6 +1914,11 @@ inline size_t DynamicMatrix<Type,SO>::addPadding( size_t value ) const noexcept
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// In case the matrix is not square and has at least DMATTRANSPOSE_THRESHOLD elements, the matrix
+// is transposed in-place as long as the current capacity of the matrix is sufficient to hold the
+// transposed matrix (see the capacity() function). Otherwise the transposed matrix is assembled
+// in a temporary matrix.
 */
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
@@ -1869,21 +1926,16 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t ii=0UL; ii<m_; ii+=block ) {
-         const size_t iend( min( ii+block, m_ ) );
-         for( size_t jj=0UL; jj<=ii; jj+=block ) {
-            for( size_t i=ii; i<iend; ++i ) {
-               const size_t jend( min( jj+block, n_, i ) );
-               for( size_t j=jj; j<jend; ++j ) {
-                  swap( v_[i*nn_+j], v_[j*nn_+i] );
-               }
-            }
-         }
-      }
+      transposeSquare( v_, m_, nn_ );
+   }
+   else if( m_*n_ >= DMATTRANSPOSE_THRESHOLD && n_*addPadding( m_ ) <= capacity_ )
+   {
+      const size_t nn( addPadding( m_ ) );
+      transposeRectangular( v_, m_, n_, nn_, nn );
+      swap( m_, n_ );
+      nn_ = nn;
    }
    else
    {
@@ -1929,8 +1981,13 @@ inline DynamicMatrix<Type,SO>& DynamicMatrix<Type,SO>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      swap( tmp );
+      transpose();
+
+      for( size_t i=0UL; i<m_; ++i ) {
+         for( size_t j=0UL; j<n_; ++j ) {
+            conjugate( v_[i*nn_+j] );
+         }
+      }
    }
 
    return *this;
@@ -2444,7 +2501,8 @@ inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,SO>& rhs )
 template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 template< typename MT >  // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+   -> DisableIf_t< VectorizedTransposeAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -2468,6 +2526,33 @@ inline void DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+template< typename MT >  // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,SO>::assign( const DenseMatrix<MT,!SO>& rhs )
+   -> EnableIf_t< VectorizedTransposeAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeBlock( (~rhs).data(), (~rhs).spacing(), v_, nn_, n_, m_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3341,6 +3426,16 @@ class DynamicMatrix<Type,true>
         IsSIMDCombinable_v< Type, ElementType_t<MT> > );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedTransposeAssign_v =
+      ( useOptimizedKernels &&
+        HasSIMDTranspose_v<Type> &&
+        HasConstDataAccess_v<MT> && IsContiguous_v<MT> &&
+        IsSame_v< Type, RemoveCV_t< ElementType_t<MT> > > );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT >
@@ -3410,7 +3505,12 @@ class DynamicMatrix<Type,true>
    template< typename MT >
    inline auto assign( const DenseMatrix<MT,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
-   template< typename MT > inline void assign( const DenseMatrix<MT,false>&  rhs );
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,false>& rhs ) -> DisableIf_t< VectorizedTransposeAssign_v<MT> >;
+
+   template< typename MT >
+   inline auto assign( const DenseMatrix<MT,false>& rhs ) -> EnableIf_t< VectorizedTransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -3510,7 +3610,9 @@ inline DynamicMatrix<Type,true>::DynamicMatrix() noexcept
 // \param n The number of columns of the matrix.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! The only exception is the first-touch initialization
+// (see the \c BLAZE_USE_FIRST_TOUCH_INITIALIZATION switch), which default initializes the
+// elements of large numeric matrices in parallel.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
@@ -3520,7 +3622,10 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
    , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
    , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<true,simdEnabled>( v_, m_, n_, mm_, Type() );
+   }
+   else if( IsVectorizable_v<Type> ) {
       for( size_t j=0UL; j<n_; ++j ) {
          for( size_t i=m_; i<mm_; ++i ) {
             v_[i+j*mm_] = Type();
@@ -3546,11 +3651,26 @@ inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n )
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>::DynamicMatrix( size_t m, size_t n, const Type& init )
-   : DynamicMatrix( m, n )
+   : m_       ( m )                            // The current number of rows of the matrix
+   , mm_      ( addPadding( m ) )              // The alignment adjusted number of rows
+   , n_       ( n )                            // The current number of columns of the matrix
+   , capacity_( mm_*n_ )                       // The maximum capacity of the matrix
+   , v_       ( allocate<Type>( capacity_ ) )  // The matrix elements
 {
-   for( size_t j=0UL; j<n_; ++j ) {
-      for( size_t i=0UL; i<m_; ++i ) {
-         v_[i+j*mm_] = init;
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<true,simdEnabled>( v_, m_, n_, mm_, init );
+   }
+   else {
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            v_[i+j*mm_] = init;
+         }
+
+         if( IsVectorizable_v<Type> ) {
+            for( size_t i=m_; i<mm_; ++i ) {
+               v_[i+j*mm_] = Type();
+            }
+         }
       }
    }
 
@@ -4653,6 +4773,11 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    if( preserve )
    {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         smpFirstTouch<true,simdEnabled>( v, m, n, mm, Type() );
+      }
+
       const size_t min_m( min( m, m_ ) );
       const size_t min_n( min( n, n_ ) );
 
@@ -4666,6 +4791,11 @@ void DynamicMatrix<Type,true>::resize( size_t m, size_t n, bool preserve )
    }
    else if( mm*n > capacity_ ) {
       Type* BLAZE_RESTRICT v = allocate<Type>( mm*n );
+
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && m*n >= SMP_DMATASSIGN_THRESHOLD ) {
+         smpFirstTouch<true,simdEnabled>( v, m, n, mm, Type() );
+      }
+
       swap( v_, v );
       deallocate( v );
       capacity_ = mm*n;
@@ -4825,27 +4955,27 @@ inline size_t DynamicMatrix<Type,true>::addPadding( size_t values ) const noexce
 /*!\brief In-place transpose of the matrix.
 //
 // \return Reference to the transposed matrix.
+//
+// In case the matrix is not square and has at least DMATTRANSPOSE_THRESHOLD elements, the matrix
+// is transposed in-place as long as the current capacity of the matrix is sufficient to hold the
+// transposed matrix (see the capacity() function). Otherwise the transposed matrix is assembled
+// in a temporary matrix.
 */
 template< typename Type >  // Data type of the matrix
 inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::transpose()
 {
    using std::swap;
 
-   constexpr size_t block( BLOCK_SIZE );
-
    if( m_ == n_ )
    {
-      for( size_t jj=0UL; jj<n_; jj+=block ) {
-         const size_t jend( min( jj+block, n_ ) );
-         for( size_t ii=0UL; ii<=jj; ii+=block ) {
-            for( size_t j=jj; j<jend; ++j ) {
-               const size_t iend( min( ii+block, m_, j ) );
-               for( size_t i=ii; i<iend; ++i ) {
-                  swap( v_[i+j*mm_], v_[j+i*mm_] );
-               }
-            }
-         }
-      }
+      transposeSquare( v_, n_, mm_ );
+   }
+   else if( m_*n_ >= DMATTRANSPOSE_THRESHOLD && m_*addPadding( n_ ) <= capacity_ )
+   {
+      const size_t mm( addPadding( n_ ) );
+      transposeRectangular( v_, n_, m_, mm_, mm );
+      swap( m_, n_ );
+      mm_ = mm;
    }
    else
    {
@@ -4892,8 +5022,13 @@ inline DynamicMatrix<Type,true>& DynamicMatrix<Type,true>::ctranspose()
    }
    else
    {
-      DynamicMatrix tmp( ctrans(*this) );
-      this->swap( tmp );
+      transpose();
+
+      for( size_t j=0UL; j<n_; ++j ) {
+         for( size_t i=0UL; i<m_; ++i ) {
+            conjugate( v_[i+j*mm_] );
+         }
+      }
    }
 
    return *this;
@@ -5416,7 +5551,8 @@ inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,true>& rhs )
 */
 template< typename Type >  // Data type of the matrix
 template< typename MT >    // Type of the right-hand side dense matrix
-inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+   -> DisableIf_t< VectorizedTransposeAssign_v<MT> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
 
@@ -5441,6 +5577,34 @@ inline void DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type >  // Data type of the matrix
+template< typename MT >    // Type of the right-hand side dense matrix
+inline auto DynamicMatrix<Type,true>::assign( const DenseMatrix<MT,false>& rhs )
+   -> EnableIf_t< VectorizedTransposeAssign_v<MT> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+
+   BLAZE_INTERNAL_ASSERT( m_ == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( n_ == (~rhs).columns(), "Invalid number of columns" );
+
+   transposeBlock( (~rhs).data(), (~rhs).spacing(), v_, mm_, m_, n_ );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
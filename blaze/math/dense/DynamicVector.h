@@ -48,6 +48,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MaskedTail.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -58,6 +59,7 @@
 #include <blaze/math/shims/NextMultiple.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/FirstTouch.h>
 #include <blaze/math/traits/AddTrait.h>
 #include <blaze/math/traits/BandTrait.h>
 #include <blaze/math/traits/ColumnTrait.h>
@@ -99,6 +101,7 @@
 #include <blaze/system/Inline.h>
 #include <blaze/system/Optimizations.h>
 #include <blaze/system/Restrict.h>
+#include <blaze/system/SMP.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/system/TransposeFlag.h>
 #include <blaze/util/algorithms/Transfer.h>
@@ -532,7 +535,9 @@ inline DynamicVector<Type,TF>::DynamicVector() noexcept
 // \param n The size of the vector.
 //
 // \note This constructor is only responsible to allocate the required dynamic memory. No
-// element initialization is performed!
+// element initialization is performed! The only exception is the first-touch initialization
+// (see the \c BLAZE_USE_FIRST_TOUCH_INITIALIZATION switch), which default initializes the
+// elements of large numeric vectors in parallel.
 */
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
@@ -541,7 +546,10 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
    , capacity_( addPadding( n ) )              // The maximum capacity of the vector
    , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   if( IsVectorizable_v<Type> ) {
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<simdEnabled>( v_, size_, capacity_, Type() );
+   }
+   else if( IsVectorizable_v<Type> ) {
       for( size_t i=size_; i<capacity_; ++i )
          v_[i] = Type();
    }
@@ -562,10 +570,22 @@ inline DynamicVector<Type,TF>::DynamicVector( size_t n )
 template< typename Type  // Data type of the vector
         , bool TF >      // Transpose flag
 inline DynamicVector<Type,TF>::DynamicVector( size_t n, const Type& init )
-   : DynamicVector( n )
+   : size_    ( n )                            // The current size/dimension of the vector
+   , capacity_( addPadding( n ) )              // The maximum capacity of the vector
+   , v_       ( allocate<Type>( capacity_ ) )  // The vector elements
 {
-   for( size_t i=0UL; i<size_; ++i )
-      v_[i] = init;
+   if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && canSMPAssign() ) {
+      smpFirstTouch<simdEnabled>( v_, size_, capacity_, init );
+   }
+   else {
+      for( size_t i=0UL; i<size_; ++i )
+         v_[i] = init;
+
+      if( IsVectorizable_v<Type> ) {
+         for( size_t i=size_; i<capacity_; ++i )
+            v_[i] = Type();
+      }
+   }
 
    BLAZE_INTERNAL_ASSERT( isIntact(), "Invariant violation detected" );
 }
@@ -1458,15 +1478,18 @@ inline void DynamicVector<Type,TF>::resize( size_t n, bool preserve )
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
 
       // Initializing the new array
-      if( preserve ) {
-         transfer( v_, v_+size_, tmp );
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && n > SMP_DVECASSIGN_THRESHOLD ) {
+         smpFirstTouch<simdEnabled>( tmp, n, newCapacity, Type() );
       }
-
-      if( IsVectorizable_v<Type> ) {
+      else if( IsVectorizable_v<Type> ) {
          for( size_t i=size_; i<newCapacity; ++i )
             tmp[i] = Type();
       }
 
+      if( preserve ) {
+         transfer( v_, v_+size_, tmp );
+      }
+
       // Replacing the old array
       swap( v_, tmp );
       deallocate( tmp );
@@ -1526,13 +1549,16 @@ inline void DynamicVector<Type,TF>::reserve( size_t n )
       Type* BLAZE_RESTRICT tmp = allocate<Type>( newCapacity );
 
       // Initializing the new array
-      transfer( v_, v_+size_, tmp );
-
-      if( IsVectorizable_v<Type> ) {
+      if( BLAZE_FIRST_TOUCH_MODE && IsNumeric_v<Type> && n > SMP_DVECASSIGN_THRESHOLD ) {
+         smpFirstTouch<simdEnabled>( tmp, n, newCapacity, Type() );
+      }
+      else if( IsVectorizable_v<Type> ) {
          for( size_t i=size_; i<newCapacity; ++i )
             tmp[i] = Type();
       }
 
+      transfer( v_, v_+size_, tmp );
+
       // Replacing the old array
       swap( tmp, v_ );
       deallocate( tmp );
@@ -2016,6 +2042,7 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2029,7 +2056,11 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.stream( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && i<size_; ++i ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && remainder && i<size_; ++i ) {
          *left = *right; ++left; ++right;
       }
    }
@@ -2044,7 +2075,11 @@ inline auto DynamicVector<Type,TF>::assign( const DenseVector<VT,TF>& rhs )
       for( ; i<ipos; i+=SIMDSIZE ) {
          left.store( right.load() ); left += SIMDSIZE; right += SIMDSIZE;
       }
-      for( ; remainder && i<size_; ++i ) {
+      if( masked && i<size_ ) {
+         const size_t n( size_ - i );
+         storem( v_+i, n, loadTail( ~rhs, i, n ) );
+      }
+      for( ; !masked && remainder && i<size_; ++i ) {
          *left = *right; ++left; ++right;
       }
    }
@@ -2130,6 +2165,7 @@ inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2147,7 +2183,11 @@ inline auto DynamicVector<Type,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       left.store( left.load() + right.load() ); left += SIMDSIZE; right += SIMDSIZE;
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) + loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       *left += *right; ++left; ++right;
    }
 }
@@ -2232,6 +2272,7 @@ inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2249,7 +2290,11 @@ inline auto DynamicVector<Type,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       left.store( left.load() - right.load() ); left += SIMDSIZE; right += SIMDSIZE;
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) - loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       *left -= *right; ++left; ++right;
    }
 }
@@ -2334,6 +2379,7 @@ inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2351,7 +2397,11 @@ inline auto DynamicVector<Type,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       left.store( left.load() * right.load() ); left += SIMDSIZE; right += SIMDSIZE;
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) * loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       *left *= *right; ++left; ++right;
    }
 }
@@ -0,0 +1,958 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Fused.h
+//  \brief Header file for the fused evaluation of several dense vector operations
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_FUSED_H_
+#define _BLAZE_MATH_DENSE_FUSED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <tuple>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/DVecNormExpr.h>
+#include <blaze/math/expressions/DVecReduceExpr.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/RequiresEvaluation.h>
+#include <blaze/math/Vector.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/IntegralConstant.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Empty partial result of the fused assignment statements.
+// \ingroup dense_vector
+*/
+struct FusedVoid
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment operation of a fused assignment statement.
+// \ingroup dense_vector
+*/
+struct FusedAssignOp
+{
+   template< typename VT1, typename VT2, bool TF >
+   static void evaluate( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { ~lhs = ~rhs; }
+
+   template< typename VT1, typename VT2, bool TF >
+   static void apply( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { assign( ~lhs, ~rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Addition assignment operation of a fused assignment statement.
+// \ingroup dense_vector
+*/
+struct FusedAddAssignOp
+{
+   template< typename VT1, typename VT2, bool TF >
+   static void evaluate( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { ~lhs += ~rhs; }
+
+   template< typename VT1, typename VT2, bool TF >
+   static void apply( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { addAssign( ~lhs, ~rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Subtraction assignment operation of a fused assignment statement.
+// \ingroup dense_vector
+*/
+struct FusedSubAssignOp
+{
+   template< typename VT1, typename VT2, bool TF >
+   static void evaluate( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { ~lhs -= ~rhs; }
+
+   template< typename VT1, typename VT2, bool TF >
+   static void apply( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { subAssign( ~lhs, ~rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Multiplication assignment operation of a fused assignment statement.
+// \ingroup dense_vector
+*/
+struct FusedMultAssignOp
+{
+   template< typename VT1, typename VT2, bool TF >
+   static void evaluate( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { ~lhs *= ~rhs; }
+
+   template< typename VT1, typename VT2, bool TF >
+   static void apply( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs ) { multAssign( ~lhs, ~rhs ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assignment statement of a fused evaluation.
+// \ingroup dense_vector
+//
+// This class represents the assignment of the dense vector expression \a VT2 to the dense
+// vector \a VT1 via the operation \a OP (i.e. assignment, addition assignment, subtraction
+// assignment, or multiplication assignment) within a fused evaluation (see the fuse() function).
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , typename OP > // Type of the assignment operation
+class FusedAssignment
+{
+ private:
+   //**Type definitions****************************************************************************
+   //! Composite type of the right-hand side dense vector expression.
+   using Operand = If_t< IsExpression_v<VT2>, const VT2, const VT2& >;
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<VT1>;  //!< Element type of the left-hand side vector.
+   using PartialType = FusedVoid;           //!< Type of the partial result of the statement.
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedAssignment class.
+   //
+   // \param lhs The target dense vector of the assignment.
+   // \param rhs The right-hand side dense vector of the assignment.
+   */
+   explicit inline FusedAssignment( VT1& lhs, const VT2& rhs ) noexcept
+      : lhs_( lhs )  // The target dense vector of the assignment
+      , rhs_( rhs )  // The right-hand side dense vector of the assignment
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the statement.
+   //
+   // \return The size of the target vector.
+   */
+   inline size_t size() const noexcept {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the statement is aliased with the given address in a way that
+   //        prevents the blockwise evaluation.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the statement requires the complete aliased vector, \a false if not.
+   */
+   template< typename Other >  // Data type of the foreign expression
+   inline bool isAliased( const Other* alias ) const noexcept {
+      return RequiresEvaluation_v<VT2> && rhs_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**Conflicts function**************************************************************************
+   /*!\brief Returns whether the given statement reads the target of this statement in a way
+   //        that prevents the blockwise evaluation.
+   //
+   // \param stmt The statement to be checked.
+   // \return \a true in case of a conflict, \a false if not.
+   */
+   template< typename Stmt >  // Type of the statement to be checked
+   inline bool conflicts( const Stmt& stmt ) const noexcept {
+      return stmt.isAliased( &lhs_ );
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the statement can be used in SMP assignments.
+   //
+   // \return \a true in case the target vector can be used in SMP assignments, \a false if not.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return lhs_.canSMPAssign();
+   }
+   //**********************************************************************************************
+
+   //**Evaluate functions**************************************************************************
+   /*!\brief Unfused evaluation of the complete statement.
+   //
+   // \return void
+   */
+   inline void evaluate( PartialType& ) const {
+      OP::evaluate( lhs_, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Evaluation of the statement for the given range of elements.
+   //
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   // \return void
+   */
+   inline void evaluate( size_t index, size_t size, PartialType& ) const {
+      auto target( subvector( lhs_, index, size, unchecked ) );
+      OP::apply( target, subvector( rhs_, index, size, unchecked ) );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combination of two partial results.
+   //
+   // \return The combined partial result.
+   */
+   static inline PartialType combine( const PartialType&, const PartialType& ) noexcept {
+      return PartialType();
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the result of the statement.
+   //
+   // \return An empty tuple.
+   */
+   inline std::tuple<> result( const PartialType& ) const noexcept {
+      return std::tuple<>();
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   VT1&    lhs_;  //!< The target dense vector of the assignment.
+   Operand rhs_;  //!< The right-hand side dense vector of the assignment.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Dot product statement of a fused evaluation.
+// \ingroup dense_vector
+//
+// This class represents the dot product of the two dense vectors \a VT1 and \a VT2 within a
+// fused evaluation (see the fuse() function).
+*/
+template< typename VT1    // Type of the left-hand side dense vector
+        , typename VT2 >  // Type of the right-hand side dense vector
+class FusedDot
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Operand1 = If_t< IsExpression_v<VT1>, const VT1, const VT1& >;  //!< Composite type of the left-hand side operand.
+   using Operand2 = If_t< IsExpression_v<VT2>, const VT2, const VT2& >;  //!< Composite type of the right-hand side operand.
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<VT1>;  //!< Element type of the left-hand side vector.
+
+   //! Type of the partial result of the statement.
+   using PartialType = Decay_t< decltype( dot( std::declval<const VT1&>(), std::declval<const VT2&>() ) ) >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedDot class.
+   //
+   // \param lhs The left-hand side dense vector of the dot product.
+   // \param rhs The right-hand side dense vector of the dot product.
+   */
+   explicit inline FusedDot( const VT1& lhs, const VT2& rhs ) noexcept
+      : lhs_( lhs )  // The left-hand side dense vector of the dot product
+      , rhs_( rhs )  // The right-hand side dense vector of the dot product
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the statement.
+   //
+   // \return The size of the operands.
+   */
+   inline size_t size() const noexcept {
+      return lhs_.size();
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the statement is aliased with the given address in a way that
+   //        prevents the blockwise evaluation.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the statement requires the complete aliased vector, \a false if not.
+   */
+   template< typename Other >  // Data type of the foreign expression
+   inline bool isAliased( const Other* alias ) const noexcept {
+      return ( RequiresEvaluation_v<VT1> && lhs_.isAliased( alias ) ) ||
+             ( RequiresEvaluation_v<VT2> && rhs_.isAliased( alias ) );
+   }
+   //**********************************************************************************************
+
+   //**Conflicts function**************************************************************************
+   /*!\brief Returns whether the given statement conflicts with this statement.
+   //
+   // \return \a false since the statement does not write any vector.
+   */
+   template< typename Stmt >  // Type of the statement to be checked
+   inline bool conflicts( const Stmt& ) const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the statement can be used in SMP assignments.
+   //
+   // \return \a true.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**Evaluate functions**************************************************************************
+   /*!\brief Unfused evaluation of the complete statement.
+   //
+   // \param partial The resulting dot product.
+   // \return void
+   */
+   inline void evaluate( PartialType& partial ) const {
+      partial = dot( lhs_, rhs_ );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Evaluation of the statement for the given range of elements.
+   //
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   // \param partial The partial dot product to be updated.
+   // \return void
+   */
+   inline void evaluate( size_t index, size_t size, PartialType& partial ) const {
+      partial += dot( subvector( lhs_, index, size, unchecked ),
+                      subvector( rhs_, index, size, unchecked ) );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combination of two partial results.
+   //
+   // \param a The first partial dot product.
+   // \param b The second partial dot product.
+   // \return The sum of both partial dot products.
+   */
+   static inline PartialType combine( const PartialType& a, const PartialType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the result of the statement.
+   //
+   // \param partial The complete dot product.
+   // \return A tuple containing the dot product.
+   */
+   inline std::tuple<PartialType> result( const PartialType& partial ) const {
+      return std::tuple<PartialType>( partial );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand1 lhs_;  //!< The left-hand side dense vector of the dot product.
+   Operand2 rhs_;  //!< The right-hand side dense vector of the dot product.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Sum reduction statement of a fused evaluation.
+// \ingroup dense_vector
+//
+// This class represents the sum or the squared norm of the dense vector \a VT within a fused
+// evaluation (see the fuse() function). In case \a SQR is set to \a true, the squared norm is
+// computed, otherwise the sum of all elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool SQR >   // Flag for the squared norm
+class FusedReduction
+{
+ private:
+   //**Type definitions****************************************************************************
+   using Operand = If_t< IsExpression_v<VT>, const VT, const VT& >;  //!< Composite type of the operand.
+   //**********************************************************************************************
+
+   //**Reduce functions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename VT2, bool TF >
+   static inline decltype(auto) reduce( const DenseVector<VT2,TF>& dv, TrueType ) {
+      return sqrNorm( ~dv );
+   }
+
+   template< typename VT2, bool TF >
+   static inline decltype(auto) reduce( const DenseVector<VT2,TF>& dv, FalseType ) {
+      return sum( ~dv );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using ElementType = ElementType_t<VT>;  //!< Element type of the dense vector.
+
+   //! Type of the partial result of the statement.
+   using PartialType = Decay_t< decltype( reduce( std::declval<const VT&>(), BoolConstant<SQR>() ) ) >;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the FusedReduction class.
+   //
+   // \param dv The dense vector to be reduced.
+   */
+   explicit inline FusedReduction( const VT& dv ) noexcept
+      : dv_( dv )  // The dense vector to be reduced
+   {}
+   //**********************************************************************************************
+
+   //**Size function*******************************************************************************
+   /*!\brief Returns the size of the statement.
+   //
+   // \return The size of the operand.
+   */
+   inline size_t size() const noexcept {
+      return dv_.size();
+   }
+   //**********************************************************************************************
+
+   //**IsAliased function**************************************************************************
+   /*!\brief Returns whether the statement is aliased with the given address in a way that
+   //        prevents the blockwise evaluation.
+   //
+   // \param alias The alias to be checked.
+   // \return \a true in case the statement requires the complete aliased vector, \a false if not.
+   */
+   template< typename Other >  // Data type of the foreign expression
+   inline bool isAliased( const Other* alias ) const noexcept {
+      return RequiresEvaluation_v<VT> && dv_.isAliased( alias );
+   }
+   //**********************************************************************************************
+
+   //**Conflicts function**************************************************************************
+   /*!\brief Returns whether the given statement conflicts with this statement.
+   //
+   // \return \a false since the statement does not write any vector.
+   */
+   template< typename Stmt >  // Type of the statement to be checked
+   inline bool conflicts( const Stmt& ) const noexcept {
+      return false;
+   }
+   //**********************************************************************************************
+
+   //**CanSMPAssign function***********************************************************************
+   /*!\brief Returns whether the statement can be used in SMP assignments.
+   //
+   // \return \a true.
+   */
+   inline bool canSMPAssign() const noexcept {
+      return true;
+   }
+   //**********************************************************************************************
+
+   //**Evaluate functions**************************************************************************
+   /*!\brief Unfused evaluation of the complete statement.
+   //
+   // \param partial The resulting reduction.
+   // \return void
+   */
+   inline void evaluate( PartialType& partial ) const {
+      partial = reduce( dv_, BoolConstant<SQR>() );
+   }
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Evaluation of the statement for the given range of elements.
+   //
+   // \param index The index of the first element of the range.
+   // \param size The number of elements of the range.
+   // \param partial The partial reduction to be updated.
+   // \return void
+   */
+   inline void evaluate( size_t index, size_t size, PartialType& partial ) const {
+      partial += reduce( subvector( dv_, index, size, unchecked ), BoolConstant<SQR>() );
+   }
+   //**********************************************************************************************
+
+   //**Combine function****************************************************************************
+   /*!\brief Combination of two partial results.
+   //
+   // \param a The first partial reduction.
+   // \param b The second partial reduction.
+   // \return The sum of both partial reductions.
+   */
+   static inline PartialType combine( const PartialType& a, const PartialType& b ) {
+      return a + b;
+   }
+   //**********************************************************************************************
+
+   //**Result function*****************************************************************************
+   /*!\brief Returns the result of the statement.
+   //
+   // \param partial The complete reduction.
+   // \return A tuple containing the reduction.
+   */
+   inline std::tuple<PartialType> result( const PartialType& partial ) const {
+      return std::tuple<PartialType>( partial );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Operand dv_;  //!< The dense vector to be reduced.
+   //**********************************************************************************************
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Fused dense vector operations */
+//@{
+template< typename VT1, typename VT2, bool TF >
+FusedAssignment<VT1,VT2,FusedAssignOp>
+   fusedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+FusedAssignment<VT1,VT2,FusedAddAssignOp>
+   fusedAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+FusedAssignment<VT1,VT2,FusedSubAssignOp>
+   fusedSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+FusedAssignment<VT1,VT2,FusedMultAssignOp>
+   fusedMultAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT1, typename VT2, bool TF >
+FusedDot<VT1,VT2> fusedDot( const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs );
+
+template< typename VT, bool TF >
+FusedReduction<VT,false> fusedSum( const DenseVector<VT,TF>& dv );
+
+template< typename VT, bool TF >
+FusedReduction<VT,true> fusedSqrNorm( const DenseVector<VT,TF>& dv );
+
+template< typename... Stmts >
+decltype(auto) fuse( const Stmts&... stmts );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an assignment statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be assigned.
+// \return The assignment statement \f$ \vec{lhs} = \vec{rhs} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates the statement \f$ \vec{lhs} = \vec{rhs} \f$ for the fuse() function.
+// In case the sizes of the two vectors don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline FusedAssignment<VT1,VT2,FusedAssignOp>
+   fusedAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates an addition assignment statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be added.
+// \return The addition assignment statement \f$ \vec{lhs} += \vec{rhs} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates the statement \f$ \vec{lhs} += \vec{rhs} \f$ for the fuse() function.
+// In case the sizes of the two vectors don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline FusedAssignment<VT1,VT2,FusedAddAssignOp>
+   fusedAddAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedAddAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a subtraction assignment statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return The subtraction assignment statement \f$ \vec{lhs} -= \vec{rhs} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates the statement \f$ \vec{lhs} -= \vec{rhs} \f$ for the fuse() function.
+// In case the sizes of the two vectors don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline FusedAssignment<VT1,VT2,FusedSubAssignOp>
+   fusedSubAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedSubAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a componentwise multiplication assignment statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param lhs The target dense vector.
+// \param rhs The right-hand side dense vector to be multiplied with.
+// \return The multiplication assignment statement \f$ \vec{lhs} *= \vec{rhs} \f$.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates the statement \f$ \vec{lhs} *= \vec{rhs} \f$ for the fuse() function.
+// In case the sizes of the two vectors don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline FusedAssignment<VT1,VT2,FusedMultAssignOp>
+   fusedMultAssign( DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedAssignment<VT1,VT2,FusedMultAssignOp>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a dot product statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param lhs The left-hand side dense vector of the dot product.
+// \param rhs The right-hand side dense vector of the dot product.
+// \return The dot product statement.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// This function creates a statement for the fuse() function, which computes the dot product
+// of the two given vectors (see the dot() function). In case the sizes of the two vectors
+// don't match, a \a std::invalid_argument is thrown.
+*/
+template< typename VT1  // Type of the left-hand side dense vector
+        , typename VT2  // Type of the right-hand side dense vector
+        , bool TF >     // Transpose flag
+inline FusedDot<VT1,VT2> fusedDot( const DenseVector<VT1,TF>& lhs, const DenseVector<VT2,TF>& rhs )
+{
+   if( (~lhs).size() != (~rhs).size() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   return FusedDot<VT1,VT2>( ~lhs, ~rhs );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a sum reduction statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reduced.
+// \return The sum reduction statement.
+//
+// This function creates a statement for the fuse() function, which computes the sum of all
+// elements of the given vector (see the sum() function).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline FusedReduction<VT,false> fusedSum( const DenseVector<VT,TF>& dv )
+{
+   return FusedReduction<VT,false>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Creates a squared norm statement for a fused evaluation.
+// \ingroup dense_vector
+//
+// \param dv The dense vector to be reduced.
+// \return The squared norm statement.
+//
+// This function creates a statement for the fuse() function, which computes the squared
+// Euclidean norm of the given vector (see the sqrNorm() function).
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+inline FusedReduction<VT,true> fusedSqrNorm( const DenseVector<VT,TF>& dv )
+{
+   return FusedReduction<VT,true>( ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the target of the given statement is read by any of the statements
+//        in a way that prevents the blockwise evaluation.
+// \ingroup dense_vector
+//
+// \param stmt The statement whose target is checked.
+// \param stmts The tuple of all statements.
+// \return \a true in case of a conflict, \a false if not.
+*/
+template< typename Stmt     // Type of the checked statement
+        , typename Tuple    // Type of the tuple of statements
+        , size_t... Is >    // Indices of the statements
+inline bool fusedConflicts( const Stmt& stmt, const Tuple& stmts, std::index_sequence<Is...> )
+{
+   bool conflict( false );
+   const int expand[] = { ( conflict = conflict || stmt.conflicts( std::get<Is>( stmts ) ), 0 )... };
+   UNUSED_PARAMETER( expand );
+   return conflict;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the fused evaluation of several dense vector statements.
+// \ingroup dense_vector
+//
+// \param stmts The tuple of statements to be evaluated.
+// \return The tuple of the results of all reduction statements.
+// \exception std::invalid_argument Vector sizes do not match.
+*/
+template< typename Tuple  // Type of the tuple of statements
+        , size_t... Is >  // Indices of the statements
+auto fuse_backend( const Tuple& stmts, std::index_sequence<Is...> )
+{
+   using Partials    = std::tuple< typename Decay_t< std::tuple_element_t<Is,Tuple> >::PartialType... >;
+   using ElementType = typename Decay_t< std::tuple_element_t<0UL,Tuple> >::ElementType;
+
+   // Number of elements per block, such that the blocks of a few operands fit into the L1 cache
+   constexpr size_t blockSize( 16384UL / sizeof( ElementType ) );
+
+   const size_t n( std::get<0UL>( stmts ).size() );
+
+   bool sizes( true );
+   bool conflict( false );
+   bool parallel( n > SMP_DVECASSIGN_THRESHOLD );
+
+   const int expand[] = { ( sizes    = sizes && std::get<Is>( stmts ).size() == n,
+                            conflict = conflict || fusedConflicts( std::get<Is>( stmts ), stmts, std::index_sequence<Is...>() ),
+                            parallel = parallel && std::get<Is>( stmts ).canSMPAssign(), 0 )... };
+   UNUSED_PARAMETER( expand );
+
+   if( !sizes ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   Partials partials{};
+
+   if( conflict )
+   {
+      const int sequence[] = { ( std::get<Is>( stmts ).evaluate( std::get<Is>( partials ) ), 0 )... };
+      UNUSED_PARAMETER( sequence );
+   }
+   else
+   {
+      const auto kernel = [&stmts,blockSize]( size_t index, size_t size )
+      {
+         Partials local{};
+
+         for( size_t i=index; i<index+size; i+=blockSize ) {
+            const size_t block( min( blockSize, index+size-i ) );
+            const int sequence[] = { ( std::get<Is>( stmts ).evaluate( i, block, std::get<Is>( local ) ), 0 )... };
+            UNUSED_PARAMETER( sequence );
+         }
+
+         return local;
+      };
+
+      const auto combine = [&stmts]( const Partials& a, const Partials& b )
+      {
+         return Partials( std::get<Is>( stmts ).combine( std::get<Is>( a ), std::get<Is>( b ) )... );
+      };
+
+      partials = ( parallel )
+                 ?( smpReduce( n, SIMDTrait<ElementType>::size, kernel, combine ) )
+                 :( kernel( 0UL, n ) );
+   }
+
+   return std::tuple_cat( std::get<Is>( stmts ).result( std::get<Is>( partials ) )... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Evaluates several dense vector statements in a single pass over the vectors.
+// \ingroup dense_vector
+//
+// \param stmts The statements to be evaluated.
+// \return The tuple of the results of all reduction statements.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// Expression templates fuse all operations of a single right-hand side expression, but a
+// sequence of several statements still streams all operands through memory once per statement.
+// The fuse() function evaluates a sequence of assignment and reduction statements on vectors
+// of the same size in a single pass: The vectors are processed in cache-sized blocks, and for
+// each block all statements are evaluated in the given order. Therefore all vectors written
+// by a statement are still cached when they are read by subsequent statements. The following
+// example demonstrates the fused update of a conjugate gradient iteration:
+
+   \code
+   blaze::DynamicVector<double> x, r, d, h;
+   double alpha;
+   // ... Resizing and initialization
+
+   // Unfused: x, r, d and h are streamed through memory in three separate passes
+   x += alpha * d;
+   r -= alpha * h;
+   double rr = dot( r, r );
+
+   // Fused: x, r, d and h are streamed through memory once
+   std::tie( rr ) = blaze::fuse( blaze::fusedAddAssign( x, alpha * d ),
+                                 blaze::fusedSubAssign( r, alpha * h ),
+                                 blaze::fusedDot( r, r ) );
+   \endcode
+
+// The available statements are the assignment statements fusedAssign(), fusedAddAssign(),
+// fusedSubAssign(), and fusedMultAssign() and the reduction statements fusedDot(), fusedSum(),
+// and fusedSqrNorm(). The function returns a \c std::tuple containing the results of all
+// reduction statements in the given order. The sizes of all vectors are checked once, in case
+// they don't match a \a std::invalid_argument exception is thrown. In case the vectors contain
+// more than \c BLAZE_SMP_DVECASSIGN_THRESHOLD elements, the pass is split across threads in
+// the same way as an SMP assignment and the partial reductions are combined in a deterministic
+// order.
+//
+// The result of the fused evaluation is identical to the evaluation of the statements one
+// after another as long as all statements access the targets element-wise, i.e. each element
+// of a target is only read at its own index. Expressions that require the complete operand (as
+// for instance matrix/vector multiplications) must not refer to a target of any statement; in
+// case such an alias is detected, the statements are evaluated one after another. Views that
+// read a target at shifted indices (as for instance a subvector of a target at another offset)
+// are not detected and result in undefined behavior. Note that the statements only
+// store references to their operands and should therefore be created within the call to
+// fuse().
+*/
+template< typename... Stmts >  // Types of the statements
+inline decltype(auto) fuse( const Stmts&... stmts )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_STATIC_ASSERT_MSG( sizeof...( Stmts ) > 0UL, "No statements provided" );
+
+   return fuse_backend( std::forward_as_tuple( stmts... ), std::index_sequence_for<Stmts...>() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
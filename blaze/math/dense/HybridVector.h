@@ -38,6 +38,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MaskedTail.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -2190,6 +2191,7 @@ inline auto HybridVector<Type,N,TF>::assign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == size_, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2199,7 +2201,11 @@ inline auto HybridVector<Type,N,TF>::assign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, (~rhs).load(i) );
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       v_[i] = (~rhs)[i];
    }
 }
@@ -2280,6 +2286,7 @@ inline auto HybridVector<Type,N,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == size_, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2289,7 +2296,11 @@ inline auto HybridVector<Type,N,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) + (~rhs).load(i) );
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) + loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       v_[i] += (~rhs)[i];
    }
 }
@@ -2370,6 +2381,7 @@ inline auto HybridVector<Type,N,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == size_, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2379,7 +2391,11 @@ inline auto HybridVector<Type,N,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) - (~rhs).load(i) );
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) - loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       v_[i] -= (~rhs)[i];
    }
 }
@@ -2460,6 +2476,7 @@ inline auto HybridVector<Type,N,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == size_, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( size_ & size_t(-SIMDSIZE) ):( size_ ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( size_ - ( size_ % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2469,7 +2486,11 @@ inline auto HybridVector<Type,N,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) * (~rhs).load(i) );
    }
-   for( ; remainder && i<size_; ++i ) {
+   if( masked && i<size_ ) {
+      const size_t n( size_ - i );
+      storem( v_+i, n, loadm( v_+i, n ) * loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<size_; ++i ) {
       v_[i] *= (~rhs)[i];
    }
 }
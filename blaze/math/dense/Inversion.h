@@ -45,6 +45,7 @@
 #include <blaze/math/constraints/Adaptor.h>
 #include <blaze/math/constraints/BLASCompatible.h>
 #include <blaze/math/constraints/StrictlyTriangular.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/dense/StaticMatrix.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
@@ -62,6 +63,8 @@
 #include <blaze/math/shims/IsDivisor.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/Real.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
@@ -3288,8 +3291,10 @@ inline void invert6x6( DenseMatrix<MT,SO>& dm )
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// \note Matrices with less than DMATDECOMPOSITION_THRESHOLD elements are inverted by the
+// native Blaze kernels. Larger matrices are inverted by LAPACK, which requires a fitting LAPACK
+// library to be linked to the executable. In case the LAPACK mode is disabled (see the
+// BLAZE_LAPACK_MODE switch), all matrices are inverted by the native kernels.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3304,8 +3309,19 @@ inline void invertByLU( DenseMatrix<MT,SO>& dm )
    const size_t n( min( (~dm).rows(), (~dm).columns() ) );
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
-   getrf( ~dm, ipiv.get() );
-   getri( ~dm, ipiv.get() );
+#if BLAZE_LAPACK_MODE
+   if( (~dm).rows() * (~dm).columns() >= DMATDECOMPOSITION_THRESHOLD ) {
+      getrf( ~dm, ipiv.get() );
+      getri( ~dm, ipiv.get() );
+   }
+   else {
+      nativeGetrf( ~dm, ipiv.get() );
+      nativeGetri( ~dm, ipiv.get() );
+   }
+#else
+   nativeGetrf( ~dm, ipiv.get() );
+   nativeGetri( ~dm, ipiv.get() );
+#endif
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3497,8 +3513,10 @@ inline auto invertByLDLH( DenseMatrix<MT,SO>& dm )
 // \c complex<float> or \c complex<double> element type. The attempt to call the function with
 // matrices of any other element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// \note Matrices with less than DMATDECOMPOSITION_THRESHOLD elements are inverted by the
+// native Blaze kernels. Larger matrices are inverted by LAPACK, which requires a fitting LAPACK
+// library to be linked to the executable. In case the LAPACK mode is disabled (see the
+// BLAZE_LAPACK_MODE switch), all matrices are inverted by the native kernels.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a dm may already have been modified.
@@ -3512,21 +3530,30 @@ inline void invertByLLH( DenseMatrix<MT,SO>& dm )
 
    BLAZE_USER_ASSERT( isHermitian( ~dm ), "Invalid non-symmetric matrix detected" );
 
-   const char uplo( ( SO )?( 'L' ):( 'U' ) );
-
-   potrf( ~dm, uplo );
-   potri( ~dm, uplo );
+#if BLAZE_LAPACK_MODE
+   if( (~dm).rows() * (~dm).columns() >= DMATDECOMPOSITION_THRESHOLD ) {
+      potrf( ~dm, 'L' );
+      potri( ~dm, 'L' );
+   }
+   else {
+      nativePotrf( ~dm );
+      nativePotri( ~dm );
+   }
+#else
+   nativePotrf( ~dm );
+   nativePotri( ~dm );
+#endif
 
    if( SO ) {
-      for( size_t i=1UL; i<(~dm).rows(); ++i ) {
-         for( size_t j=0UL; j<i; ++j ) {
-            (~dm)(j,i) = conj( (~dm)(i,j) );
+      for( size_t j=1UL; j<(~dm).columns(); ++j ) {
+         for( size_t i=0UL; i<j; ++i ) {
+            (~dm)(i,j) = conj( (~dm)(j,i) );
          }
       }
    }
    else {
-      for( size_t j=1UL; j<(~dm).columns(); ++j ) {
-         for( size_t i=0UL; i<j; ++i ) {
+      for( size_t i=1UL; i<(~dm).rows(); ++i ) {
+         for( size_t j=0UL; j<i; ++j ) {
             (~dm)(j,i) = conj( (~dm)(i,j) );
          }
       }
@@ -47,11 +47,14 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/potrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 
 
 namespace blaze {
@@ -114,8 +117,11 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L );
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note Matrices with less than DMATDECOMPOSITION_THRESHOLD elements are decomposed by the
+// native, blocked Blaze kernels. Larger matrices are decomposed by LAPACK, which requires a
+// fitting LAPACK library to be linked to the executable. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), all matrices are decomposed by the native kernels and
+// LAPACK is not required.
 //
 // \note This function does only provide the basic exception safety guarantee, i.e. in case of an
 // exception \a L may already have been modified.
@@ -165,7 +171,16 @@ void llh( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& L )
       }
    }
 
-   potrf( l, 'L' );
+#if BLAZE_LAPACK_MODE
+   if( n*n >= DMATDECOMPOSITION_THRESHOLD ) {
+      potrf( l, 'L' );
+   }
+   else {
+      nativePotrf( l );
+   }
+#else
+   nativePotrf( l );
+#endif
 }
 //*************************************************************************************************
 
@@ -51,10 +51,13 @@
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
 #include <blaze/math/constraints/Upper.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/NumericCast.h>
 
@@ -113,7 +116,16 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
    int* ipiv  ( helper.get() );
    int* permut( ipiv + mindim );
 
-   getrf( ~A, ipiv );
+#if BLAZE_LAPACK_MODE
+   if( (~A).rows() * (~A).columns() >= DMATDECOMPOSITION_THRESHOLD ) {
+      getrf( ~A, ipiv );
+   }
+   else {
+      nativeGetrf( ~A, ipiv );
+   }
+#else
+   nativeGetrf( ~A, ipiv );
+#endif
 
    for( int i=0; i<size; ++i ) {
       permut[i] = i;
@@ -205,8 +217,11 @@ void lu( DenseMatrix<MT1,SO1>& A, Matrix<MT2,SO2>& P )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note Matrices with less than DMATDECOMPOSITION_THRESHOLD elements are decomposed by the
+// native, blocked Blaze kernels. Larger matrices are decomposed by LAPACK, which requires a
+// fitting LAPACK library to be linked to the executable. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), all matrices are decomposed by the native kernels and
+// LAPACK is not required.
 //
 // \note The LU decomposition will never fail, even for singular matrices. However, in case of a
 // singular matrix the resulting decomposition cannot be used for a matrix inversion or solving
@@ -56,6 +56,7 @@
 #include <blaze/math/constraints/Lower.h>
 #include <blaze/math/constraints/Upper.h>
 #include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/dense/PackedMMM.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/IsOne.h>
@@ -124,6 +125,11 @@ void mmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST be
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      pmmm( ~C, A, B, alpha, beta );
+      return;
+   }
+
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
@@ -624,6 +630,11 @@ void mmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST bet
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
    BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      pmmm( ~C, A, B, alpha, beta );
+      return;
+   }
+
    constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
 
    constexpr bool remainder( !IsPadded_v<MT2> || !IsPadded_v<MT3> );
@@ -1173,6 +1184,11 @@ void lmmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_DECLTYPE_AUTO( c, derestrict( ~C ) );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      plmmm( c, A, B, alpha, beta );
+      return;
+   }
+
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -1699,6 +1715,11 @@ void lmmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_DECLTYPE_AUTO( c, derestrict( ~C ) );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      plmmm( c, A, B, alpha, beta );
+      return;
+   }
+
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2243,6 +2264,11 @@ void ummm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha, ST b
 
    BLAZE_DECLTYPE_AUTO( c, derestrict( ~C ) );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      pummm( c, A, B, alpha, beta );
+      return;
+   }
+
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -2761,6 +2787,11 @@ void ummm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha, ST be
 
    BLAZE_DECLTYPE_AUTO( c, derestrict( ~C ) );
 
+   if( UsePackedKernel_v<MT1,MT2,MT3> ) {
+      pummm( c, A, B, alpha, beta );
+      return;
+   }
+
    if( isDefault( beta ) ) {
       reset( c );
    }
@@ -0,0 +1,190 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/MaskedTail.h
+//  \brief Header file for the masked SIMD tail processing of dense vectors and matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_MASKEDTAIL_H_
+#define _BLAZE_MATH_DENSE_MASKEDTAIL_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/simd/Loadm.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDMaskedAccess.h>
+#include <blaze/math/typetraits/IsContiguous.h>
+#include <blaze/math/typetraits/IsPadded.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MASKED TAIL CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the trailing elements of a dense operand can be loaded by a
+//        single masked SIMD operation.
+// \ingroup math
+//
+// This variable template evaluates to \a true in case the masked SIMD tails are enabled (see the
+// BLAZE_USE_MASKED_TAILS switch), masked SIMD loads are available for the element type of the
+// given dense vector or matrix type \a T, and the trailing elements of \a T can either be loaded
+// by a regular SIMD load (since \a T is padded) or by a masked load from its contiguous memory.
+*/
+template< typename T >  // Type of the dense vector or matrix
+constexpr bool HasMaskedTail_v =
+   ( useMaskedTails &&
+     HasSIMDMaskedAccess_v< ElementType_t<T> > &&
+     ( IsPadded_v<T> || ( HasConstDataAccess_v<T> && IsContiguous_v<T> ) ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MASKED TAIL LOAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the trailing elements of an unpadded dense vector by a masked SIMD load.
+// \ingroup math
+//
+// \param dv The dense vector to be accessed.
+// \param i The index of the first trailing element.
+// \param n The number of trailing elements \f$[0..SIMD size]\f$.
+// \return The trailing elements, padded with zeros.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE auto loadTail( const DenseVector<VT,TF>& dv, size_t i, size_t n )
+   -> EnableIf_t< !IsPadded_v<VT> && HasConstDataAccess_v<VT> && IsContiguous_v<VT>
+                , SIMDTrait_t< ElementType_t<VT> > >
+{
+   return loadm( (~dv).data()+i, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the trailing elements of a padded dense vector by a regular SIMD load.
+// \ingroup math
+//
+// \param dv The dense vector to be accessed.
+// \param i The index of the first trailing element.
+// \param n The number of trailing elements \f$[0..SIMD size]\f$.
+// \return The trailing elements, followed by the padding elements.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+BLAZE_ALWAYS_INLINE auto loadTail( const DenseVector<VT,TF>& dv, size_t i, size_t n )
+   -> DisableIf_t< !IsPadded_v<VT> && HasConstDataAccess_v<VT> && IsContiguous_v<VT>
+                 , decltype( (~dv).load( i ) ) >
+{
+   UNUSED_PARAMETER( n );
+   return (~dv).load( i );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the trailing elements of a row/column of an unpadded dense matrix by a masked
+//        SIMD load.
+// \ingroup math
+//
+// \param dm The dense matrix to be accessed.
+// \param i The row index of the first trailing element.
+// \param j The column index of the first trailing element.
+// \param n The number of trailing elements \f$[0..SIMD size]\f$.
+// \return The trailing elements, padded with zeros.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE auto loadTail( const DenseMatrix<MT,SO>& dm, size_t i, size_t j, size_t n )
+   -> EnableIf_t< !IsPadded_v<MT> && HasConstDataAccess_v<MT> && IsContiguous_v<MT>
+                , SIMDTrait_t< ElementType_t<MT> > >
+{
+   return ( SO )?( loadm( (~dm).data(j)+i, n ) ):( loadm( (~dm).data(i)+j, n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Loads the trailing elements of a row/column of a padded dense matrix by a regular SIMD
+//        load.
+// \ingroup math
+//
+// \param dm The dense matrix to be accessed.
+// \param i The row index of the first trailing element.
+// \param j The column index of the first trailing element.
+// \param n The number of trailing elements \f$[0..SIMD size]\f$.
+// \return The trailing elements, followed by the padding elements.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+BLAZE_ALWAYS_INLINE auto loadTail( const DenseMatrix<MT,SO>& dm, size_t i, size_t j, size_t n )
+   -> DisableIf_t< !IsPadded_v<MT> && HasConstDataAccess_v<MT> && IsContiguous_v<MT>
+                 , decltype( (~dm).load( i, j ) ) >
+{
+   UNUSED_PARAMETER( n );
+   return (~dm).load( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
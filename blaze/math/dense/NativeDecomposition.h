@@ -0,0 +1,949 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/NativeDecomposition.h
+//  \brief Header file for the native blocked dense matrix decompositions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_NATIVEDECOMPOSITION_H_
+#define _BLAZE_MATH_DENSE_NATIVEDECOMPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Adaptor.h>
+#include <blaze/math/constraints/BLASCompatible.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/Contiguous.h>
+#include <blaze/math/constraints/MutableDataAccess.h>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/DynamicMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NumericCast.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  NATIVE DENSE MATRIX DECOMPOSITION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Native dense matrix decomposition functions */
+//@{
+template< typename MT, bool SO >
+void nativeGetrf( DenseMatrix<MT,SO>& A, int* ipiv );
+
+template< typename MT, bool SO >
+void nativeGetri( DenseMatrix<MT,SO>& A, const int* ipiv );
+
+template< typename MT, bool SO >
+void nativePotrf( DenseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+void nativePotri( DenseMatrix<MT,SO>& A );
+
+template< typename MT, bool SO >
+void nativeGeqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau );
+
+template< typename MT, bool SO >
+void nativeUngqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Execution of the column-blocked trailing matrix update of a native decomposition.
+// \ingroup dense_matrix
+//
+// \param columns The total number of columns of the trailing matrix.
+// \param elements The total number of elements of the trailing matrix.
+// \param update The update kernel for a range of columns.
+// \return void
+//
+// This function calls \c update(begin,end) for consecutive column ranges of the trailing matrix
+// of a blocked decomposition. In case the trailing matrix has at least as many elements as
+// specified by the SMP_DMATDECOMPOSITION_THRESHOLD, the column ranges are of the size of the
+// decomposition block size and are processed in parallel. Otherwise the complete trailing
+// matrix is updated by a single, serial call.
+*/
+template< typename Kernel >  // Type of the update kernel
+void nativeTrailingUpdate( size_t columns, size_t elements, Kernel update )
+{
+   if( columns == 0UL ) {
+      return;
+   }
+
+   if( elements < SMP_DMATDECOMPOSITION_THRESHOLD || columns <= DECOMPOSITION_BLOCK_SIZE ) {
+      update( 0UL, columns );
+      return;
+   }
+
+   const size_t tasks( ( columns - 1UL ) / DECOMPOSITION_BLOCK_SIZE + 1UL );
+
+   smpFor( tasks, [columns,&update]( size_t task )
+   {
+      const size_t begin( task * DECOMPOSITION_BLOCK_SIZE );
+      const size_t end  ( min( begin + DECOMPOSITION_BLOCK_SIZE, columns ) );
+      update( begin, end );
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the 1-norm of a single real or complex value.
+// \ingroup dense_matrix
+//
+// \param value The given real or complex value.
+// \return The sum of the absolute values of the real and imaginary part.
+//
+// This function computes \f$ |re(value)| + |im(value)| \f$, which is used for the pivot
+// search of the native LU decomposition (equivalent to the \c cabs1 function of LAPACK).
+*/
+template< typename T >  // Type of the value
+inline UnderlyingBuiltin_t<T> nativeAbs1( const T& value )
+{
+   return std::abs( std::real( value ) ) + std::abs( std::imag( value ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the squared absolute value of a single real or complex value.
+// \ingroup dense_matrix
+//
+// \param value The given real or complex value.
+// \return The squared absolute value.
+*/
+template< typename T >  // Type of the value
+inline UnderlyingBuiltin_t<T> nativeAbs2( const T& value )
+{
+   return std::real( value ) * std::real( value ) + std::imag( value ) * std::imag( value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked LU decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param ipiv Auxiliary array for the pivot indices; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix LU decomposition of a general \a m-by-\a n matrix
+// without the help of LAPACK. The function has exactly the same semantics as the getrf()
+// LAPACK wrapper: In case of a column-major matrix the decomposition uses partial pivoting with
+// row interchanges and results in
+
+                          \f[ A = P \cdot L \cdot U, \f]
+
+// where \c L is stored below the diagonal (with implicit unit diagonal) and \c U on and above
+// the diagonal of \a A. In case of a row-major matrix the decomposition uses partial pivoting
+// with column interchanges and results in \f$ A = L \cdot U \cdot P \f$, where \c U has an
+// implicit unit diagonal. The 1-based pivot indices are stored in \a ipiv in the same way as by
+// LAPACK. In case of a singular matrix the decomposition does not fail, but \c U (or \c L in
+// case of a row-major matrix) has an exact zero on the diagonal.
+//
+// The decomposition is right-looking and blocked: Each panel of DECOMPOSITION_BLOCK_SIZE
+// columns is factorized by an unblocked kernel, whereas the trailing matrix is updated by
+// a triangular solve and a matrix multiplication, which is computed by the optimized Blaze
+// kernels. The trailing updates of large matrices are executed in parallel.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeGetrf( DenseMatrix<MT,SO>& A, int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+   using View = CustomMatrix<ET,unaligned,unpadded,columnMajor>;
+
+   // The decomposition is performed on the column-major interpretation of the matrix data
+   const size_t m  ( SO ? (~A).rows() : (~A).columns() );
+   const size_t n  ( SO ? (~A).columns() : (~A).rows() );
+   const size_t lda( (~A).spacing() );
+   const size_t k  ( min( m, n ) );
+
+   ET* const a( (~A).data() );
+
+   for( size_t kk=0UL; kk<k; kk+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( kk+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      // Unblocked factorization of the current panel
+      for( size_t j=kk; j<kend; ++j )
+      {
+         ET* const aj( a + j*lda );
+
+         size_t p( j );
+         BT pmax( nativeAbs1( aj[j] ) );
+
+         for( size_t i=j+1UL; i<m; ++i ) {
+            const BT tmp( nativeAbs1( aj[i] ) );
+            if( tmp > pmax ) {
+               p = i;
+               pmax = tmp;
+            }
+         }
+
+         ipiv[j] = numeric_cast<int>( p+1UL );
+
+         if( !isDefault( aj[p] ) )
+         {
+            if( p != j ) {
+               for( size_t c=kk; c<kend; ++c ) {
+                  std::swap( a[j+c*lda], a[p+c*lda] );
+               }
+            }
+
+            const ET inv( ET(1) / aj[j] );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               aj[i] *= inv;
+            }
+         }
+
+         for( size_t c=j+1UL; c<kend; ++c )
+         {
+            ET* const ac( a + c*lda );
+            const ET tmp( ac[j] );
+
+            if( isDefault( tmp ) ) continue;
+
+            for( size_t i=j+1UL; i<m; ++i ) {
+               ac[i] -= aj[i] * tmp;
+            }
+         }
+      }
+
+      // Application of the row interchanges to the columns left of the panel
+      for( size_t j=kk; j<kend; ++j ) {
+         const size_t p( ipiv[j] - 1 );
+         if( p != j ) {
+            for( size_t c=0UL; c<kk; ++c ) {
+               std::swap( a[j+c*lda], a[p+c*lda] );
+            }
+         }
+      }
+
+      // Update of the trailing matrix
+      const size_t kb( kend - kk );
+      const size_t columns( n - kend );
+
+      nativeTrailingUpdate( columns, ( m - kk ) * columns, [=]( size_t begin, size_t end )
+      {
+         const size_t jbegin( kend + begin );
+         const size_t jend  ( kend + end   );
+
+         for( size_t j=kk; j<kend; ++j ) {
+            const size_t p( ipiv[j] - 1 );
+            if( p != j ) {
+               for( size_t c=jbegin; c<jend; ++c ) {
+                  std::swap( a[j+c*lda], a[p+c*lda] );
+               }
+            }
+         }
+
+         for( size_t c=jbegin; c<jend; ++c )
+         {
+            ET* const ac( a + c*lda );
+
+            for( size_t j=kk; j<kend; ++j ) {
+               const ET tmp( ac[j] );
+               if( isDefault( tmp ) ) continue;
+               const ET* const aj( a + j*lda );
+               for( size_t i=j+1UL; i<kend; ++i ) {
+                  ac[i] -= aj[i] * tmp;
+               }
+            }
+         }
+
+         if( kend < m ) {
+            const View L21( a + kend + kk*lda    , m-kend, kb         , lda );
+            const View U12( a + kk   + jbegin*lda, kb    , jend-jbegin, lda );
+            View A22( a + kend + jbegin*lda, m-kend, jend-jbegin, lda );
+            subAssign( A22, L21 * U12 );
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a dense matrix based on its LU decomposition.
+// \ingroup dense_matrix
+//
+// \param A The LU decomposed matrix.
+// \param ipiv The pivot indices from the LU decomposition.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes the inverse of a general square matrix based on the LU decomposition
+// computed by the nativeGetrf() function (or the getrf() LAPACK wrapper) without the help of
+// LAPACK. The function has the same semantics as the getri() LAPACK wrapper: First \c U is
+// inverted, then \f$ A^{-1} \f$ is computed by solving \f$ A^{-1} \cdot L = U^{-1} \f$ and
+// finally the column interchanges are applied. In case the matrix is singular a
+// \a std::runtime_error exception is thrown.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeGetri( DenseMatrix<MT,SO>& A, const int* ipiv )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_HAVE_MUTABLE_DATA_ACCESS( MT );
+   BLAZE_CONSTRAINT_MUST_BE_CONTIGUOUS_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+   using View = CustomMatrix<ET,unaligned,unpadded,columnMajor>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   const size_t n  ( (~A).rows() );
+   const size_t lda( (~A).spacing() );
+
+   ET* const a( (~A).data() );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( isDefault( a[j+j*lda] ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+
+   // Inversion of the upper triangular matrix U
+   for( size_t j=0UL; j<n; ++j )
+   {
+      ET* const aj( a + j*lda );
+
+      aj[j] = ET(1) / aj[j];
+      const ET ajj( -aj[j] );
+
+      for( size_t p=0UL; p<j; ++p ) {
+         const ET tmp( aj[p] );
+         const ET* const ap( a + p*lda );
+         for( size_t i=0UL; i<p; ++i ) {
+            aj[i] += ap[i] * tmp;
+         }
+         aj[p] = ap[p] * tmp;
+      }
+
+      for( size_t i=0UL; i<j; ++i ) {
+         aj[i] *= ajj;
+      }
+   }
+
+   // Solution of inv(A)*L = inv(U) for inv(A)
+   if( n > 0UL )
+   {
+      DynamicMatrix<ET,columnMajor> work( n, DECOMPOSITION_BLOCK_SIZE );
+
+      size_t jend( n );
+
+      while( jend > 0UL )
+      {
+         const size_t jbegin( jend > DECOMPOSITION_BLOCK_SIZE ? jend - DECOMPOSITION_BLOCK_SIZE : 0UL );
+         const size_t jb( jend - jbegin );
+
+         for( size_t j=jbegin; j<jend; ++j ) {
+            ET* const aj( a + j*lda );
+            for( size_t i=jbegin; i<j+1UL; ++i ) {
+               reset( work(i,j-jbegin) );
+            }
+            for( size_t i=j+1UL; i<n; ++i ) {
+               work(i,j-jbegin) = aj[i];
+               reset( aj[i] );
+            }
+         }
+
+         if( jend < n ) {
+            View Aj( a + jbegin*lda, n, jb, lda );
+            const View Ar( a + jend*lda, n, n-jend, lda );
+            Aj -= Ar * submatrix( work, jend, 0UL, n-jend, jb );
+         }
+
+         for( size_t j=jend; j-- > jbegin; ) {
+            ET* const aj( a + j*lda );
+            for( size_t p=j+1UL; p<jend; ++p ) {
+               const ET tmp( work(p,j-jbegin) );
+               if( isDefault( tmp ) ) continue;
+               const ET* const ap( a + p*lda );
+               for( size_t i=0UL; i<n; ++i ) {
+                  aj[i] -= ap[i] * tmp;
+               }
+            }
+         }
+
+         jend = jbegin;
+      }
+   }
+
+   // Application of the column interchanges
+   for( size_t j=n; j-- > 0UL; ) {
+      const size_t p( ipiv[j] - 1 );
+      if( p != j ) {
+         for( size_t i=0UL; i<n; ++i ) {
+            std::swap( a[i+j*lda], a[i+p*lda] );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked Cholesky (LLH) decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Decomposition of non-positive-definite matrix failed.
+//
+// This function performs the Cholesky decomposition \f$ A = L \cdot L^{H} \f$ of the given
+// positive definite matrix without the help of LAPACK. Only the lower part of \a A is referenced
+// and overwritten by \c L, the strictly upper part remains unchanged. In case the matrix is not
+// positive definite a \a std::runtime_error exception is thrown. The decomposition is blocked
+// and right-looking; the trailing updates of large matrices are executed in parallel.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativePotrf( DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   MT& a( ~A );
+   const size_t n( a.rows() );
+
+   for( size_t kk=0UL; kk<n; kk+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( kk+DECOMPOSITION_BLOCK_SIZE, n ) );
+
+      // Unblocked factorization of the current panel
+      for( size_t j=kk; j<kend; ++j )
+      {
+         BT d( std::real( a(j,j) ) );
+
+         if( SO == rowMajor ) {
+            for( size_t p=kk; p<j; ++p ) {
+               d -= nativeAbs2( a(j,p) );
+            }
+         }
+
+         if( !( d > BT(0) ) ) {
+            BLAZE_THROW_LAPACK_ERROR( "Decomposition of non-positive-definite matrix failed" );
+         }
+
+         d = std::sqrt( d );
+         a(j,j) = ET( d );
+
+         if( SO == rowMajor )
+         {
+            for( size_t i=j+1UL; i<n; ++i ) {
+               ET tmp( a(i,j) );
+               for( size_t p=kk; p<j; ++p ) {
+                  tmp -= a(i,p) * conj( a(j,p) );
+               }
+               a(i,j) = tmp / d;
+            }
+         }
+         else
+         {
+            for( size_t i=j+1UL; i<n; ++i ) {
+               a(i,j) /= d;
+            }
+
+            for( size_t c=j+1UL; c<kend; ++c ) {
+               const ET tmp( conj( a(c,j) ) );
+               for( size_t i=c; i<n; ++i ) {
+                  a(i,c) -= a(i,j) * tmp;
+               }
+            }
+         }
+      }
+
+      // Update of the lower part of the trailing matrix
+      if( kend == n ) break;
+
+      const size_t kb( kend - kk );
+      const size_t rest( n - kend );
+
+      const DynamicMatrix<ET,!SO> H( ctrans( submatrix( a, kend, kk, rest, kb, unchecked ) ) );
+
+      nativeTrailingUpdate( rest, rest * rest / 2UL, [&a,&H,kk,kb,kend,rest]( size_t begin, size_t end )
+      {
+         const size_t jb( end - begin );
+
+         const DynamicMatrix<ET,SO> D( serial( submatrix( a, kend+begin, kk, jb, kb, unchecked ) *
+                                               submatrix( H, 0UL, begin, kb, jb, unchecked ) ) );
+
+         for( size_t j=0UL; j<jb; ++j ) {
+            for( size_t i=j; i<jb; ++i ) {
+               a(kend+begin+i,kend+begin+j) -= D(i,j);
+            }
+         }
+
+         if( end < rest ) {
+            auto C( submatrix( a, kend+end, kend+begin, rest-end, jb, unchecked ) );
+            subAssign( C, submatrix( a, kend+end, kk, rest-end, kb, unchecked ) *
+                          submatrix( H, 0UL, begin, kb, jb, unchecked ) );
+         }
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native inversion of a positive definite dense matrix based on its Cholesky decomposition.
+// \ingroup dense_matrix
+//
+// \param A The Cholesky decomposed matrix.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::runtime_error Inversion of singular matrix failed.
+//
+// This function computes the inverse of a positive definite matrix based on the Cholesky
+// decomposition computed by the nativePotrf() function without the help of LAPACK. The
+// lower part of \a A (containing \c L) is overwritten by the lower part of the inverse
+// \f$ L^{-H} \cdot L^{-1} \f$, the strictly upper part remains unchanged.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+//
+// \note This function does only provide the basic exception safety guarantee, i.e. in case of an
+// exception \a A may already have been modified.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativePotri( DenseMatrix<MT,SO>& A )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   if( !isSquare( ~A ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   MT& a( ~A );
+   const size_t n( a.rows() );
+
+   for( size_t j=0UL; j<n; ++j ) {
+      if( isDefault( a(j,j) ) ) {
+         BLAZE_THROW_LAPACK_ERROR( "Inversion of singular matrix failed" );
+      }
+   }
+
+   // Inversion of the lower triangular matrix L
+   for( size_t j=n; j-- > 0UL; )
+   {
+      a(j,j) = ET(1) / a(j,j);
+      const ET ajj( -a(j,j) );
+
+      for( size_t p=n; p-- > j+1UL; ) {
+         const ET tmp( a(p,j) );
+         for( size_t i=n; i-- > p+1UL; ) {
+            a(i,j) += a(i,p) * tmp;
+         }
+         a(p,j) = a(p,p) * tmp;
+      }
+
+      for( size_t i=j+1UL; i<n; ++i ) {
+         a(i,j) *= ajj;
+      }
+   }
+
+   // Computation of the lower part of inv(L)^H * inv(L)
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const ET aii( std::real( a(i,i) ) );
+
+      ET diag( aii * aii );
+      for( size_t r=i+1UL; r<n; ++r ) {
+         diag += nativeAbs2( a(r,i) );
+      }
+
+      for( size_t p=0UL; p<i; ++p ) {
+         ET tmp( a(i,p) * aii );
+         for( size_t r=i+1UL; r<n; ++r ) {
+            tmp += a(r,p) * conj( a(r,i) );
+         }
+         a(i,p) = tmp;
+      }
+
+      a(i,i) = diag;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Formation of the triangular factor of a block of elementary reflectors.
+// \ingroup dense_matrix
+//
+// \param V The unit lower trapezoidal matrix of Householder vectors.
+// \param tau The scalar factors of the elementary reflectors.
+// \param T The resulting upper triangular factor.
+// \return void
+//
+// This function forms the upper triangular matrix \c T of the block reflector
+// \f$ H = H(1) H(2) \ldots H(k) = I - V \cdot T \cdot V^{H} \f$ (equivalent to the LAPACK
+// \c larft function for forward, columnwise storage).
+*/
+template< typename MT1    // Type of the Householder vectors
+        , typename ET     // Type of the scalar factors
+        , typename MT2 >  // Type of the triangular factor
+void nativeLarft( const MT1& V, const ET* tau, MT2& T )
+{
+   const size_t m( V.rows()    );
+   const size_t k( V.columns() );
+
+   T.resize( k, k, false );
+   reset( T );
+
+   for( size_t i=0UL; i<k; ++i )
+   {
+      T(i,i) = tau[i];
+
+      if( isDefault( tau[i] ) ) continue;
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET tmp{};
+         for( size_t p=i; p<m; ++p ) {
+            tmp += conj( V(p,j) ) * V(p,i);
+         }
+         T(j,i) = -tau[i] * tmp;
+      }
+
+      for( size_t j=0UL; j<i; ++j ) {
+         ET tmp{};
+         for( size_t q=j; q<i; ++q ) {
+            tmp += T(j,q) * T(q,i);
+         }
+         T(j,i) = tmp;
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Extraction of the Householder vectors of a block of elementary reflectors.
+// \ingroup dense_matrix
+//
+// \param A The QR decomposed matrix.
+// \param kk The index of the first reflector of the block.
+// \param kend The index one past the last reflector of the block.
+// \param V The resulting unit lower trapezoidal matrix of Householder vectors.
+// \return void
+*/
+template< typename MT1    // Type of the QR decomposed matrix
+        , typename MT2 >  // Type of the Householder vectors
+void nativeReflectors( const MT1& A, size_t kk, size_t kend, MT2& V )
+{
+   using ET = ElementType_t<MT2>;
+
+   const size_t m( A.rows() - kk );
+   const size_t k( kend - kk );
+
+   V.resize( m, k, false );
+
+   for( size_t j=0UL; j<k; ++j ) {
+      for( size_t i=0UL; i<j; ++i ) {
+         reset( V(i,j) );
+      }
+      V(j,j) = ET(1);
+      for( size_t i=j+1UL; i<m; ++i ) {
+         V(i,j) = A(kk+i,kk+j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native blocked QR decomposition of the given dense matrix.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors; size >= min( \a m, \a n ).
+// \return void
+//
+// This function performs the dense matrix QR decomposition of a general \a m-by-\a n matrix
+// without the help of LAPACK. The resulting decomposition has the form
+
+                              \f[ A = Q \cdot R, \f]
+
+// where the upper trapezoidal matrix \c R is stored on and above the diagonal of \a A and the
+// orthogonal/unitary matrix \c Q is represented as a product of min(\a m,\a n) elementary
+// reflectors \f$ H(i) = I - tau_i \cdot v_i \cdot v_i^{H} \f$, whose vectors \f$ v_i \f$ are
+// stored below the diagonal of \a A (with implicit unit first element). In contrast to the
+// geqrf() LAPACK wrapper, the decomposition is always computed for the given matrix itself,
+// independent of its storage order. The matrix \c Q can be reconstructed by nativeUngqr().
+//
+// The decomposition is blocked: Each panel of DECOMPOSITION_BLOCK_SIZE columns is factorized by
+// an unblocked kernel, whereas the trailing matrix is updated by means of the compact WY
+// representation of the block reflector. The trailing updates of large matrices are executed
+// in parallel.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeGeqrf( DenseMatrix<MT,SO>& A, ElementType_t<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+   using BT = UnderlyingBuiltin_t<ET>;
+
+   MT& a( ~A );
+   const size_t m( a.rows()    );
+   const size_t n( a.columns() );
+   const size_t k( min( m, n ) );
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   for( size_t kk=0UL; kk<k; kk+=DECOMPOSITION_BLOCK_SIZE )
+   {
+      const size_t kend( min( kk+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      // Unblocked factorization of the current panel
+      for( size_t j=kk; j<kend; ++j )
+      {
+         BT xnorm( 0 );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            xnorm += nativeAbs2( a(i,j) );
+         }
+
+         const ET alpha( a(j,j) );
+
+         if( xnorm == BT(0) && std::imag( alpha ) == BT(0) ) {
+            reset( tau[j] );
+            continue;
+         }
+
+         const BT anorm( std::sqrt( nativeAbs2( alpha ) + xnorm ) );
+         const BT beta( std::real( alpha ) >= BT(0) ? -anorm : anorm );
+
+         tau[j] = ( ET( beta ) - alpha ) / ET( beta );
+
+         const ET scale( ET(1) / ( alpha - ET( beta ) ) );
+         for( size_t i=j+1UL; i<m; ++i ) {
+            a(i,j) *= scale;
+         }
+
+         a(j,j) = ET( beta );
+
+         const ET ctau( conj( tau[j] ) );
+
+         for( size_t c=j+1UL; c<kend; ++c )
+         {
+            ET tmp( a(j,c) );
+            for( size_t i=j+1UL; i<m; ++i ) {
+               tmp += conj( a(i,j) ) * a(i,c);
+            }
+            tmp *= ctau;
+
+            a(j,c) -= tmp;
+            for( size_t i=j+1UL; i<m; ++i ) {
+               a(i,c) -= a(i,j) * tmp;
+            }
+         }
+      }
+
+      // Application of the block reflector H^H = I - V*T^H*V^H to the trailing matrix
+      if( kend == n ) continue;
+
+      nativeReflectors( a, kk, kend, V );
+      nativeLarft( V, tau+kk, T );
+
+      const DynamicMatrix<ET,rowMajor> VH( ctrans( V ) );
+      const DynamicMatrix<ET,rowMajor> TH( ctrans( T ) );
+
+      nativeTrailingUpdate( n-kend, ( m-kk ) * ( n-kend ), [&a,&V,&VH,&TH,kk,kend,m]( size_t begin, size_t end )
+      {
+         auto C( submatrix( a, kk, kend+begin, m-kk, end-begin, unchecked ) );
+         const DynamicMatrix<ET,columnMajor> W( serial( TH * serial( VH * C ) ) );
+         subAssign( C, V * W );
+      } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Native reconstruction of the orthogonal/unitary matrix Q from a QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The QR decomposed matrix.
+// \param tau The scalar factors of the elementary reflectors.
+// \return void
+//
+// This function reconstructs the first min(\a m,\a n) columns of the orthogonal/unitary matrix
+// \f$ Q = H(1) H(2) \ldots H(k) \f$ of a QR decomposition computed by nativeGeqrf() without the
+// help of LAPACK (equivalent to the LAPACK \c orgqr and \c ungqr functions). The block
+// reflectors are applied in reverse order; the updates of large matrices are executed in
+// parallel.
+//
+// \note This function can only be used for dense matrices with \c float, \c double,
+// \c complex<float> or \c complex<double> element type. The attempt to call the function with
+// matrices of any other element type results in a compile time error!
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order of the dense matrix
+void nativeUngqr( DenseMatrix<MT,SO>& A, const ElementType_t<MT>* tau )
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_ADAPTOR_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_BE_BLAS_COMPATIBLE_TYPE( ElementType_t<MT> );
+
+   using ET = ElementType_t<MT>;
+
+   MT& a( ~A );
+   const size_t m( a.rows()    );
+   const size_t n( a.columns() );
+   const size_t k( min( m, n ) );
+
+   if( k == 0UL ) {
+      return;
+   }
+
+   DynamicMatrix<ET,columnMajor> V, T;
+
+   size_t kk( ( ( k - 1UL ) / DECOMPOSITION_BLOCK_SIZE ) * DECOMPOSITION_BLOCK_SIZE );
+
+   while( true )
+   {
+      const size_t kend( min( kk+DECOMPOSITION_BLOCK_SIZE, k ) );
+
+      nativeReflectors( a, kk, kend, V );
+      nativeLarft( V, tau+kk, T );
+
+      for( size_t j=kk; j<kend; ++j ) {
+         for( size_t i=0UL; i<m; ++i ) {
+            a(i,j) = ( i == j )?( ET(1) ):( ET(0) );
+         }
+      }
+
+      const DynamicMatrix<ET,rowMajor> VH( ctrans( V ) );
+
+      nativeTrailingUpdate( k-kk, ( m-kk ) * ( k-kk ), [&a,&V,&VH,&T,kk,m]( size_t begin, size_t end )
+      {
+         auto C( submatrix( a, kk, kk+begin, m-kk, end-begin, unchecked ) );
+         const DynamicMatrix<ET,columnMajor> W( serial( T * serial( VH * C ) ) );
+         subAssign( C, V * W );
+      } );
+
+      if( kk == 0UL ) break;
+      kk -= DECOMPOSITION_BLOCK_SIZE;
+   }
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,795 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMMM.h
+//  \brief Header file for the packed dense matrix multiplication kernels
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMMM_H_
+#define _BLAZE_MATH_DENSE_PACKEDMMM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/SIMDCombinable.h>
+#include <blaze/math/dense/DispatchKernels.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/IsOne.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/typetraits/IsBLASCompatible.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/IsComplex.h>
+#include <blaze/util/typetraits/IsSame.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED KERNEL CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the packed dense matrix multiplication kernels.
+// \ingroup dense_matrix
+//
+// The PMMMBlocking class template determines the register blocking of the micro kernel as well
+// as the cache blocking of the packed operand panels for the given element type \a T. The
+// register tile consists of \a MR broadcast elements times \a NV SIMD vectors and is chosen
+// such that all accumulators fit into the register file of the active instruction set (32
+// vector registers for AVX-512 and MIC, 16 vector registers for SSE and AVX). The block sizes
+// \a MC, \a NC and \a KC are derived from the PMMM_*_BLOCK_SIZE settings and rounded to multiples
+// of the register tile. The static microKernel() function computes a single register tile by
+// means of the micro kernel of the instruction set selected at compile time.
+*/
+template< typename T >
+struct PMMMBlocking
+{
+   //! Number of elements packed into a single SIMD vector.
+   static constexpr size_t SIMDSIZE = SIMDTrait<T>::size;
+
+   //! Number of available vector registers.
+   static constexpr size_t REGISTERS = ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE ) ? 32UL : 16UL;
+
+   //! Number of broadcast elements per register tile.
+   static constexpr size_t MR = ( IsComplex_v<T> )
+                                ?( REGISTERS == 32UL ? 4UL : 3UL )
+                                :( REGISTERS == 32UL ? 8UL : 6UL );
+
+   //! Number of SIMD vectors per register tile.
+   static constexpr size_t NV = ( !IsComplex_v<T> && REGISTERS == 32UL ) ? 3UL : 2UL;
+
+   //! Number of vectorized elements per register tile.
+   static constexpr size_t NR = NV * SIMDSIZE;
+
+   //! Size of the packed blocks in the broadcast dimension.
+   static constexpr size_t MC = max( MR, PMMM_M_BLOCK_SIZE - PMMM_M_BLOCK_SIZE % MR );
+
+   //! Size of the packed blocks in the vectorized dimension.
+   static constexpr size_t NC = max( NR, PMMM_N_BLOCK_SIZE - PMMM_N_BLOCK_SIZE % NR );
+
+   //! Size of the packed blocks in the inner dimension.
+   static constexpr size_t KC = ( PMMM_K_BLOCK_SIZE * 8UL ) / max( sizeof(T), 8UL );
+
+   BLAZE_STATIC_ASSERT( MC % MR == 0UL && NC % NR == 0UL && KC > 0UL );
+
+   template< typename ET1, typename ET2 >
+   static void microKernel( size_t kc, const ET1* a, const ET2* b, T* tile );
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKING AND MICRO KERNEL
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the broadcast operand into micro panels of \a MR rows.
+// \ingroup dense_matrix
+//
+// \param A The operand to be packed.
+// \param pbegin The first index of the block in the broadcast dimension.
+// \param mc The size of the block in the broadcast dimension.
+// \param kbegin The first index of the block in the inner dimension.
+// \param kc The size of the block in the inner dimension.
+// \param alpha The scaling factor to be applied to all packed elements.
+// \param buffer The target buffer for the packed elements.
+// \return void
+//
+// This function copies the \a mc x \a kc block of the operand \a A (or of its transpose in case
+// \a TF is set to \a true) into \a buffer such that the \a MR elements of each micro panel that
+// are required for a single step of the micro kernel are stored contiguously. Incomplete micro
+// panels are padded with zeros. The scaling factor \a alpha is folded into the packed elements.
+*/
+template< size_t MR        // Number of broadcast elements per register tile
+        , bool TF          // Transposition flag
+        , typename MT      // Type of the operand
+        , typename ST      // Type of the scaling factor
+        , typename ET >    // Type of the packed elements
+void pmmmPackBroadcast( const MT& A, size_t pbegin, size_t mc, size_t kbegin, size_t kc,
+                        ST alpha, ET* buffer )
+{
+   const bool scale( !isOne( alpha ) );
+
+   for( size_t ir=0UL; ir<mc; ir+=MR )
+   {
+      const size_t mr( min( MR, mc-ir ) );
+
+      for( size_t r=0UL; r<mr; ++r ) {
+         const size_t p( pbegin+ir+r );
+         for( size_t k=0UL; k<kc; ++k ) {
+            const ET value( TF ? A(kbegin+k,p) : A(p,kbegin+k) );
+            buffer[k*MR+r] = ( scale ? ET( value * alpha ) : value );
+         }
+      }
+
+      for( size_t r=mr; r<MR; ++r ) {
+         for( size_t k=0UL; k<kc; ++k ) {
+            reset( buffer[k*MR+r] );
+         }
+      }
+
+      buffer += MR*kc;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packs a block of the vectorized operand into micro panels of \a NR columns.
+// \ingroup dense_matrix
+//
+// \param B The operand to be packed.
+// \param kbegin The first index of the block in the inner dimension.
+// \param kc The size of the block in the inner dimension.
+// \param qbegin The first index of the block in the vectorized dimension.
+// \param nc The size of the block in the vectorized dimension.
+// \param buffer The target buffer for the packed elements.
+// \return void
+//
+// This function copies the \a kc x \a nc block of the operand \a B (or of its transpose in case
+// \a TF is set to \a true) into \a buffer such that the \a NR elements of each micro panel that
+// are required for a single step of the micro kernel are stored contiguously and aligned.
+// Incomplete micro panels are padded with zeros.
+*/
+template< size_t NR        // Number of vectorized elements per register tile
+        , bool TF          // Transposition flag
+        , typename MT      // Type of the operand
+        , typename ET >    // Type of the packed elements
+void pmmmPackVectorized( const MT& B, size_t kbegin, size_t kc, size_t qbegin, size_t nc,
+                         ET* buffer )
+{
+   for( size_t jr=0UL; jr<nc; jr+=NR )
+   {
+      const size_t nr( min( NR, nc-jr ) );
+
+      for( size_t k=0UL; k<kc; ++k ) {
+         for( size_t c=0UL; c<nr; ++c ) {
+            const size_t q( qbegin+jr+c );
+            buffer[k*NR+c] = ( TF ? B(q,kbegin+k) : B(kbegin+k,q) );
+         }
+         for( size_t c=nr; c<NR; ++c ) {
+            reset( buffer[k*NR+c] );
+         }
+      }
+
+      buffer += NR*kc;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Register-blocked micro kernel of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kc The size of the packed micro panels in the inner dimension.
+// \param a The packed micro panel of the broadcast operand.
+// \param b The packed micro panel of the vectorized operand.
+// \param tile The aligned \a MR x \a NR elements of the resulting register tile.
+// \return void
+//
+// This function computes the rank-\a kc update of an \a MR x \a NR register tile by means of
+// \a kc outer products. The accumulation is performed in local registers, the final result is
+// stored row by row to \a tile. In each step \a NV aligned SIMD vectors of the vectorized micro
+// panel are loaded and multiplied with \a MR broadcasts of the elements of the broadcast micro
+// panel.
+*/
+template< size_t MR        // Number of broadcast elements per register tile
+        , size_t NV        // Number of SIMD vectors per register tile
+        , typename ET1     // Type of the broadcast elements
+        , typename ET2     // Type of the vectorized elements
+        , typename ET3 >   // Type of the resulting elements
+BLAZE_ALWAYS_INLINE void pmmmMicroKernel( size_t kc, const ET1* a, const ET2* b, ET3* tile )
+{
+   constexpr size_t SIMDSIZE( SIMDTrait<ET3>::size );
+
+   SIMDTrait_t<ET3> acc[MR][NV];
+
+   for( size_t k=0UL; k<kc; ++k )
+   {
+      SIMDTrait_t<ET2> b1[NV];
+
+      for( size_t v=0UL; v<NV; ++v ) {
+         b1[v] = loada( b + v*SIMDSIZE );
+      }
+
+      for( size_t r=0UL; r<MR; ++r ) {
+         const SIMDTrait_t<ET1> a1( set( a[r] ) );
+         for( size_t v=0UL; v<NV; ++v ) {
+            acc[r][v] += a1 * b1[v];
+         }
+      }
+
+      a += MR;
+      b += NV*SIMDSIZE;
+   }
+
+   for( size_t r=0UL; r<MR; ++r ) {
+      for( size_t v=0UL; v<NV; ++v ) {
+         storea( tile + ( r*NV + v )*SIMDSIZE, acc[r][v] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes a single register tile of the packed dense matrix multiplication.
+// \ingroup dense_matrix
+//
+// \param kc The size of the packed micro panels in the inner dimension.
+// \param a The packed micro panel of the broadcast operand.
+// \param b The packed micro panel of the vectorized operand.
+// \param tile The aligned \a MR x \a NR elements of the resulting register tile.
+// \return void
+*/
+template< typename T >     // Type of the resulting elements
+template< typename ET1     // Type of the broadcast elements
+        , typename ET2 >   // Type of the vectorized elements
+BLAZE_ALWAYS_INLINE void PMMMBlocking<T>::microKernel( size_t kc, const ET1* a, const ET2* b, T* tile )
+{
+   pmmmMicroKernel<MR,NV>( kc, a, b, tile );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+#if BLAZE_DISPATCH_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the AVX2 packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The PMMMBlockingAVX2 class template corresponds to the PMMMBlocking class template for the
+// runtime dispatched AVX2 micro kernel (see the pmmmMicroKernelAVX2() function), which computes
+// a register tile of 6 x 2 AVX vectors for \c float and \c double.
+*/
+template< typename T >
+struct PMMMBlockingAVX2
+{
+   static constexpr size_t MR = 6UL;
+   static constexpr size_t NV = 2UL;
+   static constexpr size_t NR = NV * DispatchAVX2<T>::size;
+   static constexpr size_t MC = max( MR, PMMM_M_BLOCK_SIZE - PMMM_M_BLOCK_SIZE % MR );
+   static constexpr size_t NC = max( NR, PMMM_N_BLOCK_SIZE - PMMM_N_BLOCK_SIZE % NR );
+   static constexpr size_t KC = ( PMMM_K_BLOCK_SIZE * 8UL ) / max( sizeof(T), 8UL );
+
+   static void microKernel( size_t kc, const T* a, const T* b, T* tile ) {
+      pmmmMicroKernelAVX2( kc, a, b, tile );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blocking parameters of the AVX-512 packed dense matrix multiplication kernel.
+// \ingroup dense_matrix
+//
+// The PMMMBlockingAVX512 class template corresponds to the PMMMBlocking class template for the
+// runtime dispatched AVX-512 micro kernel (see the pmmmMicroKernelAVX512() function), which
+// computes a register tile of 8 x 3 AVX-512 vectors for \c float and \c double.
+*/
+template< typename T >
+struct PMMMBlockingAVX512
+{
+   static constexpr size_t MR = 8UL;
+   static constexpr size_t NV = 3UL;
+   static constexpr size_t NR = NV * DispatchAVX512<T>::size;
+   static constexpr size_t MC = max( MR, PMMM_M_BLOCK_SIZE - PMMM_M_BLOCK_SIZE % MR );
+   static constexpr size_t NC = max( NR, PMMM_N_BLOCK_SIZE - PMMM_N_BLOCK_SIZE % NR );
+   static constexpr size_t KC = ( PMMM_K_BLOCK_SIZE * 8UL ) / max( sizeof(T), 8UL );
+
+   static void microKernel( size_t kc, const T* a, const T* b, T* tile ) {
+      pmmmMicroKernelAVX512( kc, a, b, tile );
+   }
+};
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed dense matrix/dense matrix multiplication for the given blocking parameters
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements a GotoBLAS-style packed matrix multiplication. For a row-major target
+// matrix the rows of \a A are broadcast and the rows of \a B are vectorized, for a column-major
+// target matrix the columns of \a B are broadcast and the columns of \a A are vectorized. Panels
+// of both operands are packed into contiguous, aligned buffers that fit into the caches and are
+// combined by a register-blocked micro kernel. In case \a LOW (\a UPP) is set to \a true only the
+// lower (upper) part of \a C is updated. Lower and upper operands are exploited by skipping all
+// blocks that are known to be zero. The register tiles are computed by the micro kernel of the
+// given \a Blocking class (see for instance the PMMMBlocking class template).
+*/
+template< typename Blocking  // Type of the blocking parameters
+        , bool LOW         // Lower flag
+        , bool UPP         // Upper flag
+        , bool SO          // Storage order of the target matrix
+        , typename MT1     // Type of the target matrix
+        , typename MT2     // Type of the left-hand side matrix operand
+        , typename MT3     // Type of the right-hand side matrix operand
+        , typename ST >    // Type of the scaling factors
+void pmmmKernel( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+
+   using XT = If_t< SO, ET3, ET2 >;  // Type of the broadcast elements
+   using YT = If_t< SO, ET2, ET3 >;  // Type of the vectorized elements
+
+   constexpr size_t SIMDSIZE( SIMDTrait<ET1>::size );
+   constexpr size_t MR( Blocking::MR );
+   constexpr size_t NR( Blocking::NR );
+   constexpr size_t MC( Blocking::MC );
+   constexpr size_t NC( Blocking::NC );
+   constexpr size_t KC( Blocking::KC );
+
+   const size_t M( A.rows()    );
+   const size_t N( B.columns() );
+   const size_t K( A.columns() );
+
+   BLAZE_STATIC_ASSERT( NR % SIMDSIZE == 0UL );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows(), "Invalid matrix sizes detected" );
+
+   // Sizes of the broadcast (P) and of the vectorized (Q) dimension
+   const size_t P( SO ? N : M );
+   const size_t Q( SO ? M : N );
+
+   if( isDefault( beta ) ) {
+      reset( C );
+   }
+   else if( !isOne( beta ) ) {
+      C *= beta;
+   }
+
+   if( M == 0UL || N == 0UL || K == 0UL )
+      return;
+
+   DynamicVector<XT,false> Xp( MC*KC );
+   DynamicVector<YT,false> Yp( min( NC, ( Q+NR-1UL ) / NR * NR ) * KC );
+
+   alignas( AlignmentOf_v<ET1> ) ET1 tile[MR*NR];
+
+   for( size_t qc=0UL; qc<Q; qc+=NC )
+   {
+      const size_t nc( min( NC, Q-qc ) );
+
+      for( size_t pc=0UL; pc<K; pc+=KC )
+      {
+         const size_t kc( min( KC, K-pc ) );
+
+         // Skipping zero blocks of the operand that is packed into the vectorized buffer
+         if( SO ) {
+            if( ( IsLower_v<MT2> && pc >= qc+nc ) || ( IsUpper_v<MT2> && pc+kc <= qc ) )
+               continue;
+         }
+         else {
+            if( ( IsLower_v<MT3> && qc >= pc+kc ) || ( IsUpper_v<MT3> && pc >= qc+nc ) )
+               continue;
+         }
+
+         if( SO )
+            pmmmPackVectorized<NR,true>( A, pc, kc, qc, nc, Yp.data() );
+         else
+            pmmmPackVectorized<NR,false>( B, pc, kc, qc, nc, Yp.data() );
+
+         for( size_t ic=0UL; ic<P; ic+=MC )
+         {
+            const size_t mc( min( MC, P-ic ) );
+
+            // Skipping blocks of the target matrix that lie outside of the computed triangle
+            // and zero blocks of the operand that is packed into the broadcast buffer
+            const size_t ibegin( SO ? qc : ic ), iend( SO ? qc+nc : ic+mc );
+            const size_t jbegin( SO ? ic : qc ), jend( SO ? ic+mc : qc+nc );
+
+            if( ( LOW && jbegin >= iend ) || ( UPP && ibegin >= jend ) )
+               continue;
+
+            if( SO ) {
+               if( ( IsLower_v<MT3> && ic >= pc+kc ) || ( IsUpper_v<MT3> && pc >= ic+mc ) )
+                  continue;
+            }
+            else {
+               if( ( IsLower_v<MT2> && pc >= ic+mc ) || ( IsUpper_v<MT2> && pc+kc <= ic ) )
+                  continue;
+            }
+
+            if( SO )
+               pmmmPackBroadcast<MR,true>( B, ic, mc, pc, kc, alpha, Xp.data() );
+            else
+               pmmmPackBroadcast<MR,false>( A, ic, mc, pc, kc, alpha, Xp.data() );
+
+            for( size_t jr=0UL; jr<nc; jr+=NR )
+            {
+               const size_t nr( min( NR, nc-jr ) );
+               const size_t q( qc+jr );
+
+               for( size_t ir=0UL; ir<mc; ir+=MR )
+               {
+                  const size_t mr( min( MR, mc-ir ) );
+                  const size_t p( ic+ir );
+
+                  // Index ranges of the register tile in the target matrix
+                  const size_t i1( SO ? q : p ), i2( SO ? q+nr : p+mr );
+                  const size_t j1( SO ? p : q ), j2( SO ? p+mr : q+nr );
+
+                  if( ( LOW && j1 >= i2 ) || ( UPP && i1 >= j2 ) )
+                     continue;
+
+                  Blocking::microKernel( kc, Xp.data()+ir*kc, Yp.data()+jr*kc, tile );
+
+                  const bool full( mr == MR && nr == NR &&
+                                   ( !LOW || j2 <= i1+1UL ) && ( !UPP || i2 <= j1+1UL ) );
+
+                  if( full ) {
+                     for( size_t r=0UL; r<MR; ++r ) {
+                        for( size_t c=0UL; c<NR; c+=SIMDSIZE ) {
+                           if( SO ) {
+                              C.storeu( q+c, p+r, C.loadu( q+c, p+r ) + loada( tile+r*NR+c ) );
+                           }
+                           else {
+                              C.storeu( p+r, q+c, C.loadu( p+r, q+c ) + loada( tile+r*NR+c ) );
+                           }
+                        }
+                     }
+                     continue;
+                  }
+
+                  for( size_t r=0UL; r<mr; ++r ) {
+                     for( size_t c=0UL; c<nr; ++c )
+                     {
+                        const size_t i( SO ? q+c : p+r );
+                        const size_t j( SO ? p+r : q+c );
+
+                        if( ( LOW && j > i ) || ( UPP && i > j ) )
+                           continue;
+
+                        C(i,j) += tile[r*NR+c];
+                     }
+                  }
+               }
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the packed dense matrix/dense matrix multiplication kernels
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function selects the micro kernel of the instruction set selected at compile time for
+// all element types that are not supported by the runtime dispatched kernels.
+*/
+template< bool LOW         // Lower flag
+        , bool UPP         // Upper flag
+        , bool SO          // Storage order of the target matrix
+        , typename MT1     // Type of the target matrix
+        , typename MT2     // Type of the left-hand side matrix operand
+        , typename MT3     // Type of the right-hand side matrix operand
+        , typename ST >    // Type of the scaling factors
+inline DisableIf_t< IsDispatchable_v< ElementType_t<MT1> > >
+   pmmmBackend( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   pmmmKernel< PMMMBlocking< ElementType_t<MT1> >, LOW, UPP, SO >( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend of the packed dense matrix/dense matrix multiplication kernels
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function selects the micro kernel of the instruction set returned by getInstructionSet()
+// for \c float and \c double element types in case the runtime dispatch mode is active.
+*/
+template< bool LOW         // Lower flag
+        , bool UPP         // Upper flag
+        , bool SO          // Storage order of the target matrix
+        , typename MT1     // Type of the target matrix
+        , typename MT2     // Type of the left-hand side matrix operand
+        , typename MT3     // Type of the right-hand side matrix operand
+        , typename ST >    // Type of the scaling factors
+inline EnableIf_t< IsDispatchable_v< ElementType_t<MT1> > >
+   pmmmBackend( MT1& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET = ElementType_t<MT1>;
+
+#if BLAZE_DISPATCH_MODE
+   if( getInstructionSet() == InstructionSet::avx512 && isDispatched() ) {
+      pmmmKernel< PMMMBlockingAVX512<ET>, LOW, UPP, SO >( C, A, B, alpha, beta );
+      return;
+   }
+   if( getInstructionSet() == InstructionSet::avx2 && isDispatched() ) {
+      pmmmKernel< PMMMBlockingAVX2<ET>, LOW, UPP, SO >( C, A, B, alpha, beta );
+      return;
+   }
+#endif
+
+   pmmmKernel< PMMMBlocking<ET>, LOW, UPP, SO >( C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compile time check whether the packed kernels can be used for the given matrix types.
+// \ingroup dense_matrix
+//
+// This variable template evaluates to \a true in case the packed dense matrix multiplication
+// kernels are enabled (see the BLAZE_USE_PACKED_KERNELS switch) and all three matrix types have
+// the same, BLAS compatible element type (i.e. \c float, \c double, \c complex<float> or
+// \c complex<double>). Otherwise it evaluates to \a false.
+*/
+template< typename MT1, typename MT2, typename MT3 >
+constexpr bool UsePackedKernel_v =
+   ( usePackedKernels &&
+     IsBLASCompatible_v< ElementType_t<MT1> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT2> > &&
+     IsSame_v< ElementType_t<MT1>, ElementType_t<MT3> > );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a general dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the packed compute kernel for a general dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Both \a A and \a B must be
+// non-expression dense matrix types, \a C must be a non-expression, non-adaptor dense matrix
+// type. The element types of all three matrices must be SIMD combinable, i.e. must provide a
+// common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, bool SO, typename ST >
+void pmmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
+
+   pmmmBackend<false,false,SO>( ~C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for a lower dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the packed compute kernel for a lower dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Only the lower part of \a C is
+// updated. Both \a A and \a B must be non-expression dense matrix types, \a C must be a
+// non-expression dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, bool SO, typename ST >
+void plmmm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
+
+   pmmmBackend<true,false,SO>( ~C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Packed compute kernel for an upper dense matrix/dense matrix multiplication
+//        (\f$ C=\alpha*A*B+\beta*C \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side dense matrix.
+// \param A The left-hand side multiplication operand.
+// \param B The right-hand side multiplication operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \param beta The scaling factor for \f$ C \f$.
+// \return void
+//
+// This function implements the packed compute kernel for an upper dense matrix/dense matrix
+// multiplication of the form \f$ C=\alpha*A*B+\beta*C \f$. Only the upper part of \a C is
+// updated. Both \a A and \a B must be non-expression dense matrix types, \a C must be a
+// non-expression dense matrix type. The element types of all three matrices must be SIMD
+// combinable, i.e. must provide a common SIMD interface.
+*/
+template< typename MT1, typename MT2, typename MT3, bool SO, typename ST >
+void pummm( DenseMatrix<MT1,SO>& C, const MT2& A, const MT3& B, ST alpha, ST beta )
+{
+   using ET1 = ElementType_t<MT1>;
+   using ET2 = ElementType_t<MT2>;
+   using ET3 = ElementType_t<MT3>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT1 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT1 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET2 );
+   BLAZE_CONSTRAINT_MUST_BE_SIMD_COMBINABLE_TYPES( ET1, ET3 );
+
+   pmmmBackend<false,true,SO>( ~C, A, B, alpha, beta );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,261 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/PackedMult.h
+//  \brief Header file for the kernels of the multiplication with packed dense matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_PACKEDMULT_H_
+#define _BLAZE_MATH_DENSE_PACKEDMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/Computation.h>
+#include <blaze/math/constraints/DenseMatrix.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/expressions/DenseMatrix.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/shims/Conjugate.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/math/views/Column.h>
+#include <blaze/math/views/Row.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX/DENSE VECTOR MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a packed dense matrix/dense vector multiplication
+//        (\f$ \vec{y}+=\alpha*A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param y The target left-hand side dense vector.
+// \param A The left-hand side packed dense matrix operand.
+// \param x The right-hand side dense vector operand.
+// \param alpha The scaling factor for \f$ A*\vec{x} \f$.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of a symmetric, Hermitian,
+// lower, or upper dense matrix with packed storage (see PackedMatrix) and a dense vector. It
+// traverses the contiguously stored segments of \a A: The segment \f$ p \f$ of a symmetric,
+// Hermitian, or lower matrix contains the elements \f$ (p,0) \f$ to \f$ (p,p) \f$ and adds a
+// dot product to \f$ y_p \f$. The strictly lower part of the segment of a symmetric or
+// Hermitian matrix additionally represents the (conjugated) column \f$ p \f$ and is added as
+// a scaled vector to \a y. The segment of an upper matrix contains the column elements
+// \f$ (0,p) \f$ to \f$ (p,p) \f$. Both the dot products and the vector updates are vectorized.
+// \a A must be a non-expression packed dense matrix type, \a x must be a non-expression dense
+// vector type.
+*/
+template< typename VT1   // Type of the left-hand side target vector
+        , typename MT    // Type of the left-hand side matrix operand
+        , typename VT2   // Type of the right-hand side vector operand
+        , typename ST >  // Type of the scaling factor
+void packedmv( DenseVector<VT1,false>& y, const MT& A, const VT2& x, ST alpha )
+{
+   using ET = ElementType_t<MT>;
+   using SegmentType = CustomVector<const ET,unaligned,unpadded>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE   ( VT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( VT2 );
+
+   BLAZE_STATIC_ASSERT( IsPacked_v<MT> );
+
+   constexpr bool storesRows   ( !IsUpper_v<MT> );
+   constexpr bool storesColumns( !IsLower_v<MT> );
+   constexpr bool conjugate    ( IsHermitian_v<MT> && !IsSymmetric_v<MT> );
+
+   const size_t N( A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == x.size()   , "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~y).size(), "Invalid vector size" );
+
+   for( size_t p=0UL; p<N; ++p )
+   {
+      const SegmentType segment( A.data( p ), p+1UL );
+
+      if( storesRows ) {
+         (~y)[p] += alpha * ( trans( segment ) * subvector( x, 0UL, p+1UL, unchecked ) );
+      }
+
+      const size_t m( storesRows ? p : p+1UL );
+
+      if( !storesColumns || m == 0UL ) continue;
+
+      if( conjugate ) {
+         subvector( ~y, 0UL, m, unchecked ) +=
+            ( alpha * x[p] ) * conj( subvector( segment, 0UL, m, unchecked ) );
+      }
+      else {
+         subvector( ~y, 0UL, m, unchecked ) +=
+            ( alpha * x[p] ) * subvector( segment, 0UL, m, unchecked );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  PACKED DENSE MATRIX/DENSE MATRIX MULTIPLICATION KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a packed dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side row-major dense matrix.
+// \param A The left-hand side packed dense matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of a symmetric, Hermitian,
+// lower, or upper dense matrix with packed storage (see PackedMatrix) and a dense matrix for a
+// row-major target matrix. Each stored element \f$ a_{pq} \f$ of the segment \f$ p \f$ of \a A
+// (see packedmv()) adds the scaled row \f$ q \f$ of \a B to the row \f$ p \f$ of \a C and/or
+// (in case of a mirrored or an upper segment) the scaled row \f$ p \f$ of \a B to the row
+// \f$ q \f$ of \a C. Thus all updates are vectorized operations on full rows.
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void packedmm( DenseMatrix<MT1,false>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   using ET = ElementType_t<MT2>;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT2 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_STATIC_ASSERT( IsPacked_v<MT2> );
+
+   constexpr bool storesRows   ( !IsUpper_v<MT2> );
+   constexpr bool storesColumns( !IsLower_v<MT2> );
+   constexpr bool conjugate    ( IsHermitian_v<MT2> && !IsSymmetric_v<MT2> );
+
+   const size_t N( A.rows() );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (~C).columns(), "Invalid number of columns" );
+
+   for( size_t p=0UL; p<N; ++p )
+   {
+      const ET* segment( A.data( p ) );
+
+      for( size_t q=0UL; q<=p; ++q )
+      {
+         if( storesRows ) {
+            row( ~C, p, unchecked ) += ( alpha * segment[q] ) * row( B, q, unchecked );
+         }
+
+         if( storesColumns && ( !storesRows || q < p ) ) {
+            const ET value( conjugate ? conj( segment[q] ) : segment[q] );
+            row( ~C, q, unchecked ) += ( alpha * value ) * row( B, p, unchecked );
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Compute kernel for a packed dense matrix/dense matrix multiplication
+//        (\f$ C+=\alpha*A*B \f$).
+// \ingroup dense_matrix
+//
+// \param C The target left-hand side column-major dense matrix.
+// \param A The left-hand side packed dense matrix operand.
+// \param B The right-hand side dense matrix operand.
+// \param alpha The scaling factor for \f$ A*B \f$.
+// \return void
+//
+// This function implements the compute kernel for the multiplication of a symmetric, Hermitian,
+// lower, or upper dense matrix with packed storage (see PackedMatrix) and a dense matrix for a
+// column-major target matrix. Each column of \a C is computed by means of the packed dense
+// matrix/dense vector kernel (see packedmv()).
+*/
+template< typename MT1   // Type of the left-hand side target matrix
+        , typename MT2   // Type of the left-hand side matrix operand
+        , typename MT3   // Type of the right-hand side matrix operand
+        , typename ST >  // Type of the scaling factor
+void packedmm( DenseMatrix<MT1,true>& C, const MT2& A, const MT3& B, ST alpha )
+{
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_MATRIX_TYPE   ( MT3 );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_COMPUTATION_TYPE( MT3 );
+
+   BLAZE_INTERNAL_ASSERT( A.columns() == B.rows()      , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( A.rows()    == (~C).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( B.columns() == (~C).columns(), "Invalid number of columns" );
+
+   for( size_t j=0UL; j<B.columns(); ++j ) {
+      auto c( column( ~C, j, unchecked ) );
+      packedmv( c, A, column( B, j, unchecked ), alpha );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
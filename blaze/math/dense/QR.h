@@ -49,6 +49,7 @@
 #include <blaze/math/constraints/StrictlyTriangular.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/constraints/UniTriangular.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/geqrf.h>
@@ -57,8 +58,11 @@
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/views/Submatrix.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/EnableIf.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -122,6 +126,68 @@ inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The matrix to be QR decomposed.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param lapack \a true in case the decomposition is performed by LAPACK, \a false if not.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
+// in-place QR decomposition of the given matrix either by LAPACK or by the native Blaze kernels.
+*/
+template< typename MT1 >  // Type of matrix A
+inline void qr_decompose( MT1& A, ElementType_t<MT1>* tau, bool lapack )
+{
+#if BLAZE_LAPACK_MODE
+   if( lapack ) {
+      geqrf( A, tau );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( lapack );
+#endif
+
+   nativeGeqrf( A, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary function for the QR decomposition.
+// \ingroup dense_matrix
+//
+// \param A The QR decomposed matrix.
+// \param tau Array for the scalar factors of the elementary reflectors.
+// \param lapack \a true in case the decomposition has been performed by LAPACK, \a false if not.
+// \return void
+//
+// This function is an auxiliary helper for the dense matrix QR decomposition. It performs the
+// reconstruction of the \c Q matrix by the same kernels that have performed the decomposition.
+*/
+template< typename MT1 >  // Type of matrix A
+inline void qr_reconstruct( MT1& A, const ElementType_t<MT1>* tau, bool lapack )
+{
+#if BLAZE_LAPACK_MODE
+   if( lapack ) {
+      qr_backend( A, tau );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( lapack );
+#endif
+
+   nativeUngqr( A, tau );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief QR decomposition of the given dense matrix.
 // \ingroup dense_matrix
@@ -167,8 +233,11 @@ inline auto qr_backend( MT1& A, const ElementType_t<MT1>* tau )
 // \c complex<double> element type. The attempt to call the function with matrices of any other
 // element type results in a compile time error!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a call to this function will result in a linker error.
+// \note Matrices with less than DMATDECOMPOSITION_THRESHOLD elements are decomposed by the
+// native, blocked Blaze kernels. Larger matrices are decomposed by LAPACK, which requires a
+// fitting LAPACK library to be linked to the executable. In case the LAPACK mode is disabled
+// (see the BLAZE_LAPACK_MODE switch), all matrices are decomposed by the native kernels and
+// LAPACK is not required.
 */
 template< typename MT1  // Type of matrix A
         , bool SO1      // Storage order of matrix A
@@ -208,12 +277,14 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    const std::unique_ptr<ET1[]> tau( new ET1[mindim] );
    decltype(auto) r( derestrict( ~R ) );
 
+   const bool lapack( BLAZE_LAPACK_MODE && m*n >= DMATDECOMPOSITION_THRESHOLD );
+
    if( m < n )
    {
       r = A;
-      geqrf( r, tau.get() );
+      qr_decompose( r, tau.get(), lapack );
       (~Q) = submatrix( r, 0UL, 0UL, m, m );
-      qr_backend( ~Q, tau.get() );
+      qr_reconstruct( ~Q, tau.get(), lapack );
 
       for( size_t i=1UL; i<m; ++i ) {
          for( size_t j=0UL; j<i; ++j ) {
@@ -224,7 +295,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
    else
    {
       (~Q) = A;
-      geqrf( ~Q, tau.get() );
+      qr_decompose( ~Q, tau.get(), lapack );
 
       resize( ~R, n, n, false );
       reset( r );
@@ -235,7 +306,7 @@ void qr( const DenseMatrix<MT1,SO1>& A, DenseMatrix<MT2,SO2>& Q, DenseMatrix<MT3
          }
       }
 
-      qr_backend( ~Q, tau.get() );
+      qr_reconstruct( ~Q, tau.get(), lapack );
    }
 }
 //*************************************************************************************************
@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/Diagonal.h>
 #include <blaze/math/constraints/Symmetric.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/Transposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/SparseMatrix.h>
@@ -71,6 +72,7 @@
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
 #include <blaze/math/typetraits/HighType.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsColumnMajorMatrix.h>
@@ -124,6 +126,7 @@
 #include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/IsVectorizable.h>
 #include <blaze/util/typetraits/RemoveConst.h>
+#include <blaze/util/typetraits/RemoveCV.h>
 #include <blaze/util/Unused.h>
 
 
@@ -409,6 +412,19 @@ class StaticMatrix
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedTransposeAssign_v =
+      ( useOptimizedKernels &&
+        HasSIMDTranspose_v<Type> &&
+        HasConstDataAccess_v<MT> && IsContiguous_v<MT> &&
+        IsSame_v< Type, RemoveCV_t< ElementType_t<MT> > > &&
+        IsColumnMajorMatrix_v<MT> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -476,11 +492,15 @@ class StaticMatrix
    BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
 
    template< typename MT, bool SO2 >
-   inline auto assign( const DenseMatrix<MT,SO2>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
+   inline auto assign( const DenseMatrix<MT,SO2>& rhs )
+      -> DisableIf_t< VectorizedAssign_v<MT> || VectorizedTransposeAssign_v<MT> >;
 
    template< typename MT, bool SO2 >
    inline auto assign( const DenseMatrix<MT,SO2>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
+   template< typename MT, bool SO2 >
+   inline auto assign( const DenseMatrix<MT,SO2>& rhs ) -> EnableIf_t< VectorizedTransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,SO>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,!SO>& rhs );
 
@@ -1800,13 +1820,9 @@ template< typename Type  // Data type of the matrix
         , bool SO >      // Storage order
 inline StaticMatrix<Type,M,N,SO>& StaticMatrix<Type,M,N,SO>::transpose()
 {
-   using std::swap;
-
    BLAZE_STATIC_ASSERT( M == N );
 
-   for( size_t i=1UL; i<M; ++i )
-      for( size_t j=0UL; j<i; ++j )
-         swap( v_[i*NN+j], v_[j*NN+i] );
+   transposeSquare( v_.data(), M, NN );
 
    return *this;
 }
@@ -2521,7 +2537,7 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO2 >     // Storage order of the right-hand side dense matrix
 inline auto StaticMatrix<Type,M,N,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
-   -> DisableIf_t< VectorizedAssign_v<MT> >
+   -> DisableIf_t< VectorizedAssign_v<MT> || VectorizedTransposeAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
 
@@ -2578,6 +2594,33 @@ inline auto StaticMatrix<Type,M,N,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N       // Number of columns
+        , bool SO >      // Storage order
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO2 >     // Storage order of the right-hand side dense matrix
+inline auto StaticMatrix<Type,M,N,SO>::assign( const DenseMatrix<MT,SO2>& rhs )
+   -> EnableIf_t< VectorizedTransposeAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   transposeBlock( (~rhs).data(), (~rhs).spacing(), v_.data(), NN, N, M );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Default implementation of the assignment of a row-major sparse matrix.
 //
@@ -3294,6 +3337,17 @@ class StaticMatrix<Type,M,N,true>
         IsColumnMajorMatrix_v<MT> );
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT >
+   static constexpr bool VectorizedTransposeAssign_v =
+      ( useOptimizedKernels &&
+        HasSIMDTranspose_v<Type> &&
+        HasConstDataAccess_v<MT> && IsContiguous_v<MT> &&
+        IsSame_v< Type, RemoveCV_t< ElementType_t<MT> > > &&
+        IsRowMajorMatrix_v<MT> );
+   //**********************************************************************************************
+
    //**********************************************************************************************
    //! Helper variable template for the explicit application of the SFINAE principle.
    template< typename MT >
@@ -3355,11 +3409,15 @@ class StaticMatrix<Type,M,N,true>
    BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
 
    template< typename MT, bool SO >
-   inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT> >;
+   inline auto assign( const DenseMatrix<MT,SO>& rhs )
+      -> DisableIf_t< VectorizedAssign_v<MT> || VectorizedTransposeAssign_v<MT> >;
 
    template< typename MT, bool SO >
    inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT> >;
 
+   template< typename MT, bool SO >
+   inline auto assign( const DenseMatrix<MT,SO>& rhs ) -> EnableIf_t< VectorizedTransposeAssign_v<MT> >;
+
    template< typename MT > inline void assign( const SparseMatrix<MT,true>&  rhs );
    template< typename MT > inline void assign( const SparseMatrix<MT,false>& rhs );
 
@@ -4691,13 +4749,9 @@ template< typename Type  // Data type of the matrix
         , size_t N >     // Number of columns
 inline StaticMatrix<Type,M,N,true>& StaticMatrix<Type,M,N,true>::transpose()
 {
-   using std::swap;
-
    BLAZE_STATIC_ASSERT( M == N );
 
-   for( size_t j=1UL; j<N; ++j )
-      for( size_t i=0UL; i<j; ++i )
-         swap( v_[i+j*MM], v_[j+i*MM] );
+   transposeSquare( v_.data(), N, MM );
 
    return *this;
 }
@@ -5424,7 +5478,7 @@ template< typename Type  // Data type of the matrix
 template< typename MT    // Type of the right-hand side dense matrix
         , bool SO >      // Storage order of the right-hand side dense matrix
 inline auto StaticMatrix<Type,M,N,true>::assign( const DenseMatrix<MT,SO>& rhs )
-   -> DisableIf_t< VectorizedAssign_v<MT> >
+   -> DisableIf_t< VectorizedAssign_v<MT> || VectorizedTransposeAssign_v<MT> >
 {
    BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
 
@@ -5483,6 +5537,34 @@ inline auto StaticMatrix<Type,M,N,true>::assign( const DenseMatrix<MT,SO>& rhs )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t M       // Number of rows
+        , size_t N >     // Number of columns
+template< typename MT    // Type of the right-hand side dense matrix
+        , bool SO >      // Storage order of the right-hand side dense matrix
+inline auto StaticMatrix<Type,M,N,true>::assign( const DenseMatrix<MT,SO>& rhs )
+   -> EnableIf_t< VectorizedTransposeAssign_v<MT> >
+{
+   BLAZE_INTERNAL_ASSERT( (~rhs).rows() == M && (~rhs).columns() == N, "Invalid matrix size" );
+
+   transposeBlock( (~rhs).data(), (~rhs).spacing(), v_.data(), MM, M, N );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
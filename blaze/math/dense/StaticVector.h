@@ -47,6 +47,7 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/TransposeFlag.h>
 #include <blaze/math/dense/DenseIterator.h>
+#include <blaze/math/dense/MaskedTail.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/SparseVector.h>
@@ -2060,6 +2061,7 @@ inline auto StaticVector<Type,N,TF>::assign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == N, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2069,7 +2071,11 @@ inline auto StaticVector<Type,N,TF>::assign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, (~rhs).load(i) );
    }
-   for( ; remainder && i<N; ++i ) {
+   if( masked && i<N ) {
+      const size_t n( N - i );
+      storem( v_+i, n, loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<N; ++i ) {
       v_[i] = (~rhs)[i];
    }
 }
@@ -2150,6 +2156,7 @@ inline auto StaticVector<Type,N,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == N, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2159,7 +2166,11 @@ inline auto StaticVector<Type,N,TF>::addAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) + (~rhs).load(i) );
    }
-   for( ; remainder && i<N; ++i ) {
+   if( masked && i<N ) {
+      const size_t n( N - i );
+      storem( v_+i, n, loadm( v_+i, n ) + loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<N; ++i ) {
       v_[i] += (~rhs)[i];
    }
 }
@@ -2240,6 +2251,7 @@ inline auto StaticVector<Type,N,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == N, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2249,7 +2261,11 @@ inline auto StaticVector<Type,N,TF>::subAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) - (~rhs).load(i) );
    }
-   for( ; remainder && i<N; ++i ) {
+   if( masked && i<N ) {
+      const size_t n( N - i );
+      storem( v_+i, n, loadm( v_+i, n ) - loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<N; ++i ) {
       v_[i] -= (~rhs)[i];
    }
 }
@@ -2330,6 +2346,7 @@ inline auto StaticVector<Type,N,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    BLAZE_INTERNAL_ASSERT( (~rhs).size() == N, "Invalid vector sizes" );
 
    constexpr bool remainder( !usePadding || !IsPadded_v<VT> );
+   constexpr bool masked( remainder && HasMaskedTail_v<VT> );
 
    const size_t ipos( ( remainder )?( N & size_t(-SIMDSIZE) ):( N ) );
    BLAZE_INTERNAL_ASSERT( !remainder || ( N - ( N % (SIMDSIZE) ) ) == ipos, "Invalid end calculation" );
@@ -2339,7 +2356,11 @@ inline auto StaticVector<Type,N,TF>::multAssign( const DenseVector<VT,TF>& rhs )
    for( ; i<ipos; i+=SIMDSIZE ) {
       store( i, load(i) * (~rhs).load(i) );
    }
-   for( ; remainder && i<N; ++i ) {
+   if( masked && i<N ) {
+      const size_t n( N - i );
+      storem( v_+i, n, loadm( v_+i, n ) * loadTail( ~rhs, i, n ) );
+   }
+   for( ; !masked && remainder && i<N; ++i ) {
       v_[i] *= (~rhs)[i];
    }
 }
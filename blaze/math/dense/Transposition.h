@@ -0,0 +1,652 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/dense/Transposition.h
+//  \brief Header file for the SIMD transposition kernels of dense matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+#define _BLAZE_MATH_DENSE_TRANSPOSITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <blaze/math/typetraits/HasSIMDTranspose.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SIMD TRANSPOSITION TILES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief The edge length of the square tiles transposed by a single SIMD transposition kernel.
+// \ingroup math
+//
+// Depending on the size of the data type \a T and the available instruction set, a single
+// transposition kernel transposes a 4x4, 8x8 or 16x16 tile of 4-byte elements or a 2x2, 4x4
+// or 8x8 tile of 8-byte elements. The value is only meaningful in case HasSIMDTranspose_v<T>
+// evaluates to \a true.
+*/
+template< typename T >  // Data type of the elements
+constexpr size_t TransposeTileSize_v =
+   ( sizeof(T) == 4UL )
+   ?( BLAZE_AVX512F_MODE ? 16UL : ( BLAZE_AVX_MODE ? 8UL : 4UL ) )
+   :( BLAZE_AVX512F_MODE ?  8UL : ( BLAZE_AVX_MODE ? 4UL : 2UL ) );
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single square tile of single precision floating point values.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source tile.
+// \param dst Pointer to the first element of the destination tile.
+// \param ds The spacing between two rows of the destination tile.
+// \return void
+//
+// This function loads the rows of a \a TransposeTileSize_v<float> x \a TransposeTileSize_v<float>
+// tile into SIMD registers, transposes the tile in-register by means of unpack and shuffle
+// operations and stores the resulting columns as rows of the destination tile. The source and
+// the destination tile must not overlap.
+*/
+BLAZE_ALWAYS_INLINE void transposeTile( const float* src, size_t ss, float* dst, size_t ds ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   __m512 r[16], t[16], s[16];
+
+   for( size_t k=0UL; k<16UL; ++k ) {
+      r[k] = _mm512_loadu_ps( src+k*ss );
+   }
+
+   for( size_t k=0UL; k<16UL; k+=2UL ) {
+      t[k    ] = _mm512_unpacklo_ps( r[k], r[k+1UL] );
+      t[k+1UL] = _mm512_unpackhi_ps( r[k], r[k+1UL] );
+   }
+
+   for( size_t k=0UL; k<16UL; k+=4UL ) {
+      s[k    ] = _mm512_shuffle_ps( t[k    ], t[k+2UL], 0x44 );
+      s[k+1UL] = _mm512_shuffle_ps( t[k    ], t[k+2UL], 0xEE );
+      s[k+2UL] = _mm512_shuffle_ps( t[k+1UL], t[k+3UL], 0x44 );
+      s[k+3UL] = _mm512_shuffle_ps( t[k+1UL], t[k+3UL], 0xEE );
+   }
+
+   for( size_t k=0UL; k<4UL; ++k ) {
+      const __m512 v0( _mm512_shuffle_f32x4( s[k    ], s[k+ 4UL], 0x44 ) );
+      const __m512 v1( _mm512_shuffle_f32x4( s[k    ], s[k+ 4UL], 0xEE ) );
+      const __m512 v2( _mm512_shuffle_f32x4( s[k+8UL], s[k+12UL], 0x44 ) );
+      const __m512 v3( _mm512_shuffle_f32x4( s[k+8UL], s[k+12UL], 0xEE ) );
+      _mm512_storeu_ps( dst+(k     )*ds, _mm512_shuffle_f32x4( v0, v2, 0x88 ) );
+      _mm512_storeu_ps( dst+(k+ 4UL)*ds, _mm512_shuffle_f32x4( v0, v2, 0xDD ) );
+      _mm512_storeu_ps( dst+(k+ 8UL)*ds, _mm512_shuffle_f32x4( v1, v3, 0x88 ) );
+      _mm512_storeu_ps( dst+(k+12UL)*ds, _mm512_shuffle_f32x4( v1, v3, 0xDD ) );
+   }
+#elif BLAZE_AVX_MODE
+   __m256 r[8], t[8], s[8];
+
+   for( size_t k=0UL; k<8UL; ++k ) {
+      r[k] = _mm256_loadu_ps( src+k*ss );
+   }
+
+   for( size_t k=0UL; k<8UL; k+=2UL ) {
+      t[k    ] = _mm256_unpacklo_ps( r[k], r[k+1UL] );
+      t[k+1UL] = _mm256_unpackhi_ps( r[k], r[k+1UL] );
+   }
+
+   for( size_t k=0UL; k<8UL; k+=4UL ) {
+      s[k    ] = _mm256_shuffle_ps( t[k    ], t[k+2UL], 0x44 );
+      s[k+1UL] = _mm256_shuffle_ps( t[k    ], t[k+2UL], 0xEE );
+      s[k+2UL] = _mm256_shuffle_ps( t[k+1UL], t[k+3UL], 0x44 );
+      s[k+3UL] = _mm256_shuffle_ps( t[k+1UL], t[k+3UL], 0xEE );
+   }
+
+   for( size_t k=0UL; k<4UL; ++k ) {
+      _mm256_storeu_ps( dst+(k    )*ds, _mm256_permute2f128_ps( s[k], s[k+4UL], 0x20 ) );
+      _mm256_storeu_ps( dst+(k+4UL)*ds, _mm256_permute2f128_ps( s[k], s[k+4UL], 0x31 ) );
+   }
+#elif BLAZE_SSE_MODE
+   __m128 r0( _mm_loadu_ps( src      ) );
+   __m128 r1( _mm_loadu_ps( src+  ss ) );
+   __m128 r2( _mm_loadu_ps( src+2*ss ) );
+   __m128 r3( _mm_loadu_ps( src+3*ss ) );
+
+   _MM_TRANSPOSE4_PS( r0, r1, r2, r3 );
+
+   _mm_storeu_ps( dst     , r0 );
+   _mm_storeu_ps( dst+  ds, r1 );
+   _mm_storeu_ps( dst+2*ds, r2 );
+   _mm_storeu_ps( dst+3*ds, r3 );
+#else
+   for( size_t k=0UL; k<TransposeTileSize_v<float>; ++k ) {
+      for( size_t l=0UL; l<TransposeTileSize_v<float>; ++l ) {
+         dst[l*ds+k] = src[k*ss+l];
+      }
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single square tile of double precision floating point values.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source tile.
+// \param dst Pointer to the first element of the destination tile.
+// \param ds The spacing between two rows of the destination tile.
+// \return void
+//
+// This function loads the rows of a \a TransposeTileSize_v<double> x \a TransposeTileSize_v<double>
+// tile into SIMD registers, transposes the tile in-register by means of unpack and shuffle
+// operations and stores the resulting columns as rows of the destination tile. The source and
+// the destination tile must not overlap.
+*/
+BLAZE_ALWAYS_INLINE void transposeTile( const double* src, size_t ss, double* dst, size_t ds ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   __m512d r[8], t[8], u[8];
+
+   for( size_t k=0UL; k<8UL; ++k ) {
+      r[k] = _mm512_loadu_pd( src+k*ss );
+   }
+
+   for( size_t k=0UL; k<8UL; k+=2UL ) {
+      t[k    ] = _mm512_unpacklo_pd( r[k], r[k+1UL] );
+      t[k+1UL] = _mm512_unpackhi_pd( r[k], r[k+1UL] );
+   }
+
+   for( size_t k=0UL; k<8UL; k+=4UL ) {
+      u[k    ] = _mm512_shuffle_f64x2( t[k    ], t[k+2UL], 0x88 );
+      u[k+1UL] = _mm512_shuffle_f64x2( t[k    ], t[k+2UL], 0xDD );
+      u[k+2UL] = _mm512_shuffle_f64x2( t[k+1UL], t[k+3UL], 0x88 );
+      u[k+3UL] = _mm512_shuffle_f64x2( t[k+1UL], t[k+3UL], 0xDD );
+   }
+
+   _mm512_storeu_pd( dst     , _mm512_shuffle_f64x2( u[0], u[4], 0x88 ) );
+   _mm512_storeu_pd( dst+  ds, _mm512_shuffle_f64x2( u[2], u[6], 0x88 ) );
+   _mm512_storeu_pd( dst+2*ds, _mm512_shuffle_f64x2( u[1], u[5], 0x88 ) );
+   _mm512_storeu_pd( dst+3*ds, _mm512_shuffle_f64x2( u[3], u[7], 0x88 ) );
+   _mm512_storeu_pd( dst+4*ds, _mm512_shuffle_f64x2( u[0], u[4], 0xDD ) );
+   _mm512_storeu_pd( dst+5*ds, _mm512_shuffle_f64x2( u[2], u[6], 0xDD ) );
+   _mm512_storeu_pd( dst+6*ds, _mm512_shuffle_f64x2( u[1], u[5], 0xDD ) );
+   _mm512_storeu_pd( dst+7*ds, _mm512_shuffle_f64x2( u[3], u[7], 0xDD ) );
+#elif BLAZE_AVX_MODE
+   const __m256d r0( _mm256_loadu_pd( src      ) );
+   const __m256d r1( _mm256_loadu_pd( src+  ss ) );
+   const __m256d r2( _mm256_loadu_pd( src+2*ss ) );
+   const __m256d r3( _mm256_loadu_pd( src+3*ss ) );
+
+   const __m256d t0( _mm256_unpacklo_pd( r0, r1 ) );
+   const __m256d t1( _mm256_unpackhi_pd( r0, r1 ) );
+   const __m256d t2( _mm256_unpacklo_pd( r2, r3 ) );
+   const __m256d t3( _mm256_unpackhi_pd( r2, r3 ) );
+
+   _mm256_storeu_pd( dst     , _mm256_permute2f128_pd( t0, t2, 0x20 ) );
+   _mm256_storeu_pd( dst+  ds, _mm256_permute2f128_pd( t1, t3, 0x20 ) );
+   _mm256_storeu_pd( dst+2*ds, _mm256_permute2f128_pd( t0, t2, 0x31 ) );
+   _mm256_storeu_pd( dst+3*ds, _mm256_permute2f128_pd( t1, t3, 0x31 ) );
+#elif BLAZE_SSE2_MODE
+   const __m128d r0( _mm_loadu_pd( src    ) );
+   const __m128d r1( _mm_loadu_pd( src+ss ) );
+
+   _mm_storeu_pd( dst   , _mm_unpacklo_pd( r0, r1 ) );
+   _mm_storeu_pd( dst+ds, _mm_unpackhi_pd( r0, r1 ) );
+#else
+   for( size_t k=0UL; k<TransposeTileSize_v<double>; ++k ) {
+      for( size_t l=0UL; l<TransposeTileSize_v<double>; ++l ) {
+         dst[l*ds+k] = src[k*ss+l];
+      }
+   }
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single square tile of 4-byte integral values.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source tile.
+// \param dst Pointer to the first element of the destination tile.
+// \param ds The spacing between two rows of the destination tile.
+// \return void
+//
+// Since a transposition only moves the elements, the tile is transposed by the kernel for
+// single precision floating point values.
+*/
+template< typename T >  // Type of the integral elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds ) noexcept
+   -> EnableIf_t< IsIntegral_v<T> && HasSize_v<T,4UL> >
+{
+   transposeTile( reinterpret_cast<const float*>( src ), ss, reinterpret_cast<float*>( dst ), ds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transposition of a single square tile of 8-byte integral values.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source tile.
+// \param ss The spacing between two rows of the source tile.
+// \param dst Pointer to the first element of the destination tile.
+// \param ds The spacing between two rows of the destination tile.
+// \return void
+//
+// Since a transposition only moves the elements, the tile is transposed by the kernel for
+// double precision floating point values.
+*/
+template< typename T >  // Type of the integral elements
+BLAZE_ALWAYS_INLINE auto transposeTile( const T* src, size_t ss, T* dst, size_t ds ) noexcept
+   -> EnableIf_t< IsIntegral_v<T> && HasSize_v<T,8UL> >
+{
+   transposeTile( reinterpret_cast<const double*>( src ), ss, reinterpret_cast<double*>( dst ), ds );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OUT-OF-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Cache-oblivious SIMD transposition of a dense block of elements.
+// \ingroup math
+//
+// \param src Pointer to the first element of the source block.
+// \param ss The spacing between two rows of the source block.
+// \param dst Pointer to the first element of the destination block.
+// \param ds The spacing between two rows of the destination block.
+// \param m The number of rows of the source block.
+// \param n The number of columns of the source block.
+// \return void
+//
+// This function stores the transpose of the \f$ m \times n \f$ source block in the
+// \f$ n \times m \f$ destination block, i.e. it performs \f$ dst[j*ds+i] = src[i*ss+j] \f$.
+// The block is recursively split along its larger dimension until both dimensions fit into
+// TRANSPOSE_BLOCK_SIZE, independent of the actual cache sizes. The resulting sub-blocks are
+// transposed by SIMD transposition tiles (see the transposeTile() functions); only the
+// trailing rows and columns that don't fill an entire tile are handled element-wise. The
+// source and the destination block must not overlap.
+*/
+template< typename T >  // Data type of the elements
+auto transposeBlock( const T* src, size_t ss, T* dst, size_t ds, size_t m, size_t n ) noexcept
+   -> EnableIf_t< HasSIMDTranspose_v<T> >
+{
+   constexpr size_t TILE( TransposeTileSize_v<T> );
+
+   BLAZE_STATIC_ASSERT( TILE <= TRANSPOSE_BLOCK_SIZE );
+
+   if( m > TRANSPOSE_BLOCK_SIZE && m >= n ) {
+      const size_t mh( ( ( m/2UL ) + TILE - 1UL ) & size_t(-TILE) );
+      transposeBlock( src, ss, dst, ds, mh, n );
+      transposeBlock( src+mh*ss, ss, dst+mh, ds, m-mh, n );
+      return;
+   }
+
+   if( n > TRANSPOSE_BLOCK_SIZE ) {
+      const size_t nh( ( ( n/2UL ) + TILE - 1UL ) & size_t(-TILE) );
+      transposeBlock( src, ss, dst, ds, m, nh );
+      transposeBlock( src+nh, ss, dst+nh*ds, ds, m, n-nh );
+      return;
+   }
+
+   const size_t ipos( m & size_t(-TILE) );
+   const size_t jpos( n & size_t(-TILE) );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=TILE )
+   {
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=TILE ) {
+         transposeTile( src+i*ss+j, ss, dst+j*ds+i, ds );
+      }
+      for( ; j<n; ++j ) {
+         for( size_t k=i; k<i+TILE; ++k ) {
+            dst[j*ds+k] = src[k*ss+j];
+         }
+      }
+   }
+
+   for( ; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         dst[j*ds+i] = src[i*ss+j];
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  IN-PLACE TRANSPOSITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default in-place transposition of a square dense block of elements.
+// \ingroup math
+//
+// \param v Pointer to the first element of the block.
+// \param n The number of rows and columns of the block.
+// \param s The spacing between two rows of the block.
+// \return void
+//
+// This function transposes the given \f$ n \times n \f$ block in-place by swapping the
+// elements of the strictly lower and the strictly upper part in blocks of BLOCK_SIZE.
+*/
+template< typename T >  // Data type of the elements
+auto transposeSquare( T* v, size_t n, size_t s )
+   -> DisableIf_t< HasSIMDTranspose_v<T> >
+{
+   using std::swap;
+
+   constexpr size_t block( BLOCK_SIZE );
+
+   for( size_t ii=0UL; ii<n; ii+=block ) {
+      const size_t iend( min( ii+block, n ) );
+      for( size_t jj=0UL; jj<=ii; jj+=block ) {
+         for( size_t i=ii; i<iend; ++i ) {
+            const size_t jend( min( jj+block, n, i ) );
+            for( size_t j=jj; j<jend; ++j ) {
+               swap( v[i*s+j], v[j*s+i] );
+            }
+         }
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD in-place transposition of a square dense block of elements.
+// \ingroup math
+//
+// \param v Pointer to the first element of the block.
+// \param n The number of rows and columns of the block.
+// \param s The spacing between two rows of the block.
+// \return void
+//
+// This function transposes the given \f$ n \times n \f$ block in-place. Each pair of
+// mirrored SIMD transposition tiles is exchanged via a single tile-sized buffer and each
+// diagonal tile is transposed via the same buffer. The tiles are traversed in blocks of
+// TRANSPOSE_BLOCK_SIZE to keep both tiles of a pair in cache. The trailing rows and columns
+// that don't fill an entire tile are swapped element-wise.
+*/
+template< typename T >  // Data type of the elements
+auto transposeSquare( T* v, size_t n, size_t s )
+   -> EnableIf_t< HasSIMDTranspose_v<T> >
+{
+   using std::swap;
+
+   constexpr size_t TILE ( TransposeTileSize_v<T> );
+   constexpr size_t block( TRANSPOSE_BLOCK_SIZE );
+
+   T tmp[TILE*TILE];
+
+   const size_t npos( n & size_t(-TILE) );
+
+   for( size_t ii=0UL; ii<npos; ii+=block ) {
+      const size_t iend( min( ii+block, npos ) );
+      for( size_t jj=0UL; jj<=ii; jj+=block ) {
+         const size_t jend( min( jj+block, npos ) );
+         for( size_t i=ii; i<iend; i+=TILE ) {
+            for( size_t j=jj; j<jend && j<i; j+=TILE ) {
+               transposeTile( v+i*s+j, s, tmp, TILE );
+               transposeTile( v+j*s+i, s, v+i*s+j, s );
+               for( size_t k=0UL; k<TILE; ++k ) {
+                  std::copy( tmp+k*TILE, tmp+(k+1UL)*TILE, v+(j+k)*s+i );
+               }
+            }
+            if( jj == ii ) {
+               transposeTile( v+i*s+i, s, tmp, TILE );
+               for( size_t k=0UL; k<TILE; ++k ) {
+                  std::copy( tmp+k*TILE, tmp+(k+1UL)*TILE, v+(i+k)*s+i );
+               }
+            }
+         }
+      }
+   }
+
+   for( size_t i=npos; i<n; ++i ) {
+      for( size_t j=0UL; j<i; ++j ) {
+         swap( v[i*s+j], v[j*s+i] );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief In-place transposition of a rectangular dense block of elements.
+// \ingroup math
+//
+// \param v Pointer to the first element of the block.
+// \param m The number of rows of the block.
+// \param n The number of columns of the block.
+// \param s The spacing between two rows of the given \f$ m \times n \f$ block.
+// \param ns The spacing between two rows of the resulting \f$ n \times m \f$ block.
+// \return void
+//
+// This function transposes the given \f$ m \times n \f$ block in-place, i.e. without an
+// \f$ m \times n \f$ temporary. The memory starting at \a v must be large enough to hold both
+// \f$ m \cdot s \f$ and \f$ n \cdot ns \f$ elements. Between the rows of the resulting block,
+// the \f$ ns - m \f$ padding elements are reset to their default value.
+//
+// After compacting the rows, the transposition permutation is decomposed into a rotation of
+// the columns, an independent shuffle of every row and an independent shuffle of every column
+// of the compact \f$ m \times n \f$ array (see B. Catanzaro, A. Keller, M. Garland: "A
+// Decomposition for In-place Matrix Transposition", PPoPP 2014). Each step is performed via
+// a single buffer of \f$ \max(16m,n) \f$ elements. The rotation of the columns moves
+// contiguous row segments, the row shuffles operate on contiguous rows, and the column shuffles
+// are performed for 16 adjacent columns at once.
+*/
+template< typename T >  // Data type of the elements
+void transposeRectangular( T* v, size_t m, size_t n, size_t s, size_t ns )
+{
+   BLAZE_INTERNAL_ASSERT( s  >= n, "Invalid row spacing" );
+   BLAZE_INTERNAL_ASSERT( ns >= m, "Invalid row spacing" );
+
+   if( m == 0UL || n == 0UL )
+      return;
+
+   const auto gcd = []( size_t a, size_t b ) {
+      while( b != 0UL ) {
+         const size_t r( a % b );
+         a = b;
+         b = r;
+      }
+      return a;
+   };
+
+   if( s != n ) {
+      for( size_t i=1UL; i<m; ++i ) {
+         transfer( v+i*s, v+i*s+n, v+i*n );
+      }
+   }
+
+   const size_t c( gcd( m, n ) );
+   const size_t b( n / c );
+
+   constexpr size_t block( 16UL );
+
+   const std::unique_ptr<T[]> tmp( new T[max( m*block, n )] );
+
+   // Rotating the columns with index j downwards by j/b rows, which rotates each group of b
+   // adjacent columns as a whole
+   for( size_t q=1UL; q<c; ++q )
+   {
+      const size_t cycles( gcd( m, q ) );
+
+      for( size_t start=0UL; start<cycles; ++start )
+      {
+         T* const first( v+start*n+q*b );
+         transfer( first, first+b, tmp.get() );
+
+         size_t cur( start );
+
+         while( true ) {
+            const size_t prev( ( cur + m - q ) % m );
+            if( prev == start ) break;
+            transfer( v+prev*n+q*b, v+prev*n+(q+1UL)*b, v+cur*n+q*b );
+            cur = prev;
+         }
+
+         transfer( tmp.get(), tmp.get()+b, v+cur*n+q*b );
+      }
+   }
+
+   // Shuffling each row such that every element ends up in its final column
+   const size_t mn( m % n );
+
+   for( size_t r=0UL; r<m; ++r )
+   {
+      T* const row( v+r*n );
+      size_t jm( 0UL );
+
+      for( size_t q=0UL; q<c; ++q )
+      {
+         const size_t i( ( ( r + m - q % m ) % m ) % n );
+
+         for( size_t j=q*b; j<(q+1UL)*b; ++j ) {
+            const size_t k( ( jm + i < n )?( jm + i ):( jm + i - n ) );
+            tmp[k] = std::move( row[j] );
+            jm = ( jm + mn < n )?( jm + mn ):( jm + mn - n );
+         }
+      }
+
+      transfer( tmp.get(), tmp.get()+n, row );
+   }
+
+   // Shuffling each column such that every element ends up in its final row. The final row r
+   // of column k receives the element (i,j) with i*n+j == r*n+k, which has been moved to row
+   // (i+j/b)%m in the first step. The columns are processed in blocks to reduce the number of
+   // strided sweeps over the array and all indices are updated incrementally to avoid divisions.
+   const size_t nm( n % m );
+   const size_t nd( n / m );
+   const size_t ndq( nd / b );
+   const size_t ndr( nd % b );
+
+   for( size_t kk=0UL; kk<n; kk+=block )
+   {
+      const size_t kn( min( block, n-kk ) );
+
+      size_t i[block], jq[block], jr[block];
+
+      for( size_t k=0UL; k<kn; ++k ) {
+         i [k] = ( kk+k ) % m;
+         jq[k] = ( ( kk+k ) / m ) / b;
+         jr[k] = ( ( kk+k ) / m ) % b;
+      }
+
+      for( size_t r=0UL; r<m; ++r )
+      {
+         for( size_t k=0UL; k<kn; ++k )
+         {
+            const size_t src( ( i[k] + jq[k] < m )?( i[k] + jq[k] ):( i[k] + jq[k] - m ) );
+            tmp[r*kn+k] = std::move( v[src*n+kk+k] );
+
+            i [k] += nm;
+            jr[k] += ndr;
+            jq[k] += ndq;
+            if( i [k] >= m ) { i [k] -= m; ++jr[k]; }
+            if( jr[k] >= b ) { jr[k] -= b; ++jq[k]; }
+         }
+      }
+
+      for( size_t r=0UL; r<m; ++r ) {
+         transfer( tmp.get()+r*kn, tmp.get()+(r+1UL)*kn, v+r*n+kk );
+      }
+   }
+
+   if( ns != m ) {
+      for( size_t j=n-1UL; j>0UL; --j ) {
+         std::move_backward( v+j*m, v+(j+1UL)*m, v+j*ns+m );
+      }
+      for( size_t j=0UL; j<n; ++j ) {
+         std::fill( v+j*ns+m, v+(j+1UL)*ns, T() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -83,6 +83,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -111,6 +112,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
@@ -544,10 +546,28 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectSmallAssignKernel" )
+                               :( "DMatDMatMultExpr::selectDefaultAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + C.rows()*C.columns() )
+                             , 1UL );
          selectSmallAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                                  ?( "DMatDMatMultExpr::selectLargeAssignKernel" )
+                                  :( "DMatDMatMultExpr::selectDefaultAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + C.rows()*C.columns() )
+                             , 1UL );
          selectBlasAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1812,10 +1832,28 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectSmallAddAssignKernel" )
+                               :( "DMatDMatMultExpr::selectDefaultAddAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectSmallAddAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                                  ?( "DMatDMatMultExpr::selectLargeAddAssignKernel" )
+                                  :( "DMatDMatMultExpr::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectBlasAddAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -3028,10 +3066,28 @@ class DMatDMatMultExpr
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectSmallSubAssignKernel" )
+                               :( "DMatDMatMultExpr::selectDefaultSubAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectSmallSubAssignKernel( C, A, B );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5> )
+                               ?( "DMatDMatMultExpr::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5> )
+                                  ?( "DMatDMatMultExpr::selectLargeSubAssignKernel" )
+                                  :( "DMatDMatMultExpr::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectBlasSubAssignKernel( C, A, B );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -4971,10 +5027,28 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectSmallAssignKernel" )
+                               :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + C.rows()*C.columns() )
+                             , 1UL );
          selectSmallAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                                  ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectLargeAssignKernel" )
+                                  :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + C.rows()*C.columns() )
+                             , 1UL );
          selectBlasAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -6262,10 +6336,28 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectSmallAddAssignKernel" )
+                               :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultAddAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectSmallAddAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                                  ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectLargeAddAssignKernel" )
+                                  :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectBlasAddAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -7375,10 +7467,28 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
    {
       if( ( IsDiagonal_v<MT5> ) ||
           ( !BLAZE_DEBUG_MODE && B.columns() <= SIMDSIZE*10UL ) ||
-          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) )
+          ( C.rows() * C.columns() < DMATDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectSmallSubAssignKernel" )
+                               :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultSubAssignKernel" )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectSmallSubAssignKernel( C, A, B, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<MT3,MT4,MT5,ST2> )
+                               ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<MT3,MT4,MT5,ST2> )
+                                  ?( "DMatScalarMultExpr<DMatDMatMultExpr>::selectLargeSubAssignKernel" )
+                                  :( "DMatScalarMultExpr<DMatDMatMultExpr>::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), B.columns(), A.columns(), 2UL*A.rows()*B.columns()*A.columns()
+                             , sizeof( ElementType_t<MT3> )*( A.rows()*A.columns() +
+                                                              B.rows()*B.columns() + 2UL*C.rows()*C.columns() )
+                             , 1UL );
          selectBlasSubAssignKernel( C, A, B, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -8840,6 +8950,64 @@ class DMatScalarMultExpr< DMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of two row-major dense matrices
+//        (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side row-major dense matrix for the multiplication.
+// \param rhs The right-hand side row-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the default treatment of the multiplication of a row-major dense
+// matrix and a row-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , DisableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const DMatDMatMultExpr<MT1,MT2,false,false,false,false>
+   dmatdmatmult( const DenseMatrix<MT1,false>& lhs, const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return DMatDMatMultExpr<MT1,MT2,false,false,false,false>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a row-major dense matrix with packed
+//        storage and a row-major dense matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side row-major packed dense matrix for the multiplication.
+// \param rhs The right-hand side row-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// row-major dense matrix with packed storage (see PackedMatrix) and a row-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , EnableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const PMatDMatMultExpr<MT1,MT2,false>
+   dmatdmatmult( const DenseMatrix<MT1,false>& lhs, const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return PMatDMatMultExpr<MT1,MT2,false>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of two row-major dense matrices
 //        (\f$ A=B*C \f$).
@@ -8878,8 +9046,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   using ReturnType = const DMatDMatMultExpr<MT1,MT2,false,false,false,false>;
-   return ReturnType( ~lhs, ~rhs );
+   return dmatdmatmult( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
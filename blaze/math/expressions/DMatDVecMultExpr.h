@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
+#include <blaze/math/dense/DispatchKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -72,6 +73,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -90,6 +92,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -442,10 +445,26 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectSmallAssignKernel" )
+                               :( "DMatDVecMultExpr::selectDefaultAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectSmallAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                                  ?( "DMatDVecMultExpr::selectLargeAssignKernel" )
+                                  :( "DMatDVecMultExpr::selectDefaultAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectBlasAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -752,6 +771,11 @@ class DMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -1125,10 +1149,26 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectSmallAddAssignKernel" )
+                               :( "DMatDVecMultExpr::selectDefaultAddAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallAddAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                                  ?( "DMatDVecMultExpr::selectLargeAddAssignKernel" )
+                                  :( "DMatDVecMultExpr::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasAddAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1435,6 +1475,11 @@ class DMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -1781,10 +1826,26 @@ class DMatDVecMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectSmallSubAssignKernel" )
+                               :( "DMatDVecMultExpr::selectDefaultSubAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallSubAssignKernel( y, A, x );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2> )
+                               ?( "DMatDVecMultExpr::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2> )
+                                  ?( "DMatDVecMultExpr::selectLargeSubAssignKernel" )
+                                  :( "DMatDVecMultExpr::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasSubAssignKernel( y, A, x );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2091,6 +2152,11 @@ class DMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -3024,10 +3090,26 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectSmallAssignKernel" )
+                               :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectSmallAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                                  ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectLargeAssignKernel" )
+                                  :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectBlasAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -3335,6 +3417,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -3726,10 +3813,26 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectSmallAddAssignKernel" )
+                               :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultAddAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallAddAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                                  ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectLargeAddAssignKernel" )
+                                  :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasAddAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4036,6 +4139,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -4383,10 +4491,26 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < DMATDVECMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectSmallSubAssignKernel" )
+                               :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultSubAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallSubAssignKernel( y, A, x, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,MT1,VT2,ST2> )
+                               ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> )
+                                  ?( "DVecScalarMultExpr<DMatDVecMultExpr>::selectLargeSubAssignKernel" )
+                                  :( "DVecScalarMultExpr<DMatDVecMultExpr>::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasSubAssignKernel( y, A, x, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -4693,6 +4817,11 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT2> );
 
       const size_t M( A.rows()    );
@@ -5306,6 +5435,64 @@ class DVecScalarMultExpr< DMatDVecMultExpr<MT,VT>, ST, false >
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a row-major dense matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side row-major dense matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+//
+// This function implements the default treatment of the multiplication of a row-major dense
+// matrix and a dense vector.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , DisableIf_t< IsPacked_v<MT> >* = nullptr >
+inline const DMatDVecMultExpr<MT,VT>
+   dmatdvecmult( const DenseMatrix<MT,false>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~mat).columns() == (~vec).size(), "Invalid matrix and vector sizes" );
+
+   return DMatDVecMultExpr<MT,VT>( ~mat, ~vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a row-major dense matrix with packed
+//        storage and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side row-major packed dense matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// row-major dense matrix with packed storage (see PackedMatrix) and a dense vector.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , EnableIf_t< IsPacked_v<MT> >* = nullptr >
+inline const PMatDVecMultExpr<MT,VT>
+   dmatdvecmult( const DenseMatrix<MT,false>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~mat).columns() == (~vec).size(), "Invalid matrix and vector sizes" );
+
+   return PMatDVecMultExpr<MT,VT>( ~mat, ~vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a row-major dense matrix and a dense
 //        vector (\f$ \vec{y}=A*\vec{x} \f$).
@@ -5349,8 +5536,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
    }
 
-   using ReturnType = const DMatDVecMultExpr<MT,VT>;
-   return ReturnType( ~mat, ~vec );
+   return dmatdvecmult( ~mat, ~vec );
 }
 //*************************************************************************************************
 
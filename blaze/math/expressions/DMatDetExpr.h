@@ -46,6 +46,7 @@
 #include <blaze/math/constraints/DenseMatrix.h>
 #include <blaze/math/constraints/MutableDataAccess.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/lapack/getrf.h>
@@ -54,6 +55,8 @@
 #include <blaze/math/typetraits/IsTriangular.h>
 #include <blaze/math/typetraits/IsUniTriangular.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
+#include <blaze/system/LAPACK.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/NumericCast.h>
 #include <blaze/util/Types.h>
@@ -336,17 +339,28 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 
    URT A( ~dm );
 
-   int n   ( numeric_cast<int>( A.rows()    ) );
-   int lda ( numeric_cast<int>( A.spacing() ) );
-   int info( 0 );
+   int n( numeric_cast<int>( A.rows() ) );
 
    const std::unique_ptr<int[]> ipiv( new int[n] );
 
-   getrf( n, n, A.data(), lda, ipiv.get(), &info );
+#if BLAZE_LAPACK_MODE
+   if( A.rows() * A.columns() >= DMATDECOMPOSITION_THRESHOLD )
+   {
+      int lda ( numeric_cast<int>( A.spacing() ) );
+      int info( 0 );
 
-   if( info > 0 ) {
-      return ET(0);
+      getrf( n, n, A.data(), lda, ipiv.get(), &info );
+
+      if( info > 0 ) {
+         return ET(0);
+      }
    }
+   else {
+      nativeGetrf( A, ipiv.get() );
+   }
+#else
+   nativeGetrf( A, ipiv.get() );
+#endif
 
    ET determinant = ET(1);
 
@@ -376,8 +390,10 @@ ElementType_t<MT> detNxN( const DenseMatrix<MT,SO>& dm )
 // matrices the value can overflow during the computation. Please note that this function does
 // not guarantee that it is possible to compute the determinant with the given matrix!
 //
-// \note This function can only be used if a fitting LAPACK library is available and linked to
-// the executable. Otherwise a linker error will be created.
+// \note For matrices with at least DMATDECOMPOSITION_THRESHOLD elements this function can only
+// be used if a fitting LAPACK library is available and linked to the executable. Otherwise a
+// linker error will be created. In case the LAPACK mode is disabled (see the BLAZE_LAPACK_MODE
+// switch), LAPACK is not required.
 */
 template< typename MT  // Type of the dense matrix
         , bool SO >    // Storage order of the dense matrix
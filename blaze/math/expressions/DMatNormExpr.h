@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
 #include <blaze/math/functors/L2Norm.h>
@@ -61,11 +62,14 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FalseType.h>
 #include <blaze/util/FunctionTrace.h>
@@ -77,6 +81,7 @@
 #include <blaze/util/TrueType.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -452,6 +457,9 @@ inline decltype(auto) norm_backend( const DenseMatrix<MT,true>& dm, Abs abs, Pow
    // ... Resizing and initialization
    const double l2 = norm( A, blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the matrix contains at least \c BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD elements and the
+// shared memory parallelization is active, the norm is computed in parallel.
 */
 template< typename MT      // Type of the dense matrix
         , bool SO          // Storage order
@@ -460,7 +468,23 @@ template< typename MT      // Type of the dense matrix
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseMatrix<MT,SO>& dm, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dm, abs, power, root, Bool< DMatNormHelper<MT,Abs,Power>::value >() );
+   using CT = CompositeType_t<MT>;
+   using ET = ElementType_t<MT>;
+
+   if( (~dm).rows() * (~dm).columns() < SMP_DMATTOTALREDUCE_THRESHOLD ) {
+      return norm_backend( ~dm, abs, power, root, Bool< DMatNormHelper<MT,Abs,Power>::value >() );
+   }
+
+   CT tmp( ~dm );
+
+   const ET norm( smpReduce( SO ? tmp.columns() : tmp.rows(), 1UL, [&]( size_t index, size_t size ) {
+      const auto sm( SO ? submatrix( tmp, 0UL, index, tmp.rows(), size, unchecked )
+                        : submatrix( tmp, index, 0UL, size, tmp.columns(), unchecked ) );
+      using ST = Decay_t< decltype( sm ) >;
+      return norm_backend( sm, abs, power, Noop(), Bool< DMatNormHelper<ST,Abs,Power>::value >() );
+   }, Add() ) );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -62,6 +62,7 @@
 #include <blaze/math/ReductionFlag.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/ReduceTrait.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
@@ -1974,6 +1975,11 @@ inline ElementType_t<MT> dmatreduce( const DenseMatrix<MT,true>& dm, OP op )
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case the matrix contains at least \c BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD elements and the
+// shared memory parallelization is active, the reduction is performed in parallel. Each thread
+// reduces a block of rows (in case of a row-major matrix) or columns (in case of a column-major
+// matrix) and the partial results are combined in a fixed order.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -1985,7 +1991,18 @@ inline decltype(auto) reduce( const DenseMatrix<MT,SO>& dm, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dmatreduce( ~dm, op );
+   using CT = CompositeType_t<MT>;
+
+   if( (~dm).rows() * (~dm).columns() < SMP_DMATTOTALREDUCE_THRESHOLD ) {
+      return dmatreduce( ~dm, op );
+   }
+
+   CT tmp( ~dm );
+
+   return smpReduce( SO ? tmp.columns() : tmp.rows(), 1UL, [&]( size_t index, size_t size ) {
+      return dmatreduce( SO ? submatrix( tmp, 0UL, index, tmp.rows(), size, unchecked )
+                            : submatrix( tmp, index, 0UL, size, tmp.columns(), unchecked ), op );
+   }, op );
 }
 //*************************************************************************************************
 
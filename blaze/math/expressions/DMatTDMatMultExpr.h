@@ -79,6 +79,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
@@ -8128,6 +8129,64 @@ class DMatScalarMultExpr< DMatTDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, false >
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a row-major dense matrix and a
+//        column-major dense matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side row-major dense matrix for the multiplication.
+// \param rhs The right-hand side column-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the default treatment of the multiplication of a row-major dense
+// matrix and a column-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , DisableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const DMatTDMatMultExpr<MT1,MT2,false,false,false,false>
+   dmattdmatmult( const DenseMatrix<MT1,false>& lhs, const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return DMatTDMatMultExpr<MT1,MT2,false,false,false,false>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a row-major dense matrix with packed
+//        storage and a column-major dense matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side row-major packed dense matrix for the multiplication.
+// \param rhs The right-hand side column-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// row-major dense matrix with packed storage (see PackedMatrix) and a column-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , EnableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const PMatDMatMultExpr<MT1,MT2,false>
+   dmattdmatmult( const DenseMatrix<MT1,false>& lhs, const DenseMatrix<MT2,true>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return PMatDMatMultExpr<MT1,MT2,false>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a row-major dense matrix and a
 //        column-major dense matrix (\f$ A=B*C \f$).
@@ -8169,8 +8228,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   using ReturnType = const DMatTDMatMultExpr<MT1,MT2,false,false,false,false>;
-   return ReturnType( ~lhs, ~rhs );
+   return dmattdmatmult( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
@@ -56,6 +56,7 @@
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
@@ -239,6 +240,17 @@ class DMatTransExpr
    }
    //**********************************************************************************************
 
+   //**Low-level data access***********************************************************************
+   /*!\brief Low-level data access to the matrix elements of row/column \a i.
+   //
+   // \param i The row/column index.
+   // \return Pointer to the internal element storage.
+   */
+   inline const ElementType* data( size_t i ) const noexcept {
+      return dm_.data(i);
+   }
+   //**********************************************************************************************
+
    //**Begin function******************************************************************************
    /*!\brief Returns an iterator to the first non-zero element of row/column \a i.
    //
@@ -882,6 +894,24 @@ struct IsAligned< DMatTransExpr<MT,SO> >
 
 
 
+//=================================================================================================
+//
+//  ISCONTIGUOUS SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename MT, bool SO >
+struct IsContiguous< DMatTransExpr<MT,SO> >
+   : public IsContiguous<MT>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  ISPADDED SPECIALIZATIONS
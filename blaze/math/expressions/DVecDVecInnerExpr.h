@@ -41,15 +41,20 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DispatchKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -196,6 +201,11 @@ inline EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
    CT1 left ( ~lhs );
    CT2 right( ~rhs );
 
+   MultType sp{};
+
+   if( dispatchDot( left, right, sp ) )
+      return sp;
+
    constexpr size_t SIMDSIZE = SIMDTrait<MultType>::size;
    constexpr bool remainder( !usePadding || !IsPadded_v<XT1> || !IsPadded_v<XT2> );
 
@@ -221,7 +231,7 @@ inline EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
       xmm1 = xmm1 + ( left.load(i) * right.load(i) );
    }
 
-   MultType sp( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   sp = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
    for( ; remainder && i<N; ++i ) {
       sp += left[i] * right[i];
@@ -257,7 +267,8 @@ inline EnableIf_t< DVecDVecInnerExprHelper<VT1,VT2>::value
 // and \a VT2 as well as the two element types \a VT1::ElementType and \a VT2::ElementType
 // have to be supported by the MultTrait class template.\n
 // In case the current sizes of the two given vectors don't match, a \a std::invalid_argument
-// is thrown.
+// is thrown. In case the vectors contain at least \c BLAZE_SMP_DVECDVECINNER_THRESHOLD elements
+// and the shared memory parallelization is active, the scalar product is computed in parallel.
 */
 template< typename VT1    // Type of the left-hand side dense vector
         , typename VT2 >  // Type of the right-hand side dense vector
@@ -266,11 +277,25 @@ inline decltype(auto)
 {
    BLAZE_FUNCTION_TRACE;
 
+   using CT1      = CompositeType_t<VT1>;
+   using CT2      = CompositeType_t<VT2>;
+   using MultType = MultTrait_t< ElementType_t<VT1>, ElementType_t<VT2> >;
+
    if( (~lhs).size() != (~rhs).size() ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   return dvecdvecinner( ~lhs, ~rhs );
+   if( (~lhs).size() < SMP_DVECDVECINNER_THRESHOLD ) {
+      return MultType( dvecdvecinner( ~lhs, ~rhs ) );
+   }
+
+   CT1 left ( ~lhs );
+   CT2 right( ~rhs );
+
+   return smpReduce( left.size(), SIMDTrait<MultType>::size, [&]( size_t index, size_t size ) {
+      return dvecdvecinner( subvector( left , index, size, unchecked ),
+                            subvector( right, index, size, unchecked ) );
+   }, Add() );
 }
 //*************************************************************************************************
 
@@ -42,8 +42,10 @@
 
 #include <utility>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DispatchKernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
 #include <blaze/math/functors/L2Norm.h>
@@ -61,11 +63,14 @@
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Optimizations.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FalseType.h>
@@ -78,6 +83,7 @@
 #include <blaze/util/TrueType.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
 #include <blaze/util/typetraits/HasMember.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
@@ -231,6 +237,11 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
 
    CT tmp( ~dv );
 
+   ET norm{};
+
+   if( dispatchNorm( tmp, abs, power, norm ) )
+      return evaluate( root( norm ) );
+
    const size_t N( tmp.size() );
 
    constexpr bool remainder( !usePadding || !IsPadded_v< RemoveReference_t<VT> > );
@@ -255,7 +266,7 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
       xmm1 += power( abs( tmp.load(i) ) );
    }
 
-   ET norm( sum( xmm1 + xmm2 + xmm3 + xmm4 ) );
+   norm = sum( xmm1 + xmm2 + xmm3 + xmm4 );
 
    for( ; remainder && i<N; ++i ) {
       norm += power( abs( tmp[i] ) );
@@ -287,6 +298,9 @@ inline decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the vector contains at least \c BLAZE_SMP_DVECREDUCE_THRESHOLD elements and the shared
+// memory parallelization is active, the norm is computed in parallel.
 */
 template< typename VT      // Type of the dense vector
         , bool TF          // Transpose flag
@@ -295,7 +309,22 @@ template< typename VT      // Type of the dense vector
         , typename Root >  // Type of the root operation
 decltype(auto) norm_backend( const DenseVector<VT,TF>& dv, Abs abs, Power power, Root root )
 {
-   return norm_backend( ~dv, abs, power, root, Bool< DVecNormHelper<VT,Abs,Power>::value >() );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   if( (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return norm_backend( ~dv, abs, power, root, Bool< DVecNormHelper<VT,Abs,Power>::value >() );
+   }
+
+   CT tmp( ~dv );
+
+   const ET norm( smpReduce( tmp.size(), SIMDTrait<ET>::size, [&]( size_t index, size_t size ) {
+      const auto sv( subvector( tmp, index, size, unchecked ) );
+      using ST = Decay_t< decltype( sv ) >;
+      return norm_backend( sv, abs, power, Noop(), Bool< DVecNormHelper<ST,Abs,Power>::value >() );
+   }, Add() ) );
+
+   return evaluate( root( norm ) );
 }
 /*! \endcond */
 //*************************************************************************************************
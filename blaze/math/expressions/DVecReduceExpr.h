@@ -41,13 +41,17 @@
 //*************************************************************************************************
 
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DispatchKernels.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/views/Check.h>
 #include <blaze/system/Compiler.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
@@ -335,6 +339,36 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a dense vector.
+// \ingroup dense_vector
+//
+// \param dv The given dense vector for the reduction operation.
+// \param op The reduction operation.
+// \return The result of the reduction operation.
+//
+// This function uses the runtime dispatched kernel in case one is available for the given
+// vector and reduction operation (see blaze::getInstructionSet()) and falls back to the
+// default backend implementation otherwise.
+*/
+template< typename VT    // Type of the dense vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline auto dvecreduceDispatch( const DenseVector<VT,TF>& dv, OP op )
+   -> ElementType_t<VT>
+{
+   ElementType_t<VT> redux{};
+
+   if( dispatchReduce( ~dv, op, redux ) )
+      return redux;
+
+   return dvecreduce( ~dv, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given dense vector.
 // \ingroup dense_vector
@@ -360,6 +394,10 @@ inline auto dvecreduce( const DenseVector<VT,TF>& dv, Add /*op*/ )
 // possible to create vectorized custom operations. See \ref custom_operations for a detailed
 // overview of the possibilities of custom operations.
 //
+// In case the vector contains at least \c BLAZE_SMP_DVECREDUCE_THRESHOLD elements and the shared
+// memory parallelization is active, the reduction is performed in parallel. Each thread reduces
+// a contiguous part of the vector and the partial results are combined in a fixed order.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -371,7 +409,18 @@ inline decltype(auto) reduce( const DenseVector<VT,TF>& dv, OP op )
 {
    BLAZE_FUNCTION_TRACE;
 
-   return dvecreduce( ~dv, op );
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   if( (~dv).size() < SMP_DVECREDUCE_THRESHOLD ) {
+      return dvecreduceDispatch( ~dv, op );
+   }
+
+   CT tmp( ~dv );
+
+   return smpReduce( tmp.size(), SIMDTrait<ET>::size, [&]( size_t index, size_t size ) {
+      return dvecreduceDispatch( subvector( tmp, index, size, unchecked ), op );
+   }, op );
 }
 //*************************************************************************************************
 
@@ -106,6 +106,8 @@ template< typename, typename, bool > class DVecSVecSubExpr;
 template< typename, bool > class DVecTransExpr;
 template< typename, bool > class DVecTransposer;
 template< typename, bool > struct Matrix;
+template< typename, typename, bool > class PMatDMatMultExpr;
+template< typename, typename > class PMatDVecMultExpr;
 template< typename, bool > class SMatDeclDiagExpr;
 template< typename, bool > class SMatDeclHermExpr;
 template< typename, bool > class SMatDeclLowExpr;
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -53,20 +54,29 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
 #include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -75,6 +85,7 @@
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -96,6 +107,7 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -162,6 +174,29 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the sparse matrix operand is stored in block compressed format, the right-hand
+       side dense matrix operand is not diagonal, and no symmetry or triangular structure has to
+       be considered, the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseBlockKernel_v =
+      ( IsBlockCompressed_v<T2> && !IsDiagonal_v<T3> && !SYM && !HERM && !LOW && !UPP );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the block row-wise parallel
+       evaluation strategy. In case the block kernel can be used for the sparse matrix operand,
+       the variable will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseBlockSMPAssign_v = UseBlockKernel_v<T1,MT1,MT2>;
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
@@ -170,6 +205,7 @@ class SMatDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseVectorizedKernel_v =
       ( useOptimizedKernels &&
+        !UseBlockKernel_v<T1,T2,T3> &&
         !IsDiagonal_v<T3> &&
         T1::simdEnabled && T3::simdEnabled &&
         IsRowMajorMatrix_v<T1> &&
@@ -190,6 +226,7 @@ class SMatDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseOptimizedKernel_v =
       ( useOptimizedKernels &&
+        !UseBlockKernel_v<T1,T2,T3> &&
         !UseVectorizedKernel_v<T1,T2,T3> &&
         !IsDiagonal_v<T3> &&
         !IsResizable_v< ElementType_t<T1> > &&
@@ -200,11 +237,12 @@ class SMatDMatMultExpr
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Helper variable template for the explicit application of the SFINAE principle.
-   /*! In case neither a vectorized nor optimized computation is possible, the variable will be
-       set to 1, otherwise it will be 0. */
+   /*! In case neither a block, vectorized, nor optimized computation is possible, the variable
+       will be set to 1, otherwise it will be 0. */
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseDefaultKernel_v =
-      ( !UseVectorizedKernel_v<T1,T2,T3> &&
+      ( !UseBlockKernel_v<T1,T2,T3> &&
+        !UseVectorizedKernel_v<T1,T2,T3> &&
         !UseOptimizedKernel_v<T1,T2,T3> );
    /*! \endcond */
    //**********************************************************************************************
@@ -825,6 +863,90 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed assignment to dense matrices***********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a block compressed matrix-dense matrix multiplication to dense matrices
+   //        (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for a sparse matrix in block compressed
+   // format (see the BlockCompressedMatrix class template).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseBlockKernel_v<MT3,MT4,MT5> >
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectBlockRowKernel( C, A, B, 0UL, A.blockRows(), Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed kernel*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a range of block rows of a block compressed matrix-dense
+   //        matrix multiplication.
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param bbegin The index of the first block row of the range.
+   // \param bend The index one past the last block row of the range.
+   // \return void
+   //
+   // This function computes the given range of block rows one after another. Each element of a
+   // stored block scales the according row of the dense matrix operand, which is accumulated in
+   // the according row of the target matrix by means of a vectorized row update. The type of the
+   // (compound) assignment is selected via the type \a OP.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static inline void
+      selectBlockRowKernel( MT3& C, const MT4& A, const MT5& B, size_t bbegin, size_t bend, OP )
+   {
+      constexpr size_t BH( MT4::blockHeight );
+      constexpr size_t BW( MT4::blockWidth );
+
+      const auto* const blocks ( A.blocks() );
+      const auto* const indices( A.columnIndices() );
+      const size_t* const rowptr( A.rowPointers() );
+
+      const size_t N( B.columns() );
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         if( IsSame_v<OP,Assign> ) {
+            reset( submatrix( C, bi*BH, 0UL, BH, N, unchecked ) );
+         }
+
+         for( size_t k=rowptr[bi]; k<rowptr[bi+1UL]; ++k )
+         {
+            for( size_t i=0UL; i<BH; ++i )
+            {
+               auto target( row( C, bi*BH+i, unchecked ) );
+
+               for( size_t j=0UL; j<BW; ++j )
+               {
+                  if( IsSame_v<OP,SubAssign> )
+                     target -= serial( blocks[k](i,j) * row( B, indices[k]*BW+j, unchecked ) );
+                  else
+                     target += serial( blocks[k](i,j) * row( B, indices[k]*BW+j, unchecked ) );
+               }
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1223,6 +1345,31 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed addition assignment to dense matrices**************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a block compressed matrix-dense matrix multiplication to dense
+   //        matrices (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for a sparse matrix in block
+   // compressed format (see the BlockCompressedMatrix class template).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseBlockKernel_v<MT3,MT4,MT5> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectBlockRowKernel( C, A, B, 0UL, A.blockRows(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Addition assignment to sparse matrices******************************************************
    // No special implementation for the addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1586,6 +1733,31 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed subtraction assignment to dense matrices***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a block compressed matrix-dense matrix multiplication to
+   //        dense matrices (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for a sparse matrix in block
+   // compressed format (see the BlockCompressedMatrix class template).
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseBlockKernel_v<MT3,MT4,MT5> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectBlockRowKernel( C, A, B, 0UL, A.blockRows(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Subtraction assignment to sparse matrices***************************************************
    // No special implementation for the subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -1634,6 +1806,49 @@ class SMatDMatMultExpr
    // No special implementation for the multiplication assignment to sparse matrices.
    //**********************************************************************************************
 
+   //**Block compressed SMP assignment*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP (compound) assignment of a block compressed matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side sparse matrix operand.
+   // \param B The right-hand side dense matrix operand.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function implements the SMP (compound) assignment of a block compressed matrix-dense
+   // matrix multiplication. The work is split along the block rows: Each thread computes a range
+   // of block rows with roughly the same number of stored blocks. In case the parallel execution
+   // is not possible, the block rows are computed serially.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static inline void smpAssignBlockRows( MT3& C, const MT4& A, const MT5& B, OP op, bool parallel )
+   {
+      if( !IsSMPAssignable_v<MT3> || !IsSMPAssignable_v<MT5> || !parallel ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         selectBlockRowKernel( C, A, B, 0UL, A.blockRows(), op );
+         return;
+      }
+
+      const size_t threads( getNumThreads() );
+
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionBlockRows( A, threads, bounds.get() );
+
+      smpFor( threads, [&]( size_t i )
+      {
+         if( bounds[i] == bounds[i+1UL] ) return;
+         selectBlockRowKernel( C, A, B, bounds[i], bounds[i+1UL], op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to dense matrices************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a dense matrix
@@ -1651,7 +1866,7 @@ class SMatDMatMultExpr
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> && !UseBlockSMPAssign_v<MT> >
       smpAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -1674,6 +1889,46 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed SMP assignment to dense matrices*******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block compressed matrix-dense matrix multiplication to a dense
+   //        matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense matrix
+   // multiplication expression with a block compressed matrix operand to a dense matrix. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBlockSMPAssign_v<MT> >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignBlockRows( ~lhs, A, B, Assign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-dense matrix multiplication to a sparse matrix
@@ -1734,7 +1989,7 @@ class SMatDMatMultExpr
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> && !UseBlockSMPAssign_v<MT> >
       smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -1757,6 +2012,46 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed SMP addition assignment to dense matrices**********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a block compressed matrix-dense matrix multiplication to a
+   //        dense matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense matrix
+   // multiplication expression with a block compressed matrix operand to a dense matrix. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBlockSMPAssign_v<MT> >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignBlockRows( ~lhs, A, B, AddAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse matrices**************************************************
    // No special implementation for the SMP addition assignment to sparse matrices.
    //**********************************************************************************************
@@ -1779,7 +2074,7 @@ class SMatDMatMultExpr
    */
    template< typename MT  // Type of the target dense matrix
            , bool SO >    // Storage order of the target dense matrix
-   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> >
+   friend inline EnableIf_t< IsEvaluationRequired_v<MT,MT1,MT2> && !UseBlockSMPAssign_v<MT> >
       smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -1802,6 +2097,46 @@ class SMatDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Block compressed SMP subtraction assignment to dense matrices*******************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a block compressed matrix-dense matrix multiplication
+   //        to a dense matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense matrix
+   // multiplication expression with a block compressed matrix operand to a dense matrix. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseBlockSMPAssign_v<MT> >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignBlockRows( ~lhs, A, B, SubAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse matrices***********************************************
    // No special implementation for the SMP subtraction assignment to sparse matrices.
    //**********************************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnVector.h>
 #include <blaze/math/constraints/DenseVector.h>
@@ -48,26 +49,50 @@
 #include <blaze/math/constraints/RequiresEvaluation.h>
 #include <blaze/math/constraints/RowMajorMatrix.h>
 #include <blaze/math/constraints/SparseMatrix.h>
+#include <blaze/math/dense/Forward.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/IsAligned.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
 #include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSoACompressed.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/Decay.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -114,11 +139,14 @@ class SMatDVecMultExpr
    //! Compilation switch for the evaluation strategy of the multiplication expression.
    /*! The \a useAssign compile time constant expression represents a compilation switch for
        the evaluation strategy of the multiplication expression. In case either the matrix or
-       the vector operand requires an intermediate evaluation or the dense vector expression
-       is a compound expression, \a useAssign will be set to \a true and the multiplication
-       expression will be evaluated via the \a assign function family. Otherwise \a useAssign
-       will be set to \a false and the expression will be evaluated via the subscript operator. */
-   static constexpr bool useAssign = ( evaluateMatrix || evaluateVector );
+       the vector operand requires an intermediate evaluation, the dense vector expression is a
+       compound expression, or the sparse matrix is stored in sliced ELLPACK format (which is
+       evaluated chunk-wise) or in block compressed format (which is evaluated block row-wise),
+       \a useAssign will be set to \a true and the multiplication expression will be evaluated
+       via the \a assign function family. Otherwise \a useAssign will be set to \a false and the
+       expression will be evaluated via the subscript operator. */
+   static constexpr bool useAssign =
+      ( evaluateMatrix || evaluateVector || IsSlicedEllpack_v<MT> || IsBlockCompressed_v<MT> );
    //**********************************************************************************************
 
    //**********************************************************************************************
@@ -195,7 +223,7 @@ class SMatDVecMultExpr
    */
    inline ReturnType operator[]( size_t index ) const {
       BLAZE_INTERNAL_ASSERT( index < mat_.rows(), "Invalid vector access index" );
-      return row( mat_, index, unchecked ) * vec_;
+      return selectSubscriptKernel( mat_, vec_, index );
    }
    //**********************************************************************************************
 
@@ -289,11 +317,424 @@ class SMatDVecMultExpr
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the nonzero-balanced parallel
+       evaluation strategy. In case the balanced scheduling is enabled and both the target vector
+       and the (evaluated) operands are SMP assignable, the variable will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseBalancedSMPAssign_v =
+      ( useBalancedSpMV && !IsSlicedEllpack_v<MT> && !IsBlockCompressed_v<MT> &&
+        IsSMPAssignable_v<T1> && IsSMPAssignable_v< Decay_t<LT> > && IsSMPAssignable_v< Decay_t<RT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the chunk-wise parallel evaluation
+       strategy. In case the sparse matrix is stored in sliced ELLPACK format, the variable will
+       be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSlicedSMPAssign_v = IsSlicedEllpack_v<MT>;
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the block row-wise parallel
+       evaluation strategy. In case the sparse matrix is stored in block compressed format, the
+       variable will be set to 1, otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseBlockSMPAssign_v = IsBlockCompressed_v<MT>;
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    LeftOperand  mat_;  //!< Left-hand side sparse matrix of the multiplication expression.
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the gather kernel for a single
+       element of the product. In case the sparse matrix stores its values and indices in
+       separate arrays (see the IsSoACompressed type trait), the dense vector provides low-level
+       access to its contiguous elements, both operands have the same element type, and SIMD
+       gather operations are available for this element type, the variable will be set to 1,
+       otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   static constexpr bool UseGatherKernel_v =
+      ( useOptimizedKernels && IsSoACompressed_v<T1> &&
+        HasConstDataAccess_v<T2> && IsContiguous_v<T2> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsFloatingPoint_v< ElementType_t<T1> > && HasSIMDGather_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default subscript kernel********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default computation of a single element of the sparse matrix-dense vector product.
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the element to be computed.
+   // \return The resulting value.
+   //
+   // This function computes the \a i-th element of the product as the inner product of the
+   // \a i-th row of the sparse matrix and the dense vector.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline DisableIf_t< UseGatherKernel_v<MT1,VT1>, ElementType >
+      selectSubscriptKernel( const MT1& A, const VT1& x, size_t i )
+   {
+      return row( A, i, unchecked ) * x;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Gather subscript kernel*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Gather-based computation of a single element of the sparse matrix-dense vector product.
+   //
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param i The index of the element to be computed.
+   // \return The resulting value.
+   //
+   // This function computes the \a i-th element of the product for sparse matrices with separate
+   // value and index arrays. The values of the \a i-th row are loaded contiguously, whereas the
+   // corresponding elements of the dense vector are gathered via the stored column indices.
+   */
+   template< typename MT1    // Type of the left-hand side matrix operand
+           , typename VT1 >  // Type of the right-hand side vector operand
+   static inline EnableIf_t< UseGatherKernel_v<MT1,VT1>, ElementType >
+      selectSubscriptKernel( const MT1& A, const VT1& x, size_t i )
+   {
+      using ET = ElementType_t<MT1>;
+      using IT = If_t< sizeof( typename MT1::IndexType ) == 4UL, uint32_t, size_t >;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      const ET* const values ( A.values( i ) );
+      const IT* const indices( reinterpret_cast<const IT*>( A.indices( i ) ) );
+      const ET* const data   ( x.data() );
+
+      const size_t nonzeros( A.nonZeros( i ) );
+      const size_t kpos( nonzeros & size_t(-SIMDSIZE) );
+      BLAZE_INTERNAL_ASSERT( ( nonzeros - ( nonzeros % SIMDSIZE ) ) == kpos, "Invalid end calculation" );
+
+      SIMDTrait_t<ET> xmm1, xmm2;
+      size_t k( 0UL );
+
+      for( ; (k+SIMDSIZE) < kpos; k+=SIMDSIZE*2UL ) {
+         xmm1 = xmm1 + ( loadu( values+k          ) * gather( data, indices+k          ) );
+         xmm2 = xmm2 + ( loadu( values+k+SIMDSIZE ) * gather( data, indices+k+SIMDSIZE ) );
+      }
+      for( ; k<kpos; k+=SIMDSIZE ) {
+         xmm1 = xmm1 + ( loadu( values+k ) * gather( data, indices+k ) );
+      }
+
+      ElementType res( sum( xmm1 + xmm2 ) );
+
+      for( ; k<nonzeros; ++k ) {
+         res += values[k] * data[indices[k]];
+      }
+
+      return res;
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the vectorized kernel for sparse
+       matrices in sliced ELLPACK format. In case the dense vector provides low-level access to
+       its contiguous elements, both operands have the same element type, and SIMD gather
+       operations are available for this element type, the variable will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1, typename T2 >
+   static constexpr bool UseSlicedGatherKernel_v =
+      ( useOptimizedKernels && IsSlicedEllpack_v<T1> &&
+        HasConstDataAccess_v<T2> && IsContiguous_v<T2> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsFloatingPoint_v< ElementType_t<T1> > && HasSIMDGather_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default assignment kernel*******************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default (compound) assignment of a sparse matrix-dense vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline DisableIf_t< IsSlicedEllpack_v<MT1> || IsBlockCompressed_v<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, OP op )
+   {
+      op( y, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sliced ELLPACK assignment kernel************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a sliced ELLPACK matrix-dense vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline EnableIf_t< IsSlicedEllpack_v<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, OP op )
+   {
+      selectSlicedKernel( y, A, x, 0UL, A.chunks(), op );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default sliced ELLPACK kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default (compound) assignment of a range of chunks of a sliced ELLPACK matrix-dense
+   //        vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param cbegin The index of the first chunk of the range.
+   // \param cend The index one past the last chunk of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function computes the rows of the given range of chunks one after another by means
+   // of the interleaved value and index arrays.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline DisableIf_t< UseSlicedGatherKernel_v<MT1,VT2> >
+      selectSlicedKernel( VT1& y, const MT1& A, const VT2& x, size_t cbegin, size_t cend, OP op )
+   {
+      constexpr size_t C( MT1::chunkSize );
+
+      const auto* const values ( A.values() );
+      const auto* const indices( A.indices() );
+      const auto* const rows   ( A.rowIndices() );
+      const auto* const lengths( A.rowLengths() );
+
+      const size_t M( A.rows() );
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const size_t first( c*C );
+         const size_t lanes( min( C, M - first ) );
+
+         for( size_t l=0UL; l<lanes; ++l )
+         {
+            const size_t nonzeros( lengths[first+l] );
+            size_t pos( A.offset( c ) + l );
+
+            if( nonzeros == 0UL ) {
+               assignElement( y[rows[first+l]], ElementType(), op );
+               continue;
+            }
+
+            ElementType res( values[pos] * x[indices[pos]] );
+            pos += C;
+
+            for( size_t k=1UL; k<nonzeros; ++k, pos+=C ) {
+               res += values[pos] * x[indices[pos]];
+            }
+
+            assignElement( y[rows[first+l]], res, op );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized sliced ELLPACK kernel************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized (compound) assignment of a range of chunks of a sliced ELLPACK
+   //        matrix-dense vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param cbegin The index of the first chunk of the range.
+   // \param cend The index one past the last chunk of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function computes all rows of a chunk simultaneously: For each position that is
+   // occupied in all rows of the chunk, the values are loaded via a single aligned SIMD load
+   // and the according elements of the dense vector are gathered via the stored column indices.
+   // The remaining elements of longer rows are added individually. Therefore the padding
+   // elements of the chunk never contribute to the result.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline EnableIf_t< UseSlicedGatherKernel_v<MT1,VT2> >
+      selectSlicedKernel( VT1& y, const MT1& A, const VT2& x, size_t cbegin, size_t cend, OP op )
+   {
+      using ET = ElementType_t<MT1>;
+      using IT = If_t< sizeof( typename MT1::IndexType ) == 4UL, uint32_t, size_t >;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      const ET* const values ( A.values() );
+      const IT* const indices( reinterpret_cast<const IT*>( A.indices() ) );
+      const auto* const rows   ( A.rowIndices() );
+      const auto* const lengths( A.rowLengths() );
+      const ET* const data   ( x.data() );
+
+      const size_t M( A.rows() );
+
+      alignas( AlignmentOf_v<ET> ) ET tmp[SIMDSIZE];
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const size_t first( c*SIMDSIZE );
+         const size_t lanes( min( SIMDSIZE, M - first ) );
+
+         const ET* const v( values  + A.offset( c ) );
+         const IT* const j( indices + A.offset( c ) );
+
+         size_t kmin( lengths[first] );
+         for( size_t l=1UL; l<lanes; ++l ) {
+            kmin = min( kmin, lengths[first+l] );
+         }
+
+         SIMDTrait_t<ET> xmm1, xmm2;
+         size_t k( 0UL );
+
+         for( ; (k+2UL) <= kmin; k+=2UL ) {
+            xmm1 = xmm1 + ( loada( v+k*SIMDSIZE          ) * gather( data, j+k*SIMDSIZE          ) );
+            xmm2 = xmm2 + ( loada( v+k*SIMDSIZE+SIMDSIZE ) * gather( data, j+k*SIMDSIZE+SIMDSIZE ) );
+         }
+         if( k < kmin ) {
+            xmm1 = xmm1 + ( loada( v+k*SIMDSIZE ) * gather( data, j+k*SIMDSIZE ) );
+         }
+
+         storea( tmp, xmm1 + xmm2 );
+
+         for( size_t l=0UL; l<lanes; ++l )
+         {
+            const size_t nonzeros( lengths[first+l] );
+            ET res( tmp[l] );
+
+            for( k=kmin; k<nonzeros; ++k ) {
+               res += v[k*SIMDSIZE+l] * data[j[k*SIMDSIZE+l]];
+            }
+
+            assignElement( y[rows[first+l]], res, op );
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed assignment kernel**********************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a block compressed matrix-dense vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline EnableIf_t< IsBlockCompressed_v<MT1> >
+      selectAssignKernel( VT1& y, const MT1& A, const VT2& x, OP op )
+   {
+      selectBlockRowKernel( y, A, x, 0UL, A.blockRows(), op );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed kernel*********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a range of block rows of a block compressed matrix-dense
+   //        vector multiplication.
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param bbegin The index of the first block row of the range.
+   // \param bend The index one past the last block row of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function computes the given range of block rows one after another. The products of
+   // all stored blocks with the according segments of the dense vector are accumulated in a
+   // StaticVector by means of fixed-size loops, which the compiler can fully unroll. The result
+   // of each block row is assigned to the target vector at once.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline void
+      selectBlockRowKernel( VT1& y, const MT1& A, const VT2& x, size_t bbegin, size_t bend, OP op )
+   {
+      constexpr size_t R( MT1::blockHeight );
+      constexpr size_t C( MT1::blockWidth );
+
+      using YT = StaticVector< ElementType, R, columnVector >;
+
+      const auto* const blocks ( A.blocks() );
+      const auto* const indices( A.columnIndices() );
+      const size_t* const rowptr( A.rowPointers() );
+
+      for( size_t bi=bbegin; bi<bend; ++bi )
+      {
+         YT tmp;
+
+         for( size_t k=rowptr[bi]; k<rowptr[bi+1UL]; ++k )
+         {
+            const auto& block( blocks[k] );
+            const size_t jbegin( indices[k]*C );
+
+            for( size_t i=0UL; i<R; ++i ) {
+               for( size_t j=0UL; j<C; ++j ) {
+                  tmp[i] += block(i,j) * x[jbegin+j];
+               }
+            }
+         }
+
+         auto target( subvector( y, bi*R, R, unchecked ) );
+         op( target, tmp );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to dense vectors*****************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-dense vector multiplication to a dense vector
@@ -331,7 +772,7 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      assign( ~lhs, A * x );
+      selectAssignKernel( ~lhs, A, x, Assign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -406,7 +847,7 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      addAssign( ~lhs, A * x );
+      selectAssignKernel( ~lhs, A, x, AddAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -451,7 +892,7 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      subAssign( ~lhs, A * x );
+      selectAssignKernel( ~lhs, A, x, SubAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -552,7 +993,8 @@ class SMatDVecMultExpr
    // specific parallel evaluation strategy is selected.
    */
    template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedSMPAssign_v<VT1> &&
+                             !UseSlicedSMPAssign_v<VT1> && !UseBlockSMPAssign_v<VT1> >
       smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -577,107 +1019,236 @@ class SMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP assignment to sparse vectors************************************************************
+   //**Balanced SMP assignment to dense vectors*****************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
-   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   /*!\brief Nonzero-balanced SMP (compound) assignment of a sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param lhs The target left-hand side sparse vector.
-   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
    // \return void
    //
-   // This function implements the performance optimized SMP assignment of a sparse matrix-dense
-   // vector multiplication expression to a sparse vector. Due to the explicit application of
-   // the SFINAE principle, this function can only be selected by the compiler in case the
-   // expression specific parallel evaluation strategy is selected.
+   // This function implements the nonzero-balanced SMP (compound) assignment of a sparse
+   // matrix-dense vector multiplication. The rows of the sparse matrix are split into one
+   // partition per thread such that each partition contains roughly the same number of
+   // non-zero elements. Each thread assigns the product of its rows to the corresponding
+   // range of the target vector. In contrast to a split of the target vector into equally
+   // sized ranges, this keeps all threads busy for matrices with very irregular rows.
    */
-   template< typename VT1 >  // Type of the target sparse vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
-      smpAssign( SparseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline void smpAssignBalanced( VT1& y, const MT1& A, const VT2& x, OP op )
    {
-      BLAZE_FUNCTION_TRACE;
+      const size_t threads( getNumThreads() );
 
-      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
-      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
-      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionNonZeros( A, threads, bounds.get() );
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      smpFor( threads, [&]( size_t i )
+      {
+         const size_t index( bounds[i] );
+         const size_t n( bounds[i+1UL] - index );
 
-      const ResultType tmp( rhs );
-      smpAssign( ~lhs, tmp );
+         if( n == 0UL ) return;
+
+         auto target( subvector( y, index, n, unchecked ) );
+         assignBlock( target, A, x, index, op );
+      } );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP addition assignment to dense vectors****************************************************
+   //**Sliced SMP assignment***********************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP addition assignment of a sparse matrix-dense vector multiplication to a dense
-   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   /*!\brief SMP (compound) assignment of a sliced ELLPACK matrix-dense vector multiplication to
+   //        a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
-   // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be added.
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
    // \return void
    //
-   // This function implements the performance optimized SMP addition assignment of a sparse
-   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
+   // This function implements the SMP (compound) assignment of a sliced ELLPACK matrix-dense
+   // vector multiplication. Since the rows of a sliced ELLPACK matrix are permuted within their
+   // chunks, the work is split along the chunks instead of along the target vector: Each thread
+   // computes a range of chunks with roughly the same number of stored elements and writes the
+   // results to the original positions of the according rows. In case the parallel execution
+   // is not possible, the chunks are computed serially.
    */
-   template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
-      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline void smpAssignSliced( VT1& y, const MT1& A, const VT2& x, OP op, bool parallel )
    {
-      BLAZE_FUNCTION_TRACE;
+      if( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> || !parallel ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         selectSlicedKernel( y, A, x, 0UL, A.chunks(), op );
+         return;
+      }
 
-      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+      const size_t threads( getNumThreads() );
 
-      if( rhs.mat_.columns() == 0UL ) {
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionChunks( A, threads, bounds.get() );
+
+      smpFor( threads, [&]( size_t i )
+      {
+         if( bounds[i] == bounds[i+1UL] ) return;
+         selectSlicedKernel( y, A, x, bounds[i], bounds[i+1UL], op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed SMP assignment*************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP (compound) assignment of a block compressed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function implements the SMP (compound) assignment of a block compressed matrix-dense
+   // vector multiplication. The work is split along the block rows: Each thread computes a range
+   // of block rows with roughly the same number of stored blocks. In case the parallel execution
+   // is not possible, the block rows are computed serially.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline void smpAssignBlockRows( VT1& y, const MT1& A, const VT2& x, OP op, bool parallel )
+   {
+      if( !IsSMPAssignable_v<VT1> || !IsSMPAssignable_v<VT2> || !parallel ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         selectBlockRowKernel( y, A, x, 0UL, A.blockRows(), op );
          return;
       }
 
-      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
-      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+      const size_t threads( getNumThreads() );
 
-      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
-      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
-      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
-      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionBlockRows( A, threads, bounds.get() );
 
-      smpAddAssign( ~lhs, A * x );
+      smpFor( threads, [&]( size_t i )
+      {
+         if( bounds[i] == bounds[i+1UL] ) return;
+         selectBlockRowKernel( y, A, x, bounds[i], bounds[i+1UL], op );
+      } );
    }
    /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP addition assignment to sparse vectors***************************************************
-   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**Default block assignment********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default (compound) assignment of a range of rows of a sparse matrix-dense vector
+   //        multiplication.
+   //
+   // \param y The target range of the left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param index The index of the first row of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline DisableIf_t< UseGatherKernel_v<MT1,VT2> >
+      assignBlock( VT1& y, const MT1& A, const VT2& x, size_t index, OP op )
+   {
+      op( y, submatrix( A, index, 0UL, y.size(), A.columns(), unchecked ) * x );
+   }
+   /*! \endcond */
    //**********************************************************************************************
 
-   //**SMP subtraction assignment to dense vectors*************************************************
+   //**Gather block assignment*********************************************************************
    /*! \cond BLAZE_INTERNAL */
-   /*!\brief SMP subtraction assignment of a sparse matrix-dense vector multiplication to a dense
-   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   /*!\brief Gather-based (compound) assignment of a range of rows of a sparse matrix-dense vector
+   //        multiplication.
+   //
+   // \param y The target range of the left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param index The index of the first row of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function computes each row of the given range directly on the sparse matrix operand
+   // by means of the gather kernel, since a submatrix view does not expose the separate value
+   // and index arrays.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP >   // Type of the assignment operation
+   static inline EnableIf_t< UseGatherKernel_v<MT1,VT2> >
+      assignBlock( VT1& y, const MT1& A, const VT2& x, size_t index, OP op )
+   {
+      for( size_t i=0UL; i<y.size(); ++i ) {
+         assignElement( y[i], selectSubscriptKernel( A, x, index+i ), op );
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Element assignment**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a single element of the target vector.
+   //
+   // \param a The target element.
+   // \param b The value to be assigned.
+   // \return void
+   */
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, Assign ) { a = b; }
+
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, AddAssign ) { a += b; }
+
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, SubAssign ) { a -= b; }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Balanced SMP assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
    // \ingroup dense_vector
    //
    // \param lhs The target left-hand side dense vector.
-   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \param rhs The right-hand side multiplication expression to be assigned.
    // \return void
    //
-   // This function implements the performance optimized SMP subtraction assignment of a sparse
-   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
-   // application of the SFINAE principle, this function can only be selected by the compiler
-   // in case the expression specific parallel evaluation strategy is selected.
+   // This function implements the nonzero-balanced SMP assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // nonzero-balanced parallel evaluation strategy is selected.
    */
    template< typename VT1 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
-      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
 
       BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
 
       if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
          return;
       }
 
@@ -689,7 +1260,463 @@ class SMatDVecMultExpr
       BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
       BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
 
-      smpSubAssign( ~lhs, A * x );
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         assign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sliced SMP assignment to dense vectors******************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense vector
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense vector. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignSliced( ~lhs, A, x, Assign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed SMP assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a block compressed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-dense vector
+   // multiplication expression with a block compressed matrix operand to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBlockSMPAssign_v<VT1> >
+      smpAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignBlockRows( ~lhs, A, x, Assign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP assignment to sparse vectors************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sparse matrix-dense vector multiplication to a sparse vector
+   //        (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side sparse vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the performance optimized SMP assignment of a sparse matrix-dense
+   // vector multiplication expression to a sparse vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target sparse vector
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> >
+      smpAssign( SparseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_BE_COLUMN_VECTOR_TYPE( ResultType );
+      BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( ResultType );
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      const ResultType tmp( rhs );
+      smpAssign( ~lhs, tmp );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the performance optimized SMP addition assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedSMPAssign_v<VT1> &&
+                             !UseSlicedSMPAssign_v<VT1> && !UseBlockSMPAssign_v<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAddAssign( ~lhs, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Balanced SMP addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP addition assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP addition assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // nonzero-balanced parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sliced SMP addition assignment to dense vectors*********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense vector
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense vector. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignSliced( ~lhs, A, x, AddAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed SMP addition assignment to dense vectors***********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a block compressed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-dense vector
+   // multiplication expression with a block compressed matrix operand to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBlockSMPAssign_v<VT1> >
+      smpAddAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignBlockRows( ~lhs, A, x, AddAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**SMP addition assignment to sparse vectors***************************************************
+   // No special implementation for the SMP addition assignment to sparse vectors.
+   //**********************************************************************************************
+
+   //**SMP subtraction assignment to dense vectors*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sparse matrix-dense vector multiplication to a dense
+   //        vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the performance optimized SMP subtraction assignment of a sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the expression specific parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseSMPAssign_v<VT1> && !UseBalancedSMPAssign_v<VT1> &&
+                             !UseSlicedSMPAssign_v<VT1> && !UseBlockSMPAssign_v<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpSubAssign( ~lhs, A * x );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Balanced SMP subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP subtraction assignment of a sparse matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP subtraction assignment of a sparse matrix-dense
+   // vector multiplication expression to a dense vector. Due to the explicit application of
+   // the SFINAE principle, this function can only be selected by the compiler in case the
+   // nonzero-balanced parallel evaluation strategy is selected.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sliced SMP subtraction assignment to dense vectors******************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sliced ELLPACK matrix-dense vector multiplication to a
+   //        dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense vector. Due to
+   // the explicit application of the SFINAE principle, this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignSliced( ~lhs, A, x, SubAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Block compressed SMP subtraction assignment to dense vectors********************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a block compressed matrix-dense vector multiplication
+   //        to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-dense vector
+   // multiplication expression with a block compressed matrix operand to a dense vector. Due
+   // to the explicit application of the SFINAE principle, this function can only be selected
+   // by the compiler in case the sparse matrix is stored in block compressed format.
+   */
+   template< typename VT1 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBlockSMPAssign_v<VT1> >
+      smpSubAssign( DenseVector<VT1,false>& lhs, const SMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      smpAssignBlockRows( ~lhs, A, x, SubAssign(), rhs.canSMPAssign() );
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/DenseMatrix.h>
@@ -53,16 +54,27 @@
 #include <blaze/math/expressions/DenseMatrix.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatMatMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
 #include <blaze/math/functors/DeclDiag.h>
 #include <blaze/math/functors/DeclHerm.h>
 #include <blaze/math/functors/DeclLow.h>
 #include <blaze/math/functors/DeclSym.h>
 #include <blaze/math/functors/DeclUpp.h>
 #include <blaze/math/functors/Noop.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
 #include <blaze/math/traits/MultTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -70,6 +82,8 @@
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
 #include <blaze/math/typetraits/IsStrictlyUpper.h>
 #include <blaze/math/typetraits/IsSymmetric.h>
@@ -92,7 +106,11 @@
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/TrueType.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/AlignmentOf.h>
+#include <blaze/util/typetraits/Decay.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
+#include <blaze/util/typetraits/IsSame.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -180,12 +198,67 @@ class SMatTDMatMultExpr
    template< typename T1, typename T2, typename T3 >
    static constexpr bool UseOptimizedKernel_v =
       ( useOptimizedKernels &&
+        !IsSlicedEllpack_v<T2> &&
         !IsDiagonal_v<T3> &&
         !IsResizable_v< ElementType_t<T1> > &&
         !IsResizable_v<ET1> );
    /*! \endcond */
    //**********************************************************************************************
 
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the left-hand side matrix is stored in sliced ELLPACK format (see the
+       IsSlicedEllpack type trait) and neither a symmetric, Hermitian, lower, nor upper result
+       is requested, the variable will be set to 1 and the chunk-wise kernel is selected.
+       Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseSlicedKernel_v =
+      ( useOptimizedKernels &&
+        IsSlicedEllpack_v<T2> &&
+        !( SYM || HERM || LOW || UPP ) &&
+        !IsResizable_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case neither the optimized nor the chunk-wise kernel can be used, the variable will
+       be set to 1 and the default kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2, typename T3 >
+   static constexpr bool UseDefaultKernel_v =
+      ( !UseOptimizedKernel_v<T1,T2,T3> && !UseSlicedKernel_v<T1,T2,T3> );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the chunk-wise kernel is used and the right-hand side dense matrix provides
+       low-level access to its columns, both operands have the same element type, and SIMD
+       gather operations are available for this element type, the variable will be set to 1
+       and the vectorized chunk-wise kernel is selected. Otherwise it will be 0. */
+   template< typename T1, typename T2 >
+   static constexpr bool UseSlicedGatherKernel_v =
+      ( IsSlicedEllpack_v<T1> && HasConstDataAccess_v<T2> &&
+        IsSame_v< ElementType_t<T1>, ElementType_t<T2> > &&
+        IsFloatingPoint_v< ElementType_t<T1> > && HasSIMDGather_v< ElementType_t<T1> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! In case the chunk-wise kernel is used and no symmetry can be exploited, the variable will
+       be set to 1 and the SMP assignment splits the chunks of the sliced ELLPACK matrix among
+       the threads. Otherwise it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseSlicedSMPAssign_v =
+      ( UseSlicedKernel_v<T1,MT1,MT2> && !CanExploitSymmetry_v<T1,MT1,MT2> );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**********************************************************************************************
    /*! \cond BLAZE_INTERNAL */
    //! Type of the functor for forwarding an expression to another assign kernel.
@@ -465,7 +538,7 @@ class SMatTDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+   static inline EnableIf_t< UseDefaultKernel_v<MT3,MT4,MT5> >
       selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       using ConstIterator = ConstIterator_t<MT4>;
@@ -769,6 +842,251 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced ELLPACK assignment to dense matrices*************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the assignment kernel for the sparse matrix-transpose dense
+   // matrix multiplication in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseSlicedKernel_v<MT3,MT4,MT5> >
+      selectAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSlicedKernel( C, A, B, 0UL, A.chunks(), Assign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Default sliced ELLPACK kernel***************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Default (compound) assignment of a range of chunks of a sliced ELLPACK
+   //        matrix-transpose dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param cbegin The index of the first chunk of the range.
+   // \param cend The index one past the last chunk of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static inline DisableIf_t< UseSlicedGatherKernel_v<MT4,MT5> >
+      selectSlicedKernel( MT3& C, const MT4& A, const MT5& B, size_t cbegin, size_t cend, OP op )
+   {
+      constexpr size_t CS( MT4::chunkSize );
+
+      const auto* const values ( A.values() );
+      const auto* const indices( A.indices() );
+      const auto* const rows   ( A.rowIndices() );
+      const auto* const lengths( A.rowLengths() );
+
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const size_t first( c*CS );
+         const size_t lanes( min( CS, M - first ) );
+
+         for( size_t l=0UL; l<lanes; ++l )
+         {
+            const size_t i( rows[first+l] );
+            const size_t nonzeros( lengths[first+l] );
+            const size_t begin( A.offset( c ) + l );
+
+            for( size_t j=0UL; j<N; ++j )
+            {
+               if( nonzeros == 0UL ) {
+                  assignElement( C(i,j), ElementType(), op );
+                  continue;
+               }
+
+               size_t pos( begin );
+               ElementType res( values[pos] * B(indices[pos],j) );
+               pos += CS;
+
+               for( size_t k=1UL; k<nonzeros; ++k, pos+=CS ) {
+                  res += values[pos] * B(indices[pos],j);
+               }
+
+               assignElement( C(i,j), res, op );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Vectorized sliced ELLPACK kernel************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Vectorized (compound) assignment of a range of chunks of a sliced ELLPACK
+   //        matrix-transpose dense matrix multiplication.
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param cbegin The index of the first chunk of the range.
+   // \param cend The index one past the last chunk of the range.
+   // \param op The (compound) assignment operation.
+   // \return void
+   //
+   // This function computes all rows of a chunk simultaneously for up to four columns of the
+   // dense matrix: For each position that is occupied in all rows of the chunk, the values
+   // are loaded once via an aligned SIMD load and the according elements of the columns are
+   // gathered via the stored column indices. The remaining elements of longer rows are added
+   // individually, i.e. the padding elements of the chunk never contribute to the result.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static inline EnableIf_t< UseSlicedGatherKernel_v<MT4,MT5> >
+      selectSlicedKernel( MT3& C, const MT4& A, const MT5& B, size_t cbegin, size_t cend, OP op )
+   {
+      using ET = ElementType_t<MT4>;
+      using IT = If_t< sizeof( typename MT4::IndexType ) == 4UL, uint32_t, size_t >;
+
+      constexpr size_t SIMDSIZE( SIMDTrait<ET>::size );
+
+      const ET* const values ( A.values() );
+      const IT* const indices( reinterpret_cast<const IT*>( A.indices() ) );
+      const auto* const rows   ( A.rowIndices() );
+      const auto* const lengths( A.rowLengths() );
+
+      const size_t M( A.rows()    );
+      const size_t N( B.columns() );
+
+      alignas( AlignmentOf_v<ET> ) ET tmp[4UL*SIMDSIZE];
+
+      for( size_t c=cbegin; c<cend; ++c )
+      {
+         const size_t first( c*SIMDSIZE );
+         const size_t lanes( min( SIMDSIZE, M - first ) );
+
+         const ET* const v( values  + A.offset( c ) );
+         const IT* const x( indices + A.offset( c ) );
+
+         size_t kmin( lengths[first] );
+         for( size_t l=1UL; l<lanes; ++l ) {
+            kmin = min( kmin, lengths[first+l] );
+         }
+
+         size_t j( 0UL );
+
+         for( ; (j+4UL) <= N; j+=4UL )
+         {
+            const ET* const b1( B.data( j     ) );
+            const ET* const b2( B.data( j+1UL ) );
+            const ET* const b3( B.data( j+2UL ) );
+            const ET* const b4( B.data( j+3UL ) );
+
+            SIMDTrait_t<ET> xmm1, xmm2, xmm3, xmm4;
+
+            for( size_t k=0UL; k<kmin; ++k ) {
+               const SIMDTrait_t<ET> a1( loada( v+k*SIMDSIZE ) );
+               const IT* const idx( x+k*SIMDSIZE );
+               xmm1 = xmm1 + ( a1 * gather( b1, idx ) );
+               xmm2 = xmm2 + ( a1 * gather( b2, idx ) );
+               xmm3 = xmm3 + ( a1 * gather( b3, idx ) );
+               xmm4 = xmm4 + ( a1 * gather( b4, idx ) );
+            }
+
+            storea( tmp             , xmm1 );
+            storea( tmp+SIMDSIZE    , xmm2 );
+            storea( tmp+SIMDSIZE*2UL, xmm3 );
+            storea( tmp+SIMDSIZE*3UL, xmm4 );
+
+            for( size_t l=0UL; l<lanes; ++l )
+            {
+               const size_t i( rows[first+l] );
+               const size_t nonzeros( lengths[first+l] );
+
+               ET res1( tmp[l             ] );
+               ET res2( tmp[l+SIMDSIZE    ] );
+               ET res3( tmp[l+SIMDSIZE*2UL] );
+               ET res4( tmp[l+SIMDSIZE*3UL] );
+
+               for( size_t k=kmin; k<nonzeros; ++k ) {
+                  const ET value( v[k*SIMDSIZE+l] );
+                  const IT index( x[k*SIMDSIZE+l] );
+                  res1 += value * b1[index];
+                  res2 += value * b2[index];
+                  res3 += value * b3[index];
+                  res4 += value * b4[index];
+               }
+
+               assignElement( C(i,j    ), res1, op );
+               assignElement( C(i,j+1UL), res2, op );
+               assignElement( C(i,j+2UL), res3, op );
+               assignElement( C(i,j+3UL), res4, op );
+            }
+         }
+
+         for( ; j<N; ++j )
+         {
+            const ET* const b1( B.data( j ) );
+
+            SIMDTrait_t<ET> xmm1;
+
+            for( size_t k=0UL; k<kmin; ++k ) {
+               xmm1 = xmm1 + ( loada( v+k*SIMDSIZE ) * gather( b1, x+k*SIMDSIZE ) );
+            }
+
+            storea( tmp, xmm1 );
+
+            for( size_t l=0UL; l<lanes; ++l )
+            {
+               const size_t nonzeros( lengths[first+l] );
+
+               ET res1( tmp[l] );
+
+               for( size_t k=kmin; k<nonzeros; ++k ) {
+                  res1 += v[k*SIMDSIZE+l] * b1[x[k*SIMDSIZE+l]];
+               }
+
+               assignElement( C(rows[first+l],j), res1, op );
+            }
+         }
+      }
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Element assignment**************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief (Compound) assignment of a single element of the target matrix.
+   //
+   // \param a The target element.
+   // \param b The value to be assigned.
+   // \return void
+   */
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, Assign ) { a = b; }
+
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, AddAssign ) { a += b; }
+
+   template< typename T1, typename T2 >
+   static inline void assignElement( T1& a, const T2& b, SubAssign ) { a -= b; }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Assignment to sparse matrices***************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Assignment of a sparse matrix-transpose dense matrix multiplication to a sparse matrix
@@ -896,7 +1214,7 @@ class SMatTDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+   static inline EnableIf_t< UseDefaultKernel_v<MT3,MT4,MT5> >
       selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       using ConstIterator = ConstIterator_t<MT4>;
@@ -1139,6 +1457,31 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced ELLPACK addition assignment to dense matrices****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Addition assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        (\f$ C+=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the addition assignment kernel for the sparse matrix-transpose dense
+   // matrix multiplication in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseSlicedKernel_v<MT3,MT4,MT5> >
+      selectAddAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSlicedKernel( C, A, B, 0UL, A.chunks(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring addition assignment***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring addition assignment of a sparse matrix-transpose dense matrix
@@ -1230,7 +1573,7 @@ class SMatTDMatMultExpr
    template< typename MT3    // Type of the left-hand side target matrix
            , typename MT4    // Type of the left-hand side matrix operand
            , typename MT5 >  // Type of the right-hand side matrix operand
-   static inline DisableIf_t< UseOptimizedKernel_v<MT3,MT4,MT5> >
+   static inline EnableIf_t< UseDefaultKernel_v<MT3,MT4,MT5> >
       selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
    {
       using ConstIterator = ConstIterator_t<MT4>;
@@ -1473,6 +1816,31 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced ELLPACK subtraction assignment to dense matrices*************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Subtraction assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        (\f$ C-=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \return void
+   //
+   // This function implements the subtraction assignment kernel for the sparse matrix-transpose dense
+   // matrix multiplication in case the sparse matrix is stored in sliced ELLPACK format.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5 >  // Type of the right-hand side matrix operand
+   static inline EnableIf_t< UseSlicedKernel_v<MT3,MT4,MT5> >
+      selectSubAssignKernel( MT3& C, const MT4& A, const MT5& B )
+   {
+      selectSlicedKernel( C, A, B, 0UL, A.chunks(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring subtraction assignment********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring subtraction assignment of a sparse matrix-transpose dense matrix
@@ -1593,6 +1961,93 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced SMP assignment***********************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP (compound) assignment of a sliced ELLPACK matrix-transpose dense matrix
+   //        multiplication to a dense matrix (\f$ C=A*B \f$).
+   // \ingroup dense_matrix
+   //
+   // \param C The target left-hand side dense matrix.
+   // \param A The left-hand side multiplication operand.
+   // \param B The right-hand side multiplication operand.
+   // \param op The (compound) assignment operation.
+   // \param parallel \a true in case the multiplication is large enough for a parallel execution.
+   // \return void
+   //
+   // This function implements the SMP (compound) assignment of a sliced ELLPACK matrix-transpose
+   // dense matrix multiplication. Since the rows of a sliced ELLPACK matrix are permuted within
+   // their chunks, the work is split along the chunks: Each thread computes a range of chunks
+   // with roughly the same number of stored elements and writes the results to the according
+   // rows of the target matrix. In case the parallel execution is not possible, the chunks are
+   // computed serially.
+   */
+   template< typename MT3    // Type of the left-hand side target matrix
+           , typename MT4    // Type of the left-hand side matrix operand
+           , typename MT5    // Type of the right-hand side matrix operand
+           , typename OP >   // Type of the assignment operation
+   static inline void smpAssignSliced( MT3& C, const MT4& A, const MT5& B, OP op, bool parallel )
+   {
+      if( !IsSMPAssignable_v<MT3> || !IsSMPAssignable_v<MT5> || !parallel ||
+          isSerialSectionActive() || isParallelSectionActive() ) {
+         selectSlicedKernel( C, A, B, 0UL, A.chunks(), op );
+         return;
+      }
+
+      const size_t threads( getNumThreads() );
+
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionChunks( A, threads, bounds.get() );
+
+      smpFor( threads, [&]( size_t i )
+      {
+         if( bounds[i] == bounds[i+1UL] ) return;
+         selectSlicedKernel( C, A, B, bounds[i], bounds[i+1UL], op );
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Sliced SMP assignment to dense matrices*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the SMP assignment of a sparse matrix-transpose dense matrix
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense matrix. Due to
+   // the explicit application of the SFINAE principle this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format and no symmetry
+   // can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<MT> >
+      smpAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignSliced( ~lhs, A, B, Assign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse matrices***********************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a sparse matrix-transpose dense matrix multiplication to a sparse
@@ -1708,6 +2163,47 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced SMP addition assignment to dense matrices********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP addition assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A+=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the SMP addition assignment of a sparse matrix-transpose dense matrix
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense matrix. Due to
+   // the explicit application of the SFINAE principle this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format and no symmetry
+   // can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<MT> >
+      smpAddAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignSliced( ~lhs, A, B, AddAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP addition assignment*******************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP addition assignment of a sparse matrix-transpose dense matrix
@@ -1785,6 +2281,47 @@ class SMatTDMatMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Sliced SMP subtraction assignment to dense matrices*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief SMP subtraction assignment of a sliced ELLPACK matrix-transpose dense matrix multiplication
+   //        to a dense matrix (\f$ A-=B*C \f$).
+   // \ingroup dense_matrix
+   //
+   // \param lhs The target left-hand side dense matrix.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the SMP subtraction assignment of a sparse matrix-transpose dense matrix
+   // multiplication expression with a sliced ELLPACK matrix operand to a dense matrix. Due to
+   // the explicit application of the SFINAE principle this function can only be selected by
+   // the compiler in case the sparse matrix is stored in sliced ELLPACK format and no symmetry
+   // can be exploited.
+   */
+   template< typename MT  // Type of the target dense matrix
+           , bool SO >    // Storage order of the target dense matrix
+   friend inline EnableIf_t< UseSlicedSMPAssign_v<MT> >
+      smpSubAssign( DenseMatrix<MT,SO>& lhs, const SMatTDMatMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).rows()    == rhs.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( (~lhs).columns() == rhs.columns(), "Invalid number of columns" );
+
+      LT A( rhs.lhs_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT B( rhs.rhs_ );  // Evaluation of the right-hand side dense matrix operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.lhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.lhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( B.rows()    == rhs.rhs_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == rhs.rhs_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).rows()     , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( B.columns() == (~lhs).columns()  , "Invalid number of columns" );
+
+      smpAssignSliced( ~lhs, A, B, SubAssign(), rhs.canSMPAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Restructuring SMP subtraction assignment****************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief Restructuring SMP subtraction assignment of a sparse matrix-transpose dense matrix
@@ -44,6 +44,7 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/functors/Abs.h>
+#include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Cbrt.h>
 #include <blaze/math/functors/L1Norm.h>
 #include <blaze/math/functors/L2Norm.h>
@@ -60,8 +61,11 @@
 #include <blaze/math/shims/Evaluate.h>
 #include <blaze/math/shims/Invert.h>
 #include <blaze/math/shims/IsZero.h>
+#include <blaze/math/smp/Reduction.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/UnderlyingBuiltin.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/StaticAssert.h>
@@ -76,6 +80,48 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the norm of a sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the norm computation.
+// \param abs The functor for the abs operation.
+// \param power The functor for the power operation.
+// \return The sum of the powers of the absolute values of the non-zero elements.
+//
+// This function serially computes the sum of the powers of the absolute values of all non-zero
+// elements of the given sparse vector, i.e. the norm before the application of the root.
+*/
+template< typename VT       // Type of the sparse vector
+        , bool TF           // Transpose flag
+        , typename Abs      // Type of the abs operation
+        , typename Power >  // Type of the power operation
+inline ElementType_t<VT> svecnorm( const SparseVector<VT,TF>& sv, Abs abs, Power power )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   CT tmp( ~sv );
+
+   const auto end( tmp.end() );
+   auto element( tmp.begin() );
+
+   if( element == end ) return ET();
+
+   ET norm( power( abs( element->value() ) ) );
+   ++element;
+
+   for( ; element!=end; ++element ) {
+      norm += power( abs( element->value() ) );
+   }
+
+   return norm;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Computes a custom norm for the given sparse vector.
@@ -96,6 +142,9 @@ namespace blaze {
    // ... Resizing and initialization
    const double l2 = norm( a, blaze::Noop(), blaze::Pow2(), blaze::Sqrt() );
    \endcode
+
+// In case the vector contains at least \c BLAZE_SMP_SVECREDUCE_THRESHOLD non-zero elements and
+// the shared memory parallelization is active, the norm is computed in parallel.
 */
 template< typename VT      // Type of the sparse vector
         , bool TF          // Transpose flag
@@ -110,19 +159,15 @@ decltype(auto) norm_backend( const SparseVector<VT,TF>& sv, Abs abs, Power power
 
    if( (~sv).size() == 0UL ) return RT();
 
-   CT tmp( ~sv );
-
-   const auto end( tmp.end() );
-   auto element( tmp.begin() );
-
-   if( element == end ) return RT();
+   if( (~sv).nonZeros() < SMP_SVECREDUCE_THRESHOLD ) {
+      return evaluate( root( svecnorm( ~sv, abs, power ) ) );
+   }
 
-   ET norm( power( abs( element->value() ) ) );
-   ++element;
+   CT tmp( ~sv );
 
-   for( ; element!=end; ++element ) {
-      norm += power( abs( element->value() ) );
-   }
+   const ET norm( smpReduce( tmp.size(), 1UL, [&]( size_t index, size_t size ) {
+      return svecnorm( subvector( tmp, index, size, unchecked ), abs, power );
+   }, Add() ) );
 
    return evaluate( root( norm ) );
 }
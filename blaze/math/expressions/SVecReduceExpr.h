@@ -40,12 +40,16 @@
 // Includes
 //*************************************************************************************************
 
+#include <utility>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/functors/Add.h>
 #include <blaze/math/functors/Max.h>
 #include <blaze/math/functors/Min.h>
 #include <blaze/math/functors/Mult.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/views/Check.h>
+#include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/Types.h>
@@ -60,6 +64,49 @@ namespace blaze {
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the reduction of a sparse vector.
+// \ingroup sparse_vector
+//
+// \param sv The given sparse vector for the reduction computation.
+// \param op The reduction operation.
+// \return The result of the reduction and whether the vector contains any non-zero element.
+//
+// This function serially reduces the non-zero elements of the given sparse vector. In addition
+// to the result of the reduction it reports whether the vector contains any non-zero element
+// at all, which enables the correct combination of the results of several parts of a vector.
+*/
+template< typename VT    // Type of the sparse vector
+        , bool TF        // Transpose flag
+        , typename OP >  // Type of the reduction operation
+inline std::pair< ElementType_t<VT>, bool > svecreduce( const SparseVector<VT,TF>& sv, OP op )
+{
+   using CT = CompositeType_t<VT>;
+   using ET = ElementType_t<VT>;
+
+   CT tmp( ~sv );
+
+   BLAZE_INTERNAL_ASSERT( tmp.size() == (~sv).size(), "Invalid vector size" );
+
+   const auto end( tmp.end() );
+   auto element( tmp.begin() );
+
+   if( element == end ) return std::make_pair( ET{}, false );
+
+   ET redux( element->value() );
+   ++element;
+
+   for( ; element!=end; ++element ) {
+      redux = op( redux, element->value() );
+   }
+
+   return std::make_pair( redux, true );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Performs a custom reduction operation on the given sparse vector.
 // \ingroup sparse_vector
@@ -83,6 +130,11 @@ namespace blaze {
 // operation. See \ref custom_operations for a detailed overview of the possibilities of custom
 // operations.
 //
+// In case the vector contains at least \c BLAZE_SMP_SVECREDUCE_THRESHOLD non-zero elements and
+// the shared memory parallelization is active, the reduction is performed in parallel. Each
+// thread reduces the non-zero elements of a contiguous range of the vector and the partial
+// results are combined in a fixed order.
+//
 // Please note that the evaluation order of the reduction operation is unspecified. Thus the
 // behavior is non-deterministic if \a op is not associative or not commutative. Also, the
 // operation is undefined if the given reduction operation modifies the values.
@@ -96,26 +148,24 @@ inline decltype(auto) reduce( const SparseVector<VT,TF>& sv, OP op )
 
    using CT = CompositeType_t<VT>;
    using ET = ElementType_t<VT>;
+   using PT = std::pair<ET,bool>;
 
    if( (~sv).size() == 0UL ) return ET{};
 
-   CT tmp( ~sv );
-
-   BLAZE_INTERNAL_ASSERT( tmp.size() == (~sv).size(), "Invalid vector size" );
-
-   const auto end( tmp.end() );
-   auto element( tmp.begin() );
-
-   if( element == end ) return ET{};
+   if( (~sv).nonZeros() < SMP_SVECREDUCE_THRESHOLD ) {
+      const PT redux( svecreduce( ~sv, op ) );
+      return redux.first;
+   }
 
-   ET redux( element->value() );
-   ++element;
+   CT tmp( ~sv );
 
-   for( ; element!=end; ++element ) {
-      redux = op( redux, element->value() );
-   }
+   const PT redux( smpReduce( tmp.size(), 1UL, [&]( size_t index, size_t size ) {
+      return svecreduce( subvector( tmp, index, size, unchecked ), op );
+   }, [op]( const PT& lhs, const PT& rhs ) {
+      return ( !lhs.second )?( rhs ):( !rhs.second )?( lhs ):( PT( op( lhs.first, rhs.first ), true ) );
+   } ) );
 
-   return redux;
+   return redux.first;
 }
 //*************************************************************************************************
 
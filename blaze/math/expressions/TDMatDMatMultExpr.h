@@ -79,6 +79,7 @@
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsHermitian.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -13115,6 +13116,64 @@ class DMatScalarMultExpr< TDMatDMatMultExpr<MT1,MT2,SF,HF,LF,UF>, ST, true >
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a column-major dense matrix and a
+//        row-major dense matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side column-major dense matrix for the multiplication.
+// \param rhs The right-hand side row-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the default treatment of the multiplication of a column-major dense
+// matrix and a row-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , DisableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const TDMatDMatMultExpr<MT1,MT2,false,false,false,false>
+   tdmatdmatmult( const DenseMatrix<MT1,true>& lhs, const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return TDMatDMatMultExpr<MT1,MT2,false,false,false,false>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a column-major dense matrix with packed
+//        storage and a row-major dense matrix (\f$ A=B*C \f$).
+// \ingroup dense_matrix
+//
+// \param lhs The left-hand side column-major packed dense matrix for the multiplication.
+// \param rhs The right-hand side row-major dense matrix for the multiplication.
+// \return The resulting matrix.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// column-major dense matrix with packed storage (see PackedMatrix) and a row-major dense matrix.
+*/
+template< typename MT1  // Type of the left-hand side dense matrix
+        , typename MT2  // Type of the right-hand side dense matrix
+        , EnableIf_t< IsPacked_v<MT1> >* = nullptr >
+inline const PMatDMatMultExpr<MT1,MT2,true>
+   tdmatdmatmult( const DenseMatrix<MT1,true>& lhs, const DenseMatrix<MT2,false>& rhs )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).rows(), "Invalid matrix sizes" );
+
+   return PMatDMatMultExpr<MT1,MT2,true>( ~lhs, ~rhs );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a column-major dense matrix and a
 //        row-major dense matrix (\f$ A=B*C \f$).
@@ -13156,8 +13215,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   using ReturnType = const TDMatDMatMultExpr<MT1,MT2,false,false,false,false>;
-   return ReturnType( ~lhs, ~rhs );
+   return tdmatdmatmult( ~lhs, ~rhs );
 }
 //*************************************************************************************************
 
@@ -50,6 +50,7 @@
 #include <blaze/math/constraints/MatMatMultExpr.h>
 #include <blaze/math/constraints/MatVecMultExpr.h>
 #include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/dense/DispatchKernels.h>
 #include <blaze/math/Exception.h>
 #include <blaze/math/expressions/Computation.h>
 #include <blaze/math/expressions/DenseVector.h>
@@ -71,6 +72,7 @@
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsPadded.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -770,6 +772,11 @@ class TDMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1366,6 +1373,11 @@ class TDMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -1937,6 +1949,11 @@ class TDMatDVecMultExpr
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-1), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -3110,6 +3127,11 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(0) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -3668,6 +3690,11 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeAddAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -4201,6 +4228,11 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
    static inline EnableIf_t< UseVectorizedDefaultKernel_v<VT1,MT1,VT2,ST2> >
       selectLargeSubAssignKernel( VT1& y, const MT1& A, const VT2& x, ST2 scalar )
    {
+      using ET = ElementType_t<VT1>;
+
+      if( dispatchGemv( y, A, x, ET(-scalar), ET(1) ) )
+         return;
+
       constexpr bool remainder( !IsPadded_v<MT1> || !IsPadded_v<VT1> );
 
       const size_t M( A.rows()    );
@@ -4718,6 +4750,64 @@ class DVecScalarMultExpr< TDMatDVecMultExpr<MT,VT>, ST, false >
 //
 //=================================================================================================
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a column-major dense matrix and a dense
+//        vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side column-major dense matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+//
+// This function implements the default treatment of the multiplication of a column-major dense
+// matrix and a dense vector.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , DisableIf_t< IsPacked_v<MT> >* = nullptr >
+inline const TDMatDVecMultExpr<MT,VT>
+   tdmatdvecmult( const DenseMatrix<MT,true>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~mat).columns() == (~vec).size(), "Invalid matrix and vector sizes" );
+
+   return TDMatDVecMultExpr<MT,VT>( ~mat, ~vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of the multiplication of a column-major dense matrix with packed
+//        storage and a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+// \ingroup dense_vector
+//
+// \param mat The left-hand side column-major packed dense matrix for the multiplication.
+// \param vec The right-hand side dense vector for the multiplication.
+// \return The resulting vector.
+//
+// This function implements the performance optimized treatment of the multiplication of a
+// column-major dense matrix with packed storage (see PackedMatrix) and a dense vector.
+*/
+template< typename MT  // Type of the left-hand side dense matrix
+        , typename VT  // Type of the right-hand side dense vector
+        , EnableIf_t< IsPacked_v<MT> >* = nullptr >
+inline const PMatDVecMultExpr<MT,VT>
+   tdmatdvecmult( const DenseMatrix<MT,true>& mat, const DenseVector<VT,false>& vec )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   BLAZE_INTERNAL_ASSERT( (~mat).columns() == (~vec).size(), "Invalid matrix and vector sizes" );
+
+   return PMatDVecMultExpr<MT,VT>( ~mat, ~vec );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Multiplication operator for the multiplication of a column-major dense matrix and a dense
 //        vector (\f$ \vec{y}=A*\vec{x} \f$).
@@ -4762,8 +4852,7 @@ inline decltype(auto)
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
    }
 
-   using ReturnType = const TDMatDVecMultExpr<MT,VT>;
-   return ReturnType( ~mat, ~vec );
+   return tdmatdvecmult( ~mat, ~vec );
 }
 //*************************************************************************************************
 
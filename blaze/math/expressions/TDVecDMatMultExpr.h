@@ -92,6 +92,7 @@
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/IntegralConstant.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsBuiltin.h>
@@ -444,10 +445,26 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectSmallAssignKernel" )
+                               :( "TDVecDMatMultExpr::selectDefaultAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectSmallAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                                  ?( "TDVecDMatMultExpr::selectLargeAssignKernel" )
+                                  :( "TDVecDMatMultExpr::selectDefaultAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectBlasAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1046,10 +1063,26 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectSmallAddAssignKernel" )
+                               :( "TDVecDMatMultExpr::selectDefaultAddAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallAddAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                                  ?( "TDVecDMatMultExpr::selectLargeAddAssignKernel" )
+                                  :( "TDVecDMatMultExpr::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasAddAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -1615,10 +1648,26 @@ class TDVecDMatMultExpr
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectSmallSubAssignKernel" )
+                               :( "TDVecDMatMultExpr::selectDefaultSubAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallSubAssignKernel( y, x, A );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1> )
+                               ?( "TDVecDMatMultExpr::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1> )
+                                  ?( "TDVecDMatMultExpr::selectLargeSubAssignKernel" )
+                                  :( "TDVecDMatMultExpr::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasSubAssignKernel( y, x, A );
+      }
    }
    /*! \endcond */
    //**********************************************************************************************
@@ -2773,10 +2822,26 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectSmallAssignKernel" )
+                               :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectSmallAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectBlasAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                                  ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectLargeAssignKernel" )
+                                  :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + y.size() )
+                             , 1UL );
          selectBlasAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -3384,10 +3449,26 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectSmallAddAssignKernel" )
+                               :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultAddAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallAddAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectBlasAddAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                                  ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectLargeAddAssignKernel" )
+                                  :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultAddAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasAddAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -3917,10 +3998,26 @@ class DVecScalarMultExpr< TDVecDMatMultExpr<VT,MT>, ST, true >
    {
       if( ( IsDiagonal_v<MT1> ) ||
           ( IsComputation_v<MT> && !evaluateMatrix ) ||
-          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) )
+          ( A.rows() * A.columns() < TDVECDMATMULT_THRESHOLD ) ) {
+         BLAZE_KERNEL_PROFILE( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectSmallSubAssignKernel" )
+                               :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultSubAssignKernel" )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectSmallSubAssignKernel( y, x, A, scalar );
-      else
+      }
+      else {
+         BLAZE_KERNEL_PROFILE( ( UseBlasKernel_v<VT1,VT2,MT1,ST2> )
+                               ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectBlasSubAssignKernel" )
+                               :( ( UseVectorizedDefaultKernel_v<VT1,VT2,MT1,ST2> )
+                                  ?( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectLargeSubAssignKernel" )
+                                  :( "DVecScalarMultExpr<TDVecDMatMultExpr>::selectDefaultSubAssignKernel" ) )
+                             , A.rows(), A.columns(), 0UL, 2UL*A.rows()*A.columns()
+                             , sizeof( ElementType_t<VT1> )*( A.rows()*A.columns() + x.size() + 2UL*y.size() )
+                             , 1UL );
          selectBlasSubAssignKernel( y, x, A, scalar );
+      }
    }
    //**********************************************************************************************
 
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/ColumnMajorMatrix.h>
 #include <blaze/math/constraints/ColumnVector.h>
@@ -55,14 +56,23 @@
 #include <blaze/math/expressions/DenseVector.h>
 #include <blaze/math/expressions/Forward.h>
 #include <blaze/math/expressions/MatVecMultExpr.h>
+#include <blaze/math/functors/AddAssign.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
 #include <blaze/math/shims/Serial.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
 #include <blaze/math/traits/MultTrait.h>
 #include <blaze/math/typetraits/IsAligned.h>
 #include <blaze/math/typetraits/IsComputation.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
 #include <blaze/math/typetraits/IsExpression.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
 #include <blaze/math/typetraits/IsLower.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsStrictlyLower.h>
@@ -71,13 +81,16 @@
 #include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/math/typetraits/RequiresEvaluation.h>
 #include <blaze/math/views/Check.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/algorithms/Min.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
 #include <blaze/util/typetraits/RemoveReference.h>
 
 
@@ -299,6 +312,20 @@ class TSMatDVecMultExpr
    //**********************************************************************************************
 
  private:
+   //**********************************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! This variable template is a helper for the selection of the nonzero-balanced parallel
+       evaluation strategy. In case the balanced scheduling is enabled and both the target vector
+       and the (evaluated) operands are SMP assignable, the variable will be set to 1, otherwise
+       it will be 0. */
+   template< typename T1 >
+   static constexpr bool UseBalancedSMPAssign_v =
+      ( useBalancedSpMV && IsSMPAssignable_v<T1> &&
+        IsSMPAssignable_v< Decay_t<LT> > && IsSMPAssignable_v< Decay_t<RT> > );
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**Member variables****************************************************************************
    LeftOperand  mat_;  //!< Left-hand side sparse matrix of the multiplication expression.
    RightOperand vec_;  //!< Right-hand side dense vector of the multiplication expression.
@@ -639,7 +666,7 @@ class TSMatDVecMultExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename VT2 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT2> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT2> && !UseBalancedSMPAssign_v<VT2> >
       smpAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -663,6 +690,128 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Balanced SMP assignment to dense vectors****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP (compound) assignment of a transpose sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param y The target left-hand side dense vector.
+   // \param A The left-hand side sparse matrix operand.
+   // \param x The right-hand side dense vector operand.
+   // \param op The (compound) assignment operation for the first partial result.
+   // \param combine The compound assignment operation for all further partial results.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP (compound) assignment of a transpose
+   // sparse matrix-dense vector multiplication. The columns of the sparse matrix are split into
+   // one partition per thread such that each partition contains roughly the same number of
+   // non-zero elements. Each thread scatters the product of its columns into a private
+   // accumulator vector, which avoids any synchronization on the elements of the target vector.
+   // Afterwards the private accumulators are combined in parallel by equally sized ranges of
+   // the target vector. Note that this strategy requires one temporary vector per thread.
+   */
+   template< typename VT1    // Type of the left-hand side target vector
+           , typename MT1    // Type of the left-hand side matrix operand
+           , typename VT2    // Type of the right-hand side vector operand
+           , typename OP1    // Type of the assignment operation
+           , typename OP2 >  // Type of the combination operation
+   static inline void smpAssignBalanced( VT1& y, const MT1& A, const VT2& x, OP1 op, OP2 combine )
+   {
+      const size_t threads( getNumThreads() );
+
+      std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+      partitionNonZeros( A, threads, bounds.get() );
+
+      std::unique_ptr<ResultType[]> partials( new ResultType[threads] );
+
+      smpFor( threads, [&]( size_t i )
+      {
+         const size_t index( bounds[i] );
+         const size_t n( bounds[i+1UL] - index );
+
+         if( n == 0UL ) return;
+
+         partials[i].resize( A.rows(), false );
+         assign( partials[i], submatrix( A, 0UL, index, A.rows(), n, unchecked ) *
+                              subvector( x, index, n, unchecked ) );
+      } );
+
+      const size_t addon        ( ( ( y.size() % threads ) != 0UL )? 1UL : 0UL );
+      const size_t sizePerThread( y.size() / threads + addon );
+
+      smpFor( threads, [&]( size_t i )
+      {
+         const size_t index( i*sizePerThread );
+
+         if( index >= y.size() ) return;
+
+         const size_t n( min( sizePerThread, y.size() - index ) );
+         auto target( subvector( y, index, n, unchecked ) );
+         bool first( true );
+
+         for( size_t j=0UL; j<threads; ++j )
+         {
+            if( bounds[j+1UL] == bounds[j] ) continue;
+
+            const auto source( subvector( partials[j], index, n, unchecked ) );
+
+            if( first ) op( target, source );
+            else combine( target, source );
+
+            first = false;
+         }
+      } );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
+   //**Balanced SMP assignment to dense vectors*****************************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP assignment of a transpose sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be assigned.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP assignment of a transpose sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the nonzero-balanced parallel evaluation strategy is selected.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT2> >
+      smpAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         reset( ~lhs );
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         assign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, Assign(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP assignment to sparse vectors************************************************************
    /*! \cond BLAZE_INTERNAL */
    /*!\brief SMP assignment of a transpose sparse matrix-dense vector multiplication to a sparse
@@ -712,7 +861,7 @@ class TSMatDVecMultExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename VT2 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT2> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT2> && !UseBalancedSMPAssign_v<VT2> >
       smpAddAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -734,6 +883,51 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Balanced SMP addition assignment to dense vectors********************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP addition assignment of a transpose sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}+=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be added.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP addition assignment of a transpose sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the nonzero-balanced parallel evaluation strategy is selected.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT2> >
+      smpAddAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         addAssign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, AddAssign(), AddAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP addition assignment to sparse vectors***************************************************
    // No special implementation for the SMP addition assignment to sparse vectors.
    //**********************************************************************************************
@@ -754,7 +948,7 @@ class TSMatDVecMultExpr
    // in case the expression specific parallel evaluation strategy is selected.
    */
    template< typename VT2 >  // Type of the target dense vector
-   friend inline EnableIf_t< UseSMPAssign_v<VT2> >
+   friend inline EnableIf_t< UseSMPAssign_v<VT2> && !UseBalancedSMPAssign_v<VT2> >
       smpSubAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
    {
       BLAZE_FUNCTION_TRACE;
@@ -776,6 +970,51 @@ class TSMatDVecMultExpr
    /*! \endcond */
    //**********************************************************************************************
 
+   //**Balanced SMP subtraction assignment to dense vectors*****************************************
+   /*! \cond BLAZE_INTERNAL */
+   /*!\brief Nonzero-balanced SMP subtraction assignment of a transpose sparse matrix-dense vector
+   //        multiplication to a dense vector (\f$ \vec{y}-=A*\vec{x} \f$).
+   // \ingroup dense_vector
+   //
+   // \param lhs The target left-hand side dense vector.
+   // \param rhs The right-hand side multiplication expression to be subtracted.
+   // \return void
+   //
+   // This function implements the nonzero-balanced SMP subtraction assignment of a transpose sparse
+   // matrix-dense vector multiplication expression to a dense vector. Due to the explicit
+   // application of the SFINAE principle, this function can only be selected by the compiler
+   // in case the nonzero-balanced parallel evaluation strategy is selected.
+   */
+   template< typename VT2 >  // Type of the target dense vector
+   friend inline EnableIf_t< UseBalancedSMPAssign_v<VT2> >
+      smpSubAssign( DenseVector<VT2,false>& lhs, const TSMatDVecMultExpr& rhs )
+   {
+      BLAZE_FUNCTION_TRACE;
+
+      BLAZE_INTERNAL_ASSERT( (~lhs).size() == rhs.size(), "Invalid vector sizes" );
+
+      if( rhs.mat_.columns() == 0UL ) {
+         return;
+      }
+
+      LT A( rhs.mat_ );  // Evaluation of the left-hand side sparse matrix operand
+      RT x( rhs.vec_ );  // Evaluation of the right-hand side dense vector operand
+
+      BLAZE_INTERNAL_ASSERT( A.rows()    == rhs.mat_.rows()   , "Invalid number of rows"    );
+      BLAZE_INTERNAL_ASSERT( A.columns() == rhs.mat_.columns(), "Invalid number of columns" );
+      BLAZE_INTERNAL_ASSERT( x.size()    == rhs.vec_.size()   , "Invalid vector size"       );
+      BLAZE_INTERNAL_ASSERT( A.rows()    == (~lhs).size()     , "Invalid vector size"       );
+
+      if( isSerialSectionActive() || isParallelSectionActive() || !rhs.canSMPAssign() ) {
+         subAssign( ~lhs, A * x );
+         return;
+      }
+
+      smpAssignBalanced( ~lhs, A, x, SubAssign(), SubAssign() );
+   }
+   /*! \endcond */
+   //**********************************************************************************************
+
    //**SMP subtraction assignment to sparse vectors************************************************
    // No special implementation for the SMP subtraction assignment to sparse vectors.
    //**********************************************************************************************
@@ -0,0 +1,532 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/serialization/MappedArchive.h
+//  \brief Memory mapped archive for the zero-copy deserialization of vectors and matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+#define _BLAZE_MATH_SERIALIZATION_MAPPEDARCHIVE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Platform.h>
+#if BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+#  include <fstream>
+#else
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+#include <cstring>
+#include <string>
+#include <blaze/math/dense/CustomMatrix.h>
+#include <blaze/math/dense/CustomVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/PaddingFlag.h>
+#include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/sparse/MappedCompressedMatrix.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Memory mapped archive for the zero-copy deserialization of vectors and matrices.
+// \ingroup serialization
+//
+// The MappedArchive class provides read-only access to a binary archive file, which has been
+// written by means of the Archive class. Instead of reading the file, the archive maps the
+// file into memory. Vectors and matrices with elements of built-in or complex data type, which
+// are written in the version 2 format of the VectorSerializer and MatrixSerializer, can then be
+// deserialized without copying any element: Dense vectors and matrices are reconstituted as
+// unpadded CustomVector and CustomMatrix of constant element type, sparse matrices are
+// reconstituted as MappedCompressedMatrix. The following example demonstrates this by means of
+// a dense and a sparse matrix:
+
+   \code
+   using blaze::CustomMatrix;
+   using blaze::MappedCompressedMatrix;
+   using blaze::unaligned;
+   using blaze::unpadded;
+   using blaze::rowMajor;
+
+   // Serialization of a dense and a sparse matrix into the file 'filename'
+   {
+      blaze::DynamicMatrix<double,rowMajor> D;
+      blaze::CompressedMatrix<double,rowMajor> S;
+      // ... Resizing and initialization
+      blaze::Archive<std::ofstream> archive( "filename" );
+      archive << D << S;
+   }
+
+   // Mapping both matrices without copying any element
+   {
+      blaze::MappedArchive archive( "filename" );
+      CustomMatrix<const double,unaligned,unpadded,rowMajor> D;
+      MappedCompressedMatrix<double,rowMajor> S;
+      archive >> D >> S;
+      // ... D and S can be used as long as the archive exists
+   }
+   \endcode
+
+// Note that the storage order, the element type and the type (dense or sparse) of the target
+// vector or matrix must exactly match the serialized object. In case of a mismatch or in case
+// the archive is corrupt a \a std::runtime_error exception is thrown. On POSIX platforms the
+// file is mapped via \c mmap(), on all other platforms the file is read into an aligned buffer
+// instead. In both cases all reconstituted vectors and matrices refer to the memory of the
+// archive and therefore must not be used after the archive has been destroyed!
+*/
+class MappedArchive
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline MappedArchive( const std::string& filename );
+
+   MappedArchive( const MappedArchive& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~MappedArchive();
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   MappedArchive& operator=( const MappedArchive& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+   //**Deserialization operators*******************************************************************
+   /*!\name Deserialization operators */
+   //@{
+   template< typename Type, bool AF, bool TF, typename RT >
+   MappedArchive& operator>>( CustomVector<const Type,AF,unpadded,TF,RT>& vec );
+
+   template< typename Type, bool AF, bool SO, typename RT >
+   MappedArchive& operator>>( CustomMatrix<const Type,AF,unpadded,SO,RT>& mat );
+
+   template< typename Type, bool SO >
+   MappedArchive& operator>>( MappedCompressedMatrix<Type,SO>& mat );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size    () const noexcept;
+   inline size_t position() const noexcept;
+   inline bool   eof     () const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void readHeader( uint8_t type, uint64_t* values, size_t count );
+
+   template< typename Type >
+   const Type* map( size_t count );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static constexpr size_t alignment = 64UL;  //!< Alignment of all blocks of a version 2 archive.
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   const byte_t* data_;      //!< The memory of the mapped archive.
+   size_t        size_;      //!< The size of the mapped archive in bytes.
+   size_t        position_;  //!< The current read position within the mapped archive.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a memory mapped archive for the given file.
+//
+// \param filename The name of the archive file.
+// \exception std::runtime_error Archive file could not be mapped.
+*/
+inline MappedArchive::MappedArchive( const std::string& filename )
+   : data_    ( nullptr )  // The memory of the mapped archive
+   , size_    ( 0UL )      // The size of the mapped archive in bytes
+   , position_( 0UL )      // The current read position within the mapped archive
+{
+#if BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+   std::ifstream file( filename, std::ifstream::binary | std::ifstream::ate );
+
+   if( !file ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( file.tellg() );
+
+   if( size_ > 0UL )
+   {
+      byte_t* buffer( allocate<byte_t>( size_ ) );
+
+      file.seekg( 0 );
+      if( !file.read( reinterpret_cast<char*>( buffer ), size_ ) ) {
+         deallocate( buffer );
+         BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be mapped" );
+      }
+
+      data_ = buffer;
+   }
+#else
+   const int fd( ::open( filename.c_str(), O_RDONLY ) );
+
+   if( fd == -1 ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be mapped" );
+   }
+
+   struct stat info;
+
+   if( ::fstat( fd, &info ) != 0 ) {
+      ::close( fd );
+      BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be mapped" );
+   }
+
+   size_ = static_cast<size_t>( info.st_size );
+
+   if( size_ > 0UL )
+   {
+      void* address( ::mmap( nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0 ) );
+
+      if( address == MAP_FAILED ) {
+         ::close( fd );
+         BLAZE_THROW_RUNTIME_ERROR( "Archive file could not be mapped" );
+      }
+
+      data_ = static_cast<const byte_t*>( address );
+   }
+
+   ::close( fd );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor of the MappedArchive class.
+//
+// The destructor unmaps the archive file. All vectors and matrices that have been reconstituted
+// from the archive become invalid.
+*/
+inline MappedArchive::~MappedArchive()
+{
+   if( data_ == nullptr ) return;
+
+#if BLAZE_WIN64_PLATFORM || BLAZE_MINGW64_PLATFORM || BLAZE_MINGW32_PLATFORM
+   deallocate( const_cast<byte_t*>( data_ ) );
+#else
+   ::munmap( const_cast<byte_t*>( data_ ), size_ );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESERIALIZATION OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Reconstitutes a dense vector from the archive without copying its elements.
+//
+// \param vec The custom vector to be reconstituted.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+*/
+template< typename Type  // Data type of the vector
+        , bool AF        // Alignment flag
+        , bool TF        // Transpose flag
+        , typename RT >  // Result type
+MappedArchive& MappedArchive::operator>>( CustomVector<const Type,AF,unpadded,TF,RT>& vec )
+{
+   uint64_t values[2];  // The size and the number of elements of the vector
+
+   readHeader<Type>( 0U, values, 2UL );
+
+   if( values[1] != values[0] ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const Type* const ptr( map<Type>( values[0] ) );
+
+   vec.reset( ptr, values[0] );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reconstitutes a dense matrix from the archive without copying its elements.
+//
+// \param mat The custom matrix to be reconstituted.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+*/
+template< typename Type  // Data type of the matrix
+        , bool AF        // Alignment flag
+        , bool SO        // Storage order
+        , typename RT >  // Result type
+MappedArchive& MappedArchive::operator>>( CustomMatrix<const Type,AF,unpadded,SO,RT>& mat )
+{
+   uint64_t values[3];  // The number of rows, columns and elements of the matrix
+
+   readHeader<Type>( SO ? 5U : 1U, values, 3UL );
+
+   if( values[2] != values[0]*values[1] ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const Type* const ptr( map<Type>( values[2] ) );
+
+   mat.reset( ptr, values[0], values[1] );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reconstitutes a sparse matrix from the archive without copying its elements.
+//
+// \param mat The mapped compressed matrix to be reconstituted.
+// \return Reference to the archive.
+// \exception std::runtime_error Error during deserialization.
+//
+// This function maps the compressed arrays of a sparse matrix with the same storage order. In
+// order to guarantee that the resulting matrix can be safely used in all operations, all offsets
+// and indices are verified. In case the offsets or indices are inconsistent, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+MappedArchive& MappedArchive::operator>>( MappedCompressedMatrix<Type,SO>& mat )
+{
+   uint64_t values[3];  // The number of rows, columns and non-zero elements of the matrix
+
+   readHeader<Type>( SO ? 7U : 3U, values, 3UL );
+
+   const size_t major( SO ? values[1] : values[0] );
+   const size_t minor( SO ? values[0] : values[1] );
+
+   if( values[2] > values[0]*values[1] ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   const uint64_t* const offsets( map<uint64_t>( major+1UL ) );
+   const uint64_t* const indices( map<uint64_t>( values[2] ) );
+   const Type*     const nonzeros( map<Type>( values[2] ) );
+
+   if( offsets[0UL] != 0UL || offsets[major] != values[2] ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   for( size_t i=0UL; i<major; ++i ) {
+      if( offsets[i] > offsets[i+1UL] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      for( size_t k=offsets[i]; k<offsets[i+1UL]; ++k ) {
+         if( indices[k] >= minor || ( k > offsets[i] && indices[k] <= indices[k-1UL] ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+      }
+   }
+
+   mat.reset( values[0], values[1], offsets, indices, nonzeros );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the total size of the archive in bytes.
+//
+// \return The size of the archive in bytes.
+*/
+inline size_t MappedArchive::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current read position within the archive.
+//
+// \return The current read position in bytes.
+*/
+inline size_t MappedArchive::position() const noexcept
+{
+   return position_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the end of the archive has been reached.
+//
+// \return \a true in case all objects have been read from the archive, \a false if not.
+*/
+inline bool MappedArchive::eof() const noexcept
+{
+   return position_ == size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads and verifies the header of the next object in the archive.
+//
+// \param type The expected type of the object.
+// \param values The array for the sizes contained in the header.
+// \param count The number of sizes contained in the header.
+// \return void
+// \exception std::runtime_error Error during deserialization.
+*/
+template< typename Type >  // Data type of the elements
+void MappedArchive::readHeader( uint8_t type, uint64_t* values, size_t count )
+{
+   const size_t bytes( 4UL + count*sizeof( uint64_t ) );
+   const byte_t* const header( map<byte_t>( bytes ) );
+
+   if( header[0] != 2U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
+   }
+   else if( header[1] != type ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid object type detected" );
+   }
+   else if( header[2] != TypeValueMapping<Type>::value ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element type detected" );
+   }
+   else if( header[3] != sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid element size detected" );
+   }
+
+   std::memcpy( values, header+4UL, count*sizeof( uint64_t ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Maps the next block of the archive.
+//
+// \param count The number of elements of the block.
+// \return Pointer to the first element of the block.
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function returns a pointer to the current read position and advances the read position
+// by the size of the block, including the padding to the next multiple of 64 bytes.
+*/
+template< typename Type >  // Data type of the elements
+const Type* MappedArchive::map( size_t count )
+{
+   const size_t remaining( size_ - position_ );
+
+   if( count > remaining / sizeof( Type ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const size_t bytes( count*sizeof( Type ) );
+   const size_t padding( ( alignment - bytes % alignment ) % alignment );
+
+   if( bytes + padding > remaining ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   const Type* const ptr( reinterpret_cast<const Type*>( data_ + position_ ) );
+   position_ += bytes + padding;
+
+   return ptr;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Matrix.h>
 #include <blaze/math/dense/DynamicMatrix.h>
@@ -48,15 +49,23 @@
 #include <blaze/math/expressions/SparseMatrix.h>
 #include <blaze/math/expressions/Matrix.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/shims/Conjugate.h>
 #include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsPacked.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
 #include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -154,6 +163,20 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// Matrices with elements of built-in or complex data type are written in the version 2 format:
+// After the header, the dense payload or the compressed (CSR/CSC) arrays of a sparse matrix
+// (the offsets of the rows/columns, the indices, and the values of the non-zero elements) are
+// written as contiguous blocks. Both the header and each of these blocks are padded to a
+// multiple of 64 bytes. Therefore all blocks are properly aligned for a memory mapping of the
+// archive (see the MappedArchive class). All other matrices are written element by element in
+// the version 1 format. Both versions can be deserialized.
+//
+// Symmetric, Hermitian, lower and upper matrices in packed storage (see the PackedMatrix class
+// template) with elements of built-in or complex data type only write the \f$ N(N+1)/2 \f$
+// elements of their packed array. Such an archive can be reconstituted as packed matrix of the
+// same kind or as any other dense or sparse matrix, in which case the implied elements of the
+// opposite triangle are restored. Packed archives cannot be memory mapped.
 */
 class MatrixSerializer
 {
@@ -170,7 +193,14 @@ class MatrixSerializer
       0x01 - Vector/Matrix flag
       0x02 - Dense/Sparse flag
       0x04 - Row-/Column-major flag
+      0x08 - Packed storage flag
+      0x10 - Packed Hermitian matrix
+      0x20 - Packed lower matrix
+      0x40 - Packed upper matrix
       \endcode
+
+   // The flags 0x08 to 0x40 are only set for packed matrices with elements of built-in or complex
+   // data type. A packed matrix without one of the flags 0x10 to 0x40 is a symmetric matrix.
    */
    template< bool IsDenseMatrix, bool IsRowMajorMatrix >
    struct MatrixValueMappingHelper;
@@ -188,7 +218,13 @@ class MatrixSerializer
    template< typename T >
    struct MatrixValueMapping
    {
-      enum { value = MatrixValueMappingHelper< IsDenseMatrix_v<T>, IsRowMajorMatrix_v<T> >::value };
+      static constexpr bool packed = ( IsPacked_v<T> && IsNumeric_v< ElementType_t<T> > );
+
+      enum { value = MatrixValueMappingHelper< IsDenseMatrix_v<T>, IsRowMajorMatrix_v<T> >::value
+                   | ( packed ? 0x08 : 0 )
+                   | ( packed && IsHermitian_v<T> && !IsSymmetric_v<T> ? 0x10 : 0 )
+                   | ( packed && IsLower_v<T> ? 0x20 : 0 )
+                   | ( packed && IsUpper_v<T> ? 0x40 : 0 ) };
       BLAZE_CONSTRAINT_MUST_BE_MATRIX_TYPE( T );
    };
    /*! \endcond */
@@ -226,10 +262,35 @@ class MatrixSerializer
    void serializeHeader( Archive& archive, const MT& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
 
    template< typename Archive, typename MT, bool SO >
-   void serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > && !IsPacked_v<MT> >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > && IsPacked_v<MT> >
+      serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< HasConstDataAccess_v<MT> >
+      serializeDenseArray( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   DisableIf_t< HasConstDataAccess_v<MT> >
+      serializeDenseArray( Archive& archive, const DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive >
+   void serializePadding( Archive& archive, size_t bytes );
    //@}
    //**********************************************************************************************
 
@@ -246,7 +307,10 @@ class MatrixSerializer
    DisableIf_t< IsResizable_v<MT> > prepareMatrix( SparseMatrix<MT,SO>& mat );
 
    template< typename MT >
-   EnableIf_t< IsResizable_v<MT> > prepareMatrix( MT& mat );
+   EnableIf_t< IsResizable_v<MT> && !IsPacked_v<MT> > prepareMatrix( MT& mat );
+
+   template< typename MT >
+   EnableIf_t< IsResizable_v<MT> && IsPacked_v<MT> > prepareMatrix( MT& mat );
 
    template< typename Archive, typename MT >
    void deserializeMatrix( Archive& archive, MT& mat );
@@ -298,6 +362,45 @@ class MatrixSerializer
 
    template< typename Archive, typename MT >
    void deserializeSparseColumnMatrix( Archive& archive, SparseMatrix<MT,columnMajor>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeCompressedMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeCompressedMatrix( Archive& archive, SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializeCompressedMatrix( Archive& archive, MT& mat );
+
+   template< typename Archive, typename ET, typename Inserter, typename Finalizer >
+   void deserializeCompressedArrays( Archive& archive, Inserter insert, Finalizer finalize );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializePackedMatrix( Archive& archive, DenseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT, bool SO >
+   EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializePackedMatrix( Archive& archive, SparseMatrix<MT,SO>& mat );
+
+   template< typename Archive, typename MT >
+   DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+      deserializePackedMatrix( Archive& archive, MT& mat );
+
+   template< typename Archive >
+   void deserializePadding( Archive& archive, size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static constexpr size_t alignment  = 64UL;    //!< Alignment of all blocks of a version 2 archive.
+   static constexpr size_t headerSize = 28UL;    //!< Size of the matrix header in bytes.
+   static constexpr size_t bufferSize = 4096UL;  //!< Number of elements per bulk write/read.
    //@}
    //**********************************************************************************************
 
@@ -385,13 +488,18 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 {
    using ET = ElementType_t<MT>;
 
-   archive << uint8_t ( 1U );
+   archive << uint8_t ( IsNumeric_v<ET> ? 2U : 1U );
    archive << uint8_t ( MatrixValueMapping<MT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
    archive << uint64_t( mat.rows() );
    archive << uint64_t( mat.columns() );
-   archive << uint64_t( ( IsDenseMatrix_v<MT> ) ? ( mat.rows()*mat.columns() ) : ( mat.nonZeros() ) );
+   archive << uint64_t( ( MatrixValueMapping<MT>::packed ) ? ( mat.rows()*(mat.rows()+1UL)/2UL )
+                      : ( IsDenseMatrix_v<MT> ) ? ( mat.rows()*mat.columns() ) : ( mat.nonZeros() ) );
+
+   if( IsNumeric_v<ET> ) {
+      serializePadding( archive, headerSize );
+   }
 
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
@@ -401,7 +509,7 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a dense matrix.
+/*!\brief Serializes the elements of a dense matrix element by element.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
@@ -411,7 +519,8 @@ void MatrixSerializer::serializeHeader( Archive& archive, const MT& mat )
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
 {
    if( IsRowMajorMatrix_v<MT> ) {
       for( size_t i=0UL; i<(~mat).rows(); ++i ) {
@@ -436,7 +545,67 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a sparse matrix.
+/*!\brief Serializes the elements of a dense matrix as a single contiguous block.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes all elements of the given dense matrix in the storage order of the
+// matrix as a single block, which is padded to a multiple of 64 bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > && !IsPacked_v<MT> >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   serializeDenseArray( archive, ~mat );
+   serializePadding( archive, (~mat).rows() * (~mat).columns() * sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the packed array of a packed matrix as a single contiguous block.
+//
+// \param archive The archive to be written.
+// \param mat The packed matrix to be serialized.
+// \return void
+// \exception std::runtime_error Dense matrix could not be serialized.
+//
+// This function writes the \f$ N(N+1)/2 \f$ elements of the packed array of the given matrix
+// as a single block, which is padded to a multiple of 64 bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > && IsPacked_v<MT> >
+   MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t n( (~mat).rows() );
+
+   archive.write( (~mat).data(), n*(n+1UL)/2UL );
+   serializePadding( archive, n*(n+1UL)/2UL * sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix element by element.
 //
 // \param archive The archive to be written.
 // \param mat The matrix to be serialized.
@@ -446,7 +615,8 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const DenseMatrix<MT,S
 template< typename Archive  // Type of the archive
         , typename MT       // Type of the matrix
         , bool SO >         // Storage order
-void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
 {
    using ConstIterator = ConstIterator_t<MT>;
 
@@ -474,6 +644,176 @@ void MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse matrix in compressed format.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be serialized.
+//
+// This function writes the given sparse matrix in compressed row (CSR) or compressed column
+// (CSC) format, depending on the storage order of the matrix: The offsets of all rows/columns,
+// the indices of all non-zero elements and the values of all non-zero elements are written as
+// three consecutive blocks of 64-bit offsets, 64-bit indices and values, respectively. Each
+// block is padded to a multiple of 64 bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::serializeMatrix( Archive& archive, const SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+   using ConstIterator = ConstIterator_t<MT>;
+
+   const size_t major( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+
+   std::unique_ptr<uint64_t[]> positions( new uint64_t[bufferSize] );
+   std::unique_ptr<ET[]> values( new ET[bufferSize] );
+
+   size_t nonzeros( 0UL );
+   size_t k( 0UL );
+
+   positions[k++] = 0UL;
+
+   for( size_t i=0UL; i<major; ++i ) {
+      nonzeros += (~mat).nonZeros( i );
+      positions[k++] = nonzeros;
+      if( k == bufferSize ) {
+         archive.write( positions.get(), k );
+         k = 0UL;
+      }
+   }
+
+   archive.write( positions.get(), k );
+   serializePadding( archive, ( major+1UL ) * sizeof( uint64_t ) );
+
+   k = 0UL;
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         positions[k++] = element->index();
+         if( k == bufferSize ) {
+            archive.write( positions.get(), k );
+            k = 0UL;
+         }
+      }
+   }
+
+   archive.write( positions.get(), k );
+   serializePadding( archive, nonzeros * sizeof( uint64_t ) );
+
+   k = 0UL;
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( ConstIterator element=(~mat).begin(i); element!=(~mat).end(i); ++element ) {
+         values[k++] = element->value();
+         if( k == bufferSize ) {
+            archive.write( values.get(), k );
+            k = 0UL;
+         }
+      }
+   }
+
+   archive.write( values.get(), k );
+   serializePadding( archive, nonzeros * sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the elements of a dense matrix with data access to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// This function writes the elements of the given dense matrix directly from its underlying
+// storage. In case the rows/columns are not padded, all elements are written at once.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< HasConstDataAccess_v<MT> >
+   MatrixSerializer::serializeDenseArray( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   const size_t major( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+   const size_t minor( ( SO == rowMajor )?( (~mat).columns() ):( (~mat).rows() ) );
+
+   if( major == 0UL || minor == 0UL ) return;
+
+   if( (~mat).spacing() == minor ) {
+      archive.write( (~mat).data(), major*minor );
+   }
+   else {
+      for( size_t i=0UL; i<major; ++i ) {
+         archive.write( (~mat).data(i), minor );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the elements of a dense matrix without data access to the archive.
+//
+// \param archive The archive to be written.
+// \param mat The matrix to be serialized.
+// \return void
+//
+// This function evaluates the elements of the given dense matrix in its storage order into a
+// small buffer, which is written to the archive whenever it is full.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+DisableIf_t< HasConstDataAccess_v<MT> >
+   MatrixSerializer::serializeDenseArray( Archive& archive, const DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const size_t major( ( SO == rowMajor )?( (~mat).rows() ):( (~mat).columns() ) );
+   const size_t minor( ( SO == rowMajor )?( (~mat).columns() ):( (~mat).rows() ) );
+
+   std::unique_ptr<ET[]> buffer( new ET[bufferSize] );
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<major; ++i ) {
+      for( size_t j=0UL; j<minor; ++j ) {
+         buffer[k++] = ( SO == rowMajor )?( (~mat)(i,j) ):( (~mat)(j,i) );
+         if( k == bufferSize ) {
+            archive.write( buffer.get(), k );
+            k = 0UL;
+         }
+      }
+   }
+
+   archive.write( buffer.get(), k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pads a block of the given size to the alignment of the version 2 format.
+//
+// \param archive The archive to be written.
+// \param bytes The size of the preceding block in bytes.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::serializePadding( Archive& archive, size_t bytes )
+{
+   const uint8_t padding[alignment] = {};
+   archive.write( padding, ( alignment - bytes % alignment ) % alignment );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -523,10 +863,16 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> rows_ >> columns_ >> number_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ != 1UL && ( version_ != 2UL || !IsNumeric_v<ET> ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
-   else if( ( type_ & 1U ) != 1U || ( type_ & (~7U) ) != 0U ) {
+   else if( ( type_ & 1U ) != 1U || ( type_ & (~0x7FU) ) != 0U ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
+   }
+   else if( ( type_ & 0x78U ) != 0U &&
+            ( version_ != 2U || ( type_ & 0x0AU ) != 0x08U ||
+              ( ( type_ & 0x70U ) != 0x00U && ( type_ & 0x70U ) != 0x10U &&
+                ( type_ & 0x70U ) != 0x20U && ( type_ & 0x70U ) != 0x40U ) ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix type detected" );
    }
    else if( elementType_ != TypeValueMapping<ET>::value ) {
@@ -538,9 +884,19 @@ void MatrixSerializer::deserializeHeader( Archive& archive, const MT& mat )
    else if( !IsResizable_v<MT> && ( rows_ != mat.rows() || columns_ != mat.columns() ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
    }
+   else if( ( IsPacked_v<MT> || ( type_ & 8U ) ) && rows_ != columns_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid matrix size detected" );
+   }
    else if( number_ > rows_*columns_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
    }
+   else if( ( type_ & 8U ) && number_ != rows_*(rows_+1UL)/2UL ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
+   }
+
+   if( version_ == 2U ) {
+      deserializePadding( archive, headerSize );
+   }
 }
 //*************************************************************************************************
 
@@ -583,7 +939,7 @@ DisableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( SparseMatrix<M
 // \return void
 */
 template< typename MT >  // Type of the matrix
-EnableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
+EnableIf_t< IsResizable_v<MT> && !IsPacked_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
 {
    mat.resize ( rows_, columns_, false );
    mat.reserve( number_ );
@@ -592,6 +948,21 @@ EnableIf_t< IsResizable_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Prepares the given resizable packed matrix for the deserialization process.
+//
+// \param mat The packed matrix to be prepared.
+// \return void
+*/
+template< typename MT >  // Type of the matrix
+EnableIf_t< IsResizable_v<MT> && IsPacked_v<MT> > MatrixSerializer::prepareMatrix( MT& mat )
+{
+   mat.resize( rows_, false );
+   reset( mat );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Deserializes a matrix from the archive.
 //
@@ -607,7 +978,13 @@ template< typename Archive  // Type of the archive
         , typename MT >     // Type of the matrix
 void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
 {
-   if( type_ == 1U ) {
+   if( type_ & 8U ) {
+      deserializePackedMatrix( archive, ~mat );
+   }
+   else if( version_ == 2U && ( type_ & 2U ) ) {
+      deserializeCompressedMatrix( archive, ~mat );
+   }
+   else if( type_ == 1U ) {
       deserializeDenseRowMatrix( archive, ~mat );
    }
    else if( type_ == 5UL ) {
@@ -622,6 +999,11 @@ void MatrixSerializer::deserializeMatrix( Archive& archive, MT& mat )
    else {
       BLAZE_INTERNAL_ASSERT( false, "Undefined type flag" );
    }
+
+   if( version_ == 2U && !( type_ & 2U ) ) {
+      deserializePadding( archive, ( ( type_ & 8U )?( number_ ):( rows_ * columns_ ) )
+                                 * sizeof( ElementType_t<MT> ) );
+   }
 }
 //*************************************************************************************************
 
@@ -1120,6 +1502,312 @@ void MatrixSerializer::deserializeSparseColumnMatrix( Archive& archive, SparseMa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a compressed sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The dense matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes a row-major or column-major sparse matrix in compressed format
+// from the archive and reconstitutes the given dense matrix. In case any error is detected
+// during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeCompressedMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   if( type_ & 4U ) {
+      deserializeCompressedArrays<Archive,ET>( archive,
+         [&mat]( size_t j, size_t i, const ET& value ) { (~mat)(i,j) = value; },
+         []( size_t ) {} );
+   }
+   else {
+      deserializeCompressedArrays<Archive,ET>( archive,
+         [&mat]( size_t i, size_t j, const ET& value ) { (~mat)(i,j) = value; },
+         []( size_t ) {} );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a compressed sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The sparse matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes a row-major or column-major sparse matrix in compressed format
+// from the archive and reconstitutes the given sparse matrix. In case the storage order of the
+// archived matrix matches the storage order of the given matrix, the elements are appended
+// directly. Otherwise the matrix is reconstituted via a temporary matrix. In case any error
+// is detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeCompressedMatrix( Archive& archive, SparseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   if( static_cast<bool>( type_ & 4U ) != SO ) {
+      CompressedMatrix< ET, !SO > tmp( rows_, columns_, number_ );
+      deserializeCompressedMatrix( archive, tmp );
+      (~mat) = tmp;
+   }
+   else if( SO == rowMajor ) {
+      deserializeCompressedArrays<Archive,ET>( archive,
+         [&mat]( size_t i, size_t j, const ET& value ) { (~mat).append( i, j, value, false ); },
+         [&mat]( size_t i ) { (~mat).finalize( i ); } );
+   }
+   else {
+      deserializeCompressedArrays<Archive,ET>( archive,
+         [&mat]( size_t j, size_t i, const ET& value ) { (~mat).append( i, j, value, false ); },
+         [&mat]( size_t j ) { (~mat).finalize( j ); } );
+   }
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a compressed sparse matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+//
+// Matrices with elements of non-numeric type are never written in compressed format, which
+// is guaranteed by the version check of the deserializeHeader() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializeCompressedMatrix( Archive& archive, MT& mat )
+{
+   UNUSED_PARAMETER( archive, mat );
+
+   BLAZE_INTERNAL_ASSERT( false, "Invalid compressed matrix of non-numeric element type" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reads and validates the compressed arrays of a sparse matrix.
+//
+// \param archive The archive to be read from.
+// \param insert Functor for the insertion of a single non-zero element.
+// \param finalize Functor for the finalization of a single row/column.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function reads the offsets and indices of a compressed sparse matrix, verifies their
+// consistency and subsequently streams the non-zero values in chunks. For each non-zero element
+// the \a insert functor is called with the index of the row/column, the index of the element
+// within the row/column and the value of the element. After all elements of a row/column have
+// been inserted, the \a finalize functor is called with the index of the row/column.
+*/
+template< typename Archive     // Type of the archive
+        , typename ET          // Type of the elements
+        , typename Inserter    // Type of the insertion functor
+        , typename Finalizer > // Type of the finalization functor
+void MatrixSerializer::deserializeCompressedArrays( Archive& archive, Inserter insert, Finalizer finalize )
+{
+   const size_t major( ( type_ & 4U )?( columns_ ):( rows_ ) );
+   const size_t minor( ( type_ & 4U )?( rows_ ):( columns_ ) );
+
+   std::unique_ptr<uint64_t[]> offsets( new uint64_t[major+1UL] );
+   std::unique_ptr<uint64_t[]> indices( new uint64_t[number_] );
+
+   archive.read( offsets.get(), major+1UL );
+   deserializePadding( archive, ( major+1UL ) * sizeof( uint64_t ) );
+   archive.read( indices.get(), number_ );
+   deserializePadding( archive, number_ * sizeof( uint64_t ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+
+   if( offsets[0UL] != 0UL || offsets[major] != number_ ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+
+   for( size_t i=0UL; i<major; ++i ) {
+      if( offsets[i] > offsets[i+1UL] ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+      for( size_t k=offsets[i]; k<offsets[i+1UL]; ++k ) {
+         if( indices[k] >= minor || ( k > offsets[i] && indices[k] <= indices[k-1UL] ) ) {
+            BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+         }
+      }
+   }
+
+   std::unique_ptr<ET[]> values( new ET[bufferSize] );
+
+   size_t i( 0UL );
+
+   for( size_t k=0UL; k<number_; k+=bufferSize )
+   {
+      const size_t chunk( ( number_-k < bufferSize )?( number_-k ):( bufferSize ) );
+
+      if( !archive.read( values.get(), chunk ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+      }
+
+      for( size_t l=0UL; l<chunk; ++l ) {
+         while( offsets[i+1UL] <= k+l ) {
+            finalize( i );
+            ++i;
+         }
+         insert( i, indices[k+l], values[l] );
+      }
+   }
+
+   for( ; i<major; ++i ) {
+      finalize( i );
+   }
+
+   deserializePadding( archive, number_ * sizeof( ET ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a packed matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The dense matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Dense matrix could not be deserialized.
+//
+// This function deserializes the packed array of a symmetric, Hermitian, lower or upper matrix
+// from the archive and reconstitutes the given dense matrix, including the implied elements of
+// the opposite triangle of symmetric and Hermitian matrices. The packed array is read segment
+// by segment, where segment \a p contains the elements \f$ (p,0) \ldots (p,p) \f$ (or the
+// elements \f$ (0,p) \ldots (p,p) \f$ in case of an upper matrix). In case any error is
+// detected during the deserialization process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializePackedMatrix( Archive& archive, DenseMatrix<MT,SO>& mat )
+{
+   using ET = ElementType_t<MT>;
+
+   const uint8_t kind( type_ & 0x70U );
+
+   std::unique_ptr<ET[]> segment( new ET[rows_+1UL] );
+
+   for( size_t p=0UL; p<rows_; ++p )
+   {
+      if( !archive.read( segment.get(), p+1UL ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Dense matrix could not be deserialized" );
+      }
+
+      for( size_t q=0UL; q<=p; ++q )
+      {
+         if( kind == 0x40U ) {
+            (~mat)(q,p) = segment[q];
+         }
+         else {
+            (~mat)(p,q) = segment[q];
+            if( q < p && kind == 0x10U )
+               (~mat)(q,p) = conj( segment[q] );
+            else if( q < p && kind == 0x00U )
+               (~mat)(q,p) = segment[q];
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a packed matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The sparse matrix to be reconstituted.
+// \return void
+// \exception std::runtime_error Sparse matrix could not be deserialized.
+//
+// This function deserializes the packed array of a symmetric, Hermitian, lower or upper matrix
+// from the archive and reconstitutes the given sparse matrix via a temporary dense matrix. In
+// case any error is detected during the deserialization process, a \a std::runtime_error is
+// thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT       // Type of the matrix
+        , bool SO >         // Storage order
+EnableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializePackedMatrix( Archive& archive, SparseMatrix<MT,SO>& mat )
+{
+   DynamicMatrix< ElementType_t<MT>, rowMajor > tmp( rows_, columns_, ElementType_t<MT>() );
+   deserializePackedMatrix( archive, tmp );
+   (~mat) = tmp;
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse matrix could not be deserialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a packed matrix from the archive.
+//
+// \param archive The archive to be read from.
+// \param mat The matrix to be reconstituted.
+// \return void
+//
+// Matrices with elements of non-numeric type are never written in packed format, which is
+// guaranteed by the version check of the deserializeHeader() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename MT >     // Type of the matrix
+DisableIf_t< IsNumeric_v< ElementType_t<MT> > >
+   MatrixSerializer::deserializePackedMatrix( Archive& archive, MT& mat )
+{
+   UNUSED_PARAMETER( archive, mat );
+
+   BLAZE_INTERNAL_ASSERT( false, "Invalid packed matrix of non-numeric element type" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the padding of a block of the given size in the version 2 format.
+//
+// \param archive The archive to be read from.
+// \param bytes The size of the preceding block in bytes.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+*/
+template< typename Archive >  // Type of the archive
+void MatrixSerializer::deserializePadding( Archive& archive, size_t bytes )
+{
+   uint8_t padding[alignment];
+
+   if( !archive.read( padding, ( alignment - bytes % alignment ) % alignment ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
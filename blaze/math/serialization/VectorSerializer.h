@@ -40,6 +40,7 @@
 // Includes
 //*************************************************************************************************
 
+#include <memory>
 #include <blaze/math/Aliases.h>
 #include <blaze/math/constraints/Vector.h>
 #include <blaze/math/Exception.h>
@@ -47,12 +48,15 @@
 #include <blaze/math/expressions/SparseVector.h>
 #include <blaze/math/expressions/Vector.h>
 #include <blaze/math/serialization/TypeValueMapping.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsResizable.h>
 #include <blaze/util/Assert.h>
 #include <blaze/util/DisableIf.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsNumeric.h>
+#include <blaze/util/Unused.h>
 
 
 namespace blaze {
@@ -149,6 +153,13 @@ namespace blaze {
 //
 // In case an error is encountered during (de-)serialization, a \a std::runtime_exception is
 // thrown.
+//
+// Vectors with elements of built-in or complex data type are written in the version 2 format:
+// After the header, the dense payload or the indices and values of all non-zero elements of a
+// sparse vector are written as contiguous blocks. Both the header and each of these blocks are
+// padded to a multiple of 64 bytes, which enables a memory mapping of the archive (see the
+// MappedArchive class). All other vectors are written element by element in the version 1
+// format. Both versions can be deserialized.
 */
 class VectorSerializer
 {
@@ -221,10 +232,31 @@ class VectorSerializer
    void serializeHeader( Archive& archive, const VT& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
 
    template< typename Archive, typename VT, bool TF >
-   void serializeVector( Archive& archive, const SparseVector<VT,TF>& vec );
+   EnableIf_t< HasConstDataAccess_v<VT> >
+      serializeDenseArray( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT, bool TF >
+   DisableIf_t< HasConstDataAccess_v<VT> >
+      serializeDenseArray( Archive& archive, const DenseVector<VT,TF>& vec );
+
+   template< typename Archive >
+   void serializePadding( Archive& archive, size_t bytes );
    //@}
    //**********************************************************************************************
 
@@ -262,6 +294,32 @@ class VectorSerializer
 
    template< typename Archive, typename VT, bool TF >
    void deserializeSparseVector( Archive& archive, SparseVector<VT,TF>& vec );
+
+   template< typename Archive, typename VT >
+   EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      deserializeCompressedVector( Archive& archive, VT& vec );
+
+   template< typename Archive, typename VT >
+   DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+      deserializeCompressedVector( Archive& archive, VT& vec );
+
+   template< typename VT, bool TF >
+   void insertElement( DenseVector<VT,TF>& vec, size_t index, const ElementType_t<VT>& value );
+
+   template< typename VT, bool TF >
+   void insertElement( SparseVector<VT,TF>& vec, size_t index, const ElementType_t<VT>& value );
+
+   template< typename Archive >
+   void deserializePadding( Archive& archive, size_t bytes );
+   //@}
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   /*!\name Constants */
+   //@{
+   static constexpr size_t alignment  = 64UL;    //!< Alignment of all blocks of a version 2 archive.
+   static constexpr size_t headerSize = 20UL;    //!< Size of the vector header in bytes.
+   static constexpr size_t bufferSize = 4096UL;  //!< Number of elements per bulk write/read.
    //@}
    //**********************************************************************************************
 
@@ -350,13 +408,17 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 {
    using ET = ElementType_t<VT>;
 
-   archive << uint8_t ( 1U );
+   archive << uint8_t ( IsNumeric_v<ET> ? 2U : 1U );
    archive << uint8_t ( VectorValueMapping<VT>::value );
    archive << uint8_t ( TypeValueMapping<ET>::value );
    archive << uint8_t ( sizeof( ET ) );
    archive << uint64_t( vec.size() );
    archive << uint64_t( IsDenseVector_v<VT> ? vec.size() : vec.nonZeros() );
 
+   if( IsNumeric_v<ET> ) {
+      serializePadding( archive, headerSize );
+   }
+
    if( !archive ) {
       BLAZE_THROW_RUNTIME_ERROR( "File header could not be serialized" );
    }
@@ -365,7 +427,7 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a dense vector.
+/*!\brief Serializes the elements of a dense vector element by element.
 //
 // \param archive The archive to be written.
 // \param vec The vector to be serialized.
@@ -375,7 +437,8 @@ void VectorSerializer::serializeHeader( Archive& archive, const VT& vec )
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
 {
    size_t i( 0UL );
    while( ( i < (~vec).size() ) && ( archive << (~vec)[i] ) ) {
@@ -390,7 +453,36 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 
 
 //*************************************************************************************************
-/*!\brief Serializes the elements of a sparse vector.
+/*!\brief Serializes the elements of a dense vector as a single contiguous block.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Dense vector could not be serialized.
+//
+// This function writes all elements of the given dense vector as a single block, which is
+// padded to a multiple of 64 bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   serializeDenseArray( archive, ~vec );
+   serializePadding( archive, (~vec).size() * sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Dense vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse vector element by element.
 //
 // \param archive The archive to be written.
 // \param vec The vector to be serialized.
@@ -400,7 +492,8 @@ void VectorSerializer::serializeVector( Archive& archive, const DenseVector<VT,T
 template< typename Archive  // Type of the archive
         , typename VT       // Type of the vector
         , bool TF >         // Transpose flag
-void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
 {
    using ConstIterator = ConstIterator_t<VT>;
 
@@ -417,6 +510,133 @@ void VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serializes the elements of a sparse vector in compressed format.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+// \exception std::runtime_error Sparse vector could not be serialized.
+//
+// This function writes the 64-bit indices and the values of all non-zero elements of the
+// given sparse vector as two consecutive blocks. Each block is padded to a multiple of 64
+// bytes.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::serializeVector( Archive& archive, const SparseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+   using ConstIterator = ConstIterator_t<VT>;
+
+   std::unique_ptr<uint64_t[]> indices( new uint64_t[bufferSize] );
+   std::unique_ptr<ET[]> values( new ET[bufferSize] );
+
+   size_t nonzeros( 0UL );
+   size_t k( 0UL );
+
+   for( ConstIterator element=(~vec).begin(); element!=(~vec).end(); ++element ) {
+      indices[k++] = element->index();
+      ++nonzeros;
+      if( k == bufferSize ) {
+         archive.write( indices.get(), k );
+         k = 0UL;
+      }
+   }
+
+   archive.write( indices.get(), k );
+   serializePadding( archive, nonzeros * sizeof( uint64_t ) );
+
+   k = 0UL;
+
+   for( ConstIterator element=(~vec).begin(); element!=(~vec).end(); ++element ) {
+      values[k++] = element->value();
+      if( k == bufferSize ) {
+         archive.write( values.get(), k );
+         k = 0UL;
+      }
+   }
+
+   archive.write( values.get(), k );
+   serializePadding( archive, nonzeros * sizeof( ET ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Sparse vector could not be serialized" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the elements of a dense vector with data access to the archive.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+EnableIf_t< HasConstDataAccess_v<VT> >
+   VectorSerializer::serializeDenseArray( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   archive.write( (~vec).data(), (~vec).size() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the elements of a dense vector without data access to the archive.
+//
+// \param archive The archive to be written.
+// \param vec The vector to be serialized.
+// \return void
+//
+// This function evaluates the elements of the given dense vector into a small buffer, which
+// is written to the archive whenever it is full.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT       // Type of the vector
+        , bool TF >         // Transpose flag
+DisableIf_t< HasConstDataAccess_v<VT> >
+   VectorSerializer::serializeDenseArray( Archive& archive, const DenseVector<VT,TF>& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   std::unique_ptr<ET[]> buffer( new ET[bufferSize] );
+   size_t k( 0UL );
+
+   for( size_t i=0UL; i<(~vec).size(); ++i ) {
+      buffer[k++] = (~vec)[i];
+      if( k == bufferSize ) {
+         archive.write( buffer.get(), k );
+         k = 0UL;
+      }
+   }
+
+   archive.write( buffer.get(), k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Pads a block of the given size to the alignment of the version 2 format.
+//
+// \param archive The archive to be written.
+// \param bytes The size of the preceding block in bytes.
+// \return void
+*/
+template< typename Archive >  // Type of the archive
+void VectorSerializer::serializePadding( Archive& archive, size_t bytes )
+{
+   const uint8_t padding[alignment] = {};
+   archive.write( padding, ( alignment - bytes % alignment ) % alignment );
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -471,7 +691,7 @@ void VectorSerializer::deserializeHeader( Archive& archive, const VT& vec )
    if( !( archive >> version_ >> type_ >> elementType_ >> elementSize_ >> size_ >> number_ ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
    }
-   else if( version_ != 1UL ) {
+   else if( version_ != 1UL && ( version_ != 2UL || !IsNumeric_v<ET> ) ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid version detected" );
    }
    else if( ( type_ & 1U ) != 0U || ( type_ & (~3U) ) != 0U ) {
@@ -489,6 +709,10 @@ void VectorSerializer::deserializeHeader( Archive& archive, const VT& vec )
    else if( number_ > size_ ) {
       BLAZE_THROW_RUNTIME_ERROR( "Invalid number of elements detected" );
    }
+
+   if( version_ == 2U ) {
+      deserializePadding( archive, headerSize );
+   }
 }
 //*************************************************************************************************
 
@@ -557,6 +781,12 @@ void VectorSerializer::deserializeVector( Archive& archive, VT& vec )
 {
    if( type_ == 0U ) {
       deserializeDenseVector( archive, vec );
+      if( version_ == 2U ) {
+         deserializePadding( archive, size_ * sizeof( ElementType_t<VT> ) );
+      }
+   }
+   else if( type_ == 2U && version_ == 2U ) {
+      deserializeCompressedVector( archive, vec );
    }
    else if( type_ == 2U ) {
       deserializeSparseVector( archive, vec );
@@ -735,6 +965,138 @@ void VectorSerializer::deserializeSparseVector( Archive& archive, SparseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserializes a compressed sparse vector from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The vector to be reconstituted.
+// \return void
+// \exception std::runtime_error Vector could not be deserialized.
+// \exception std::runtime_error Corrupt archive detected.
+//
+// This function reads the indices of all non-zero elements of a compressed sparse vector,
+// verifies their consistency and subsequently streams the non-zero values in chunks into the
+// given dense or sparse vector. In case any error is detected during the deserialization
+// process, a \a std::runtime_error is thrown.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+EnableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::deserializeCompressedVector( Archive& archive, VT& vec )
+{
+   using ET = ElementType_t<VT>;
+
+   std::unique_ptr<uint64_t[]> indices( new uint64_t[number_] );
+
+   archive.read( indices.get(), number_ );
+   deserializePadding( archive, number_ * sizeof( uint64_t ) );
+
+   if( !archive ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Vector could not be deserialized" );
+   }
+
+   for( size_t i=0UL; i<number_; ++i ) {
+      if( indices[i] >= size_ || ( i > 0UL && indices[i] <= indices[i-1UL] ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+      }
+   }
+
+   std::unique_ptr<ET[]> values( new ET[bufferSize] );
+
+   for( size_t i=0UL; i<number_; i+=bufferSize )
+   {
+      const size_t chunk( ( number_-i < bufferSize )?( number_-i ):( bufferSize ) );
+
+      if( !archive.read( values.get(), chunk ) ) {
+         BLAZE_THROW_RUNTIME_ERROR( "Vector could not be deserialized" );
+      }
+
+      for( size_t j=0UL; j<chunk; ++j ) {
+         insertElement( vec, indices[i+j], values[j] );
+      }
+   }
+
+   deserializePadding( archive, number_ * sizeof( ET ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserializes a compressed sparse vector from the archive.
+//
+// \param archive The archive to be read from.
+// \param vec The vector to be reconstituted.
+// \return void
+//
+// Vectors with elements of non-numeric type are never written in compressed format, which is
+// guaranteed by the version check of the deserializeHeader() function.
+*/
+template< typename Archive  // Type of the archive
+        , typename VT >     // Type of the vector
+DisableIf_t< IsNumeric_v< ElementType_t<VT> > >
+   VectorSerializer::deserializeCompressedVector( Archive& archive, VT& vec )
+{
+   UNUSED_PARAMETER( archive, vec );
+
+   BLAZE_INTERNAL_ASSERT( false, "Invalid compressed vector of non-numeric element type" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserts a single deserialized element into a dense vector.
+//
+// \param vec The dense vector to be reconstituted.
+// \param index The index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void VectorSerializer::insertElement( DenseVector<VT,TF>& vec, size_t index, const ElementType_t<VT>& value )
+{
+   (~vec)[index] = value;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserts a single deserialized element into a sparse vector.
+//
+// \param vec The sparse vector to be reconstituted.
+// \param index The index of the element.
+// \param value The value of the element.
+// \return void
+*/
+template< typename VT  // Type of the vector
+        , bool TF >    // Transpose flag
+void VectorSerializer::insertElement( SparseVector<VT,TF>& vec, size_t index, const ElementType_t<VT>& value )
+{
+   (~vec).append( index, value, false );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skips the padding of a block of the given size in the version 2 format.
+//
+// \param archive The archive to be read from.
+// \param bytes The size of the preceding block in bytes.
+// \return void
+// \exception std::runtime_error Corrupt archive detected.
+*/
+template< typename Archive >  // Type of the archive
+void VectorSerializer::deserializePadding( Archive& archive, size_t bytes )
+{
+   uint8_t padding[alignment];
+
+   if( !archive.read( padding, ( alignment - bytes % alignment ) % alignment ) ) {
+      BLAZE_THROW_RUNTIME_ERROR( "Corrupt archive detected" );
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
@@ -0,0 +1,283 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Dispatch.h
+//  \brief Header file for the runtime selection of the instruction set
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SIMD_DISPATCH_H_
+#define _BLAZE_MATH_SIMD_DISPATCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <cstring>
+#include <blaze/system/Vectorization.h>
+
+#if BLAZE_DISPATCH_MODE
+#  include <cpuid.h>
+#endif
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  INSTRUCTION SETS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Instruction sets of the compute kernels.
+// \ingroup simd
+//
+// This enumeration lists the instruction sets the compute kernels of the Blaze library can be
+// compiled for, in ascending order of capability.
+*/
+enum class InstructionSet : int
+{
+   scalar = 0,  //!< No vectorization.
+   sse2   = 1,  //!< SSE2 (including SSE3 and SSSE3).
+   sse4   = 2,  //!< SSE4.1/SSE4.2.
+   avx    = 3,  //!< AVX.
+   avx2   = 4,  //!< AVX2 and FMA.
+   avx512 = 5   //!< AVX-512F.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The instruction set selected at compile time.
+// \ingroup simd
+//
+// This constant represents the instruction set the Blaze library has been compiled for (see
+// the BLAZE_SSE*_MODE, BLAZE_AVX*_MODE and BLAZE_MIC_MODE macros).
+*/
+constexpr InstructionSet compiledInstructionSet =
+   ( BLAZE_AVX512F_MODE || BLAZE_MIC_MODE )
+   ?( InstructionSet::avx512 )
+   :( BLAZE_AVX2_MODE )
+    ?( InstructionSet::avx2 )
+    :( BLAZE_AVX_MODE )
+     ?( InstructionSet::avx )
+     :( BLAZE_SSE4_MODE )
+      ?( InstructionSet::sse4 )
+      :( BLAZE_SSE2_MODE )
+       ?( InstructionSet::sse2 )
+       :( InstructionSet::scalar );
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET DETECTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Detects the best instruction set supported by the executing CPU and operating system.
+// \ingroup simd
+//
+// \return The best supported instruction set.
+//
+// This function queries the executing CPU via \c cpuid and checks via \c xgetbv that the
+// operating system saves the according register state. Only the instruction sets that are
+// candidates for the runtime dispatch (i.e. AVX2 with FMA and AVX-512F) are detected. In case
+// neither of them is available or in case the runtime dispatch is disabled, the function
+// returns the instruction set selected at compile time.
+*/
+inline InstructionSet detectInstructionSet() noexcept
+{
+#if BLAZE_DISPATCH_MODE
+   unsigned int eax( 0U ), ebx( 0U ), ecx( 0U ), edx( 0U );
+
+   if( !__get_cpuid( 1U, &eax, &ebx, &ecx, &edx ) )
+      return compiledInstructionSet;
+
+   const bool osxsave( ecx & ( 1U << 27 ) );
+   const bool fma    ( ecx & ( 1U << 12 ) );
+   const bool avx    ( ecx & ( 1U << 28 ) );
+
+   if( !osxsave || !avx )
+      return compiledInstructionSet;
+
+   unsigned int xcr0( 0U ), xcr0hi( 0U );
+   __asm__ __volatile__ ( "xgetbv" : "=a"( xcr0 ), "=d"( xcr0hi ) : "c"( 0U ) );
+
+   // Checking the XMM and YMM register state
+   if( ( xcr0 & 0x06U ) != 0x06U )
+      return compiledInstructionSet;
+
+   if( !__get_cpuid_count( 7U, 0U, &eax, &ebx, &ecx, &edx ) )
+      return compiledInstructionSet;
+
+   const bool avx2   ( ebx & ( 1U <<  5 ) );
+   const bool avx512f( ebx & ( 1U << 16 ) );
+
+   // Checking the opmask and ZMM register state
+   if( avx2 && fma && avx512f && ( xcr0 & 0xE6U ) == 0xE6U )
+      return InstructionSet::avx512;
+
+   if( avx2 && fma )
+      return InstructionSet::avx2;
+#endif
+
+   return compiledInstructionSet;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selects the instruction set of the compute kernels.
+// \ingroup simd
+//
+// \return The selected instruction set.
+//
+// This function selects the instruction set of the compute kernels based on the capabilities
+// of the executing CPU and on the \c BLAZE_ISA environment variable. The environment variable
+// may be set to \c "scalar", \c "sse2", \c "sse4", \c "avx", \c "avx2" or \c "avx512" in order
+// to restrict the selection. Unknown values are ignored. An instruction set that is not
+// supported by the CPU can never be selected, and the result is never below the instruction
+// set selected at compile time.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+inline InstructionSet selectInstructionSet() noexcept
+{
+   constexpr const char* names[] = { "scalar", "sse2", "sse4", "avx", "avx2", "avx512" };
+
+   InstructionSet isa( detectInstructionSet() );
+
+   const char* env = std::getenv( "BLAZE_ISA" );
+
+   if( env != nullptr ) {
+      for( int i=0; i<6; ++i ) {
+         if( std::strcmp( env, names[i] ) == 0 && i < static_cast<int>( isa ) ) {
+            isa = static_cast<InstructionSet>( i );
+         }
+      }
+   }
+
+   if( isa != InstructionSet::avx2 && isa != InstructionSet::avx512 ) {
+      isa = compiledInstructionSet;
+   }
+
+   return ( isa < compiledInstructionSet ? compiledInstructionSet : isa );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTRUCTION SET QUERY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the instruction set used by the compute kernels.
+// \ingroup simd
+//
+// \return The instruction set used by the compute kernels.
+//
+// This function returns the instruction set that is used by the dispatched compute kernels of
+// the Blaze library (i.e. dense matrix multiplications, dense matrix/dense vector multiplications,
+// dot products, summations and Euclidean norms of \c float and \c double vectors and matrices).
+// The instruction set is selected once on the first call: In case the runtime dispatch is
+// enabled (see the BLAZE_USE_DISPATCH switch), the best instruction set supported by the
+// executing CPU is chosen, optionally restricted by the \c BLAZE_ISA environment variable.
+// Otherwise the instruction set selected at compile time is returned.
+
+   \code
+   std::cout << "Blaze kernels: " << blaze::getInstructionSetName() << "\n";
+   \endcode
+*/
+inline InstructionSet getInstructionSet() noexcept
+{
+   static const InstructionSet isa( selectInstructionSet() );
+   return isa;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the given instruction set.
+// \ingroup simd
+//
+// \param isa The given instruction set.
+// \return The name of the instruction set.
+*/
+inline const char* getInstructionSetName( InstructionSet isa ) noexcept
+{
+   switch( isa ) {
+      case InstructionSet::sse2  : return "sse2";
+      case InstructionSet::sse4  : return "sse4";
+      case InstructionSet::avx   : return "avx";
+      case InstructionSet::avx2  : return "avx2";
+      case InstructionSet::avx512: return "avx512";
+      default                    : return "scalar";
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the name of the instruction set used by the compute kernels.
+// \ingroup simd
+//
+// \return The name of the instruction set used by the compute kernels.
+//
+// This function returns the name of the instruction set returned by getInstructionSet().
+*/
+inline const char* getInstructionSetName() noexcept
+{
+   return getInstructionSetName( getInstructionSet() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
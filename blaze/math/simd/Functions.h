@@ -63,10 +63,12 @@
 #include <blaze/math/simd/Exp10.h>
 #include <blaze/math/simd/Floor.h>
 #include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Gather.h>
 #include <blaze/math/simd/Hypot.h>
 #include <blaze/math/simd/InvCbrt.h>
 #include <blaze/math/simd/InvSqrt.h>
 #include <blaze/math/simd/Loada.h>
+#include <blaze/math/simd/Loadm.h>
 #include <blaze/math/simd/Loadu.h>
 #include <blaze/math/simd/Log.h>
 #include <blaze/math/simd/Log2.h>
@@ -78,6 +80,7 @@
 #include <blaze/math/simd/Prod.h>
 #include <blaze/math/simd/Reduce.h>
 #include <blaze/math/simd/Round.h>
+#include <blaze/math/simd/Scatter.h>
 #include <blaze/math/simd/Set.h>
 #include <blaze/math/simd/Setzero.h>
 #include <blaze/math/simd/Sign.h>
@@ -85,6 +88,7 @@
 #include <blaze/math/simd/Sinh.h>
 #include <blaze/math/simd/Sqrt.h>
 #include <blaze/math/simd/Storea.h>
+#include <blaze/math/simd/Storem.h>
 #include <blaze/math/simd/Storeu.h>
 #include <blaze/math/simd/Stream.h>
 #include <blaze/math/simd/Sub.h>
@@ -0,0 +1,443 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Gather.h
+//  \brief Header file for the SIMD gather functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_GATHER_H_
+#define _BLAZE_MATH_SIMD_GATHER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  4-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The base address of the integral values.
+// \param indices The indices of the values to be gathered.
+// \return The gathered vector of integral values.
+//
+// This function gathers a vector of 4-byte integral values from the given base address. The
+// \a i-th element of the resulting vector is given by \c address[indices[i]]. The given array
+// of indices must contain at least as many indices as the SIMD vector contains values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,4UL>
+                                    , If_t< IsSigned_v<T>, SIMDint32, SIMDuint32 > >
+   gather( const T* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   const __m256i v1( _mm512_i64gather_epi32( _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256i v2( _mm512_i64gather_epi32( _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   return _mm512_inserti64x4( _mm512_castsi256_si512( v1 ), v2, 1 );
+#elif BLAZE_AVX2_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   const int* base( reinterpret_cast<const int*>( address ) );
+   const __m128i v1( _mm256_i64gather_epi32( base, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ), 4 ) );
+   const __m128i v2( _mm256_i64gather_epi32( base, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ), 4 ) );
+   return _mm256_inserti128_si256( _mm256_castsi128_si256( v1 ), v2, 1 );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_epi32( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a strided vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The address of the first integral value.
+// \param stride The distance between two consecutive values.
+// \return The gathered vector of integral values.
+//
+// This function gathers a vector of 4-byte integral values with constant distance. The \a i-th
+// element of the resulting vector is given by \c address[i*stride].
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,4UL>
+                                    , If_t< IsSigned_v<T>, SIMDint32, SIMDuint32 > >
+   gather( const T* address, size_t stride ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   const __m512i i1( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   const __m512i i2( _mm512_add_epi64( i1, _mm512_set1_epi64( 8*s ) ) );
+   const __m256i v1( _mm512_i64gather_epi32( i1, address, 4 ) );
+   const __m256i v2( _mm512_i64gather_epi32( i2, address, 4 ) );
+   return _mm512_inserti64x4( _mm512_castsi256_si512( v1 ), v2, 1 );
+#elif BLAZE_AVX2_MODE
+   const long long s( stride );
+   const int* base( reinterpret_cast<const int*>( address ) );
+   const __m256i i1( _mm256_set_epi64x( 3*s, 2*s, s, 0 ) );
+   const __m256i i2( _mm256_add_epi64( i1, _mm256_set1_epi64x( 4*s ) ) );
+   const __m128i v1( _mm256_i64gather_epi32( base, i1, 4 ) );
+   const __m128i v2( _mm256_i64gather_epi32( base, i2, 4 ) );
+   return _mm256_inserti128_si256( _mm256_castsi128_si256( v1 ), v2, 1 );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_epi32( address[3UL*stride], address[2UL*stride], address[stride], address[0] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  8-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The base address of the integral values.
+// \param indices The indices of the values to be gathered.
+// \return The gathered vector of integral values.
+//
+// This function gathers a vector of 8-byte integral values from the given base address. The
+// \a i-th element of the resulting vector is given by \c address[indices[i]]. The given array
+// of indices must contain at least as many indices as the SIMD vector contains values.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,8UL>
+                                    , If_t< IsSigned_v<T>, SIMDint64, SIMDuint64 > >
+   gather( const T* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   return _mm512_i64gather_epi64( _mm512_loadu_si512( indices ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   return _mm256_i64gather_epi64( reinterpret_cast<const long long*>( address ),
+                                  _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 8 );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_epi64x( address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a strided vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The address of the first integral value.
+// \param stride The distance between two consecutive values.
+// \return The gathered vector of integral values.
+//
+// This function gathers a vector of 8-byte integral values with constant distance. The \a i-th
+// element of the resulting vector is given by \c address[i*stride].
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,8UL>
+                                    , If_t< IsSigned_v<T>, SIMDint64, SIMDuint64 > >
+   gather( const T* address, size_t stride ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   return _mm512_i64gather_epi64( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   const long long s( stride );
+   return _mm256_i64gather_epi64( reinterpret_cast<const long long*>( address ),
+                                  _mm256_set_epi64x( 3*s, 2*s, s, 0 ), 8 );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_epi64x( address[stride], address[0] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values.
+// \param indices The indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address. The \a i-th
+// element of the resulting vector is given by \c address[indices[i]]. The given array of
+// indices must contain at least as many indices as the SIMD vector contains values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   const __m256 v1( _mm512_i64gather_ps( _mm512_loadu_si512( indices     ), address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( _mm512_loadu_si512( indices+8UL ), address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( v1 ) )
+                                              , _mm256_castps_pd( v2 ), 1 ) );
+#elif BLAZE_AVX2_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   const __m128 v1( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ), 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+4UL ) ), 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[indices[7]], address[indices[6]], address[indices[5]], address[indices[4]],
+                         address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'float' values via 32-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values.
+// \param indices The 32-bit indices of the values to be gathered.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values from the given base address. The \a i-th
+// element of the resulting vector is given by \c address[indices[i]]. The given array of
+// indices must contain at least as many indices as the SIMD vector contains values. Since
+// the indices are unsigned, they are zero-extended to 64 bit before the gather.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, const uint32_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const __m512i i1( _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices     ) ) ) );
+   const __m512i i2( _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices+8UL ) ) ) );
+   const __m256 v1( _mm512_i64gather_ps( i1, address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( i2, address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( v1 ) )
+                                              , _mm256_castps_pd( v2 ), 1 ) );
+#elif BLAZE_AVX2_MODE
+   const __m256i i1( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices     ) ) ) );
+   const __m256i i2( _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices+4UL ) ) ) );
+   const __m128 v1( _mm256_i64gather_ps( address, i1, 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, i2, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[indices[7]], address[indices[6]], address[indices[5]], address[indices[4]],
+                         address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a strided vector of 'float' values.
+// \ingroup simd
+//
+// \param address The address of the first 'float' value.
+// \param stride The distance between two consecutive values.
+// \return The gathered vector of 'float' values.
+//
+// This function gathers a vector of 'float' values with constant distance. The \a i-th element
+// of the resulting vector is given by \c address[i*stride].
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat gather( const float* address, size_t stride ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   const __m512i i1( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   const __m512i i2( _mm512_add_epi64( i1, _mm512_set1_epi64( 8*s ) ) );
+   const __m256 v1( _mm512_i64gather_ps( i1, address, 4 ) );
+   const __m256 v2( _mm512_i64gather_ps( i2, address, 4 ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( _mm512_castpd256_pd512( _mm256_castps_pd( v1 ) )
+                                              , _mm256_castps_pd( v2 ), 1 ) );
+#elif BLAZE_AVX2_MODE
+   const long long s( stride );
+   const __m256i i1( _mm256_set_epi64x( 3*s, 2*s, s, 0 ) );
+   const __m256i i2( _mm256_add_epi64( i1, _mm256_set1_epi64x( 4*s ) ) );
+   const __m128 v1( _mm256_i64gather_ps( address, i1, 4 ) );
+   const __m128 v2( _mm256_i64gather_ps( address, i2, 4 ) );
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( v1 ), v2, 1 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_ps( address[7UL*stride], address[6UL*stride], address[5UL*stride], address[4UL*stride],
+                         address[3UL*stride], address[2UL*stride], address[stride], address[0] );
+#elif BLAZE_SSE_MODE
+   return _mm_set_ps( address[3UL*stride], address[2UL*stride], address[stride], address[0] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values.
+// \param indices The indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address. The \a i-th
+// element of the resulting vector is given by \c address[indices[i]]. The given array of
+// indices must contain at least as many indices as the SIMD vector contains values.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, const size_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   return _mm512_i64gather_pd( _mm512_loadu_si512( indices ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   return _mm256_i64gather_pd( address, _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a vector of 'double' values via 32-bit indices.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values.
+// \param indices The 32-bit indices of the values to be gathered.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values from the given base address. The \a i-th
+// element of the resulting vector is given by \c address[indices[i]]. The given array of
+// indices must contain at least as many indices as the SIMD vector contains values. Since
+// the indices are unsigned, they are zero-extended to 64 bit before the gather.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, const uint32_t* indices ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_i64gather_pd( _mm512_cvtepu32_epi64( _mm256_loadu_si256( reinterpret_cast<const __m256i*>( indices ) ) ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   return _mm256_i64gather_pd( address, _mm256_cvtepu32_epi64( _mm_loadu_si128( reinterpret_cast<const __m128i*>( indices ) ) ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[indices[3]], address[indices[2]], address[indices[1]], address[indices[0]] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[indices[1]], address[indices[0]] );
+#else
+   return address[indices[0]];
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Gathers a strided vector of 'double' values.
+// \ingroup simd
+//
+// \param address The address of the first 'double' value.
+// \param stride The distance between two consecutive values.
+// \return The gathered vector of 'double' values.
+//
+// This function gathers a vector of 'double' values with constant distance. The \a i-th element
+// of the resulting vector is given by \c address[i*stride].
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble gather( const double* address, size_t stride ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   return _mm512_i64gather_pd( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ), address, 8 );
+#elif BLAZE_AVX2_MODE
+   const long long s( stride );
+   return _mm256_i64gather_pd( address, _mm256_set_epi64x( 3*s, 2*s, s, 0 ), 8 );
+#elif BLAZE_AVX_MODE
+   return _mm256_set_pd( address[3UL*stride], address[2UL*stride], address[stride], address[0] );
+#elif BLAZE_SSE2_MODE
+   return _mm_set_pd( address[stride], address[0] );
+#else
+   UNUSED_PARAMETER( stride );
+   return *address;
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1590 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Kernels.h
+//  \brief Header file for the Blaze-native SIMD kernels of the elementary functions
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_KERNELS_H_
+#define _BLAZE_MATH_SIMD_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <limits>
+#include <blaze/math/simd/Add.h>
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Div.h>
+#include <blaze/math/simd/FMA.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/Max.h>
+#include <blaze/math/simd/Min.h>
+#include <blaze/math/simd/Mult.h>
+#include <blaze/math/simd/Set.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/math/simd/Sub.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+
+
+//=================================================================================================
+//
+//  DESIGN NOTES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*
+// This file provides the Blaze-native SIMD implementations of the elementary functions \c exp(),
+// \c exp2(), \c exp10(), \c log(), \c log2(), \c log10(), \c sin(), \c cos(), \c pow(), \c erf()
+// and \c tanh(), which are used in case the Intel SVML is not available (see the
+// BLAZE_SIMD_MATH_MODE switch). All kernels are written once in terms of the SIMDfloat and
+// SIMDdouble types and a small set of instruction set specific primitives (comparisons,
+// blending, rounding, and exponent manipulation) for SSE2/SSE4, AVX/AVX2, and AVX-512.
+//
+// All functions follow the classic approach of an exact or extra precise range reduction
+// followed by a minimax polynomial on the reduced interval. The polynomials have been fitted
+// with a Chebyshev fit such that the approximation error is well below the rounding error of
+// the according data type. The resulting maximum errors, measured against a higher precision
+// reference on random and worst-case arguments on SSE2, AVX, AVX2, and AVX-512, are
+// documented at the according functions in the simd/ headers.
+//
+// Special values (NaN, infinities, zeros, subnormal arguments and results) are treated
+// according to the C99 standard. Sine and cosine perform an accurate reduction for arguments
+// up to approximately \f$ 1.6 \cdot 10^6 \f$. In case any element of a vector exceeds this
+// bound, the entire vector is evaluated by means of the scalar standard library functions.
+*/
+/*! \endcond */
+//*************************************************************************************************
+
+
+namespace blaze {
+
+#if BLAZE_SIMD_MATH_MODE
+
+//=================================================================================================
+//
+//  INSTRUCTION SET SPECIFIC PRIMITIVES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if BLAZE_AVX512F_MODE
+
+using SIMDf32Mask = __mmask16;  //!< Mask type for vectors of single precision values.
+using SIMDf64Mask = __mmask8;   //!< Mask type for vectors of double precision values.
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmplt( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_LT_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmplt( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_LT_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmple( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_LE_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmple( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_LE_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpeq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_EQ_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpeq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_EQ_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpneq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_cmp_ps_mask( a.value, b.value, _CMP_NEQ_UQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpneq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_cmp_pd_mask( a.value, b.value, _CMP_NEQ_UQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpunord( const SIMDfloat& a ) noexcept {
+   return _mm512_cmp_ps_mask( a.value, a.value, _CMP_UNORD_Q );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpunord( const SIMDdouble& a ) noexcept {
+   return _mm512_cmp_pd_mask( a.value, a.value, _CMP_UNORD_Q );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskAnd( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return static_cast<SIMDf32Mask>( a & b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskAnd( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return static_cast<SIMDf64Mask>( a & b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskOr( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return static_cast<SIMDf32Mask>( a | b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskOr( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return static_cast<SIMDf64Mask>( a | b );
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf32Mask m ) noexcept {
+   return m != 0;
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf64Mask m ) noexcept {
+   return m != 0;
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat select( SIMDf32Mask m, const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_mask_blend_ps( m, b.value, a.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble select( SIMDf64Mask m, const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_mask_blend_pd( m, b.value, a.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAnd( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_castsi512_ps( _mm512_and_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAnd( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_castsi512_pd( _mm512_and_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAndNot( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_castsi512_ps( _mm512_andnot_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAndNot( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_castsi512_pd( _mm512_andnot_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitOr( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_castsi512_ps( _mm512_or_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitOr( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_castsi512_pd( _mm512_or_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitXor( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm512_castsi512_ps( _mm512_xor_si512( _mm512_castps_si512( a.value ), _mm512_castps_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitXor( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm512_castsi512_pd( _mm512_xor_si512( _mm512_castpd_si512( a.value ), _mm512_castpd_si512( b.value ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat roundNearest( const SIMDfloat& a ) noexcept {
+   return _mm512_roundscale_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble roundNearest( const SIMDdouble& a ) noexcept {
+   return _mm512_roundscale_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat scaleByPow2( const SIMDfloat& a, const SIMDfloat& n ) noexcept {
+   return _mm512_scalef_ps( a.value, n.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble scaleByPow2( const SIMDdouble& a, const SIMDdouble& n ) noexcept {
+   return _mm512_scalef_pd( a.value, n.value );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDfloat& a, SIMDfloat& m, SIMDfloat& e ) noexcept {
+   m = _mm512_getmant_ps( a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src );
+   e = _mm512_add_ps( _mm512_getexp_ps( a.value ), _mm512_set1_ps( 1.0F ) );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDdouble& a, SIMDdouble& m, SIMDdouble& e ) noexcept {
+   m = _mm512_getmant_pd( a.value, _MM_MANT_NORM_p5_1, _MM_MANT_SIGN_src );
+   e = _mm512_add_pd( _mm512_getexp_pd( a.value ), _mm512_set1_pd( 1.0 ) );
+}
+
+BLAZE_ALWAYS_INLINE void convert( const SIMDfloat& a, SIMDdouble& lo, SIMDdouble& hi ) noexcept {
+   lo = _mm512_cvtps_pd( _mm512_castps512_ps256( a.value ) );
+   hi = _mm512_cvtps_pd( _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( a.value ), 1 ) ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat convert( const SIMDdouble& lo, const SIMDdouble& hi ) noexcept {
+   const __m512d tmp( _mm512_castps_pd( _mm512_castps256_ps512( _mm512_cvtpd_ps( lo.value ) ) ) );
+   return _mm512_castpd_ps( _mm512_insertf64x4( tmp, _mm256_castps_pd( _mm512_cvtpd_ps( hi.value ) ), 1 ) );
+}
+
+#elif BLAZE_AVX_MODE
+
+using SIMDf32Mask = __m256;   //!< Mask type for vectors of single precision values.
+using SIMDf64Mask = __m256d;  //!< Mask type for vectors of double precision values.
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmplt( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LT_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmplt( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LT_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmple( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_cmp_ps( a.value, b.value, _CMP_LE_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmple( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_cmp_pd( a.value, b.value, _CMP_LE_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpeq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_cmp_ps( a.value, b.value, _CMP_EQ_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpeq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_cmp_pd( a.value, b.value, _CMP_EQ_OQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpneq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_cmp_ps( a.value, b.value, _CMP_NEQ_UQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpneq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_cmp_pd( a.value, b.value, _CMP_NEQ_UQ );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpunord( const SIMDfloat& a ) noexcept {
+   return _mm256_cmp_ps( a.value, a.value, _CMP_UNORD_Q );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpunord( const SIMDdouble& a ) noexcept {
+   return _mm256_cmp_pd( a.value, a.value, _CMP_UNORD_Q );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskAnd( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return _mm256_and_ps( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskAnd( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return _mm256_and_pd( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskOr( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return _mm256_or_ps( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskOr( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return _mm256_or_pd( a, b );
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf32Mask m ) noexcept {
+   return _mm256_movemask_ps( m ) != 0;
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf64Mask m ) noexcept {
+   return _mm256_movemask_pd( m ) != 0;
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat select( SIMDf32Mask m, const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_blendv_ps( b.value, a.value, m );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble select( SIMDf64Mask m, const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_blendv_pd( b.value, a.value, m );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAnd( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_and_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAnd( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_and_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAndNot( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_andnot_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAndNot( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_andnot_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitOr( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_or_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitOr( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_or_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitXor( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm256_xor_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitXor( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm256_xor_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat roundNearest( const SIMDfloat& a ) noexcept {
+   return _mm256_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble roundNearest( const SIMDdouble& a ) noexcept {
+   return _mm256_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+}
+
+BLAZE_ALWAYS_INLINE __m256i shiftLeft52( __m256i a ) noexcept {
+#if BLAZE_AVX2_MODE
+   return _mm256_slli_epi64( a, 52 );
+#else
+   const __m128i lo( _mm_slli_epi64( _mm256_castsi256_si128( a ), 52 ) );
+   const __m128i hi( _mm_slli_epi64( _mm256_extractf128_si256( a, 1 ), 52 ) );
+   return _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE __m256i shiftRight52( __m256i a ) noexcept {
+#if BLAZE_AVX2_MODE
+   return _mm256_srli_epi64( a, 52 );
+#else
+   const __m128i lo( _mm_srli_epi64( _mm256_castsi256_si128( a ), 52 ) );
+   const __m128i hi( _mm_srli_epi64( _mm256_extractf128_si256( a, 1 ), 52 ) );
+   return _mm256_insertf128_si256( _mm256_castsi128_si256( lo ), hi, 1 );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat pow2n( const SIMDfloat& n ) noexcept {
+   const __m256 bits( _mm256_mul_ps( _mm256_add_ps( n.value, _mm256_set1_ps( 127.0F ) ), _mm256_set1_ps( 8388608.0F ) ) );
+   return _mm256_castsi256_ps( _mm256_cvtps_epi32( bits ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble pow2n( const SIMDdouble& n ) noexcept {
+   const __m256d bits( _mm256_add_pd( n.value, _mm256_set1_pd( 4503599627371519.0 ) ) );
+   return _mm256_castsi256_pd( shiftLeft52( _mm256_castpd_si256( bits ) ) );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDfloat& a, SIMDfloat& m, SIMDfloat& e ) noexcept {
+   const __m256 expmask( _mm256_castsi256_ps( _mm256_set1_epi32( 0x7F800000 ) ) );
+   const __m256 biased( _mm256_cvtepi32_ps( _mm256_castps_si256( _mm256_and_ps( a.value, expmask ) ) ) );
+   e = _mm256_sub_ps( _mm256_mul_ps( biased, _mm256_set1_ps( 1.1920928955078125E-7F ) ), _mm256_set1_ps( 126.0F ) );
+   m = _mm256_or_ps( _mm256_andnot_ps( expmask, a.value ), _mm256_set1_ps( 0.5F ) );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDdouble& a, SIMDdouble& m, SIMDdouble& e ) noexcept {
+   const __m256d expmask( _mm256_castsi256_pd( _mm256_set1_epi64x( 0x7FF0000000000000LL ) ) );
+   const __m256d magic( _mm256_set1_pd( 4503599627370496.0 ) );
+   const __m256i biased( shiftRight52( _mm256_castpd_si256( _mm256_and_pd( a.value, expmask ) ) ) );
+   e = _mm256_sub_pd( _mm256_or_pd( _mm256_castsi256_pd( biased ), magic ), _mm256_set1_pd( 4503599627371518.0 ) );
+   m = _mm256_or_pd( _mm256_andnot_pd( expmask, a.value ), _mm256_set1_pd( 0.5 ) );
+}
+
+BLAZE_ALWAYS_INLINE void convert( const SIMDfloat& a, SIMDdouble& lo, SIMDdouble& hi ) noexcept {
+   lo = _mm256_cvtps_pd( _mm256_castps256_ps128( a.value ) );
+   hi = _mm256_cvtps_pd( _mm256_extractf128_ps( a.value, 1 ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat convert( const SIMDdouble& lo, const SIMDdouble& hi ) noexcept {
+   return _mm256_insertf128_ps( _mm256_castps128_ps256( _mm256_cvtpd_ps( lo.value ) ), _mm256_cvtpd_ps( hi.value ), 1 );
+}
+
+#elif BLAZE_SSE2_MODE
+
+using SIMDf32Mask = __m128;   //!< Mask type for vectors of single precision values.
+using SIMDf64Mask = __m128d;  //!< Mask type for vectors of double precision values.
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmplt( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_cmplt_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmplt( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_cmplt_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmple( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_cmple_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmple( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_cmple_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpeq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_cmpeq_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpeq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_cmpeq_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpneq( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_cmpneq_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpneq( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_cmpneq_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask cmpunord( const SIMDfloat& a ) noexcept {
+   return _mm_cmpunord_ps( a.value, a.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask cmpunord( const SIMDdouble& a ) noexcept {
+   return _mm_cmpunord_pd( a.value, a.value );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskAnd( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return _mm_and_ps( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskAnd( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return _mm_and_pd( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf32Mask maskOr( SIMDf32Mask a, SIMDf32Mask b ) noexcept {
+   return _mm_or_ps( a, b );
+}
+
+BLAZE_ALWAYS_INLINE SIMDf64Mask maskOr( SIMDf64Mask a, SIMDf64Mask b ) noexcept {
+   return _mm_or_pd( a, b );
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf32Mask m ) noexcept {
+   return _mm_movemask_ps( m ) != 0;
+}
+
+BLAZE_ALWAYS_INLINE bool anyOf( SIMDf64Mask m ) noexcept {
+   return _mm_movemask_pd( m ) != 0;
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat select( SIMDf32Mask m, const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+#if BLAZE_SSE4_MODE
+   return _mm_blendv_ps( b.value, a.value, m );
+#else
+   return _mm_or_ps( _mm_and_ps( m, a.value ), _mm_andnot_ps( m, b.value ) );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble select( SIMDf64Mask m, const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+#if BLAZE_SSE4_MODE
+   return _mm_blendv_pd( b.value, a.value, m );
+#else
+   return _mm_or_pd( _mm_and_pd( m, a.value ), _mm_andnot_pd( m, b.value ) );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAnd( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_and_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAnd( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_and_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitAndNot( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_andnot_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitAndNot( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_andnot_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitOr( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_or_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitOr( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_or_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat bitXor( const SIMDfloat& a, const SIMDfloat& b ) noexcept {
+   return _mm_xor_ps( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble bitXor( const SIMDdouble& a, const SIMDdouble& b ) noexcept {
+   return _mm_xor_pd( a.value, b.value );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat roundNearest( const SIMDfloat& a ) noexcept {
+#if BLAZE_SSE4_MODE
+   return _mm_round_ps( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+   const __m128 sign ( _mm_set1_ps( -0.0F ) );
+   const __m128 magic( _mm_set1_ps( 8388608.0F ) );
+   const __m128 abs  ( _mm_andnot_ps( sign, a.value ) );
+   const __m128 tmp  ( _mm_or_ps( _mm_sub_ps( _mm_add_ps( abs, magic ), magic ), _mm_and_ps( sign, a.value ) ) );
+   const __m128 mask ( _mm_cmplt_ps( abs, magic ) );
+   return _mm_or_ps( _mm_and_ps( mask, tmp ), _mm_andnot_ps( mask, a.value ) );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble roundNearest( const SIMDdouble& a ) noexcept {
+#if BLAZE_SSE4_MODE
+   return _mm_round_pd( a.value, _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC );
+#else
+   const __m128d sign ( _mm_set1_pd( -0.0 ) );
+   const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );
+   const __m128d abs  ( _mm_andnot_pd( sign, a.value ) );
+   const __m128d tmp  ( _mm_or_pd( _mm_sub_pd( _mm_add_pd( abs, magic ), magic ), _mm_and_pd( sign, a.value ) ) );
+   const __m128d mask ( _mm_cmplt_pd( abs, magic ) );
+   return _mm_or_pd( _mm_and_pd( mask, tmp ), _mm_andnot_pd( mask, a.value ) );
+#endif
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat pow2n( const SIMDfloat& n ) noexcept {
+   const __m128 bits( _mm_mul_ps( _mm_add_ps( n.value, _mm_set1_ps( 127.0F ) ), _mm_set1_ps( 8388608.0F ) ) );
+   return _mm_castsi128_ps( _mm_cvtps_epi32( bits ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDdouble pow2n( const SIMDdouble& n ) noexcept {
+   const __m128d bits( _mm_add_pd( n.value, _mm_set1_pd( 4503599627371519.0 ) ) );
+   return _mm_castsi128_pd( _mm_slli_epi64( _mm_castpd_si128( bits ), 52 ) );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDfloat& a, SIMDfloat& m, SIMDfloat& e ) noexcept {
+   const __m128 expmask( _mm_castsi128_ps( _mm_set1_epi32( 0x7F800000 ) ) );
+   const __m128 biased( _mm_cvtepi32_ps( _mm_castps_si128( _mm_and_ps( a.value, expmask ) ) ) );
+   e = _mm_sub_ps( _mm_mul_ps( biased, _mm_set1_ps( 1.1920928955078125E-7F ) ), _mm_set1_ps( 126.0F ) );
+   m = _mm_or_ps( _mm_andnot_ps( expmask, a.value ), _mm_set1_ps( 0.5F ) );
+}
+
+BLAZE_ALWAYS_INLINE void decompose( const SIMDdouble& a, SIMDdouble& m, SIMDdouble& e ) noexcept {
+   const __m128d expmask( _mm_castsi128_pd( _mm_set1_epi64x( 0x7FF0000000000000LL ) ) );
+   const __m128d magic( _mm_set1_pd( 4503599627370496.0 ) );
+   const __m128i biased( _mm_srli_epi64( _mm_castpd_si128( _mm_and_pd( a.value, expmask ) ), 52 ) );
+   e = _mm_sub_pd( _mm_or_pd( _mm_castsi128_pd( biased ), magic ), _mm_set1_pd( 4503599627371518.0 ) );
+   m = _mm_or_pd( _mm_andnot_pd( expmask, a.value ), _mm_set1_pd( 0.5 ) );
+}
+
+BLAZE_ALWAYS_INLINE void convert( const SIMDfloat& a, SIMDdouble& lo, SIMDdouble& hi ) noexcept {
+   lo = _mm_cvtps_pd( a.value );
+   hi = _mm_cvtps_pd( _mm_movehl_ps( a.value, a.value ) );
+}
+
+BLAZE_ALWAYS_INLINE const SIMDfloat convert( const SIMDdouble& lo, const SIMDdouble& hi ) noexcept {
+   return _mm_movelh_ps( _mm_cvtpd_ps( lo.value ), _mm_cvtpd_ps( hi.value ) );
+}
+
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !BLAZE_AVX512F_MODE
+/*!\brief Computes \f$ a \cdot 2^n \f$ for a vector of single precision values.
+// \ingroup simd
+//
+// \param a The vector of single precision values.
+// \param n The vector of integral exponents in the range \f$ [-300..300] \f$.
+// \return The resulting vector.
+//
+// The scaling is performed in two steps to cover the subnormal range with a single rounding.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat scaleByPow2( const SIMDfloat& a, const SIMDfloat& n ) noexcept
+{
+   const SIMDfloat n1( roundNearest( n * set( 0.5F ) ) );
+   return ( a * pow2n( n1 ) ) * pow2n( n - n1 );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+#if !BLAZE_AVX512F_MODE
+/*!\brief Computes \f$ a \cdot 2^n \f$ for a vector of double precision values.
+// \ingroup simd
+//
+// \param a The vector of double precision values.
+// \param n The vector of integral exponents in the range \f$ [-2000..2000] \f$.
+// \return The resulting vector.
+//
+// The scaling is performed in two steps to cover the subnormal range with a single rounding.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble scaleByPow2( const SIMDdouble& a, const SIMDdouble& n ) noexcept
+{
+   const SIMDdouble n1( roundNearest( n * set( 0.5 ) ) );
+   return ( a * pow2n( n1 ) ) * pow2n( n - n1 );
+}
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Termination of the Horner scheme.
+// \ingroup simd
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T horner( const T& /*x*/, const T& p ) noexcept
+{
+   return p;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Single step of the Horner scheme.
+// \ingroup simd
+*/
+template< typename T          // Type of the SIMD vector
+        , typename... Cs >    // Types of the remaining coefficients
+BLAZE_ALWAYS_INLINE const T horner( const T& x, const T& p, typename T::ValueType c, Cs... cs ) noexcept
+{
+   return horner( x, T( p*x + set( c ) ), cs... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a polynomial by means of the Horner scheme.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param c The coefficient of the highest power, followed by all remaining coefficients.
+// \return The resulting vector.
+*/
+template< typename T          // Type of the SIMD vector
+        , typename... Cs >    // Types of the remaining coefficients
+BLAZE_ALWAYS_INLINE const T polynomial( const T& x, typename T::ValueType c, Cs... cs ) noexcept
+{
+   return horner( x, T( set( c ) ), cs... );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the sum \f$ s + e = a + b \f$ without rounding error.
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE void twoSum( const SIMDdouble& a, const SIMDdouble& b, SIMDdouble& s, SIMDdouble& e ) noexcept
+{
+   s = a + b;
+   const SIMDdouble bb( s - a );
+   e = ( a - ( s - bb ) ) + ( b - bb );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the product \f$ p + e = a \cdot b \f$ without rounding error.
+// \ingroup simd
+//
+// In case FMA is not available the product is computed via Dekker's algorithm, which requires
+// \f$ |a|,|b| < 2^{995} \f$.
+*/
+BLAZE_ALWAYS_INLINE void twoProduct( const SIMDdouble& a, const SIMDdouble& b, SIMDdouble& p, SIMDdouble& e ) noexcept
+{
+   p = a * b;
+#if BLAZE_FMA_MODE
+   e = a*b - p;
+#else
+   const SIMDdouble split( set( 134217729.0 ) );
+   const SIMDdouble ta( split * a ), tb( split * b );
+   const SIMDdouble ah( ta - ( ta - a ) ), bh( tb - ( tb - b ) );
+   const SIMDdouble al( a - ah ), bl( b - bh );
+   e = ( ( ( ah*bh - p ) + ah*bl ) + al*bh ) + al*bl;
+#endif
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar evaluation of an elementary function for all elements of a SIMD vector.
+// \ingroup simd
+//
+// \param a The vector of arguments.
+// \param op The scalar operation.
+// \return The resulting vector.
+*/
+template< typename T     // Type of the SIMD vector
+        , typename OP >  // Type of the scalar operation
+inline const T scalarFallback( const T& a, OP op ) noexcept
+{
+   typename T::ValueType tmp[T::size];
+   storeu( tmp, a );
+   for( size_t i=0UL; i<T::size; ++i ) {
+      tmp[i] = op( tmp[i] );
+   }
+   return loadu( tmp );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPONENTIAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^r \f$ for \f$ |r| \le \ln(2)/2 \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat expPolynomial( const SIMDfloat& r ) noexcept
+{
+   const SIMDfloat r2( r * r );
+   const SIMDfloat q( polynomial( r, 1.989098091E-04F, 1.393364160E-03F, 8.333310485E-03F,
+                                     4.166646674E-02F, 1.666666716E-01F, 5.000000000E-01F ) );
+   return set( 1.0F ) + SIMDfloat( r2*q + r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^r \f$ for \f$ |r| \le \ln(2)/2 \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble expPolynomial( const SIMDdouble& r ) noexcept
+{
+   const SIMDdouble r2( r * r );
+   const SIMDdouble q( polynomial( r, 2.09146793765839349E-09, 2.51052063739570109E-08,
+                                      2.75572736613486373E-07, 2.75572554257464351E-06,
+                                      2.48015873255333634E-05, 1.98412698748004929E-04,
+                                      1.38888888888837525E-03, 8.33333333332614105E-03,
+                                      4.16666666666666713E-02, 1.66666666666666713E-01,
+                                      5.00000000000000000E-01 ) );
+   return set( 1.0 ) + SIMDdouble( r2*q + r );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^x \f$ for \f$ x \in [-104..89] \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat expCore( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat n( roundNearest( x * set( 1.44269504F ) ) );
+   const SIMDfloat r( SIMDfloat( x - n*set( 0.693359375F ) ) - n*set( -2.12194440E-4F ) );
+   return scaleByPow2( expPolynomial( r ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ e^{x+xl} \f$ for \f$ x \in [-746..710] \f$ and \f$ |xl| \ll |x| \f$
+//        (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble expCore( const SIMDdouble& x, const SIMDdouble& xl ) noexcept
+{
+   const SIMDdouble n( roundNearest( x * set( 1.44269504088896339 ) ) );
+   const SIMDdouble t( x - n*set( 6.93147180369123816E-01 ) );
+   const SIMDdouble r( SIMDdouble( t + xl ) - n*set( 1.90821492927058770E-10 ) );
+   return scaleByPow2( expPolynomial( r ), n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ e^x \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat expKernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat xc( min( max( x, set( -104.0F ) ), set( 89.0F ) ) );
+   return select( cmpunord( x ), x, expCore( xc ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ e^x \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble expKernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble xc( min( max( x, set( -746.0 ) ), set( 710.0 ) ) );
+   return select( cmpunord( x ), x, expCore( xc, set( 0.0 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ 2^x \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat exp2Kernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat xc( min( max( x, set( -151.0F ) ), set( 129.0F ) ) );
+   const SIMDfloat n( roundNearest( xc ) );
+   const SIMDfloat r( SIMDfloat( xc - n ) * set( 0.693147181F ) );
+   return select( cmpunord( x ), x, scaleByPow2( expPolynomial( r ), n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ 2^x \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble exp2Kernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble xc( min( max( x, set( -1076.0 ) ), set( 1025.0 ) ) );
+   const SIMDdouble n( roundNearest( xc ) );
+   const SIMDdouble r( SIMDdouble( xc - n ) * set( 6.93147180559945286E-01 ) );
+   return select( cmpunord( x ), x, scaleByPow2( expPolynomial( r ), n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ 10^x \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat exp10Kernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat xc( min( max( x, set( -46.0F ) ), set( 39.0F ) ) );
+   const SIMDfloat n( roundNearest( xc * set( 3.32192809F ) ) );
+   const SIMDfloat t( SIMDfloat( xc - n*set( 3.010253906E-01F ) ) - n*set( 4.605039067E-06F ) );
+   const SIMDfloat r( t * set( 2.30258509F ) );
+   return select( cmpunord( x ), x, scaleByPow2( expPolynomial( r ), n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ 10^x \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble exp10Kernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble xc( min( max( x, set( -325.0 ) ), set( 309.0 ) ) );
+   const SIMDdouble n( roundNearest( xc * set( 3.32192809488736218 ) ) );
+   const SIMDdouble t( SIMDdouble( xc - n*set( 3.01029995663952832E-01 ) ) - n*set( 2.83633945510449642E-14 ) );
+   const SIMDdouble r( t * set( 2.30258509299404590 ) );
+   return select( cmpunord( x ), x, scaleByPow2( expPolynomial( r ), n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOGARITHMIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of the argument of a logarithm (single precision).
+// \ingroup simd
+//
+// \param x The vector of positive arguments.
+// \param f The resulting vector of reduced arguments \f$ f \in [\sqrt{1/2}-1..\sqrt{2}-1) \f$.
+// \param e The resulting vector of exponents such that \f$ x = (1+f) \cdot 2^e \f$.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void logReduce( const SIMDfloat& x, SIMDfloat& f, SIMDfloat& e ) noexcept
+{
+   const SIMDf32Mask tiny( cmplt( x, set( 1.17549435E-38F ) ) );
+   SIMDfloat m;
+   decompose( select( tiny, x * set( 16777216.0F ), x ), m, e );
+   e = select( tiny, e - set( 24.0F ), e );
+   const SIMDf32Mask small( cmplt( m, set( 0.707106781F ) ) );
+   f = select( small, m + m, m ) - set( 1.0F );
+   e = select( small, e - set( 1.0F ), e );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reduction of the argument of a logarithm (double precision).
+// \ingroup simd
+//
+// \param x The vector of positive arguments.
+// \param f The resulting vector of reduced arguments \f$ f \in [\sqrt{1/2}-1..\sqrt{2}-1) \f$.
+// \param e The resulting vector of exponents such that \f$ x = (1+f) \cdot 2^e \f$.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void logReduce( const SIMDdouble& x, SIMDdouble& f, SIMDdouble& e ) noexcept
+{
+   const SIMDf64Mask tiny( cmplt( x, set( 2.2250738585072014E-308 ) ) );
+   SIMDdouble m;
+   decompose( select( tiny, x * set( 18014398509481984.0 ), x ), m, e );
+   e = select( tiny, e - set( 54.0 ), e );
+   const SIMDf64Mask small( cmplt( m, set( 0.70710678118654752 ) ) );
+   f = select( small, m + m, m ) - set( 1.0 );
+   e = select( small, e - set( 1.0 ), e );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ \log(1+f) - f \f$ for \f$ f \in [\sqrt{1/2}-1..\sqrt{2}-1) \f$
+//        (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat logPolynomial( const SIMDfloat& f ) noexcept
+{
+   const SIMDfloat f2( f * f );
+   const SIMDfloat p( polynomial( f, 6.971611828E-02F, -1.147973388E-01F, 1.168541983E-01F,
+                                    -1.242568716E-01F, 1.424905807E-01F, -1.666780263E-01F,
+                                     2.000071555E-01F, -2.499999702E-01F, 3.333333135E-01F ) );
+   return SIMDfloat( f2 * f ) * p - f2 * set( 0.5F );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes the components of \f$ \log(1+f) = f - (h - t) \f$ for
+//        \f$ f \in [\sqrt{1/2}-1..\sqrt{2}-1) \f$ (double precision).
+// \ingroup simd
+//
+// \param f The vector of reduced arguments.
+// \param h The resulting vector \f$ h = f^2/2 \f$.
+// \param t The resulting vector \f$ t = s \cdot (h + R(s^2)) \f$ with \f$ s = f/(2+f) \f$.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void logPolynomial( const SIMDdouble& f, SIMDdouble& h, SIMDdouble& t ) noexcept
+{
+   const SIMDdouble s( f / SIMDdouble( set( 2.0 ) + f ) );
+   const SIMDdouble z( s * s );
+   const SIMDdouble R( z * polynomial( z, 1.46164496850434061E-01, 1.53317216005560419E-01,
+                                          1.81828891252617225E-01, 2.22222111347950807E-01,
+                                          2.85714286259754868E-01, 3.99999999998995048E-01,
+                                          6.66666666666666963E-01 ) );
+   h = set( 0.5 ) * f * f;
+   t = s * SIMDdouble( h + R );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Treatment of the special arguments of a logarithm.
+// \ingroup simd
+//
+// \param x The vector of arguments.
+// \param y The vector of results for positive, finite arguments.
+// \return The vector of results for all arguments.
+*/
+template< typename T >  // Type of the SIMD vector
+BLAZE_ALWAYS_INLINE const T logSpecial( const T& x, const T& y ) noexcept
+{
+   using ET = typename T::ValueType;
+
+   const T zero  ( set( ET(0) ) );
+   const T posInf( set( std::numeric_limits<ET>::infinity() ) );
+
+   T res( select( cmpeq( x, zero ), T( zero - posInf ), y ) );
+   res = select( cmpeq( x, posInf ), posInf, res );
+   res = select( cmplt( x, zero ), set( std::numeric_limits<ET>::quiet_NaN() ), res );
+   return select( cmpunord( x ), x, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \ln(x) \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat logKernel( const SIMDfloat& x ) noexcept
+{
+   SIMDfloat f, e;
+   logReduce( x, f, e );
+   const SIMDfloat y( logPolynomial( f ) + e*set( -2.12194440E-4F ) );
+   return logSpecial( x, SIMDfloat( SIMDfloat( f + y ) + e*set( 0.693359375F ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \ln(x) \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble logKernel( const SIMDdouble& x ) noexcept
+{
+   SIMDdouble f, e, h, t;
+   logReduce( x, f, e );
+   logPolynomial( f, h, t );
+   const SIMDdouble lo( f - SIMDdouble( h - SIMDdouble( t + e*set( 1.90821492927058770E-10 ) ) ) );
+   return logSpecial( x, SIMDdouble( e*set( 6.93147180369123816E-01 ) + lo ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \log_2(x) \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat log2Kernel( const SIMDfloat& x ) noexcept
+{
+   SIMDfloat f, e;
+   logReduce( x, f, e );
+   const SIMDfloat y( logPolynomial( f ) );
+   const SIMDfloat t( y*set( 1.442695022E+00F ) + f*set( 1.925963034E-08F ) );
+   return logSpecial( x, SIMDfloat( SIMDfloat( f*set( 1.442695022E+00F ) + t ) + e ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \log_2(x) \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble log2Kernel( const SIMDdouble& x ) noexcept
+{
+   SIMDdouble f, e, h, t;
+   logReduce( x, f, e );
+   logPolynomial( f, h, t );
+   const SIMDdouble y( t - h );
+   const SIMDdouble u( y*set( 1.44269504088896339E+00 ) + f*set( 2.03552737409310331E-17 ) );
+   return logSpecial( x, SIMDdouble( SIMDdouble( f*set( 1.44269504088896339E+00 ) + u ) + e ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \log_{10}(x) \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat log10Kernel( const SIMDfloat& x ) noexcept
+{
+   SIMDfloat f, e;
+   logReduce( x, f, e );
+   const SIMDfloat y( logPolynomial( f ) );
+   const SIMDfloat t( SIMDfloat( y*set( 4.342944920E-01F ) + f*set( -1.010304995E-08F ) ) + e*set( 4.605039067E-06F ) );
+   return logSpecial( x, SIMDfloat( SIMDfloat( f*set( 4.342944920E-01F ) + t ) + e*set( 3.010253906E-01F ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \log_{10}(x) \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble log10Kernel( const SIMDdouble& x ) noexcept
+{
+   SIMDdouble f, e, h, t;
+   logReduce( x, f, e );
+   logPolynomial( f, h, t );
+   const SIMDdouble y( t - h );
+   const SIMDdouble u( SIMDdouble( y*set( 4.34294481903251817E-01 ) + f*set( 1.09831965021676507E-17 ) ) + e*set( 2.83633945510449642E-14 ) );
+   return logSpecial( x, SIMDdouble( SIMDdouble( f*set( 4.34294481903251817E-01 ) + u ) + e*set( 3.01029995663952832E-01 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  POWER FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ \ln(x) = hi + lo \f$ with approximately 64 bits of precision
+//        (double precision).
+// \ingroup simd
+//
+// \param x The vector of positive, finite arguments.
+// \param hi The resulting vector of leading components.
+// \param lo The resulting vector of trailing components.
+// \return void
+*/
+BLAZE_ALWAYS_INLINE void logExtended( const SIMDdouble& x, SIMDdouble& hi, SIMDdouble& lo ) noexcept
+{
+   SIMDdouble f, e;
+   logReduce( x, f, e );
+
+   // s + sl = f / ( 2 + f )
+   const SIMDdouble d ( set( 2.0 ) + f );
+   const SIMDdouble dl( SIMDdouble( set( 2.0 ) - d ) + f );
+   const SIMDdouble s ( f / d );
+   SIMDdouble ph, pl;
+   twoProduct( s, d, ph, pl );
+   const SIMDdouble sl( SIMDdouble( SIMDdouble( SIMDdouble( f - ph ) - pl ) - s*dl ) / d );
+
+   // ln(1+f) = 2(s+sl) + 2/3 (s+sl)^3 + s^5 R(s^2), where the cubic term is computed as
+   // th + tl with an additional 53 bits of precision
+   SIMDdouble zh, zl, ch, cl, th, tl;
+   twoProduct( s, s, zh, zl );
+   twoProduct( zh, s, ch, cl );
+   cl = cl + zl*s;
+   twoProduct( ch, set( 6.66666666666666630E-01 ), th, tl );
+   tl = tl + SIMDdouble( SIMDdouble( ch*set( 3.70074341541718826E-17 ) + cl*set( 6.66666666666666630E-01 ) ) + zh*SIMDdouble( sl + sl ) );
+
+   const SIMDdouble R( SIMDdouble( s*zh ) * SIMDdouble( zh * polynomial( zh, 1.29134960668031512E-01, 1.32859672738906143E-01,
+                                                                              1.53855745004588290E-01, 1.81818082516073981E-01,
+                                                                              2.22222222710774492E-01, 2.85714285713385585E-01,
+                                                                              4.00000000000000244E-01 ) ) );
+
+   SIMDdouble h1, l1, h2, l2;
+   twoSum( e*set( 6.93147180369123816E-01 ), s + s, h1, l1 );
+   twoSum( h1, th, h2, l2 );
+   const SIMDdouble l( SIMDdouble( l1 + l2 ) + SIMDdouble( SIMDdouble( sl + sl ) + SIMDdouble( SIMDdouble( tl + R ) + e*set( 1.90821492927058770E-10 ) ) ) );
+   hi = h2 + l;
+   lo = l - SIMDdouble( hi - h2 );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ x^y \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble powKernel( const SIMDdouble& x, const SIMDdouble& y ) noexcept
+{
+   const SIMDdouble zero  ( set(  0.0 ) );
+   const SIMDdouble one   ( set(  1.0 ) );
+   const SIMDdouble sign  ( set( -0.0 ) );
+   const SIMDdouble posInf( set( std::numeric_limits<double>::infinity() ) );
+
+   const SIMDdouble ax( bitAndNot( sign, x ) );
+   const SIMDdouble ay( bitAndNot( sign, y ) );
+
+   // y * ln|x| = ph + pl
+   SIMDdouble lh, ll, ph, pl;
+   logExtended( ax, lh, ll );
+   twoProduct( y, lh, ph, pl );
+   pl = select( cmplt( bitAndNot( sign, ph ), set( 750.0 ) ), SIMDdouble( pl + y*ll ), zero );
+   ph = min( max( ph, set( -746.0 ) ), set( 710.0 ) );
+   SIMDdouble res( expCore( ph, pl ) );
+
+   // Zero and infinite arguments
+   const SIMDf64Mask yneg( cmplt( y, zero ) );
+   res = select( cmpeq( ax, zero   ), select( yneg, posInf, zero ), res );
+   res = select( cmpeq( ax, posInf ), select( yneg, zero, posInf ), res );
+   res = select( cmpeq( ay, posInf ),
+                 select( cmplt( ax, one ), select( yneg, posInf, zero ),
+                                           select( yneg, zero, posInf ) ), res );
+   res = select( cmpeq( ax, one ), one, res );
+
+   // Negative arguments
+   const SIMDdouble yr( roundNearest( y ) );
+   const SIMDdouble yh( y * set( 0.5 ) );
+   const SIMDf64Mask odd( maskAnd( cmpeq( yr, y ), cmpneq( roundNearest( yh ), yh ) ) );
+   res = bitXor( res, bitAnd( x, select( odd, sign, zero ) ) );
+   res = select( maskAnd( maskAnd( cmplt( x, zero ), cmplt( ax, posInf ) ), cmpneq( yr, y ) ),
+                 set( std::numeric_limits<double>::quiet_NaN() ), res );
+
+   // NaN arguments and the unconditional cases pow(1,y) = pow(x,0) = 1
+   res = select( maskOr( cmpunord( x ), cmpunord( y ) ), x + y, res );
+   return select( maskOr( cmpeq( x, one ), cmpeq( y, zero ) ), one, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ x^y \f$ (single precision).
+// \ingroup simd
+//
+// The single precision power function is evaluated via the double precision kernel.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat powKernel( const SIMDfloat& x, const SIMDfloat& y ) noexcept
+{
+   SIMDdouble xl, xh, yl, yh;
+   convert( x, xl, xh );
+   convert( y, yl, yh );
+   return convert( powKernel( xl, yl ), powKernel( xh, yh ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TRIGONOMETRIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computes \f$ \sin(x) \f$ or \f$ \cos(x) \f$ for \f$ |x| \le 1.6 \cdot 10^6 \f$
+//        (double precision).
+// \ingroup simd
+//
+// The argument is reduced to \f$ r \in [-\pi/4..\pi/4] \f$ by a Cody-Waite reduction with
+// \f$ \pi/2 \f$ split into 33-bit chunks, which is exact for quadrants up to \f$ 2^{20} \f$.
+// The reduced argument is kept as the unevaluated sum \f$ r + rl \f$.
+// In case \a Single is \a true, the reduction and polynomials are shortened to the accuracy
+// required for single precision arguments and results.
+*/
+template< bool Cosine    // Flag for the computation of the cosine
+        , bool Single >  // Flag for single precision accuracy
+BLAZE_ALWAYS_INLINE const SIMDdouble sincosCore( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble q( roundNearest( x * set( 6.36619772367581382E-01 ) ) );
+
+   // Reduction to r + rl = x - q*pi/2
+   const SIMDdouble r1( x - q*set( 1.57079632673412561417E+00 ) );
+   SIMDdouble r, rl;
+   if( Single ) {
+      r = r1 - q*set( 6.07710050650619224932E-11 );
+   }
+   else {
+      SIMDdouble r2, e2, r3, e3;
+      twoSum( r1, q*set( -6.07710050630396597660E-11 ), r2, e2 );
+      twoSum( r2, q*set( -2.02226624871116645580E-21 ), r3, e3 );
+      const SIMDdouble t( SIMDdouble( e2 + e3 ) - q*set( 8.47842766036889956997E-32 ) );
+      r  = r3 + t;
+      rl = t - SIMDdouble( r - r3 );
+   }
+
+   const SIMDdouble z( r * r );
+   SIMDdouble sinr, cosr;
+   if( Single ) {
+      sinr = SIMDdouble( r*z ) * polynomial( z, 2.724992555E-06, -1.984008704E-04,
+                                                8.333331905E-03, -1.666666716E-01 ) + r;
+      cosr = SIMDdouble( z*z ) * polynomial( z, -2.730095900E-07, 2.480059993E-05,
+                                                -1.388888806E-03, 4.166666791E-02 ) + SIMDdouble( set( 1.0 ) - z*set( 0.5 ) );
+   }
+   else {
+      const SIMDdouble hz( z * set( 0.5 ) );
+      const SIMDdouble s ( SIMDdouble( r*z ) * polynomial( z, -7.58669711770691831E-13, 1.60585316189861469E-10,
+                                                              -2.50521062324475780E-08, 2.75573192193391672E-06,
+                                                              -1.98412698412650653E-04, 8.33333333333333148E-03,
+                                                              -1.66666666666666657E-01 ) );
+      sinr = r + SIMDdouble( s + SIMDdouble( rl - hz*rl ) );
+      const SIMDdouble w ( set( 1.0 ) - hz );
+      const SIMDdouble c ( SIMDdouble( z*z ) * polynomial( z, -1.13826324255217172E-11, 2.08761462684031992E-09,
+                                                              -2.75573172717297931E-07, 2.48015872987656891E-05,
+                                                              -1.38888888888873976E-03, 4.16666666666666644E-02 ) );
+      cosr = w + SIMDdouble( SIMDdouble( SIMDdouble( set( 1.0 ) - w ) - hz ) + SIMDdouble( c - r*rl ) );
+   }
+
+   // Selection of the polynomial by the quadrant k and the sign by bit 1 of k
+   const SIMDdouble k( Cosine ? SIMDdouble( q + set( 1.0 ) ) : q );
+   const SIMDdouble k2( roundNearest( k * set( 0.5  ) ) );
+   const SIMDdouble k4( k - set( 4.0 ) * roundNearest( k * set( 0.25 ) ) );
+   const SIMDf64Mask odd( cmpneq( k, k2 + k2 ) );
+   const SIMDf64Mask neg( maskOr( cmplt( k4, set( 0.0 ) ), cmplt( set( 1.5 ), k4 ) ) );
+
+   return bitXor( select( odd, cosr, sinr ), select( neg, set( -0.0 ), set( 0.0 ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \sin(x) \f$ or \f$ \cos(x) \f$ (single precision).
+// \ingroup simd
+*/
+template< bool Cosine >  // Flag for the computation of the cosine
+BLAZE_ALWAYS_INLINE const SIMDfloat sincosKernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat ax( bitAndNot( set( -0.0F ), x ) );
+
+   if( anyOf( maskOr( cmplt( set( 1.6E6F ), ax ), cmpunord( x ) ) ) ) {
+      return Cosine ? scalarFallback( x, []( float v ){ return std::cos( v ); } )
+                    : scalarFallback( x, []( float v ){ return std::sin( v ); } );
+   }
+
+   SIMDdouble lo, hi;
+   convert( x, lo, hi );
+   const SIMDfloat res( convert( sincosCore<Cosine,true>( lo ), sincosCore<Cosine,true>( hi ) ) );
+   return Cosine ? res : select( cmpeq( x, set( 0.0F ) ), x, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \sin(x) \f$ or \f$ \cos(x) \f$ (double precision).
+// \ingroup simd
+*/
+template< bool Cosine >  // Flag for the computation of the cosine
+BLAZE_ALWAYS_INLINE const SIMDdouble sincosKernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble ax( bitAndNot( set( -0.0 ), x ) );
+
+   if( anyOf( maskOr( cmplt( set( 1.6E6 ), ax ), cmpunord( x ) ) ) ) {
+      return Cosine ? scalarFallback( x, []( double v ){ return std::cos( v ); } )
+                    : scalarFallback( x, []( double v ){ return std::sin( v ); } );
+   }
+
+   const SIMDdouble res( sincosCore<Cosine,false>( x ) );
+   return Cosine ? res : select( cmpeq( x, set( 0.0 ) ), x, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HYPERBOLIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \tanh(x) \f$ (single precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat tanhKernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat sign( set( -0.0F ) );
+   const SIMDfloat ax( bitAndNot( sign, x ) );
+   const SIMDfloat z( x * x );
+
+   const SIMDfloat p( SIMDfloat( x*z ) * polynomial( z, 2.292744815E-03F, -8.343945257E-03F,
+                                                        2.176891826E-02F, -5.395925790E-02F,
+                                                        1.333330423E-01F, -3.333333433E-01F ) + x );
+   SIMDfloat res( bitOr( p, bitAnd( sign, x ) ) );
+
+   const SIMDf32Mask large( cmple( set( 0.625F ), ax ) );
+   if( anyOf( large ) ) {
+      const SIMDfloat e( expKernel( ax + ax ) );
+      const SIMDfloat t( set( 1.0F ) - set( 2.0F ) / SIMDfloat( e + set( 1.0F ) ) );
+      res = select( large, bitOr( t, bitAnd( sign, x ) ), res );
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \tanh(x) \f$ (double precision).
+// \ingroup simd
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble tanhKernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble sign( set( -0.0 ) );
+   const SIMDdouble ax( bitAndNot( sign, x ) );
+   const SIMDdouble z( x * x );
+
+   const SIMDdouble p( SIMDdouble( x*z ) * polynomial( z, 6.48516348279311301E-06, -3.12011014257974025E-05,
+                                                          9.25711612955676871E-05, -2.37590649605556203E-04,
+                                                          5.89660657775704336E-04, -1.45577541204780546E-03,
+                                                          3.59212175115496222E-03, -8.86323510324087821E-03,
+                                                          2.18694885190083045E-02, -5.39682539678969925E-02,
+                                                          1.33333333333330417E-01, -3.33333333333333315E-01 ) + x );
+   SIMDdouble res( bitOr( p, bitAnd( sign, x ) ) );
+
+   const SIMDf64Mask large( cmple( set( 0.625 ), ax ) );
+   if( anyOf( large ) ) {
+      const SIMDdouble e( expKernel( ax + ax ) );
+      const SIMDdouble t( set( 1.0 ) - set( 2.0 ) / SIMDdouble( e + set( 1.0 ) ) );
+      res = select( large, bitOr( t, bitAnd( sign, x ) ), res );
+   }
+
+   return res;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERROR FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \mathrm{erf}(x) \f$ (single precision).
+// \ingroup simd
+//
+// For \f$ |x| < 1 \f$ the error function is approximated by \f$ x + x \cdot P(x^2) \f$, for
+// \f$ 1 \le |x| < 3.92 \f$ by \f$ 1 - e^{-x^2} \cdot Q(1/|x|) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat erfKernel( const SIMDfloat& x ) noexcept
+{
+   const SIMDfloat one ( set(  1.0F ) );
+   const SIMDfloat sign( set( -0.0F ) );
+   const SIMDfloat ax( bitAndNot( sign, x ) );
+   const SIMDfloat z( x * x );
+
+   SIMDfloat res( x * polynomial( z, 7.875874871E-05F, -8.016864303E-04F, 5.189087242E-03F,
+                                    -2.685421146E-02F, 1.128359437E-01F, -3.761262596E-01F,
+                                     1.283791661E-01F ) + x );
+
+   const SIMDf32Mask large( cmple( one, ax ) );
+   if( anyOf( large ) ) {
+      const SIMDfloat u( one / ax );
+      const SIMDfloat g( polynomial( u, -1.983946748E-02F, 1.295735687E-01F, -3.706989288E-01F,
+                                         5.921540856E-01F, -5.152885914E-01F, 5.409666523E-02F,
+                                         5.571971536E-01F, 3.891016531E-04F ) );
+      const SIMDfloat t( one - expCore( min( z, set( 16.0F ) ) * set( -1.0F ) ) * g );
+      res = select( large, bitOr( select( cmplt( ax, set( 3.92F ) ), t, one ), bitAnd( sign, x ) ), res );
+   }
+
+   return select( cmpunord( x ), x, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Blaze-native SIMD kernel for \f$ \mathrm{erf}(x) \f$ (double precision).
+// \ingroup simd
+//
+// For \f$ |x| < 1 \f$ the error function is approximated by \f$ x + x \cdot P(x^2) \f$, for
+// \f$ 1 \le |x| < 2.5 \f$ by \f$ 1 - e^{-x^2} \cdot Q_1(|x|-1.75) \f$, and for
+// \f$ 2.5 \le |x| < 6 \f$ by \f$ 1 - e^{-x^2} \cdot Q_2(1/|x|) \f$.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble erfKernel( const SIMDdouble& x ) noexcept
+{
+   const SIMDdouble one ( set(  1.0 ) );
+   const SIMDdouble sign( set( -0.0 ) );
+   const SIMDdouble ax( bitAndNot( sign, x ) );
+   const SIMDdouble z( x * x );
+
+   SIMDdouble res( bitOr( one, bitAnd( sign, x ) ) );
+
+   const SIMDf64Mask small( cmplt( ax, one ) );
+   if( anyOf( small ) ) {
+      const SIMDdouble t( x * polynomial( z, -7.79589882700214246E-10, 1.37200645467776862E-08,
+                                             -1.62084838018717052E-07, 1.64474247033173623E-06,
+                                             -1.49247369074196605E-05, 1.20552949048397074E-04,
+                                             -8.54832597538969182E-04, 5.22397760711642255E-03,
+                                             -2.68661706432377703E-02, 1.12837916709450065E-01,
+                                             -3.76126389031835429E-01, 1.28379167095512559E-01 ) + x );
+      res = select( small, t, res );
+   }
+
+   const SIMDf64Mask medium( maskAnd( cmple( one, ax ), cmplt( ax, set( 2.5 ) ) ) );
+   if( anyOf( medium ) ) {
+      const SIMDdouble v( ax - set( 1.75 ) );
+      const SIMDdouble g( polynomial( v, 4.80148704401226622E-09, -1.87944876027529491E-08,
+                                         6.05467891687218378E-08, -2.25019837014208743E-07,
+                                         8.27488676468025641E-07, -2.92938985670978175E-06,
+                                         1.00865764564926609E-05, -3.37549200854035799E-05,
+                                         1.09505306588646373E-04, -3.43533427250640227E-04,
+                                         1.03920452081878237E-03, -3.02097464480334098E-03,
+                                         8.40431920739429135E-03, -2.22599952416548293E-02,
+                                         5.57636300870864993E-02, -1.30976345514482090E-01,
+                                         2.84972234737436381E-01 ) );
+      const SIMDdouble t( one - expCore( min( z, set( 36.0 ) ) * set( -1.0 ), set( 0.0 ) ) * g );
+      res = select( medium, bitOr( t, bitAnd( sign, x ) ), res );
+   }
+
+   const SIMDf64Mask large( maskAnd( cmple( set( 2.5 ), ax ), cmplt( ax, set( 6.0 ) ) ) );
+   if( anyOf( large ) ) {
+      const SIMDdouble u( one / ax );
+      const SIMDdouble g( polynomial( u, 7.46599823159966869E-01, -3.77088547411572828E+00,
+                                         8.49830466698996823E+00, -1.11865317427968520E+01,
+                                         9.27153832880739515E+00, -4.63763087766408155E+00,
+                                         9.64626046157954109E-01, 2.34808605362895634E-01,
+                                         2.67380990022531365E-02, -2.84797970974214054E-01,
+                                         1.84947029687425373E-04, 5.64181895326934080E-01,
+                                         1.46759842298332979E-07 ) );
+      const SIMDdouble t( one - expCore( min( z, set( 36.0 ) ) * set( -1.0 ), set( 0.0 ) ) * g );
+      res = select( large, bitOr( t, bitAnd( sign, x ) ), res );
+   }
+
+   return select( cmpunord( x ), x, res );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+#endif
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,288 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Loadm.h
+//  \brief Header file for the SIMD masked load functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_LOADM_H_
+#define _BLAZE_MATH_SIMD_LOADM_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Loadu.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsDouble.h>
+#include <blaze/util/typetraits/IsFloat.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+#include <blaze/util/typetraits/IsSigned.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  MASK GENERATION
+//
+//=================================================================================================
+
+#if BLAZE_AVX_MODE && !BLAZE_AVX512F_MODE
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX mask selecting the first \a n 4-byte elements.
+// \ingroup simd
+//
+// \param n The number of selected elements \f$[0..8]\f$.
+// \return The mask with the sign bit set in the first \a n elements.
+*/
+BLAZE_ALWAYS_INLINE __m256i tailmask32( size_t n ) noexcept
+{
+   alignas( 32 ) static const int masks[16] = { -1, -1, -1, -1, -1, -1, -1, -1,
+                                                 0,  0,  0,  0,  0,  0,  0,  0 };
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( masks+8UL-n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates an AVX mask selecting the first \a n 8-byte elements.
+// \ingroup simd
+//
+// \param n The number of selected elements \f$[0..4]\f$.
+// \return The mask with the sign bit set in the first \a n elements.
+*/
+BLAZE_ALWAYS_INLINE __m256i tailmask64( size_t n ) noexcept
+{
+   alignas( 32 ) static const long long masks[8] = { -1, -1, -1, -1, 0, 0, 0, 0 };
+   return _mm256_loadu_si256( reinterpret_cast<const __m256i*>( masks+4UL-n ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+#endif
+
+
+
+
+//=================================================================================================
+//
+//  4-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMD size]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 4-byte integral values and sets
+// all remaining elements to zero. In contrast to the \c loadu() function, no memory beyond
+// \c address[n-1] is accessed. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,4UL>
+                                    , If_t< IsSigned_v<T>, SIMDint32, SIMDuint32 > >
+   loadm( const T* address, size_t n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi32( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX2_MODE
+   return _mm256_maskload_epi32( reinterpret_cast<const int*>( address ), tailmask32( n ) );
+#else
+   T tmp[SIMDTrait_t<T>::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  8-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The first integral value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMD size]\f$.
+// \return The loaded vector of integral values.
+//
+// This function loads the first \a n elements of a vector of 8-byte integral values and sets
+// all remaining elements to zero. In contrast to the \c loadu() function, no memory beyond
+// \c address[n-1] is accessed. The given address is not required to be properly aligned.
+*/
+template< typename T >  // Type of the integral value
+BLAZE_ALWAYS_INLINE const EnableIf_t< IsIntegral_v<T> && HasSize_v<T,8UL>
+                                    , If_t< IsSigned_v<T>, SIMDint64, SIMDuint64 > >
+   loadm( const T* address, size_t n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_epi64( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX2_MODE
+   return _mm256_maskload_epi64( reinterpret_cast<const long long*>( address ), tailmask64( n ) );
+#else
+   T tmp[SIMDTrait_t<T>::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The first 'float' value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMD size]\f$.
+// \return The loaded vector of 'float' values.
+//
+// This function loads the first \a n elements of a vector of 'float' values and sets all
+// remaining elements to zero. In contrast to the \c loadu() function, no memory beyond
+// \c address[n-1] is accessed. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDfloat loadm( const float* address, size_t n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_ps( static_cast<__mmask16>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX_MODE
+   return _mm256_maskload_ps( address, tailmask32( n ) );
+#else
+   float tmp[SIMDfloat::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The first 'double' value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMD size]\f$.
+// \return The loaded vector of 'double' values.
+//
+// This function loads the first \a n elements of a vector of 'double' values and sets all
+// remaining elements to zero. In contrast to the \c loadu() function, no memory beyond
+// \c address[n-1] is accessed. The given address is not required to be properly aligned.
+*/
+BLAZE_ALWAYS_INLINE const SIMDdouble loadm( const double* address, size_t n ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   return _mm512_maskz_loadu_pd( static_cast<__mmask8>( ( 1U << n ) - 1U ), address );
+#elif BLAZE_AVX_MODE
+   return _mm256_maskload_pd( address, tailmask64( n ) );
+#else
+   double tmp[SIMDdouble::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GENERIC SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Masked load of a vector of values without hardware mask support.
+// \ingroup simd
+//
+// \param address The first value to be loaded.
+// \param n The number of values to be loaded \f$[0..SIMD size]\f$.
+// \return The loaded vector of values.
+//
+// This function loads the first \a n elements of a SIMD vector of 1-byte or 2-byte integral
+// values or of complex values and sets all remaining elements to zero. Since no hardware
+// mask operation is used, the values are copied element-wise into a temporary buffer.
+*/
+template< typename T >  // Type of the value
+BLAZE_ALWAYS_INLINE const EnableIf_t< !IsFloat_v<T> && !IsDouble_v<T> &&
+                                      !( IsIntegral_v<T> && ( HasSize_v<T,4UL> || HasSize_v<T,8UL> ) )
+                                    , SIMDTrait_t<T> >
+   loadm( const T* address, size_t n ) noexcept
+{
+   T tmp[SIMDTrait_t<T>::size] = {};
+   for( size_t i=0UL; i<n; ++i )
+      tmp[i] = address[i];
+   return loadu( tmp );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,344 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/simd/Scatter.h
+//  \brief Header file for the SIMD scatter functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SIMD_SCATTER_H_
+#define _BLAZE_MATH_SIMD_SCATTER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/BasicTypes.h>
+#include <blaze/math/simd/Storeu.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/HasSize.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  4-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scatters a vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The base address of the integral values.
+// \param indices The indices of the target elements.
+// \param value The 4-byte integral vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 4-byte integral values to the given base address. The
+// \a i-th element of the given vector is stored to \c address[indices[i]]. In case an index
+// occurs several times, the last according element of the vector is stored.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,4UL> >
+   scatter( T1* address, const size_t* indices, const SIMDi32<T2>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   _mm512_i64scatter_epi32( address, _mm512_loadu_si512( indices     ), _mm512_castsi512_si256( (~value).value ), 4 );
+   _mm512_i64scatter_epi32( address, _mm512_loadu_si512( indices+8UL ), _mm512_extracti64x4_epi64( (~value).value, 1 ), 4 );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<T2::size; ++i ) {
+      address[indices[i]] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatters a strided vector of 4-byte integral values.
+// \ingroup simd
+//
+// \param address The address of the first target element.
+// \param stride The distance between two consecutive target elements.
+// \param value The 4-byte integral vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 4-byte integral values with constant distance. The \a i-th
+// element of the given vector is stored to \c address[i*stride].
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,4UL> >
+   scatter( T1* address, size_t stride, const SIMDi32<T2>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   const __m512i i1( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   const __m512i i2( _mm512_add_epi64( i1, _mm512_set1_epi64( 8*s ) ) );
+   _mm512_i64scatter_epi32( address, i1, _mm512_castsi512_si256( (~value).value ), 4 );
+   _mm512_i64scatter_epi32( address, i2, _mm512_extracti64x4_epi64( (~value).value, 1 ), 4 );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<T2::size; ++i ) {
+      address[i*stride] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  8-BYTE INTEGRAL SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scatters a vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The base address of the integral values.
+// \param indices The indices of the target elements.
+// \param value The 8-byte integral vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 8-byte integral values to the given base address. The
+// \a i-th element of the given vector is stored to \c address[indices[i]]. In case an index
+// occurs several times, the last according element of the vector is stored.
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,8UL> >
+   scatter( T1* address, const size_t* indices, const SIMDi64<T2>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   _mm512_i64scatter_epi64( address, _mm512_loadu_si512( indices ), (~value).value, 8 );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<T2::size; ++i ) {
+      address[indices[i]] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatters a strided vector of 8-byte integral values.
+// \ingroup simd
+//
+// \param address The address of the first target element.
+// \param stride The distance between two consecutive target elements.
+// \param value The 8-byte integral vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 8-byte integral values with constant distance. The \a i-th
+// element of the given vector is stored to \c address[i*stride].
+*/
+template< typename T1    // Type of the integral value
+        , typename T2 >  // Type of the SIMD data type
+BLAZE_ALWAYS_INLINE EnableIf_t< IsIntegral_v<T1> && HasSize_v<T1,8UL> >
+   scatter( T1* address, size_t stride, const SIMDi64<T2>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const long long s( stride );
+   _mm512_i64scatter_epi64( address, _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ), (~value).value, 8 );
+#else
+   T1 tmp[T2::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<T2::size; ++i ) {
+      address[i*stride] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  32-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scatters a vector of 'float' values.
+// \ingroup simd
+//
+// \param address The base address of the 'float' values.
+// \param indices The indices of the target elements.
+// \param value The 'float' vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 'float' values to the given base address. The \a i-th
+// element of the given vector is stored to \c address[indices[i]]. In case an index occurs
+// several times, the last according element of the vector is stored.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( float* address, const size_t* indices, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDfloat tmp( (~value).eval() );
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices     ), _mm512_castps512_ps256( tmp.value ), 4 );
+   _mm512_i64scatter_ps( address, _mm512_loadu_si512( indices+8UL ),
+                         _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( tmp.value ), 1 ) ), 4 );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[indices[i]] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatters a strided vector of 'float' values.
+// \ingroup simd
+//
+// \param address The address of the first target element.
+// \param stride The distance between two consecutive target elements.
+// \param value The 'float' vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 'float' values with constant distance. The \a i-th element
+// of the given vector is stored to \c address[i*stride].
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( float* address, size_t stride, const SIMDf32<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDfloat tmp( (~value).eval() );
+   const long long s( stride );
+   const __m512i i1( _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ) );
+   const __m512i i2( _mm512_add_epi64( i1, _mm512_set1_epi64( 8*s ) ) );
+   _mm512_i64scatter_ps( address, i1, _mm512_castps512_ps256( tmp.value ), 4 );
+   _mm512_i64scatter_ps( address, i2, _mm256_castpd_ps( _mm512_extractf64x4_pd( _mm512_castps_pd( tmp.value ), 1 ) ), 4 );
+#else
+   float tmp[SIMDfloat::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDfloat::size; ++i ) {
+      address[i*stride] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  64-BIT FLOATING POINT SIMD TYPES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scatters a vector of 'double' values.
+// \ingroup simd
+//
+// \param address The base address of the 'double' values.
+// \param indices The indices of the target elements.
+// \param value The 'double' vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 'double' values to the given base address. The \a i-th
+// element of the given vector is stored to \c address[indices[i]]. In case an index occurs
+// several times, the last according element of the vector is stored.
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( double* address, const size_t* indices, const SIMDf64<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDdouble tmp( (~value).eval() );
+   BLAZE_STATIC_ASSERT( sizeof( size_t ) == 8UL );
+   _mm512_i64scatter_pd( address, _mm512_loadu_si512( indices ), tmp.value, 8 );
+#else
+   double tmp[SIMDdouble::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDdouble::size; ++i ) {
+      address[indices[i]] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scatters a strided vector of 'double' values.
+// \ingroup simd
+//
+// \param address The address of the first target element.
+// \param stride The distance between two consecutive target elements.
+// \param value The 'double' vector to be scattered.
+// \return void
+//
+// This function scatters a vector of 'double' values with constant distance. The \a i-th element
+// of the given vector is stored to \c address[i*stride].
+*/
+template< typename T >  // Type of the operand
+BLAZE_ALWAYS_INLINE void scatter( double* address, size_t stride, const SIMDf64<T>& value ) noexcept
+{
+#if BLAZE_AVX512F_MODE
+   const SIMDdouble tmp( (~value).eval() );
+   const long long s( stride );
+   _mm512_i64scatter_pd( address, _mm512_set_epi64( 7*s, 6*s, 5*s, 4*s, 3*s, 2*s, s, 0 ), tmp.value, 8 );
+#else
+   double tmp[SIMDdouble::size];
+   storeu( tmp, ~value );
+   for( size_t i=0UL; i<SIMDdouble::size; ++i ) {
+      address[i*stride] = tmp[i];
+   }
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -40,7 +40,6 @@
 // Includes
 //*************************************************************************************************
 
-#include <blaze/math/Exception.h>
 #include <blaze/util/Suffix.h>
 
 
@@ -57,8 +56,11 @@ namespace blaze {
 // \ingroup smp
 //
 // The ParallelSection class is an auxiliary helper class for the \a BLAZE_PARALLEL_SECTION macro.
-// It provides the functionality to detected whether a parallel section has been started and with
-// that serves as a utility for debugging the shared-memory parallelization.
+// It provides the functionality to detected whether a parallel section has been started by the
+// calling thread and with that serves as a utility for debugging the shared-memory parallelization.
+// Since the activity flag is maintained per thread, several threads can execute parallel sections
+// concurrently. Therefore the SMP backends open a parallel section in every thread executing one
+// of their tasks, such that nested SMP operations within a task are executed serially.
 */
 template< typename T >
 class ParallelSection
@@ -97,10 +99,13 @@ class ParallelSection
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static bool active_;  //!< Activity flag for the parallel section.
-                         /*!< In case a parallel section is active (i.e. the currently executed
-                              code is inside a parallel section), the flag is set to \a true,
-                              otherwise it is \a false. */
+   bool outer_;  //!< Activity flag of the enclosing parallel section.
+
+   static thread_local bool active_;  //!< Activity flag for the parallel section.
+                                      /*!< In case a parallel section is active in the calling
+                                           thread (i.e. the currently executed code is inside a
+                                           parallel section), the flag is set to \a true,
+                                           otherwise it is \a false. */
    //@}
    //**********************************************************************************************
 
@@ -124,7 +129,7 @@ class ParallelSection
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename T >
-bool ParallelSection<T>::active_ = false;
+thread_local bool ParallelSection<T>::active_ = false;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -141,16 +146,16 @@ bool ParallelSection<T>::active_ = false;
 /*!\brief Constructor for the ParallelSection class.
 //
 // \param activate Activation flag for the parallel section.
-// \exception std::runtime_error Nested parallel sections detected.
+//
+// In case a parallel section is already active in the calling thread, the new section is
+// nested within the active section and the section remains active until the enclosing
+// section is left.
 */
 template< typename T >
 inline ParallelSection<T>::ParallelSection( bool activate )
+   : outer_( active_ )  // Activity flag of the enclosing parallel section
 {
-   if( active_ ) {
-      BLAZE_THROW_RUNTIME_ERROR( "Nested parallel sections detected" );
-   }
-
-   active_ = activate;
+   active_ = outer_ || activate;
 }
 //*************************************************************************************************
 
@@ -169,7 +174,7 @@ inline ParallelSection<T>::ParallelSection( bool activate )
 template< typename T >
 inline ParallelSection<T>::~ParallelSection()
 {
-   active_ = false;  // Resetting the activity flag
+   active_ = outer_;  // Restoring the activity flag of the enclosing section
 }
 //*************************************************************************************************
 
@@ -217,6 +222,8 @@ inline bool isParallelSectionActive();
 // \ingroup smp
 //
 // \return \a true if a parallel section is active, \a false if not.
+//
+// This function only considers the parallel sections of the calling thread.
 */
 inline bool isParallelSectionActive()
 {
@@ -241,12 +248,12 @@ inline bool isParallelSectionActive()
 /*!\brief Section for the debugging of the shared-memory parallelization.
 // \ingroup smp
 //
-// During the shared-memory parallel (SMP) execution of an operation nested calls to the SMP
-// assign functions are conceptually not allowed. In other words, it is not allowed to call a
-// SMP assign function from within a non-SMP assign function. The BLAZE_PARALLEL_SECTION macro
-// can be used to mark the start of a parallel section and with that detect nested SMP assign
-// function calls. In case a nested use of a parallel section is detected, a \a std::runtime_error
-// exception is thrown.\n
+// The BLAZE_PARALLEL_SECTION macro marks the start of a parallel section, i.e. the shared-memory
+// parallel (SMP) execution of an operation. The state of parallel sections is maintained per
+// thread, i.e. several application threads can execute parallel sections concurrently. Parallel
+// sections can also be nested: SMP assign functions called within an active parallel section of
+// the same thread are either executed as nested tasks of the thread backend or serially (as for
+// instance the SMP for loops and reductions).\n
 // Note that this macro is reserved for internal debugging purposes only and therefore must \b NOT
 // be used explicitly! Using this macro might result in erroneous results, runtime or compilation
 // errors.
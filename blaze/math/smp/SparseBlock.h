@@ -0,0 +1,327 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SparseBlock.h
+//  \brief Header file for the block-wise SMP assignment to sparse vectors and matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_SPARSEBLOCK_H_
+#define _BLAZE_MATH_SMP_SPARSEBLOCK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/Aliases.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/expressions/Vector.h>
+#include <blaze/math/functors/Assign.h>
+#include <blaze/math/typetraits/IsDenseMatrix.h>
+#include <blaze/math/typetraits/IsDenseVector.h>
+#include <blaze/math/views/Submatrix.h>
+#include <blaze/math/views/Subvector.h>
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE BLOCK FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of a sparse block for a plain assignment.
+// \ingroup smp
+//
+// \param result The block to be initialized.
+// \param target The corresponding block of the target.
+// \param op The plain assignment operation.
+// \return void
+//
+// In case of a plain assignment the previous values of the target are irrelevant and the
+// result block remains empty.
+*/
+template< typename RT    // Type of the result block
+        , typename TT >  // Type of the target block
+inline void initSparseBlock( RT& result, const TT& target, Assign op )
+{
+   UNUSED_PARAMETER( result, target, op );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Initialization of a sparse block for a compound assignment.
+// \ingroup smp
+//
+// \param result The block to be initialized.
+// \param target The corresponding block of the target.
+// \param op The compound assignment operation.
+// \return void
+//
+// In case of a compound assignment the result block is initialized with a copy of the
+// corresponding block of the target.
+*/
+template< typename RT    // Type of the result block
+        , typename TT    // Type of the target block
+        , typename OP >  // Type of the compound assignment operation
+inline void initSparseBlock( RT& result, const TT& target, OP op )
+{
+   UNUSED_PARAMETER( op );
+
+   result.reserve( target.nonZeros() );
+   assign( result, target );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reservation of a sparse block for a dense source.
+// \ingroup smp
+//
+// \param result The block to be evaluated.
+// \param source The dense source of the assignment.
+// \return void
+//
+// The number of non-zero elements of a dense source is unknown in advance. Therefore the
+// assignment itself takes care of extending the capacity of the block.
+*/
+template< typename RT   // Type of the result block
+        , typename ST > // Type of the source block
+inline void reserveSparseBlock( RT& result, const ST& source, TrueType )
+{
+   UNUSED_PARAMETER( result, source );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Reservation of a sparse block for a sparse source.
+// \ingroup smp
+//
+// \param result The block to be evaluated.
+// \param source The sparse source of the assignment.
+// \return void
+//
+// In case of a sparse source, the capacity of the block is extended by the number of non-zero
+// elements of the source.
+*/
+template< typename RT   // Type of the result block
+        , typename ST > // Type of the source block
+inline void reserveSparseBlock( RT& result, const ST& source, FalseType )
+{
+   result.reserve( result.nonZeros() + source.nonZeros() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a block of rows/columns of a (compound) assignment to a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param rhs The right-hand side matrix to be assigned.
+// \param op The (compound) assignment operation.
+// \param result The resulting block.
+// \param index The index of the first row/column of the block.
+// \param n The number of rows/columns of the block.
+// \param nonzeros The number of non-zero elements per row/column of the target.
+// \return void
+//
+// This function represents the first pass of the SMP assignment to a sparse matrix. It
+// serially evaluates the block of \a n rows (in case of a row-major target) or columns (in
+// case of a column-major target) starting at \a index into the given \a result matrix and
+// stores the number of non-zero elements of each row/column of the block in \a nonzeros.
+// Since the blocks of different calls don't overlap, the function can be executed concurrently.
+// Note that \a lhs is not modified.
+*/
+template< typename MT1   // Type of the left-hand side sparse matrix
+        , bool SO1       // Storage order of the left-hand side sparse matrix
+        , typename MT2   // Type of the right-hand side matrix
+        , bool SO2       // Storage order of the right-hand side matrix
+        , typename OP    // Type of the assignment operation
+        , typename RT >  // Type of the result block
+void evaluateSparseBlock( const SparseMatrix<MT1,SO1>& lhs, const Matrix<MT2,SO2>& rhs, OP op,
+                          RT& result, size_t index, size_t n, size_t* nonzeros )
+{
+   const size_t row   ( SO1 ? 0UL : index );
+   const size_t column( SO1 ? index : 0UL );
+   const size_t m     ( SO1 ? (~lhs).rows() : n );
+   const size_t k     ( SO1 ? n : (~lhs).columns() );
+
+   const auto target( submatrix<unaligned>( ~lhs, row, column, m, k, unchecked ) );
+   const auto source( submatrix<unaligned>( ~rhs, row, column, m, k, unchecked ) );
+
+   result.resize( m, k, false );
+   result.reset();
+
+   initSparseBlock( result, target, op );
+
+   reserveSparseBlock( result, source, IsDenseMatrix<MT2>() );
+   op( result, source );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      nonzeros[index+i] = result.nonZeros( i );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfer of an evaluated block of rows/columns into a sparse matrix.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse matrix.
+// \param result The evaluated block.
+// \param index The index of the first row/column of the block.
+// \return void
+//
+// This function represents the second pass of the SMP assignment to a sparse matrix. It appends
+// all elements of the given \a result block to the according rows/columns of the target. The
+// target is required to provide sufficient capacity in all rows/columns of the block (see the
+// \a restructure() function of the CompressedMatrix class template). Since the blocks of
+// different calls don't overlap, the function can be executed concurrently.
+*/
+template< typename MT1  // Type of the left-hand side sparse matrix
+        , bool SO1      // Storage order of the left-hand side sparse matrix
+        , typename RT > // Type of the result block
+void transferSparseBlock( SparseMatrix<MT1,SO1>& lhs, const RT& result, size_t index )
+{
+   const size_t n( SO1 ? result.columns() : result.rows() );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const auto end( result.end(i) );
+
+      for( auto element=result.begin(i); element!=end; ++element ) {
+         if( SO1 )
+            (~lhs).append( element->index(), index+i, element->value() );
+         else
+            (~lhs).append( index+i, element->index(), element->value() );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Evaluation of a range of a (compound) assignment to a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param rhs The right-hand side vector to be assigned.
+// \param op The (compound) assignment operation.
+// \param result The resulting range.
+// \param index The index of the first element of the range.
+// \param n The number of elements of the range.
+// \return void
+//
+// This function represents the first pass of the SMP assignment to a sparse vector. It serially
+// evaluates the range of \a n elements starting at \a index into the given \a result vector.
+// Since the ranges of different calls don't overlap, the function can be executed concurrently.
+// Note that \a lhs is not modified.
+*/
+template< typename VT1   // Type of the left-hand side sparse vector
+        , bool TF1       // Transpose flag of the left-hand side sparse vector
+        , typename VT2   // Type of the right-hand side vector
+        , bool TF2       // Transpose flag of the right-hand side vector
+        , typename OP    // Type of the assignment operation
+        , typename RT >  // Type of the result range
+void evaluateSparseBlock( const SparseVector<VT1,TF1>& lhs, const Vector<VT2,TF2>& rhs, OP op,
+                          RT& result, size_t index, size_t n )
+{
+   const auto target( subvector<unaligned>( ~lhs, index, n, unchecked ) );
+   const auto source( subvector<unaligned>( ~rhs, index, n, unchecked ) );
+
+   result.resize( n, false );
+   result.reset();
+
+   initSparseBlock( result, target, op );
+
+   reserveSparseBlock( result, source, IsDenseVector<VT2>() );
+   op( result, source );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Transfer of an evaluated range into a sparse vector.
+// \ingroup smp
+//
+// \param lhs The target left-hand side sparse vector.
+// \param result The evaluated range.
+// \param index The index of the first element of the range.
+// \return void
+//
+// This function represents the second pass of the SMP assignment to a sparse vector. It appends
+// all elements of the given \a result range to the target. The target is required to provide
+// sufficient capacity. Since all elements are appended to a single contiguous storage, the
+// ranges have to be transferred in ascending order.
+*/
+template< typename VT1  // Type of the left-hand side sparse vector
+        , bool TF1      // Transpose flag of the left-hand side sparse vector
+        , typename RT > // Type of the result range
+void transferSparseBlock( SparseVector<VT1,TF1>& lhs, const RT& result, size_t index )
+{
+   const auto end( result.end() );
+
+   for( auto element=result.begin(); element!=end; ++element ) {
+      (~lhs).append( index+element->index(), element->value() );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,250 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/SparsePartition.h
+//  \brief Header file for the nonzero-balanced partitioning of sparse matrices
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_SPARSEPARTITION_H_
+#define _BLAZE_MATH_SMP_SPARSEPARTITION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  SPARSE PARTITION FUNCTIONALITY
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the rows/columns of a sparse matrix by the number of non-zero elements.
+// \ingroup smp
+//
+// \param sm The sparse matrix to be partitioned.
+// \param parts The number of partitions (at least 1).
+// \param bounds The resulting partition boundaries (an array of \a parts+1 elements).
+// \return void
+//
+// This function splits the rows (in case of a row-major matrix) or the columns (in case of a
+// column-major matrix) of the given sparse matrix into \a parts contiguous partitions of
+// roughly equal work. The work of each row/column is estimated as the number of its non-zero
+// elements plus one, i.e. both the non-zero elements and the rows/columns themselves are
+// accounted for (merge-path partitioning). Partition \a i comprises the rows/columns in the
+// range \f$ [bounds[i]..bounds[i+1]) \f$, where \a bounds[0] is 0 and \a bounds[parts] is the
+// total number of rows/columns. Note that a single row/column with a huge number of non-zero
+// elements may result in empty partitions.
+*/
+template< typename MT  // Type of the sparse matrix
+        , bool SO >    // Storage order of the sparse matrix
+void partitionNonZeros( const SparseMatrix<MT,SO>& sm, size_t parts, size_t* bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of partitions" );
+
+   const size_t n( SO ? (~sm).columns() : (~sm).rows() );
+
+   size_t total( n );
+   for( size_t i=0UL; i<n; ++i ) {
+      total += (~sm).nonZeros( i );
+   }
+
+   size_t part( 1UL );
+   size_t work( 0UL );
+
+   bounds[0UL] = 0UL;
+
+   for( size_t i=0UL; i<n && part<parts; ++i )
+   {
+      work += (~sm).nonZeros( i ) + 1UL;
+
+      while( part < parts && work*parts >= part*total ) {
+         bounds[part] = i+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the chunks of a sliced ELLPACK matrix by the number of stored elements.
+// \ingroup smp
+//
+// \param sm The sliced ELLPACK matrix to be partitioned.
+// \param parts The number of partitions (at least 1).
+// \param bounds The resulting partition boundaries (an array of \a parts+1 elements).
+// \return void
+//
+// This function splits the chunks of the given sliced ELLPACK matrix (see SlicedEllpackMatrix)
+// into \a parts contiguous partitions of roughly equal work. The work of each chunk is estimated
+// as the number of its stored elements (including the padding) plus the chunk size. Partition
+// \a i comprises the chunks in the range \f$ [bounds[i]..bounds[i+1]) \f$, where \a bounds[0]
+// is 0 and \a bounds[parts] is the total number of chunks.
+*/
+template< typename MT >  // Type of the sliced ELLPACK matrix
+void partitionChunks( const SparseMatrix<MT,false>& sm, size_t parts, size_t* bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of partitions" );
+
+   const size_t n( (~sm).chunks() );
+   const size_t C( MT::chunkSize );
+
+   const size_t total( (~sm).offset( n ) + n*C );
+
+   size_t part( 1UL );
+
+   bounds[0UL] = 0UL;
+
+   for( size_t c=0UL; c<n && part<parts; ++c )
+   {
+      const size_t work( (~sm).offset( c+1UL ) + ( c+1UL )*C );
+
+      while( part < parts && work*parts >= part*total ) {
+         bounds[part] = c+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of the block rows of a block compressed matrix by the number of blocks.
+// \ingroup smp
+//
+// \param sm The block compressed matrix to be partitioned.
+// \param parts The number of partitions (at least 1).
+// \param bounds The resulting partition boundaries (an array of \a parts+1 elements).
+// \return void
+//
+// This function splits the block rows of the given block compressed matrix (see the
+// BlockCompressedMatrix class template) into \a parts contiguous partitions of roughly equal
+// work. The work of each block row is estimated as the number of its stored blocks plus one.
+// Partition \a i comprises the block rows in the range \f$ [bounds[i]..bounds[i+1]) \f$, where
+// \a bounds[0] is 0 and \a bounds[parts] is the total number of block rows.
+*/
+template< typename MT >  // Type of the block compressed matrix
+void partitionBlockRows( const SparseMatrix<MT,false>& sm, size_t parts, size_t* bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of partitions" );
+
+   const size_t n( (~sm).blockRows() );
+   const size_t* const rowptr( (~sm).rowPointers() );
+
+   const size_t total( n > 0UL ? rowptr[n] + n : 0UL );
+
+   size_t part( 1UL );
+
+   bounds[0UL] = 0UL;
+
+   for( size_t bi=0UL; bi<n && part<parts; ++bi )
+   {
+      const size_t work( rowptr[bi+1UL] + bi + 1UL );
+
+      while( part < parts && work*parts >= part*total ) {
+         bounds[part] = bi+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Partitioning of a range of rows/columns by the given accumulated amount of work.
+// \ingroup smp
+//
+// \param offsets The accumulated work of the rows/columns (an array of \a n+1 elements).
+// \param n The total number of rows/columns.
+// \param parts The number of partitions (at least 1).
+// \param bounds The resulting partition boundaries (an array of \a parts+1 elements).
+// \return void
+//
+// This function splits \a n rows/columns into \a parts contiguous partitions of roughly equal
+// work. The given array has to contain the exclusive prefix sum of the work of all rows/columns,
+// i.e. \a offsets[0] is 0 and the work of row/column \a i is \a offsets[i+1] - \a offsets[i].
+// Analogously to partitionNonZeros(), every row/column additionally accounts for one unit of
+// work. Partition \a i comprises the rows/columns in the range \f$ [bounds[i]..bounds[i+1]) \f$.
+*/
+inline void partitionWork( const size_t* offsets, size_t n, size_t parts, size_t* bounds )
+{
+   BLAZE_INTERNAL_ASSERT( parts > 0UL, "Invalid number of partitions" );
+
+   const size_t total( offsets[n] + n );
+
+   size_t part( 1UL );
+
+   bounds[0UL] = 0UL;
+
+   for( size_t i=0UL; i<n && part<parts; ++i )
+   {
+      const size_t work( offsets[i+1UL] + i + 1UL );
+
+      while( part < parts && work*parts >= part*total ) {
+         bounds[part] = i+1UL;
+         ++part;
+      }
+   }
+
+   for( ; part<=parts; ++part ) {
+      bounds[part] = n;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -66,24 +66,21 @@ using ThreadMapping = std::pair<size_t,size_t>;
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Creates a 2D mapping of threads.
+/*!\brief Creates a 2D mapping of threads for a matrix of the given dimensions.
 // \ingroup smp
 //
 // \param threads The total number of threads to be mapped.
-// \param A The matrix the mapping is created for.
+// \param M The number of rows of the matrix.
+// \param N The number of columns of the matrix.
+// \param SO The storage order of the matrix.
 // \return 2D mapping of the given number of threads.
 //
-// This function creates a 2D mapping of the given number of threads for the given matrix \a A.
+// This function creates a 2D mapping of the given number of threads for a \a M x \a N matrix.
 // The mapping will depend on the ratio between rows and columns of the matrix and its storage
 // order.
 */
-template< typename MT  // Type of the matrix
-        , bool SO >    // Storage order of the matrix
-ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+inline ThreadMapping createThreadMapping( size_t threads, size_t M, size_t N, bool SO )
 {
-   const size_t M( (~A).rows()    );
-   const size_t N( (~A).columns() );
-
    if( M > N || ( M == N && !SO ) )
    {
       const double ratio( double(M)/double(N) );
@@ -114,6 +111,29 @@ ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
 /*! \endcond */
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Creates a 2D mapping of threads.
+// \ingroup smp
+//
+// \param threads The total number of threads to be mapped.
+// \param A The matrix the mapping is created for.
+// \return 2D mapping of the given number of threads.
+//
+// This function creates a 2D mapping of the given number of threads for the given matrix \a A.
+// The mapping will depend on the ratio between rows and columns of the matrix and its storage
+// order.
+*/
+template< typename MT  // Type of the matrix
+        , bool SO >    // Storage order of the matrix
+ThreadMapping createThreadMapping( size_t threads, const Matrix<MT,SO>& A )
+{
+   return createThreadMapping( threads, (~A).rows(), (~A).columns(), SO );
+}
+/*! \endcond */
+//*************************************************************************************************
+
 } // namespace blaze
 
 #endif
@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/default/FirstTouch.h
+//  \brief Header file for the default SMP first-touch initialization
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_DEFAULT_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_DEFAULT_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/SMP.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the first-touch initialization of a dense vector.
+// \ingroup smp
+//
+// \param data Pointer to the first element of the vector.
+// \param size The size of the vector.
+// \param capacity The capacity of the vector (including padding elements).
+// \param value The initial value of the vector elements.
+// \return void
+//
+// This function implements the default first-touch initialization of the elements of a dense
+// vector. Since no shared memory parallelization is active, all elements are initialized
+// single-threaded with \a value, the padding elements in the range \f$ [size..capacity) \f$ are
+// default initialized.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dynamically allocated dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< bool SIMD        // Flag for SIMD-aligned partitions
+        , typename Type >  // Data type of the elements
+inline void smpFirstTouch( Type* data, size_t size, size_t capacity, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   for( size_t i=0UL; i<size; ++i )
+      data[i] = value;
+   for( size_t i=size; i<capacity; ++i )
+      data[i] = Type();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Default implementation of the first-touch initialization of a dense matrix.
+// \ingroup smp
+//
+// \param data Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param spacing The spacing between two rows/columns (including padding elements).
+// \param value The initial value of the matrix elements.
+// \return void
+//
+// This function implements the default first-touch initialization of the elements of a dense
+// matrix. Since no shared memory parallelization is active, all elements are initialized
+// single-threaded with \a value, the padding elements of each row (or column in case of a
+// column-major matrix) are default initialized.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dynamically allocated dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< bool SO          // Storage order of the matrix
+        , bool SIMD        // Flag for SIMD-aligned partitions
+        , typename Type >  // Data type of the elements
+inline void smpFirstTouch( Type* data, size_t m, size_t n, size_t spacing, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   const size_t outer( SO ? n : m );
+   const size_t inner( SO ? m : n );
+
+   for( size_t k=0UL; k<outer; ++k )
+   {
+      for( size_t l=0UL; l<inner; ++l )
+         data[k*spacing+l] = value;
+
+      for( size_t l=inner; l<spacing; ++l )
+         data[k*spacing+l] = Type();
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( !BLAZE_HPX_PARALLEL_MODE           );
+BLAZE_STATIC_ASSERT( !BLAZE_CPP_THREADS_PARALLEL_MODE   );
+BLAZE_STATIC_ASSERT( !BLAZE_BOOST_THREADS_PARALLEL_MODE );
+BLAZE_STATIC_ASSERT( !BLAZE_OPENMP_PARALLEL_MODE        );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
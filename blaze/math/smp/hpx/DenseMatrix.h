@@ -52,6 +52,7 @@
 #include <blaze/math/functors/SchurAssign.h>
 #include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/hpx/Functions.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
 #include <blaze/math/smp/Functions.h>
@@ -65,6 +66,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -301,9 +303,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, serial)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
       assign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, parallel)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, Assign() );
    }
 }
@@ -389,9 +395,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, serial)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
       addAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, parallel)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, AddAssign() );
    }
 }
@@ -477,9 +487,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, serial)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
       subAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, parallel)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, SubAssign() );
    }
 }
@@ -565,9 +579,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).columns() == (~rhs).columns(), "Invalid number of columns" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, serial)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
       schurAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, parallel)"
+                          , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, SchurAssign() );
    }
 }
@@ -51,6 +51,7 @@
 #include <blaze/math/functors/MultAssign.h>
 #include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/hpx/Functions.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/Functions.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -62,6 +63,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -279,9 +281,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, serial)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
       assign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, parallel)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, Assign() );
    }
 }
@@ -365,9 +371,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, serial)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
       addAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, parallel)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, AddAssign() );
    }
 }
@@ -451,9 +461,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, serial)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
       subAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, parallel)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, SubAssign() );
    }
 }
@@ -537,9 +551,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, serial)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
       multAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, parallel)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, MultAssign() );
    }
 }
@@ -623,9 +641,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_INTERNAL_ASSERT( (~lhs).size() == (~rhs).size(), "Invalid vector sizes" );
 
    if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+      BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, serial)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
       divAssign( ~lhs, ~rhs );
    }
    else {
+      BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, parallel)"
+                          , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
       hpxAssign( ~lhs, ~rhs, DivAssign() );
    }
 }
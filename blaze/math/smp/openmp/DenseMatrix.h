@@ -52,6 +52,7 @@
 #include <blaze/math/functors/SchurAssign.h>
 #include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/openmp/Functions.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
@@ -65,6 +66,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -127,7 +129,7 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -202,7 +204,7 @@ void openmpAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
    const size_t addon2       ( ( ( (~rhs).columns() % threadmap.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threadmap.second + addon2 );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( size_t i=0; i<threads; ++i )
    {
       const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
@@ -303,10 +305,15 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -395,10 +402,15 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -487,10 +499,15 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -579,10 +596,15 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, SchurAssign() );
       }
    }
@@ -51,6 +51,7 @@
 #include <blaze/math/functors/MultAssign.h>
 #include <blaze/math/functors/SubAssign.h>
 #include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/openmp/Functions.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -62,6 +63,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -117,7 +119,7 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -185,7 +187,7 @@ void openmpAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-#pragma omp for schedule(dynamic,1) nowait
+#pragma omp for schedule(static) nowait
    for( int i=0UL; i<threads; ++i )
    {
       const size_t index( i*sizePerThread );
@@ -281,10 +283,15 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -371,10 +378,15 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -461,10 +473,15 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -551,10 +568,15 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, MultAssign() );
       }
    }
@@ -641,10 +663,15 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
 #pragma omp parallel shared( lhs, rhs )
+         BLAZE_PARALLEL_SECTION
          openmpAssign( ~lhs, ~rhs, DivAssign() );
       }
    }
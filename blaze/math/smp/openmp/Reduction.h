@@ -0,0 +1,158 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/openmp/Reduction.h
+//  \brief Header file for the OpenMP-based SMP reduction implementation
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+#define _BLAZE_MATH_SMP_OPENMP_REDUCTION_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <omp.h>
+#include <memory>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/constraints/Constructible.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the OpenMP-based SMP reduction of a partitioned range.
+// \ingroup smp
+//
+// \param size The total number of elements/rows/columns of the reduced range.
+// \param alignment The alignment of the partitions of the range (a power of 2).
+// \param kernel The serial reduction kernel for a partition of the range.
+// \param op The operation for the combination of two partial results.
+// \return The result of the reduction.
+//
+// This function implements the OpenMP-based SMP reduction of the range \f$ [0..size) \f$.
+// The range is split into one partition per thread, where the size of each partition is a
+// multiple of the given \a alignment. Each partition is reduced concurrently by means of the
+// given \a kernel, which is called as \c kernel(index,n) for the partition of \a n elements
+// starting at \a index. The partial results are subsequently combined via \a op in ascending
+// order of the partitions. Therefore, for a fixed number of threads, the result of the reduction
+// is deterministic. In case a serial section or a parallel section is active, the complete range
+// is reduced single-threaded by a single call of the kernel. Since the partial results are
+// stored in a default initialized array, the result type of the kernel is required to be default
+// constructible and copy assignable.\n
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of reduction operations. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename Kernel  // Type of the reduction kernel
+        , typename OP >    // Type of the combination operation
+auto smpReduce( size_t size, size_t alignment, Kernel kernel, OP op )
+   -> Decay_t< decltype( kernel( size_t(), size_t() ) ) >
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using RT = Decay_t< decltype( kernel( size_t(), size_t() ) ) >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DEFAULT_CONSTRUCTIBLE_TYPE( RT );
+
+   const size_t threads( omp_get_max_threads() );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || omp_in_parallel() || threads == 1UL || size == 0UL ) {
+      return kernel( 0UL, size );
+   }
+
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare & ( alignment - 1UL ) );
+   const size_t sizePerThread( ( rest )?( equalShare - rest + alignment ):( equalShare ) );
+   const size_t blocks       ( ( size - 1UL ) / sizePerThread + 1UL );
+
+   std::unique_ptr<RT[]> partials( new RT[blocks] );
+
+   BLAZE_PARALLEL_SECTION
+   {
+#pragma omp parallel for schedule(static) shared(partials)
+      for( int i=0; i<static_cast<int>( blocks ); ++i ) {
+         BLAZE_PARALLEL_SECTION
+         {
+            const size_t index( i*sizePerThread );
+            partials[i] = kernel( index, min( sizePerThread, size - index ) );
+         }
+      }
+   }
+
+   RT redux( partials[0UL] );
+
+   for( size_t i=1UL; i<blocks; ++i ) {
+      redux = op( redux, partials[i] );
+   }
+
+   return redux;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_OPENMP_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
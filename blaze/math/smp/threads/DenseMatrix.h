@@ -53,6 +53,7 @@
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
 #include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/math/smp/threads/Functions.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/StorageOrder.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -64,6 +65,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -125,47 +127,38 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const DenseMatrix<MT2,SO2>& rhs, O
    const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
    const size_t colsPerThread( ( simdEnabled && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   TheThreadBackend::distribute( threads.first*threads.second, [&]( size_t i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
-
-         if( column >= (~rhs).columns() )
-            continue;
-
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
-
-         if( simdEnabled && lhsAligned && rhsAligned ) {
-            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && lhsAligned ) {
-            auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else if( simdEnabled && rhsAligned ) {
-            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-         else {
-            auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-            const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-            TheThreadBackend::schedule( target, source, op );
-         }
-      }
-   }
+      const size_t row   ( ( i / threads.second ) * rowsPerThread );
+      const size_t column( ( i % threads.second ) * colsPerThread );
+
+      if( row >= (~lhs).rows() || column >= (~rhs).columns() )
+         return;
 
-   TheThreadBackend::wait();
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~rhs).columns() - column ) );
+
+      if( simdEnabled && lhsAligned && rhsAligned ) {
+         auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && lhsAligned ) {
+         auto       target( submatrix<aligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else if( simdEnabled && rhsAligned ) {
+         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<aligned>( ~rhs, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+      else {
+         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+         op( target, source );
+      }
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -208,30 +201,21 @@ void threadAssign( DenseMatrix<MT1,SO1>& lhs, const SparseMatrix<MT2,SO2>& rhs,
    const size_t addon2       ( ( ( (~rhs).columns() % threads.second ) != 0UL )? 1UL : 0UL );
    const size_t colsPerThread( (~rhs).columns() / threads.second + addon2 );
 
-   for( size_t i=0UL; i<threads.first; ++i )
+   TheThreadBackend::distribute( threads.first*threads.second, [&]( size_t i )
    {
-      const size_t row( i*rowsPerThread );
-
-      if( row >= (~lhs).rows() )
-         continue;
-
-      for( size_t j=0UL; j<threads.second; ++j )
-      {
-         const size_t column( j*colsPerThread );
+      const size_t row   ( ( i / threads.second ) * rowsPerThread );
+      const size_t column( ( i % threads.second ) * colsPerThread );
 
-         if( column >= (~lhs).columns() )
-            continue;
+      if( row >= (~lhs).rows() || column >= (~lhs).columns() )
+         return;
 
-         const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
-         const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
-
-         auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
-         const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
-      }
-   }
+      const size_t m( min( rowsPerThread, (~lhs).rows()    - row    ) );
+      const size_t n( min( colsPerThread, (~lhs).columns() - column ) );
 
-   TheThreadBackend::wait();
+      auto       target( submatrix<unaligned>( ~lhs, row, column, m, n, unchecked ) );
+      const auto source( submatrix<unaligned>( ~rhs, row, column, m, n, unchecked ) );
+      op( target, source );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -317,9 +301,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -409,9 +397,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -502,9 +494,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -595,9 +591,13 @@ inline EnableIf_t< IsDenseMatrix_v<MT1> && IsSMPAssignable_v<MT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, serial)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, 1UL );
          schurAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSchurAssign (dense matrix, parallel)"
+                             , (~lhs).rows(), (~lhs).columns(), 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, SchurAssign() );
       }
    }
@@ -52,6 +52,7 @@
 #include <blaze/math/simd/SIMDTrait.h>
 #include <blaze/math/smp/ParallelSection.h>
 #include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/Functions.h>
 #include <blaze/math/smp/threads/ThreadBackend.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
 #include <blaze/math/typetraits/IsSIMDCombinable.h>
@@ -62,6 +63,7 @@
 #include <blaze/util/Assert.h>
 #include <blaze/util/EnableIf.h>
 #include <blaze/util/FunctionTrace.h>
+#include <blaze/util/KernelProfile.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -118,38 +120,36 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const DenseVector<VT2,TF2>& rhs, O
    const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
    const size_t sizePerThread( ( simdEnabled && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
 
-   for( size_t i=0UL; i<threads; ++i )
+   TheThreadBackend::distribute( threads, [&]( size_t i )
    {
       const size_t index( i*sizePerThread );
 
       if( index >= (~lhs).size() )
-         continue;
+         return;
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
 
       if( simdEnabled && lhsAligned && rhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         op( target, source );
       }
       else if( simdEnabled && lhsAligned ) {
          auto       target( subvector<aligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         op( target, source );
       }
       else if( simdEnabled && rhsAligned ) {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<aligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         op( target, source );
       }
       else {
          auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
          const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-         TheThreadBackend::schedule( target, source, op );
+         op( target, source );
       }
-   }
-
-   TheThreadBackend::wait();
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -188,20 +188,18 @@ void threadAssign( DenseVector<VT1,TF1>& lhs, const SparseVector<VT2,TF2>& rhs,
    const size_t addon        ( ( ( (~lhs).size() % threads ) != 0UL )? 1UL : 0UL );
    const size_t sizePerThread( (~lhs).size() / threads + addon );
 
-   for( size_t i=0UL; i<threads; ++i )
+   TheThreadBackend::distribute( threads, [&]( size_t i )
    {
       const size_t index( i*sizePerThread );
 
       if( index >= (~lhs).size() )
-         continue;
+         return;
 
       const size_t size( min( sizePerThread, (~lhs).size() - index ) );
       auto       target( subvector<unaligned>( ~lhs, index, size, unchecked ) );
       const auto source( subvector<unaligned>( ~rhs, index, size, unchecked ) );
-      TheThreadBackend::schedule( target, source, op );
-   }
-
-   TheThreadBackend::wait();
+      op( target, source );
+   } );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -285,9 +283,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          assign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, Assign() );
       }
    }
@@ -375,9 +377,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          addAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpAddAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, AddAssign() );
       }
    }
@@ -466,9 +472,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          subAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpSubAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, SubAssign() );
       }
    }
@@ -557,9 +567,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          multAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpMultAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, MultAssign() );
       }
    }
@@ -647,9 +661,13 @@ inline EnableIf_t< IsDenseVector_v<VT1> && IsSMPAssignable_v<VT1> && IsSMPAssign
    BLAZE_PARALLEL_SECTION
    {
       if( isSerialSectionActive() || !(~rhs).canSMPAssign() ) {
+         BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, serial)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, 1UL );
          divAssign( ~lhs, ~rhs );
       }
       else {
+         BLAZE_KERNEL_PROFILE( "smpDivAssign (dense vector, parallel)"
+                             , (~lhs).size(), 0UL, 0UL, 0UL, 0UL, getNumThreads() );
          threadAssign( ~lhs, ~rhs, DivAssign() );
       }
    }
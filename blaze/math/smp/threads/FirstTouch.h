@@ -0,0 +1,248 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/smp/threads/FirstTouch.h
+//  \brief Header file for the C++11/Boost thread-based SMP first-touch initialization
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+#define _BLAZE_MATH_SMP_THREADS_FIRSTTOUCH_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/threads/ThreadBackend.h>
+#include <blaze/math/smp/ThreadMapping.h>
+#include <blaze/system/SMP.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based first-touch initialization of a dense
+//        vector.
+// \ingroup smp
+//
+// \param data Pointer to the first element of the vector.
+// \param size The size of the vector.
+// \param capacity The capacity of the vector (including padding elements).
+// \param value The initial value of the vector elements.
+// \return void
+//
+// This function implements the C++11/Boost thread-based first-touch initialization of the
+// elements of a dense vector. The elements are partitioned and distributed among the threads
+// exactly as in the thread-based SMP assignment to a dense vector (see threadAssign()), i.e.
+// every thread first writes to the part of the vector it processes in subsequent assignments
+// and the memory pages of this part are placed on the NUMA node of the thread. All elements
+// are initialized with \a value, the padding elements in the range \f$ [size..capacity) \f$
+// are default initialized. In case a serial section or a parallel section is active, the vector
+// is initialized single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dynamically allocated dense vectors. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< bool SIMD        // Flag for SIMD-aligned partitions
+        , typename Type >  // Data type of the elements
+void smpFirstTouch( Type* data, size_t size, size_t capacity, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t threads( TheThreadBackend::size() );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || threads == 1UL || size == 0UL ) {
+      for( size_t i=0UL; i<size; ++i )
+         data[i] = value;
+      for( size_t i=size; i<capacity; ++i )
+         data[i] = Type();
+      return;
+   }
+
+   const size_t addon        ( ( ( size % threads ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare   ( size / threads + addon );
+   const size_t rest         ( equalShare & ( SIMDSIZE - 1UL ) );
+   const size_t sizePerThread( ( SIMD && rest )?( equalShare - rest + SIMDSIZE ):( equalShare ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TheThreadBackend::distribute( threads, [&]( size_t i )
+      {
+         const size_t index( i*sizePerThread );
+
+         if( index >= size )
+            return;
+
+         const size_t end( min( index+sizePerThread, size ) );
+
+         for( size_t j=index; j<end; ++j )
+            data[j] = value;
+
+         if( end == size ) {
+            for( size_t j=size; j<capacity; ++j )
+               data[j] = Type();
+         }
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Implementation of the C++11/Boost thread-based first-touch initialization of a dense
+//        matrix.
+// \ingroup smp
+//
+// \param data Pointer to the first element of the matrix.
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param spacing The spacing between two rows/columns (including padding elements).
+// \param value The initial value of the matrix elements.
+// \return void
+//
+// This function implements the C++11/Boost thread-based first-touch initialization of the
+// elements of a dense matrix. The elements are partitioned and distributed among the threads
+// exactly as in the thread-based SMP assignment to a dense matrix (see threadAssign()), i.e.
+// every thread first writes to the block of the matrix it processes in subsequent assignments
+// and the memory pages of this block are placed on the NUMA node of the thread. All elements
+// are initialized with \a value, the padding elements of a row (or column in case of a
+// column-major matrix) are default initialized by the thread that initializes the last block
+// of the row/column. In case a serial section or a parallel section is active, the matrix is
+// initialized single-threaded.\n
+// This function must \b NOT be called explicitly! It is used internally for the initialization
+// of dynamically allocated dense matrices. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< bool SO          // Storage order of the matrix
+        , bool SIMD        // Flag for SIMD-aligned partitions
+        , typename Type >  // Data type of the elements
+void smpFirstTouch( Type* data, size_t m, size_t n, size_t spacing, const Type& value )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   constexpr size_t SIMDSIZE( SIMDTrait<Type>::size );
+
+   const size_t inner( SO ? m : n );
+
+   auto fill = [=]( size_t outerBegin, size_t outerEnd, size_t innerBegin, size_t innerEnd )
+   {
+      for( size_t k=outerBegin; k<outerEnd; ++k )
+      {
+         for( size_t l=innerBegin; l<innerEnd; ++l )
+            data[k*spacing+l] = value;
+
+         if( innerEnd == inner ) {
+            for( size_t l=inner; l<spacing; ++l )
+               data[k*spacing+l] = Type();
+         }
+      }
+   };
+
+   const size_t threads( TheThreadBackend::size() );
+
+   if( isSerialSectionActive() || isParallelSectionActive() || threads == 1UL || m == 0UL || n == 0UL ) {
+      fill( 0UL, ( SO ? n : m ), 0UL, inner );
+      return;
+   }
+
+   const ThreadMapping threadmap( createThreadMapping( threads, m, n, SO ) );
+
+   const size_t addon1     ( ( ( m % threadmap.first ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare1( m / threadmap.first + addon1 );
+   const size_t rest1      ( equalShare1 & ( SIMDSIZE - 1UL ) );
+   const size_t rowsPerThread( ( SIMD && rest1 )?( equalShare1 - rest1 + SIMDSIZE ):( equalShare1 ) );
+
+   const size_t addon2     ( ( ( n % threadmap.second ) != 0UL )? 1UL : 0UL );
+   const size_t equalShare2( n / threadmap.second + addon2 );
+   const size_t rest2      ( equalShare2 & ( SIMDSIZE - 1UL ) );
+   const size_t colsPerThread( ( SIMD && rest2 )?( equalShare2 - rest2 + SIMDSIZE ):( equalShare2 ) );
+
+   BLAZE_PARALLEL_SECTION
+   {
+      TheThreadBackend::distribute( threads, [&]( size_t i )
+      {
+         const size_t row   ( ( i / threadmap.second ) * rowsPerThread );
+         const size_t column( ( i % threadmap.second ) * colsPerThread );
+
+         if( row >= m || column >= n )
+            return;
+
+         const size_t rowEnd   ( min( row+rowsPerThread   , m ) );
+         const size_t columnEnd( min( column+colsPerThread, n ) );
+
+         if( SO ) fill( column, columnEnd, row, rowEnd );
+         else     fill( row, rowEnd, column, columnEnd );
+      } );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  COMPILE TIME CONSTRAINT
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+namespace {
+
+BLAZE_STATIC_ASSERT( BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE );
+
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -84,7 +84,8 @@ BLAZE_ALWAYS_INLINE size_t getNumThreads()
 //
 // Via this function the maximum number of threads for thread parallel operations can be specified.
 // Note that the given \a number must be in the range \f$[1..\infty)\f$. In case an invalid
-// number of threads is specified, a \a std::invalid_argument exception is thrown.
+// number of threads is specified, a \a std::invalid_argument exception is thrown. Note that
+// this function must not be called while other threads execute thread parallel operations.
 */
 BLAZE_ALWAYS_INLINE void setNumThreads( size_t number )
 {
@@ -50,13 +50,17 @@
 #  include <boost/thread/thread.hpp>
 #endif
 
+#include <atomic>
 #include <cstdlib>
+#include <memory>
+#include <utility>
 #include <blaze/math/constraints/Expression.h>
+#include <blaze/math/smp/ParallelSection.h>
 #include <blaze/system/SMP.h>
 #include <blaze/util/algorithms/Max.h>
 #include <blaze/util/constraints/Const.h>
 #include <blaze/util/StaticAssert.h>
-#include <blaze/util/ThreadPool.h>
+#include <blaze/util/TaskScheduler.h>
 #include <blaze/util/Types.h>
 
 
@@ -74,8 +78,14 @@ namespace blaze {
 // \ingroup smp
 //
 // The ThreadBackend class template represents the backend system for the C++11 and Boost
-// thread-based parallelization. It provides the functionality to manage a pool of active
-// threads and to schedule (compound) assignment tasks for execution.\n
+// thread-based parallelization. It provides the functionality to manage a work-stealing task
+// scheduler and to schedule (compound) assignment tasks for execution. Note that the thread
+// calling wait() participates in the execution of the scheduled tasks, i.e. a backend system
+// of size \a n consists of the calling thread and \a n-1 worker threads. Several application
+// threads can schedule tasks concurrently, in which case they share the worker threads. Each
+// call to wait() only joins the tasks scheduled by the calling thread. In case the environment
+// variable \c BLAZE_THREAD_PINNING is set to a non-zero value, the worker threads are pinned to
+// individual CPUs (see TaskScheduler).\n
 // This class must \b NOT be used explicitly! It is reserved for internal use only. Using
 // this class explicitly might result in erroneous results and/or in undefined behavior.
 */
@@ -100,6 +110,12 @@ class ThreadBackend
    //@{
    template< typename Target, typename Source, typename OP >
    static inline void schedule( Target& target, const Source& source, OP op );
+
+   template< typename Callable >
+   static inline void schedule( Callable&& func );
+
+   template< typename Kernel >
+   static inline void distribute( size_t tasks, Kernel kernel );
    //@}
    //**********************************************************************************************
 
@@ -149,22 +165,33 @@ class ThreadBackend
    };
    //**********************************************************************************************
 
+   //**Thread execution functions******************************************************************
+   /*!\name Thread execution functions */
+   //@{
+   template< typename Callable >
+   static inline auto inherit( Callable&& func );
+   //@}
+   //**********************************************************************************************
+
    //**Initialization functions********************************************************************
    /*!\name Initialization functions */
    //@{
    static inline size_t initPool();
+   static inline bool   initPinning();
    //@}
    //**********************************************************************************************
 
    //**Member variables****************************************************************************
    /*!\name Member variables */
    //@{
-   static ThreadPool<TT,MT,LT,CT> threadpool_;  //!< The pool of active threads of the backend system.
-                                                /*!< It is initialized with the number of threads
-                                                     specified via the environment variable
-                                                     \c BLAZE_NUM_THREADS. However, it can be
-                                                     explicitly resized to arbitrary numbers of
-                                                     threads. */
+   static TaskScheduler<TT,MT,LT,CT> scheduler_;  //!< The task scheduler of the backend system.
+                                                 /*!< It is initialized with the number of threads
+                                                      specified via the environment variable
+                                                      \c BLAZE_NUM_THREADS. However, it can be
+                                                      explicitly resized to arbitrary numbers of
+                                                      threads. The worker threads are pinned in
+                                                      case the environment variable
+                                                      \c BLAZE_THREAD_PINNING is set. */
    //@}
    //**********************************************************************************************
 };
@@ -183,7 +210,7 @@ class ThreadBackend
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 template< typename TT, typename MT, typename LT, typename CT >
-ThreadPool<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::threadpool_( initPool() );
+TaskScheduler<TT,MT,LT,CT> ThreadBackend<TT,MT,LT,CT>::scheduler_( initPool(), initPinning() );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -208,7 +235,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 {
-   return threadpool_.size();
+   return scheduler_.size();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -223,12 +250,10 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::size()
 // \return void
 // \exception std::invalid_argument Invalid number of threads.
 //
-// This function changes the total number of threads managed by the thread backend system. If
-// \a n is smaller than the current size of the thread pool, the according number of threads is
-// removed from the backend system, otherwise new threads are added to the backend system. In
-// case an invalid number of threads is specified, an \a std::invalid_argument exception is
-// thrown. Via the \a block flag it is possible to block the function until the desired
-// number of threads is available.
+// This function changes the total number of threads managed by the thread backend system. All
+// scheduled tasks are completed before the worker threads of the task scheduler are replaced.
+// In case an invalid number of threads is specified, an \a std::invalid_argument exception is
+// thrown.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -236,7 +261,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 {
-   return threadpool_.resize( n, block );
+   return scheduler_.resize( n, block );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -248,7 +273,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::resize( size_t n, bool block )
 //
 // \return void
 //
-// This function blocks until all scheduled tasks have been completed.
+// This function blocks until all tasks scheduled by the calling thread have been completed.
+// While waiting, the calling thread executes scheduled tasks itself.
 */
 template< typename TT    // Type of the encapsulated thread
         , typename MT    // Type of the synchronization mutex
@@ -256,7 +282,7 @@ template< typename TT    // Type of the encapsulated thread
         , typename CT >  // Type of the condition variable
 inline void ThreadBackend<TT,MT,LT,CT>::wait()
 {
-   threadpool_.wait();
+   scheduler_.wait();
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -280,6 +306,8 @@ inline void ThreadBackend<TT,MT,LT,CT>::wait()
 // \return void
 //
 // This function schedules a (compound) assignment of the two given operands for execution.
+// The assignment is executed within a parallel section in case the calling thread is inside
+// a parallel section.
 */
 template< typename TT      // Type of the encapsulated thread
         , typename MT      // Type of the synchronization mutex
@@ -291,7 +319,116 @@ template< typename Target  // Type of the target operand
 inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source& source, OP op )
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_CONST( Target );
-   threadpool_.schedule( Assigner<Target,Source,OP>( target, source, op ) );
+   scheduler_.schedule( inherit( Assigner<Target,Source,OP>( target, source, op ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. It is used for tasks that
+// cannot be expressed as a (compound) assignment between two operands, as for instance the
+// individual passes of the SMP assignment to a sparse matrix. The function/functor is executed
+// within a parallel section in case the calling thread is inside a parallel section.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline void ThreadBackend<TT,MT,LT,CT>::schedule( Callable&& func )
+{
+   scheduler_.schedule( inherit( std::forward<Callable>( func ) ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Executing a set of tasks with a preferred thread for each task.
+//
+// \param tasks The total number of tasks.
+// \param kernel The serial kernel for a single task.
+// \return void
+//
+// This function executes the tasks \f$ [0..tasks) \f$ by calls of \c kernel(i) and blocks until
+// all tasks are completed. In contrast to scheduling the tasks individually, task \a i is
+// preferably executed by the thread with index \a i (the calling thread runs task 0, the worker
+// threads the tasks 1 to size()-1). For that purpose, each scheduled task first claims the task
+// of its executing thread and only falls back to the lowest unclaimed task in case this task is
+// already taken or does not exist. Thus for a fixed partitioning of an operand into size()
+// parts, every part is processed by the same thread across subsequent operations, which keeps
+// the accesses to first-touched memory pages local to the NUMA node of the thread. Load
+// balancing by means of work stealing remains unaffected.
+*/
+template< typename TT        // Type of the encapsulated thread
+        , typename MT        // Type of the synchronization mutex
+        , typename LT        // Type of the mutex lock
+        , typename CT >      // Type of the condition variable
+template< typename Kernel >  // Type of the task kernel
+inline void ThreadBackend<TT,MT,LT,CT>::distribute( size_t tasks, Kernel kernel )
+{
+   if( tasks == 0UL )
+      return;
+
+   const std::unique_ptr< std::atomic<bool>[] > claimed( new std::atomic<bool>[tasks]() );
+
+   auto claim = [&claimed,tasks]( size_t preferred ) {
+      if( preferred < tasks && !claimed[preferred].exchange( true ) )
+         return preferred;
+      size_t i( 0UL );
+      while( claimed[i].exchange( true ) ) ++i;
+      return i;
+   };
+
+   for( size_t i=1UL; i<tasks; ++i ) {
+      scheduler_.schedule( inherit( [&kernel,&claim]() {
+         kernel( claim( scheduler_.index() ) );
+      } ) );
+   }
+
+   kernel( claim( scheduler_.index() ) );
+
+   scheduler_.wait();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Passes the parallel section of the calling thread on to the given task.
+//
+// \param func The given function/functor.
+// \return The task executing the given function/functor.
+//
+// The activity flag of parallel sections is maintained per thread. Therefore a task executed
+// by a worker thread would not see the parallel section of the thread that scheduled it, and
+// SMP operations within the task would fork new parallel work instead of being executed
+// serially. This function wraps the given function/functor such that it is executed within
+// a parallel section in case the calling thread is inside a parallel section.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+inline auto ThreadBackend<TT,MT,LT,CT>::inherit( Callable&& func )
+{
+   return [func=std::forward<Callable>( func ), active=isParallelSectionActive()]() mutable
+   {
+      ParallelSection<int> section( active );
+      func();
+   };
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -307,7 +444,7 @@ inline void ThreadBackend<TT,MT,LT,CT>::schedule( Target& target, const Source&
 
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
-/*!\brief Returns the initial number of threads of the thread pool.
+/*!\brief Returns the initial number of threads of the task scheduler.
 //
 // \return The initial number of threads.
 //
@@ -338,6 +475,37 @@ inline size_t ThreadBackend<TT,MT,LT,CT>::initPool()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns whether the worker threads of the task scheduler are pinned.
+//
+// \return \a true in case the worker threads are pinned, \a false if not.
+//
+// This function determines the pinning of the worker threads based on the \c BLAZE_THREAD_PINNING
+// environment variable. In case the environment variable is not defined or is set to 0, the
+// function returns \a false. Otherwise it returns \a true.
+*/
+#if (defined _MSC_VER)
+#  pragma warning(push)
+#  pragma warning(disable:4996)
+#endif
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool ThreadBackend<TT,MT,LT,CT>::initPinning()
+{
+   const char* env = std::getenv( "BLAZE_THREAD_PINNING" );
+
+   return ( env != nullptr && atoi( env ) != 0 );
+}
+#if (defined _MSC_VER)
+#  pragma warning(pop)
+#endif
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
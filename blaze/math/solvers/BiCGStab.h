@@ -0,0 +1,235 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/BiCGStab.h
+//  \brief Header file for the biconjugate gradient stabilized method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+#define _BLAZE_MATH_SOLVERS_BICGSTAB_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  BICONJUGATE GRADIENT STABILIZED METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Biconjugate gradient stabilized method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& P, const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations via the right preconditioned biconjugate
+//        gradient stabilized method.
+// \ingroup solvers
+//
+// \param A The system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param P The preconditioner.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the (in general non-symmetric) linear system of equations
+// \f$ A\vec{x}=\vec{b} \f$ by means of the right preconditioned BiCGStab method, where the
+// given vector \a x is used as initial guess. The iteration stops as soon as
+// \f$ |\vec{b}-A\vec{x}| \leq tol \cdot |\vec{b}| \f$ or after the given maximum number of
+// iterations:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL );
+   // ... Initialization
+
+   const blaze::ILU0Preconditioner<double> P( A );
+   const blaze::SolverResult result( blaze::bicgstab( A, x, b, P ) );
+   \endcode
+
+// The system matrix \a A can be any dense or sparse matrix or a user-defined operator (see the
+// cg() function for the requirements on the operator and the IdentityPreconditioner class for
+// the requirements on the preconditioner). The vector updates are fused with the subsequent
+// dot products and norms, such that each iteration performs four passes over the vectors in
+// addition to the two products with the system matrix. In case of a breakdown of the method the
+// solver stops without convergence.
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const PT& P, const SolverSettings& settings )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using T = ElementType_t<VT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( T );
+
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   checkSystem( A, n );
+
+   SolverResult result;
+
+   DynamicVector<T,columnVector> xw( ~x ), r( ~b ), r0( n ), p( n, T() ), v( n, T() ),
+                                 s( n ), t( n ), pz( n ), sz( n );
+
+   const T bnorm( std::sqrt( dots( r, r, r )[0] ) );
+
+   if( bnorm == T() ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   multiply( A, xw, t );
+   r -= t;
+   r0 = r;
+
+   const T tol( T( settings.tolerance ) * bnorm );
+   T rr( dots( r, r, r )[0] );
+   T rho( rr ), rhoOld( 1 ), alpha( 1 ), omega( 1 );
+
+   while( std::sqrt( rr ) > tol && result.iterations < settings.maxIterations )
+   {
+      if( rho == T() || omega == T() )
+         break;
+
+      const T beta( ( rho / rhoOld ) * ( alpha / omega ) );
+      p = r + beta * ( p - omega * v );
+
+      const DynamicVector<T,columnVector>& ph( precondition( P, p, pz ) );
+      const T r0v( multDots( A, ph, v, r0 )[0] );
+
+      if( r0v == T() )
+         break;
+
+      alpha = rho / r0v;
+      ++result.iterations;
+
+      const T ss( waxpyDots( s, r, -alpha, v, r0 )[1] );
+
+      if( std::sqrt( ss ) <= tol ) {
+         xw += alpha * ph;
+         rr = ss;
+         break;
+      }
+
+      const DynamicVector<T,columnVector>& sh( precondition( P, s, sz ) );
+      const std::array<T,2UL> ts( multDots( A, sh, t, s ) );
+
+      if( ts[1] == T() )
+         break;
+
+      omega = ts[0] / ts[1];
+      xw += alpha * ph + omega * sh;
+
+      const std::array<T,2UL> res( waxpyDots( r, s, -omega, t, r0 ) );
+      rhoOld = rho;
+      rho    = res[0];
+      rr     = res[1];
+   }
+
+   ~x = xw;
+
+   result.residual  = double( std::sqrt( rr ) / bnorm );
+   result.converged = ( std::sqrt( rr ) <= tol );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations via the biconjugate gradient stabilized
+//        method.
+// \ingroup solvers
+//
+// \param A The system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A\vec{x}=\vec{b} \f$ by means of the
+// unpreconditioned BiCGStab method (see the preconditioned variant of the function for more
+// details).
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult bicgstab( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                       const SolverSettings& settings )
+{
+   return bicgstab( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,398 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/CG.h
+//  \brief Header file for the conjugate gradient method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_CG_H_
+#define _BLAZE_MATH_SOLVERS_CG_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CONJUGATE GRADIENT METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Conjugate gradient method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& P, const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update of the solution and the residual of the conjugate gradient method.
+// \ingroup solvers
+//
+// \param P The preconditioner.
+// \param x The current solution.
+// \param r The current residual.
+// \param z The preconditioned residual.
+// \param alpha The step length.
+// \param d The current search direction.
+// \param h The product of the system matrix and the current search direction.
+// \return The dot products \f$ \vec{r}\cdot\vec{r} \f$ and \f$ \vec{r}\cdot\vec{z} \f$.
+//
+// This function updates the solution and the residual in a single pass and subsequently applies
+// the given preconditioner to the updated residual.
+*/
+template< typename PT  // Type of the preconditioner
+        , typename T >  // Element type of the vectors
+std::array<T,2UL> cgUpdate( const PT& P, DynamicVector<T,columnVector>& x,
+                            DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z,
+                            T alpha, const DynamicVector<T,columnVector>& d,
+                            const DynamicVector<T,columnVector>& h )
+{
+   T* const px( x.data() );
+   T* const pr( r.data() );
+   const T* const pd( d.data() );
+   const T* const ph( h.data() );
+
+   const T rr( fusedReduce<1UL,T>( x.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type a( Lane::set( alpha ) );
+      Lane::store( px+i, a * Lane::load( pd+i ) + Lane::load( px+i ) );
+      const typename Lane::Type ri( Lane::load( pr+i ) - a * Lane::load( ph+i ) );
+      Lane::store( pr+i, ri );
+      acc[0] = ri * ri + acc[0];
+   } )[0] );
+
+   P.apply( r, z );
+
+   return { { rr, dots( r, z, z )[0] } };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update of the solution and the residual of the unpreconditioned conjugate
+//        gradient method.
+// \ingroup solvers
+//
+// \param P The identity preconditioner.
+// \param x The current solution.
+// \param r The current residual.
+// \param z The unused preconditioned residual.
+// \param alpha The step length.
+// \param d The current search direction.
+// \param h The product of the system matrix and the current search direction.
+// \return The dot products \f$ \vec{r}\cdot\vec{r} \f$ and \f$ \vec{r}\cdot\vec{r} \f$.
+//
+// This function updates the solution and the residual and computes the squared norm of the
+// updated residual in a single pass.
+*/
+template< typename T >  // Element type of the vectors
+std::array<T,2UL> cgUpdate( const IdentityPreconditioner& P, DynamicVector<T,columnVector>& x,
+                            DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z,
+                            T alpha, const DynamicVector<T,columnVector>& d,
+                            const DynamicVector<T,columnVector>& h )
+{
+   UNUSED_PARAMETER( P, z );
+
+   T* const px( x.data() );
+   T* const pr( r.data() );
+   const T* const pd( d.data() );
+   const T* const ph( h.data() );
+
+   const T rr( fusedReduce<1UL,T>( x.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type a( Lane::set( alpha ) );
+      Lane::store( px+i, a * Lane::load( pd+i ) + Lane::load( px+i ) );
+      const typename Lane::Type ri( Lane::load( pr+i ) - a * Lane::load( ph+i ) );
+      Lane::store( pr+i, ri );
+      acc[0] = ri * ri + acc[0];
+   } )[0] );
+
+   return { { rr, rr } };
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused update of the solution and the residual of the Jacobi preconditioned conjugate
+//        gradient method.
+// \ingroup solvers
+//
+// \param P The Jacobi preconditioner.
+// \param x The current solution.
+// \param r The current residual.
+// \param z The preconditioned residual.
+// \param alpha The step length.
+// \param d The current search direction.
+// \param h The product of the system matrix and the current search direction.
+// \return The dot products \f$ \vec{r}\cdot\vec{r} \f$ and \f$ \vec{r}\cdot\vec{z} \f$.
+//
+// This function updates the solution and the residual, applies the Jacobi preconditioner to
+// the updated residual and computes both dot products in a single pass.
+*/
+template< typename T >  // Element type of the vectors
+std::array<T,2UL> cgUpdate( const JacobiPreconditioner<T>& P, DynamicVector<T,columnVector>& x,
+                            DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z,
+                            T alpha, const DynamicVector<T,columnVector>& d,
+                            const DynamicVector<T,columnVector>& h )
+{
+   T* const px( x.data() );
+   T* const pr( r.data() );
+   T* const pz( z.data() );
+   const T* const pd( d.data() );
+   const T* const ph( h.data() );
+   const T* const pm( P.inverseDiagonal().data() );
+
+   return fusedReduce<2UL,T>( x.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type a( Lane::set( alpha ) );
+      Lane::store( px+i, a * Lane::load( pd+i ) + Lane::load( px+i ) );
+      const typename Lane::Type ri( Lane::load( pr+i ) - a * Lane::load( ph+i ) );
+      const typename Lane::Type zi( Lane::load( pm+i ) * ri );
+      Lane::store( pr+i, ri );
+      Lane::store( pz+i, zi );
+      acc[0] = ri * ri + acc[0];
+      acc[1] = ri * zi + acc[1];
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the preconditioned residual of the conjugate gradient method.
+// \ingroup solvers
+//
+// \param P The preconditioner.
+// \param r The current residual.
+// \param z The preconditioned residual.
+// \return Reference to the preconditioned residual.
+*/
+template< typename PT  // Type of the preconditioner
+        , typename T >  // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   preconditioned( const PT& P, const DynamicVector<T,columnVector>& r,
+                   const DynamicVector<T,columnVector>& z )
+{
+   UNUSED_PARAMETER( P, r );
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the (unmodified) residual of the unpreconditioned conjugate gradient method.
+// \ingroup solvers
+//
+// \param P The identity preconditioner.
+// \param r The current residual.
+// \param z The unused preconditioned residual.
+// \return Reference to the residual.
+*/
+template< typename T >  // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   preconditioned( const IdentityPreconditioner& P, const DynamicVector<T,columnVector>& r,
+                   const DynamicVector<T,columnVector>& z )
+{
+   UNUSED_PARAMETER( P, z );
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric positive definite linear system of equations via the
+//        preconditioned conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric positive definite system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param P The symmetric positive definite preconditioner.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A\vec{x}=\vec{b} \f$ by means of the
+// preconditioned conjugate gradient method, where the given vector \a x is used as initial
+// guess. The iteration stops as soon as \f$ |\vec{b}-A\vec{x}| \leq tol \cdot |\vec{b}| \f$
+// or after the given maximum number of iterations:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL );
+   // ... Initialization
+
+   const blaze::JacobiPreconditioner<double> P( A );
+   const blaze::SolverResult result( blaze::cg( A, x, b, P ) );
+   \endcode
+
+// The system matrix \a A can be any dense or sparse matrix or a user-defined operator, i.e. any
+// object \c op that can be called as \c op(d,h) to compute the product \f$ \vec{h}=A\vec{d} \f$
+// of two \c DynamicVector<T> (see the IdentityPreconditioner class for the requirements on the
+// preconditioner). Each iteration performs a single pass over all vectors for the update of the
+// solution and the residual and the computation of the residual norm. For row-major sparse
+// system matrices, the matrix/vector product is fused with the subsequent dot product. In case
+// the system matrix is not positive definite the solver stops without convergence.
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const PT& P, const SolverSettings& settings )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using T = ElementType_t<VT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( T );
+
+   const size_t n( (~b).size() );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   checkSystem( A, n );
+
+   SolverResult result;
+
+   DynamicVector<T,columnVector> xw( ~x ), r( ~b ), z( n ), d( n ), h( n );
+
+   const T bnorm( std::sqrt( dots( r, r, r )[0] ) );
+
+   if( bnorm == T() ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   multiply( A, xw, h );
+   r -= h;
+
+   const T tol( T( settings.tolerance ) * bnorm );
+   T rr( dots( r, r, r )[0] );
+
+   d = precondition( P, r, z );
+   T rz( dots( r, d, d )[0] );
+
+   while( std::sqrt( rr ) > tol && result.iterations < settings.maxIterations )
+   {
+      const T dh( multDots( A, d, h, d )[0] );
+
+      if( !( dh > T() ) )
+         break;
+
+      const T alpha( rz / dh );
+      const std::array<T,2UL> res( cgUpdate( P, xw, r, z, alpha, d, h ) );
+      ++result.iterations;
+
+      const T beta( res[1] / rz );
+      rr = res[0];
+      rz = res[1];
+
+      d = preconditioned( P, r, z ) + beta * d;
+   }
+
+   ~x = xw;
+
+   result.residual  = double( std::sqrt( rr ) / bnorm );
+   result.converged = ( std::sqrt( rr ) <= tol );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given symmetric positive definite linear system of equations via the
+//        conjugate gradient method.
+// \ingroup solvers
+//
+// \param A The symmetric positive definite system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+//
+// This function solves the linear system of equations \f$ A\vec{x}=\vec{b} \f$ by means of the
+// unpreconditioned conjugate gradient method (see the preconditioned variant of the function
+// for more details).
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult cg( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                 const SolverSettings& settings )
+{
+   return cg( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,271 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/GMRES.h
+//  \brief Header file for the generalized minimal residual method
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_GMRES_H_
+#define _BLAZE_MATH_SOLVERS_GMRES_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <cmath>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/solvers/Kernels.h>
+#include <blaze/math/solvers/Preconditioners.h>
+#include <blaze/math/solvers/SolverSettings.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  GENERALIZED MINIMAL RESIDUAL METHOD
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Generalized minimal residual method */
+//@{
+template< typename OP, typename VT1, typename VT2, typename PT >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& P, const SolverSettings& settings = SolverSettings() );
+
+template< typename OP, typename VT1, typename VT2 >
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings = SolverSettings() );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations via the right preconditioned restarted
+//        generalized minimal residual method.
+// \ingroup solvers
+//
+// \param A The system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param P The preconditioner.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid restart length.
+//
+// This function solves the (in general non-symmetric) linear system of equations
+// \f$ A\vec{x}=\vec{b} \f$ by means of the right preconditioned GMRES(m) method, where the
+// given vector \a x is used as initial guess and \a m is given by the \a restart setting. The
+// iteration stops as soon as \f$ |\vec{b}-A\vec{x}| \leq tol \cdot |\vec{b}| \f$ or after the
+// given maximum number of iterations:
+
+   \code
+   blaze::CompressedMatrix<double> A( 1000UL, 1000UL );
+   blaze::DynamicVector<double> x( 1000UL, 0.0 ), b( 1000UL );
+   // ... Initialization
+
+   blaze::SolverSettings settings;
+   settings.restart = 50UL;
+
+   const blaze::ILU0Preconditioner<double> P( A );
+   const blaze::SolverResult result( blaze::gmres( A, x, b, P, settings ) );
+   \endcode
+
+// The system matrix \a A can be any dense or sparse matrix or a user-defined operator (see the
+// cg() function for the requirements on the operator and the IdentityPreconditioner class for
+// the requirements on the preconditioner). The Krylov basis is orthogonalized by means of the
+// modified Gram-Schmidt method, where each subtraction of a basis vector is fused with the dot
+// product with the next basis vector. The reported residual is the true residual at the end of
+// the last restart cycle.
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2    // Type of the right-hand side vector
+        , typename PT >   // Type of the preconditioner
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const PT& P, const SolverSettings& settings )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using T = ElementType_t<VT1>;
+
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( T );
+
+   const size_t n( (~b).size() );
+   const size_t m( settings.restart );
+
+   if( (~x).size() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( m == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid restart length" );
+   }
+
+   checkSystem( A, n );
+
+   SolverResult result;
+
+   DynamicVector<T,columnVector> xw( ~x ), bw( ~b ), r( n ), w( n ), z( n );
+   std::vector< DynamicVector<T,columnVector> > V( m+1UL, DynamicVector<T,columnVector>( n ) );
+   DynamicMatrix<T,rowMajor> H( m+1UL, m, T() );
+   DynamicVector<T,columnVector> g( m+1UL ), c( m ), s( m ), y( m );
+
+   const T bnorm( std::sqrt( dots( bw, bw, bw )[0] ) );
+
+   if( bnorm == T() ) {
+      reset( ~x );
+      result.converged = true;
+      return result;
+   }
+
+   const T tol( T( settings.tolerance ) * bnorm );
+
+   multiply( A, xw, w );
+   r = bw - w;
+   T beta( std::sqrt( dots( r, r, r )[0] ) );
+
+   while( beta > tol && result.iterations < settings.maxIterations )
+   {
+      V[0UL] = r * ( T(1) / beta );
+      reset( g );
+      g[0UL] = beta;
+
+      size_t j( 0UL );
+
+      while( j < m && result.iterations < settings.maxIterations )
+      {
+         T hij( multDots( A, precondition( P, V[j], z ), w, V[0UL] )[0] );
+
+         for( size_t i=0UL; i<=j; ++i ) {
+            H(i,j) = hij;
+            hij = axpyDot( w, -hij, V[i], ( i < j )?( V[i+1UL] ):( w ) );
+         }
+
+         const T hnorm( std::sqrt( hij ) );
+
+         if( hnorm != T() ) {
+            V[j+1UL] = w * ( T(1) / hnorm );
+         }
+
+         for( size_t i=0UL; i<j; ++i ) {
+            const T tmp( c[i]*H(i,j) + s[i]*H(i+1UL,j) );
+            H(i+1UL,j) = -s[i]*H(i,j) + c[i]*H(i+1UL,j);
+            H(i,j) = tmp;
+         }
+
+         const T denom( std::sqrt( H(j,j)*H(j,j) + hnorm*hnorm ) );
+         c[j] = H(j,j) / denom;
+         s[j] = hnorm / denom;
+         H(j,j) = denom;
+         H(j+1UL,j) = T();
+         g[j+1UL] = -s[j] * g[j];
+         g[j] = c[j] * g[j];
+
+         ++j;
+         ++result.iterations;
+
+         if( std::abs( g[j] ) <= tol || hnorm == T() )
+            break;
+      }
+
+      for( size_t i=j; i-- > 0UL; ) {
+         T tmp( g[i] );
+         for( size_t k=i+1UL; k<j; ++k ) {
+            tmp -= H(i,k) * y[k];
+         }
+         y[i] = tmp / H(i,i);
+      }
+
+      w = y[0UL] * V[0UL];
+      for( size_t i=1UL; i<j; ++i ) {
+         w += y[i] * V[i];
+      }
+
+      xw += precondition( P, w, z );
+
+      multiply( A, xw, w );
+      r = bw - w;
+      beta = std::sqrt( dots( r, r, r )[0] );
+   }
+
+   ~x = xw;
+
+   result.residual  = double( beta / bnorm );
+   result.converged = ( beta <= tol );
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Solves the given linear system of equations via the restarted generalized minimal
+//        residual method.
+// \ingroup solvers
+//
+// \param A The system matrix or operator.
+// \param x The initial guess and the resulting solution vector.
+// \param b The right-hand side vector.
+// \param settings The settings of the solver.
+// \return The number of iterations, the final relative residual, and the convergence flag.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+// \exception std::invalid_argument Invalid restart length.
+//
+// This function solves the linear system of equations \f$ A\vec{x}=\vec{b} \f$ by means of the
+// unpreconditioned GMRES(m) method (see the preconditioned variant of the function for more
+// details).
+*/
+template< typename OP     // Type of the system matrix or operator
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+SolverResult gmres( const OP& A, DenseVector<VT1,false>& x, const DenseVector<VT2,false>& b,
+                    const SolverSettings& settings )
+{
+   return gmres( A, x, b, IdentityPreconditioner(), settings );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
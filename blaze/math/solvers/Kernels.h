@@ -0,0 +1,533 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Kernels.h
+//  \brief Header file for the fused vector kernels of the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_KERNELS_H_
+#define _BLAZE_MATH_SOLVERS_KERNELS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <array>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/SIMD.h>
+#include <blaze/math/smp/Reduction.h>
+#include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDMult.h>
+#include <blaze/math/typetraits/HasSIMDSub.h>
+#include <blaze/math/typetraits/IsMatrix.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/typetraits/IsVectorizable.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Scalar lane of the fused vector kernels of the iterative solvers.
+// \ingroup solvers
+//
+// The fused vector kernels of the iterative solvers are formulated as generic lambdas that are
+// called with either a scalar lane or a SIMD lane. The lane provides the type and the load and
+// store operations for a single step of the kernel. The ScalarLane class template processes
+// a single element per step.
+*/
+template< typename T >  // Element type of the vectors
+struct ScalarLane
+{
+   using Type = T;  //!< Type of a single step of the kernel.
+
+   static constexpr size_t size = 1UL;  //!< Number of elements per step.
+
+   static BLAZE_ALWAYS_INLINE T    load ( const T* address ) noexcept { return *address; }
+   static BLAZE_ALWAYS_INLINE void store( T* address, T value ) noexcept { *address = value; }
+   static BLAZE_ALWAYS_INLINE T    set  ( T value ) noexcept { return value; }
+   static BLAZE_ALWAYS_INLINE T    total( T value ) noexcept { return value; }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD lane of the fused vector kernels of the iterative solvers.
+// \ingroup solvers
+//
+// The SIMDLane class template processes a complete SIMD vector of elements per step of the
+// kernel (see ScalarLane).
+*/
+template< typename T >  // Element type of the vectors
+struct SIMDLane
+{
+   using Type = SIMDTrait_t<T>;  //!< Type of a single step of the kernel.
+
+   static constexpr size_t size = SIMDTrait<T>::size;  //!< Number of elements per step.
+
+   static BLAZE_ALWAYS_INLINE Type load ( const T* address ) noexcept { return loadu( address ); }
+   static BLAZE_ALWAYS_INLINE void store( T* address, const Type& value ) noexcept { storeu( address, value ); }
+   static BLAZE_ALWAYS_INLINE Type set  ( T value ) noexcept { return blaze::set( value ); }
+   static BLAZE_ALWAYS_INLINE T    total( const Type& value ) noexcept { return sum( value ); }
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Auxiliary alias declaration for the lane type of the fused vector kernels.
+// \ingroup solvers
+//
+// The VectorLane_t alias declaration selects the SIMD lane in case the given element type can
+// be vectorized and the scalar lane otherwise.
+*/
+template< typename T >  // Element type of the vectors
+using VectorLane_t = If_t< IsVectorizable_v<T> && HasSIMDAdd_v<T,T> &&
+                           HasSIMDSub_v<T,T> && HasSIMDMult_v<T,T>
+                         , SIMDLane<T>
+                         , ScalarLane<T> >;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  FUSED VECTOR KERNELS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Backend implementation of a fused vector kernel for a range of elements.
+// \ingroup solvers
+//
+// \param index The index of the first element of the range.
+// \param size The number of elements of the range.
+// \param kernel The fused vector kernel.
+// \return The \a K partial results of the kernel for the given range.
+//
+// This function applies the given \a kernel to all elements in the range \f$ [index..index+size) \f$.
+// The kernel is called as \c kernel(lane,i,acc) for the step starting at element \a i, where
+// \a acc is an array of \a K accumulators of the lane type. All steps but the last few ones are
+// performed by means of SIMD operations, in case the element type can be vectorized.
+*/
+template< size_t K          // Number of results of the kernel
+        , typename T        // Element type of the vectors
+        , typename Kernel >  // Type of the fused vector kernel
+std::array<T,K> fusedKernel( size_t index, size_t size, Kernel& kernel )
+{
+   using Lane = VectorLane_t<T>;
+
+   std::array<T,K> result;
+   typename Lane::Type acc[K];
+   T rest[K];
+
+   for( size_t k=0UL; k<K; ++k ) {
+      acc[k]  = Lane::set( T() );
+      rest[k] = T();
+   }
+
+   const size_t end ( index + size );
+   const size_t ipos( index + ( size & size_t(-Lane::size) ) );
+
+   size_t i( index );
+
+   for( ; i<ipos; i+=Lane::size ) {
+      kernel( Lane(), i, acc );
+   }
+   for( ; i<end; ++i ) {
+      kernel( ScalarLane<T>(), i, rest );
+   }
+
+   for( size_t k=0UL; k<K; ++k ) {
+      result[k] = Lane::total( acc[k] ) + rest[k];
+   }
+
+   return result;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies a fused vector kernel to all elements of the involved vectors.
+// \ingroup solvers
+//
+// \param size The size of the involved vectors.
+// \param kernel The fused vector kernel.
+// \return The \a K results of the kernel (as for instance dot products).
+//
+// This function applies the given fused vector \a kernel to all \a size elements of the involved
+// vectors in a single pass. In case the size of the vectors is larger or equal to the
+// SMP_SOLVERUPDATE_THRESHOLD, the vectors are partitioned and the partitions are processed in
+// parallel. The partial results are combined in ascending order of the partitions.
+*/
+template< size_t K          // Number of results of the kernel
+        , typename T        // Element type of the vectors
+        , typename Kernel >  // Type of the fused vector kernel
+std::array<T,K> fusedReduce( size_t size, Kernel kernel )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   auto partition = [&kernel]( size_t index, size_t n ) {
+      return fusedKernel<K,T>( index, n, kernel );
+   };
+
+   if( size < SMP_SOLVERUPDATE_THRESHOLD ) {
+      return partition( 0UL, size );
+   }
+
+   return smpReduce( size, SIMDTrait<T>::size, partition,
+                     []( const std::array<T,K>& lhs, const std::array<T,K>& rhs ) {
+                        std::array<T,K> res;
+                        for( size_t k=0UL; k<K; ++k ) {
+                           res[k] = lhs[k] + rhs[k];
+                        }
+                        return res;
+                     } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused vector update and dot product (\f$ \vec{y}+=\alpha\vec{x}, s=\vec{y}\cdot\vec{z} \f$).
+// \ingroup solvers
+//
+// \param y The vector to be updated.
+// \param alpha The scaling factor for \a x.
+// \param x The vector to be added to \a y.
+// \param z The right-hand side vector of the dot product (may be \a y itself).
+// \return The dot product of the updated vector \a y and \a z.
+*/
+template< typename T >  // Element type of the vectors
+T axpyDot( DynamicVector<T,columnVector>& y, T alpha, const DynamicVector<T,columnVector>& x,
+           const DynamicVector<T,columnVector>& z )
+{
+   BLAZE_INTERNAL_ASSERT( y.size() == x.size() && y.size() == z.size(), "Invalid vector sizes" );
+
+   T* const py( y.data() );
+   const T* const px( x.data() );
+   const T* const pz( z.data() );
+
+   return fusedReduce<1UL,T>( y.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type yi( Lane::set( alpha ) * Lane::load( px+i ) + Lane::load( py+i ) );
+      Lane::store( py+i, yi );
+      acc[0] = yi * Lane::load( pz+i ) + acc[0];
+   } )[0];
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused vector addition and two dot products (\f$ \vec{w}=\vec{y}+\alpha\vec{x} \f$).
+// \ingroup solvers
+//
+// \param w The target vector.
+// \param y The left-hand side vector of the addition.
+// \param alpha The scaling factor for \a x.
+// \param x The right-hand side vector of the addition.
+// \param z The right-hand side vector of the first dot product.
+// \return The dot products \f$ \vec{w}\cdot\vec{z} \f$ and \f$ \vec{w}\cdot\vec{w} \f$.
+*/
+template< typename T >  // Element type of the vectors
+std::array<T,2UL> waxpyDots( DynamicVector<T,columnVector>& w, const DynamicVector<T,columnVector>& y,
+                             T alpha, const DynamicVector<T,columnVector>& x,
+                             const DynamicVector<T,columnVector>& z )
+{
+   BLAZE_INTERNAL_ASSERT( w.size() == y.size() && w.size() == x.size() && w.size() == z.size(),
+                          "Invalid vector sizes" );
+
+   T* const pw( w.data() );
+   const T* const py( y.data() );
+   const T* const px( x.data() );
+   const T* const pz( z.data() );
+
+   return fusedReduce<2UL,T>( w.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type wi( Lane::set( alpha ) * Lane::load( px+i ) + Lane::load( py+i ) );
+      Lane::store( pw+i, wi );
+      acc[0] = wi * Lane::load( pz+i ) + acc[0];
+      acc[1] = wi * wi + acc[1];
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused computation of two dot products (\f$ \vec{x}\cdot\vec{y}, \vec{x}\cdot\vec{z} \f$).
+// \ingroup solvers
+//
+// \param x The common left-hand side vector of both dot products.
+// \param y The right-hand side vector of the first dot product.
+// \param z The right-hand side vector of the second dot product.
+// \return The dot products \f$ \vec{x}\cdot\vec{y} \f$ and \f$ \vec{x}\cdot\vec{z} \f$.
+*/
+template< typename T >  // Element type of the vectors
+std::array<T,2UL> dots( const DynamicVector<T,columnVector>& x, const DynamicVector<T,columnVector>& y,
+                        const DynamicVector<T,columnVector>& z )
+{
+   BLAZE_INTERNAL_ASSERT( x.size() == y.size() && x.size() == z.size(), "Invalid vector sizes" );
+
+   const T* const px( x.data() );
+   const T* const py( y.data() );
+   const T* const pz( z.data() );
+
+   return fusedReduce<2UL,T>( x.size(), [=]( auto lane, size_t i, auto* acc ) {
+      using Lane = decltype( lane );
+      const typename Lane::Type xi( Lane::load( px+i ) );
+      acc[0] = xi * Lane::load( py+i ) + acc[0];
+      acc[1] = xi * Lane::load( pz+i ) + acc[1];
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATOR FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given system matrix.
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param n The size of the right-hand side vector.
+// \return void
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Matrix and vector sizes do not match.
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO >    // Storage order of the system matrix
+inline void checkSystem( const Matrix<MT,SO>& A, size_t n )
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   if( (~A).rows() != n ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix and vector sizes do not match" );
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Checks the dimensions of the given user-defined operator.
+// \ingroup solvers
+//
+// \param A The user-defined operator.
+// \param n The size of the right-hand side vector.
+// \return void
+//
+// The dimensions of a user-defined operator cannot be checked. Therefore this function has no
+// effect.
+*/
+template< typename OP >  // Type of the user-defined operator
+inline EnableIf_t< !IsMatrix_v<OP> > checkSystem( const OP& A, size_t n )
+{
+   UNUSED_PARAMETER( A, n );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given matrix to a vector (\f$ \vec{y}=A\vec{x} \f$).
+// \ingroup solvers
+//
+// \param A The system matrix.
+// \param x The vector to be multiplied.
+// \param y The resulting vector.
+// \return void
+*/
+template< typename MT  // Type of the system matrix
+        , bool SO      // Storage order of the system matrix
+        , typename T >  // Element type of the vectors
+inline void multiply( const Matrix<MT,SO>& A, const DynamicVector<T,columnVector>& x,
+                      DynamicVector<T,columnVector>& y )
+{
+   y = (~A) * x;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given user-defined operator to a vector (\f$ \vec{y}=A\vec{x} \f$).
+// \ingroup solvers
+//
+// \param A The user-defined operator.
+// \param x The vector to be multiplied.
+// \param y The resulting vector.
+// \return void
+//
+// The operator is called as \c A(x,y) and is expected to compute \f$ \vec{y}=A\vec{x} \f$.
+*/
+template< typename OP  // Type of the user-defined operator
+        , typename T >  // Element type of the vectors
+inline EnableIf_t< !IsMatrix_v<OP> >
+   multiply( const OP& A, const DynamicVector<T,columnVector>& x, DynamicVector<T,columnVector>& y )
+{
+   A( x, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused operator application and two dot products (\f$ \vec{y}=A\vec{x} \f$).
+// \ingroup solvers
+//
+// \param A The system matrix or user-defined operator.
+// \param x The vector to be multiplied.
+// \param y The resulting vector.
+// \param w The left-hand side vector of the first dot product.
+// \return The dot products \f$ \vec{w}\cdot\vec{y} \f$ and \f$ \vec{y}\cdot\vec{y} \f$.
+//
+// This is the default implementation for dense matrices, column-major sparse matrices and
+// user-defined operators. The product is computed by the according Blaze kernel or operator,
+// the dot products are computed in a second pass.
+*/
+template< typename OP  // Type of the system matrix or operator
+        , typename T >  // Element type of the vectors
+inline std::array<T,2UL> multDots( const OP& A, const DynamicVector<T,columnVector>& x,
+                                   DynamicVector<T,columnVector>& y,
+                                   const DynamicVector<T,columnVector>& w )
+{
+   multiply( A, x, y );
+   return dots( y, w, y );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Fused row-major sparse matrix/dense vector multiplication and two dot products.
+// \ingroup solvers
+//
+// \param A The row-major sparse system matrix.
+// \param x The vector to be multiplied.
+// \param y The resulting vector.
+// \param w The left-hand side vector of the first dot product.
+// \return The dot products \f$ \vec{w}\cdot\vec{y} \f$ and \f$ \vec{y}\cdot\vec{y} \f$.
+//
+// This function computes the product \f$ \vec{y}=A\vec{x} \f$ row by row and accumulates the
+// dot products while the elements of \a y are still in registers. In case the number of rows
+// is larger than the SMP_SMATDVECMULT_THRESHOLD, the rows are processed in parallel.
+*/
+template< typename MT  // Type of the system matrix
+        , typename T >  // Element type of the vectors
+std::array<T,2UL> multDots( const SparseMatrix<MT,rowMajor>& A, const DynamicVector<T,columnVector>& x,
+                            DynamicVector<T,columnVector>& y, const DynamicVector<T,columnVector>& w )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   using CT = CompositeType_t<MT>;
+
+   BLAZE_INTERNAL_ASSERT( (~A).columns() == x.size(), "Invalid vector size" );
+   BLAZE_INTERNAL_ASSERT( (~A).rows() == y.size() && y.size() == w.size(), "Invalid vector sizes" );
+
+   CT a( ~A );
+
+   auto kernel = [&a,&x,&y,&w]( size_t index, size_t n ) {
+      std::array<T,2UL> res{ { T(), T() } };
+      for( size_t i=index; i<index+n; ++i ) {
+         T yi = T();
+         const auto end( a.end(i) );
+         for( auto element=a.begin(i); element!=end; ++element ) {
+            yi += element->value() * x[element->index()];
+         }
+         y[i] = yi;
+         res[0] += w[i] * yi;
+         res[1] += yi * yi;
+      }
+      return res;
+   };
+
+   if( a.rows() <= SMP_SMATDVECMULT_THRESHOLD ) {
+      return kernel( 0UL, a.rows() );
+   }
+
+   return smpReduce( a.rows(), 1UL, kernel,
+                     []( const std::array<T,2UL>& lhs, const std::array<T,2UL>& rhs ) {
+                        return std::array<T,2UL>{ { lhs[0] + rhs[0], lhs[1] + rhs[1] } };
+                     } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
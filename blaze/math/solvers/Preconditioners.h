@@ -0,0 +1,486 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/Preconditioners.h
+//  \brief Header file for the preconditioners of the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_PRECONDITIONERS_H_
+#define _BLAZE_MATH_SOLVERS_PRECONDITIONERS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/DynamicVector.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/FloatingPoint.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS IDENTITYPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Identity preconditioner for the iterative solvers.
+// \ingroup solvers
+//
+// The IdentityPreconditioner class represents the absence of a preconditioner. It is used by
+// the iterative solvers in case no preconditioner is specified explicitly. In general, a
+// preconditioner is an arbitrary class that provides the constant member function
+
+   \code
+   void apply( const DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z ) const;
+   \endcode
+
+// which computes \f$ \vec{z}=M^{-1}\vec{r} \f$ for an approximation \f$ M \f$ of the system
+// matrix.
+*/
+class IdentityPreconditioner
+{
+ public:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename T >
+   inline void apply( const DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z ) const;
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the identity preconditioner (\f$ \vec{z}=\vec{r} \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting vector.
+// \return void
+*/
+template< typename T >  // Element type of the vectors
+inline void IdentityPreconditioner::apply( const DynamicVector<T,columnVector>& r,
+                                           DynamicVector<T,columnVector>& z ) const
+{
+   z = r;
+}
+//*************************************************************************************************
+
+
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the given preconditioner (\f$ \vec{z}=M^{-1}\vec{r} \f$).
+// \ingroup solvers
+//
+// \param P The preconditioner.
+// \param r The vector to be preconditioned.
+// \param z The resulting vector.
+// \return Reference to the preconditioned vector \a z.
+*/
+template< typename PT  // Type of the preconditioner
+        , typename T >  // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   precondition( const PT& P, const DynamicVector<T,columnVector>& r, DynamicVector<T,columnVector>& z )
+{
+   P.apply( r, z );
+   return z;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Applies the identity preconditioner (\f$ \vec{z}=\vec{r} \f$).
+// \ingroup solvers
+//
+// \param P The identity preconditioner.
+// \param r The vector to be preconditioned.
+// \param z The unused resulting vector.
+// \return Reference to the given vector \a r.
+//
+// This overload avoids the copy operation of the identity preconditioner.
+*/
+template< typename T >  // Element type of the vectors
+inline const DynamicVector<T,columnVector>&
+   precondition( const IdentityPreconditioner& P, const DynamicVector<T,columnVector>& r,
+                 DynamicVector<T,columnVector>& z )
+{
+   UNUSED_PARAMETER( P, z );
+   return r;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS JACOBIPRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Jacobi (diagonal) preconditioner for the iterative solvers.
+// \ingroup solvers
+//
+// The JacobiPreconditioner class template represents the diagonal of the system matrix, i.e.
+// \f$ M=diag(A) \f$. It stores the inverse diagonal elements, such that the application of the
+// preconditioner reduces to a componentwise multiplication:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::JacobiPreconditioner<double> P( A );
+   blaze::cg( A, x, b, P );
+   \endcode
+
+// Within the conjugate gradient method the application of the Jacobi preconditioner is fused
+// with the update of the residual. In case any diagonal element of the system matrix is zero,
+// a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+class JacobiPreconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline JacobiPreconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void apply( const DynamicVector<Type,columnVector>& r,
+                      DynamicVector<Type,columnVector>& z ) const;
+
+   inline const DynamicVector<Type,columnVector>& inverseDiagonal() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   DynamicVector<Type,columnVector> inv_;  //!< The inverse diagonal elements of the system matrix.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the JacobiPreconditioner class template.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Zero diagonal element detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline JacobiPreconditioner<Type>::JacobiPreconditioner( const Matrix<MT,SO>& A )
+   : inv_( (~A).rows() )  // The inverse diagonal elements of the system matrix
+{
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   CompositeType_t<MT> a( ~A );
+
+   for( size_t i=0UL; i<a.rows(); ++i ) {
+      const Type diag( a(i,i) );
+      if( isDefault( diag ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Zero diagonal element detected" );
+      }
+      inv_[i] = Type(1) / diag;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the Jacobi preconditioner (\f$ \vec{z}=diag(A)^{-1}\vec{r} \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting vector.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+inline void JacobiPreconditioner<Type>::apply( const DynamicVector<Type,columnVector>& r,
+                                               DynamicVector<Type,columnVector>& z ) const
+{
+   BLAZE_INTERNAL_ASSERT( r.size() == inv_.size(), "Invalid vector size" );
+
+   z = inv_ * r;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the inverse diagonal elements of the system matrix.
+//
+// \return The inverse diagonal elements of the system matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const DynamicVector<Type,columnVector>&
+   JacobiPreconditioner<Type>::inverseDiagonal() const noexcept
+{
+   return inv_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS ILU0PRECONDITIONER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Incomplete LU preconditioner without fill-in for the iterative solvers.
+// \ingroup solvers
+//
+// The ILU0Preconditioner class template represents the incomplete LU factorization ILU(0) of
+// the system matrix, i.e. \f$ M=LU \f$, where the lower unitriangular factor \f$ L \f$ and the
+// upper triangular factor \f$ U \f$ have the same sparsity pattern as the system matrix. Both
+// factors are stored in a single row-major compressed matrix. The application of the
+// preconditioner consists of a forward and a backward substitution:
+
+   \code
+   blaze::CompressedMatrix<double> A;
+   blaze::DynamicVector<double> x, b;
+   // ... Resizing and initialization
+
+   const blaze::ILU0Preconditioner<double> P( A );
+   blaze::bicgstab( A, x, b, P );
+   \endcode
+
+// The factorization requires all diagonal elements of the system matrix to be part of its
+// sparsity pattern. In case a diagonal element is missing or a zero pivot is encountered during
+// the factorization, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type >  // Data type of the preconditioner
+class ILU0Preconditioner
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   template< typename MT, bool SO >
+   explicit inline ILU0Preconditioner( const Matrix<MT,SO>& A );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void apply( const DynamicVector<Type,columnVector>& r,
+                      DynamicVector<Type,columnVector>& z ) const;
+
+   inline const CompressedMatrix<Type,rowMajor>& factors() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   CompressedMatrix<Type,rowMajor> lu_;  //!< The combined incomplete LU factors.
+   std::vector<size_t> diag_;            //!< The positions of the diagonal elements within the rows.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_BE_FLOATING_POINT_TYPE( Type );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for the ILU0Preconditioner class template.
+//
+// \param A The square system matrix.
+// \exception std::invalid_argument Invalid non-square matrix provided.
+// \exception std::invalid_argument Missing diagonal element detected.
+// \exception std::invalid_argument Zero pivot detected.
+*/
+template< typename Type >  // Data type of the preconditioner
+template< typename MT      // Type of the system matrix
+        , bool SO >        // Storage order of the system matrix
+inline ILU0Preconditioner<Type>::ILU0Preconditioner( const Matrix<MT,SO>& A )
+   : lu_  ()  // The combined incomplete LU factors
+   , diag_()  // The positions of the diagonal elements within the rows
+{
+   using Iterator = typename CompressedMatrix<Type,rowMajor>::Iterator;
+
+   if( (~A).rows() != (~A).columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid non-square matrix provided" );
+   }
+
+   lu_ = ~A;
+
+   const size_t n( lu_.rows() );
+   const size_t unset( n );
+
+   diag_.resize( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      const Iterator diag( lu_.find( i, i ) );
+      if( diag == lu_.end(i) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Missing diagonal element detected" );
+      }
+      diag_[i] = diag - lu_.begin(i);
+   }
+
+   std::vector<size_t> marker( n, unset );
+
+   for( size_t i=0UL; i<n; ++i )
+   {
+      const Iterator begin( lu_.begin(i) );
+      const Iterator end  ( lu_.end(i) );
+
+      for( Iterator element=begin; element!=end; ++element ) {
+         marker[element->index()] = element - begin;
+      }
+
+      for( Iterator element=begin; element!=begin+diag_[i]; ++element )
+      {
+         const size_t k( element->index() );
+         const Iterator pivot( lu_.begin(k) + diag_[k] );
+
+         element->value() /= pivot->value();
+
+         for( Iterator upper=pivot+1; upper!=lu_.end(k); ++upper ) {
+            const size_t pos( marker[upper->index()] );
+            if( pos != unset ) {
+               begin[pos].value() -= element->value() * upper->value();
+            }
+         }
+      }
+
+      for( Iterator element=begin; element!=end; ++element ) {
+         marker[element->index()] = unset;
+      }
+
+      if( isDefault( begin[diag_[i]].value() ) ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Zero pivot detected" );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Application of the ILU(0) preconditioner (\f$ \vec{z}=(LU)^{-1}\vec{r} \f$).
+//
+// \param r The vector to be preconditioned.
+// \param z The resulting vector.
+// \return void
+*/
+template< typename Type >  // Data type of the preconditioner
+inline void ILU0Preconditioner<Type>::apply( const DynamicVector<Type,columnVector>& r,
+                                             DynamicVector<Type,columnVector>& z ) const
+{
+   using ConstIterator = typename CompressedMatrix<Type,rowMajor>::ConstIterator;
+
+   BLAZE_INTERNAL_ASSERT( r.size() == lu_.rows(), "Invalid vector size" );
+
+   const size_t n( lu_.rows() );
+
+   z.resize( n, false );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      Type tmp( r[i] );
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      for( ConstIterator element=lu_.begin(i); element!=diag; ++element ) {
+         tmp -= element->value() * z[element->index()];
+      }
+      z[i] = tmp;
+   }
+
+   for( size_t i=n; i-- > 0UL; ) {
+      Type tmp( z[i] );
+      const ConstIterator diag( lu_.begin(i) + diag_[i] );
+      for( ConstIterator element=diag+1; element!=lu_.end(i); ++element ) {
+         tmp -= element->value() * z[element->index()];
+      }
+      z[i] = tmp / diag->value();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the combined incomplete LU factors.
+//
+// \return The strictly lower part of \f$ L \f$ and the upper part \f$ U \f$ in a single matrix.
+*/
+template< typename Type >  // Data type of the preconditioner
+inline const CompressedMatrix<Type,rowMajor>& ILU0Preconditioner<Type>::factors() const noexcept
+{
+   return lu_;
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
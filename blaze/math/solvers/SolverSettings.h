@@ -0,0 +1,105 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/solvers/SolverSettings.h
+//  \brief Header file for the settings and results of the iterative solvers
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SOLVERS_SOLVERSETTINGS_H_
+#define _BLAZE_MATH_SOLVERS_SOLVERSETTINGS_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Settings of the iterative solvers.
+// \ingroup solvers
+//
+// The SolverSettings class bundles the parameters that control the iteration of the iterative
+// solvers cg(), bicgstab(), and gmres():
+
+   \code
+   blaze::SolverSettings settings;
+   settings.maxIterations = 500UL;  // Stop after at most 500 iterations
+   settings.tolerance     = 1E-10;  // Stop in case ||b-Ax|| <= 1E-10 * ||b||
+   settings.restart       = 50UL;   // Restart GMRES after 50 iterations
+   \endcode
+*/
+struct SolverSettings
+{
+   size_t maxIterations = 1000UL;  //!< The maximum number of iterations.
+   double tolerance     = 1E-8;    //!< The tolerance for the relative residual norm.
+   size_t restart       = 30UL;    //!< The number of iterations before GMRES is restarted.
+};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Result of an iterative solver.
+// \ingroup solvers
+//
+// The SolverResult class represents the outcome of a call to one of the iterative solvers
+// cg(), bicgstab(), and gmres(). Note that an iterative solver does not throw an exception in
+// case it does not converge within the given number of iterations. Instead, the \a converged
+// flag of the result is set to \a false:
+
+   \code
+   const blaze::SolverResult result( blaze::cg( A, x, b ) );
+
+   if( !result.converged ) {
+      std::cerr << "No convergence after " << result.iterations << " iterations "
+                << "(relative residual " << result.residual << ")\n";
+   }
+   \endcode
+*/
+struct SolverResult
+{
+   size_t iterations = 0UL;    //!< The number of performed iterations.
+   double residual   = 0.0;    //!< The final relative residual norm \f$ |\vec{b}-A\vec{x}|/|\vec{b}| \f$.
+   bool   converged  = false;  //!< \a true in case the tolerance has been reached, \a false if not.
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
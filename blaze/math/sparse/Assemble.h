@@ -0,0 +1,473 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/Assemble.h
+//  \brief Header file for the assembly of compressed matrices from coordinate triplets
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_ASSEMBLE_H_
+#define _BLAZE_MATH_SPARSE_ASSEMBLE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/Exception.h>
+#include <blaze/math/functors/Add.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Coordinate triplet of the compressed matrix assembly.
+// \ingroup sparse_matrix
+//
+// This auxiliary class template represents a single (row,column,value) triplet in the storage
+// order of the assembled matrix, i.e. the major index is the row index in case of a row-major
+// matrix and the column index in case of a column-major matrix.
+*/
+template< typename Type >  // Data type of the matrix
+struct AssemblyTriplet
+{
+   size_t major;  //!< The row (row-major) or column (column-major) index of the triplet.
+   size_t minor;  //!< The column (row-major) or row (column-major) index of the triplet.
+   Type   value;  //!< The value of the triplet.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the number of threads for the assembly of the given number of triplets.
+// \ingroup sparse_matrix
+//
+// \param nonzeros The total number of triplets.
+// \return The number of threads to be used.
+*/
+inline size_t assemblyThreads( size_t nonzeros )
+{
+   if( nonzeros < SMP_SMATASSEMBLY_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() )
+      return 1UL;
+   else
+      return getNumThreads();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the bucket size of the compressed matrix assembly.
+// \ingroup sparse_matrix
+//
+// \param m The number of rows/columns of the assembled matrix.
+// \param threads The number of threads.
+// \return The number of bits a row/column index is shifted to determine its bucket.
+//
+// The rows/columns are grouped into contiguous buckets of \f$ 2^{shift} \f$ rows/columns. The
+// shift is chosen such that there are at most 256 buckets per thread, which keeps the per-thread
+// bucket histograms small and still provides enough buckets to balance the load.
+*/
+inline size_t assemblyShift( size_t m, size_t threads ) noexcept
+{
+   const size_t buckets( 256UL * threads );
+
+   size_t shift( 0UL );
+
+   while( ( m >> shift ) > buckets ) {
+      ++shift;
+   }
+
+   return shift;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Assembly of a compressed matrix from unsorted coordinate triplets.
+// \ingroup sparse_matrix
+//
+// \param A The target matrix.
+// \param m The number of rows of the assembled matrix.
+// \param n The number of columns of the assembled matrix.
+// \param rows Iterator to the first row index.
+// \param columns Iterator to the first column index.
+// \param values Iterator to the first value.
+// \param nonzeros The total number of triplets.
+// \param op The operation for the combination of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function sorts the triplets by a parallel, stable bucket sort: after counting the
+// triplets per bucket of rows/columns and thread, every thread scatters its share of triplets
+// into the buckets. Afterwards each bucket is sorted by row/column via counting sort and each
+// row/column is sorted by column/row via stable sort, which allows to combine duplicates in
+// the order of their appearance in the input. Finally the storage of the target matrix is laid
+// out via a single call to CompressedMatrix::restructure() and filled in parallel.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename IT1   // Type of the row index iterator
+        , typename IT2   // Type of the column index iterator
+        , typename IT3   // Type of the value iterator
+        , typename OP >  // Type of the combine operation
+void assembleKernel( CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+                     IT1 rows, IT2 columns, IT3 values, size_t nonzeros, OP op )
+{
+   const size_t M( SO ? n : m );
+
+   const size_t threads( assemblyThreads( nonzeros ) );
+   const size_t shift  ( assemblyShift( M, threads ) );
+   const size_t buckets( M != 0UL ? ( ( M - 1UL ) >> shift ) + 1UL : 0UL );
+
+   const auto first = [nonzeros,threads]( size_t t ) {
+      return ( t * nonzeros ) / threads;
+   };
+
+   // Counting the triplets per bucket and thread
+   std::unique_ptr<size_t[]> counts( new size_t[threads*buckets] );
+   std::unique_ptr<bool[]> valid( new bool[threads] );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      size_t* const count( counts.get() + t*buckets );
+      std::fill( count, count+buckets, 0UL );
+
+      valid[t] = true;
+
+      for( size_t k=first(t); k<first(t+1UL); ++k )
+      {
+         const size_t i( rows[k] );
+         const size_t j( columns[k] );
+
+         if( i >= m || j >= n ) {
+            valid[t] = false;
+            break;
+         }
+
+         ++count[ ( SO ? j : i ) >> shift ];
+      }
+   } );
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      if( !valid[t] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Invalid triplet index" );
+      }
+   }
+
+   // Computing the scatter positions of all threads (in bucket-major order)
+   std::unique_ptr<size_t[]> offsets( new size_t[buckets+1UL] );
+
+   size_t total( 0UL );
+
+   for( size_t b=0UL; b<buckets; ++b )
+   {
+      offsets[b] = total;
+
+      for( size_t t=0UL; t<threads; ++t ) {
+         const size_t count( counts[t*buckets+b] );
+         counts[t*buckets+b] = total;
+         total += count;
+      }
+   }
+
+   offsets[buckets] = total;
+
+   BLAZE_INTERNAL_ASSERT( total == nonzeros, "Invalid number of triplets detected" );
+
+   // Scattering the triplets into the buckets
+   std::unique_ptr< AssemblyTriplet<Type>[] > triplets( new AssemblyTriplet<Type>[nonzeros] );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      size_t* const pos( counts.get() + t*buckets );
+
+      for( size_t k=first(t); k<first(t+1UL); ++k )
+      {
+         const size_t i( rows[k] );
+         const size_t j( columns[k] );
+
+         AssemblyTriplet<Type>& triplet( triplets[ pos[ ( SO ? j : i ) >> shift ]++ ] );
+         triplet.major = ( SO ? j : i );
+         triplet.minor = ( SO ? i : j );
+         triplet.value = values[k];
+      }
+   } );
+
+   counts.reset();
+
+   // Sorting the buckets and combining duplicates
+   std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+   partitionWork( offsets.get(), buckets, threads, bounds.get() );
+
+   std::unique_ptr< std::pair<size_t,Type>[] > elements( new std::pair<size_t,Type>[nonzeros] );
+   std::unique_ptr<size_t[]> begins( new size_t[M] );
+   std::unique_ptr<size_t[]> sizes ( new size_t[M] );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      std::vector<size_t> pos( std::min( M, size_t(1) << shift ) );
+
+      for( size_t b=bounds[t]; b<bounds[t+1UL]; ++b )
+      {
+         const size_t ibegin( b << shift );
+         const size_t iend  ( std::min( M, ( b+1UL ) << shift ) );
+
+         std::fill( pos.begin(), pos.begin()+( iend-ibegin ), 0UL );
+
+         for( size_t k=offsets[b]; k<offsets[b+1UL]; ++k ) {
+            ++pos[triplets[k].major-ibegin];
+         }
+
+         size_t index( offsets[b] );
+
+         for( size_t i=ibegin; i<iend; ++i ) {
+            begins[i] = index;
+            index += pos[i-ibegin];
+            pos[i-ibegin] = begins[i];
+         }
+
+         for( size_t k=offsets[b]; k<offsets[b+1UL]; ++k ) {
+            AssemblyTriplet<Type>& triplet( triplets[k] );
+            std::pair<size_t,Type>& element( elements[ pos[triplet.major-ibegin]++ ] );
+            element.first  = triplet.minor;
+            element.second = std::move( triplet.value );
+         }
+
+         for( size_t i=ibegin; i<iend; ++i )
+         {
+            std::pair<size_t,Type>* const ebegin( elements.get() + begins[i] );
+            std::pair<size_t,Type>* const eend  ( elements.get() + pos[i-ibegin] );
+
+            if( ebegin == eend ) {
+               sizes[i] = 0UL;
+               continue;
+            }
+
+            std::stable_sort( ebegin, eend,
+               []( const std::pair<size_t,Type>& lhs, const std::pair<size_t,Type>& rhs ) {
+                  return lhs.first < rhs.first;
+               } );
+
+            std::pair<size_t,Type>* last( ebegin );
+
+            for( std::pair<size_t,Type>* element=ebegin+1UL; element!=eend; ++element ) {
+               if( element->first == last->first )
+                  last->second = op( last->second, element->second );
+               else
+                  *(++last) = std::move( *element );
+            }
+
+            sizes[i] = last - ebegin + 1UL;
+         }
+      }
+   } );
+
+   triplets.reset();
+
+   // Filling the target matrix in a single allocation
+   A.resize( m, n, false );
+   A.restructure( sizes.get() );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      const size_t ibegin( std::min( M, bounds[t] << shift ) );
+      const size_t iend  ( std::min( M, bounds[t+1UL] << shift ) );
+
+      for( size_t i=ibegin; i<iend; ++i ) {
+         for( size_t k=begins[i]; k<begins[i]+sizes[i]; ++k ) {
+            if( SO ) A.append( elements[k].first, i, elements[k].second );
+            else     A.append( i, elements[k].first, elements[k].second );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Compressed matrix assembly functions */
+//@{
+template< typename Type, bool SO, typename IT1, typename IT2, typename IT3, typename OP >
+void assemble( CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+               IT1 rows, IT2 columns, IT3 values, size_t nonzeros, OP op );
+
+template< typename Type, bool SO, typename IT1, typename IT2, typename IT3 >
+void assemble( CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+               IT1 rows, IT2 columns, IT3 values, size_t nonzeros );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of a compressed matrix from unsorted (row,column,value) triplets.
+// \ingroup sparse_matrix
+//
+// \param A The target matrix.
+// \param m The number of rows of the assembled matrix.
+// \param n The number of columns of the assembled matrix.
+// \param rows Random access iterator to the first row index.
+// \param columns Random access iterator to the first column index.
+// \param values Random access iterator to the first value.
+// \param nonzeros The total number of triplets.
+// \param op The operation for the combination of duplicate triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function resizes the given compressed matrix to \f$ m \times n \f$ and replaces its
+// content by the given coordinate (COO) triplets, i.e. the \a k-th triplet sets the element
+// at position (\a rows[k],\a columns[k]) to \a values[k]. In contrast to the element-wise setup
+// via the function call operator or the insert() function, the triplets don't have to be sorted
+// in any way: they are sorted by means of a bucket sort, which is executed in parallel for large
+// numbers of triplets, and the matrix is filled via a single allocation. Duplicate triplets are
+// combined via the given binary operation in the order of their appearance in the input:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   std::vector<size_t> rows, columns;
+   std::vector<double> values;
+   // ... Initialization of the triplets
+
+   CompressedMatrix<double> A;
+   assemble( A, 1000UL, 1000UL, rows.begin(), columns.begin(), values.begin(), values.size(),
+             []( double a, double b ){ return std::max( a, b ); } );
+   \endcode
+
+// Note that all triplets are stored explicitly, i.e. the matrix may contain elements with a
+// default value in case the given values or their combination are zero. In case any triplet
+// refers to a position outside the \f$ m \times n \f$ matrix, a \a std::invalid_argument
+// exception is thrown and the matrix is left unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename IT1   // Type of the row index iterator
+        , typename IT2   // Type of the column index iterator
+        , typename IT3   // Type of the value iterator
+        , typename OP >  // Type of the combine operation
+void assemble( CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+               IT1 rows, IT2 columns, IT3 values, size_t nonzeros, OP op )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   assembleKernel( A, m, n, rows, columns, values, nonzeros, op );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assembly of a compressed matrix from unsorted (row,column,value) triplets.
+// \ingroup sparse_matrix
+//
+// \param A The target matrix.
+// \param m The number of rows of the assembled matrix.
+// \param n The number of columns of the assembled matrix.
+// \param rows Random access iterator to the first row index.
+// \param columns Random access iterator to the first column index.
+// \param values Random access iterator to the first value.
+// \param nonzeros The total number of triplets.
+// \return void
+// \exception std::invalid_argument Invalid triplet index.
+//
+// This function assembles the given compressed matrix from the given coordinate triplets and
+// sums up the values of duplicate triplets, which corresponds to the typical assembly of finite
+// element matrices:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   std::vector<size_t> rows, columns;
+   std::vector<double> values;
+   // ... Initialization of the triplets
+
+   CompressedMatrix<double> A;
+   assemble( A, 1000UL, 1000UL, rows.begin(), columns.begin(), values.begin(), values.size() );
+   \endcode
+
+// For a detailed description see the assemble() function with explicit combine operation.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order of the matrix
+        , typename IT1   // Type of the row index iterator
+        , typename IT2   // Type of the column index iterator
+        , typename IT3 > // Type of the value iterator
+inline void assemble( CompressedMatrix<Type,SO>& A, size_t m, size_t n,
+                      IT1 rows, IT2 columns, IT3 values, size_t nonzeros )
+{
+   assemble( A, m, n, rows, columns, values, nonzeros, Add() );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,1768 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/BlockCompressedMatrix.h
+//  \brief Implementation of a sparse MxN matrix in block compressed row (BSR) format
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_BLOCKCOMPRESSEDMATRIX_H_
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/dense/StaticMatrix.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsBlockCompressed.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup block_compressed_matrix BlockCompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix in block compressed format.
+// \ingroup block_compressed_matrix
+//
+// The BlockCompressedMatrix class template is the representation of an arbitrary sized, row-major
+// sparse matrix in the block compressed row format (also known as BSR). The non-zero elements of
+// the matrix are stored in dense blocks of \a R rows and \a C columns. The type of the elements,
+// the size of the blocks, and the type of the stored block indices can be specified via the four
+// template parameters:
+
+   \code
+   template< typename Type, size_t R, size_t C, typename IT >
+   class BlockCompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. BlockCompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - R   : specifies the number of rows of a single block (at least 1).
+//  - C   : specifies the number of columns of a single block (at least 1).
+//  - IT  : specifies the type of the stored block column indices. IT must be an unsigned integral
+//          type. The default value is \c uint32_t.
+//
+// The matrix is partitioned into block rows of \a R consecutive rows and block columns of \a C
+// consecutive columns. For each block row, all blocks that contain at least one non-zero element
+// are stored as StaticMatrix instances of size \f$ R \times C \f$, in ascending order of their
+// block column index. Only a single index is stored per block instead of a single index per
+// element. Matrices resulting from finite element or multibody discretizations, whose non-zero
+// elements come in dense \f$ 3 \times 3 \f$ or \f$ 6 \times 6 \f$ blocks, thus require considerably
+// less memory for their indices and can be multiplied block by block by means of fixed-size,
+// fully unrolled kernels. Note that the number of rows of the matrix has to be a multiple of \a R
+// and the number of columns has to be a multiple of \a C.
+//
+// BlockCompressedMatrix is a read-only format that is created from an arbitrary matrix. Since
+// the layout depends on the positions of all non-zero elements, it is not possible to insert
+// individual elements. Instead, the entire matrix has to be reassigned:
+
+   \code
+   using blaze::BlockCompressedMatrix;
+   using blaze::CompressedMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 3000UL, 3000UL );
+   // ... Initialization of the compressed matrix
+
+   BlockCompressedMatrix<double,3UL,3UL> B( A );  // Conversion into 3x3 blocks
+
+   DynamicVector<double> x( 3000UL, 1.0 ), y;
+   y = B * x;  // Block-wise sparse matrix/dense vector multiplication
+
+   // Traversing the elements of the 2nd row
+   for( auto it=B.begin(1); it!=B.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the element
+      ... = it->index();  // Access to the index of the element
+   }
+
+   // Traversing the blocks of the 2nd block row
+   for( size_t k=B.rowPointers()[1]; k<B.rowPointers()[2]; ++k ) {
+      ... = B.blocks()[k];         // Access to the 3x3 block
+      ... = B.columnIndices()[k];  // Access to the block column index of the block
+   }
+
+   CompressedMatrix<double> C( B );  // Conversion back into a compressed matrix
+
+   B = 2.0 * A;  // Reassignment of the entire matrix
+   \endcode
+
+// The iterators of a BlockCompressedMatrix traverse all elements of the stored blocks, including
+// zero elements within a block. Therefore the number of non-zero elements of the matrix always
+// corresponds to the number of stored blocks times \f$ R \cdot C \f$. BlockCompressedMatrix can
+// be used as operand in all operations that are supported for sparse matrices, in arbitrary
+// combinations with dense and sparse vectors and matrices. The results of these operations are
+// stored in a CompressedMatrix.
+*/
+template< typename Type               // Data type of the matrix
+        , size_t R                    // Number of rows per block
+        , size_t C                    // Number of columns per block
+        , typename IT = uint32_t >    // Type of the indices
+class BlockCompressedMatrix
+   : public SparseMatrix< BlockCompressedMatrix<Type,R,C,IT>, rowMajor >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows per block.
+   static constexpr size_t blockHeight = R;
+
+   //! The number of columns per block.
+   static constexpr size_t blockWidth = C;
+
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using BlockType = StaticMatrix<Type,R,C,rowMajor>;  //!< Type of the dense blocks.
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the elements of a single row of the block compressed matrix.
+   //
+   // The iterator traverses the row of all stored blocks of a block row. Within each block it
+   // visits all \a C elements of the row, including zero elements. Similar to the iterators of
+   // the SoACompressedMatrix class template, the value and index of the current element are
+   // accessed via the arrow operator.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using Element = ValueIndexPair<Type>;  //!< Element type of the iterator.
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the underlying elements.
+      using PointerType      = const ConstIterator*;             //!< Pointer return type.
+      using ReferenceType    = const Element;                    //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : block_ ( nullptr )  // Pointer to the current block
+         , index_ ( nullptr )  // Pointer to the block column index of the current block
+         , row_   ( 0UL )      // The row of the iterator within the blocks
+         , column_( 0UL )      // The column of the current element within the current block
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param block Pointer to the initial block.
+      // \param index Pointer to the block column index of the initial block.
+      // \param row The row of the iterator within the blocks.
+      // \param column The column of the initial element within the initial block.
+      */
+      inline ConstIterator( const BlockType* block, const IT* index, size_t row, size_t column ) noexcept
+         : block_ ( block  )  // Pointer to the current block
+         , index_ ( index  )  // Pointer to the block column index of the current block
+         , row_   ( row    )  // The row of the iterator within the blocks
+         , column_( column )  // The column of the current element within the current block
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         if( ++column_ == C ) {
+            column_ = 0UL;
+            ++block_;
+            ++index_;
+         }
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         if( column_ == 0UL ) {
+            column_ = C;
+            --block_;
+            --index_;
+         }
+         --column_;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( ptrdiff_t inc ) noexcept {
+         advance( inc );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( ptrdiff_t dec ) noexcept {
+         advance( -dec );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The current value-index-pair.
+      */
+      inline ReferenceType operator*() const {
+         return Element( value(), index() );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the iterator, which provides access to the current value and index.
+      */
+      inline PointerType operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return Reference to the current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return (*block_)( row_, column_ );
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return size_t( *index_ ) * C + column_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_ && column_ == rhs.column_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return !( *this == rhs );
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const noexcept {
+         return ( *this - rhs ) < 0;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const noexcept {
+         return ( *this - rhs ) > 0;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const noexcept {
+         return ( *this - rhs ) <= 0;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const noexcept {
+         return ( *this - rhs ) >= 0;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( index_ - rhs.index_ ) * ptrdiff_t( C ) + ptrdiff_t( column_ ) - ptrdiff_t( rhs.column_ );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, ptrdiff_t inc ) noexcept {
+         ConstIterator tmp( it );
+         tmp.advance( inc );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( ptrdiff_t inc, const ConstIterator& it ) noexcept {
+         ConstIterator tmp( it );
+         tmp.advance( inc );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, ptrdiff_t dec ) noexcept {
+         ConstIterator tmp( it );
+         tmp.advance( -dec );
+         return tmp;
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Advance function*************************************************************************
+      /*!\brief Moves the iterator by the given number of elements.
+      //
+      // \param inc The number of elements the iterator is moved (might be negative).
+      // \return void
+      */
+      inline void advance( ptrdiff_t inc ) noexcept {
+         const ptrdiff_t pos( ptrdiff_t( column_ ) + inc );
+         ptrdiff_t blocks( pos / ptrdiff_t( C ) );
+         ptrdiff_t column( pos % ptrdiff_t( C ) );
+         if( column < 0 ) {
+            column += ptrdiff_t( C );
+            --blocks;
+         }
+         block_  += blocks;
+         index_  += blocks;
+         column_  = size_t( column );
+      }
+      //*******************************************************************************************
+
+      //**Member variables*************************************************************************
+      const BlockType* block_;   //!< Pointer to the current block.
+      const IT*        index_;   //!< Pointer to the block column index of the current block.
+      size_t           row_;     //!< The row of the iterator within the blocks.
+      size_t           column_;  //!< The column of the current element within the current block.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using This           = BlockCompressedMatrix<Type,R,C,IT>;    //!< Type of this BlockCompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,rowMajor>;           //!< Base type of this BlockCompressedMatrix instance.
+   using ResultType     = CompressedMatrix<Type,rowMajor>;       //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,columnMajor>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,columnMajor>;    //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                  //!< Type of the sparse matrix elements.
+   using IndexType      = IT;                                    //!< Type of the stored block column indices.
+   using ReturnType     = const Type&;                           //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                           //!< Data type for composite expression templates.
+   using Reference      = const Type&;                           //!< Reference to a sparse matrix value.
+   using ConstReference = const Type&;                           //!< Reference to a constant sparse matrix value.
+   using Iterator       = ConstIterator;                         //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a BlockCompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = BlockCompressedMatrix<NewType,R,C,IT>;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a BlockCompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = BlockCompressedMatrix<Type,R,C,IT>;  //!< The type of the other BlockCompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline BlockCompressedMatrix();
+   explicit inline BlockCompressedMatrix( size_t m, size_t n );
+
+   inline BlockCompressedMatrix( const BlockCompressedMatrix& sm );
+   inline BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO >
+   inline BlockCompressedMatrix( const Matrix<MT,SO>& m );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~BlockCompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference   operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference   at( size_t i, size_t j ) const;
+   inline ConstIterator    begin ( size_t i ) const noexcept;
+   inline ConstIterator    cbegin( size_t i ) const noexcept;
+   inline ConstIterator    end   ( size_t i ) const noexcept;
+   inline ConstIterator    cend  ( size_t i ) const noexcept;
+   inline const BlockType* blocks() const noexcept;
+   inline const IT*        columnIndices() const noexcept;
+   inline const size_t*    rowPointers() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline BlockCompressedMatrix& operator=( const BlockCompressedMatrix& rhs );
+   inline BlockCompressedMatrix& operator=( BlockCompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO > inline BlockCompressedMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t blockRows() const noexcept;
+   inline size_t blockColumns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline size_t nonZeroBlocks() const noexcept;
+   inline size_t nonZeroBlocks( size_t bi ) const noexcept;
+   inline void   clear();
+   inline void   swap( BlockCompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void checkDimensions( size_t m, size_t n );
+
+   inline size_t findBlock( size_t bi, size_t bj ) const noexcept;
+
+   template< typename MT > void construct( const SparseMatrix<MT,rowMajor>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t     m_;        //!< The current number of rows of the sparse matrix.
+   size_t     n_;        //!< The current number of columns of the sparse matrix.
+   size_t*    rowptr_;   //!< Offsets of the first block of each block row (\a m_/R+1 elements).
+   IT*        colidx_;   //!< The block column indices of all stored blocks.
+   BlockType* blocks_;   //!< The stored dense blocks.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   BLAZE_STATIC_ASSERT( R > 0UL && C > 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, size_t R, size_t C, typename IT >
+const Type BlockCompressedMatrix<Type,R,C,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix()
+   : m_     ( 0UL )      // The current number of rows of the sparse matrix
+   , n_     ( 0UL )      // The current number of columns of the sparse matrix
+   , rowptr_( nullptr )  // Offsets of the first block of each block row
+   , colidx_( nullptr )  // The block column indices of all stored blocks
+   , blocks_( nullptr )  // The stored dense blocks
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a block compressed matrix of size \f$ m \times n \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix dimensions are not multiples of the block size.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is initialized as empty \f$ m \times n \f$ matrix without any stored blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( size_t m, size_t n )
+   : BlockCompressedMatrix()
+{
+   checkDimensions( m, n );
+
+   rowptr_ = new size_t[m/R+1UL];
+   std::fill( rowptr_, rowptr_+m/R+1UL, size_t(0) );
+
+   m_ = m;
+   n_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for BlockCompressedMatrix.
+//
+// \param sm Block compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( const BlockCompressedMatrix& sm )
+   : BlockCompressedMatrix()
+{
+   if( sm.rowptr_ == nullptr ) {
+      m_ = sm.m_;
+      n_ = sm.n_;
+      return;
+   }
+
+   const size_t mb( sm.m_ / R );
+   const size_t nonzeros( sm.rowptr_[mb] );
+
+   rowptr_ = new size_t[mb+1UL];
+   colidx_ = allocate<IT>( nonzeros );
+   blocks_ = allocate<BlockType>( nonzeros );
+
+   std::copy( sm.rowptr_, sm.rowptr_+mb+1UL, rowptr_ );
+   std::copy( sm.colidx_, sm.colidx_+nonzeros, colidx_ );
+   std::copy( sm.blocks_, sm.blocks_+nonzeros, blocks_ );
+
+   m_ = sm.m_;
+   n_ = sm.n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for BlockCompressedMatrix.
+//
+// \param sm The block compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( BlockCompressedMatrix&& sm ) noexcept
+   : BlockCompressedMatrix()
+{
+   swap( sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from arbitrary matrices.
+//
+// \param m The matrix to be converted.
+// \exception std::invalid_argument Matrix dimensions are not multiples of the block size.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This constructor converts the given dense or sparse matrix into the block compressed format.
+// Each \f$ R \times C \f$ block of the given matrix that contains at least one non-zero element
+// is stored as dense block. In case the number of rows of the given matrix is not a multiple of
+// \a R or the number of columns is not a multiple of \a C, a \a std::invalid_argument exception
+// is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline BlockCompressedMatrix<Type,R,C,IT>::BlockCompressedMatrix( const Matrix<MT,SO>& m )
+   : BlockCompressedMatrix()
+{
+   using TmpType = If_t< IsSparseMatrix_v<MT> && IsRowMajorMatrix_v<MT> && !IsComputation_v<MT>
+                       , const MT&
+                       , const CompressedMatrix<Type,rowMajor> >;
+
+   checkDimensions( (~m).rows(), (~m).columns() );
+
+   TmpType tmp( ~m );
+   construct( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for BlockCompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>::~BlockCompressedMatrix()
+{
+   delete[] rowptr_;
+   deallocate( colidx_ );
+   deallocate( blocks_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstReference
+   BlockCompressedMatrix<Type,R,C,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t bi( i / R );
+   const size_t bj( j / C );
+   const size_t k ( findBlock( bi, bj ) );
+
+   if( k == rowptr_[bi+1UL] || colidx_[k] != bj )
+      return zero_;
+   else
+      return blocks_[k]( i%R, j%C );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstReference
+   BlockCompressedMatrix<Type,R,C,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( rowptr_[i/R] );
+   return ConstIterator( blocks_+k, colidx_+k, i%R, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t k( rowptr_[i/R+1UL] );
+   return ConstIterator( blocks_+k, colidx_+k, i%R, 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the stored blocks.
+//
+// \return Pointer to the array of blocks.
+//
+// This function returns a pointer to the dense blocks of all block rows. The blocks of block
+// row \a bi are stored at the positions \f$ [rowPointers()[bi]..rowPointers()[bi+1]) \f$ in
+// ascending order of their block column index.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline const typename BlockCompressedMatrix<Type,R,C,IT>::BlockType*
+   BlockCompressedMatrix<Type,R,C,IT>::blocks() const noexcept
+{
+   return blocks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the block column indices of the stored blocks.
+//
+// \return Pointer to the array of block column indices.
+//
+// This function returns a pointer to the block column indices of all stored blocks. The block
+// stored at position \a k covers the columns \f$ [j*C..j*C+C) \f$ with \a j being the block
+// column index \a columnIndices()[k].
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline const IT* BlockCompressedMatrix<Type,R,C,IT>::columnIndices() const noexcept
+{
+   return colidx_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the offsets of the block rows.
+//
+// \return Pointer to the array of block row offsets.
+//
+// This function returns a pointer to an array of \f$ blockRows()+1 \f$ elements, which contains
+// the position of the first block of each block row. The last element corresponds to the total
+// number of stored blocks. In case the matrix is in default state, a \a nullptr is returned.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline const size_t* BlockCompressedMatrix<Type,R,C,IT>::rowPointers() const noexcept
+{
+   return rowptr_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for BlockCompressedMatrix.
+//
+// \param rhs Block compressed matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>&
+   BlockCompressedMatrix<Type,R,C,IT>::operator=( const BlockCompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   BlockCompressedMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for BlockCompressedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline BlockCompressedMatrix<Type,R,C,IT>&
+   BlockCompressedMatrix<Type,R,C,IT>::operator=( BlockCompressedMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for arbitrary matrices.
+//
+// \param rhs The matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix dimensions are not multiples of the block size.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The given matrix is converted into the block compressed format. The matrix may alias with
+// this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline BlockCompressedMatrix<Type,R,C,IT>&
+   BlockCompressedMatrix<Type,R,C,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   BlockCompressedMatrix tmp( ~rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block rows of the sparse matrix.
+//
+// \return The number of block rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockRows() const noexcept
+{
+   return m_ / R;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of block columns of the sparse matrix.
+//
+// \return The number of block columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::blockColumns() const noexcept
+{
+   return n_ / C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements of the sparse matrix.
+//
+// \return The capacity of the sparse matrix.
+//
+// The capacity corresponds to the number of stored blocks times \f$ R \cdot C \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::capacity() const noexcept
+{
+   return nonZeros();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The number of elements stored for the row.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::capacity( size_t i ) const noexcept
+{
+   return nonZeros( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+//
+// Since all elements of the stored blocks are considered to be non-zero elements, the number
+// of non-zero elements corresponds to the number of stored blocks times \f$ R \cdot C \f$.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeros() const noexcept
+{
+   return nonZeroBlocks() * R * C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return nonZeroBlocks( i/R ) * C;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored blocks of the sparse matrix.
+//
+// \return The number of stored blocks.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeroBlocks() const noexcept
+{
+   return ( rowptr_ != nullptr ? rowptr_[m_/R] : 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of stored blocks of the specified block row.
+//
+// \param bi The index of the block row.
+// \return The number of stored blocks of block row \a bi.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::nonZeroBlocks( size_t bi ) const noexcept
+{
+   BLAZE_USER_ASSERT( bi < blockRows(), "Invalid block row access index" );
+   return rowptr_[bi+1UL] - rowptr_[bi];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline void BlockCompressedMatrix<Type,R,C,IT>::clear()
+{
+   BlockCompressedMatrix tmp;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline void BlockCompressedMatrix<Type,R,C,IT>::swap( BlockCompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( rowptr_, sm.rowptr_ );
+   std::swap( colidx_, sm.colidx_ );
+   std::swap( blocks_, sm.blocks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the dimensions of a block compressed matrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix dimensions are not multiples of the block size.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This function checks whether the given dimensions are multiples of the block size and whether
+// all block column indices can be represented by the index type. In case either condition is
+// violated, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline void BlockCompressedMatrix<Type,R,C,IT>::checkDimensions( size_t m, size_t n )
+{
+   constexpr size_t maxSize( std::numeric_limits<IT>::max() );
+
+   if( m % R != 0UL || n % C != 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix dimensions are not multiples of the block size" );
+   }
+
+   if( n / C > maxSize ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix dimensions exceed the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the position of the first block not left of the given block column.
+//
+// \param bi The index of the block row.
+// \param bj The index of the block column.
+// \return The position of the first block of block row \a bi not left of block column \a bj.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline size_t BlockCompressedMatrix<Type,R,C,IT>::findBlock( size_t bi, size_t bj ) const noexcept
+{
+   const IT* const first( colidx_ + rowptr_[bi] );
+   const IT* const last ( colidx_ + rowptr_[bi+1UL] );
+
+   return std::lower_bound( first, last, bj ) - colidx_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the block compressed format for the given row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function determines the non-zero blocks of each block row of the given sparse matrix
+// in a first pass and copies the non-zero elements into the dense blocks in a second pass.
+// The function expects the matrix to be in default state and the dimensions of the given
+// matrix to be multiples of the block size.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+template< typename MT >  // Type of the sparse matrix
+void BlockCompressedMatrix<Type,R,C,IT>::construct( const SparseMatrix<MT,rowMajor>& sm )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == 0UL && rowptr_ == nullptr, "Invalid matrix state detected" );
+
+   const size_t m ( (~sm).rows() );
+   const size_t n ( (~sm).columns() );
+   const size_t mb( m / R );
+   const size_t nb( n / C );
+
+   BLAZE_INTERNAL_ASSERT( m % R == 0UL && n % C == 0UL, "Invalid matrix dimensions detected" );
+
+   std::vector<size_t> marker  ( nb, mb );
+   std::vector<size_t> position( nb );
+
+   rowptr_ = new size_t[mb+1UL];
+   rowptr_[0UL] = 0UL;
+
+   for( size_t bi=0UL; bi<mb; ++bi )
+   {
+      size_t count( 0UL );
+
+      for( size_t i=bi*R; i<(bi+1UL)*R; ++i ) {
+         for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+            const size_t bj( element->index() / C );
+            if( marker[bj] != bi ) {
+               marker[bj] = bi;
+               ++count;
+            }
+         }
+      }
+
+      rowptr_[bi+1UL] = rowptr_[bi] + count;
+   }
+
+   m_ = m;
+   n_ = n;
+
+   const size_t nonzeros( rowptr_[mb] );
+
+   colidx_ = allocate<IT>( nonzeros );
+   blocks_ = allocate<BlockType>( nonzeros );
+
+   std::fill( marker.begin(), marker.end(), mb );
+
+   for( size_t bi=0UL; bi<mb; ++bi )
+   {
+      size_t k( rowptr_[bi] );
+
+      for( size_t i=bi*R; i<(bi+1UL)*R; ++i ) {
+         for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+            const size_t bj( element->index() / C );
+            if( marker[bj] != bi ) {
+               marker[bj] = bi;
+               colidx_[k++] = bj;
+            }
+         }
+      }
+
+      BLAZE_INTERNAL_ASSERT( k == rowptr_[bi+1UL], "Invalid number of non-zero blocks" );
+
+      std::sort( colidx_+rowptr_[bi], colidx_+k );
+
+      for( k=rowptr_[bi]; k<rowptr_[bi+1UL]; ++k ) {
+         position[colidx_[k]] = k;
+      }
+
+      for( size_t i=bi*R; i<(bi+1UL)*R; ++i ) {
+         for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+            const size_t j( element->index() );
+            blocks_[position[j/C]]( i-bi*R, j%C ) = element->value();
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// The search is performed by means of a binary search over the block column indices of the
+// block row containing row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t bi( i / R );
+   const size_t bj( j / C );
+   const size_t k ( findBlock( bi, bj ) );
+
+   const size_t column( ( k != rowptr_[bi+1UL] && colidx_[k] == bj ) ? j%C : 0UL );
+
+   return ConstIterator( blocks_+k, colidx_+k, i%R, column );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline typename BlockCompressedMatrix<Type,R,C,IT>::ConstIterator
+   BlockCompressedMatrix<Type,R,C,IT>::upperBound( size_t i, size_t j ) const
+{
+   ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      ++pos;
+   return pos;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,R,C,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , size_t R          // Number of rows per block
+        , size_t C          // Number of columns per block
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool BlockCompressedMatrix<Type,R,C,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. Since the matrix
+// cannot be the target of an assignment, this function always returns \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline bool BlockCompressedMatrix<Type,R,C,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BLOCKCOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name BlockCompressedMatrix operators */
+//@{
+template< typename Type, size_t R, size_t C, typename IT >
+inline void clear( BlockCompressedMatrix<Type,R,C,IT>& m );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline bool isIntact( const BlockCompressedMatrix<Type,R,C,IT>& m );
+
+template< typename Type, size_t R, size_t C, typename IT >
+inline void swap( BlockCompressedMatrix<Type,R,C,IT>& a, BlockCompressedMatrix<Type,R,C,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given block compressed matrix.
+// \ingroup block_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline void clear( BlockCompressedMatrix<Type,R,C,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given block compressed matrix are intact.
+// \ingroup block_compressed_matrix
+//
+// \param m The block compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false if not.
+//
+// This function checks whether the invariants of the block compressed matrix are intact, i.e.
+// if its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline bool isIntact( const BlockCompressedMatrix<Type,R,C,IT>& m )
+{
+   if( m.rows() % R != 0UL || m.columns() % C != 0UL )
+      return false;
+
+   if( m.rowPointers() == nullptr )
+      return m.rows() == 0UL;
+
+   if( m.rowPointers()[0UL] != 0UL )
+      return false;
+
+   for( size_t bi=0UL; bi<m.blockRows(); ++bi )
+   {
+      const size_t kbegin( m.rowPointers()[bi] );
+      const size_t kend  ( m.rowPointers()[bi+1UL] );
+
+      if( kend < kbegin || kend - kbegin > m.blockColumns() )
+         return false;
+
+      for( size_t k=kbegin; k<kend; ++k ) {
+         if( m.columnIndices()[k] >= m.blockColumns() ||
+             ( k > kbegin && m.columnIndices()[k] <= m.columnIndices()[k-1UL] ) ||
+             !isIntact( m.blocks()[k] ) )
+            return false;
+      }
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two block compressed matrices.
+// \ingroup block_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , size_t R       // Number of rows per block
+        , size_t C       // Number of columns per block
+        , typename IT >  // Type of the indices
+inline void swap( BlockCompressedMatrix<Type,R,C,IT>& a, BlockCompressedMatrix<Type,R,C,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISBLOCKCOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, size_t R, size_t C, typename IT >
+struct IsBlockCompressed< BlockCompressedMatrix<T,R,C,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -422,6 +422,7 @@ class CompressedMatrix
           void   resize ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t nonzeros );
           void   reserve( size_t i, size_t nonzeros );
+          void   restructure( const size_t* nonzeros );
    inline void   trim   ();
    inline void   trim   ( size_t i );
    inline void   shrinkToFit();
@@ -754,9 +755,7 @@ template< typename MT    // Type of the foreign dense matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const DenseMatrix<MT,SO2>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
-   using blaze::assign;
-
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 //*************************************************************************************************
 
@@ -773,9 +772,7 @@ template< typename MT    // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,SO>::CompressedMatrix( const SparseMatrix<MT,SO2>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 //*************************************************************************************************
 
@@ -1238,15 +1235,13 @@ template< typename MT    // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const DenseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1270,8 +1265,6 @@ template< typename MT    // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator=( const SparseMatrix<MT,SO2>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).rows()     > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -1281,7 +1274,7 @@ inline CompressedMatrix<Type,SO>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1306,13 +1299,11 @@ template< typename MT    // Type of the right-hand side matrix
 inline CompressedMatrix<Type,SO>&
    CompressedMatrix<Type,SO>::operator+=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1334,13 +1325,11 @@ template< typename MT    // Type of the right-hand side matrix
         , bool SO2 >     // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,SO>& CompressedMatrix<Type,SO>::operator-=( const Matrix<MT,SO2>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 //*************************************************************************************************
@@ -1780,6 +1769,48 @@ void CompressedMatrix<Type,SO>::reserve( size_t i, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Resetting the matrix and setting the capacity of all rows/columns.
+//
+// \param nonzeros The new capacities of all rows/columns.
+// \return void
+//
+// This function resets all elements of the matrix and redistributes the internal storage such
+// that row/column \a i provides a capacity of exactly \a nonzeros[i] elements. In case the
+// storage order is set to \a rowMajor, the given array has to contain \f$ M \f$ capacities, in
+// case the storage order is set to \a columnMajor, it has to contain \f$ N \f$ capacities. In
+// case the total capacity exceeds the current capacity of the matrix, a single new memory block
+// is allocated. Since the rows/columns don't share any storage afterwards, the subsequent
+// append() calls for different rows/columns can be performed concurrently. Note that in this
+// case no call to finalize() is required.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO >      // Storage order
+void CompressedMatrix<Type,SO>::restructure( const size_t* nonzeros )
+{
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      total += nonzeros[i];
+   }
+
+   if( total > capacity() ) {
+      Iterator newStorage( allocate<Element>( total ) );
+      deallocate( begin_[0UL] );
+      begin_[0UL] = newStorage;
+      end_[m_] = newStorage + total;
+   }
+
+   for( size_t i=0UL; i<m_; ++i ) {
+      end_  [i    ] = begin_[i];
+      begin_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+
+   BLAZE_INTERNAL_ASSERT( begin_[m_] <= end_[m_], "Invalid pointer calculations" );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Removing all excessive capacity from all rows/columns.
 //
@@ -3185,6 +3216,7 @@ class CompressedMatrix<Type,true>
           void   resize ( size_t m, size_t n, bool preserve=true );
    inline void   reserve( size_t nonzeros );
           void   reserve( size_t j, size_t nonzeros );
+          void   restructure( const size_t* nonzeros );
    inline void   trim   ();
    inline void   trim   ( size_t j );
    inline void   shrinkToFit();
@@ -3529,9 +3561,7 @@ template< typename MT      // Type of the foreign dense matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const DenseMatrix<MT,SO>& dm )
    : CompressedMatrix( (~dm).rows(), (~dm).columns() )
 {
-   using blaze::assign;
-
-   assign( *this, ~dm );
+   smpAssign( *this, ~dm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -3549,9 +3579,7 @@ template< typename MT      // Type of the foreign compressed matrix
 inline CompressedMatrix<Type,true>::CompressedMatrix( const SparseMatrix<MT,SO>& sm )
    : CompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sm );
+   smpAssign( *this, ~sm );
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -4005,15 +4033,13 @@ template< typename MT      // Type of the right-hand side dense matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const DenseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedMatrix tmp( ~rhs );
       swap( tmp );
    }
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4038,8 +4064,6 @@ template< typename MT      // Type of the right-hand side compressed matrix
 inline CompressedMatrix<Type,true>&
    CompressedMatrix<Type,true>::operator=( const SparseMatrix<MT,SO>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ||
        (~rhs).columns()  > capacity_ ||
        (~rhs).nonZeros() > capacity() ) {
@@ -4049,7 +4073,7 @@ inline CompressedMatrix<Type,true>&
    else {
       resize( (~rhs).rows(), (~rhs).columns(), false );
       reset();
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -4074,13 +4098,11 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator+=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -4103,13 +4125,11 @@ template< typename MT      // Type of the right-hand side matrix
         , bool SO >        // Storage order of the right-hand side matrix
 inline CompressedMatrix<Type,true>& CompressedMatrix<Type,true>::operator-=( const Matrix<MT,SO>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
    }
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
    return *this;
 }
 /*! \endcond */
@@ -4549,6 +4569,47 @@ void CompressedMatrix<Type,true>::reserve( size_t j, size_t nonzeros )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Resetting the matrix and setting the capacity of all columns.
+//
+// \param nonzeros The new capacities of all \f$ N \f$ columns.
+// \return void
+//
+// This function resets all elements of the matrix and redistributes the internal storage such
+// that column \a j provides a capacity of exactly \a nonzeros[j] elements. In case the total
+// capacity exceeds the current capacity of the matrix, a single new memory block is allocated.
+// Since the columns don't share any storage afterwards, the subsequent append() calls for
+// different columns can be performed concurrently. Note that in this case no call to finalize()
+// is required.
+*/
+template< typename Type >  // Data type of the matrix
+void CompressedMatrix<Type,true>::restructure( const size_t* nonzeros )
+{
+   size_t total( 0UL );
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      total += nonzeros[j];
+   }
+
+   if( total > capacity() ) {
+      Iterator newStorage( allocate<Element>( total ) );
+      deallocate( begin_[0UL] );
+      begin_[0UL] = newStorage;
+      end_[n_] = newStorage + total;
+   }
+
+   for( size_t j=0UL; j<n_; ++j ) {
+      end_  [j    ] = begin_[j];
+      begin_[j+1UL] = begin_[j] + nonzeros[j];
+   }
+
+   BLAZE_INTERNAL_ASSERT( begin_[n_] <= end_[n_], "Invalid pointer calculations" );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Removing all excessive capacity from all columns.
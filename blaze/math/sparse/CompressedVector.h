@@ -649,9 +649,7 @@ template< typename VT >  // Type of the foreign dense vector
 inline CompressedVector<Type,TF>::CompressedVector( const DenseVector<VT,TF>& dv )
    : CompressedVector( (~dv).size() )
 {
-   using blaze::assign;
-
-   assign( *this, ~dv );
+   smpAssign( *this, ~dv );
 }
 //*************************************************************************************************
 
@@ -667,9 +665,7 @@ template< typename VT >  // Type of the foreign sparse vector
 inline CompressedVector<Type,TF>::CompressedVector( const SparseVector<VT,TF>& sv )
    : CompressedVector( (~sv).size(), (~sv).nonZeros() )
 {
-   using blaze::assign;
-
-   assign( *this, ~sv );
+   smpAssign( *this, ~sv );
 }
 //*************************************************************************************************
 
@@ -1015,8 +1011,6 @@ template< typename VT >  // Type of the right-hand side dense vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const DenseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -1024,7 +1018,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1047,8 +1041,6 @@ template< typename VT >  // Type of the right-hand side sparse vector
 inline CompressedVector<Type,TF>&
    CompressedVector<Type,TF>::operator=( const SparseVector<VT,TF>& rhs )
 {
-   using blaze::assign;
-
    if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
       CompressedVector tmp( ~rhs );
       swap( tmp );
@@ -1056,7 +1048,7 @@ inline CompressedVector<Type,TF>&
    else {
       size_ = (~rhs).size();
       end_  = begin_;
-      assign( *this, ~rhs );
+      smpAssign( *this, ~rhs );
    }
 
    return *this;
@@ -1079,13 +1071,11 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator+=( const Vector<VT,TF>& rhs )
 {
-   using blaze::addAssign;
-
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   addAssign( *this, ~rhs );
+   smpAddAssign( *this, ~rhs );
 
    return *this;
 }
@@ -1107,13 +1097,11 @@ template< typename Type  // Data type of the vector
 template< typename VT >  // Type of the right-hand side vector
 inline CompressedVector<Type,TF>& CompressedVector<Type,TF>::operator-=( const Vector<VT,TF>& rhs )
 {
-   using blaze::subAssign;
-
    if( (~rhs).size() != size_ ) {
       BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
    }
 
-   subAssign( *this, ~rhs );
+   smpSubAssign( *this, ~rhs );
 
    return *this;
 }
@@ -36,6 +36,13 @@
 #define _BLAZE_MATH_SPARSE_FORWARD_H_
 
 
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/Types.h>
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -44,9 +51,14 @@ namespace blaze {
 //
 //=================================================================================================
 
+template< typename, size_t, size_t, typename > class BlockCompressedMatrix;
 template< typename, bool > class CompressedMatrix;
 template< typename, bool > class CompressedVector;
 template< typename, bool > class IdentityMatrix;
+template< typename, bool > class MappedCompressedMatrix;
+template< typename, typename > class SlicedEllpackMatrix;
+template< typename, bool, typename > class SoACompressedMatrix;
+template< typename, bool, typename > class SoACompressedVector;
 
 } // namespace blaze
 
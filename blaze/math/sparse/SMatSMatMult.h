@@ -0,0 +1,937 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SMatSMatMult.h
+//  \brief Header file for the two-phase sparse matrix/sparse matrix multiplication
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SMATSMATMULT_H_
+#define _BLAZE_MATH_SPARSE_SMATSMATMULT_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/math/AccumulatorFlag.h>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Infinity.h>
+#include <blaze/math/shims/Reset.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/ParallelFor.h>
+#include <blaze/math/smp/ParallelSection.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/smp/SparsePartition.h>
+#include <blaze/math/sparse/CompressedMatrix.h>
+#include <blaze/system/Thresholds.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/FunctionTrace.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Thread-local workspace of the row-wise sparse matrix/sparse matrix multiplication.
+// \ingroup sparse_matrix
+//
+// This auxiliary class template bundles the accumulators of the symbolicMult() and numericMult()
+// functions. The storage of each accumulator is allocated when it is used for the first time and
+// is reused for all subsequent rows/columns.
+*/
+template< typename Type >  // Data type of the result matrix
+struct SMatSMatMultWorkspace
+{
+   std::vector<size_t> positions;  //!< Dense accumulator (marker or position per column).
+   std::vector<size_t> keys;       //!< Keys of the hash accumulator.
+   std::vector<size_t> slots;      //!< Positions of the keys of the hash accumulator.
+   std::vector< std::pair<size_t,Type> > products;  //!< Expanded products of the ESC accumulator.
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  AUXILIARY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Selection of the accumulator for a single row/column of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param af The requested accumulator.
+// \param products The number of scalar products of the row/column.
+// \param n The number of columns/rows of the result matrix.
+// \return The accumulator to be used for the row/column.
+//
+// In case the adaptive accumulator is requested, rows/columns with a few dozen scalar products
+// are accumulated via expand-sort-compress, rows/columns whose products cover only a tiny part
+// of the result row/column via hash table, and all remaining rows/columns via dense array.
+*/
+inline AccumulatorFlag selectAccumulator( AccumulatorFlag af, size_t products, size_t n ) noexcept
+{
+   if( af != adaptiveAccumulator )
+      return af;
+   else if( products <= 32UL )
+      return sortAccumulator;
+   else if( products*16UL < n )
+      return hashAccumulator;
+   else
+      return denseAccumulator;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the number of bits of a hash accumulator for the given number of keys.
+// \ingroup sparse_matrix
+//
+// \param keys The maximum number of keys to be stored.
+// \return The number of bits of the hash accumulator.
+//
+// The size of the hash table is the smallest power of two that is at least twice the number of
+// keys, which keeps the load factor of the open addressing table below 0.5.
+*/
+inline size_t hashAccumulatorBits( size_t keys ) noexcept
+{
+   size_t bits( 4UL );
+   while( ( 1UL << bits ) < 2UL*keys ) {
+      ++bits;
+   }
+   return bits;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the initial slot of the given key within a hash accumulator.
+// \ingroup sparse_matrix
+//
+// \param key The key (i.e. the column/row index).
+// \param bits The number of bits of the hash accumulator.
+// \return The initial slot of the key.
+*/
+inline size_t hashAccumulatorSlot( size_t key, size_t bits ) noexcept
+{
+   const uint64_t hash( static_cast<uint64_t>( key ) * 0x9E3779B97F4A7C15ULL );
+   return static_cast<size_t>( hash >> ( 64UL - bits ) );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Counting the scalar products of all rows/columns of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param L The outer sparse matrix operand.
+// \param R The inner sparse matrix operand.
+// \param m The number of rows/columns of the outer operand.
+// \param offsets The resulting exclusive prefix sum of the products (an array of \a m+1 elements).
+// \return void
+*/
+template< typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+void countProducts( const MT1& L, const MT2& R, size_t m, size_t* offsets )
+{
+   offsets[0UL] = 0UL;
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      size_t products( 0UL );
+
+      const auto lend( L.end( i ) );
+      for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+         products += R.nonZeros( lelem->index() );
+      }
+
+      offsets[i+1UL] = offsets[i] + products;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the sparsity pattern of a range of rows/columns of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param L The outer sparse matrix operand.
+// \param R The inner sparse matrix operand.
+// \param n The number of columns/rows of the result matrix.
+// \param af The requested accumulator.
+// \param offsets The exclusive prefix sum of the products of all rows/columns.
+// \param begin The index of the first row/column of the range.
+// \param end The index one past the last row/column of the range.
+// \param nonzeros The resulting number of non-zero elements per row/column.
+// \param indices The resulting sorted indices of the non-zero elements of the range.
+// \param ws The workspace of the accumulators.
+// \return void
+*/
+template< typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2    // Type of the inner sparse matrix operand
+        , typename Type > // Data type of the result matrix
+void symbolicMultRows( const MT1& L, const MT2& R, size_t n, AccumulatorFlag af,
+                       const size_t* offsets, size_t begin, size_t end, size_t* nonzeros,
+                       std::vector<size_t>& indices, SMatSMatMultWorkspace<Type>& ws )
+{
+   for( size_t i=begin; i<end; ++i )
+   {
+      const size_t first( indices.size() );
+      const size_t products( offsets[i+1UL] - offsets[i] );
+
+      const auto lend( L.end( i ) );
+
+      switch( selectAccumulator( af, products, n ) )
+      {
+         case hashAccumulator: {
+            const size_t bits( hashAccumulatorBits( products ) );
+            const size_t mask( ( 1UL << bits ) - 1UL );
+
+            ws.keys.assign( 1UL << bits, inf );
+
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+                  size_t slot( hashAccumulatorSlot( j, bits ) );
+
+                  while( ws.keys[slot] != j && ws.keys[slot] != size_t( inf ) ) {
+                     slot = ( slot + 1UL ) & mask;
+                  }
+
+                  if( ws.keys[slot] != j ) {
+                     ws.keys[slot] = j;
+                     indices.push_back( j );
+                  }
+               }
+            }
+
+            std::sort( indices.begin()+first, indices.end() );
+            break;
+         }
+
+         case sortAccumulator: {
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  indices.push_back( relem->index() );
+               }
+            }
+
+            std::sort( indices.begin()+first, indices.end() );
+            indices.erase( std::unique( indices.begin()+first, indices.end() ), indices.end() );
+            break;
+         }
+
+         default: {
+            if( ws.positions.empty() ) {
+               ws.positions.resize( n, inf );
+            }
+
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+
+                  if( ws.positions[j] != i ) {
+                     ws.positions[j] = i;
+                     indices.push_back( j );
+                  }
+               }
+            }
+
+            std::sort( indices.begin()+first, indices.end() );
+            break;
+         }
+      }
+
+      nonzeros[i] = indices.size() - first;
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric computation of a range of rows/columns of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the precomputed sparsity pattern.
+// \param L The outer sparse matrix operand.
+// \param R The inner sparse matrix operand.
+// \param n The number of columns/rows of the result matrix.
+// \param af The requested accumulator.
+// \param offsets The exclusive prefix sum of the products of all rows/columns.
+// \param begin The index of the first row/column of the range.
+// \param end The index one past the last row/column of the range.
+// \param ws The workspace of the accumulators.
+// \return \a true in case all products fit into the sparsity pattern, \a false if not.
+//
+// This function resets all values of the given range of rows/columns of the target matrix and
+// accumulates the scalar products in the existing elements. In case of a column-major target
+// matrix \a L corresponds to the right-hand side operand and \a R to the left-hand side operand,
+// which is respected by the order of the scalar multiplications.
+*/
+template< typename Type   // Data type of the result matrix
+        , bool SO         // Storage order of the result matrix
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+bool numericMultRows( CompressedMatrix<Type,SO>& C, const MT1& L, const MT2& R, size_t n,
+                      AccumulatorFlag af, const size_t* offsets, size_t begin, size_t end,
+                      SMatSMatMultWorkspace<Type>& ws )
+{
+   for( size_t i=begin; i<end; ++i )
+   {
+      const auto element( C.begin( i ) );
+      const size_t nonzeros( C.nonZeros( i ) );
+      const size_t products( offsets[i+1UL] - offsets[i] );
+
+      for( size_t k=0UL; k<nonzeros; ++k ) {
+         reset( element[k].value() );
+      }
+
+      const auto lend( L.end( i ) );
+
+      switch( selectAccumulator( af, products, n ) )
+      {
+         case hashAccumulator: {
+            const size_t bits( hashAccumulatorBits( nonzeros ) );
+            const size_t mask( ( 1UL << bits ) - 1UL );
+
+            ws.keys.assign( 1UL << bits, inf );
+            ws.slots.resize( 1UL << bits );
+
+            for( size_t k=0UL; k<nonzeros; ++k )
+            {
+               size_t slot( hashAccumulatorSlot( element[k].index(), bits ) );
+
+               while( ws.keys[slot] != size_t( inf ) ) {
+                  slot = ( slot + 1UL ) & mask;
+               }
+
+               ws.keys [slot] = element[k].index();
+               ws.slots[slot] = k;
+            }
+
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t j( relem->index() );
+                  size_t slot( hashAccumulatorSlot( j, bits ) );
+
+                  while( ws.keys[slot] != j ) {
+                     if( ws.keys[slot] == size_t( inf ) ) return false;
+                     slot = ( slot + 1UL ) & mask;
+                  }
+
+                  element[ws.slots[slot]].value() += SO ? Type( relem->value() * lelem->value() )
+                                                        : Type( lelem->value() * relem->value() );
+               }
+            }
+            break;
+         }
+
+         case sortAccumulator: {
+            ws.products.clear();
+
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem ) {
+                  ws.products.emplace_back( relem->index(),
+                                            SO ? Type( relem->value() * lelem->value() )
+                                               : Type( lelem->value() * relem->value() ) );
+               }
+            }
+
+            std::stable_sort( ws.products.begin(), ws.products.end(),
+                              []( const auto& a, const auto& b ) { return a.first < b.first; } );
+
+            size_t k( 0UL );
+
+            for( const auto& product : ws.products )
+            {
+               while( k < nonzeros && element[k].index() < product.first ) {
+                  ++k;
+               }
+
+               if( k == nonzeros || element[k].index() != product.first ) return false;
+
+               element[k].value() += product.second;
+            }
+            break;
+         }
+
+         default: {
+            if( ws.positions.empty() ) {
+               ws.positions.resize( n, 0UL );
+            }
+
+            for( size_t k=0UL; k<nonzeros; ++k ) {
+               ws.positions[element[k].index()] = k;
+            }
+
+            for( auto lelem=L.begin( i ); lelem!=lend; ++lelem ) {
+               const auto rend( R.end( lelem->index() ) );
+               for( auto relem=R.begin( lelem->index() ); relem!=rend; ++relem )
+               {
+                  const size_t k( ws.positions[relem->index()] );
+
+                  if( k >= nonzeros || element[k].index() != relem->index() ) return false;
+
+                  element[k].value() += SO ? Type( relem->value() * lelem->value() )
+                                           : Type( lelem->value() * relem->value() );
+               }
+            }
+            break;
+         }
+      }
+   }
+
+   return true;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computing the number of threads for a sparse matrix product with the given number of
+//        scalar products.
+// \ingroup sparse_matrix
+//
+// \param products The total number of scalar products.
+// \return The number of threads to be used.
+*/
+inline size_t smatSMatMultThreads( size_t products )
+{
+   if( products < SMP_SMATSMATMULT_THRESHOLD ||
+       isSerialSectionActive() || isParallelSectionActive() )
+      return 1UL;
+   else
+      return getNumThreads();
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the sparsity pattern of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix.
+// \param L The outer sparse matrix operand.
+// \param R The inner sparse matrix operand.
+// \param m The number of rows/columns of the result matrix.
+// \param n The number of columns/rows of the result matrix.
+// \param af The requested accumulator.
+// \return void
+//
+// This function computes the sorted indices of all rows/columns in parallel, lays out the storage
+// of the target matrix via a single call to CompressedMatrix::restructure(), and appends all
+// elements with a default value in parallel.
+*/
+template< typename Type   // Data type of the result matrix
+        , bool SO         // Storage order of the result matrix
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+void symbolicMultKernel( CompressedMatrix<Type,SO>& C, const MT1& L, const MT2& R,
+                         size_t m, size_t n, AccumulatorFlag af )
+{
+   std::unique_ptr<size_t[]> offsets( new size_t[m+1UL] );
+   countProducts( L, R, m, offsets.get() );
+
+   const size_t threads( smatSMatMultThreads( offsets[m] ) );
+
+   std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+   partitionWork( offsets.get(), m, threads, bounds.get() );
+
+   std::unique_ptr<size_t[]> nonzeros( new size_t[m] );
+   std::vector< std::vector<size_t> > indices( threads );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      SMatSMatMultWorkspace<Type> ws;
+      symbolicMultRows( L, R, n, af, offsets.get(), bounds[t], bounds[t+1UL],
+                        nonzeros.get(), indices[t], ws );
+   } );
+
+   if( SO ) C.resize( n, m, false );
+   else     C.resize( m, n, false );
+
+   C.restructure( nonzeros.get() );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      auto index( indices[t].cbegin() );
+
+      for( size_t i=bounds[t]; i<bounds[t+1UL]; ++i ) {
+         for( size_t k=0UL; k<nonzeros[i]; ++k, ++index ) {
+            if( SO ) C.append( *index, i, Type() );
+            else     C.append( i, *index, Type() );
+         }
+      }
+   } );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric computation of a sparse matrix product.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the precomputed sparsity pattern.
+// \param L The outer sparse matrix operand.
+// \param R The inner sparse matrix operand.
+// \param m The number of rows/columns of the result matrix.
+// \param n The number of columns/rows of the result matrix.
+// \param af The requested accumulator.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the product.
+*/
+template< typename Type   // Data type of the result matrix
+        , bool SO         // Storage order of the result matrix
+        , typename MT1    // Type of the outer sparse matrix operand
+        , typename MT2 >  // Type of the inner sparse matrix operand
+void numericMultKernel( CompressedMatrix<Type,SO>& C, const MT1& L, const MT2& R,
+                        size_t m, size_t n, AccumulatorFlag af )
+{
+   std::unique_ptr<size_t[]> offsets( new size_t[m+1UL] );
+   countProducts( L, R, m, offsets.get() );
+
+   const size_t threads( smatSMatMultThreads( offsets[m] ) );
+
+   std::unique_ptr<size_t[]> bounds( new size_t[threads+1UL] );
+   partitionWork( offsets.get(), m, threads, bounds.get() );
+
+   std::unique_ptr<bool[]> valid( new bool[threads] );
+
+   smpFor( threads, [&]( size_t t )
+   {
+      SMatSMatMultWorkspace<Type> ws;
+      valid[t] = numericMultRows( C, L, R, n, af, offsets.get(), bounds[t], bounds[t+1UL], ws );
+   } );
+
+   for( size_t t=0UL; t<threads; ++t ) {
+      if( !valid[t] ) {
+         BLAZE_THROW_INVALID_ARGUMENT( "Sparsity pattern does not match the matrix product" );
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the sparsity pattern of a sparse matrix product with row-major target.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side sparse matrix operand (row-major).
+// \param B The right-hand side sparse matrix operand (row-major).
+// \param af The requested accumulator.
+// \return void
+//
+// In case of a row-major target matrix, each row of the result is computed by traversing the
+// according row of \a A and accumulating the rows of \a B.
+*/
+template< typename Type   // Data type of the result matrix
+        , typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2 >  // Type of the right-hand side sparse matrix operand
+inline void symbolicMultKernel( CompressedMatrix<Type,false>& C, const MT1& A, const MT2& B,
+                                AccumulatorFlag af )
+{
+   symbolicMultKernel( C, A, B, A.rows(), B.columns(), af );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Computation of the sparsity pattern of a sparse matrix product with column-major target.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side sparse matrix operand (column-major).
+// \param B The right-hand side sparse matrix operand (column-major).
+// \param af The requested accumulator.
+// \return void
+//
+// In case of a column-major target matrix, each column of the result is computed by traversing
+// the according column of \a B and accumulating the columns of \a A.
+*/
+template< typename Type   // Data type of the result matrix
+        , typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2 >  // Type of the right-hand side sparse matrix operand
+inline void symbolicMultKernel( CompressedMatrix<Type,true>& C, const MT1& A, const MT2& B,
+                                AccumulatorFlag af )
+{
+   symbolicMultKernel( C, B, A, B.columns(), A.rows(), af );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric computation of a sparse matrix product with row-major target.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the precomputed sparsity pattern.
+// \param A The left-hand side sparse matrix operand (row-major).
+// \param B The right-hand side sparse matrix operand (row-major).
+// \param af The requested accumulator.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the product.
+*/
+template< typename Type   // Data type of the result matrix
+        , typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2 >  // Type of the right-hand side sparse matrix operand
+inline void numericMultKernel( CompressedMatrix<Type,false>& C, const MT1& A, const MT2& B,
+                               AccumulatorFlag af )
+{
+   numericMultKernel( C, A, B, A.rows(), B.columns(), af );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Numeric computation of a sparse matrix product with column-major target.
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the precomputed sparsity pattern.
+// \param A The left-hand side sparse matrix operand (column-major).
+// \param B The right-hand side sparse matrix operand (column-major).
+// \param af The requested accumulator.
+// \return void
+// \exception std::invalid_argument Sparsity pattern does not match the product.
+*/
+template< typename Type   // Data type of the result matrix
+        , typename MT1    // Type of the left-hand side sparse matrix operand
+        , typename MT2 >  // Type of the right-hand side sparse matrix operand
+inline void numericMultKernel( CompressedMatrix<Type,true>& C, const MT1& A, const MT2& B,
+                               AccumulatorFlag af )
+{
+   numericMultKernel( C, B, A, B.columns(), A.rows(), af );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SPARSE MATRIX/SPARSE MATRIX MULTIPLICATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Two-phase sparse matrix/sparse matrix multiplication functions */
+//@{
+template< AccumulatorFlag AF, typename Type, bool SO
+        , typename MT1, bool SO1, typename MT2, bool SO2 >
+void symbolicMult( CompressedMatrix<Type,SO>& C,
+                   const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B );
+
+template< typename Type, bool SO
+        , typename MT1, bool SO1, typename MT2, bool SO2 >
+void symbolicMult( CompressedMatrix<Type,SO>& C,
+                   const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B );
+
+template< AccumulatorFlag AF, typename Type, bool SO
+        , typename MT1, bool SO1, typename MT2, bool SO2 >
+void numericMult( CompressedMatrix<Type,SO>& C,
+                  const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B );
+
+template< typename Type, bool SO
+        , typename MT1, bool SO1, typename MT2, bool SO2 >
+void numericMult( CompressedMatrix<Type,SO>& C,
+                  const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the sparsity pattern of a sparse matrix/sparse matrix multiplication
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function resizes the given compressed matrix to the size of the product \f$ A*B \f$ and
+// sets up its sparsity pattern in a single allocation. All elements of the pattern are stored
+// with a default value, i.e. the pattern contains every position that is structurally non-zero,
+// including positions where the scalar products cancel each other out. The values are computed
+// by a subsequent call to numericMult(), which can be repeated for all operands that have the
+// same sparsity pattern as \a A and \a B:
+
+   \code
+   using blaze::CompressedMatrix;
+
+   CompressedMatrix<double> A, P;
+   // ... Resizing and initialization
+
+   CompressedMatrix<double> AP;
+   symbolicMult( AP, A, P );  // Computation of the sparsity pattern of A*P
+
+   for( ... ) {
+      // ... Update of the values of A and P without changing their sparsity pattern
+      numericMult( AP, A, P );  // Refill of the values of AP
+   }
+   \endcode
+
+// The accumulator used for the rows (row-major target) or columns (column-major target) of the
+// product can be selected explicitly via the \a AF template argument (see AccumulatorFlag):
+
+   \code
+   symbolicMult<blaze::hashAccumulator>( AP, A, P );
+   numericMult<blaze::hashAccumulator>( AP, A, P );
+   \endcode
+
+// By default, the accumulator is selected individually for each row/column. In case the storage
+// order of an operand differs from the storage order of the target matrix, the operand is
+// converted on each call. Large products are computed in parallel.
+*/
+template< AccumulatorFlag AF  // Type of the accumulator
+        , typename Type       // Data type of the result matrix
+        , bool SO             // Storage order of the result matrix
+        , typename MT1        // Type of the left-hand side sparse matrix operand
+        , bool SO1            // Storage order of the left-hand side sparse matrix operand
+        , typename MT2        // Type of the right-hand side sparse matrix operand
+        , bool SO2 >          // Storage order of the right-hand side sparse matrix operand
+void symbolicMult( CompressedMatrix<Type,SO>& C,
+                   const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using OT1 = If_t< SO1 == SO
+                   , CompositeType_t<MT1>
+                   , const CompressedMatrix< ElementType_t<MT1>, SO > >;
+   using OT2 = If_t< SO2 == SO
+                   , CompositeType_t<MT2>
+                   , const CompressedMatrix< ElementType_t<MT2>, SO > >;
+
+   OT1 a( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   OT2 b( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( a.canAlias( &C ) || b.canAlias( &C ) ) {
+      CompressedMatrix<Type,SO> tmp;
+      symbolicMultKernel( tmp, a, b, AF );
+      C.swap( tmp );
+   }
+   else {
+      symbolicMultKernel( C, a, b, AF );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computation of the sparsity pattern of a sparse matrix/sparse matrix multiplication
+//        (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target matrix.
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// This function computes the sparsity pattern of the product \f$ A*B \f$ with an accumulator
+// that is selected individually for each row/column (see the \a adaptiveAccumulator flag). For
+// a detailed description see the symbolicMult() function with explicit accumulator flag.
+*/
+template< typename Type  // Data type of the result matrix
+        , bool SO        // Storage order of the result matrix
+        , typename MT1   // Type of the left-hand side sparse matrix operand
+        , bool SO1       // Storage order of the left-hand side sparse matrix operand
+        , typename MT2   // Type of the right-hand side sparse matrix operand
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix operand
+inline void symbolicMult( CompressedMatrix<Type,SO>& C,
+                          const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B )
+{
+   symbolicMult<adaptiveAccumulator>( C, ~A, ~B );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric computation of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the sparsity pattern computed by symbolicMult().
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match the matrix product.
+//
+// This function computes the values of the product \f$ A*B \f$ and stores them in the existing
+// elements of the given compressed matrix, whose sparsity pattern has been set up by a previous
+// call to symbolicMult(). No memory is allocated for the target matrix and no indices are sorted
+// or moved, which makes this function the method of choice for repeatedly computing products of
+// operands with unchanging sparsity patterns (for instance Galerkin products in multigrid methods
+// or the matrices of time stepping schemes):
+
+   \code
+   using blaze::CompressedMatrix;
+
+   CompressedMatrix<double> A, B, C;
+   // ... Resizing and initialization
+
+   symbolicMult( C, A, B );
+
+   for( ... ) {
+      // ... Update of the values of A and B without changing their sparsity pattern
+      numericMult( C, A, B );
+   }
+   \endcode
+
+// All elements of the sparsity pattern are overwritten, including elements that are not affected
+// by any scalar product, which are reset to their default value. In case a scalar product does
+// not fit into the sparsity pattern of the target matrix, a \a std::invalid_argument exception
+// is thrown. In this case the values of the target matrix are unspecified, but its sparsity
+// pattern remains unchanged.
+*/
+template< AccumulatorFlag AF  // Type of the accumulator
+        , typename Type       // Data type of the result matrix
+        , bool SO             // Storage order of the result matrix
+        , typename MT1        // Type of the left-hand side sparse matrix operand
+        , bool SO1            // Storage order of the left-hand side sparse matrix operand
+        , typename MT2        // Type of the right-hand side sparse matrix operand
+        , bool SO2 >          // Storage order of the right-hand side sparse matrix operand
+void numericMult( CompressedMatrix<Type,SO>& C,
+                  const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B )
+{
+   BLAZE_FUNCTION_TRACE;
+
+   if( (~A).columns() != (~B).rows() ||
+       (~A).rows() != C.rows() || (~B).columns() != C.columns() ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   using OT1 = If_t< SO1 == SO
+                   , CompositeType_t<MT1>
+                   , const CompressedMatrix< ElementType_t<MT1>, SO > >;
+   using OT2 = If_t< SO2 == SO
+                   , CompositeType_t<MT2>
+                   , const CompressedMatrix< ElementType_t<MT2>, SO > >;
+
+   OT1 a( ~A );  // Evaluation of the left-hand side sparse matrix operand
+   OT2 b( ~B );  // Evaluation of the right-hand side sparse matrix operand
+
+   if( a.canAlias( &C ) || b.canAlias( &C ) ) {
+      CompressedMatrix<Type,SO> tmp( C );
+      numericMultKernel( tmp, a, b, AF );
+      C.swap( tmp );
+   }
+   else {
+      numericMultKernel( C, a, b, AF );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Numeric computation of a sparse matrix/sparse matrix multiplication (\f$ C=A*B \f$).
+// \ingroup sparse_matrix
+//
+// \param C The target matrix with the sparsity pattern computed by symbolicMult().
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::invalid_argument Matrix sizes do not match.
+// \exception std::invalid_argument Sparsity pattern does not match the matrix product.
+//
+// This function computes the values of the product \f$ A*B \f$ with an accumulator that is
+// selected individually for each row/column (see the \a adaptiveAccumulator flag). For a detailed
+// description see the numericMult() function with explicit accumulator flag.
+*/
+template< typename Type  // Data type of the result matrix
+        , bool SO        // Storage order of the result matrix
+        , typename MT1   // Type of the left-hand side sparse matrix operand
+        , bool SO1       // Storage order of the left-hand side sparse matrix operand
+        , typename MT2   // Type of the right-hand side sparse matrix operand
+        , bool SO2 >     // Storage order of the right-hand side sparse matrix operand
+inline void numericMult( CompressedMatrix<Type,SO>& C,
+                         const SparseMatrix<MT1,SO1>& A, const SparseMatrix<MT2,SO2>& B )
+{
+   numericMult<adaptiveAccumulator>( C, ~A, ~B );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
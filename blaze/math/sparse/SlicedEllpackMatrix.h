@@ -0,0 +1,1677 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SlicedEllpackMatrix.h
+//  \brief Implementation of a sparse MxN matrix in sliced ELLPACK (SELL-C-sigma) format
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SLICEDELLPACKMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/Matrix.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/simd/SIMDTrait.h>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/math/typetraits/IsComputation.h>
+#include <blaze/math/typetraits/IsRowMajorMatrix.h>
+#include <blaze/math/typetraits/IsSlicedEllpack.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSparseMatrix.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Size.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/mpl/If.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup sliced_ellpack_matrix SlicedEllpackMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ sparse matrix in sliced ELLPACK format.
+// \ingroup sliced_ellpack_matrix
+//
+// The SlicedEllpackMatrix class template is the representation of an arbitrary sized, row-major
+// sparse matrix in the sliced ELLPACK format (also known as SELL-C-sigma). The type of the
+// elements and the type of the stored indices can be specified via the two template parameters:
+
+   \code
+   template< typename Type, typename IT >
+   class SlicedEllpackMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SlicedEllpackMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - IT  : specifies the type of the stored indices. IT must be a 32-bit or 64-bit unsigned
+//          integral type (i.e. \c uint32_t or \c uint64_t). The default value is \c uint32_t.
+//
+// The rows of the matrix are grouped into chunks of \a C consecutive rows, where \a C is the
+// number of elements per SIMD vector (see the \a chunkSize member constant). Within a chunk the
+// non-zero elements of all rows are interleaved: The k-th element of all rows of a chunk are
+// stored contiguously in memory. All rows of a chunk are padded to the length of the longest
+// row of the chunk. In order to keep the amount of padding small, the rows are sorted by their
+// number of non-zero elements in descending order within windows of \a sigma consecutive rows
+// before they are assigned to chunks. The larger the sorting scope, the less padding is required,
+// but the more the access pattern to the result vector of a sparse matrix/dense vector product
+// is scattered.
+//
+// This layout enables the vectorization of sparse matrix/dense vector and sparse matrix/dense
+// matrix products across the rows of a chunk: For each position k within a chunk, a single
+// aligned SIMD load retrieves the values of all rows of the chunk and a single SIMD gather
+// retrieves the corresponding elements of the dense vector. In contrast to the row-wise
+// vectorization of the CompressedMatrix and SoACompressedMatrix kernels, this also works for
+// very short rows. Note that the padding elements are never part of any computation, i.e. the
+// results are identical to the results of a CompressedMatrix even in case the dense operand
+// contains infinite or NaN values.
+//
+// SlicedEllpackMatrix is a read-only format that is created from an arbitrary matrix. Since
+// the layout depends on the number of non-zero elements of all rows, it is not possible to
+// modify individual elements. Instead, the entire matrix has to be reassigned:
+
+   \code
+   using blaze::CompressedMatrix;
+   using blaze::SlicedEllpackMatrix;
+   using blaze::DynamicVector;
+
+   CompressedMatrix<double> A( 1000UL, 1000UL );
+   // ... Initialization of the compressed matrix
+
+   SlicedEllpackMatrix<double> S( A );           // Conversion with default sorting scope
+   SlicedEllpackMatrix<double> T( A, 256UL );    // Conversion with a sorting scope of 256 rows
+
+   DynamicVector<double> x( 1000UL, 1.0 ), y;
+   y = S * x;  // Vectorized sparse matrix/dense vector multiplication
+
+   // Traversing the non-zero elements of the 2nd row
+   for( auto it=S.begin(1); it!=S.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+
+   S = 2.0 * A;  // Reassignment of the entire matrix
+   \endcode
+
+// SlicedEllpackMatrix can be used as operand in all operations that are supported for sparse
+// matrices, in arbitrary combinations with dense and sparse vectors and matrices. The results
+// of these operations are stored in a CompressedMatrix.
+*/
+template< typename Type               // Data type of the matrix
+        , typename IT = uint32_t >    // Type of the indices
+class SlicedEllpackMatrix
+   : public SparseMatrix< SlicedEllpackMatrix<Type,IT>, rowMajor >
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! The number of rows per chunk.
+   /*! The \a chunkSize compilation constant corresponds to the number of elements of the matrix
+       element type per SIMD vector. All rows of a chunk are processed simultaneously by the
+       vectorized multiplication kernels. */
+   static constexpr size_t chunkSize = SIMDTrait<Type>::size;
+
+   //! The default sorting scope.
+   /*! The \a defaultSigma compilation constant specifies the default number of consecutive rows
+       that are sorted by their number of non-zero elements during the construction. */
+   static constexpr size_t defaultSigma = 32UL * chunkSize;
+
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**ConstIterator class definition**************************************************************
+   /*!\brief Iterator over the non-zero elements of a single row of the sliced ELLPACK matrix.
+   //
+   // Since the elements of all rows of a chunk are interleaved, the iterator advances by
+   // \a chunkSize elements in the value and index arrays. Similar to the iterators of the
+   // SoACompressedMatrix class template, the value and index of the current element are
+   // accessed via the arrow operator.
+   */
+   class ConstIterator
+   {
+    public:
+      //**Type definitions*************************************************************************
+      using Element = ValueIndexPair<Type>;  //!< Element type of the iterator.
+
+      using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+      using ValueType        = Element;                          //!< Type of the underlying elements.
+      using PointerType      = const ConstIterator*;             //!< Pointer return type.
+      using ReferenceType    = const Element;                    //!< Reference return type.
+      using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+      // STL iterator requirements
+      using iterator_category = IteratorCategory;  //!< The iterator category.
+      using value_type        = ValueType;         //!< Type of the underlying elements.
+      using pointer           = PointerType;       //!< Pointer return type.
+      using reference         = ReferenceType;     //!< Reference return type.
+      using difference_type   = DifferenceType;    //!< Difference between two iterators.
+      //*******************************************************************************************
+
+      //**Constructors*****************************************************************************
+      /*!\brief Default constructor for the ConstIterator class.
+      */
+      inline ConstIterator() noexcept
+         : value_( nullptr )  // Pointer to the value of the current element
+         , index_( nullptr )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //*******************************************************************************************
+      /*!\brief Constructor for the ConstIterator class.
+      //
+      // \param value Pointer to the value of the initial element.
+      // \param index Pointer to the index of the initial element.
+      */
+      inline ConstIterator( const Type* value, const IT* index ) noexcept
+         : value_( value )  // Pointer to the value of the current element
+         , index_( index )  // Pointer to the index of the current element
+      {}
+      //*******************************************************************************************
+
+      //**Prefix increment operator****************************************************************
+      /*!\brief Pre-increment operator.
+      //
+      // \return Reference to the incremented iterator.
+      */
+      inline ConstIterator& operator++() noexcept {
+         value_ += chunkSize;
+         index_ += chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix increment operator***************************************************************
+      /*!\brief Post-increment operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator++( int ) noexcept {
+         const ConstIterator tmp( *this );
+         ++(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Prefix decrement operator****************************************************************
+      /*!\brief Pre-decrement operator.
+      //
+      // \return Reference to the decremented iterator.
+      */
+      inline ConstIterator& operator--() noexcept {
+         value_ -= chunkSize;
+         index_ -= chunkSize;
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Postfix decrement operator***************************************************************
+      /*!\brief Post-decrement operator.
+      //
+      // \return The previous position of the iterator.
+      */
+      inline const ConstIterator operator--( int ) noexcept {
+         const ConstIterator tmp( *this );
+         --(*this);
+         return tmp;
+      }
+      //*******************************************************************************************
+
+      //**Addition assignment operator*************************************************************
+      /*!\brief Addition assignment operator.
+      //
+      // \param inc The increment of the iterator.
+      // \return The incremented iterator.
+      */
+      inline ConstIterator& operator+=( ptrdiff_t inc ) noexcept {
+         value_ += inc * ptrdiff_t( chunkSize );
+         index_ += inc * ptrdiff_t( chunkSize );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction assignment operator**********************************************************
+      /*!\brief Subtraction assignment operator.
+      //
+      // \param dec The decrement of the iterator.
+      // \return The decremented iterator.
+      */
+      inline ConstIterator& operator-=( ptrdiff_t dec ) noexcept {
+         value_ -= dec * ptrdiff_t( chunkSize );
+         index_ -= dec * ptrdiff_t( chunkSize );
+         return *this;
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return The current value-index-pair.
+      */
+      inline ReferenceType operator*() const {
+         return Element( *value_, *index_ );
+      }
+      //*******************************************************************************************
+
+      //**Element access operator******************************************************************
+      /*!\brief Direct access to the element at the current iterator position.
+      //
+      // \return Pointer to the iterator, which provides access to the current value and index.
+      */
+      inline PointerType operator->() const noexcept {
+         return this;
+      }
+      //*******************************************************************************************
+
+      //**Value function***************************************************************************
+      /*!\brief Access to the current value of the sparse element.
+      //
+      // \return Reference to the current value of the sparse element.
+      */
+      inline const Type& value() const noexcept {
+         return *value_;
+      }
+      //*******************************************************************************************
+
+      //**Index function***************************************************************************
+      /*!\brief Access to the current index of the sparse element.
+      //
+      // \return The current index of the sparse element.
+      */
+      inline size_t index() const noexcept {
+         return *index_;
+      }
+      //*******************************************************************************************
+
+      //**Equality operator************************************************************************
+      /*!\brief Equality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators refer to the same element, \a false if not.
+      */
+      inline bool operator==( const ConstIterator& rhs ) const noexcept {
+         return index_ == rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Inequality operator**********************************************************************
+      /*!\brief Inequality comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the iterators don't refer to the same element, \a false if they do.
+      */
+      inline bool operator!=( const ConstIterator& rhs ) const noexcept {
+         return index_ != rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-than operator***********************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller, \a false if not.
+      */
+      inline bool operator<( const ConstIterator& rhs ) const noexcept {
+         return index_ < rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-than operator********************************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater, \a false if not.
+      */
+      inline bool operator>( const ConstIterator& rhs ) const noexcept {
+         return index_ > rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Less-or-equal-than operator**************************************************************
+      /*!\brief Less-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+      */
+      inline bool operator<=( const ConstIterator& rhs ) const noexcept {
+         return index_ <= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Greater-or-equal-than operator***********************************************************
+      /*!\brief Greater-than comparison between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+      */
+      inline bool operator>=( const ConstIterator& rhs ) const noexcept {
+         return index_ >= rhs.index_;
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Calculating the number of elements between two ConstIterator objects.
+      //
+      // \param rhs The right-hand side iterator.
+      // \return The number of elements between the two iterators.
+      */
+      inline DifferenceType operator-( const ConstIterator& rhs ) const noexcept {
+         return ( index_ - rhs.index_ ) / ptrdiff_t( chunkSize );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be incremented.
+      // \param inc The number of elements the iterator is incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( const ConstIterator& it, ptrdiff_t inc ) noexcept {
+         return ConstIterator( it.value_ + inc*ptrdiff_t( chunkSize ), it.index_ + inc*ptrdiff_t( chunkSize ) );
+      }
+      //*******************************************************************************************
+
+      //**Addition operator************************************************************************
+      /*!\brief Addition between an integral value and a ConstIterator.
+      //
+      // \param inc The number of elements the iterator is incremented.
+      // \param it The iterator to be incremented.
+      // \return The incremented iterator.
+      */
+      friend inline const ConstIterator operator+( ptrdiff_t inc, const ConstIterator& it ) noexcept {
+         return ConstIterator( it.value_ + inc*ptrdiff_t( chunkSize ), it.index_ + inc*ptrdiff_t( chunkSize ) );
+      }
+      //*******************************************************************************************
+
+      //**Subtraction operator*********************************************************************
+      /*!\brief Subtraction between a ConstIterator and an integral value.
+      //
+      // \param it The iterator to be decremented.
+      // \param dec The number of elements the iterator is decremented.
+      // \return The decremented iterator.
+      */
+      friend inline const ConstIterator operator-( const ConstIterator& it, ptrdiff_t dec ) noexcept {
+         return ConstIterator( it.value_ - dec*ptrdiff_t( chunkSize ), it.index_ - dec*ptrdiff_t( chunkSize ) );
+      }
+      //*******************************************************************************************
+
+    private:
+      //**Member variables*************************************************************************
+      const Type* value_;  //!< Pointer to the value of the current element.
+      const IT*   index_;  //!< Pointer to the index of the current element.
+      //*******************************************************************************************
+   };
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   using This           = SlicedEllpackMatrix<Type,IT>;          //!< Type of this SlicedEllpackMatrix instance.
+   using BaseType       = SparseMatrix<This,rowMajor>;           //!< Base type of this SlicedEllpackMatrix instance.
+   using ResultType     = CompressedMatrix<Type,rowMajor>;       //!< Result type for expression template evaluations.
+   using OppositeType   = CompressedMatrix<Type,columnMajor>;    //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = CompressedMatrix<Type,columnMajor>;    //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                                  //!< Type of the sparse matrix elements.
+   using IndexType      = IT;                                    //!< Type of the stored indices.
+   using ReturnType     = const Type&;                           //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                           //!< Data type for composite expression templates.
+   using Reference      = const Type&;                           //!< Reference to a sparse matrix value.
+   using ConstReference = const Type&;                           //!< Reference to a constant sparse matrix value.
+   using Iterator       = ConstIterator;                         //!< Iterator over non-constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SlicedEllpackMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SlicedEllpackMatrix<NewType,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SlicedEllpackMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SlicedEllpackMatrix<Type,IT>;  //!< The type of the other SlicedEllpackMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SlicedEllpackMatrix();
+
+   inline SlicedEllpackMatrix( const SlicedEllpackMatrix& sm );
+   inline SlicedEllpackMatrix( SlicedEllpackMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO >
+   inline SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma=defaultSigma );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SlicedEllpackMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   inline const Type*    values() const noexcept;
+   inline const IT*      indices() const noexcept;
+   inline const IT*      rowIndices() const noexcept;
+   inline const IT*      rowLengths() const noexcept;
+   inline size_t         offset( size_t c ) const noexcept;
+   inline size_t         width ( size_t c ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SlicedEllpackMatrix& operator=( const SlicedEllpackMatrix& rhs );
+   inline SlicedEllpackMatrix& operator=( SlicedEllpackMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO > inline SlicedEllpackMatrix& operator=( const Matrix<MT,SO>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t sigma() const noexcept;
+   inline size_t chunks() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const noexcept;
+   inline size_t nonZeros( size_t i ) const noexcept;
+   inline void   clear();
+   inline void   swap( SlicedEllpackMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void checkDimensions( size_t m, size_t n );
+
+   inline size_t base( size_t i ) const noexcept;
+
+   template< typename MT > void construct( const SparseMatrix<MT,rowMajor>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;          //!< The current number of rows of the sparse matrix.
+   size_t  n_;          //!< The current number of columns of the sparse matrix.
+   size_t  sigma_;      //!< The number of consecutive rows sorted by their number of non-zeros.
+   size_t  nonzeros_;   //!< The total number of non-zero elements.
+   size_t  chunks_;     //!< The number of chunks.
+   size_t* offsets_;    //!< Offsets of the first element of each chunk (\a chunks_+1 elements).
+   IT*     rows_;       //!< The original row index of each sorted row (\a chunks_*C elements).
+   IT*     positions_;  //!< The sorted position of each original row (\a m_ elements).
+   IT*     lengths_;    //!< The number of non-zeros of each sorted row (\a chunks_*C elements).
+   Type*   values_;     //!< The values of all non-zero elements including the padding.
+   IT*     indices_;    //!< The column indices of all non-zero elements including the padding.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 1UL );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 2UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, typename IT >
+const Type SlicedEllpackMatrix<Type,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix()
+   : m_        ( 0UL )           // The current number of rows of the sparse matrix
+   , n_        ( 0UL )           // The current number of columns of the sparse matrix
+   , sigma_    ( defaultSigma )  // The number of consecutive rows sorted by their number of non-zeros
+   , nonzeros_ ( 0UL )           // The total number of non-zero elements
+   , chunks_   ( 0UL )           // The number of chunks
+   , offsets_  ( nullptr )       // Offsets of the first element of each chunk
+   , rows_     ( nullptr )       // The original row index of each sorted row
+   , positions_( nullptr )       // The sorted position of each original row
+   , lengths_  ( nullptr )       // The number of non-zeros of each sorted row
+   , values_   ( nullptr )       // The values of all non-zero elements including the padding
+   , indices_  ( nullptr )       // The column indices of all non-zero elements including the padding
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SlicedEllpackMatrix.
+//
+// \param sm Sliced ELLPACK matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const SlicedEllpackMatrix& sm )
+   : SlicedEllpackMatrix()
+{
+   if( sm.m_ == 0UL ) {
+      m_     = sm.m_;
+      n_     = sm.n_;
+      sigma_ = sm.sigma_;
+      return;
+   }
+
+   const size_t lanes   ( sm.chunks_ * chunkSize );
+   const size_t elements( sm.offsets_[sm.chunks_] + chunkSize );
+
+   offsets_   = new size_t[sm.chunks_+1UL];
+   rows_      = allocate<IT>( lanes );
+   positions_ = allocate<IT>( sm.m_ );
+   lengths_   = allocate<IT>( lanes );
+   values_    = allocate<Type>( elements );
+   indices_   = allocate<IT>( elements );
+
+   std::copy( sm.offsets_, sm.offsets_+sm.chunks_+1UL, offsets_ );
+   std::copy( sm.rows_, sm.rows_+lanes, rows_ );
+   std::copy( sm.positions_, sm.positions_+sm.m_, positions_ );
+   std::copy( sm.lengths_, sm.lengths_+lanes, lengths_ );
+   std::copy( sm.values_, sm.values_+elements, values_ );
+   std::copy( sm.indices_, sm.indices_+elements, indices_ );
+
+   m_        = sm.m_;
+   n_        = sm.n_;
+   sigma_    = sm.sigma_;
+   nonzeros_ = sm.nonzeros_;
+   chunks_   = sm.chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SlicedEllpackMatrix.
+//
+// \param sm The sliced ELLPACK matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( SlicedEllpackMatrix&& sm ) noexcept
+   : SlicedEllpackMatrix()
+{
+   swap( sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from arbitrary matrices.
+//
+// \param m The matrix to be converted.
+// \param sigma The number of consecutive rows sorted by their number of non-zero elements.
+// \exception std::invalid_argument Invalid sorting scope.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This constructor converts the given dense or sparse matrix into the sliced ELLPACK format.
+// Within each window of \a sigma consecutive rows, the rows are sorted by their number of
+// non-zero elements in descending order. A sorting scope of 1 preserves the original order of
+// the rows, a sorting scope equal to the number of rows sorts all rows of the matrix. In case
+// \a sigma is 0, a \a std::invalid_argument exception is thrown. Note that for dense matrices
+// all elements are stored, including the default (zero) elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+template< typename MT    // Type of the foreign matrix
+        , bool SO >      // Storage order of the foreign matrix
+inline SlicedEllpackMatrix<Type,IT>::SlicedEllpackMatrix( const Matrix<MT,SO>& m, size_t sigma )
+   : SlicedEllpackMatrix()
+{
+   using TmpType = If_t< IsSparseMatrix_v<MT> && IsRowMajorMatrix_v<MT> && !IsComputation_v<MT>
+                       , const MT&
+                       , const CompressedMatrix<Type,rowMajor> >;
+
+   if( sigma == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid sorting scope" );
+   }
+
+   checkDimensions( (~m).rows(), (~m).columns() );
+
+   sigma_ = sigma;
+
+   TmpType tmp( ~m );
+   construct( tmp );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SlicedEllpackMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>::~SlicedEllpackMatrix()
+{
+   delete[] offsets_;
+   deallocate( rows_ );
+   deallocate( positions_ );
+   deallocate( lengths_ );
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( i ) || pos->index() != j )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the sparse matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstReference
+   SlicedEllpackMatrix<Type,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( base( i ) );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator to the first non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cbegin( size_t i ) const noexcept
+{
+   return begin( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < m_, "Invalid sparse matrix row access index" );
+   const size_t pos( base( i ) + lengths_[positions_[i]]*chunkSize );
+   return ConstIterator( values_+pos, indices_+pos );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row \a i.
+//
+// \param i The row index.
+// \return Iterator just past the last non-zero element of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::cend( size_t i ) const noexcept
+{
+   return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the values of all chunks.
+//
+// \return Pointer to the value array.
+//
+// This function returns a pointer to the interleaved values of all chunks. The k-th element of
+// the row at position \a p (see the rowIndices() function) is stored at the index
+// \f$ offset(p/C) + k*C + p\%C \f$, where \a C is the chunk size. The value array is aligned
+// such that the values of each chunk start at an aligned address.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline const Type* SlicedEllpackMatrix<Type,IT>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the column indices of all chunks.
+//
+// \return Pointer to the index array.
+//
+// This function returns a pointer to the interleaved column indices of all chunks. The index
+// array has the same layout as the value array (see the values() function).
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline const IT* SlicedEllpackMatrix<Type,IT>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the permutation of the rows.
+//
+// \return Pointer to the row indices.
+//
+// This function returns a pointer to an array that contains the original row index for each
+// position within the chunks. The array contains \f$ chunks()*C \f$ elements. The elements at
+// positions \f$ [rows()..chunks()*C) \f$ correspond to padding rows and are not meaningful.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline const IT* SlicedEllpackMatrix<Type,IT>::rowIndices() const noexcept
+{
+   return rows_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level data access to the number of non-zero elements of the sorted rows.
+//
+// \return Pointer to the row lengths.
+//
+// This function returns a pointer to an array that contains the number of non-zero elements
+// of the row at each position within the chunks. The array contains \f$ chunks()*C \f$ elements,
+// where the lengths of padding rows are 0.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline const IT* SlicedEllpackMatrix<Type,IT>::rowLengths() const noexcept
+{
+   return lengths_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given chunk.
+//
+// \param c The index of the chunk in the range \f$[0..chunks()]\f$.
+// \return The offset of the chunk within the value and index arrays.
+//
+// The offset of chunk \a chunks() corresponds to the total number of stored elements including
+// the padding elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::offset( size_t c ) const noexcept
+{
+   BLAZE_USER_ASSERT( c <= chunks_, "Invalid chunk access index" );
+   return ( offsets_ != nullptr ? offsets_[c] : 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the width of the given chunk.
+//
+// \param c The index of the chunk in the range \f$[0..chunks()-1]\f$.
+// \return The number of non-zero elements of the longest row of the chunk.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::width( size_t c ) const noexcept
+{
+   BLAZE_USER_ASSERT( c < chunks_, "Invalid chunk access index" );
+   return ( offsets_[c+1UL] - offsets_[c] ) / chunkSize;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs Sliced ELLPACK matrix to be copied.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const SlicedEllpackMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   SlicedEllpackMatrix tmp( rhs );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SlicedEllpackMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( SlicedEllpackMatrix&& rhs ) noexcept
+{
+   swap( rhs );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for arbitrary matrices.
+//
+// \param rhs The matrix to be assigned.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The given matrix is converted into the sliced ELLPACK format by means of the current sorting
+// scope. The matrix may alias with this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+template< typename MT    // Type of the right-hand side matrix
+        , bool SO >      // Storage order of the right-hand side matrix
+inline SlicedEllpackMatrix<Type,IT>&
+   SlicedEllpackMatrix<Type,IT>::operator=( const Matrix<MT,SO>& rhs )
+{
+   SlicedEllpackMatrix tmp( ~rhs, sigma_ );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the sparse matrix.
+//
+// \return The number of rows of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the sparse matrix.
+//
+// \return The number of columns of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the sorting scope of the sparse matrix.
+//
+// \return The number of consecutive rows sorted by their number of non-zero elements.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::sigma() const noexcept
+{
+   return sigma_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of chunks of the sparse matrix.
+//
+// \return The number of chunks.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::chunks() const noexcept
+{
+   return chunks_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of stored elements including the padding elements.
+//
+// \return The capacity of the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity() const noexcept
+{
+   return offset( chunks_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the capacity of the specified row.
+//
+// \param i The index of the row.
+// \return The number of elements stored for the row including the padding elements.
+//
+// The capacity of a row corresponds to the width of the chunk containing the row.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return width( positions_[i] / chunkSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the sparse matrix.
+//
+// \return The number of non-zero elements in the sparse matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros() const noexcept
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row.
+//
+// \param i The index of the row.
+// \return The number of non-zero elements of row \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::nonZeros( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+   return lengths_[positions_[i]];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the sparse matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the sparse matrix is 0. The sorting scope remains
+// unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline void SlicedEllpackMatrix<Type,IT>::clear()
+{
+   SlicedEllpackMatrix tmp;
+   tmp.sigma_ = sigma_;
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+//
+// \param sm The matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline void SlicedEllpackMatrix<Type,IT>::swap( SlicedEllpackMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( sigma_, sm.sigma_ );
+   std::swap( nonzeros_, sm.nonzeros_ );
+   std::swap( chunks_, sm.chunks_ );
+   std::swap( offsets_, sm.offsets_ );
+   std::swap( rows_, sm.rows_ );
+   std::swap( positions_, sm.positions_ );
+   std::swap( lengths_, sm.lengths_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the dimensions of a sliced ELLPACK matrix against the range of the index type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This function checks whether all row and column indices as well as the number of non-zero
+// elements of all rows can be represented by the index type. In case either dimension exceeds
+// the range of the index type, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline void SlicedEllpackMatrix<Type,IT>::checkDimensions( size_t m, size_t n )
+{
+   constexpr size_t maxSize( std::numeric_limits<IT>::max() );
+
+   if( m > maxSize || n > maxSize ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix dimensions exceed the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the offset of the first element of the given row.
+//
+// \param i The index of the row.
+// \return The offset of the first element of row \a i within the value and index arrays.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline size_t SlicedEllpackMatrix<Type,IT>::base( size_t i ) const noexcept
+{
+   const size_t pos( positions_[i] );
+   return offsets_[pos/chunkSize] + pos%chunkSize;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setup of the sliced ELLPACK format for the given row-major sparse matrix.
+//
+// \param sm The row-major sparse matrix to be converted.
+// \return void
+//
+// This function sorts the rows of the given sparse matrix by their number of non-zero elements
+// within windows of \a sigma_ rows, groups the sorted rows into chunks, and finally copies the
+// non-zero elements into the interleaved layout. The function expects the matrix to be in
+// default state.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+template< typename MT >  // Type of the sparse matrix
+void SlicedEllpackMatrix<Type,IT>::construct( const SparseMatrix<MT,rowMajor>& sm )
+{
+   BLAZE_INTERNAL_ASSERT( m_ == 0UL && offsets_ == nullptr, "Invalid matrix state detected" );
+
+   const size_t m( (~sm).rows() );
+   const size_t n( (~sm).columns() );
+
+   if( m == 0UL ) {
+      n_ = n;
+      return;
+   }
+
+   const size_t chunks( ( m + chunkSize - 1UL ) / chunkSize );
+   const size_t lanes ( chunks * chunkSize );
+
+   std::vector<size_t> lengths( m );
+   for( size_t i=0UL; i<m; ++i ) {
+      lengths[i] = (~sm).nonZeros( i );
+   }
+
+   std::vector<size_t> order( m );
+   std::iota( order.begin(), order.end(), size_t(0) );
+
+   for( size_t i=0UL; i<m; i+=sigma_ ) {
+      const size_t iend( min( i+sigma_, m ) );
+      std::stable_sort( order.begin()+i, order.begin()+iend,
+                        [&lengths]( size_t a, size_t b ) { return lengths[a] > lengths[b]; } );
+   }
+
+   offsets_   = new size_t[chunks+1UL];
+   rows_      = allocate<IT>( lanes );
+   positions_ = allocate<IT>( m );
+   lengths_   = allocate<IT>( lanes );
+
+   std::fill( rows_, rows_+lanes, IT(0) );
+   std::fill( lengths_, lengths_+lanes, IT(0) );
+
+   for( size_t p=0UL; p<m; ++p ) {
+      rows_[p] = order[p];
+      lengths_[p] = lengths[order[p]];
+      positions_[order[p]] = p;
+   }
+
+   offsets_[0UL] = 0UL;
+   for( size_t c=0UL; c<chunks; ++c ) {
+      const IT* const first( lengths_ + c*chunkSize );
+      offsets_[c+1UL] = offsets_[c] + size_t( *std::max_element( first, first+chunkSize ) ) * chunkSize;
+   }
+
+   const size_t elements( offsets_[chunks] + chunkSize );
+
+   values_  = allocate<Type>( elements );
+   indices_ = allocate<IT>( elements );
+
+   std::fill( values_, values_+elements, Type() );
+   std::fill( indices_, indices_+elements, IT(0) );
+
+   m_      = m;
+   n_      = n;
+   chunks_ = chunks;
+
+   for( size_t i=0UL; i<m; ++i )
+   {
+      size_t pos( base( i ) );
+
+      for( auto element=(~sm).begin(i); element!=(~sm).end(i); ++element ) {
+         values_ [pos] = element->value();
+         indices_[pos] = element->index();
+         pos += chunkSize;
+      }
+
+      BLAZE_INTERNAL_ASSERT( pos == base( i ) + lengths[i]*chunkSize, "Invalid number of non-zero elements" );
+      nonzeros_ += lengths[i];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( i ) && pos->index() == j )
+      return pos;
+   else return end( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// Since the column indices of each row are stored in ascending order, the search is performed
+// by means of a binary search over the interleaved index array.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( base( i ) );
+   const IT* const indices( indices_ + pos );
+
+   size_t first( 0UL );
+   size_t last ( lengths_[positions_[i]] );
+
+   while( first < last ) {
+      const size_t mid( first + ( last - first ) / 2UL );
+      if( indices[mid*chunkSize] < j ) first = mid + 1UL;
+      else last = mid;
+   }
+
+   return ConstIterator( values_+pos+first*chunkSize, indices+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline typename SlicedEllpackMatrix<Type,IT>::ConstIterator
+   SlicedEllpackMatrix<Type,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( i < rows(), "Invalid row access index" );
+
+   const size_t pos( base( i ) );
+   const IT* const indices( indices_ + pos );
+
+   size_t first( 0UL );
+   size_t last ( lengths_[positions_[i]] );
+
+   while( first < last ) {
+      const size_t mid( first + ( last - first ) / 2UL );
+      if( indices[mid*chunkSize] <= j ) first = mid + 1UL;
+      else last = mid;
+   }
+
+   return ConstIterator( values_+pos+first*chunkSize, indices+first*chunkSize );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SlicedEllpackMatrix<Type,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. Since the matrix
+// cannot be the target of an assignment, this function always returns \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline bool SlicedEllpackMatrix<Type,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SLICEDELLPACKMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SlicedEllpackMatrix operators */
+//@{
+template< typename Type, typename IT >
+inline void clear( SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline bool isIntact( const SlicedEllpackMatrix<Type,IT>& m );
+
+template< typename Type, typename IT >
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given sliced ELLPACK matrix.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline void clear( SlicedEllpackMatrix<Type,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given sliced ELLPACK matrix are intact.
+// \ingroup sliced_ellpack_matrix
+//
+// \param m The sliced ELLPACK matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false if not.
+//
+// This function checks whether the invariants of the sliced ELLPACK matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else it
+// will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline bool isIntact( const SlicedEllpackMatrix<Type,IT>& m )
+{
+   constexpr size_t C( SlicedEllpackMatrix<Type,IT>::chunkSize );
+
+   if( m.chunks() != ( m.rows() + C - 1UL ) / C || m.nonZeros() > m.capacity() )
+      return false;
+
+   for( size_t c=0UL; c<m.chunks(); ++c ) {
+      if( m.offset(c+1UL) < m.offset(c) || ( m.offset(c+1UL) - m.offset(c) ) % C != 0UL )
+         return false;
+      for( size_t l=0UL; l<C; ++l ) {
+         if( m.rowLengths()[c*C+l] > m.width(c) )
+            return false;
+      }
+   }
+
+   for( size_t i=0UL; i<m.rows(); ++i ) {
+      if( m.nonZeros(i) > m.capacity(i) || m.nonZeros(i) > m.columns() )
+         return false;
+   }
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two sliced ELLPACK matrices.
+// \ingroup sliced_ellpack_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , typename IT >  // Type of the indices
+inline void swap( SlicedEllpackMatrix<Type,IT>& a, SlicedEllpackMatrix<Type,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSLICEDELLPACK SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, typename IT >
+struct IsSlicedEllpack< SlicedEllpackMatrix<T,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,3409 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoACompressedMatrix.h
+//  \brief Implementation of a compressed MxN matrix with structure-of-arrays storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOACOMPRESSEDMATRIX_H_
+#define _BLAZE_MATH_SPARSE_SOACOMPRESSEDMATRIX_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/SparseMatrix.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/MatrixAccessProxy.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSoACompressed.h>
+#include <blaze/math/typetraits/IsStrictlyLower.h>
+#include <blaze/math/typetraits/IsStrictlyUpper.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/StorageOrder.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Size.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup soa_compressed_matrix SoACompressedMatrix
+// \ingroup sparse_matrix
+*/
+/*!\brief Efficient implementation of a \f$ M \times N \f$ compressed matrix with structure-of-arrays
+//        storage.
+// \ingroup soa_compressed_matrix
+//
+// The SoACompressedMatrix class template is the representation of an arbitrary sized sparse
+// matrix in compressed row (CSR) or compressed column (CSC) format. In contrast to the
+// CompressedMatrix class template, which stores each non-zero element as a value-index-pair,
+// SoACompressedMatrix stores the values and the indices of all non-zero elements in two separate
+// arrays. Additionally, the type of the stored indices can be selected. The type of the elements,
+// the storage order of the matrix, and the type of the indices can be specified via the three
+// template parameters:
+
+   \code
+   template< typename Type, bool SO, typename IT >
+   class SoACompressedMatrix;
+   \endcode
+
+//  - Type: specifies the type of the matrix elements. SoACompressedMatrix can be used with
+//          any non-cv-qualified, non-reference, non-pointer element type.
+//  - SO  : specifies the storage order (blaze::rowMajor, blaze::columnMajor) of the matrix.
+//          The default value is blaze::rowMajor.
+//  - IT  : specifies the type of the stored column (in case of a row-major matrix) or row (in
+//          case of a column-major matrix) indices. IT must be a 32-bit or 64-bit unsigned
+//          integral type (i.e. \c uint32_t or \c uint64_t). The default value is \c uint32_t.
+//
+// Since sparse matrix/vector products are limited by the available memory bandwidth, the
+// separate storage reduces the memory traffic considerably: Whereas a CompressedMatrix requires
+// 16 bytes per non-zero element for both \c float and \c double elements, a row-major
+// SoACompressedMatrix with 32-bit indices requires only 12 bytes per \c double and 8 bytes per
+// \c float element. Additionally, the contiguous values and indices enable a vectorization of
+// the sparse matrix/dense vector multiplication via SIMD gather instructions. Note however that
+// the number of columns (in case of a row-major matrix) or rows (in case of a column-major
+// matrix) is limited by the range of the index type. In case the according dimension exceeds
+// the range of the index type, a \a std::invalid_argument exception is thrown.
+//
+// SoACompressedMatrix provides the same interface as CompressedMatrix, including the efficient
+// setup via the reserve(), append(), and finalize() functions:
+
+   \code
+   using blaze::SoACompressedMatrix;
+   using blaze::rowMajor;
+
+   SoACompressedMatrix<double,rowMajor,uint32_t> A( 4, 3 );
+   A.reserve( 3 );       // Reserving enough space for 3 non-zero elements
+   A.append( 0, 1, 1 );  // Appending the value 1 in row 0 with column index 1
+   A.finalize( 0 );      // Finalizing row 0
+   A.append( 1, 1, 2 );  // Appending the value 2 in row 1 with column index 1
+   A.finalize( 1 );      // Finalizing row 1
+   A.append( 2, 0, 3 );  // Appending the value 3 in row 2 with column index 0
+   A.finalize( 2 );      // Finalizing row 2
+
+   // Traversing the non-zero elements of the 2nd row
+   for( auto it=A.begin(1); it!=A.end(1); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+
+// SoACompressedMatrix can be used in all operations that are supported for sparse matrices,
+// in arbitrary combinations with dense and sparse vectors and matrices.
+*/
+template< typename Type                     // Data type of the matrix
+        , bool SO = defaultStorageOrder     // Storage order
+        , typename IT = uint32_t >          // Type of the indices
+class SoACompressedMatrix
+   : public SparseMatrix< SoACompressedMatrix<Type,SO,IT>, SO >
+{
+ private:
+   //**Private class Uninitialized*****************************************************************
+   /*!\brief Definition of the nested auxiliary struct Uninitialized.
+   */
+   struct Uninitialized {};
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SoACompressedMatrix<Type,SO,IT>;   //!< Type of this SoACompressedMatrix instance.
+   using BaseType       = SparseMatrix<This,SO>;             //!< Base type of this SoACompressedMatrix instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using OppositeType   = SoACompressedMatrix<Type,!SO,IT>;  //!< Result type with opposite storage order for expression template evaluations.
+   using TransposeType  = SoACompressedMatrix<Type,!SO,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the compressed matrix elements.
+   using IndexType      = IT;                                //!< Type of the stored indices.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const This&;                       //!< Data type for composite expression templates.
+   using Reference      = MatrixAccessProxy<This>;           //!< Reference to a compressed matrix value.
+   using ConstReference = const Type&;                       //!< Reference to a constant compressed matrix value.
+   using Iterator       = SoAIterator<Type,IT>;              //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,IT>;        //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SoACompressedMatrix with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other matrix
+   struct Rebind {
+      using Other = SoACompressedMatrix<NewType,SO,IT>;  //!< The type of the other SoACompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SoACompressedMatrix with different fixed dimensions.
+   */
+   template< size_t NewM    // Number of rows of the other matrix
+           , size_t NewN >  // Number of columns of the other matrix
+   struct Resize {
+      using Other = SoACompressedMatrix<Type,SO,IT>;  //!< The type of the other SoACompressedMatrix.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The \a smpAssignable compilation flag indicates whether the matrix can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SoACompressedMatrix();
+   explicit inline SoACompressedMatrix( size_t m, size_t n );
+   explicit inline SoACompressedMatrix( size_t m, size_t n, size_t nonzeros );
+   explicit        SoACompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros );
+   explicit inline SoACompressedMatrix( initializer_list< initializer_list<Type> > list );
+
+   inline SoACompressedMatrix( const SoACompressedMatrix& sm );
+   inline SoACompressedMatrix( SoACompressedMatrix&& sm ) noexcept;
+
+   template< typename MT, bool SO2 > inline SoACompressedMatrix( const DenseMatrix<MT,SO2>&  dm );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix( const SparseMatrix<MT,SO2>& sm );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SoACompressedMatrix();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator()( size_t i, size_t j ) noexcept;
+   inline ConstReference operator()( size_t i, size_t j ) const noexcept;
+   inline Reference      at( size_t i, size_t j );
+   inline ConstReference at( size_t i, size_t j ) const;
+   inline Iterator       begin ( size_t i ) noexcept;
+   inline ConstIterator  begin ( size_t i ) const noexcept;
+   inline ConstIterator  cbegin( size_t i ) const noexcept;
+   inline Iterator       end   ( size_t i ) noexcept;
+   inline ConstIterator  end   ( size_t i ) const noexcept;
+   inline ConstIterator  cend  ( size_t i ) const noexcept;
+   inline Type*          values ( size_t i ) noexcept;
+   inline const Type*    values ( size_t i ) const noexcept;
+   inline const IT*      indices( size_t i ) const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SoACompressedMatrix& operator=( initializer_list< initializer_list<Type> > list );
+   inline SoACompressedMatrix& operator=( const SoACompressedMatrix& rhs );
+   inline SoACompressedMatrix& operator=( SoACompressedMatrix&& rhs ) noexcept;
+
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator= ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator= ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator+=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator-=( const Matrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator%=( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline SoACompressedMatrix& operator%=( const SparseMatrix<MT,SO2>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t rows() const noexcept;
+   inline size_t columns() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t capacity( size_t i ) const noexcept;
+   inline size_t nonZeros() const;
+   inline size_t nonZeros( size_t i ) const;
+   inline void   reset();
+   inline void   reset( size_t i );
+   inline void   clear();
+          void   resize ( size_t m, size_t n, bool preserve=true );
+   inline void   reserve( size_t nonzeros );
+          void   reserve( size_t i, size_t nonzeros );
+          void   restructure( const size_t* nonzeros );
+   inline void   trim   ();
+   inline void   trim   ( size_t i );
+   inline void   shrinkToFit();
+   inline void   swap( SoACompressedMatrix& sm ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set     ( size_t i, size_t j, const Type& value );
+   inline Iterator insert  ( size_t i, size_t j, const Type& value );
+   inline void     append  ( size_t i, size_t j, const Type& value, bool check=false );
+   inline void     finalize( size_t i );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t i, size_t j );
+   inline Iterator erase( size_t i, Iterator pos );
+   inline Iterator erase( size_t i, Iterator first, Iterator last );
+
+   template< typename Pred >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( size_t i, Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t i, size_t j );
+   inline ConstIterator find      ( size_t i, size_t j ) const;
+   inline Iterator      lowerBound( size_t i, size_t j );
+   inline ConstIterator lowerBound( size_t i, size_t j ) const;
+   inline Iterator      upperBound( size_t i, size_t j );
+   inline ConstIterator upperBound( size_t i, size_t j ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   inline SoACompressedMatrix& transpose();
+   inline SoACompressedMatrix& ctranspose();
+
+   template< typename Other > inline SoACompressedMatrix& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename MT, bool SO2 > inline void assign     ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,SO>&  rhs );
+   template< typename MT >           inline void assign     ( const SparseMatrix<MT,!SO>& rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void addAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const DenseMatrix<MT,SO2>&  rhs );
+   template< typename MT, bool SO2 > inline void subAssign  ( const SparseMatrix<MT,SO2>& rhs );
+   template< typename MT, bool SO2 > inline void schurAssign( const DenseMatrix<MT,SO2>&  rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SoACompressedMatrix( size_t m, size_t n, Uninitialized );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void checkDimensions( size_t m, size_t n );
+
+   inline size_t lines() const noexcept;
+   inline size_t extendCapacity() const noexcept;
+          void   reserveElements( size_t nonzeros );
+   inline size_t offset( ConstIterator pos ) const noexcept;
+   inline size_t transferElements( size_t first, size_t last,
+                                   Type* newValues, IT* newIndices, size_t dest );
+   inline void   moveElements( size_t first, size_t last, size_t dest );
+   inline void   moveElementsBackward( size_t first, size_t last, size_t dest );
+   inline void   appendElements( initializer_list< initializer_list<Type> > list );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( Iterator pos, size_t i, size_t j, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t  m_;         //!< The current number of rows of the compressed matrix.
+   size_t  n_;         //!< The current number of columns of the compressed matrix.
+   size_t  capacity_;  //!< The current capacity of the offset arrays.
+   size_t* begin_;     //!< Offsets of the first non-zero element of each row/column.
+   size_t* end_;       //!< Offsets one past the last non-zero element of each row/column.
+   Type*   values_;    //!< The values of all non-zero elements.
+   IT*     indices_;   //!< The column/row indices of all non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 1UL );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 2UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool SO, typename IT >
+const Type SoACompressedMatrix<Type,SO,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SoACompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix()
+   : m_       ( 0UL )      // The current number of rows of the compressed matrix
+   , n_       ( 0UL )      // The current number of columns of the compressed matrix
+   , capacity_( 0UL )      // The current capacity of the offset arrays
+   , begin_   ( nullptr )  // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )  // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )  // The values of all non-zero elements
+   , indices_ ( nullptr )  // The column/row indices of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is initialized to the zero matrix and has no free capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( size_t m, size_t n )
+   : SoACompressedMatrix( m, n, Uninitialized() )
+{
+   for( size_t i=0UL; i<2UL*capacity_+2UL; ++i )
+      begin_[i] = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is initialized to the zero matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( size_t m, size_t n, size_t nonzeros )
+   : SoACompressedMatrix( m, n, Uninitialized() )
+{
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   for( size_t i=0UL; i<2UL*capacity_+1UL; ++i )
+      begin_[i] = 0UL;
+   end_[capacity_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param nonzeros The expected number of non-zero elements in each row/column.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is initialized to the zero matrix and will have the specified capacity in each
+// row/column. Note that in case of a row-major matrix the given vector must have at least
+// \a m elements, in case of a column-major matrix at least \a n elements.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( size_t m, size_t n, const std::vector<size_t>& nonzeros )
+   : SoACompressedMatrix( m, n, Uninitialized() )
+{
+   BLAZE_USER_ASSERT( nonzeros.size() == capacity_, "Size of capacity vector and number of rows/columns don't match" );
+
+   size_t newCapacity( 0UL );
+   for( std::vector<size_t>::const_iterator it=nonzeros.begin(); it!=nonzeros.end(); ++it )
+      newCapacity += *it;
+
+   values_  = allocate<Type>( newCapacity );
+   indices_ = allocate<IT>( newCapacity );
+
+   begin_[0UL] = end_[0UL] = 0UL;
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      begin_[i+1UL] = end_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This constructor provides the option to explicitly initialize the elements of the matrix by
+// means of an initializer list:
+
+   \code
+   blaze::SoACompressedMatrix<int> A{ { 1, 2, 3 },
+                                      { 4, 5 },
+                                      { 7, 8, 9 } };
+   \endcode
+
+// The matrix is sized according to the size of the initializer list and all its elements are
+// initialized by the values of the given initializer list. Missing values are considered to
+// be default values.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( initializer_list< initializer_list<Type> > list )
+   : SoACompressedMatrix( list.size(), determineColumns( list ), blaze::nonZeros( list ) )
+{
+   appendElements( list );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SoACompressedMatrix.
+//
+// \param sm Compressed matrix to be copied.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( const SoACompressedMatrix& sm )
+   : SoACompressedMatrix( sm.m_, sm.n_, Uninitialized() )
+{
+   const size_t nonzeros( sm.nonZeros() );
+
+   values_  = allocate<Type>( nonzeros );
+   indices_ = allocate<IT>( nonzeros );
+
+   begin_[0UL] = 0UL;
+   for( size_t i=0UL; i<capacity_; ++i ) {
+      end_[i] = std::copy( sm.values_+sm.begin_[i], sm.values_+sm.end_[i], values_+begin_[i] ) - values_;
+      std::copy( sm.indices_+sm.begin_[i], sm.indices_+sm.end_[i], indices_+begin_[i] );
+      begin_[i+1UL] = end_[i];
+   }
+   end_[capacity_] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SoACompressedMatrix.
+//
+// \param sm The compressed matrix to be moved into this instance.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( SoACompressedMatrix&& sm ) noexcept
+   : m_       ( sm.m_ )         // The current number of rows of the compressed matrix
+   , n_       ( sm.n_ )         // The current number of columns of the compressed matrix
+   , capacity_( sm.capacity_ )  // The current capacity of the offset arrays
+   , begin_   ( sm.begin_ )     // Offsets of the first non-zero element of each row/column
+   , end_     ( sm.end_ )       // Offsets one past the last non-zero element of each row/column
+   , values_  ( sm.values_ )    // The values of all non-zero elements
+   , indices_ ( sm.indices_ )   // The column/row indices of all non-zero elements
+{
+   sm.m_        = 0UL;
+   sm.n_        = 0UL;
+   sm.capacity_ = 0UL;
+   sm.begin_    = nullptr;
+   sm.end_      = nullptr;
+   sm.values_   = nullptr;
+   sm.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense matrices.
+//
+// \param dm Dense matrix to be copied.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the foreign dense matrix
+        , bool SO2 >        // Storage order of the foreign dense matrix
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( const DenseMatrix<MT,SO2>& dm )
+   : SoACompressedMatrix( (~dm).rows(), (~dm).columns() )
+{
+   using blaze::assign;
+
+   smpAssign( *this, ~dm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse matrices.
+//
+// \param sm Sparse matrix to be copied.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the foreign sparse matrix
+        , bool SO2 >        // Storage order of the foreign sparse matrix
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( const SparseMatrix<MT,SO2>& sm )
+   : SoACompressedMatrix( (~sm).rows(), (~sm).columns(), (~sm).nonZeros() )
+{
+   using blaze::assign;
+
+   smpAssign( *this, ~sm );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary constructor for SoACompressedMatrix.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This auxiliary constructor checks the given dimensions and allocates the offset arrays.
+// The offsets as well as the value and index arrays are left uninitialized.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::SoACompressedMatrix( size_t m, size_t n, Uninitialized )
+   : m_       ( m )                   // The current number of rows of the compressed matrix
+   , n_       ( n )                   // The current number of columns of the compressed matrix
+   , capacity_( SO ? n : m )          // The current capacity of the offset arrays
+   , begin_   ( nullptr )             // Offsets of the first non-zero element of each row/column
+   , end_     ( nullptr )             // Offsets one past the last non-zero element of each row/column
+   , values_  ( nullptr )             // The values of all non-zero elements
+   , indices_ ( nullptr )             // The column/row indices of all non-zero elements
+{
+   checkDimensions( m, n );
+
+   begin_ = new size_t[2UL*capacity_+2UL];
+   end_   = begin_+capacity_+1UL;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SoACompressedMatrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>::~SoACompressedMatrix()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position (\a i,\a j). In case
+// the compressed matrix does not yet store an element at position (\a i,\a j) , a new element
+// is inserted into the compressed matrix. Note that this function only performs an index check
+// in case BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform
+// a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Reference
+   SoACompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   return Reference( *this, i, j );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief 2D-access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstReference
+   SoACompressedMatrix<Type,SO,IT>::operator()( size_t i, size_t j ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const ConstIterator pos( lowerBound( i, j ) );
+
+   if( pos == end( SO ? j : i ) || pos->index() != ( SO ? i : j ) )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Reference
+   SoACompressedMatrix<Type,SO,IT>::at( size_t i, size_t j )
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed matrix elements.
+//
+// \param i Access index for the row. The index has to be in the range \f$[0..M-1]\f$.
+// \param j Access index for the column. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid matrix access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access indices.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstReference
+   SoACompressedMatrix<Type,SO,IT>::at( size_t i, size_t j ) const
+{
+   if( i >= m_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid row access index" );
+   }
+   if( j >= n_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid column access index" );
+   }
+   return (*this)(i,j);
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::begin( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return Iterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::begin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator to the first non-zero element of row/column \a i.
+//
+// This function returns a row/column iterator to the first non-zero element of row/column \a i.
+// In case the storage order is set to \a rowMajor the function returns an iterator to the first
+// non-zero element of row \a i, in case the storage flag is set to \a columnMajor the function
+// returns an iterator to the first non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::cbegin( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+begin_[i], indices_+begin_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::end( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return Iterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::end( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of row/column \a i.
+//
+// \param i The row/column index.
+// \return Iterator just past the last non-zero element of row/column \a i.
+//
+// This function returns an row/column iterator just past the last non-zero element of row/column
+// \a i. In case the storage order is set to \a rowMajor the function returns an iterator just
+// past the last non-zero element of row \a i, in case the storage flag is set to \a columnMajor
+// the function returns an iterator just past the last non-zero element of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::cend( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return ConstIterator( values_+end_[i], indices_+end_[i] );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguous values of the non-zero elements of row
+// \a i (in case of a row-major matrix) or column \a i (in case of a column-major matrix). The
+// number of values is given by the nonZeros() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline Type* SoACompressedMatrix<Type,SO,IT>::values( size_t i ) noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return values_+begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the value of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguous values of the non-zero elements of row
+// \a i (in case of a row-major matrix) or column \a i (in case of a column-major matrix). The
+// number of values is given by the nonZeros() function.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline const Type* SoACompressedMatrix<Type,SO,IT>::values( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return values_+begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the indices of the non-zero elements of row/column \a i.
+//
+// \param i The row/column index.
+// \return Pointer to the index of the first non-zero element of row/column \a i.
+//
+// This function returns a pointer to the contiguous column indices (in case of a row-major
+// matrix) or row indices (in case of a column-major matrix) of the non-zero elements of row/
+// column \a i. The number of indices is given by the nonZeros() function. Since the indices
+// determine the structure of the matrix, only read access is provided.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline const IT* SoACompressedMatrix<Type,SO,IT>::indices( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid compressed matrix row/column access index" );
+   return indices_+begin_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all matrix elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the matrix
+// by means of an initializer list. The matrix is resized according to the given initializer
+// list and all its elements are assigned the values from the given initializer list. Missing
+// values are considered to be default values.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator=( initializer_list< initializer_list<Type> > list )
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), determineColumns( list ), false );
+   reset();
+   reserve( nonZeros( list ) );
+   appendElements( list );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SoACompressedMatrix.
+//
+// \param rhs Compressed matrix to be copied.
+// \return Reference to the assigned compressed matrix.
+//
+// The compressed matrix is resized according to the given compressed matrix and initialized
+// as a copy of this matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator=( const SoACompressedMatrix& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   const size_t nonzeros( rhs.nonZeros() );
+   const size_t n( rhs.lines() );
+
+   if( n > capacity_ || nonzeros > capacity() )
+   {
+      SoACompressedMatrix tmp( rhs );
+      swap( tmp );
+   }
+   else
+   {
+      const size_t total( capacity() );
+
+      begin_[0UL] = 0UL;
+      for( size_t i=0UL; i<n; ++i ) {
+         end_[i] = std::copy( rhs.values_+rhs.begin_[i], rhs.values_+rhs.end_[i], values_+begin_[i] ) - values_;
+         std::copy( rhs.indices_+rhs.begin_[i], rhs.indices_+rhs.end_[i], indices_+begin_[i] );
+         begin_[i+1UL] = end_[i];
+      }
+      end_[n] = total;
+
+      m_ = rhs.m_;
+      n_ = rhs.n_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SoACompressedMatrix.
+//
+// \param rhs The matrix to be moved into this instance.
+// \return Reference to the assigned matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator=( SoACompressedMatrix&& rhs ) noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+   delete[] begin_;
+
+   m_        = rhs.m_;
+   n_        = rhs.n_;
+   capacity_ = rhs.capacity_;
+   begin_    = rhs.begin_;
+   end_      = rhs.end_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.m_        = 0UL;
+   rhs.n_        = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.begin_    = nullptr;
+   rhs.end_      = nullptr;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense matrices.
+//
+// \param rhs Dense matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ) {
+      SoACompressedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse matrices.
+//
+// \param rhs Sparse matrix to be copied.
+// \return Reference to the assigned matrix.
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// The matrix is resized according to the given \f$ M \times N \f$ matrix and initialized as a
+// copy of this matrix.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator=( const SparseMatrix<MT,SO2>& rhs )
+{
+   using blaze::assign;
+
+   if( (~rhs).canAlias( this ) ||
+       ( SO ? (~rhs).columns() : (~rhs).rows() ) > capacity_ ||
+       (~rhs).nonZeros() > capacity() ) {
+      SoACompressedMatrix tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      resize( (~rhs).rows(), (~rhs).columns(), false );
+      reset();
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a matrix (\f$ A+=B \f$).
+//
+// \param rhs The right-hand side matrix to be added to the compressed matrix.
+// \return Reference to the compressed matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator+=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::addAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   smpAddAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a matrix (\f$ A-=B \f$).
+//
+// \param rhs The right-hand side matrix to be subtracted from the compressed matrix.
+// \return Reference to the compressed matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side matrix
+        , bool SO2 >        // Storage order of the right-hand side matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator-=( const Matrix<MT,SO2>& rhs )
+{
+   using blaze::subAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   smpSubAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a dense matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return Reference to the compressed matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator%=( const DenseMatrix<MT,SO2>& rhs )
+{
+   using blaze::schurAssign;
+
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   smpSchurAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Schur product assignment operator for the multiplication of a sparse matrix
+//        (\f$ A\circ=B \f$).
+//
+// \param rhs The right-hand side sparse matrix for the Schur product.
+// \return Reference to the compressed matrix.
+// \exception std::invalid_argument Matrix sizes do not match.
+//
+// In case the current sizes of the two matrices don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline SoACompressedMatrix<Type,SO,IT>&
+   SoACompressedMatrix<Type,SO,IT>::operator%=( const SparseMatrix<MT,SO2>& rhs )
+{
+   if( (~rhs).rows() != m_ || (~rhs).columns() != n_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix sizes do not match" );
+   }
+
+   SoACompressedMatrix tmp( (*this) % (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current number of rows of the compressed matrix.
+//
+// \return The number of rows of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::rows() const noexcept
+{
+   return m_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current number of columns of the compressed matrix.
+//
+// \return The number of columns of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::columns() const noexcept
+{
+   return n_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed matrix.
+//
+// \return The capacity of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::capacity() const noexcept
+{
+   if( begin_ != nullptr )
+      return end_[lines()];
+   else return 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the current capacity of the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The current capacity of row/column \a i.
+//
+// This function returns the current capacity of the specified row/column. In case the
+// storage order is set to \a rowMajor the function returns the capacity of row \a i,
+// in case the storage flag is set to \a columnMajor the function returns the capacity
+// of column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::capacity( size_t i ) const noexcept
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return begin_[i+1UL] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the total number of non-zero elements in the compressed matrix
+//
+// \return The number of non-zero elements in the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::nonZeros() const
+{
+   size_t nonzeros( 0UL );
+
+   for( size_t i=0UL; i<lines(); ++i )
+      nonzeros += nonZeros( i );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the specified row/column.
+//
+// \param i The index of the row/column.
+// \return The number of non-zero elements of row/column \a i.
+//
+// This function returns the current number of non-zero elements in the specified row/column.
+// In case the storage order is set to \a rowMajor the function returns the number of non-zero
+// elements in row \a i, in case the storage flag is set to \a columnMajor the function returns
+// the number of non-zero elements in column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::nonZeros( size_t i ) const
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   return end_[i] - begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::reset()
+{
+   for( size_t i=0UL; i<lines(); ++i )
+      end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column to the default initial values.
+//
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column to their default value. In case
+// the storage order is set to \a rowMajor the function resets the values in row \a i, in case
+// the storage order is set to \a columnMajor the function resets the values in column \a i.
+// Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::reset( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+   end_[i] = begin_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed matrix.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed matrix is 0.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::clear()
+{
+   if( end_ != nullptr )
+      end_[0UL] = end_[lines()];
+   m_ = 0UL;
+   n_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed matrix.
+//
+// \param m The new number of rows of the compressed matrix.
+// \param n The new number of columns of the compressed matrix.
+// \param preserve \a true if the old values of the matrix should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This function resizes the matrix using the given size to \f$ m \times n \f$. During this
+// operation, new dynamic memory may be allocated in case the capacity of the matrix is too
+// small. Note that this function may invalidate all existing views (submatrices, rows, columns,
+// ...) on the matrix if it is used to shrink the matrix. Additionally, the resize operation
+// potentially changes all matrix elements. In order to preserve the old matrix values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+void SoACompressedMatrix<Type,SO,IT>::resize( size_t m, size_t n, bool preserve )
+{
+   using std::swap;
+
+   if( m == m_ && n == n_ ) return;
+
+   checkDimensions( m, n );
+
+   const size_t oldLines( lines() );
+   const size_t newLines( SO ? n : m );
+   const size_t oldSize ( SO ? m_ : n_ );
+   const size_t newSize ( SO ? m : n );
+
+   if( begin_ == nullptr )
+   {
+      begin_ = new size_t[2UL*newLines+2UL];
+      end_   = begin_+newLines+1UL;
+
+      for( size_t i=0UL; i<2UL*newLines+2UL; ++i ) {
+         begin_[i] = 0UL;
+      }
+
+      capacity_ = newLines;
+   }
+   else if( newLines > capacity_ )
+   {
+      size_t* newBegin( new size_t[2UL*newLines+2UL] );
+      size_t* newEnd  ( newBegin+newLines+1UL );
+
+      newBegin[0UL] = 0UL;
+
+      if( preserve ) {
+         for( size_t i=0UL; i<oldLines; ++i ) {
+            newEnd  [i    ] = end_  [i    ];
+            newBegin[i+1UL] = begin_[i+1UL];
+         }
+         for( size_t i=oldLines; i<newLines; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = begin_[oldLines];
+         }
+      }
+      else {
+         for( size_t i=0UL; i<newLines; ++i ) {
+            newBegin[i+1UL] = newEnd[i] = 0UL;
+         }
+      }
+
+      newEnd[newLines] = end_[oldLines];
+
+      swap( newBegin, begin_ );
+      delete[] newBegin;
+      end_ = newEnd;
+      capacity_ = newLines;
+   }
+   else if( newLines > oldLines )
+   {
+      end_[newLines] = end_[oldLines];
+
+      if( !preserve ) {
+         for( size_t i=0UL; i<oldLines; ++i )
+            end_[i] = begin_[i];
+      }
+
+      for( size_t i=oldLines; i<newLines; ++i ) {
+         begin_[i+1UL] = end_[i] = begin_[oldLines];
+      }
+   }
+   else
+   {
+      if( !preserve ) {
+         for( size_t i=0UL; i<newLines; ++i )
+            end_[i] = begin_[i];
+      }
+
+      end_[newLines] = end_[oldLines];
+   }
+
+   if( preserve && newSize < oldSize ) {
+      for( size_t i=0UL; i<min( oldLines, newLines ); ++i ) {
+         end_[i] = std::lower_bound( indices_+begin_[i], indices_+end_[i], newSize ) - indices_;
+      }
+   }
+
+   m_ = m;
+   n_ = n;
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed matrix.
+//
+// \param nonzeros The new minimum capacity of the compressed matrix.
+// \return void
+//
+// This function increases the capacity of the compressed matrix to at least \a nonzeros elements.
+// The current values of the matrix elements and the individual capacities of the matrix rows/
+// columns are preserved.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::reserve( size_t nonzeros )
+{
+   if( nonzeros > capacity() )
+      reserveElements( nonzeros );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of a specific row/column of the compressed matrix.
+//
+// \param i The row/column index \f$[0..M-1]\f$ or \f$[0..N-1]\f$.
+// \param nonzeros The new minimum capacity of the specified row/column.
+// \return void
+//
+// This function increases the capacity of row/column \a i of the compressed matrix to at least
+// \a nonzeros elements. The current values of the compressed matrix and all other individual
+// row/column capacities are preserved. In case the storage order is set to \a rowMajor, the
+// function reserves capacity for row \a i and the index has to be in the range \f$[0..M-1]\f$.
+// In case the storage order is set to \a columnMajor, the function reserves capacity for column
+// \a i and the index has to be in the range \f$[0..N-1]\f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+void SoACompressedMatrix<Type,SO,IT>::reserve( size_t i, size_t nonzeros )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   const size_t n( lines() );
+   const size_t current( capacity(i) );
+
+   if( current >= nonzeros ) return;
+
+   const size_t additional( nonzeros - current );
+
+   if( end_[n] - begin_[n] < additional )
+   {
+      const size_t newCapacity( begin_[n] + additional );
+      BLAZE_INTERNAL_ASSERT( newCapacity > capacity(), "Invalid capacity value" );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      size_t* newBegin( new size_t[2UL*n+2UL] );
+      size_t* newEnd  ( newBegin+n+1UL );
+
+      newBegin[0UL] = 0UL;
+      newEnd  [n  ] = newCapacity;
+
+      for( size_t k=0UL; k<n; ++k ) {
+         newEnd  [k    ] = transferElements( begin_[k], end_[k], newValues, newIndices, newBegin[k] );
+         newBegin[k+1UL] = newBegin[k] + ( k == i ? nonzeros : capacity(k) );
+      }
+
+      BLAZE_INTERNAL_ASSERT( newBegin[n] == newEnd[n], "Invalid offset calculations" );
+
+      std::swap( newBegin, begin_ );
+      delete[] newBegin;
+      end_ = newEnd;
+      capacity_ = n;
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+   else
+   {
+      begin_[n] += additional;
+      for( size_t k=n-1UL; k>i; --k ) {
+         moveElementsBackward( begin_[k], end_[k], end_[k]+additional );
+         begin_[k] += additional;
+         end_  [k] += additional;
+      }
+   }
+
+   BLAZE_INTERNAL_ASSERT( end_ >= begin_, "Invalid internal storage detected" );
+   BLAZE_INTERNAL_ASSERT( static_cast<size_t>( end_ - begin_ ) == capacity_ + 1UL, "Invalid storage setting detected" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the matrix and setting the capacity of all rows/columns.
+//
+// \param nonzeros The new capacities of all rows/columns.
+// \return void
+//
+// This function resets all elements of the matrix and redistributes the internal storage such
+// that row/column \a i provides a capacity of exactly \a nonzeros[i] elements. In case the
+// storage order is set to \a rowMajor, the given array has to contain \f$ M \f$ capacities, in
+// case the storage order is set to \a columnMajor, it has to contain \f$ N \f$ capacities. In
+// case the total capacity exceeds the current capacity of the matrix, new value and index arrays
+// are allocated. Since the rows/columns don't share any storage afterwards, the subsequent
+// append() calls for different rows/columns can be performed concurrently. Note that in this
+// case no call to finalize() is required.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+void SoACompressedMatrix<Type,SO,IT>::restructure( const size_t* nonzeros )
+{
+   const size_t n( lines() );
+
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      total += nonzeros[i];
+   }
+
+   if( total > capacity() ) {
+      Type* newValues ( allocate<Type>( total ) );
+      IT*   newIndices( allocate<IT>( total ) );
+      deallocate( values_ );
+      deallocate( indices_ );
+      values_  = newValues;
+      indices_ = newIndices;
+      end_[n] = total;
+   }
+
+   for( size_t i=0UL; i<n; ++i ) {
+      end_  [i    ] = begin_[i];
+      begin_[i+1UL] = begin_[i] + nonzeros[i];
+   }
+
+   BLAZE_INTERNAL_ASSERT( begin_[n] <= end_[n], "Invalid offset calculations" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The trim() function can be used to reverse the effect of all row/column-specific reserve()
+// calls. The function removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::trim()
+{
+   for( size_t i=0UL; i<lines(); ++i )
+      trim( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity of a specific row/column of the compressed matrix.
+//
+// \param i The index of the row/column to be trimmed (\f$[0..M-1]\f$ or \f$[0..N-1]\f$).
+// \return void
+//
+// This function can be used to reverse the effect of a row/column-specific reserve() call.
+// It removes all excessive capacity from the specified row (in case of a rowMajor matrix)
+// or column (in case of a columnMajor matrix). The excessive capacity is assigned to the
+// subsequent row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::trim( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   if( i < ( lines() - 1UL ) ) {
+      const size_t nonzeros( nonZeros( i+1UL ) );
+      moveElements( begin_[i+1UL], end_[i+1UL], end_[i] );
+      end_[i+1UL] = end_[i] + nonzeros;
+   }
+   begin_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all excessive capacity from all rows/columns.
+//
+// \return void
+//
+// The shrinkToFit() function can be used to reverse the effect of all row/column-specific
+// reserve() calls. It removes all excessive capacity from all rows (in case of a rowMajor
+// matrix) or columns (in case of a columnMajor matrix). Note that this function does not
+// remove the overall capacity but only reduces the capacity per row/column.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::shrinkToFit()
+{
+   if( nonZeros() < capacity() ) {
+      SoACompressedMatrix( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+//
+// \param sm The compressed matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::swap( SoACompressedMatrix& sm ) noexcept
+{
+   std::swap( m_, sm.m_ );
+   std::swap( n_, sm.n_ );
+   std::swap( capacity_, sm.capacity_ );
+   std::swap( begin_, sm.begin_ );
+   std::swap( end_  , sm.end_ );
+   std::swap( values_, sm.values_ );
+   std::swap( indices_, sm.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the dimensions of a compressed matrix against the range of the index type.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::invalid_argument Matrix dimensions exceed the range of the index type.
+//
+// This function checks whether all column indices (in case of a row-major matrix) or all row
+// indices (in case of a column-major matrix) can be represented by the index type. In case
+// the according dimension exceeds the range of the index type, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::checkDimensions( size_t m, size_t n )
+{
+   const size_t size( SO ? m : n );
+
+   if( size != 0UL && size-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Matrix dimensions exceed the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of rows (row-major matrix) or columns (column-major matrix).
+//
+// \return The number of rows/columns of the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::lines() const noexcept
+{
+   return ( SO ? n_ : m_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new matrix capacity.
+//
+// \return The new compressed matrix capacity.
+//
+// This function calculates a new matrix capacity based on the current capacity of the sparse
+// matrix. Note that the new capacity is restricted to the interval \f$[7..M \cdot N]\f$.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity()+1UL );
+   nonzeros = max( nonzeros, 7UL );
+   nonzeros = max( min( nonzeros, m_*n_ ), capacity()+1UL );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity(), "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reserving the specified number of sparse matrix elements.
+//
+// \param nonzeros The number of matrix elements to be reserved.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+void SoACompressedMatrix<Type,SO,IT>::reserveElements( size_t nonzeros )
+{
+   const size_t n( lines() );
+
+   Type* newValues ( allocate<Type>( nonzeros ) );
+   IT*   newIndices( allocate<IT>( nonzeros ) );
+
+   size_t* newBegin( new size_t[2UL*capacity_+2UL] );
+   size_t* newEnd  ( newBegin+capacity_+1UL );
+
+   newBegin[0UL] = 0UL;
+
+   for( size_t k=0UL; k<n; ++k ) {
+      BLAZE_INTERNAL_ASSERT( begin_[k] <= end_[k], "Invalid row/column offsets" );
+      newEnd  [k    ] = transferElements( begin_[k], end_[k], newValues, newIndices, newBegin[k] );
+      newBegin[k+1UL] = newBegin[k] + ( begin_[k+1UL] - begin_[k] );
+   }
+   newEnd[n] = nonzeros;
+
+   std::swap( newBegin, begin_ );
+   delete[] newBegin;
+   end_ = begin_+capacity_+1UL;
+
+   std::swap( newValues, values_ );
+   std::swap( newIndices, indices_ );
+   deallocate( newValues );
+   deallocate( newIndices );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the offset of the element referenced by the given iterator.
+//
+// \param pos Iterator to an element of the compressed matrix.
+// \return The offset of the element within the value and index arrays.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::offset( ConstIterator pos ) const noexcept
+{
+   return pos - ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Transfers a range of elements into the given value and index arrays.
+//
+// \param first The offset of the first element to be transferred.
+// \param last The offset one past the last element to be transferred.
+// \param newValues The target value array.
+// \param newIndices The target index array.
+// \param dest The target offset.
+// \return The target offset one past the last transferred element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedMatrix<Type,SO,IT>::transferElements( size_t first, size_t last,
+                                                                 Type* newValues, IT* newIndices, size_t dest )
+{
+   transfer( values_+first, values_+last, newValues+dest );
+   std::copy( indices_+first, indices_+last, newIndices+dest );
+   return dest + ( last - first );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves a range of elements towards the front of the value and index arrays.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The target offset (\f$ dest \leq first \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::moveElements( size_t first, size_t last, size_t dest )
+{
+   BLAZE_INTERNAL_ASSERT( dest <= first, "Invalid target offset" );
+
+   std::move( values_+first, values_+last, values_+dest );
+   std::copy( indices_+first, indices_+last, indices_+dest );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves a range of elements towards the back of the value and index arrays.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The target offset one past the last moved element (\f$ dest \geq last \f$).
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::moveElementsBackward( size_t first, size_t last, size_t dest )
+{
+   BLAZE_INTERNAL_ASSERT( dest >= last, "Invalid target offset" );
+
+   std::move_backward( values_+first, values_+last, values_+dest );
+   std::copy_backward( indices_+first, indices_+last, indices_+dest );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending the non-default elements of the given initializer list.
+//
+// \param list The initializer list.
+// \return void
+//
+// This function appends all non-default elements of the given initializer list to the matrix.
+// The matrix is expected to be empty and to provide sufficient capacity.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::appendElements( initializer_list< initializer_list<Type> > list )
+{
+   if( SO )
+   {
+      for( size_t j=0UL; j<n_; ++j )
+      {
+         size_t i( 0UL );
+
+         for( const auto& rowList : list )
+         {
+            if( rowList.size() > j && !isDefault<strict>( rowList.begin()[j] ) ) {
+               append( i, j, rowList.begin()[j] );
+            }
+            ++i;
+         }
+
+         finalize( j );
+      }
+   }
+   else
+   {
+      size_t i( 0UL );
+
+      for( const auto& rowList : list )
+      {
+         size_t j( 0UL );
+
+         for( const Type& element : rowList ) {
+            if( !isDefault<strict>( element ) )
+               append( i, j, element );
+            ++j;
+         }
+
+         finalize( i );
+         ++i;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting elements of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Iterator to the set element.
+//
+// This function sets the value of an element of the compressed matrix. In case the compressed
+// matrix already contains an element with row index \a i and column index \a j its value is
+// modified, else a new element with the given \a value is inserted.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::set( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) ) {
+      pos->value() = value;
+      return pos;
+   }
+   else return insert( pos, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+// \exception std::invalid_argument Invalid compressed matrix access index.
+//
+// This function inserts a new element into the compressed matrix. However, duplicate elements
+// are not allowed. In case the compressed matrix already contains an element with row index
+// \a i and column index \a j, a \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::insert( size_t i, size_t j, const Type& value )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const Iterator pos( lowerBound( i, j ) );
+
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, i, j, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed matrix.
+//
+// \param pos The position of the new element.
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Iterator to the newly inserted element.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::insert( Iterator pos, size_t i, size_t j, const Type& value )
+{
+   const size_t n    ( lines() );
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+   const size_t k    ( offset( pos ) );
+
+   if( begin_[line+1UL] - end_[line] != 0UL )
+   {
+      moveElementsBackward( k, end_[line], end_[line]+1UL );
+      values_ [k] = value;
+      indices_[k] = static_cast<IT>( index );
+      ++end_[line];
+
+      return Iterator( values_+k, indices_+k );
+   }
+   else if( end_[n] - begin_[n] != 0UL )
+   {
+      moveElementsBackward( k, end_[n-1UL], end_[n-1UL]+1UL );
+      values_ [k] = value;
+      indices_[k] = static_cast<IT>( index );
+
+      for( size_t l=line+1UL; l<n+1UL; ++l ) {
+         ++begin_[l];
+         ++end_[l-1UL];
+      }
+
+      return Iterator( values_+k, indices_+k );
+   }
+   else
+   {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transferElements( 0UL, k, newValues, newIndices, 0UL );
+      newValues [k] = value;
+      newIndices[k] = static_cast<IT>( index );
+      transferElements( k, begin_[n], newValues, newIndices, k+1UL );
+
+      for( size_t l=line+1UL; l<n+1UL; ++l ) {
+         ++begin_[l];
+         ++end_[l-1UL];
+      }
+      end_[n] = newCapacity;
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      deallocate( newValues );
+      deallocate( newIndices );
+
+      return Iterator( values_+k, indices_+k );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the specified row/column of the compressed matrix.
+//
+// \param i The row index of the new element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed matrix with elements. It
+// appends a new element to the end of the specified row/column without any additional memory
+// allocation. Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the specified row/column of the sparse matrix
+//  - the current number of non-zero elements in the matrix must be smaller than the capacity
+//    of the matrix
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// In combination with the reserve() and the finalize() function, append() provides the most
+// efficient way to add new elements to a (newly created) compressed matrix.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::append( size_t i, size_t j, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   BLAZE_USER_ASSERT( end_[line] < end_[lines()], "Not enough reserved capacity left" );
+   BLAZE_USER_ASSERT( begin_[line] == end_[line] || index > indices_[end_[line]-1UL], "Index is not strictly increasing" );
+
+   values_[end_[line]] = value;
+
+   if( !check || !isDefault<strict>( values_[end_[line]] ) ) {
+      indices_[end_[line]] = static_cast<IT>( index );
+      ++end_[line];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Finalizing the element insertion of a row/column.
+//
+// \param i The index of the row/column to be finalized \f$[0..M-1]\f$.
+// \return void
+//
+// This function is part of the low-level interface to efficiently fill a matrix with elements.
+// After completion of row/column \a i via the append() function, this function can be called
+// to finalize row/column \a i and prepare the next row/column for insertion process via
+// append().
+//
+// \note Although finalize() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::finalize( size_t i )
+{
+   BLAZE_USER_ASSERT( i < lines(), "Invalid row/column access index" );
+
+   begin_[i+1UL] = end_[i];
+   if( i != lines()-1UL )
+      end_[i+1UL] = end_[i];
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row index of the element to be erased. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void SoACompressedMatrix<Type,SO,IT>::erase( size_t i, size_t j )
+{
+   BLAZE_USER_ASSERT( i < rows()   , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( j < columns(), "Invalid column access index" );
+
+   const size_t line( SO ? j : i );
+   const Iterator pos( find( i, j ) );
+
+   if( pos != end( line ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[line], k );
+      --end_[line];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed matrix. In case the storage order is
+// set to \a rowMajor the function erases an element from row \a i, in case the storage flag
+// is set to \a columnMajor the function erases an element from column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator pos )
+{
+   BLAZE_USER_ASSERT( i < lines()        , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( pos >= begin( i ) && pos <= end( i ), "Invalid compressed matrix iterator" );
+
+   if( pos != end( i ) ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, end_[i], k );
+      --end_[i];
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed matrix.
+//
+// \param i The row/column index of the element to be erased.
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed matrix. In case the storage
+// order is set to \a rowMajor the function erases a range of elements from row \a i, in case
+// the storage flag is set to \a columnMajor the function erases a range of elements from
+// column \a i.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( i < lines()              , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last            , "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin( i ) && first <= end( i ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( i ) && last  <= end( i ), "Invalid compressed matrix iterator" );
+
+   if( first != last ) {
+      const size_t kfirst( offset( first ) );
+      const size_t klast ( offset( last  ) );
+      moveElements( klast, end_[i], kfirst );
+      end_[i] -= klast - kfirst;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed matrix.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed matrix. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure. The following example demonstrates how to remove
+// all elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::SoACompressedMatrix<double,blaze::rowMajor> A;
+   // ... Resizing and initialization
+
+   A.erase( []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Type of the indices
+template< typename Pred >  // Type of the unary predicate
+inline void SoACompressedMatrix<Type,SO,IT>::erase( Pred predicate )
+{
+   for( size_t i=0UL; i<lines(); ++i ) {
+      erase( i, begin( i ), end( i ), predicate );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed matrix.
+//
+// \param i The row/column index of the elements to be erased.
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed matrix.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure. In case the storage
+// order is set to \a rowMajor the function erases a range of elements from row \a i, in case
+// the storage flag is set to \a columnMajor the function erases a range of elements from
+// column \a i.
+//
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the matrix
+        , bool SO          // Storage order
+        , typename IT >    // Type of the indices
+template< typename Pred >  // Type of the unary predicate
+inline void SoACompressedMatrix<Type,SO,IT>::erase( size_t i, Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( i < lines()              , "Invalid row/column access index" );
+   BLAZE_USER_ASSERT( first <= last            , "Invalid iterator range"          );
+   BLAZE_USER_ASSERT( first >= begin( i ) && first <= end( i ), "Invalid compressed matrix iterator" );
+   BLAZE_USER_ASSERT( last  >= begin( i ) && last  <= end( i ), "Invalid compressed matrix iterator" );
+
+   const size_t klast( offset( last ) );
+   size_t dest( offset( first ) );
+
+   for( size_t k=dest; k<klast; ++k ) {
+      if( !predicate( values_[k] ) ) {
+         if( dest != k ) {
+            values_ [dest] = std::move( values_[k] );
+            indices_[dest] = indices_[k];
+         }
+         ++dest;
+      }
+   }
+
+   moveElements( klast, end_[i], dest );
+   end_[i] -= klast - dest;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator, the set()
+// function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::find( size_t i, size_t j )
+{
+   const ConstIterator pos( const_cast<const This&>( *this ).find( i, j ) );
+   const size_t k( offset( pos ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific matrix element.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// matrix. It specifically searches for the element with row index \a i and column index \a j.
+// In case the element is found, the function returns an row/column iterator to the element.
+// Otherwise an iterator just past the last non-zero element of row \a i or column \a j (the
+// end() iterator) is returned. Note that the returned compressed matrix iterator is subject
+// to invalidation due to inserting operations via the function call operator, the set()
+// function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::find( size_t i, size_t j ) const
+{
+   const ConstIterator pos( lowerBound( i, j ) );
+   if( pos != end( SO ? j : i ) && pos->index() == ( SO ? i : j ) )
+      return pos;
+   else return end( SO ? j : i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j )
+{
+   const ConstIterator pos( const_cast<const This&>( *this ).lowerBound( i, j ) );
+   const size_t k( offset( pos ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index not less then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index not less then the given row
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::lowerBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO || i < rows()    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const size_t k( std::lower_bound( indices_+begin_[line], indices_+end_[line], index ) - indices_ );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::Iterator
+   SoACompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j )
+{
+   const ConstIterator pos( const_cast<const This&>( *this ).upperBound( i, j ) );
+   const size_t k( offset( pos ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param i The row index of the search element. The index has to be in the range \f$[0..M-1]\f$.
+// \param j The column index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// In case of a row-major matrix, this function returns a row iterator to the first element with
+// an index greater then the given column index. In case of a column-major matrix, the function
+// returns a column iterator to the first element with an index greater then the given row
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed matrix
+// iterator is subject to invalidation due to inserting operations via the function call
+// operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline typename SoACompressedMatrix<Type,SO,IT>::ConstIterator
+   SoACompressedMatrix<Type,SO,IT>::upperBound( size_t i, size_t j ) const
+{
+   BLAZE_USER_ASSERT( SO || i < rows()    , "Invalid row access index"    );
+   BLAZE_USER_ASSERT( !SO || j < columns(), "Invalid column access index" );
+
+   const size_t line ( SO ? j : i );
+   const size_t index( SO ? i : j );
+
+   const size_t k( std::upper_bound( indices_+begin_[line], indices_+end_[line], index ) - indices_ );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief In-place transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>& SoACompressedMatrix<Type,SO,IT>::transpose()
+{
+   SoACompressedMatrix tmp( trans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief In-place conjugate transpose of the matrix.
+//
+// \return Reference to the transposed matrix.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline SoACompressedMatrix<Type,SO,IT>& SoACompressedMatrix<Type,SO,IT>::ctranspose()
+{
+   SoACompressedMatrix tmp( ctrans( *this ) );
+   swap( tmp );
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Scaling of the matrix by the scalar value \a scalar (\f$ A=B*s \f$).
+//
+// \param scalar The scalar value for the matrix scaling.
+// \return Reference to the matrix.
+//
+// This function scales the matrix by applying the given scalar value \a scalar to each element
+// of the matrix. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::SoACompressedMatrix<int> A;
+   // ... Resizing and initialization
+   A *= 4;        // Scaling of the matrix
+   A.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the scalar value
+inline SoACompressedMatrix<Type,SO,IT>& SoACompressedMatrix<Type,SO,IT>::scale( const Other& scalar )
+{
+   for( size_t i=0UL; i<lines(); ++i )
+      for( size_t k=begin_[i]; k<end_[i]; ++k )
+         values_[k] *= scalar;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address can alias with the matrix. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SoACompressedMatrix<Type,SO,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this matrix, \a false if not.
+//
+// This function returns whether the given address is aliased with the matrix. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SoACompressedMatrix<Type,SO,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the matrix can be used in SMP assignments.
+//
+// \return \a true in case the matrix can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the matrix can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current number of
+// rows and/or columns of the matrix).
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline bool SoACompressedMatrix<Type,SO,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void SoACompressedMatrix<Type,SO,IT>::assign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   if( m_ == 0UL || n_ == 0UL )
+      return;
+
+   const size_t n   ( lines() );
+   const size_t size( SO ? m_ : n_ );
+
+   size_t nonzeros( 0UL );
+
+   for( size_t l=1UL; l<=n; ++l )
+      begin_[l] = end_[l] = end_[n];
+
+   for( size_t l=0UL; l<n; ++l )
+   {
+      begin_[l] = end_[l] = nonzeros;
+
+      const size_t kbegin( ( SO ? IsLower_v<MT> : IsUpper_v<MT> )
+                           ? ( ( SO ? IsStrictlyLower_v<MT> : IsStrictlyUpper_v<MT> ) ? l+1UL : l )
+                           : 0UL );
+      const size_t kend  ( ( SO ? IsUpper_v<MT> : IsLower_v<MT> )
+                           ? ( ( SO ? IsStrictlyUpper_v<MT> : IsStrictlyLower_v<MT> ) ? l : l+1UL )
+                           : size );
+
+      for( size_t k=kbegin; k<kend; ++k )
+      {
+         if( nonzeros == capacity() ) {
+            reserveElements( extendCapacity() );
+            for( size_t l2=l+1UL; l2<=n; ++l2 )
+               begin_[l2] = end_[l2] = end_[n];
+         }
+
+         values_[end_[l]] = ( SO ? (~rhs)(k,l) : (~rhs)(l,k) );
+
+         if( !isDefault<strict>( values_[end_[l]] ) ) {
+            indices_[end_[l]] = static_cast<IT>( k );
+            ++end_[l];
+            ++nonzeros;
+         }
+      }
+   }
+
+   begin_[n] = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with the same storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void SoACompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()     == (~rhs).rows()    , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns()  == (~rhs).columns() , "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL              , "Invalid non-zero elements" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t n( lines() );
+
+   if( n == 0UL )
+      return;
+
+   for( size_t l=0UL; l<n; ++l ) {
+      size_t k( begin_[l] );
+      for( auto element=(~rhs).begin(l); element!=(~rhs).end(l); ++element, ++k ) {
+         values_ [k] = element->value();
+         indices_[k] = static_cast<IT>( element->index() );
+      }
+      end_[l] = k;
+      begin_[l+1UL] = k;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse matrix with opposite storage order.
+//
+// \param rhs The right-hand side sparse matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+template< typename MT >  // Type of the right-hand side sparse matrix
+inline void SoACompressedMatrix<Type,SO,IT>::assign( const SparseMatrix<MT,!SO>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()     == (~rhs).rows()    , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns()  == (~rhs).columns() , "Invalid number of columns" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL              , "Invalid non-zero elements" );
+   BLAZE_INTERNAL_ASSERT( capacity() >= (~rhs).nonZeros(), "Invalid capacity detected" );
+
+   const size_t n( lines() );
+   const size_t size( SO ? m_ : n_ );
+   const size_t total( capacity() );
+
+   // Counting the number of elements per row/column
+   std::vector<size_t> lengths( n, 0UL );
+   for( size_t k=0UL; k<size; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element )
+         ++lengths[element->index()];
+   }
+
+   // Resizing the sparse matrix
+   for( size_t l=0UL; l<n; ++l ) {
+      begin_[l+1UL] = end_[l+1UL] = begin_[l] + lengths[l];
+   }
+   end_[n] = total;
+
+   // Appending the elements to the rows/columns of the sparse matrix
+   for( size_t k=0UL; k<size; ++k ) {
+      for( auto element=(~rhs).begin(k); element!=(~rhs).end(k); ++element ) {
+         if( SO )
+            append( k, element->index(), element->value() );
+         else
+            append( element->index(), k, element->value() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void SoACompressedMatrix<Type,SO,IT>::addAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SoACompressedMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void SoACompressedMatrix<Type,SO,IT>::addAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SoACompressedMatrix tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void SoACompressedMatrix<Type,SO,IT>::subAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SoACompressedMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse matrix.
+//
+// \param rhs The right-hand side sparse matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side sparse matrix
+        , bool SO2 >        // Storage order of the right-hand side sparse matrix
+inline void SoACompressedMatrix<Type,SO,IT>::subAssign( const SparseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   SoACompressedMatrix tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the Schur product assignment of a dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type     // Data type of the matrix
+        , bool SO           // Storage order
+        , typename IT >     // Type of the indices
+template< typename MT       // Type of the right-hand side dense matrix
+        , bool SO2 >        // Storage order of the right-hand side dense matrix
+inline void SoACompressedMatrix<Type,SO,IT>::schurAssign( const DenseMatrix<MT,SO2>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   for( size_t l=0UL; l<lines(); ++l ) {
+      for( size_t k=begin_[l]; k<end_[l]; ++k ) {
+         values_[k] *= ( SO ? (~rhs)(indices_[k],l) : (~rhs)(l,indices_[k]) );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOACOMPRESSEDMATRIX OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SoACompressedMatrix operators */
+//@{
+template< typename Type, bool SO, typename IT >
+inline void reset( SoACompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void reset( SoACompressedMatrix<Type,SO,IT>& m, size_t i );
+
+template< typename Type, bool SO, typename IT >
+inline void clear( SoACompressedMatrix<Type,SO,IT>& m );
+
+template< bool RF, typename Type, bool SO, typename IT >
+inline bool isDefault( const SoACompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline bool isIntact( const SoACompressedMatrix<Type,SO,IT>& m );
+
+template< typename Type, bool SO, typename IT >
+inline void swap( SoACompressedMatrix<Type,SO,IT>& a, SoACompressedMatrix<Type,SO,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed matrix.
+// \ingroup soa_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void reset( SoACompressedMatrix<Type,SO,IT>& m )
+{
+   m.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset the specified row/column of the given compressed matrix.
+// \ingroup soa_compressed_matrix
+//
+// \param m The matrix to be resetted.
+// \param i The index of the row/column to be resetted.
+// \return void
+//
+// This function resets the values in the specified row/column of the given compressed matrix to
+// their default value. In case the given matrix is a \a rowMajor matrix the function resets the
+// values in row \a i, if it is a \a columnMajor matrix the function resets the values in column
+// \a i. Note that the capacity of the row/column remains unchanged.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void reset( SoACompressedMatrix<Type,SO,IT>& m, size_t i )
+{
+   m.reset( i );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed matrix.
+// \ingroup soa_compressed_matrix
+//
+// \param m The matrix to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void clear( SoACompressedMatrix<Type,SO,IT>& m )
+{
+   m.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed matrix is in default state.
+// \ingroup soa_compressed_matrix
+//
+// \param m The matrix to be tested for its default state.
+// \return \a true in case the given matrix's rows and columns are zero, \a false otherwise.
+//
+// This function checks whether the compressed matrix is in default (constructed) state, i.e. if
+// it's number of rows and columns is 0. In case it is in default state, the function returns
+// \a true, else it will return \a false.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline bool isDefault( const SoACompressedMatrix<Type,SO,IT>& m )
+{
+   return ( m.rows() == 0UL && m.columns() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed matrix are intact.
+// \ingroup soa_compressed_matrix
+//
+// \param m The compressed matrix to be tested.
+// \return \a true in case the given matrix's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed matrix are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false.
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline bool isIntact( const SoACompressedMatrix<Type,SO,IT>& m )
+{
+   return ( m.nonZeros() <= m.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed matrices.
+// \ingroup soa_compressed_matrix
+//
+// \param a The first matrix to be swapped.
+// \param b The second matrix to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the matrix
+        , bool SO        // Storage order
+        , typename IT >  // Type of the indices
+inline void swap( SoACompressedMatrix<Type,SO,IT>& a, SoACompressedMatrix<Type,SO,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsResizable< SoACompressedMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsShrinkable< SoACompressedMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSOACOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool SO, typename IT >
+struct IsSoACompressed< SoACompressedMatrix<T,SO,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HIGHTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT, typename T2 >
+struct HighType< SoACompressedMatrix<T1,SO,IT>, SoACompressedMatrix<T2,SO,IT> >
+{
+   using Type = SoACompressedMatrix< typename HighType<T1,T2>::Type, SO, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool SO, typename IT, typename T2 >
+struct LowType< SoACompressedMatrix<T1,SO,IT>, SoACompressedMatrix<T2,SO,IT> >
+{
+   using Type = SoACompressedMatrix< typename LowType<T1,T2>::Type, SO, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,2532 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoACompressedVector.h
+//  \brief Implementation of an arbitrarily sized compressed vector with structure-of-arrays storage
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOACOMPRESSEDVECTOR_H_
+#define _BLAZE_MATH_SPARSE_SOACOMPRESSEDVECTOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <blaze/math/Aliases.h>
+#include <blaze/math/constraints/DenseVector.h>
+#include <blaze/math/constraints/RequiresEvaluation.h>
+#include <blaze/math/constraints/TransposeFlag.h>
+#include <blaze/math/Exception.h>
+#include <blaze/math/expressions/DenseVector.h>
+#include <blaze/math/expressions/SparseVector.h>
+#include <blaze/math/Forward.h>
+#include <blaze/math/InitializerList.h>
+#include <blaze/math/RelaxationFlag.h>
+#include <blaze/math/shims/IsDefault.h>
+#include <blaze/math/shims/Serial.h>
+#include <blaze/math/sparse/SoAIterator.h>
+#include <blaze/math/sparse/VectorAccessProxy.h>
+#include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/typetraits/HighType.h>
+#include <blaze/math/typetraits/IsResizable.h>
+#include <blaze/math/typetraits/IsShrinkable.h>
+#include <blaze/math/typetraits/IsSMPAssignable.h>
+#include <blaze/math/typetraits/IsSoACompressed.h>
+#include <blaze/math/typetraits/LowType.h>
+#include <blaze/system/TransposeFlag.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/algorithms/Min.h>
+#include <blaze/util/algorithms/Transfer.h>
+#include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Const.h>
+#include <blaze/util/constraints/Integral.h>
+#include <blaze/util/constraints/Pointer.h>
+#include <blaze/util/constraints/Reference.h>
+#include <blaze/util/constraints/Size.h>
+#include <blaze/util/constraints/Unsigned.h>
+#include <blaze/util/constraints/Volatile.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/TrueType.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsIntegral.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\defgroup soa_compressed_vector SoACompressedVector
+// \ingroup sparse_vector
+*/
+/*!\brief Efficient implementation of an arbitrary sized sparse vector with structure-of-arrays
+//        storage.
+// \ingroup soa_compressed_vector
+//
+// The SoACompressedVector class is the representation of an arbitrarily sized sparse vector,
+// which stores only non-zero elements of arbitrary type. In contrast to the CompressedVector
+// class template, which stores each non-zero element as a value-index-pair, SoACompressedVector
+// stores the values and the indices of all non-zero elements in two separate arrays. The type
+// of the elements, the transpose flag of the vector, and the type of the stored indices can be
+// specified via the three template parameters:
+
+   \code
+   template< typename Type, bool TF, typename IT >
+   class SoACompressedVector;
+   \endcode
+
+//  - Type: specifies the type of the vector elements. SoACompressedVector can be used with any
+//          non-cv-qualified, non-reference, non-pointer element type.
+//  - TF  : specifies whether the vector is a row vector (\a blaze::rowVector) or a column
+//          vector (\a blaze::columnVector). The default value is \a blaze::columnVector.
+//  - IT  : specifies the type of the stored indices. IT must be a 32-bit or 64-bit unsigned
+//          integral type (i.e. \c uint32_t or \c uint64_t). The default value is \c uint32_t.
+//
+// Note that the size of the vector is limited by the range of the index type. In case the size
+// exceeds the range of the index type, a \a std::invalid_argument exception is thrown. Apart
+// from that, SoACompressedVector provides the same interface as CompressedVector:
+
+   \code
+   using blaze::SoACompressedVector;
+   using blaze::columnVector;
+
+   SoACompressedVector<double,columnVector,uint32_t> a( 100 );
+
+   a[42] = 2.0;          // Access via the subscript operator
+   a.set( 45, -1.2 );    // Setting an element
+   a.insert( 50, 3.7 );  // Inserting a new element
+
+   a.reserve( 10 );      // Reserving enough capacity for 10 non-zero elements
+   a.append( 51, -2.1 ); // Appending an element
+
+   for( auto it=a.begin(); it!=a.end(); ++it ) {
+      ... = it->value();  // Access to the value of the non-zero element
+      ... = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+*/
+template< typename Type                     // Data type of the vector
+        , bool TF = defaultTransposeFlag    // Transpose flag
+        , typename IT = uint32_t >          // Type of the indices
+class SoACompressedVector
+   : public SparseVector< SoACompressedVector<Type,TF,IT>, TF >
+{
+ public:
+   //**Type definitions****************************************************************************
+   using This           = SoACompressedVector<Type,TF,IT>;   //!< Type of this SoACompressedVector instance.
+   using BaseType       = SparseVector<This,TF>;             //!< Base type of this SoACompressedVector instance.
+   using ResultType     = This;                              //!< Result type for expression template evaluations.
+   using TransposeType  = SoACompressedVector<Type,!TF,IT>;  //!< Transpose type for expression template evaluations.
+   using ElementType    = Type;                              //!< Type of the compressed vector elements.
+   using IndexType      = IT;                                //!< Type of the stored indices.
+   using ReturnType     = const Type&;                       //!< Return type for expression template evaluations.
+   using CompositeType  = const SoACompressedVector&;        //!< Data type for composite expression templates.
+   using Reference      = VectorAccessProxy<This>;           //!< Reference to a non-constant vector value.
+   using ConstReference = const Type&;                       //!< Reference to a constant vector value.
+   using Iterator       = SoAIterator<Type,IT>;              //!< Iterator over non-constant elements.
+   using ConstIterator  = SoAIterator<const Type,IT>;        //!< Iterator over constant elements.
+   //**********************************************************************************************
+
+   //**Rebind struct definition********************************************************************
+   /*!\brief Rebind mechanism to obtain a SoACompressedVector with different data/element type.
+   */
+   template< typename NewType >  // Data type of the other vector
+   struct Rebind {
+      using Other = SoACompressedVector<NewType,TF,IT>;  //!< The type of the other SoACompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Resize struct definition********************************************************************
+   /*!\brief Resize mechanism to obtain a SoACompressedVector with a different fixed number of elements.
+   */
+   template< size_t NewN >  // Number of elements of the other vector
+   struct Resize {
+      using Other = SoACompressedVector<Type,TF,IT>;  //!< The type of the other SoACompressedVector.
+   };
+   //**********************************************************************************************
+
+   //**Compilation flags***************************************************************************
+   //! Compilation switch for the expression template assignment strategy.
+   /*! The \a smpAssignable compilation flag indicates whether the vector can be used in SMP
+       (shared memory parallel) assignments (both on the left-hand and right-hand side of the
+       assignment). */
+   static constexpr bool smpAssignable = !IsSMPAssignable_v<Type>;
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit inline SoACompressedVector() noexcept;
+   explicit inline SoACompressedVector( size_t size );
+   explicit inline SoACompressedVector( size_t size, size_t nonzeros );
+   explicit inline SoACompressedVector( initializer_list<Type> list );
+
+   inline SoACompressedVector( const SoACompressedVector& sv );
+   inline SoACompressedVector( SoACompressedVector&& sv ) noexcept;
+
+   template< typename VT > inline SoACompressedVector( const DenseVector<VT,TF>&  dv );
+   template< typename VT > inline SoACompressedVector( const SparseVector<VT,TF>& sv );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~SoACompressedVector();
+   //@}
+   //**********************************************************************************************
+
+   //**Data access functions***********************************************************************
+   /*!\name Data access functions */
+   //@{
+   inline Reference      operator[]( size_t index ) noexcept;
+   inline ConstReference operator[]( size_t index ) const noexcept;
+   inline Reference      at( size_t index );
+   inline ConstReference at( size_t index ) const;
+   inline Iterator       begin () noexcept;
+   inline ConstIterator  begin () const noexcept;
+   inline ConstIterator  cbegin() const noexcept;
+   inline Iterator       end   () noexcept;
+   inline ConstIterator  end   () const noexcept;
+   inline ConstIterator  cend  () const noexcept;
+   inline Type*          values () noexcept;
+   inline const Type*    values () const noexcept;
+   inline const IT*      indices() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Assignment operators************************************************************************
+   /*!\name Assignment operators */
+   //@{
+   inline SoACompressedVector& operator=( initializer_list<Type> list );
+   inline SoACompressedVector& operator=( const SoACompressedVector& rhs );
+   inline SoACompressedVector& operator=( SoACompressedVector&& rhs ) noexcept;
+
+   template< typename VT > inline SoACompressedVector& operator= ( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator= ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator+=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator-=( const Vector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator*=( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator*=( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator/=( const DenseVector<VT,TF>& rhs );
+   template< typename VT > inline SoACompressedVector& operator%=( const Vector<VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t size() const noexcept;
+   inline size_t capacity() const noexcept;
+   inline size_t nonZeros() const;
+   inline void   reset();
+   inline void   clear();
+   inline void   resize( size_t n, bool preserve=true );
+          void   reserve( size_t n );
+   inline void   shrinkToFit();
+   inline void   swap( SoACompressedVector& sv ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   inline Iterator set   ( size_t index, const Type& value );
+   inline Iterator insert( size_t index, const Type& value );
+   inline void     append( size_t index, const Type& value, bool check=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Erase functions*****************************************************************************
+   /*!\name Erase functions */
+   //@{
+   inline void     erase( size_t index );
+   inline Iterator erase( Iterator pos );
+   inline Iterator erase( Iterator first, Iterator last );
+
+   template< typename Pred, typename = DisableIf_t< IsIntegral_v<Pred> > >
+   inline void erase( Pred predicate );
+
+   template< typename Pred >
+   inline void erase( Iterator first, Iterator last, Pred predicate );
+   //@}
+   //**********************************************************************************************
+
+   //**Lookup functions****************************************************************************
+   /*!\name Lookup functions */
+   //@{
+   inline Iterator      find      ( size_t index );
+   inline ConstIterator find      ( size_t index ) const;
+   inline Iterator      lowerBound( size_t index );
+   inline ConstIterator lowerBound( size_t index ) const;
+   inline Iterator      upperBound( size_t index );
+   inline ConstIterator upperBound( size_t index ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Numeric functions***************************************************************************
+   /*!\name Numeric functions */
+   //@{
+   template< typename Other > inline SoACompressedVector& scale( const Other& scalar );
+   //@}
+   //**********************************************************************************************
+
+   //**Expression template evaluation functions****************************************************
+   /*!\name Expression template evaluation functions */
+   //@{
+   template< typename Other > inline bool canAlias ( const Other* alias ) const noexcept;
+   template< typename Other > inline bool isAliased( const Other* alias ) const noexcept;
+
+   inline bool canSMPAssign() const noexcept;
+
+   template< typename VT > inline void assign    ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void assign    ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void addAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void subAssign ( const SparseVector<VT,TF>& rhs );
+   template< typename VT > inline void multAssign( const DenseVector <VT,TF>& rhs );
+   template< typename VT > inline void divAssign ( const DenseVector <VT,TF>& rhs );
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline void checkSize( size_t n );
+
+   inline size_t extendCapacity() const noexcept;
+   inline size_t offset( ConstIterator pos ) const noexcept;
+   inline void   moveElements( size_t first, size_t last, size_t dest );
+   //@}
+   //**********************************************************************************************
+
+   //**Insertion functions*************************************************************************
+   /*!\name Insertion functions */
+   //@{
+   Iterator insert( Iterator pos, size_t index, const Type& value );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t size_;             //!< The current size/dimension of the compressed vector.
+   size_t capacity_;         //!< The maximum capacity of the compressed vector.
+   size_t nonzeros_;         //!< The current number of non-zero elements of the compressed vector.
+   Type*  values_;           //!< The values of all non-zero elements.
+   IT*    indices_;          //!< The indices of all non-zero elements.
+
+   static const Type zero_;  //!< Neutral element for accesses to zero elements.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_CONSTRAINT_MUST_NOT_BE_POINTER_TYPE  ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_REFERENCE_TYPE( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_CONST         ( Type );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_VOLATILE      ( Type );
+   BLAZE_CONSTRAINT_MUST_BE_INTEGRAL_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_BE_UNSIGNED_TYPE     ( IT );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 1UL );
+   BLAZE_CONSTRAINT_MUST_NOT_HAVE_SIZE        ( IT, 2UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+template< typename Type, bool TF, typename IT >
+const Type SoACompressedVector<Type,TF,IT>::zero_{};
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The default constructor for SoACompressedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector() noexcept
+   : size_    ( 0UL )      // The current size/dimension of the compressed vector
+   , capacity_( 0UL )      // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )      // The current number of non-zero elements of the compressed vector
+   , values_  ( nullptr )  // The values of all non-zero elements
+   , indices_ ( nullptr )  // The indices of all non-zero elements
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( size_t n )
+   : size_    ( n   )      // The current size/dimension of the compressed vector
+   , capacity_( 0UL )      // The maximum capacity of the compressed vector
+   , nonzeros_( 0UL )      // The current number of non-zero elements of the compressed vector
+   , values_  ( nullptr )  // The values of all non-zero elements
+   , indices_ ( nullptr )  // The indices of all non-zero elements
+{
+   checkSize( n );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Constructor for a compressed vector of size \a n.
+//
+// \param n The size of the vector.
+// \param nonzeros The number of expected non-zero elements.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( size_t n, size_t nonzeros )
+   : SoACompressedVector( n )
+{
+   values_   = allocate<Type>( nonzeros );
+   indices_  = allocate<IT>( nonzeros );
+   capacity_ = nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief List initialization of all vector elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This constructor provides the option to explicitly initialize the elements of the vector by
+// means of an initializer list:
+
+   \code
+   blaze::SoACompressedVector<double> v1{ 4.2, 6.3, -1.2 };
+   \endcode
+
+// The vector is sized according to the size of the initializer list and all its elements are
+// copy initialized by the non-zero elements of the given initializer list.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( initializer_list<Type> list )
+   : SoACompressedVector( list.size(), blaze::nonZeros( list ) )
+{
+   size_t i( 0UL );
+
+   for( const Type& element : list ) {
+      if( !isDefault<strict>( element ) )
+         append( i, element );
+      ++i;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The copy constructor for SoACompressedVector.
+//
+// \param sv Compressed vector to be copied.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( const SoACompressedVector& sv )
+   : SoACompressedVector( sv.size_, sv.nonzeros_ )
+{
+   std::copy( sv.values_, sv.values_+sv.nonzeros_, values_ );
+   std::copy( sv.indices_, sv.indices_+sv.nonzeros_, indices_ );
+   nonzeros_ = sv.nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The move constructor for SoACompressedVector.
+//
+// \param sv The compressed vector to be moved into this instance.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( SoACompressedVector&& sv ) noexcept
+   : size_    ( sv.size_ )      // The current size/dimension of the compressed vector
+   , capacity_( sv.capacity_ )  // The maximum capacity of the compressed vector
+   , nonzeros_( sv.nonzeros_ )  // The current number of non-zero elements of the compressed vector
+   , values_  ( sv.values_ )    // The values of all non-zero elements
+   , indices_ ( sv.indices_ )   // The indices of all non-zero elements
+{
+   sv.size_     = 0UL;
+   sv.capacity_ = 0UL;
+   sv.nonzeros_ = 0UL;
+   sv.values_   = nullptr;
+   sv.indices_  = nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from dense vectors.
+//
+// \param dv Dense vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the foreign dense vector
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( const DenseVector<VT,TF>& dv )
+   : SoACompressedVector( (~dv).size() )
+{
+   using blaze::assign;
+
+   smpAssign( *this, ~dv );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Conversion constructor from different sparse vectors.
+//
+// \param sv Sparse vector to be copied.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the foreign sparse vector
+inline SoACompressedVector<Type,TF,IT>::SoACompressedVector( const SparseVector<VT,TF>& sv )
+   : SoACompressedVector( (~sv).size(), (~sv).nonZeros() )
+{
+   using blaze::assign;
+
+   smpAssign( *this, ~sv );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The destructor for SoACompressedVector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>::~SoACompressedVector()
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DATA ACCESS FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function returns a reference to the accessed value at position \a index. In case the
+// compressed vector does not yet store an element for index \a index, a new element is inserted
+// into the compressed vector. Note that this function only performs an index check in case
+// BLAZE_USER_ASSERT() is active. In contrast, the at() function is guaranteed to perform a
+// check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Reference
+   SoACompressedVector<Type,TF,IT>::operator[]( size_t index ) noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   return Reference( *this, index );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subscript operator for the direct access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+//
+// This function only performs an index check in case BLAZE_USER_ASSERT() is active. In contrast,
+// the at() function is guaranteed to perform a check of the given access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstReference
+   SoACompressedVector<Type,TF,IT>::operator[]( size_t index ) const noexcept
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const ConstIterator pos( lowerBound( index ) );
+
+   if( pos == end() || pos->index() != index )
+      return zero_;
+   else
+      return pos->value();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid compressed vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Reference
+   SoACompressedVector<Type,TF,IT>::at( size_t index )
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checked access to the compressed vector elements.
+//
+// \param index Access index. The index has to be in the range \f$[0..N-1]\f$.
+// \return Reference to the accessed value.
+// \exception std::out_of_range Invalid compressed vector access index.
+//
+// In contrast to the subscript operator this function always performs a check of the given
+// access index.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstReference
+   SoACompressedVector<Type,TF,IT>::at( size_t index ) const
+{
+   if( index >= size_ ) {
+      BLAZE_THROW_OUT_OF_RANGE( "Invalid compressed vector access index" );
+   }
+   return (*this)[index];
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::begin() noexcept
+{
+   return Iterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::begin() const noexcept
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first non-zero element of the compressed vector.
+//
+// \return Iterator to the first non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::cbegin() const noexcept
+{
+   return ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::end() noexcept
+{
+   return Iterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::end() const noexcept
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator just past the last non-zero element of the compressed vector.
+//
+// \return Iterator just past the last non-zero element of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::cend() const noexcept
+{
+   return ConstIterator( values_+nonzeros_, indices_+nonzeros_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements.
+//
+// \return Pointer to the value of the first non-zero element.
+//
+// This function returns a pointer to the contiguous values of the non-zero elements of the
+// compressed vector. The number of values is given by the nonZeros() function.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline Type* SoACompressedVector<Type,TF,IT>::values() noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the values of the non-zero elements.
+//
+// \return Pointer to the value of the first non-zero element.
+//
+// This function returns a pointer to the contiguous values of the non-zero elements of the
+// compressed vector. The number of values is given by the nonZeros() function.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline const Type* SoACompressedVector<Type,TF,IT>::values() const noexcept
+{
+   return values_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Low-level access to the indices of the non-zero elements.
+//
+// \return Pointer to the index of the first non-zero element.
+//
+// This function returns a pointer to the contiguous indices of the non-zero elements of the
+// compressed vector. The number of indices is given by the nonZeros() function. Since the
+// indices determine the structure of the vector, only read access is provided.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline const IT* SoACompressedVector<Type,TF,IT>::indices() const noexcept
+{
+   return indices_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ASSIGNMENT OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief List assignment to all vector elements.
+//
+// \param list The initializer list.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This assignment operator offers the option to directly assign to all elements of the vector
+// by means of an initializer list. The vector is resized according to the given initializer
+// list and all its elements are (copy) assigned the non-zero values from the given initializer
+// list.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator=( initializer_list<Type> list )
+{
+   using blaze::nonZeros;
+
+   resize( list.size(), false );
+   reserve( nonZeros( list ) );
+
+   size_t i( 0UL );
+
+   for( const Type& element : list ) {
+      if( !isDefault<strict>( element ) )
+         append( i, element );
+      ++i;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Copy assignment operator for SoACompressedVector.
+//
+// \param rhs Compressed vector to be copied.
+// \return Reference to the assigned compressed vector.
+//
+// The compressed vector is resized according to the given sparse vector and initialized as a
+// copy of this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator=( const SoACompressedVector& rhs )
+{
+   if( &rhs == this ) return *this;
+
+   if( rhs.nonzeros_ > capacity_ ) {
+      SoACompressedVector tmp( rhs );
+      swap( tmp );
+   }
+   else {
+      std::copy( rhs.values_, rhs.values_+rhs.nonzeros_, values_ );
+      std::copy( rhs.indices_, rhs.indices_+rhs.nonzeros_, indices_ );
+      nonzeros_ = rhs.nonzeros_;
+      size_     = rhs.size_;
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Move assignment operator for SoACompressedVector.
+//
+// \param rhs The compressed vector to be moved into this instance.
+// \return Reference to the assigned compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator=( SoACompressedVector&& rhs ) noexcept
+{
+   deallocate( values_ );
+   deallocate( indices_ );
+
+   size_     = rhs.size_;
+   capacity_ = rhs.capacity_;
+   nonzeros_ = rhs.nonzeros_;
+   values_   = rhs.values_;
+   indices_  = rhs.indices_;
+
+   rhs.size_     = 0UL;
+   rhs.capacity_ = 0UL;
+   rhs.nonzeros_ = 0UL;
+   rhs.values_   = nullptr;
+   rhs.indices_  = nullptr;
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for dense vectors.
+//
+// \param rhs Dense vector to be copied.
+// \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// The vector is resized according to the given dense vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator=( const DenseVector<VT,TF>& rhs )
+{
+   if( (~rhs).canAlias( this ) ) {
+      SoACompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      checkSize( (~rhs).size() );
+      size_     = (~rhs).size();
+      nonzeros_ = 0UL;
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Assignment operator for different sparse vectors.
+//
+// \param rhs Sparse vector to be copied.
+// \return Reference to the assigned compressed vector.
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// The vector is resized according to the given sparse vector and initialized as a copy of
+// this vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side sparse vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator=( const SparseVector<VT,TF>& rhs )
+{
+   if( (~rhs).canAlias( this ) || (~rhs).nonZeros() > capacity_ ) {
+      SoACompressedVector tmp( ~rhs );
+      swap( tmp );
+   }
+   else {
+      checkSize( (~rhs).size() );
+      size_     = (~rhs).size();
+      nonzeros_ = 0UL;
+      smpAssign( *this, ~rhs );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Addition assignment operator for the addition of a vector (\f$ \vec{a}+=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be added to the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator+=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   smpAddAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Subtraction assignment operator for the subtraction of a vector (\f$ \vec{a}-=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector to be subtracted from the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator-=( const Vector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   smpSubAssign( *this, ~rhs );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a dense vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator*=( const DenseVector<VT,TF>& rhs )
+{
+   using blaze::multAssign;
+
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      SoACompressedVector tmp( *this * (~rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<VT> tmp( ~rhs );
+      multAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Multiplication assignment operator for the multiplication of a sparse vector
+//        (\f$ \vec{a}*=\vec{b} \f$).
+//
+// \param rhs The right-hand side sparse vector to be multiplied with the compressed vector.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator*=( const SparseVector<VT,TF>& rhs )
+{
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   SoACompressedVector tmp( *this * (~rhs) );
+   swap( tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Division assignment operator for the division of a dense vector (\f$ \vec{a}/=\vec{b} \f$).
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Vector sizes do not match.
+//
+// In case the current sizes of the two vectors don't match, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator/=( const DenseVector<VT,TF>& rhs )
+{
+   using blaze::divAssign;
+
+   if( (~rhs).size() != size_ ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector sizes do not match" );
+   }
+
+   if( (~rhs).canAlias( this ) ) {
+      SoACompressedVector tmp( *this / (~rhs) );
+      swap( tmp );
+   }
+   else {
+      CompositeType_t<VT> tmp( ~rhs );
+      divAssign( *this, tmp );
+   }
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Cross product assignment operator for the multiplication of a vector
+//        (\f$ \vec{a}\times=\vec{b} \f$).
+//
+// \param rhs The right-hand side vector for the cross product.
+// \return Reference to the compressed vector.
+// \exception std::invalid_argument Invalid vector size for cross product.
+//
+// In case the current size of any of the two vectors is not equal to 3, a \a std::invalid_argument
+// exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side vector
+inline SoACompressedVector<Type,TF,IT>&
+   SoACompressedVector<Type,TF,IT>::operator%=( const Vector<VT,TF>& rhs )
+{
+   using blaze::assign;
+
+   using CrossType = CrossTrait_t< This, ResultType_t<VT> >;
+
+   BLAZE_CONSTRAINT_MUST_BE_DENSE_VECTOR_TYPE( CrossType );
+   BLAZE_CONSTRAINT_MUST_BE_VECTOR_WITH_TRANSPOSE_FLAG( CrossType, TF );
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( CrossType );
+
+   if( size_ != 3UL || (~rhs).size() != 3UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid vector size for cross product" );
+   }
+
+   const CrossType tmp( *this % (~rhs) );
+   nonzeros_ = 0UL;
+   assign( *this, tmp );
+
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size/dimension of the compressed vector.
+//
+// \return The size of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedVector<Type,TF,IT>::size() const noexcept
+{
+   return size_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the maximum capacity of the compressed vector.
+//
+// \return The capacity of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedVector<Type,TF,IT>::capacity() const noexcept
+{
+   return capacity_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the number of non-zero elements in the compressed vector.
+//
+// \return The number of non-zero elements in the compressed vector.
+//
+// Note that the number of non-zero elements is always less than or equal to the current size
+// of the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedVector<Type,TF,IT>::nonZeros() const
+{
+   return nonzeros_;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Reset to the default initial values.
+//
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::reset()
+{
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the compressed vector.
+//
+// \return void
+//
+// After the clear() function, the size of the compressed vector is 0.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::clear()
+{
+   size_     = 0UL;
+   nonzeros_ = 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Changing the size of the compressed vector.
+//
+// \param n The new size of the compressed vector.
+// \param preserve \a true if the old values of the vector should be preserved, \a false if not.
+// \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+//
+// This function resizes the compressed vector using the given size to \a n. During this
+// operation, new dynamic memory may be allocated in case the capacity of the compressed
+// vector is too small. Note that this function may invalidate all existing views (subvectors,
+// ...) on the vector if it is used to shrink the vector. Additionally, the resize operation
+// potentially changes all vector elements. In order to preserve the old vector values, the
+// \a preserve flag can be set to \a true.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::resize( size_t n, bool preserve )
+{
+   checkSize( n );
+
+   if( preserve ) {
+      nonzeros_ = offset( lowerBound( n ) );
+   }
+   else {
+      nonzeros_ = 0UL;
+   }
+
+   size_ = n;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Setting the minimum capacity of the compressed vector.
+//
+// \param n The new minimum capacity of the compressed vector.
+// \return void
+//
+// This function increases the capacity of the compressed vector to at least \a n elements. The
+// current values of the vector elements are preserved.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+void SoACompressedVector<Type,TF,IT>::reserve( size_t n )
+{
+   if( n > capacity_ )
+   {
+      // Allocating new value and index arrays
+      Type* newValues ( allocate<Type>( n ) );
+      IT*   newIndices( allocate<IT>( n ) );
+
+      // Replacing the old value and index arrays
+      transfer( values_, values_+nonzeros_, newValues );
+      std::copy( indices_, indices_+nonzeros_, newIndices );
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      capacity_ = n;
+
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removing all unused capacity.
+//
+// \return void
+//
+// This function minimizes the capacity of the vector by removing unused capacity. Please note
+// that in case a reallocation occurs, all iterators (including end() iterators), all pointers
+// and references to elements of this vector are invalidated.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::shrinkToFit()
+{
+   if( nonzeros_ < capacity_ ) {
+      SoACompressedVector( *this ).swap( *this );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+//
+// \param sv The compressed vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::swap( SoACompressedVector& sv ) noexcept
+{
+   using std::swap;
+
+   swap( size_, sv.size_ );
+   swap( capacity_, sv.capacity_ );
+   swap( nonzeros_, sv.nonzeros_ );
+   swap( values_, sv.values_ );
+   swap( indices_, sv.indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the size of a compressed vector against the range of the index type.
+//
+// \param n The size of the vector.
+// \return void
+// \exception std::invalid_argument Vector size exceeds the range of the index type.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::checkSize( size_t n )
+{
+   if( n != 0UL && n-1UL > static_cast<size_t>( std::numeric_limits<IT>::max() ) ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Vector size exceeds the range of the index type" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Calculating a new vector capacity.
+//
+// \return The new compressed vector capacity.
+//
+// This function calculates a new vector capacity based on the current capacity of the sparse
+// vector. Note that the new capacity is restricted to the interval \f$[7..size]\f$.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedVector<Type,TF,IT>::extendCapacity() const noexcept
+{
+   size_t nonzeros( 2UL*capacity_+1UL );
+   nonzeros = max( nonzeros, 7UL   );
+   nonzeros = min( nonzeros, size_ );
+
+   BLAZE_INTERNAL_ASSERT( nonzeros > capacity_, "Invalid capacity value" );
+
+   return nonzeros;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Computes the offset of the element referenced by the given iterator.
+//
+// \param pos Iterator to an element of the compressed vector.
+// \return The offset of the element within the value and index arrays.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline size_t SoACompressedVector<Type,TF,IT>::offset( ConstIterator pos ) const noexcept
+{
+   return pos - ConstIterator( values_, indices_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Moves a range of elements towards the front of the value and index arrays.
+//
+// \param first The offset of the first element to be moved.
+// \param last The offset one past the last element to be moved.
+// \param dest The target offset (\f$ dest \leq first \f$).
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::moveElements( size_t first, size_t last, size_t dest )
+{
+   BLAZE_INTERNAL_ASSERT( dest <= first, "Invalid target offset" );
+
+   std::move( values_+first, values_+last, values_+dest );
+   std::copy( indices_+first, indices_+last, indices_+dest );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSERTION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Setting an element of the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be set.
+// \return Reference to the set value.
+//
+// This function sets the value of an element of the compressed vector. In case the sparse vector
+// already contains an element with index \a index its value is modified, else a new element with
+// the given \a value is inserted.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::set( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index ) {
+      pos->value() = value;
+      return pos;
+   }
+   else return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Reference to the inserted value.
+// \exception std::invalid_argument Invalid compressed vector access index.
+//
+// This function inserts a new element into the compressed vector. However, duplicate elements are
+// not allowed. In case the sparse vector already contains an element with index \a index, a
+// \a std::invalid_argument exception is thrown.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::insert( size_t index, const Type& value )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( lowerBound( index ) );
+
+   if( pos != end() && pos->index() == index ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Bad access index" );
+   }
+
+   return insert( pos, index, value );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Inserting an element into the compressed vector.
+//
+// \param pos The position of the new element.
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be inserted.
+// \return Reference to the inserted value.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::insert( Iterator pos, size_t index, const Type& value )
+{
+   const size_t k( offset( pos ) );
+
+   if( nonzeros_ != capacity_ ) {
+      std::move_backward( values_+k, values_+nonzeros_, values_+nonzeros_+1UL );
+      std::copy_backward( indices_+k, indices_+nonzeros_, indices_+nonzeros_+1UL );
+   }
+   else {
+      const size_t newCapacity( extendCapacity() );
+
+      Type* newValues ( allocate<Type>( newCapacity ) );
+      IT*   newIndices( allocate<IT>( newCapacity ) );
+
+      transfer( values_, values_+k, newValues );
+      transfer( values_+k, values_+nonzeros_, newValues+k+1UL );
+      std::copy( indices_, indices_+k, newIndices );
+      std::copy( indices_+k, indices_+nonzeros_, newIndices+k+1UL );
+
+      std::swap( newValues, values_ );
+      std::swap( newIndices, indices_ );
+      capacity_ = newCapacity;
+
+      deallocate( newValues );
+      deallocate( newIndices );
+   }
+
+   values_ [k] = value;
+   indices_[k] = static_cast<IT>( index );
+   ++nonzeros_;
+
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Appending an element to the compressed vector.
+//
+// \param index The index of the new element. The index has to be in the range \f$[0..N-1]\f$.
+// \param value The value of the element to be appended.
+// \param check \a true if the new value should be checked for default values, \a false if not.
+// \return void
+//
+// This function provides a very efficient way to fill a compressed vector with elements. It
+// appends a new element to the end of the compressed vector without any memory allocation.
+// Therefore it is strictly necessary to keep the following preconditions in mind:
+//
+//  - the index of the new element must be strictly larger than the largest index of non-zero
+//    elements in the compressed vector
+//  - the current number of non-zero elements must be smaller than the capacity of the vector
+//
+// Ignoring these preconditions might result in undefined behavior! The optional \a check
+// parameter specifies whether the new value should be tested for a default value. If the new
+// value is a default value (for instance 0 in case of an integral element type) the value is
+// not appended. Per default the values are not tested.
+//
+// \note Although append() does not allocate new memory, it still invalidates all iterators
+// returned by the end() functions!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::append( size_t index, const Type& value, bool check )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+   BLAZE_USER_ASSERT( nonzeros_ < capacity_, "Not enough reserved capacity" );
+   BLAZE_USER_ASSERT( nonzeros_ == 0UL || indices_[nonzeros_-1UL] < index, "Index is not strictly increasing" );
+
+   values_[nonzeros_] = value;
+
+   if( !check || !isDefault<strict>( values_[nonzeros_] ) ) {
+      indices_[nonzeros_] = static_cast<IT>( index );
+      ++nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ERASE FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param index The index of the element to be erased. The index has to be in the range \f$[0..N-1]\f$.
+// \return void
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void SoACompressedVector<Type,TF,IT>::erase( size_t index )
+{
+   BLAZE_USER_ASSERT( index < size_, "Invalid compressed vector access index" );
+
+   const Iterator pos( find( index ) );
+   if( pos != end() ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, nonzeros_, k );
+      --nonzeros_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing an element from the compressed vector.
+//
+// \param pos Iterator to the element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases an element from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::erase( Iterator pos )
+{
+   BLAZE_USER_ASSERT( pos >= begin() && pos <= end(), "Invalid compressed vector iterator" );
+
+   if( pos != end() ) {
+      const size_t k( offset( pos ) );
+      moveElements( k+1UL, nonzeros_, k );
+      --nonzeros_;
+   }
+
+   return pos;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing a range of elements from the compressed vector.
+//
+// \param first Iterator to first element to be erased.
+// \param last Iterator just past the last element to be erased.
+// \return Iterator to the element after the erased element.
+//
+// This function erases a range of elements from the compressed vector.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   if( first != last ) {
+      const size_t kfirst( offset( first ) );
+      const size_t klast ( offset( last  ) );
+      moveElements( klast, nonzeros_, kfirst );
+      nonzeros_ -= klast - kfirst;
+   }
+
+   return first;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from the compressed vector.
+//
+// \param predicate The unary predicate for the element selection.
+// \return void.
+//
+// This function erases specific elements from the compressed vector. The elements are selected
+// by the given unary predicate \a predicate, which is expected to accept a single argument of
+// the type of the elements and to be pure. The following example demonstrates how to remove
+// all elements that are smaller than a certain threshold value:
+
+   \code
+   blaze::SoACompressedVector<double> a;
+   // ... Resizing and initialization
+
+   a.erase( []( double value ){ return value < 1E-8; } );
+   \endcode
+
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename Pred  // Type of the unary predicate
+        , typename >     // Type restriction on the unary predicate
+inline void SoACompressedVector<Type,TF,IT>::erase( Pred predicate )
+{
+   erase( begin(), end(), predicate );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Erasing specific elements from a range of the compressed vector.
+//
+// \param first Iterator to first element of the range.
+// \param last Iterator just past the last element of the range.
+// \param predicate The unary predicate for the element selection.
+// \return void
+//
+// This function erases specific elements from a range of elements of the compressed vector.
+// The elements are selected by the given unary predicate \a predicate, which is expected to
+// accept a single argument of the type of the elements and to be pure.
+//
+// \note The predicate is required to be pure, i.e. to produce deterministic results for elements
+// with the same value. The attempt to use an impure predicate leads to undefined behavior!
+*/
+template< typename Type    // Data type of the vector
+        , bool TF          // Transpose flag
+        , typename IT >    // Type of the indices
+template< typename Pred >  // Type of the unary predicate
+inline void SoACompressedVector<Type,TF,IT>::erase( Iterator first, Iterator last, Pred predicate )
+{
+   BLAZE_USER_ASSERT( first <= last, "Invalid iterator range"   );
+   BLAZE_USER_ASSERT( first >= begin() && first <= end(), "Invalid compressed vector iterator" );
+   BLAZE_USER_ASSERT( last  >= begin() && last  <= end(), "Invalid compressed vector iterator" );
+
+   const size_t klast( offset( last ) );
+   size_t dest( offset( first ) );
+
+   for( size_t k=dest; k<klast; ++k ) {
+      if( !predicate( values_[k] ) ) {
+         if( dest != k ) {
+            values_ [dest] = std::move( values_[k] );
+            indices_[dest] = indices_[k];
+         }
+         ++dest;
+      }
+   }
+
+   moveElements( klast, nonzeros_, dest );
+   nonzeros_ -= klast - dest;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOOKUP FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::find( size_t index )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).find( index ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Searches for a specific vector element.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the element in case the index is found, end() iterator otherwise.
+//
+// This function can be used to check whether a specific element is contained in the sparse
+// vector. It specifically searches for the element with index \a index. In case the element
+// is found, the function returns an iterator to the element. Otherwise an iterator just past
+// the last non-zero element of the compressed vector (the end() iterator) is returned. Note
+// that the returned compressed vector iterator is subject to invalidation due to inserting
+// operations via the subscript operator, the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::find( size_t index ) const
+{
+   const ConstIterator pos( lowerBound( index ) );
+   if( pos != end() && pos->index() == index )
+      return pos;
+   else return end();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index not less then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::lowerBound( size_t index )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).lowerBound( index ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index not less then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index not less then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index not less then the given
+// index. In combination with the upperBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::lowerBound( size_t index ) const
+{
+   const size_t k( std::lower_bound( indices_, indices_+nonzeros_, index ) - indices_ );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index greater then the given
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::Iterator
+   SoACompressedVector<Type,TF,IT>::upperBound( size_t index )
+{
+   const size_t k( offset( const_cast<const This&>( *this ).upperBound( index ) ) );
+   return Iterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns an iterator to the first index greater then the given index.
+//
+// \param index The index of the search element. The index has to be in the range \f$[0..N-1]\f$.
+// \return Iterator to the first index greater then the given index, end() iterator otherwise.
+//
+// This function returns an iterator to the first element with an index greater then the given
+// index. In combination with the lowerBound() function this function can be used to create a
+// pair of iterators specifying a range of indices. Note that the returned compressed vector
+// iterator is subject to invalidation due to inserting operations via the subscript operator,
+// the set() function or the insert() function!
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline typename SoACompressedVector<Type,TF,IT>::ConstIterator
+   SoACompressedVector<Type,TF,IT>::upperBound( size_t index ) const
+{
+   const size_t k( std::upper_bound( indices_, indices_+nonzeros_, index ) - indices_ );
+   return ConstIterator( values_+k, indices_+k );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  NUMERIC FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scaling of the compressed vector by the scalar value \a scalar (\f$ \vec{a}=\vec{b}*s \f$).
+//
+// \param scalar The scalar value for the vector scaling.
+// \return Reference to the compressed vector.
+//
+// This function scales the vector by applying the given scalar value \a scalar to each element
+// of the vector. For built-in and \c complex data types it has the same effect as using the
+// multiplication assignment operator:
+
+   \code
+   blaze::SoACompressedVector<int> a;
+   // ... Resizing and initialization
+   a *= 4;        // Scaling of the vector
+   a.scale( 4 );  // Same effect as above
+   \endcode
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the scalar value
+inline SoACompressedVector<Type,TF,IT>& SoACompressedVector<Type,TF,IT>::scale( const Other& scalar )
+{
+   for( size_t k=0UL; k<nonzeros_; ++k )
+      values_[k] *= scalar;
+   return *this;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  EXPRESSION TEMPLATE EVALUATION FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can alias with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address can alias with the vector. In contrast
+// to the isAliased() function this function is allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SoACompressedVector<Type,TF,IT>::canAlias( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector is aliased with the given address \a alias.
+//
+// \param alias The alias to be checked.
+// \return \a true in case the alias corresponds to this vector, \a false if not.
+//
+// This function returns whether the given address is aliased with the vector. In contrast
+// to the canAlias() function this function is not allowed to use compile time expressions
+// to optimize the evaluation.
+*/
+template< typename Type     // Data type of the vector
+        , bool TF           // Transpose flag
+        , typename IT >     // Type of the indices
+template< typename Other >  // Data type of the foreign expression
+inline bool SoACompressedVector<Type,TF,IT>::isAliased( const Other* alias ) const noexcept
+{
+   return static_cast<const void*>( this ) == static_cast<const void*>( alias );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the vector can be used in SMP assignments.
+//
+// \return \a true in case the vector can be used in SMP assignments, \a false if not.
+//
+// This function returns whether the vector can be used in SMP assignments. In contrast to the
+// \a smpAssignable member enumeration, which is based solely on compile time information, this
+// function additionally provides runtime information (as for instance the current size of the
+// vector).
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline bool SoACompressedVector<Type,TF,IT>::canSMPAssign() const noexcept
+{
+   return false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SoACompressedVector<Type,TF,IT>::assign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   for( size_t i=0UL; i<size_; ++i )
+   {
+      if( nonzeros_ == capacity_ )
+         reserve( extendCapacity() );
+
+      values_[nonzeros_] = (~rhs)[i];
+
+      if( !isDefault<strict>( values_[nonzeros_] ) ) {
+         indices_[nonzeros_] = static_cast<IT>( i );
+         ++nonzeros_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SoACompressedVector<Type,TF,IT>::assign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+   BLAZE_INTERNAL_ASSERT( nonZeros() == 0UL, "Invalid non-zero elements detected" );
+
+   for( ConstIterator_t<VT> element=(~rhs).begin(); element!=(~rhs).end(); ++element )
+      append( element->index(), element->value() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SoACompressedVector<Type,TF,IT>::addAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SoACompressedVector tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the addition assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SoACompressedVector<Type,TF,IT>::addAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SoACompressedVector tmp( serial( *this + (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SoACompressedVector<Type,TF,IT>::subAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SoACompressedVector tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the subtraction assignment of a sparse vector.
+//
+// \param rhs The right-hand side sparse vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side sparse vector
+inline void SoACompressedVector<Type,TF,IT>::subAssign( const SparseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   SoACompressedVector tmp( serial( *this - (~rhs) ) );
+   swap( tmp );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SoACompressedVector<Type,TF,IT>::multAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   for( size_t k=0UL; k<nonzeros_; ++k ) {
+      values_[k] *= (~rhs)[indices_[k]];
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Default implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+template< typename VT >  // Type of the right-hand side dense vector
+inline void SoACompressedVector<Type,TF,IT>::divAssign( const DenseVector<VT,TF>& rhs )
+{
+   BLAZE_INTERNAL_ASSERT( size_ == (~rhs).size(), "Invalid vector sizes" );
+
+   BLAZE_CONSTRAINT_MUST_NOT_REQUIRE_EVALUATION( VT );
+
+   for( size_t k=0UL; k<nonzeros_; ++k ) {
+      values_[k] /= (~rhs)[indices_[k]];
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  SOACOMPRESSEDVECTOR OPERATORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name SoACompressedVector operators */
+//@{
+template< typename Type, bool TF, typename IT >
+inline void reset( SoACompressedVector<Type,TF,IT>& v );
+
+template< typename Type, bool TF, typename IT >
+inline void clear( SoACompressedVector<Type,TF,IT>& v );
+
+template< bool RF, typename Type, bool TF, typename IT >
+inline bool isDefault( const SoACompressedVector<Type,TF,IT>& v );
+
+template< typename Type, bool TF, typename IT >
+inline bool isIntact( const SoACompressedVector<Type,TF,IT>& v ) noexcept;
+
+template< typename Type, bool TF, typename IT >
+inline void swap( SoACompressedVector<Type,TF,IT>& a, SoACompressedVector<Type,TF,IT>& b ) noexcept;
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the given compressed vector.
+// \ingroup soa_compressed_vector
+//
+// \param v The compressed vector to be resetted.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void reset( SoACompressedVector<Type,TF,IT>& v )
+{
+   v.reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Clearing the given compressed vector.
+// \ingroup soa_compressed_vector
+//
+// \param v The compressed vector to be cleared.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void clear( SoACompressedVector<Type,TF,IT>& v )
+{
+   v.clear();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the given compressed vector is in default state.
+// \ingroup soa_compressed_vector
+//
+// \param v The compressed vector to be tested for its default state.
+// \return \a true in case the given vector's size is zero, \a false otherwise.
+//
+// This function checks whether the compressed vector is in default (constructed) state, i.e. if
+// it's size is 0. In case it is in default state, the function returns \a true, else it will
+// return \a false.
+*/
+template< bool RF        // Relaxation flag
+        , typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline bool isDefault( const SoACompressedVector<Type,TF,IT>& v )
+{
+   return ( v.size() == 0UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the invariants of the given compressed vector are intact.
+// \ingroup soa_compressed_vector
+//
+// \param v The compressed vector to be tested.
+// \return \a true in case the given vector's invariants are intact, \a false otherwise.
+//
+// This function checks whether the invariants of the compressed vector are intact, i.e. if
+// its state is valid. In case the invariants are intact, the function returns \a true, else
+// it will return \a false.
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline bool isIntact( const SoACompressedVector<Type,TF,IT>& v ) noexcept
+{
+   return ( v.nonZeros() <= v.capacity() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Swapping the contents of two compressed vectors.
+// \ingroup soa_compressed_vector
+//
+// \param a The first compressed vector to be swapped.
+// \param b The second compressed vector to be swapped.
+// \return void
+*/
+template< typename Type  // Data type of the vector
+        , bool TF        // Transpose flag
+        , typename IT >  // Type of the indices
+inline void swap( SoACompressedVector<Type,TF,IT>& a, SoACompressedVector<Type,TF,IT>& b ) noexcept
+{
+   a.swap( b );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISRESIZABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsResizable< SoACompressedVector<T,TF,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSHRINKABLE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsShrinkable< SoACompressedVector<T,TF,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ISSOACOMPRESSED SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T, bool TF, typename IT >
+struct IsSoACompressed< SoACompressedVector<T,TF,IT> >
+   : public TrueType
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  HIGHTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename IT, typename T2 >
+struct HighType< SoACompressedVector<T1,TF,IT>, SoACompressedVector<T2,TF,IT> >
+{
+   using Type = SoACompressedVector< typename HighType<T1,T2>::Type, TF, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  LOWTYPE SPECIALIZATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename T1, bool TF, typename IT, typename T2 >
+struct LowType< SoACompressedVector<T1,TF,IT>, SoACompressedVector<T2,TF,IT> >
+{
+   using Type = SoACompressedVector< typename LowType<T1,T2>::Type, TF, IT >;
+};
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,393 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/sparse/SoAIterator.h
+//  \brief Header file for the SoAIterator class template
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+#define _BLAZE_MATH_SPARSE_SOAITERATOR_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <iterator>
+#include <blaze/math/sparse/ValueIndexPair.h>
+#include <blaze/util/EnableIf.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/IsConvertible.h>
+#include <blaze/util/typetraits/RemoveConst.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Iterator over the non-zero elements of a sparse vector or matrix in structure-of-arrays
+//        layout.
+// \ingroup sparse
+//
+// The SoAIterator class template represents an iterator over the non-zero elements of sparse
+// vectors and matrices that store the values and indices of their non-zero elements in two
+// separate arrays (see for instance the SoACompressedVector and SoACompressedMatrix class
+// templates). The first template parameter specifies the type of the values and may be
+// const-qualified in order to represent an iterator over constant elements. The second template
+// parameter specifies the type of the stored indices.
+//
+// In contrast to the iterators of CompressedVector and CompressedMatrix the iterator does not
+// point to an actual value-index-pair. Instead, the value and the index of the current element
+// are accessed via the arrow operator:
+
+   \code
+   using blaze::SoACompressedMatrix;
+
+   SoACompressedMatrix<double> A;
+   // ... Resizing and initialization
+
+   for( auto it=A.begin(0); it!=A.end(0); ++it ) {
+      it->value() *= 2.0;        // Access to the value of the non-zero element
+      size_t j = it->index();  // Access to the index of the non-zero element
+   }
+   \endcode
+*/
+template< typename Type         // Type of the values
+        , typename IndexType >  // Type of the indices
+class SoAIterator
+{
+ public:
+   //**Type definitions****************************************************************************
+   //! Element type of the iterator.
+   using Element = ValueIndexPair< RemoveConst_t<Type> >;
+
+   using IteratorCategory = std::random_access_iterator_tag;  //!< The iterator category.
+   using ValueType        = Element;                          //!< Type of the underlying elements.
+   using PointerType      = const SoAIterator*;               //!< Pointer return type.
+   using ReferenceType    = const Element;                    //!< Reference return type.
+   using DifferenceType   = ptrdiff_t;                        //!< Difference between two iterators.
+
+   // STL iterator requirements
+   using iterator_category = IteratorCategory;  //!< The iterator category.
+   using value_type        = ValueType;         //!< Type of the underlying elements.
+   using pointer           = PointerType;       //!< Pointer return type.
+   using reference         = ReferenceType;     //!< Reference return type.
+   using difference_type   = DifferenceType;    //!< Difference between two iterators.
+   //**********************************************************************************************
+
+   //**Constructors********************************************************************************
+   /*!\brief Default constructor for the SoAIterator class.
+   */
+   inline SoAIterator() noexcept
+      : value_( nullptr )  // Pointer to the value of the current element
+      , index_( nullptr )  // Pointer to the index of the current element
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Constructor for the SoAIterator class.
+   //
+   // \param value Pointer to the value of the initial element.
+   // \param index Pointer to the index of the initial element.
+   */
+   inline SoAIterator( Type* value, const IndexType* index ) noexcept
+      : value_( value )  // Pointer to the value of the current element
+      , index_( index )  // Pointer to the index of the current element
+   {}
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   /*!\brief Conversion constructor from different SoAIterator instances.
+   //
+   // \param it The iterator to be copied.
+   */
+   template< typename Other
+           , typename = EnableIf_t< IsConvertible_v<Other*,Type*> > >
+   inline SoAIterator( const SoAIterator<Other,IndexType>& it ) noexcept
+      : value_( it.value_ )  // Pointer to the value of the current element
+      , index_( it.index_ )  // Pointer to the index of the current element
+   {}
+   //**********************************************************************************************
+
+   //**Prefix increment operator*******************************************************************
+   /*!\brief Pre-increment operator.
+   //
+   // \return Reference to the incremented iterator.
+   */
+   inline SoAIterator& operator++() noexcept {
+      ++value_;
+      ++index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix increment operator******************************************************************
+   /*!\brief Post-increment operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SoAIterator operator++( int ) noexcept {
+      const SoAIterator tmp( *this );
+      ++(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Prefix decrement operator*******************************************************************
+   /*!\brief Pre-decrement operator.
+   //
+   // \return Reference to the decremented iterator.
+   */
+   inline SoAIterator& operator--() noexcept {
+      --value_;
+      --index_;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Postfix decrement operator******************************************************************
+   /*!\brief Post-decrement operator.
+   //
+   // \return The previous position of the iterator.
+   */
+   inline const SoAIterator operator--( int ) noexcept {
+      const SoAIterator tmp( *this );
+      --(*this);
+      return tmp;
+   }
+   //**********************************************************************************************
+
+   //**Addition assignment operator****************************************************************
+   /*!\brief Addition assignment operator.
+   //
+   // \param inc The increment of the iterator.
+   // \return The incremented iterator.
+   */
+   inline SoAIterator& operator+=( ptrdiff_t inc ) noexcept {
+      value_ += inc;
+      index_ += inc;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction assignment operator*************************************************************
+   /*!\brief Subtraction assignment operator.
+   //
+   // \param dec The decrement of the iterator.
+   // \return The decremented iterator.
+   */
+   inline SoAIterator& operator-=( ptrdiff_t dec ) noexcept {
+      value_ -= dec;
+      index_ -= dec;
+      return *this;
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return The current value-index-pair.
+   */
+   inline ReferenceType operator*() const {
+      return Element( *value_, *index_ );
+   }
+   //**********************************************************************************************
+
+   //**Element access operator*********************************************************************
+   /*!\brief Direct access to the element at the current iterator position.
+   //
+   // \return Pointer to the iterator, which provides access to the current value and index.
+   */
+   inline PointerType operator->() const noexcept {
+      return this;
+   }
+   //**********************************************************************************************
+
+   //**Value function******************************************************************************
+   /*!\brief Access to the current value of the sparse element.
+   //
+   // \return Reference to the current value of the sparse element.
+   */
+   inline Type& value() const noexcept {
+      return *value_;
+   }
+   //**********************************************************************************************
+
+   //**Index function******************************************************************************
+   /*!\brief Access to the current index of the sparse element.
+   //
+   // \return The current index of the sparse element.
+   */
+   inline size_t index() const noexcept {
+      return *index_;
+   }
+   //**********************************************************************************************
+
+   //**Equality operator***************************************************************************
+   /*!\brief Equality comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators refer to the same element, \a false if not.
+   */
+   friend inline bool operator==( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ == rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Inequality operator*************************************************************************
+   /*!\brief Inequality comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the iterators don't refer to the same element, \a false if they do.
+   */
+   friend inline bool operator!=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ != rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-than operator**************************************************************************
+   /*!\brief Less-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller, \a false if not.
+   */
+   friend inline bool operator<( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ < rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-than operator***********************************************************************
+   /*!\brief Greater-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater, \a false if not.
+   */
+   friend inline bool operator>( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ > rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Less-or-equal-than operator*****************************************************************
+   /*!\brief Less-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is smaller or equal, \a false if not.
+   */
+   friend inline bool operator<=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ <= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Greater-or-equal-than operator**************************************************************
+   /*!\brief Greater-than comparison between two SoAIterator objects.
+   //
+   // \param lhs The left-hand side iterator.
+   // \param rhs The right-hand side iterator.
+   // \return \a true if the left-hand side iterator is greater or equal, \a false if not.
+   */
+   friend inline bool operator>=( const SoAIterator& lhs, const SoAIterator& rhs ) noexcept {
+      return lhs.index_ >= rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Calculating the number of elements between two SoAIterator objects.
+   //
+   // \param rhs The right-hand side iterator.
+   // \return The number of elements between the two iterators.
+   */
+   inline DifferenceType operator-( const SoAIterator& rhs ) const noexcept {
+      return index_ - rhs.index_;
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between a SoAIterator and an integral value.
+   //
+   // \param it The iterator to be incremented.
+   // \param inc The number of elements the iterator is incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SoAIterator operator+( const SoAIterator& it, ptrdiff_t inc ) noexcept {
+      return SoAIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Addition operator***************************************************************************
+   /*!\brief Addition between an integral value and a SoAIterator.
+   //
+   // \param inc The number of elements the iterator is incremented.
+   // \param it The iterator to be incremented.
+   // \return The incremented iterator.
+   */
+   friend inline const SoAIterator operator+( ptrdiff_t inc, const SoAIterator& it ) noexcept {
+      return SoAIterator( it.value_ + inc, it.index_ + inc );
+   }
+   //**********************************************************************************************
+
+   //**Subtraction operator************************************************************************
+   /*!\brief Subtraction between a SoAIterator and an integral value.
+   //
+   // \param it The iterator to be decremented.
+   // \param dec The number of elements the iterator is decremented.
+   // \return The decremented iterator.
+   */
+   friend inline const SoAIterator operator-( const SoAIterator& it, ptrdiff_t dec ) noexcept {
+      return SoAIterator( it.value_ - dec, it.index_ - dec );
+   }
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   Type*            value_;  //!< Pointer to the value of the current element.
+   const IndexType* index_;  //!< Pointer to the index of the current element.
+   //**********************************************************************************************
+
+   //**Friend declarations*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   template< typename Other, typename IT > friend class SoAIterator;
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
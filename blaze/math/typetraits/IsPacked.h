@@ -0,0 +1,143 @@
+//=================================================================================================
+/*!
+//  \file blaze/math/typetraits/IsPacked.h
+//  \brief Header file for the IsPacked type trait
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_MATH_TYPETRAITS_ISPACKED_H_
+#define _BLAZE_MATH_TYPETRAITS_ISPACKED_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/util/FalseType.h>
+#include <blaze/util/TrueType.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compile time check for matrix types with packed triangular storage.
+// \ingroup math_type_traits
+//
+// This type trait tests whether the given data type is a square matrix type that stores only
+// one of its triangular parts in a packed array of \f$ N(N+1)/2 \f$ elements (see the
+// PackedMatrix class template). In case the data type uses packed storage, the \a value member
+// constant is set to \a true, the nested type definition \a Type is \a TrueType, and the class
+// derives from \a TrueType. Otherwise \a value is set to \a false, \a Type is \a FalseType,
+// and the class derives from \a FalseType. Examples:
+
+   \code
+   using blaze::DynamicMatrix;
+   using blaze::PackedMatrix;
+
+   blaze::IsPacked< SymmetricMatrix< PackedMatrix<double> > >::value  // Evaluates to 1
+   blaze::IsPacked< const LowerMatrix< PackedMatrix<float> > >::Type  // Results in TrueType
+   blaze::IsPacked< volatile UpperMatrix< PackedMatrix<int> > >       // Is derived from TrueType
+   blaze::IsPacked< int >::value                                      // Evaluates to 0
+   blaze::IsPacked< const SymmetricMatrix< DynamicMatrix<double> > >::Type  // Results in FalseType
+   blaze::IsPacked< volatile DynamicMatrix<double> >                  // Is derived from FalseType
+   \endcode
+*/
+template< typename T >
+struct IsPacked
+   : public FalseType
+{};
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPacked type trait for const types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPacked< const T >
+   : public IsPacked<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPacked type trait for volatile types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPacked< volatile T >
+   : public IsPacked<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Specialization of the IsPacked type trait for cv qualified types.
+// \ingroup math_type_traits
+*/
+template< typename T >
+struct IsPacked< const volatile T >
+   : public IsPacked<T>
+{};
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary variable template for the IsPacked type trait.
+// \ingroup type_traits
+//
+// The IsPacked_v variable template provides a convenient shortcut to access the nested \a value
+// of the IsPacked class template. For instance, given the type \a T the following two statements
+// are identical:
+
+   \code
+   constexpr bool value1 = blaze::IsPacked<T>::value;
+   constexpr bool value2 = blaze::IsPacked_v<T>;
+   \endcode
+*/
+template< typename T >
+constexpr bool IsPacked_v = IsPacked<T>::value;
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -64,9 +64,11 @@
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/ColumnTrait.h>
 #include <blaze/math/traits/CrossTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -2269,6 +2271,7 @@ class Column<MT,false,true,false,CCAs...>
    using ResultType    = ColumnTrait_t<MT,CCAs...>;    //!< Result type for expression template evaluations.
    using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<MT>;            //!< Type of the column elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;     //!< SIMD type of the column elements.
    using ReturnType    = ReturnType_t<MT>;             //!< Return type for expression template evaluations
    using CompositeType = const Column&;                //!< Data type for composite expression templates.
 
@@ -2479,6 +2482,115 @@ class Column<MT,false,true,false,CCAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the dense column by means
+      // of a strided SIMD gather operation. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( matrix_->data() + row_*matrix_->spacing() + column_, matrix_->spacing() );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the dense column.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense column.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the dense column.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the dense column.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( matrix_->data() + row_*matrix_->spacing() + column_, matrix_->spacing(), value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the dense column.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the dense column.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense column.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned, non-temporal store of the current SIMD element of the
+      // dense column. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two ColumnIterator objects.
       //
@@ -2622,7 +2734,11 @@ class Column<MT,false,true,false,CCAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The elements of the column are loaded and stored by means of strided SIMD gather and
+       scatter operations in case these are available for the element type and the underlying
+       matrix provides low-level access to its elements (see the HasSIMDGather type trait). */
+   static constexpr bool simdEnabled =
+      ( MT::simdEnabled && HasConstDataAccess_v<MT> && HasSIMDGather_v<ElementType> );
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -2702,6 +2818,54 @@ class Column<MT,false,true,false,CCAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled && HasMutableDataAccess_v<MT> &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDSub_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedMultAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDMult_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedDivAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDDiv_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+ public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -2720,15 +2884,52 @@ class Column<MT,false,true,false,CCAs...>
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT > inline void assign    ( const DenseVector <VT,false>& rhs );
-   template< typename VT > inline void assign    ( const SparseVector<VT,false>& rhs );
-   template< typename VT > inline void addAssign ( const DenseVector <VT,false>& rhs );
-   template< typename VT > inline void addAssign ( const SparseVector<VT,false>& rhs );
-   template< typename VT > inline void subAssign ( const DenseVector <VT,false>& rhs );
-   template< typename VT > inline void subAssign ( const SparseVector<VT,false>& rhs );
-   template< typename VT > inline void multAssign( const DenseVector <VT,false>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,false>& rhs ) -> DisableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT > inline void assign( const SparseVector<VT,false>& rhs );
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,false>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,false>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT > inline void addAssign( const SparseVector<VT,false>& rhs );
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,false>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,false>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT > inline void subAssign( const SparseVector<VT,false>& rhs );
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,false>& rhs ) -> DisableIf_t< VectorizedMultAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,false>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT> >;
+
    template< typename VT > inline void multAssign( const SparseVector<VT,false>& rhs );
-   template< typename VT > inline void divAssign ( const DenseVector <VT,false>& rhs );
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,false>& rhs ) -> DisableIf_t< VectorizedDivAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,false>& rhs ) -> EnableIf_t< VectorizedDivAssign_v<VT> >;
    //@}
    //**********************************************************************************************
 
@@ -3848,6 +4049,189 @@ inline bool Column<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense column. The index must be
+// smaller than the number of matrix rows. This function must \b NOT be called explicitly! It is
+// used internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Column<MT,false,true,false,CCAs...>::SIMDType
+   Column<MT,false,true,false,CCAs...>::load( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense column. Since
+// the elements of the column are gathered, this function is identical to the unaligned load. The
+// index must be smaller than the number of matrix rows. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Column<MT,false,true,false,CCAs...>::SIMDType
+   Column<MT,false,true,false,CCAs...>::loada( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense column by
+// means of a strided SIMD gather operation. The index must be smaller than the number of matrix
+// rows. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Column<MT,false,true,false,CCAs...>::SIMDType
+   Column<MT,false,true,false,CCAs...>::loadu( size_t index ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid column access index" );
+
+   return gather( matrix_.data() + index*matrix_.spacing() + column(), matrix_.spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense column. The index must
+// be smaller than the number of matrix rows. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Column<MT,false,true,false,CCAs...>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense column. Since
+// the elements of the column are scattered, this function is identical to the unaligned store.
+// The index must be smaller than the number of matrix rows. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Column<MT,false,true,false,CCAs...>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense column by
+// means of a strided SIMD scatter operation. The index must be smaller than the number of matrix
+// rows. This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result in
+// erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Column<MT,false,true,false,CCAs...>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid column access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid column access index" );
+
+   scatter( matrix_.data() + index*matrix_.spacing() + column(), matrix_.spacing(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense column.
+//
+// \param index Access index. The index must be smaller than the number of matrix rows.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the dense
+// column. Since the elements of the column are scattered, this function is identical to the
+// unaligned store. The index must be smaller than the number of matrix rows. This function must
+// \b NOT be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Column<MT,false,true,false,CCAs...>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a dense vector.
@@ -3863,7 +4247,8 @@ inline bool Column<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Column<MT,false,true,false,CCAs...>::assign( const DenseVector<VT,false>& rhs )
+inline auto Column<MT,false,true,false,CCAs...>::assign( const DenseVector<VT,false>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3879,6 +4264,44 @@ inline void Column<MT,false,true,false,CCAs...>::assign( const DenseVector<VT,fa
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Column<MT,false,true,false,CCAs...>::assign( const DenseVector<VT,false>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      store( i, (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      matrix_(i,column()) = (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a sparse vector.
@@ -3920,7 +4343,8 @@ inline void Column<MT,false,true,false,CCAs...>::assign( const SparseVector<VT,f
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Column<MT,false,true,false,CCAs...>::addAssign( const DenseVector<VT,false>& rhs )
+inline auto Column<MT,false,true,false,CCAs...>::addAssign( const DenseVector<VT,false>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3936,6 +4360,44 @@ inline void Column<MT,false,true,false,CCAs...>::addAssign( const DenseVector<VT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Column<MT,false,true,false,CCAs...>::addAssign( const DenseVector<VT,false>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      store( i, load(i) + (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      matrix_(i,column()) += (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a sparse vector.
@@ -3977,7 +4439,8 @@ inline void Column<MT,false,true,false,CCAs...>::addAssign( const SparseVector<V
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Column<MT,false,true,false,CCAs...>::subAssign( const DenseVector<VT,false>& rhs )
+inline auto Column<MT,false,true,false,CCAs...>::subAssign( const DenseVector<VT,false>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3993,6 +4456,44 @@ inline void Column<MT,false,true,false,CCAs...>::subAssign( const DenseVector<VT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Column<MT,false,true,false,CCAs...>::subAssign( const DenseVector<VT,false>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      store( i, load(i) - (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      matrix_(i,column()) -= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
@@ -4034,7 +4535,8 @@ inline void Column<MT,false,true,false,CCAs...>::subAssign( const SparseVector<V
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Column<MT,false,true,false,CCAs...>::multAssign( const DenseVector<VT,false>& rhs )
+inline auto Column<MT,false,true,false,CCAs...>::multAssign( const DenseVector<VT,false>& rhs )
+   -> DisableIf_t< VectorizedMultAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -4050,6 +4552,44 @@ inline void Column<MT,false,true,false,CCAs...>::multAssign( const DenseVector<V
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Column<MT,false,true,false,CCAs...>::multAssign( const DenseVector<VT,false>& rhs )
+   -> EnableIf_t< VectorizedMultAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      store( i, load(i) * (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      matrix_(i,column()) *= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the multiplication assignment of a sparse vector.
@@ -4104,7 +4644,8 @@ inline void Column<MT,false,true,false,CCAs...>::multAssign( const SparseVector<
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Column<MT,false,true,false,CCAs...>::divAssign( const DenseVector<VT,false>& rhs )
+inline auto Column<MT,false,true,false,CCAs...>::divAssign( const DenseVector<VT,false>& rhs )
+   -> DisableIf_t< VectorizedDivAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -4120,6 +4661,44 @@ inline void Column<MT,false,true,false,CCAs...>::divAssign( const DenseVector<VT
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Column<MT,false,true,false,CCAs...>::divAssign( const DenseVector<VT,false>& rhs )
+   -> EnableIf_t< VectorizedDivAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      store( i, load(i) / (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      matrix_(i,column()) /= (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 
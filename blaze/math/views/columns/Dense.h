@@ -64,8 +64,10 @@
 #include <blaze/math/traits/ColumnsTrait.h>
 #include <blaze/math/traits/SchurTrait.h>
 #include <blaze/math/traits/SubTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsDiagonal.h>
@@ -3132,6 +3134,7 @@ class Columns<MT,false,true,false,CCAs...>
    using OppositeType  = OppositeType_t<ResultType>;   //!< Result type with opposite storage order for expression template evaluations.
    using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<MT>;            //!< Type of the column elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;     //!< SIMD type of the column elements.
    using ReturnType    = ReturnType_t<MT>;             //!< Return type for expression template evaluations.
    using CompositeType = const Columns&;               //!< Data type for composite expression templates.
 
@@ -3342,6 +3345,117 @@ class Columns<MT,false,true,false,CCAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense column selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the dense column selection
+      // by means of a strided SIMD gather operation. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( matrix_->data() + row_*matrix_->spacing() + column_, matrix_->spacing() );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense column selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the dense column
+      // selection. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense column selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the dense column
+      // selection. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense column selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the dense column selection
+      // by means of a strided SIMD scatter operation. This function must \b NOT be called
+      // explicitly! It is used internally for the performance optimized evaluation of expression
+      // templates. Calling this function explicitly might result in erroneous results and/or in
+      // compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( matrix_->data() + row_*matrix_->spacing() + column_, matrix_->spacing(), value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense column selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the dense column
+      // selection. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense column selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the dense column
+      // selection. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense column selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned, non-temporal store of the current SIMD element of the
+      // dense column selection. This function must \b NOT be called explicitly! It is used
+      // internally for the performance optimized evaluation of expression templates. Calling this
+      // function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two ColumnsIterator objects.
       //
@@ -3485,7 +3599,11 @@ class Columns<MT,false,true,false,CCAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The elements of the column selection are loaded and stored by means of strided SIMD gather and
+       scatter operations in case these are available for the element type and the underlying
+       matrix provides low-level access to its elements (see the HasSIMDGather type trait). */
+   static constexpr bool simdEnabled =
+      ( MT::simdEnabled && HasConstDataAccess_v<MT> && HasSIMDGather_v<ElementType> );
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -3596,6 +3714,48 @@ class Columns<MT,false,true,false,CCAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && MT2::simdEnabled && HasMutableDataAccess_v<MT> &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<MT2> > &&
+        !IsDiagonal_v<MT2> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDSub_v< ElementType, ElementType_t<MT2> > &&
+        !IsDiagonal_v<MT2> );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename MT2 >
+   static constexpr bool VectorizedSchurAssign_v =
+      ( VectorizedAssign_v<MT2> &&
+        HasSIMDMult_v< ElementType, ElementType_t<MT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+ public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -3614,22 +3774,55 @@ class Columns<MT,false,true,false,CCAs...>
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,true>&   rhs );
-   template< typename MT2 > inline void assign( const DenseMatrix<MT2,false>&  rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t i, size_t j ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t i, size_t j ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t i, size_t j, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t i, size_t j, const SIMDType& value ) noexcept;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> DisableIf_t< VectorizedAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto assign( const DenseMatrix<MT2,false>& rhs ) -> EnableIf_t< VectorizedAssign_v<MT2> >;
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void assign( const SparseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,true>&   rhs );
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto addAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<MT2> >;
+
    template< typename MT2 > inline void addAssign( const DenseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void addAssign( const SparseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,true>&   rhs );
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto subAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<MT2> >;
+
    template< typename MT2 > inline void subAssign( const DenseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void subAssign( const SparseMatrix<MT2,false>& rhs );
 
-   template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,true>&   rhs );
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> DisableIf_t< VectorizedSchurAssign_v<MT2> >;
+
+   template< typename MT2 >
+   inline auto schurAssign( const DenseMatrix<MT2,true>& rhs ) -> EnableIf_t< VectorizedSchurAssign_v<MT2> >;
+
    template< typename MT2 > inline void schurAssign( const DenseMatrix<MT2,false>&  rhs );
    template< typename MT2 > inline void schurAssign( const SparseMatrix<MT2,true>&  rhs );
    template< typename MT2 > inline void schurAssign( const SparseMatrix<MT2,false>& rhs );
@@ -5105,6 +5298,202 @@ inline bool Columns<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense column selection. The row
+// index must be smaller than the number of rows and the column index must be smaller than the
+// number of columns. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Columns<MT,false,true,false,CCAs...>::SIMDType
+   Columns<MT,false,true,false,CCAs...>::load( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense column
+// selection. Since the elements are gathered, this function is identical to the unaligned load.
+// The row index must be smaller than the number of rows and the column index must be smaller than
+// the number of columns. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Columns<MT,false,true,false,CCAs...>::SIMDType
+   Columns<MT,false,true,false,CCAs...>::loada( size_t i, size_t j ) const noexcept
+{
+   return loadu( i, j );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense column
+// selection by means of a strided SIMD gather operation. The row index must be smaller than the
+// number of rows and the column index must be smaller than the number of columns. This function
+// must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE typename Columns<MT,false,true,false,CCAs...>::SIMDType
+   Columns<MT,false,true,false,CCAs...>::loadu( size_t i, size_t j ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows(), "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()         , "Invalid column access index" );
+
+   return gather( matrix_.data() + i*matrix_.spacing() + idx(j), matrix_.spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense column selection. The
+// row index must be smaller than the number of rows and the column index must be smaller than the
+// number of columns. This function must \b NOT be called explicitly! It is used internally for
+// the performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Columns<MT,false,true,false,CCAs...>::store( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense column
+// selection. Since the elements are scattered, this function is identical to the unaligned store.
+// The row index must be smaller than the number of rows and the column index must be smaller than
+// the number of columns. This function must \b NOT be called explicitly! It is used internally
+// for the performance optimized evaluation of expression templates. Calling this function
+// explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Columns<MT,false,true,false,CCAs...>::storea( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense column
+// selection by means of a strided SIMD scatter operation. The row index must be smaller than the
+// number of rows and the column index must be smaller than the number of columns. This function
+// must \b NOT be called explicitly! It is used internally for the performance optimized
+// evaluation of expression templates. Calling this function explicitly might result in erroneous
+// results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Columns<MT,false,true,false,CCAs...>::storeu( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( i < rows()            , "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( i + SIMDSIZE <= rows(), "Invalid row access index"    );
+   BLAZE_INTERNAL_ASSERT( j < columns()         , "Invalid column access index" );
+
+   scatter( matrix_.data() + i*matrix_.spacing() + idx(j), matrix_.spacing(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense column selection.
+//
+// \param i Access index for the row. The index has to be in the range [0..M-1].
+// \param j Access index for the column. The index has to be in the range [0..N-1].
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the dense
+// column selection. Since the elements are scattered, this function is identical to the unaligned
+// store. The row index must be smaller than the number of rows and the column index must be
+// smaller than the number of columns. This function must \b NOT be called explicitly! It is used
+// internally for the performance optimized evaluation of expression templates. Calling this
+// function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+BLAZE_ALWAYS_INLINE void
+   Columns<MT,false,true,false,CCAs...>::stream( size_t i, size_t j, const SIMDType& value ) noexcept
+{
+   storeu( i, j, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major dense matrix.
@@ -5120,7 +5509,8 @@ inline bool Columns<MT,false,true,false,CCAs...>::canSMPAssign() const noexcept
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+inline auto Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
@@ -5146,6 +5536,52 @@ inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      const size_t index( idx(j) );
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         store( i, j, (~rhs).load(i,j) );
+      }
+      for( ; i<rows(); ++i ) {
+         matrix_(i,index) = (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a row-major dense matrix.
@@ -5161,7 +5597,8 @@ inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+inline auto Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
@@ -5207,6 +5644,53 @@ inline void Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a row-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Columns<MT,false,true,false,CCAs...>::assign( const DenseMatrix<MT2,false>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT2 );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t jpos( columns() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( columns() - ( columns() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   for( size_t i=0UL; i<rows(); ++i )
+   {
+      size_t j( 0UL );
+
+      for( ; j<jpos; j+=SIMDSIZE ) {
+         scatter( matrix_.data() + i*matrix_.spacing(), idces().data() + j, (~rhs).load(i,j) );
+      }
+      for( ; j<columns(); ++j ) {
+         matrix_(i,idx(j)) = (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a column-major sparse matrix.
@@ -5289,7 +5773,8 @@ inline void Columns<MT,false,true,false,CCAs...>::assign( const SparseMatrix<MT2
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Columns<MT,false,true,false,CCAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto Columns<MT,false,true,false,CCAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
@@ -5321,6 +5806,52 @@ inline void Columns<MT,false,true,false,CCAs...>::addAssign( const DenseMatrix<M
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Columns<MT,false,true,false,CCAs...>::addAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      const size_t index( idx(j) );
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         store( i, j, load(i,j) + (~rhs).load(i,j) );
+      }
+      for( ; i<rows(); ++i ) {
+         matrix_(i,index) += (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a row-major dense matrix.
@@ -5463,7 +5994,8 @@ inline void Columns<MT,false,true,false,CCAs...>::addAssign( const SparseMatrix<
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Columns<MT,false,true,false,CCAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto Columns<MT,false,true,false,CCAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
@@ -5496,6 +6028,52 @@ inline void Columns<MT,false,true,false,CCAs...>::subAssign( const DenseMatrix<M
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Columns<MT,false,true,false,CCAs...>::subAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      const size_t index( idx(j) );
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         store( i, j, load(i,j) - (~rhs).load(i,j) );
+      }
+      for( ; i<rows(); ++i ) {
+         matrix_(i,index) -= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a row-major dense matrix.
@@ -5638,7 +6216,8 @@ inline void Columns<MT,false,true,false,CCAs...>::subAssign( const SparseMatrix<
 template< typename MT       // Type of the dense matrix
         , size_t... CCAs >  // Compile time column arguments
 template< typename MT2 >    // Type of the right-hand side dense matrix
-inline void Columns<MT,false,true,false,CCAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+inline auto Columns<MT,false,true,false,CCAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> DisableIf_t< VectorizedSchurAssign_v<MT2> >
 {
    BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
    BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
@@ -5664,6 +6243,52 @@ inline void Columns<MT,false,true,false,CCAs...>::schurAssign( const DenseMatrix
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the Schur product assignment of a column-major dense matrix.
+//
+// \param rhs The right-hand side dense matrix for the Schur product.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CCAs >  // Compile time column arguments
+template< typename MT2 >    // Type of the right-hand side dense matrix
+inline auto Columns<MT,false,true,false,CCAs...>::schurAssign( const DenseMatrix<MT2,true>& rhs )
+   -> EnableIf_t< VectorizedSchurAssign_v<MT2> >
+{
+   BLAZE_CONSTRAINT_MUST_NOT_BE_SYMMETRIC_MATRIX_TYPE( MT );
+   BLAZE_CONSTRAINT_MUST_NOT_BE_HERMITIAN_MATRIX_TYPE( MT );
+
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( rows()    == (~rhs).rows()   , "Invalid number of rows"    );
+   BLAZE_INTERNAL_ASSERT( columns() == (~rhs).columns(), "Invalid number of columns" );
+
+   const size_t ipos( rows() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( rows() - ( rows() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   for( size_t j=0UL; j<columns(); ++j )
+   {
+      const size_t index( idx(j) );
+      size_t i( 0UL );
+
+      for( ; i<ipos; i+=SIMDSIZE ) {
+         store( i, j, load(i,j) * (~rhs).load(i,j) );
+      }
+      for( ; i<rows(); ++i ) {
+         matrix_(i,index) *= (~rhs)(i,j);
+      }
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the Schur product assignment of a row-major dense matrix.
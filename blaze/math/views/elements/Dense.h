@@ -57,18 +57,28 @@
 #include <blaze/math/shims/Clear.h>
 #include <blaze/math/shims/IsDefault.h>
 #include <blaze/math/shims/Reset.h>
+#include <blaze/math/SIMD.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/ElementsTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
+#include <blaze/math/typetraits/IsContiguous.h>
 #include <blaze/math/typetraits/IsExpression.h>
 #include <blaze/math/typetraits/IsRestricted.h>
+#include <blaze/math/typetraits/IsSIMDCombinable.h>
 #include <blaze/math/typetraits/IsSparseVector.h>
 #include <blaze/math/views/Check.h>
 #include <blaze/math/views/elements/BaseTemplate.h>
 #include <blaze/math/views/elements/ElementsData.h>
+#include <blaze/system/Inline.h>
+#include <blaze/system/Optimizations.h>
 #include <blaze/system/Thresholds.h>
 #include <blaze/util/Assert.h>
+#include <blaze/util/constraints/Vectorizable.h>
 #include <blaze/util/DecltypeAuto.h>
+#include <blaze/util/DisableIf.h>
+#include <blaze/util/EnableIf.h>
 #include <blaze/util/mpl/If.h>
 #include <blaze/util/TypeList.h>
 #include <blaze/util/typetraits/IsConst.h>
@@ -113,6 +123,7 @@ class Elements<VT,TF,true,CEAs...>
    using ResultType    = ElementsTrait_t<VT,CEAs...>;  //!< Result type for expression template evaluations.
    using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<VT>;            //!< Type of the elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;     //!< SIMD type of the elements.
    using ReturnType    = ReturnType_t<VT>;             //!< Return type for expression template evaluations
    using CompositeType = const Elements&;              //!< Data type for composite expression templates.
 
@@ -318,6 +329,115 @@ class Elements<VT,TF,true,CEAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the element selection.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return elements_->load( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the element
+      // selection. This function must \b NOT be called explicitly! It is used internally for
+      // the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return elements_->loada( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the element selection.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the element
+      // selection. This function must \b NOT be called explicitly! It is used internally for
+      // the performance optimized evaluation of expression templates. Calling this function
+      // explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return elements_->loadu( index_ );
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the element selection.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         elements_->store( index_, value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the element selection.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the element selection.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the element selection.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned, non-temporal store of the current SIMD element of the
+      // element selection. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two ElementsIterator objects.
       //
@@ -454,7 +574,12 @@ class Elements<VT,TF,true,CEAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The elements of the selection are loaded and stored by means of SIMD gather and scatter
+       operations in case these are available for the element type and the underlying vector
+       provides low-level access to its contiguous elements (see the HasSIMDGather type trait). */
+   static constexpr bool simdEnabled =
+      ( VT::simdEnabled && HasConstDataAccess_v<VT> && IsContiguous_v<VT> &&
+        HasSIMDGather_v<ElementType> );
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = VT::smpAssignable;
@@ -535,6 +660,25 @@ class Elements<VT,TF,true,CEAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   /*! Note that only the plain assignment is vectorized since the addition, subtraction,
+       multiplication, and division assignments must accumulate all contributions to repeated
+       indices. */
+   template< typename VT2 >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT2::simdEnabled && HasMutableDataAccess_v<VT> &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT2> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+ public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -547,7 +691,21 @@ class Elements<VT,TF,true,CEAs...>
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT2 > inline void assign    ( const DenseVector <VT2,TF>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> DisableIf_t< VectorizedAssign_v<VT2> >;
+
+   template< typename VT2 >
+   inline auto assign( const DenseVector<VT2,TF>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT2> >;
+
    template< typename VT2 > inline void assign    ( const SparseVector<VT2,TF>& rhs );
    template< typename VT2 > inline void addAssign ( const DenseVector <VT2,TF>& rhs );
    template< typename VT2 > inline void addAssign ( const SparseVector<VT2,TF>& rhs );
@@ -1613,6 +1771,198 @@ inline bool Elements<VT,TF,true,CEAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the element selection by means
+// of a SIMD gather operation. The index must be smaller than the number of selected elements.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE typename Elements<VT,TF,true,CEAs...>::SIMDType
+   Elements<VT,TF,true,CEAs...>::load( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the element selection.
+// Since the selected elements are gathered, this function is identical to the unaligned load.
+// The index must be smaller than the number of selected elements. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE typename Elements<VT,TF,true,CEAs...>::SIMDType
+   Elements<VT,TF,true,CEAs...>::loada( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the element selection
+// by means of a SIMD gather operation. The index must be smaller than the number of selected
+// elements. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE typename Elements<VT,TF,true,CEAs...>::SIMDType
+   Elements<VT,TF,true,CEAs...>::loadu( size_t index ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid element access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid element access index" );
+
+   return gather( vector_.data(), idces().data() + index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the element selection by means
+// of a SIMD scatter operation. The index must be smaller than the number of selected elements.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE void
+   Elements<VT,TF,true,CEAs...>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the element selection.
+// Since the selected elements are scattered, this function is identical to the unaligned store.
+// The index must be smaller than the number of selected elements. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results
+// and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE void
+   Elements<VT,TF,true,CEAs...>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the element selection
+// by means of a SIMD scatter operation. The index must be smaller than the number of selected
+// elements. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE void
+   Elements<VT,TF,true,CEAs...>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid element access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid element access index" );
+
+   scatter( vector_.data(), idces().data() + index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the element selection.
+//
+// \param index Access index. The index must be smaller than the number of selected elements.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the
+// element selection. Since the selected elements are scattered, this function is identical
+// to the unaligned store. The index must be smaller than the number of selected elements.
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+BLAZE_ALWAYS_INLINE void
+   Elements<VT,TF,true,CEAs...>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a dense vector.
@@ -1629,7 +1979,8 @@ template< typename VT       // Type of the dense vector
         , bool TF           // Transpose flag
         , size_t... CEAs >  // Compile time element arguments
 template< typename VT2 >    // Type of the right-hand side dense vector
-inline void Elements<VT,TF,true,CEAs...>::assign( const DenseVector<VT2,TF>& rhs )
+inline auto Elements<VT,TF,true,CEAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<VT2> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -1646,6 +1997,45 @@ inline void Elements<VT,TF,true,CEAs...>::assign( const DenseVector<VT2,TF>& rhs
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename VT       // Type of the dense vector
+        , bool TF           // Transpose flag
+        , size_t... CEAs >  // Compile time element arguments
+template< typename VT2 >    // Type of the right-hand side dense vector
+inline auto Elements<VT,TF,true,CEAs...>::assign( const DenseVector<VT2,TF>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT2> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t ipos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == ipos, "Invalid end calculation" );
+
+   size_t i( 0UL );
+
+   for( ; i<ipos; i+=SIMDSIZE ) {
+      storeu( i, (~rhs).load(i) );
+   }
+   for( ; i<size(); ++i ) {
+      vector_[idx(i)] = (~rhs)[i];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a sparse vector.
@@ -65,9 +65,11 @@
 #include <blaze/math/SIMD.h>
 #include <blaze/math/traits/CrossTrait.h>
 #include <blaze/math/traits/RowTrait.h>
+#include <blaze/math/typetraits/HasConstDataAccess.h>
 #include <blaze/math/typetraits/HasMutableDataAccess.h>
 #include <blaze/math/typetraits/HasSIMDAdd.h>
 #include <blaze/math/typetraits/HasSIMDDiv.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/HasSIMDMult.h>
 #include <blaze/math/typetraits/HasSIMDSub.h>
 #include <blaze/math/typetraits/IsExpression.h>
@@ -2271,6 +2273,7 @@ class Row<MT,false,true,false,CRAs...>
    using ResultType    = RowTrait_t<MT,CRAs...>;       //!< Result type for expression template evaluations.
    using TransposeType = TransposeType_t<ResultType>;  //!< Transpose type for expression template evaluations.
    using ElementType   = ElementType_t<MT>;            //!< Type of the row elements.
+   using SIMDType      = SIMDTrait_t<ElementType>;     //!< SIMD type of the row elements.
    using ReturnType    = ElementType_t<MT>;            //!< Return type for expression template evaluations
    using CompositeType = const Row&;                   //!< Data type for composite expression templates.
 
@@ -2481,6 +2484,115 @@ class Row<MT,false,true,false,CRAs...>
       }
       //*******************************************************************************************
 
+      //**Load function****************************************************************************
+      /*!\brief Load of a SIMD element of the dense row.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs a load of the current SIMD element of the dense row by means
+      // of a strided SIMD gather operation. This function must \b NOT be called explicitly! It is
+      // used internally for the performance optimized evaluation of expression templates. Calling
+      // this function explicitly might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType load() const noexcept {
+         return gather( matrix_->data() + row_ + column_*matrix_->spacing(), matrix_->spacing() );
+      }
+      //*******************************************************************************************
+
+      //**Loada function***************************************************************************
+      /*!\brief Aligned load of a SIMD element of the dense row.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an aligned load of the current SIMD element of the dense row.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loada() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Loadu function***************************************************************************
+      /*!\brief Unaligned load of a SIMD element of the dense row.
+      //
+      // \return The loaded SIMD element.
+      //
+      // This function performs an unaligned load of the current SIMD element of the dense row.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE SIMDType loadu() const noexcept {
+         return load();
+      }
+      //*******************************************************************************************
+
+      //**Store function***************************************************************************
+      /*!\brief Store of a SIMD element of the dense row.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs a store of the current SIMD element of the dense row.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void store( const SIMDType& value ) const noexcept {
+         scatter( matrix_->data() + row_ + column_*matrix_->spacing(), matrix_->spacing(), value );
+      }
+      //*******************************************************************************************
+
+      //**Storea function**************************************************************************
+      /*!\brief Aligned store of a SIMD element of the dense row.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned store of the current SIMD element of the dense row.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storea( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Storeu function**************************************************************************
+      /*!\brief Unaligned store of a SIMD element of the dense row.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an unaligned store of the current SIMD element of the dense row.
+      // This function must \b NOT be called explicitly! It is used internally for the performance
+      // optimized evaluation of expression templates. Calling this function explicitly might
+      // result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void storeu( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
+      //**Stream function**************************************************************************
+      /*!\brief Aligned, non-temporal store of a SIMD element of the dense row.
+      //
+      // \param value The SIMD element to be stored.
+      // \return void
+      //
+      // This function performs an aligned, non-temporal store of the current SIMD element of the
+      // dense row. This function must \b NOT be called explicitly! It is used internally for the
+      // performance optimized evaluation of expression templates. Calling this function explicitly
+      // might result in erroneous results and/or in compilation errors.
+      */
+      BLAZE_ALWAYS_INLINE void stream( const SIMDType& value ) const noexcept {
+         store( value );
+      }
+      //*******************************************************************************************
+
       //**Equality operator************************************************************************
       /*!\brief Equality comparison between two RowIterator objects.
       //
@@ -2624,7 +2736,11 @@ class Row<MT,false,true,false,CRAs...>
 
    //**Compilation flags***************************************************************************
    //! Compilation switch for the expression template evaluation strategy.
-   static constexpr bool simdEnabled = false;
+   /*! The elements of the row are loaded and stored by means of strided SIMD gather and
+       scatter operations in case these are available for the element type and the underlying
+       matrix provides low-level access to its elements (see the HasSIMDGather type trait). */
+   static constexpr bool simdEnabled =
+      ( MT::simdEnabled && HasConstDataAccess_v<MT> && HasSIMDGather_v<ElementType> );
 
    //! Compilation switch for the expression template assignment strategy.
    static constexpr bool smpAssignable = MT::smpAssignable;
@@ -2704,6 +2820,54 @@ class Row<MT,false,true,false,CRAs...>
    //@}
    //**********************************************************************************************
 
+ private:
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAssign_v =
+      ( useOptimizedKernels &&
+        simdEnabled && VT::simdEnabled && HasMutableDataAccess_v<MT> &&
+        IsSIMDCombinable_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedAddAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDAdd_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedSubAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDSub_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedMultAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDMult_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**********************************************************************************************
+   //! Helper variable template for the explicit application of the SFINAE principle.
+   template< typename VT >
+   static constexpr bool VectorizedDivAssign_v =
+      ( VectorizedAssign_v<VT> &&
+        HasSIMDDiv_v< ElementType, ElementType_t<VT> > );
+   //**********************************************************************************************
+
+   //**SIMD properties*****************************************************************************
+   //! The number of elements packed within a single SIMD element.
+   static constexpr size_t SIMDSIZE = SIMDTrait<ElementType>::size;
+   //**********************************************************************************************
+
+ public:
    //**Expression template evaluation functions****************************************************
    /*!\name Expression template evaluation functions */
    //@{
@@ -2722,15 +2886,52 @@ class Row<MT,false,true,false,CRAs...>
    inline bool isAligned   () const noexcept;
    inline bool canSMPAssign() const noexcept;
 
-   template< typename VT > inline void assign    ( const DenseVector <VT,true>& rhs );
-   template< typename VT > inline void assign    ( const SparseVector<VT,true>& rhs );
-   template< typename VT > inline void addAssign ( const DenseVector <VT,true>& rhs );
-   template< typename VT > inline void addAssign ( const SparseVector<VT,true>& rhs );
-   template< typename VT > inline void subAssign ( const DenseVector <VT,true>& rhs );
-   template< typename VT > inline void subAssign ( const SparseVector<VT,true>& rhs );
-   template< typename VT > inline void multAssign( const DenseVector <VT,true>& rhs );
+   BLAZE_ALWAYS_INLINE SIMDType load ( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loada( size_t index ) const noexcept;
+   BLAZE_ALWAYS_INLINE SIMDType loadu( size_t index ) const noexcept;
+
+   BLAZE_ALWAYS_INLINE void store ( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storea( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void storeu( size_t index, const SIMDType& value ) noexcept;
+   BLAZE_ALWAYS_INLINE void stream( size_t index, const SIMDType& value ) noexcept;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,true>& rhs ) -> DisableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto assign( const DenseVector<VT,true>& rhs ) -> EnableIf_t< VectorizedAssign_v<VT> >;
+
+   template< typename VT > inline void assign( const SparseVector<VT,true>& rhs );
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,true>& rhs ) -> DisableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto addAssign( const DenseVector<VT,true>& rhs ) -> EnableIf_t< VectorizedAddAssign_v<VT> >;
+
+   template< typename VT > inline void addAssign( const SparseVector<VT,true>& rhs );
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,true>& rhs ) -> DisableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto subAssign( const DenseVector<VT,true>& rhs ) -> EnableIf_t< VectorizedSubAssign_v<VT> >;
+
+   template< typename VT > inline void subAssign( const SparseVector<VT,true>& rhs );
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,true>& rhs ) -> DisableIf_t< VectorizedMultAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto multAssign( const DenseVector<VT,true>& rhs ) -> EnableIf_t< VectorizedMultAssign_v<VT> >;
+
    template< typename VT > inline void multAssign( const SparseVector<VT,true>& rhs );
-   template< typename VT > inline void divAssign ( const DenseVector <VT,true>& rhs );
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,true>& rhs ) -> DisableIf_t< VectorizedDivAssign_v<VT> >;
+
+   template< typename VT >
+   inline auto divAssign( const DenseVector<VT,true>& rhs ) -> EnableIf_t< VectorizedDivAssign_v<VT> >;
    //@}
    //**********************************************************************************************
 
@@ -3850,6 +4051,189 @@ inline bool Row<MT,false,true,false,CRAs...>::canSMPAssign() const noexcept
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Load of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \return The loaded SIMD element.
+//
+// This function performs a load of a specific SIMD element of the dense row. The index must be
+// smaller than the number of matrix columns. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE typename Row<MT,false,true,false,CRAs...>::SIMDType
+   Row<MT,false,true,false,CRAs...>::load( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned load of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \return The loaded SIMD element.
+//
+// This function performs an aligned load of a specific SIMD element of the dense row. Since the
+// elements of the row are gathered, this function is identical to the unaligned load. The index
+// must be smaller than the number of matrix columns. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE typename Row<MT,false,true,false,CRAs...>::SIMDType
+   Row<MT,false,true,false,CRAs...>::loada( size_t index ) const noexcept
+{
+   return loadu( index );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned load of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \return The loaded SIMD element.
+//
+// This function performs an unaligned load of a specific SIMD element of the dense row by means
+// of a strided SIMD gather operation. The index must be smaller than the number of matrix
+// columns. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE typename Row<MT,false,true,false,CRAs...>::SIMDType
+   Row<MT,false,true,false,CRAs...>::loadu( size_t index ) const noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid row access index" );
+
+   return gather( matrix_.data() + row() + index*matrix_.spacing(), matrix_.spacing() );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Store of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs a store of a specific SIMD element of the dense row. The index must be
+// smaller than the number of matrix columns. This function must \b NOT be called explicitly! It
+// is used internally for the performance optimized evaluation of expression templates. Calling
+// this function explicitly might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE void
+   Row<MT,false,true,false,CRAs...>::store( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned store of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned store of a specific SIMD element of the dense row. Since the
+// elements of the row are scattered, this function is identical to the unaligned store. The index
+// must be smaller than the number of matrix columns. This function must \b NOT be called
+// explicitly! It is used internally for the performance optimized evaluation of expression
+// templates. Calling this function explicitly might result in erroneous results and/or in
+// compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE void
+   Row<MT,false,true,false,CRAs...>::storea( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Unaligned store of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an unaligned store of a specific SIMD element of the dense row by means
+// of a strided SIMD scatter operation. The index must be smaller than the number of matrix
+// columns. This function must \b NOT be called explicitly! It is used internally for the
+// performance optimized evaluation of expression templates. Calling this function explicitly
+// might result in erroneous results and/or in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE void
+   Row<MT,false,true,false,CRAs...>::storeu( size_t index, const SIMDType& value ) noexcept
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( index < size()            , "Invalid row access index" );
+   BLAZE_INTERNAL_ASSERT( index + SIMDSIZE <= size(), "Invalid row access index" );
+
+   scatter( matrix_.data() + row() + index*matrix_.spacing(), matrix_.spacing(), value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Aligned, non-temporal store of a SIMD element of the dense row.
+//
+// \param index Access index. The index must be smaller than the number of matrix columns.
+// \param value The SIMD element to be stored.
+// \return void
+//
+// This function performs an aligned, non-temporal store of a specific SIMD element of the dense
+// row. Since the elements of the row are scattered, this function is identical to the unaligned
+// store. The index must be smaller than the number of matrix columns. This function must \b NOT
+// be called explicitly! It is used internally for the performance optimized evaluation of
+// expression templates. Calling this function explicitly might result in erroneous results and/or
+// in compilation errors.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+BLAZE_ALWAYS_INLINE void
+   Row<MT,false,true,false,CRAs...>::stream( size_t index, const SIMDType& value ) noexcept
+{
+   storeu( index, value );
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a dense vector.
@@ -3865,7 +4249,8 @@ inline bool Row<MT,false,true,false,CRAs...>::canSMPAssign() const noexcept
 template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Row<MT,false,true,false,CRAs...>::assign( const DenseVector<VT,true>& rhs )
+inline auto Row<MT,false,true,false,CRAs...>::assign( const DenseVector<VT,true>& rhs )
+   -> DisableIf_t< VectorizedAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3881,6 +4266,44 @@ inline void Row<MT,false,true,false,CRAs...>::assign( const DenseVector<VT,true>
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be assigned.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Row<MT,false,true,false,CRAs...>::assign( const DenseVector<VT,true>& rhs )
+   -> EnableIf_t< VectorizedAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t jpos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      store( j, (~rhs).load(j) );
+   }
+   for( ; j<size(); ++j ) {
+      matrix_(row(),j) = (~rhs)[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the assignment of a sparse vector.
@@ -3922,7 +4345,8 @@ inline void Row<MT,false,true,false,CRAs...>::assign( const SparseVector<VT,true
 template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Row<MT,false,true,false,CRAs...>::addAssign( const DenseVector<VT,true>& rhs )
+inline auto Row<MT,false,true,false,CRAs...>::addAssign( const DenseVector<VT,true>& rhs )
+   -> DisableIf_t< VectorizedAddAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3938,6 +4362,44 @@ inline void Row<MT,false,true,false,CRAs...>::addAssign( const DenseVector<VT,tr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the addition assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be added.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Row<MT,false,true,false,CRAs...>::addAssign( const DenseVector<VT,true>& rhs )
+   -> EnableIf_t< VectorizedAddAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t jpos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      store( j, load(j) + (~rhs).load(j) );
+   }
+   for( ; j<size(); ++j ) {
+      matrix_(row(),j) += (~rhs)[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the addition assignment of a sparse vector.
@@ -3979,7 +4441,8 @@ inline void Row<MT,false,true,false,CRAs...>::addAssign( const SparseVector<VT,t
 template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Row<MT,false,true,false,CRAs...>::subAssign( const DenseVector<VT,true>& rhs )
+inline auto Row<MT,false,true,false,CRAs...>::subAssign( const DenseVector<VT,true>& rhs )
+   -> DisableIf_t< VectorizedSubAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -3995,6 +4458,44 @@ inline void Row<MT,false,true,false,CRAs...>::subAssign( const DenseVector<VT,tr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the subtraction assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be subtracted.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Row<MT,false,true,false,CRAs...>::subAssign( const DenseVector<VT,true>& rhs )
+   -> EnableIf_t< VectorizedSubAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t jpos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      store( j, load(j) - (~rhs).load(j) );
+   }
+   for( ; j<size(); ++j ) {
+      matrix_(row(),j) -= (~rhs)[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the subtraction assignment of a sparse vector.
@@ -4036,7 +4537,8 @@ inline void Row<MT,false,true,false,CRAs...>::subAssign( const SparseVector<VT,t
 template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Row<MT,false,true,false,CRAs...>::multAssign( const DenseVector<VT,true>& rhs )
+inline auto Row<MT,false,true,false,CRAs...>::multAssign( const DenseVector<VT,true>& rhs )
+   -> DisableIf_t< VectorizedMultAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -4052,6 +4554,44 @@ inline void Row<MT,false,true,false,CRAs...>::multAssign( const DenseVector<VT,t
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the multiplication assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector to be multiplied.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Row<MT,false,true,false,CRAs...>::multAssign( const DenseVector<VT,true>& rhs )
+   -> EnableIf_t< VectorizedMultAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t jpos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      store( j, load(j) * (~rhs).load(j) );
+   }
+   for( ; j<size(); ++j ) {
+      matrix_(row(),j) *= (~rhs)[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 /*!\brief Default implementation of the multiplication assignment of a sparse vector.
@@ -4106,7 +4646,8 @@ inline void Row<MT,false,true,false,CRAs...>::multAssign( const SparseVector<VT,
 template< typename MT       // Type of the dense matrix
         , size_t... CRAs >  // Compile time row arguments
 template< typename VT >     // Type of the right-hand side dense vector
-inline void Row<MT,false,true,false,CRAs...>::divAssign( const DenseVector<VT,true>& rhs )
+inline auto Row<MT,false,true,false,CRAs...>::divAssign( const DenseVector<VT,true>& rhs )
+   -> DisableIf_t< VectorizedDivAssign_v<VT> >
 {
    BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
 
@@ -4122,6 +4663,44 @@ inline void Row<MT,false,true,false,CRAs...>::divAssign( const DenseVector<VT,tr
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief SIMD optimized implementation of the division assignment of a dense vector.
+//
+// \param rhs The right-hand side dense vector divisor.
+// \return void
+//
+// This function must \b NOT be called explicitly! It is used internally for the performance
+// optimized evaluation of expression templates. Calling this function explicitly might result
+// in erroneous results and/or in compilation errors. Instead of using this function use the
+// assignment operator.
+*/
+template< typename MT       // Type of the dense matrix
+        , size_t... CRAs >  // Compile time row arguments
+template< typename VT >     // Type of the right-hand side dense vector
+inline auto Row<MT,false,true,false,CRAs...>::divAssign( const DenseVector<VT,true>& rhs )
+   -> EnableIf_t< VectorizedDivAssign_v<VT> >
+{
+   BLAZE_CONSTRAINT_MUST_BE_VECTORIZABLE_TYPE( ElementType );
+
+   BLAZE_INTERNAL_ASSERT( size() == (~rhs).size(), "Invalid vector sizes" );
+
+   const size_t jpos( size() & size_t(-SIMDSIZE) );
+   BLAZE_INTERNAL_ASSERT( ( size() - ( size() % SIMDSIZE ) ) == jpos, "Invalid end calculation" );
+
+   size_t j( 0UL );
+
+   for( ; j<jpos; j+=SIMDSIZE ) {
+      store( j, load(j) / (~rhs).load(j) );
+   }
+   for( ; j<size(); ++j ) {
+      matrix_(row(),j) /= (~rhs)[j];
+   }
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
 
 
 
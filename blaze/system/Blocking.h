@@ -41,10 +41,24 @@
 //*************************************************************************************************
 
 #include <blaze/system/Debugging.h>
+#include <blaze/system/Tuning.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
 
+
+
+//=================================================================================================
+//
+//  BLOCK SIZES
+//
+//=================================================================================================
+
+#include <blaze/config/Blocking.h>
+
+
+
+
 namespace blaze {
 
 //=================================================================================================
@@ -57,8 +71,16 @@ namespace blaze {
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DEFAULT_BLOCK_SIZE = 256UL;
 
-constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = 112UL;
-constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE =  96UL;
+constexpr size_t MMM_DEFAULT_OUTER_BLOCK_SIZE = BLAZE_MMM_OUTER_BLOCK_SIZE;
+constexpr size_t MMM_DEFAULT_INNER_BLOCK_SIZE = BLAZE_MMM_INNER_BLOCK_SIZE;
+
+constexpr size_t PMMM_DEFAULT_M_BLOCK_SIZE = BLAZE_PMMM_M_BLOCK_SIZE;
+constexpr size_t PMMM_DEFAULT_N_BLOCK_SIZE = BLAZE_PMMM_N_BLOCK_SIZE;
+constexpr size_t PMMM_DEFAULT_K_BLOCK_SIZE = BLAZE_PMMM_K_BLOCK_SIZE;
+
+constexpr size_t DECOMPOSITION_DEFAULT_BLOCK_SIZE = 64UL;
+
+constexpr size_t TRANSPOSE_DEFAULT_BLOCK_SIZE = 64UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -69,6 +91,14 @@ constexpr size_t DEBUG_BLOCK_SIZE = 8UL;
 
 constexpr size_t MMM_DEBUG_OUTER_BLOCK_SIZE = 16UL;
 constexpr size_t MMM_DEBUG_INNER_BLOCK_SIZE = 16UL;
+
+constexpr size_t PMMM_DEBUG_M_BLOCK_SIZE = 16UL;
+constexpr size_t PMMM_DEBUG_N_BLOCK_SIZE = 48UL;
+constexpr size_t PMMM_DEBUG_K_BLOCK_SIZE = 16UL;
+
+constexpr size_t DECOMPOSITION_DEBUG_BLOCK_SIZE = 4UL;
+
+constexpr size_t TRANSPOSE_DEBUG_BLOCK_SIZE = 16UL;
 /*! \endcond */
 //*************************************************************************************************
 
@@ -79,6 +109,14 @@ constexpr size_t BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DEBUG_BLOCK_SIZE : DEFAULT_BL
 
 constexpr size_t MMM_OUTER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_OUTER_BLOCK_SIZE : MMM_DEFAULT_OUTER_BLOCK_SIZE );
 constexpr size_t MMM_INNER_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? MMM_DEBUG_INNER_BLOCK_SIZE : MMM_DEFAULT_INNER_BLOCK_SIZE );
+
+constexpr size_t PMMM_M_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? PMMM_DEBUG_M_BLOCK_SIZE : PMMM_DEFAULT_M_BLOCK_SIZE );
+constexpr size_t PMMM_N_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? PMMM_DEBUG_N_BLOCK_SIZE : PMMM_DEFAULT_N_BLOCK_SIZE );
+constexpr size_t PMMM_K_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? PMMM_DEBUG_K_BLOCK_SIZE : PMMM_DEFAULT_K_BLOCK_SIZE );
+
+constexpr size_t DECOMPOSITION_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? DECOMPOSITION_DEBUG_BLOCK_SIZE : DECOMPOSITION_DEFAULT_BLOCK_SIZE );
+
+constexpr size_t TRANSPOSE_BLOCK_SIZE = ( BLAZE_DEBUG_MODE ? TRANSPOSE_DEBUG_BLOCK_SIZE : TRANSPOSE_DEFAULT_BLOCK_SIZE );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -102,6 +140,14 @@ BLAZE_STATIC_ASSERT( blaze::BLOCK_SIZE >= 4UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_OUTER_BLOCK_SIZE >= 16UL && blaze::MMM_OUTER_BLOCK_SIZE % 16UL == 0UL );
 BLAZE_STATIC_ASSERT( blaze::MMM_INNER_BLOCK_SIZE >= 16UL && blaze::MMM_INNER_BLOCK_SIZE % 16UL == 0UL );
 
+BLAZE_STATIC_ASSERT( blaze::PMMM_M_BLOCK_SIZE >= 16UL && blaze::PMMM_M_BLOCK_SIZE % 16UL == 0UL );
+BLAZE_STATIC_ASSERT( blaze::PMMM_N_BLOCK_SIZE >= 48UL && blaze::PMMM_N_BLOCK_SIZE % 48UL == 0UL );
+BLAZE_STATIC_ASSERT( blaze::PMMM_K_BLOCK_SIZE >= 16UL && blaze::PMMM_K_BLOCK_SIZE % 16UL == 0UL );
+
+BLAZE_STATIC_ASSERT( blaze::DECOMPOSITION_BLOCK_SIZE >= 1UL );
+
+BLAZE_STATIC_ASSERT( blaze::TRANSPOSE_BLOCK_SIZE >= 16UL && blaze::TRANSPOSE_BLOCK_SIZE % 16UL == 0UL );
+
 }
 /*! \endcond */
 //*************************************************************************************************
@@ -56,6 +56,9 @@ namespace blaze {
 constexpr bool usePadding          = BLAZE_USE_PADDING;
 constexpr bool useStreaming        = BLAZE_USE_STREAMING;
 constexpr bool useOptimizedKernels = BLAZE_USE_OPTIMIZED_KERNELS;
+constexpr bool usePackedKernels    = BLAZE_USE_PACKED_KERNELS;
+constexpr bool useBalancedSpMV     = BLAZE_USE_BALANCED_SPMV;
+constexpr bool useMaskedTails      = BLAZE_USE_MASKED_TAILS;
 /*! \endcond */
 //*************************************************************************************************
 
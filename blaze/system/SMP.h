@@ -153,4 +153,31 @@
 #endif
 //*************************************************************************************************
 
+
+
+//=================================================================================================
+//
+//  FIRST-TOUCH INITIALIZATION CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the first-touch initialization of dense vectors and matrices.
+// \ingroup system
+//
+// This compilation switch is active in case the first-touch initialization has been requested
+// via the \c BLAZE_USE_FIRST_TOUCH_INITIALIZATION switch and any of the shared memory
+// parallelizations is active. In this case the memory of large dense vectors and matrices is
+// initialized in parallel, using the same partitioning as the parallel assignment kernels, such
+// that the memory pages are placed on the NUMA nodes of the threads that later operate on them.
+*/
+#if BLAZE_USE_FIRST_TOUCH_INITIALIZATION && \
+    ( BLAZE_OPENMP_PARALLEL_MODE || BLAZE_HPX_PARALLEL_MODE || \
+      BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE )
+#define BLAZE_FIRST_TOUCH_MODE 1
+#else
+#define BLAZE_FIRST_TOUCH_MODE 0
+#endif
+//*************************************************************************************************
+
 #endif
@@ -41,6 +41,7 @@
 //*************************************************************************************************
 
 #include <blaze/system/Debugging.h>
+#include <blaze/system/Tuning.h>
 #include <blaze/util/StaticAssert.h>
 #include <blaze/util/Types.h>
 
@@ -246,6 +247,36 @@ constexpr size_t TSMATTDMATMULT_DEBUG_THRESHOLD = 256UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Dense matrix decomposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_DMATDECOMPOSITION_THRESHOLD while the Blaze
+// debug mode is active. It specifies the threshold between the application of the native Blaze
+// kernels and the LAPACK kernels for the LU, Cholesky, and QR decomposition of dense matrices.
+// In case the number of elements in the dense matrix is equal or higher than this value, the
+// LAPACK kernels are preferred over the native Blaze kernels. In case the number of elements in
+// the dense matrix is smaller, the Blaze kernels are used.
+*/
+constexpr size_t DMATDECOMPOSITION_DEBUG_THRESHOLD = 64UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Dense matrix in-place transposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_DMATTRANSPOSE_THRESHOLD while the Blaze debug
+// mode is active. It specifies the threshold between the two algorithms for the in-place
+// transposition of non-square dense matrices. In case the number of elements in the dense
+// matrix is equal or higher than this value, the matrix is transposed in-place without a
+// temporary matrix. In case the number of elements in the dense matrix is smaller, the
+// transpose is assembled in a temporary matrix.
+*/
+constexpr size_t DMATTRANSPOSE_DEBUG_THRESHOLD = 16UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t DMATDVECMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATDVECMULT_DEBUG_THRESHOLD   : BLAZE_DMATDVECMULT_THRESHOLD   );
@@ -260,6 +291,8 @@ constexpr size_t DMATSMATMULT_THRESHOLD   = ( BLAZE_DEBUG_MODE ? DMATSMATMULT_DE
 constexpr size_t TDMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TDMATSMATMULT_DEBUG_THRESHOLD  : BLAZE_TDMATSMATMULT_THRESHOLD  );
 constexpr size_t TSMATDMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? TSMATDMATMULT_DEBUG_THRESHOLD  : BLAZE_TSMATDMATMULT_THRESHOLD  );
 constexpr size_t TSMATTDMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? TSMATTDMATMULT_DEBUG_THRESHOLD : BLAZE_TSMATTDMATMULT_THRESHOLD );
+constexpr size_t DMATDECOMPOSITION_THRESHOLD = ( BLAZE_DEBUG_MODE ? DMATDECOMPOSITION_DEBUG_THRESHOLD : BLAZE_DMATDECOMPOSITION_THRESHOLD );
+constexpr size_t DMATTRANSPOSE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? DMATTRANSPOSE_DEBUG_THRESHOLD     : BLAZE_DMATTRANSPOSE_THRESHOLD     );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -967,6 +1000,121 @@ constexpr size_t SMP_SMATREDUCE_DEBUG_THRESHOLD = 16UL;
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief SMP dense vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the total reduction of a dense vector or the computation of
+// a dense vector norm can be executed in parallel. In case the number of elements of the dense
+// vector is larger or equal to this threshold, the operation is executed in parallel. If the
+// number of elements is below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense vector/dense vector inner product threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DVECDVECINNER_THRESHOLD while the Blaze
+// debug mode is active. It specifies when a dense vector/dense vector inner product can be
+// executed in parallel. In case the number of elements of the two dense vectors is larger or
+// equal to this threshold, the operation is executed in parallel. If the number of elements is
+// below this threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DVECDVECINNER_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse vector reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SVECREDUCE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the total reduction of a sparse vector or the computation of
+// a sparse vector norm can be executed in parallel. In case the number of non-zero elements of
+// the sparse vector is larger or equal to this threshold, the operation is executed in parallel.
+// If the number of non-zero elements is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_SVECREDUCE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix total reduction threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the total reduction of a dense matrix or the
+// computation of a dense matrix norm can be executed in parallel. In case the number of elements
+// of the dense matrix is larger or equal to this threshold, the operation is executed in
+// parallel. If the number of elements is below this threshold the operation is executed
+// single-threaded.
+*/
+constexpr size_t SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD = 256UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP dense matrix decomposition threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATDECOMPOSITION_THRESHOLD while the Blaze
+// debug mode is active. It specifies when the trailing matrix updates of the native blocked LU,
+// Cholesky, and QR decompositions can be executed in parallel. In case the number of elements of
+// the trailing submatrix is larger or equal to this threshold, the update is executed in
+// parallel. If the number of elements is below this threshold the update is executed
+// single-threaded.
+*/
+constexpr size_t SMP_DMATDECOMPOSITION_DEBUG_THRESHOLD = 64UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP batched dense matrix operation threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_DMATBATCH_THRESHOLD while the Blaze debug
+// mode is active. It specifies when a batched operation on an array of small dense matrices can
+// be executed in parallel. In case the number of matrices in the batch is larger or equal to this
+// threshold, the operation is executed in parallel. If the number of matrices is below this
+// threshold the operation is executed single-threaded.
+*/
+constexpr size_t SMP_DMATBATCH_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP iterative solver update threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SOLVERUPDATE_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the fused vector update kernels of the iterative solvers can
+// be executed in parallel. In case the size of the vectors is larger or equal to this threshold,
+// the update is executed in parallel. If the size of the vectors is below this threshold the
+// update is executed single-threaded.
+*/
+constexpr size_t SMP_SOLVERUPDATE_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief SMP sparse matrix assembly threshold.
+// \ingroup config
+//
+// This debug value is used instead of the BLAZE_SMP_SMATASSEMBLY_THRESHOLD while the Blaze debug
+// mode is active. It specifies when the assembly of a sparse matrix from unsorted triplets can
+// be executed in parallel. In case the number of triplets is larger or equal to this threshold,
+// the assembly is executed in parallel. If the number of triplets is below this threshold the
+// assembly is executed single-threaded.
+*/
+constexpr size_t SMP_SMATASSEMBLY_DEBUG_THRESHOLD = 32UL;
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*! \cond BLAZE_INTERNAL */
 constexpr size_t SMP_DVECASSIGN_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECASSIGN_DEBUG_THRESHOLD     : BLAZE_SMP_DVECASSIGN_THRESHOLD     );
@@ -1018,6 +1166,14 @@ constexpr size_t SMP_TSMATSMATMULT_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_TSMATSM
 constexpr size_t SMP_TSMATTSMATMULT_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_TSMATTSMATMULT_DEBUG_THRESHOLD : BLAZE_SMP_TSMATTSMATMULT_THRESHOLD );
 constexpr size_t SMP_DMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DMATREDUCE_THRESHOLD     );
 constexpr size_t SMP_SMATREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SMATREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SMATREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_DVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_DVECREDUCE_THRESHOLD     );
+constexpr size_t SMP_DVECDVECINNER_THRESHOLD  = ( BLAZE_DEBUG_MODE ? SMP_DVECDVECINNER_DEBUG_THRESHOLD  : BLAZE_SMP_DVECDVECINNER_THRESHOLD  );
+constexpr size_t SMP_SVECREDUCE_THRESHOLD     = ( BLAZE_DEBUG_MODE ? SMP_SVECREDUCE_DEBUG_THRESHOLD     : BLAZE_SMP_SVECREDUCE_THRESHOLD     );
+constexpr size_t SMP_DMATTOTALREDUCE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATTOTALREDUCE_DEBUG_THRESHOLD : BLAZE_SMP_DMATTOTALREDUCE_THRESHOLD );
+constexpr size_t SMP_DMATDECOMPOSITION_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATDECOMPOSITION_DEBUG_THRESHOLD : BLAZE_SMP_DMATDECOMPOSITION_THRESHOLD );
+constexpr size_t SMP_DMATBATCH_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_DMATBATCH_DEBUG_THRESHOLD : BLAZE_SMP_DMATBATCH_THRESHOLD );
+constexpr size_t SMP_SOLVERUPDATE_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_SOLVERUPDATE_DEBUG_THRESHOLD : BLAZE_SMP_SOLVERUPDATE_THRESHOLD );
+constexpr size_t SMP_SMATASSEMBLY_THRESHOLD = ( BLAZE_DEBUG_MODE ? SMP_SMATASSEMBLY_DEBUG_THRESHOLD : BLAZE_SMP_SMATASSEMBLY_THRESHOLD );
 /*! \endcond */
 //*************************************************************************************************
 
@@ -1094,6 +1250,13 @@ BLAZE_STATIC_ASSERT( blaze::SMP_TSMATSMATMULT_THRESHOLD  >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_TSMATTSMATMULT_THRESHOLD >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_DMATREDUCE_THRESHOLD     >= 0UL );
 BLAZE_STATIC_ASSERT( blaze::SMP_SMATREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DVECDVECINNER_THRESHOLD  >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SVECREDUCE_THRESHOLD     >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATTOTALREDUCE_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATDECOMPOSITION_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_DMATBATCH_THRESHOLD >= 0UL );
+BLAZE_STATIC_ASSERT( blaze::SMP_SOLVERUPDATE_THRESHOLD >= 0UL );
 
 }
 /*! \endcond */
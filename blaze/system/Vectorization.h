@@ -353,6 +353,61 @@
 
 
 
+//=================================================================================================
+//
+//  SIMD MATH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the Blaze SIMD math mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the Blaze-native SIMD math functions. In case the
+// SIMD math mode is enabled (i.e. in case at least SSE2 is available) the Blaze library
+// vectorizes several elementary functions (e.g. \c exp(), \c log(), \c sin(), \c pow(), ...)
+// by means of its own polynomial approximations in case the SVML is not available. In case the
+// SIMD math mode is disabled, these functions are only vectorized via the SVML.
+*/
+#if BLAZE_SSE2_MODE && !BLAZE_MIC_MODE
+#  define BLAZE_SIMD_MATH_MODE 1
+#else
+#  define BLAZE_SIMD_MATH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DISPATCH MODE CONFIGURATION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the runtime dispatch mode.
+// \ingroup system
+//
+// This compilation switch enables/disables the runtime dispatch of the compute kernels. In case
+// the dispatch mode is enabled, the dense matrix multiplication, dense matrix/dense vector
+// multiplication, dot product, summation and norm kernels are additionally compiled for the
+// AVX2 and AVX-512 instruction sets and the best instruction set supported by the executing
+// CPU is selected at runtime (see the blaze::getInstructionSet() function). The dispatch mode
+// requires a GNU or Clang compiler, an x86-64 platform and at least SSE2. It is disabled in
+// case the AVX-512 instruction set is already selected at compile time.
+*/
+#if BLAZE_USE_DISPATCH && BLAZE_SSE2_MODE && !BLAZE_AVX512F_MODE && !BLAZE_MIC_MODE && \
+    defined(__x86_64__) && defined(__GNUC__) && !defined(__INTEL_COMPILER)
+#  define BLAZE_DISPATCH_MODE 1
+#else
+#  define BLAZE_DISPATCH_MODE 0
+#endif
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  COMPILE TIME CONSTRAINTS
@@ -386,7 +441,7 @@ BLAZE_STATIC_ASSERT( !BLAZE_AVX512DQ_MODE || BLAZE_AVX512F_MODE );
 //
 //=================================================================================================
 
-#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE
+#if BLAZE_AVX512F_MODE || BLAZE_MIC_MODE || BLAZE_AVX2_MODE || BLAZE_AVX_MODE || BLAZE_DISPATCH_MODE
 #  include <immintrin.h>
 #elif BLAZE_SSE4_MODE
 #  include <smmintrin.h>
@@ -0,0 +1,93 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/KernelProfile.h
+//  \brief Header file for the kernel profiling functionality
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_KERNELPROFILE_H_
+#define _BLAZE_UTIL_KERNELPROFILE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <blaze/system/Debugging.h>
+#include <blaze/util/kernelprofile/KernelProfiler.h>
+
+
+
+
+//=================================================================================================
+//
+//  BLAZE_KERNEL_PROFILE MACRO
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Kernel profiling macro.
+// \ingroup util
+//
+// This macro can be used to profile a kernel selection point, i.e. the remainder of the
+// enclosing scope. The first argument is the name of the kernel selection point, which must
+// be a string literal or another constant string with static storage duration. All kernel
+// selection points with the same name are aggregated. The following arguments specify up to
+// three problem sizes, the estimated number of floating point operations, the estimated
+// memory traffic in bytes, and the number of threads used for the computation:
+
+   \code
+   template< typename MT1, typename MT2, typename MT3 >
+   void selectLargeKernel( MT1& C, const MT2& A, const MT3& B )
+   {
+      BLAZE_KERNEL_PROFILE( "selectLargeKernel", A.rows(), B.columns(), A.columns()
+                          , 2UL*A.rows()*B.columns()*A.columns()
+                          , sizeof(double)*( A.rows()*A.columns() + B.rows()*B.columns() )
+                          , 1UL );
+
+      // ...
+   }
+   \endcode
+
+// The macro must be used at most once per scope. Kernel profiling can be enabled or disabled
+// via the BLAZE_USE_KERNEL_PROFILING macro. In case kernel profiling is deactivated, the macro
+// expands to nothing, i.e. its arguments are not evaluated and no overhead results.
+*/
+#if BLAZE_USE_KERNEL_PROFILING
+#  define BLAZE_KERNEL_PROFILE( NAME, M, N, K, FLOPS, BYTES, THREADS ) \
+   static const size_t BLAZE_KERNEL_PROFILE_ID( blaze::KernelProfiler::instance().registerKernel( NAME ) ); \
+   const blaze::KernelProfileScope BLAZE_KERNEL_PROFILE_OBJECT( BLAZE_KERNEL_PROFILE_ID, M, N, K, FLOPS, BYTES, THREADS )
+#else
+#  define BLAZE_KERNEL_PROFILE( NAME, M, N, K, FLOPS, BYTES, THREADS )
+#endif
+//*************************************************************************************************
+
+#endif
@@ -0,0 +1,1010 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/TaskScheduler.h
+//  \brief Header file of the TaskScheduler class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_TASKSCHEDULER_H_
+#define _BLAZE_UTIL_TASKSCHEDULER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#if defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif
+
+#include <atomic>
+#include <memory>
+#include <utility>
+#include <vector>
+#include <blaze/system/Vectorization.h>
+#include <blaze/util/Exception.h>
+#include <blaze/util/Memory.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/policies/Deallocate.h>
+#include <blaze/util/threadpool/InlineTask.h>
+#include <blaze/util/threadpool/WorkQueue.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/Unused.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Work-stealing task scheduler for fork/join parallelism.
+// \ingroup threads
+//
+// The TaskScheduler class template represents a fixed set of worker threads that cooperatively
+// execute scheduled tasks. In contrast to the ThreadPool class template, which manages all tasks
+// in a single queue guarded by a single mutex, every thread of the task scheduler owns a
+// lock-free work-stealing queue (see threadpool::WorkQueue). Tasks are stored in small-buffer
+// task slots (see threadpool::InlineTask) and therefore do not require any dynamic memory. Idle
+// worker threads first spin on the queues of all other threads and only park on a condition
+// variable in case no task becomes available for some time.
+//
+// The TaskScheduler class template has the same four template parameters as the ThreadPool
+// class template:
+
+   \code
+   template< typename TT, typename MT, typename LT, typename CT >
+   class TaskScheduler;
+   \endcode
+
+//  - TT: specifies the type of the encapsulated thread. This can for instance be \c std::thread
+//        or \c boost::thread.
+//  - MT: specifies the type of the used mutex (used for parking idle threads only).
+//  - LT: specifies the type of lock used in combination with the given mutex type.
+//  - CT: specifies the type of the used condition variable.
+//
+// The thread calling schedule() and wait() participates in the execution of the tasks. Thus a
+// task scheduler of size \a n consists of the calling thread and \a n-1 worker threads:
+
+   \code
+   using StdTaskScheduler = blaze::TaskScheduler< std::thread
+                                                , std::mutex
+                                                , std::unique_lock<std::mutex>
+                                                , std::condition_variable >;
+
+   StdTaskScheduler scheduler( 4 );  // The calling thread plus three worker threads
+
+   for( size_t i=0UL; i<4UL; ++i ) {
+      scheduler.schedule( [i]() { ... } );  // Forking four tasks
+   }
+
+   scheduler.wait();  // Joining: executes tasks until all tasks are completed
+   \endcode
+
+// The task scheduler is re-entrant: Several application threads may fork and join tasks
+// concurrently. Every application thread that schedules a task leases one of \a callers task
+// slots with its own work queue until its next call to wait(). The task slots are allocated on
+// demand, i.e. only as many slots are allocated as application threads schedule tasks at the
+// same time. In case all slots are leased, the tasks of any further application thread are
+// executed immediately. Tasks may also fork
+// and join nested tasks. Every call to wait() only joins the tasks that have been scheduled by
+// the calling thread on the same nesting level, i.e. by the same task or, outside of any task,
+// by the same application thread. Since a joining thread executes tasks while waiting, nested
+// fork/join operations cannot deadlock. Note however that resize() must not be called while
+// other threads are using the task scheduler.
+//
+// Optionally, the worker threads can be pinned to individual CPUs. In this case the worker thread
+// with index \a i (see index()) is bound to the \a i-th CPU (modulo the number of CPUs) of the
+// CPU set of the thread that started the worker threads, whereas application threads are never
+// pinned. Since a pinned thread cannot migrate, the memory pages it touches first stay on the
+// NUMA node it is running on. Pinning is currently only supported on Linux and is ignored on
+// other platforms:
+
+   \code
+   StdTaskScheduler scheduler( 8, true );  // Eight threads, the seven worker threads are pinned
+   \endcode
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+class TaskScheduler
+   : private NonCopyable
+{
+ private:
+   //**Compilation flags***************************************************************************
+   //! Number of task slots per thread.
+   static constexpr size_t slots = 64UL;
+
+   //! Number of unsuccessful attempts to acquire a task before an idle thread is parked.
+   static constexpr size_t spins = 4096UL;
+
+   //! Maximum number of application threads that can concurrently schedule tasks.
+   static constexpr size_t callers = 64UL;
+   //**********************************************************************************************
+
+   //**Type definitions****************************************************************************
+   /*!\brief The queue and task slots of a single thread of the task scheduler.
+   */
+   struct alignas( 64 ) Worker
+   {
+      threadpool::WorkQueue  queue;                //!< The work-stealing queue of the thread.
+      threadpool::InlineTask tasks[slots];         //!< The task slots of the thread.
+      size_t                 next = 0UL;           //!< Index of the next task slot.
+      std::atomic<size_t>*   groups[slots];        //!< The join counters of the task slots.
+      std::atomic<size_t>    pending{ 0UL };       //!< Number of incomplete top level tasks.
+      std::atomic<bool>      leased{ false };      //!< Lease flag of an application thread.
+   };
+
+   //! Type of the worker container.
+   using Workers = std::vector< std::unique_ptr<Worker,Deallocate> >;
+
+   using Callers   = std::atomic<Worker*>[callers];      //!< Type of the application slots.
+   using Threads   = std::vector< std::unique_ptr<TT> >;  //!< Type of the thread container.
+   using Mutex     = MT;                                  //!< Type of the mutex.
+   using Lock      = LT;                                  //!< Type of a locking object.
+   using Condition = CT;                                  //!< Condition variable type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit TaskScheduler( size_t n, bool pin=false );
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   ~TaskScheduler();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline size_t size    () const;
+   inline size_t index   () const noexcept;
+   inline bool   isPinned() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Task scheduling*****************************************************************************
+   /*!\name Task scheduling */
+   //@{
+   template< typename Callable >
+   void schedule( Callable&& func );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void resize( size_t n, bool block=false );
+   void wait();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Thread functions****************************************************************************
+   /*!\name Thread functions */
+   //@{
+   inline Worker*                 current() const noexcept;
+   inline Worker*                 context() noexcept;
+   inline void                    release( Worker* self ) noexcept;
+   inline threadpool::InlineTask* acquire( Worker* self, Worker*& owner ) noexcept;
+   inline threadpool::InlineTask* steal( Worker* worker, Worker*& owner ) noexcept;
+   inline void                    execute( threadpool::InlineTask* task, Worker* owner );
+   inline void                    notify();
+   void                           join( const std::atomic<size_t>& pending, Worker* self );
+   void                           work( size_t index );
+   void                           stop();
+
+   static inline void pause() noexcept;
+   static inline void bind ( size_t index ) noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   Workers workers_;                //!< The queues and task slots of the worker threads.
+   Callers callers_;                //!< The queues and task slots of the application threads.
+   Threads threads_;                //!< The worker threads of the task scheduler.
+   std::atomic<size_t> leases_;     //!< Number of application slots that have ever been leased.
+   std::atomic<size_t> pending_;    //!< Total number of scheduled, incomplete tasks.
+   std::atomic<size_t> epoch_;      //!< Counter of the scheduling operations.
+   std::atomic<size_t> sleeping_;   //!< Number of parked worker threads.
+   std::atomic<size_t> waiting_;    //!< Number of parked joining threads.
+   std::atomic<bool>   stop_;       //!< Termination flag for the worker threads.
+   const bool          pin_;        //!< Flag for the pinning of the worker threads.
+   mutable Mutex mutex_;            //!< Synchronization mutex for parking threads.
+   Condition waitForTask_;          //!< Wait condition for parked worker threads.
+   Condition waitForCompletion_;    //!< Wait condition for parked joining threads.
+
+   static thread_local const TaskScheduler* owner_;  //!< The task scheduler of a worker thread.
+   static thread_local size_t index_;                //!< The index of a worker thread.
+   static thread_local const TaskScheduler* lessee_; //!< The task scheduler of a leased slot.
+   static thread_local Worker* lease_;               //!< The leased slot of an application thread.
+   static thread_local std::atomic<size_t>* group_;  //!< The join counter of the executed task.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DEFINITION AND INITIALIZATION OF THE STATIC MEMBER VARIABLES
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local const TaskScheduler<TT,MT,LT,CT>* TaskScheduler<TT,MT,LT,CT>::owner_ = nullptr;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local size_t TaskScheduler<TT,MT,LT,CT>::index_ = 0UL;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local const TaskScheduler<TT,MT,LT,CT>* TaskScheduler<TT,MT,LT,CT>::lessee_ = nullptr;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local typename TaskScheduler<TT,MT,LT,CT>::Worker* TaskScheduler<TT,MT,LT,CT>::lease_ = nullptr;
+
+template< typename TT, typename MT, typename LT, typename CT >
+thread_local std::atomic<size_t>* TaskScheduler<TT,MT,LT,CT>::group_ = nullptr;
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskScheduler class.
+//
+// \param n Total number of threads, including the calling thread.
+// \param pin \a true if the worker threads shall be pinned to individual CPUs, \a false if not.
+// \exception std::invalid_argument Invalid number of threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+TaskScheduler<TT,MT,LT,CT>::TaskScheduler( size_t n, bool pin )
+   : workers_          ()       // The queues and task slots of the worker threads
+   , callers_          {}       // The queues and task slots of the application threads
+   , threads_          ()       // The worker threads of the task scheduler
+   , leases_           ( 0UL )  // Number of application slots that have ever been leased
+   , pending_          ( 0UL )  // Total number of scheduled, incomplete tasks
+   , epoch_            ( 0UL )  // Counter of the scheduling operations
+   , sleeping_         ( 0UL )  // Number of parked worker threads
+   , waiting_          ( 0UL )  // Number of parked joining threads
+   , stop_             ( false )// Termination flag for the worker threads
+   , pin_              ( pin )  // Flag for the pinning of the worker threads
+   , mutex_            ()       // Synchronization mutex for parking threads
+   , waitForTask_      ()       // Wait condition for parked worker threads
+   , waitForCompletion_()       // Wait condition for parked joining threads
+{
+   for( auto& caller : callers_ ) {
+      caller.store( nullptr );
+   }
+
+   resize( n );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the TaskScheduler class.
+//
+// The destructor completes all scheduled tasks and terminates all worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+TaskScheduler<TT,MT,LT,CT>::~TaskScheduler()
+{
+   join( pending_, nullptr );
+   stop();
+
+   for( auto& caller : callers_ ) {
+      deallocate( caller.load() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current size of the task scheduler.
+//
+// \return The total number of threads, including the calling thread.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t TaskScheduler<TT,MT,LT,CT>::size() const
+{
+   return workers_.size() + 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the index of the calling thread within the task scheduler.
+//
+// \return The index of the calling thread \f$[0..size())\f$.
+//
+// This function returns the index of the calling thread within the task scheduler. The worker
+// threads are numbered from 1 to size()-1, all application threads have the index 0. The index
+// of a worker thread is stable until the next call to resize().
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline size_t TaskScheduler<TT,MT,LT,CT>::index() const noexcept
+{
+   return ( owner_ == this ) ? index_+1UL : 0UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns whether the worker threads are pinned to individual CPUs.
+//
+// \return \a true in case the worker threads are pinned, \a false if not.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline bool TaskScheduler<TT,MT,LT,CT>::isPinned() const noexcept
+{
+   return pin_;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TASK SCHEDULING
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Scheduling the given function/functor for execution.
+//
+// \param func The given function/functor.
+// \return void
+//
+// This function schedules the given function/functor for execution. The callable is stored
+// in a task slot of the calling thread and pushed to the work queue of the calling thread,
+// from which it can be stolen by any idle thread. In case the task scheduler consists of a
+// single thread or no task slot is available, the callable is executed immediately.
+*/
+template< typename TT          // Type of the encapsulated thread
+        , typename MT          // Type of the synchronization mutex
+        , typename LT          // Type of the mutex lock
+        , typename CT >        // Type of the condition variable
+template< typename Callable >  // Type of the function/functor
+void TaskScheduler<TT,MT,LT,CT>::schedule( Callable&& func )
+{
+   Worker* worker( threads_.empty() ? nullptr : context() );
+
+   if( worker == nullptr || worker->tasks[worker->next % slots].isBusy() ) {
+      func();
+      return;
+   }
+
+   const size_t slot( worker->next++ % slots );
+   std::atomic<size_t>* const group( group_ != nullptr ? group_ : &worker->pending );
+
+   threadpool::InlineTask& task( worker->tasks[slot] );
+   task.assign( std::forward<Callable>( func ) );
+   worker->groups[slot] = group;
+   group->fetch_add( 1UL );
+   pending_.fetch_add( 1UL );
+
+   if( !worker->queue.push( &task ) ) {
+      execute( &task, worker );
+      return;
+   }
+
+   notify();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Changes the total number of threads in the task scheduler.
+//
+// \param n The new number of threads \f$[1..\infty)\f$, including the calling thread.
+// \param block \a true if the function shall block, \a false if not.
+// \return void
+// \exception std::invalid_argument Invalid number of threads.
+//
+// This function changes the size of the task scheduler, i.e. changes the total number of
+// threads. All scheduled tasks are completed before the worker threads are replaced. Since
+// the worker threads are always joined, the function always blocks, independent of \a block.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void TaskScheduler<TT,MT,LT,CT>::resize( size_t n, bool block )
+{
+   UNUSED_PARAMETER( block );
+
+   if( n == 0UL ) {
+      BLAZE_THROW_INVALID_ARGUMENT( "Invalid number of threads" );
+   }
+
+   if( n == size() )
+      return;
+
+   join( pending_, nullptr );
+   stop();
+
+   workers_.resize( n-1UL );
+
+   for( auto& worker : workers_ ) {
+      if( !worker ) worker.reset( allocate<Worker>( 1UL ) );
+   }
+
+   for( size_t i=0UL; i<n-1UL; ++i ) {
+      threads_.push_back( std::unique_ptr<TT>( new TT( &TaskScheduler::work, this, i ) ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Waiting for all tasks scheduled by the calling thread to be completed.
+//
+// \return void
+//
+// This function implements the join operation of the task scheduler. The calling thread
+// executes scheduled tasks until all tasks it has scheduled on the current nesting level have
+// been completed. In case no further task is available, the calling thread first spins and then
+// parks until its last task is completed. Outside of any task, an application thread afterwards
+// returns its leased task slot. Tasks scheduled by other threads are not joined.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void TaskScheduler<TT,MT,LT,CT>::wait()
+{
+   Worker* const self( current() );
+
+   if( group_ != nullptr ) {
+      join( *group_, self );
+   }
+   else if( self != nullptr ) {
+      join( self->pending, self );
+      release( self );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  THREAD FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the current task slot of the calling thread.
+//
+// \return The task slot of the calling thread or \a nullptr in case the thread has no slot.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename TaskScheduler<TT,MT,LT,CT>::Worker* TaskScheduler<TT,MT,LT,CT>::current() const noexcept
+{
+   if( owner_ == this )
+      return workers_[index_].get();
+
+   return ( lessee_ == this ) ? lease_ : nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the task slot of the calling thread.
+//
+// \return The task slot of the calling thread or \a nullptr in case no slot is available.
+//
+// Worker threads use their own task slot. Application threads lease a free task slot, which
+// they keep until their next call to wait(). In case no free slot is available, a new slot is
+// allocated and installed in the first empty position. In case all \a callers slots are leased,
+// in case the allocation fails, or in case the calling thread already holds a task slot of
+// another task scheduler, the function returns \a nullptr.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline typename TaskScheduler<TT,MT,LT,CT>::Worker* TaskScheduler<TT,MT,LT,CT>::context() noexcept
+{
+   if( owner_ == this )
+      return workers_[index_].get();
+
+   if( lease_ != nullptr )
+      return ( lessee_ == this ) ? lease_ : nullptr;
+
+   for( size_t i=0UL; i<callers; ++i )
+   {
+      Worker* worker( callers_[i].load( std::memory_order_acquire ) );
+      bool leased( false );
+
+      if( worker == nullptr )
+      {
+         Worker* slot( nullptr );
+
+         try {
+            slot = allocate<Worker>( 1UL );
+         }
+         catch( ... ) {
+            return nullptr;
+         }
+
+         slot->leased.store( true, std::memory_order_relaxed );
+
+         if( callers_[i].compare_exchange_strong( worker, slot, std::memory_order_acq_rel ) ) {
+            worker = slot;
+            leased = true;
+         }
+         else {
+            deallocate( slot );
+         }
+      }
+
+      if( leased || ( !worker->leased.load( std::memory_order_relaxed ) &&
+                      !worker->leased.exchange( true, std::memory_order_acquire ) ) )
+      {
+         size_t leases( leases_.load() );
+         while( leases <= i && !leases_.compare_exchange_weak( leases, i+1UL ) ) {}
+
+         lessee_ = this;
+         lease_  = worker;
+         return worker;
+      }
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the task slot leased by an application thread.
+//
+// \param self The task slot of the calling thread.
+// \return void
+//
+// This function has no effect for the task slots of worker threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskScheduler<TT,MT,LT,CT>::release( Worker* self ) noexcept
+{
+   if( lease_ != self )
+      return;
+
+   lessee_ = nullptr;
+   lease_  = nullptr;
+   self->leased.store( false, std::memory_order_release );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Acquires a task for the given thread.
+//
+// \param self The task slot of the acquiring thread (\a nullptr for a thread without slot).
+// \param owner The task slot the acquired task belongs to.
+// \return The acquired task or \a nullptr in case no task is available.
+//
+// This function first tries to take the newest task from the thread's own work queue and then
+// tries to steal the oldest task from the work queues of all worker and application threads.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::InlineTask*
+   TaskScheduler<TT,MT,LT,CT>::acquire( Worker* self, Worker*& owner ) noexcept
+{
+   if( self != nullptr ) {
+      if( threadpool::InlineTask* task = self->queue.pop() ) {
+         owner = self;
+         return task;
+      }
+   }
+
+   const size_t n     ( workers_.size() );
+   const size_t offset( owner_ == this ? index_+1UL : 0UL );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( threadpool::InlineTask* task = steal( workers_[(offset+i)%n].get(), owner ) )
+         return task;
+   }
+
+   const size_t leases( leases_.load() );
+
+   for( size_t i=0UL; i<leases; ++i ) {
+      Worker* const worker( callers_[i].load( std::memory_order_acquire ) );
+      if( threadpool::InlineTask* task = steal( worker, owner ) )
+         return task;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Steals a task from the work queue of the given task slot.
+//
+// \param worker The task slot to steal from (\a nullptr for a slot that is not yet allocated).
+// \param owner The task slot the stolen task belongs to.
+// \return The stolen task or \a nullptr in case no task is available.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline threadpool::InlineTask*
+   TaskScheduler<TT,MT,LT,CT>::steal( Worker* worker, Worker*& owner ) noexcept
+{
+   if( worker == nullptr )
+      return nullptr;
+
+   if( threadpool::InlineTask* task = worker->queue.steal() ) {
+      owner = worker;
+      return task;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the given task and signals the completion of the last scheduled task.
+//
+// \param task The task to be executed.
+// \param owner The task slot the task belongs to.
+// \return void
+//
+// All tasks scheduled by the given task that have not been joined explicitly are joined before
+// the task is considered to be completed.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskScheduler<TT,MT,LT,CT>::execute( threadpool::InlineTask* task, Worker* owner )
+{
+   std::atomic<size_t>* const group( owner->groups[task - owner->tasks] );
+   std::atomic<size_t>* const outer( group_ );
+   std::atomic<size_t> nested( 0UL );
+
+   group_ = &nested;
+   task->run();
+
+   if( nested.load() > 0UL ) {
+      join( nested, current() );
+   }
+
+   group_ = outer;
+
+   const bool joined   ( group->fetch_sub( 1UL ) == 1UL );
+   const bool completed( pending_.fetch_sub( 1UL ) == 1UL );
+
+   if( ( joined || completed ) && waiting_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      waitForCompletion_.notify_all();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Notifies a parked worker thread about a newly scheduled task.
+//
+// \return void
+//
+// The mutex is only acquired in case at least one worker thread is parked.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskScheduler<TT,MT,LT,CT>::notify()
+{
+   ++epoch_;
+
+   if( sleeping_.load() > 0UL ) {
+      Lock lock( mutex_ );
+      waitForTask_.notify_one();
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes scheduled tasks until the given number of pending tasks drops to zero.
+//
+// \param pending The number of pending tasks to wait for.
+// \param self The task slot of the calling thread (\a nullptr for a thread without slot).
+// \return void
+//
+// In case no further task is available, the calling thread first spins and then parks until
+// the number of pending tasks drops to zero.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void TaskScheduler<TT,MT,LT,CT>::join( const std::atomic<size_t>& pending, Worker* self )
+{
+   size_t attempts( 0UL );
+   Worker* owner( nullptr );
+
+   while( pending.load() > 0UL )
+   {
+      if( threadpool::InlineTask* task = acquire( self, owner ) ) {
+         execute( task, owner );
+         attempts = 0UL;
+      }
+      else if( ++attempts < spins ) {
+         pause();
+      }
+      else {
+         Lock lock( mutex_ );
+         ++waiting_;
+         while( pending.load() > 0UL ) {
+            waitForCompletion_.wait( lock );
+         }
+         --waiting_;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief The thread function of the worker threads.
+//
+// \param index The index of the worker thread.
+// \return void
+//
+// Each worker thread repeatedly acquires and executes tasks. In case no task is available, the
+// thread spins for a while and is then parked until a new task is scheduled. In case pinning is
+// enabled, the thread is first bound to its CPU.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void TaskScheduler<TT,MT,LT,CT>::work( size_t index )
+{
+   owner_ = this;
+   index_ = index;
+
+   if( pin_ ) {
+      bind( index+1UL );
+   }
+
+   Worker* const self( workers_[index].get() );
+   Worker* owner( nullptr );
+   size_t attempts( 0UL );
+
+   while( !stop_.load() )
+   {
+      if( threadpool::InlineTask* task = acquire( self, owner ) ) {
+         execute( task, owner );
+         attempts = 0UL;
+         continue;
+      }
+
+      if( ++attempts < spins ) {
+         pause();
+         continue;
+      }
+
+      attempts = 0UL;
+
+      const size_t epoch( epoch_.load() );
+
+      if( threadpool::InlineTask* task = acquire( self, owner ) ) {
+         execute( task, owner );
+         continue;
+      }
+
+      Lock lock( mutex_ );
+      ++sleeping_;
+      while( epoch_.load() == epoch && !stop_.load() ) {
+         waitForTask_.wait( lock );
+      }
+      --sleeping_;
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Terminates and joins all worker threads.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+void TaskScheduler<TT,MT,LT,CT>::stop()
+{
+   {
+      Lock lock( mutex_ );
+      stop_ = true;
+      waitForTask_.notify_all();
+   }
+
+   for( auto const& thread : threads_ ) {
+      thread->join();
+   }
+
+   threads_.clear();
+   stop_ = false;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Signals a spin-wait loop to the processor.
+//
+// \return void
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskScheduler<TT,MT,LT,CT>::pause() noexcept
+{
+#if BLAZE_SSE2_MODE
+   _mm_pause();
+#endif
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Binds the calling thread to a single CPU.
+//
+// \param index The index of the calling thread.
+// \return void
+//
+// This function binds the calling thread to the \a index-th CPU (modulo the number of CPUs) of
+// its current CPU set, which a new thread inherits from the thread that started it. In case
+// the CPU set cannot be queried or modified, the calling thread remains unbound. On platforms
+// other than Linux the function has no effect.
+*/
+template< typename TT    // Type of the encapsulated thread
+        , typename MT    // Type of the synchronization mutex
+        , typename LT    // Type of the mutex lock
+        , typename CT >  // Type of the condition variable
+inline void TaskScheduler<TT,MT,LT,CT>::bind( size_t index ) noexcept
+{
+#if defined(__linux__)
+   cpu_set_t cpus;
+   CPU_ZERO( &cpus );
+
+   if( pthread_getaffinity_np( pthread_self(), sizeof( cpu_set_t ), &cpus ) != 0 )
+      return;
+
+   const size_t count( CPU_COUNT( &cpus ) );
+
+   if( count == 0UL )
+      return;
+
+   size_t skip( index % count );
+
+   for( int cpu=0; cpu<CPU_SETSIZE; ++cpu )
+   {
+      if( !CPU_ISSET( cpu, &cpus ) || skip-- > 0UL )
+         continue;
+
+      cpu_set_t set;
+      CPU_ZERO( &set );
+      CPU_SET( cpu, &set );
+      pthread_setaffinity_np( pthread_self(), sizeof( cpu_set_t ), &set );
+      return;
+   }
+#else
+   UNUSED_PARAMETER( index );
+#endif
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,696 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/kernelprofile/KernelProfiler.h
+//  \brief Header file for the KernelProfiler class
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZE_UTIL_KERNELPROFILE_KERNELPROFILER_H_
+#define _BLAZE_UTIL_KERNELPROFILE_KERNELPROFILER_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+#include <blaze/util/Types.h>
+
+
+namespace blaze {
+
+//=================================================================================================
+//
+//  CLASS KERNELPROFILE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Aggregated profiling information of a single kernel selection point.
+// \ingroup util
+//
+// The KernelProfile class represents the accumulated measurements of all calls to a single
+// kernel selection point (for instance the BLAS-based or the blocked large matrix kernel of
+// a dense matrix/dense matrix multiplication), aggregated over all threads that executed the
+// kernel. The number of floating point operations and the number of bytes are estimates based
+// on the problem sizes of the according kernel, i.e. they represent the minimum amount of work
+// and memory traffic required by the operation. Kernel selection points that cannot provide an
+// estimate (as for instance the SMP assignments, whose costs are dominated by the evaluation of
+// the right-hand side expression) report 0 floating point operations and 0 bytes.
+*/
+struct KernelProfile
+{
+   std::string name;        //!< The name of the kernel selection point.
+   size_t      calls;       //!< The total number of calls.
+   size_t      threads;     //!< The number of distinct threads that executed the kernel.
+   size_t      maxThreads;  //!< The maximum number of threads used by a single call.
+   double      time;        //!< The accumulated wall clock time (in seconds).
+   double      minTime;     //!< The minimum wall clock time of a single call (in seconds).
+   double      maxTime;     //!< The maximum wall clock time of a single call (in seconds).
+   size_t      sumM;        //!< The accumulated first problem size (e.g. the number of rows).
+   size_t      sumN;        //!< The accumulated second problem size (e.g. the number of columns).
+   size_t      sumK;        //!< The accumulated third problem size (e.g. the inner dimension).
+   size_t      maxM;        //!< The maximum first problem size of a single call.
+   size_t      maxN;        //!< The maximum second problem size of a single call.
+   size_t      maxK;        //!< The maximum third problem size of a single call.
+   size_t      flops;       //!< The estimated total number of floating point operations.
+   size_t      bytes;       //!< The estimated total memory traffic (in bytes).
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELPROFILER
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registry for the kernel profiling data of all threads.
+// \ingroup util
+//
+// The KernelProfiler class is the backend of the BLAZE_KERNEL_PROFILE macro. Every kernel
+// selection point is registered once by name and receives a unique ID. The measurements of a
+// call are recorded in a thread-local table that is exclusively written by the owning thread.
+// Therefore recording a measurement requires neither locks nor atomic read-modify-write
+// operations. The tables of all threads are owned by the profiler and outlive the threads, so
+// that the measurements of terminated threads are still available for the aggregation via the
+// getKernelProfiles() and writeKernelProfiles() functions.
+*/
+class KernelProfiler
+{
+ private:
+   //**Type definitions****************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   //! Counters of a single kernel selection point of a single thread.
+   struct Counters
+   {
+      std::atomic<uint64_t> calls     { 0UL };  //!< The number of calls.
+      std::atomic<uint64_t> time      { 0UL };  //!< The accumulated time (in nanoseconds).
+      std::atomic<uint64_t> minTime   { std::numeric_limits<uint64_t>::max() };  //!< The minimum time.
+      std::atomic<uint64_t> maxTime   { 0UL };  //!< The maximum time (in nanoseconds).
+      std::atomic<uint64_t> maxThreads{ 0UL };  //!< The maximum number of threads.
+      std::atomic<uint64_t> sumM      { 0UL };  //!< The accumulated first problem size.
+      std::atomic<uint64_t> sumN      { 0UL };  //!< The accumulated second problem size.
+      std::atomic<uint64_t> sumK      { 0UL };  //!< The accumulated third problem size.
+      std::atomic<uint64_t> maxM      { 0UL };  //!< The maximum first problem size.
+      std::atomic<uint64_t> maxN      { 0UL };  //!< The maximum second problem size.
+      std::atomic<uint64_t> maxK      { 0UL };  //!< The maximum third problem size.
+      std::atomic<uint64_t> flops     { 0UL };  //!< The estimated number of flops.
+      std::atomic<uint64_t> bytes     { 0UL };  //!< The estimated number of bytes.
+   };
+
+   //! Number of kernel selection points per chunk of a thread-local table.
+   static constexpr size_t chunkSize = 64UL;
+
+   //! Maximum number of chunks of a thread-local table.
+   static constexpr size_t maxChunks = 64UL;
+
+   //! Thread-local table of counters, lazily allocated in chunks by the owning thread.
+   struct Table
+   {
+      Table() {
+         for( auto& chunk : chunks ) chunk.store( nullptr, std::memory_order_relaxed );
+      }
+
+      ~Table() {
+         for( auto& chunk : chunks ) delete[] chunk.load( std::memory_order_relaxed );
+      }
+
+      std::atomic<Counters*> chunks[maxChunks];  //!< The chunks of counters.
+   };
+   /*! \endcond */
+   //**********************************************************************************************
+
+ public:
+   //**Type definitions****************************************************************************
+   using Clock = std::chrono::steady_clock;  //!< Clock used for the time measurements.
+   //**********************************************************************************************
+
+   //**Constants***********************************************************************************
+   //! Maximum number of distinct kernel selection points.
+   static constexpr size_t maxKernels = chunkSize * maxChunks;
+   //**********************************************************************************************
+
+   //**Instance function***************************************************************************
+   /*!\name Instance function */
+   //@{
+   static inline KernelProfiler& instance();
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline size_t registerKernel( const char* name );
+   inline void   record( size_t id, size_t m, size_t n, size_t k, size_t flops,
+                         size_t bytes, size_t threads, uint64_t nanoseconds );
+
+   inline std::vector<KernelProfile> profiles() const;
+   inline void reset();
+   //@}
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   KernelProfiler( const KernelProfiler& ) = delete;
+   KernelProfiler& operator=( const KernelProfiler& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   KernelProfiler() = default;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline Table& table();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   mutable std::mutex mutex_;  //!< Synchronization of the registration of kernels and threads.
+   std::vector<std::string> names_;  //!< The names of all registered kernel selection points.
+   std::vector< std::unique_ptr<Table> > tables_;  //!< The tables of all registered threads.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  INSTANCE FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the global kernel profiler.
+//
+// \return Reference to the global kernel profiler.
+*/
+inline KernelProfiler& KernelProfiler::instance()
+{
+   static KernelProfiler profiler;
+   return profiler;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Registration of a kernel selection point.
+//
+// \param name The name of the kernel selection point.
+// \return The unique ID of the kernel selection point.
+//
+// This function returns the ID associated with the given name. All selection points with the
+// same name (for instance different template instantiations of the same kernel) share a single
+// ID and are therefore aggregated. In case the maximum number of kernel selection points is
+// exceeded, the function returns \a maxKernels and the according measurements are discarded.
+*/
+inline size_t KernelProfiler::registerKernel( const char* name )
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   const auto pos( std::find( names_.begin(), names_.end(), name ) );
+   if( pos != names_.end() )
+      return static_cast<size_t>( pos - names_.begin() );
+
+   if( names_.size() == maxKernels )
+      return maxKernels;
+
+   names_.emplace_back( name );
+   return names_.size() - 1UL;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Recording the measurements of a single kernel call.
+//
+// \param id The ID of the kernel selection point.
+// \param m The first problem size (e.g. the number of rows).
+// \param n The second problem size (e.g. the number of columns).
+// \param k The third problem size (e.g. the inner dimension).
+// \param flops The estimated number of floating point operations.
+// \param bytes The estimated memory traffic (in bytes).
+// \param threads The number of threads used by the kernel call.
+// \param nanoseconds The wall clock time of the kernel call (in nanoseconds).
+// \return void
+//
+// This function is lock-free. The counters are exclusively written by the calling thread and
+// are only read concurrently, which allows to update them with plain relaxed loads and stores.
+*/
+inline void KernelProfiler::record( size_t id, size_t m, size_t n, size_t k, size_t flops,
+                                    size_t bytes, size_t threads, uint64_t nanoseconds )
+{
+   if( id >= maxKernels )
+      return;
+
+   std::atomic<Counters*>& chunk( table().chunks[id / chunkSize] );
+
+   Counters* counters( chunk.load( std::memory_order_relaxed ) );
+   if( counters == nullptr ) {
+      counters = new Counters[chunkSize];
+      chunk.store( counters, std::memory_order_release );
+   }
+
+   Counters& c( counters[id % chunkSize] );
+
+   const auto add = []( std::atomic<uint64_t>& counter, uint64_t value ) {
+      counter.store( counter.load( std::memory_order_relaxed ) + value, std::memory_order_relaxed );
+   };
+   const auto maximize = []( std::atomic<uint64_t>& counter, uint64_t value ) {
+      if( counter.load( std::memory_order_relaxed ) < value )
+         counter.store( value, std::memory_order_relaxed );
+   };
+
+   add( c.calls, 1UL );
+   add( c.time , nanoseconds );
+   add( c.sumM , m );
+   add( c.sumN , n );
+   add( c.sumK , k );
+   add( c.flops, flops );
+   add( c.bytes, bytes );
+
+   maximize( c.maxTime   , nanoseconds );
+   maximize( c.maxThreads, threads );
+   maximize( c.maxM      , m );
+   maximize( c.maxN      , n );
+   maximize( c.maxK      , k );
+
+   if( c.minTime.load( std::memory_order_relaxed ) > nanoseconds )
+      c.minTime.store( nanoseconds, std::memory_order_relaxed );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Aggregation of the measurements of all threads.
+//
+// \return The aggregated profiles of all kernel selection points that have been called.
+//
+// The profiles are returned in the order of the registration of the kernel selection points.
+// Kernel selection points that have been registered but not called are not contained.
+*/
+inline std::vector<KernelProfile> KernelProfiler::profiles() const
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   std::vector<KernelProfile> result;
+
+   for( size_t id=0UL; id<names_.size(); ++id )
+   {
+      KernelProfile p{ names_[id], 0UL, 0UL, 0UL, 0.0, 0.0, 0.0,
+                       0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL, 0UL };
+      uint64_t minTime( std::numeric_limits<uint64_t>::max() );
+      uint64_t time( 0UL );
+      uint64_t maxTime( 0UL );
+
+      for( const auto& t : tables_ )
+      {
+         const Counters* counters( t->chunks[id / chunkSize].load( std::memory_order_acquire ) );
+         if( counters == nullptr )
+            continue;
+
+         const Counters& c( counters[id % chunkSize] );
+         const uint64_t calls( c.calls.load( std::memory_order_relaxed ) );
+         if( calls == 0UL )
+            continue;
+
+         p.calls     += calls;
+         p.threads   += 1UL;
+         p.maxThreads = std::max<size_t>( p.maxThreads, c.maxThreads.load( std::memory_order_relaxed ) );
+         p.sumM      += c.sumM.load( std::memory_order_relaxed );
+         p.sumN      += c.sumN.load( std::memory_order_relaxed );
+         p.sumK      += c.sumK.load( std::memory_order_relaxed );
+         p.maxM       = std::max<size_t>( p.maxM, c.maxM.load( std::memory_order_relaxed ) );
+         p.maxN       = std::max<size_t>( p.maxN, c.maxN.load( std::memory_order_relaxed ) );
+         p.maxK       = std::max<size_t>( p.maxK, c.maxK.load( std::memory_order_relaxed ) );
+         p.flops     += c.flops.load( std::memory_order_relaxed );
+         p.bytes     += c.bytes.load( std::memory_order_relaxed );
+
+         time   += c.time.load( std::memory_order_relaxed );
+         minTime = std::min<uint64_t>( minTime, c.minTime.load( std::memory_order_relaxed ) );
+         maxTime = std::max<uint64_t>( maxTime, c.maxTime.load( std::memory_order_relaxed ) );
+      }
+
+      if( p.calls == 0UL )
+         continue;
+
+      p.time    = time    * 1E-9;
+      p.minTime = minTime * 1E-9;
+      p.maxTime = maxTime * 1E-9;
+
+      result.push_back( std::move( p ) );
+   }
+
+   return result;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resetting the measurements of all threads.
+//
+// \return void
+//
+// This function resets the counters of all kernel selection points of all threads. The kernel
+// selection points stay registered. Note that measurements of kernels that are executed during
+// the reset may be partially lost.
+*/
+inline void KernelProfiler::reset()
+{
+   std::lock_guard<std::mutex> lock( mutex_ );
+
+   for( const auto& t : tables_ )
+   {
+      for( const auto& chunk : t->chunks )
+      {
+         Counters* counters( chunk.load( std::memory_order_acquire ) );
+         if( counters == nullptr )
+            continue;
+
+         for( size_t i=0UL; i<chunkSize; ++i ) {
+            Counters& c( counters[i] );
+            c.calls     .store( 0UL, std::memory_order_relaxed );
+            c.time      .store( 0UL, std::memory_order_relaxed );
+            c.minTime   .store( std::numeric_limits<uint64_t>::max(), std::memory_order_relaxed );
+            c.maxTime   .store( 0UL, std::memory_order_relaxed );
+            c.maxThreads.store( 0UL, std::memory_order_relaxed );
+            c.sumM      .store( 0UL, std::memory_order_relaxed );
+            c.sumN      .store( 0UL, std::memory_order_relaxed );
+            c.sumK      .store( 0UL, std::memory_order_relaxed );
+            c.maxM      .store( 0UL, std::memory_order_relaxed );
+            c.maxN      .store( 0UL, std::memory_order_relaxed );
+            c.maxK      .store( 0UL, std::memory_order_relaxed );
+            c.flops     .store( 0UL, std::memory_order_relaxed );
+            c.bytes     .store( 0UL, std::memory_order_relaxed );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Returns the table of the calling thread.
+//
+// \return Reference to the table of the calling thread.
+//
+// The table is created and registered on the first call of each thread.
+*/
+inline KernelProfiler::Table& KernelProfiler::table()
+{
+   thread_local Table* t = [this]() {
+      std::lock_guard<std::mutex> lock( mutex_ );
+      tables_.emplace_back( new Table() );
+      return tables_.back().get();
+   }();
+
+   return *t;
+}
+/*! \endcond */
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CLASS KERNELPROFILESCOPE
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief RAII object for the profiling of a single kernel call.
+// \ingroup util
+//
+// The KernelProfileScope class measures the wall clock time between its construction and its
+// destruction and records it together with the given problem sizes at the kernel profiler. It
+// is not intended to be used directly, but via the BLAZE_KERNEL_PROFILE macro.
+*/
+class KernelProfileScope
+{
+ public:
+   //**Constructor*********************************************************************************
+   /*!\brief Constructor for the KernelProfileScope class.
+   //
+   // \param id The ID of the kernel selection point.
+   // \param m The first problem size (e.g. the number of rows).
+   // \param n The second problem size (e.g. the number of columns).
+   // \param k The third problem size (e.g. the inner dimension).
+   // \param flops The estimated number of floating point operations.
+   // \param bytes The estimated memory traffic (in bytes).
+   // \param threads The number of threads used by the kernel call.
+   */
+   inline KernelProfileScope( size_t id, size_t m, size_t n, size_t k,
+                              size_t flops, size_t bytes, size_t threads )
+      : id_     ( id      )  // The ID of the kernel selection point
+      , m_      ( m       )  // The first problem size
+      , n_      ( n       )  // The second problem size
+      , k_      ( k       )  // The third problem size
+      , flops_  ( flops   )  // The estimated number of floating point operations
+      , bytes_  ( bytes   )  // The estimated memory traffic
+      , threads_( threads )  // The number of threads used by the kernel call
+      , start_  ( KernelProfiler::Clock::now() )  // The start of the kernel call
+   {}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\brief Destructor for the KernelProfileScope class.
+   */
+   inline ~KernelProfileScope()
+   {
+      const auto duration( KernelProfiler::Clock::now() - start_ );
+      KernelProfiler::instance().record( id_, m_, n_, k_, flops_, bytes_, threads_,
+         std::chrono::duration_cast<std::chrono::nanoseconds>( duration ).count() );
+   }
+   //**********************************************************************************************
+
+   //**Forbidden operations************************************************************************
+   /*!\name Forbidden operations */
+   //@{
+   KernelProfileScope( const KernelProfileScope& ) = delete;
+   KernelProfileScope& operator=( const KernelProfileScope& ) = delete;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   size_t id_;       //!< The ID of the kernel selection point.
+   size_t m_;        //!< The first problem size.
+   size_t n_;        //!< The second problem size.
+   size_t k_;        //!< The third problem size.
+   size_t flops_;    //!< The estimated number of floating point operations.
+   size_t bytes_;    //!< The estimated memory traffic (in bytes).
+   size_t threads_;  //!< The number of threads used by the kernel call.
+   KernelProfiler::Clock::time_point start_;  //!< The start of the kernel call.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  KERNEL PROFILING FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\name Kernel profiling functions */
+//@{
+inline std::vector<KernelProfile> getKernelProfiles();
+inline void resetKernelProfiles();
+inline void writeKernelProfiles( std::ostream& os );
+//@}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Returns the aggregated profiles of all profiled kernels.
+// \ingroup util
+//
+// \return The profiles of all kernel selection points that have been called.
+//
+// This function returns the measurements of all kernel selection points that have been called
+// since the start of the program or the last call to resetKernelProfiles(), aggregated over all
+// threads. The following example demonstrates how to query the profiles:
+
+   \code
+   #define BLAZE_USE_KERNEL_PROFILING 1
+   #include <blaze/Blaze.h>
+
+   // ... Evaluation of several dense matrix/dense matrix multiplications
+
+   for( const blaze::KernelProfile& p : blaze::getKernelProfiles() ) {
+      std::cout << p.name << ": " << p.calls << " calls, " << p.time << "s\n";
+   }
+   \endcode
+
+// In case the kernel profiling is deactivated via the BLAZE_USE_KERNEL_PROFILING switch, the
+// returned vector is empty.
+*/
+inline std::vector<KernelProfile> getKernelProfiles()
+{
+   return KernelProfiler::instance().profiles();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Resets the measurements of all profiled kernels.
+// \ingroup util
+//
+// \return void
+//
+// This function should only be called while no kernels are executed, since measurements that
+// are recorded during the reset may be partially lost.
+*/
+inline void resetKernelProfiles()
+{
+   KernelProfiler::instance().reset();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Writes the aggregated profiles of all profiled kernels in JSON format.
+// \ingroup util
+//
+// \param os Reference to the output stream.
+// \return void
+//
+// This function writes the profiles of all kernel selection points that have been called as
+// JSON document to the given output stream. Next to the raw measurements (see KernelProfile)
+// every entry contains the achieved performance in GFlop/s and the achieved bandwidth in GB/s
+// based on the estimated number of floating point operations and bytes:
+
+   \code
+   {
+     "kernels": [
+       {
+         "name": "DMatDMatMultExpr::selectLargeAssignKernel",
+         "calls": 10,
+         "threads": 1,
+         "maxThreads": 1,
+         "time": 0.0831,
+         ...
+       }
+     ]
+   }
+   \endcode
+*/
+inline void writeKernelProfiles( std::ostream& os )
+{
+   const std::vector<KernelProfile> profiles( getKernelProfiles() );
+
+   const auto quote = []( const std::string& s ) {
+      std::string result( "\"" );
+      for( char c : s ) {
+         if( c == '"' || c == '\\' ) result += '\\';
+         result += c;
+      }
+      return result += '"';
+   };
+
+   os << "{\n  \"kernels\": [";
+
+   for( size_t i=0UL; i<profiles.size(); ++i )
+   {
+      const KernelProfile& p( profiles[i] );
+
+      const double gflops   ( ( p.time > 0.0 )?( p.flops * 1E-9 / p.time ):( 0.0 ) );
+      const double bandwidth( ( p.time > 0.0 )?( p.bytes * 1E-9 / p.time ):( 0.0 ) );
+
+      os << ( ( i == 0UL )?( "\n" ):( ",\n" ) )
+         << "    {\n"
+         << "      \"name\": "       << quote( p.name ) << ",\n"
+         << "      \"calls\": "      << p.calls      << ",\n"
+         << "      \"threads\": "    << p.threads    << ",\n"
+         << "      \"maxThreads\": " << p.maxThreads << ",\n"
+         << "      \"time\": "       << p.time       << ",\n"
+         << "      \"minTime\": "    << p.minTime    << ",\n"
+         << "      \"maxTime\": "    << p.maxTime    << ",\n"
+         << "      \"avgM\": "       << double( p.sumM ) / p.calls << ",\n"
+         << "      \"avgN\": "       << double( p.sumN ) / p.calls << ",\n"
+         << "      \"avgK\": "       << double( p.sumK ) / p.calls << ",\n"
+         << "      \"maxM\": "       << p.maxM       << ",\n"
+         << "      \"maxN\": "       << p.maxN       << ",\n"
+         << "      \"maxK\": "       << p.maxK       << ",\n"
+         << "      \"flops\": "      << p.flops      << ",\n"
+         << "      \"bytes\": "      << p.bytes      << ",\n"
+         << "      \"gflops\": "     << gflops       << ",\n"
+         << "      \"bandwidth\": "  << bandwidth    << "\n"
+         << "    }";
+   }
+
+   os << ( profiles.empty() ? "]\n}\n" : "\n  ]\n}\n" );
+}
+//*************************************************************************************************
+
+} // namespace blaze
+
+#endif
@@ -0,0 +1,317 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/InlineTask.h
+//  \brief Small-buffer task for the task scheduler
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_INLINETASK_H_
+#define _BLAZE_UTIL_THREADPOOL_INLINETASK_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <new>
+#include <utility>
+#include <blaze/util/Assert.h>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/typetraits/Decay.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Small-buffer handle for a single, executable task.
+// \ingroup threads
+//
+// The InlineTask class represents a reusable slot for a single task of the task scheduler. In
+// contrast to threadpool::Task it does not rely on \c std::function: Callables of up to
+// \a capacity bytes are stored directly inside the slot, only larger callables are allocated
+// dynamically. A slot is marked as busy from the assignment of a callable until the execution
+// of the callable has been completed and can be reused afterwards.
+*/
+class InlineTask
+   : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Size of the internal buffer in bytes.
+   static constexpr size_t capacity = 256UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline InlineTask() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   /*!\name Destructor */
+   //@{
+   inline ~InlineTask();
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isBusy() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Callable >
+   inline void assign( Callable&& func );
+
+   inline void run();
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Function = void (*)( void* );  //!< Type of the type-erased invocation functions.
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   inline void release() noexcept;
+
+   template< typename Callable > static void invoke        ( void* object );
+   template< typename Callable > static void destroyInplace( void* object );
+   template< typename Callable > static void destroyDynamic( void* object );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   alignas( 64 ) unsigned char buffer_[capacity];  //!< Internal storage for small callables.
+   void* object_;                                   //!< Pointer to the stored callable.
+   Function invoke_;                                //!< Type-erased invocation function.
+   Function destroy_;                               //!< Type-erased destruction function.
+   std::atomic<bool> busy_;                         //!< Flag for an assigned, incomplete task.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for InlineTask.
+*/
+inline InlineTask::InlineTask() noexcept
+   : object_ ( nullptr )  // Pointer to the stored callable
+   , invoke_ ( nullptr )  // Type-erased invocation function
+   , destroy_( nullptr )  // Type-erased destruction function
+   , busy_   ( false   )  // Flag for an assigned, incomplete task
+{}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  DESTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Destructor for the InlineTask class.
+//
+// The destructor destroys the stored callable in case it has not been executed.
+*/
+inline InlineTask::~InlineTask()
+{
+   release();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the task slot is currently in use.
+//
+// \return \a true in case a callable has been assigned but not yet executed, \a false if not.
+*/
+inline bool InlineTask::isBusy() const noexcept
+{
+   return busy_.load( std::memory_order_acquire );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Assigns the given callable to the task slot.
+//
+// \param func The callable to be stored in the task slot.
+// \return void
+//
+// This function stores the given callable inside the task slot. In case the callable fits into
+// the internal buffer no dynamic memory is allocated. Note that the task slot must not be busy.
+*/
+template< typename Callable >  // Type of the callable
+inline void InlineTask::assign( Callable&& func )
+{
+   using CT = Decay_t<Callable>;
+
+   BLAZE_INTERNAL_ASSERT( !isBusy(), "Assignment to busy task slot detected" );
+
+   if( sizeof( CT ) <= capacity && alignof( CT ) <= 64UL ) {
+      object_  = ::new( static_cast<void*>( buffer_ ) ) CT( std::forward<Callable>( func ) );
+      destroy_ = &destroyInplace<CT>;
+   }
+   else {
+      object_  = new CT( std::forward<Callable>( func ) );
+      destroy_ = &destroyDynamic<CT>;
+   }
+
+   invoke_ = &invoke<CT>;
+   busy_.store( true, std::memory_order_release );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Executes the stored callable and releases the task slot.
+//
+// \return void
+*/
+inline void InlineTask::run()
+{
+   BLAZE_INTERNAL_ASSERT( object_ != nullptr, "Execution of empty task slot detected" );
+
+   invoke_( object_ );
+   release();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the stored callable and marks the task slot as available.
+//
+// \return void
+*/
+inline void InlineTask::release() noexcept
+{
+   if( object_ != nullptr ) {
+      destroy_( object_ );
+      object_ = nullptr;
+      busy_.store( false, std::memory_order_release );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Invokes the given type-erased callable.
+//
+// \param object The callable to be invoked.
+// \return void
+*/
+template< typename Callable >  // Type of the callable
+void InlineTask::invoke( void* object )
+{
+   ( *static_cast<Callable*>( object ) )();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the given type-erased callable stored inside the internal buffer.
+//
+// \param object The callable to be destroyed.
+// \return void
+*/
+template< typename Callable >  // Type of the callable
+void InlineTask::destroyInplace( void* object )
+{
+   static_cast<Callable*>( object )->~Callable();
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Destroys the given type-erased, dynamically allocated callable.
+//
+// \param object The callable to be destroyed.
+// \return void
+*/
+template< typename Callable >  // Type of the callable
+void InlineTask::destroyDynamic( void* object )
+{
+   delete static_cast<Callable*>( object );
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
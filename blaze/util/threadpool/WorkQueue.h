@@ -0,0 +1,266 @@
+//=================================================================================================
+/*!
+//  \file blaze/util/threadpool/WorkQueue.h
+//  \brief Work-stealing queue for the task scheduler
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+#define _BLAZE_UTIL_THREADPOOL_WORKQUEUE_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <blaze/util/NonCopyable.h>
+#include <blaze/util/StaticAssert.h>
+#include <blaze/util/Types.h>
+#include <blaze/util/threadpool/InlineTask.h>
+
+
+namespace blaze {
+
+namespace threadpool {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Lock-free work-stealing queue for the task scheduler.
+// \ingroup threads
+//
+// The WorkQueue class implements a bounded variant of the Chase-Lev work-stealing deque. The
+// owning thread adds and removes tasks at the bottom of the queue via push() and pop() (LIFO),
+// all other threads remove tasks from the top of the queue via steal() (FIFO). None of the
+// operations acquires a lock. In case the queue is full, push() fails and the owning thread
+// is expected to execute the task itself.
+*/
+class WorkQueue
+   : private NonCopyable
+{
+ public:
+   //**Compilation flags***************************************************************************
+   //! Maximum number of tasks in the work queue (must be a power of two).
+   static constexpr size_t capacity = 1024UL;
+   //**********************************************************************************************
+
+   //**Constructor*********************************************************************************
+   /*!\name Constructor */
+   //@{
+   explicit inline WorkQueue() noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Get functions*******************************************************************************
+   /*!\name Get functions */
+   //@{
+   inline bool isEmpty() const noexcept;
+   //@}
+   //**********************************************************************************************
+
+   //**Element functions***************************************************************************
+   /*!\name Element functions */
+   //@{
+   inline bool        push ( InlineTask* task ) noexcept;
+   inline InlineTask* pop  () noexcept;
+   inline InlineTask* steal() noexcept;
+   //@}
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using Index = ptrdiff_t;  //!< Signed index type of the work queue.
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   alignas( 64 ) std::atomic<Index> top_;     //!< Index of the oldest task (stealing end).
+   alignas( 64 ) std::atomic<Index> bottom_;  //!< Index past the newest task (owning end).
+   alignas( 64 ) std::atomic<InlineTask*> tasks_[capacity];  //!< Ring buffer of tasks.
+   //@}
+   //**********************************************************************************************
+
+   //**Compile time checks*************************************************************************
+   /*! \cond BLAZE_INTERNAL */
+   BLAZE_STATIC_ASSERT( capacity > 0UL && ( capacity & ( capacity - 1UL ) ) == 0UL );
+   /*! \endcond */
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTOR
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Default constructor for WorkQueue.
+*/
+inline WorkQueue::WorkQueue() noexcept
+   : top_   ( 0 )  // Index of the oldest task (stealing end)
+   , bottom_( 0 )  // Index past the newest task (owning end)
+{
+   for( auto& task : tasks_ ) {
+      task.store( nullptr, std::memory_order_relaxed );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GET FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns whether the work queue is (momentarily) empty.
+//
+// \return \a true if the work queue is empty, \a false if it is not.
+//
+// Note that the result is only a snapshot in case other threads concurrently access the queue.
+*/
+inline bool WorkQueue::isEmpty() const noexcept
+{
+   const Index b( bottom_.load( std::memory_order_acquire ) );
+   const Index t( top_.load( std::memory_order_acquire ) );
+   return b <= t;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  ELEMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Adding a task to the bottom of the work queue.
+//
+// \param task The task to be added.
+// \return \a true if the task was added, \a false in case the work queue is full.
+//
+// This function must only be called by the owning thread of the work queue.
+*/
+inline bool WorkQueue::push( InlineTask* task ) noexcept
+{
+   const Index b( bottom_.load( std::memory_order_relaxed ) );
+   const Index t( top_.load( std::memory_order_acquire ) );
+
+   if( b - t >= static_cast<Index>( capacity ) )
+      return false;
+
+   tasks_[b & ( capacity - 1UL )].store( task, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_release );
+   bottom_.store( b + 1, std::memory_order_relaxed );
+
+   return true;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the newest task from the bottom of the work queue.
+//
+// \return The removed task or \a nullptr in case the work queue is empty.
+//
+// This function must only be called by the owning thread of the work queue.
+*/
+inline InlineTask* WorkQueue::pop() noexcept
+{
+   const Index b( bottom_.load( std::memory_order_relaxed ) - 1 );
+   bottom_.store( b, std::memory_order_relaxed );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   Index t( top_.load( std::memory_order_relaxed ) );
+
+   if( t > b ) {
+      bottom_.store( b + 1, std::memory_order_relaxed );
+      return nullptr;
+   }
+
+   InlineTask* task( tasks_[b & ( capacity - 1UL )].load( std::memory_order_relaxed ) );
+
+   if( t == b ) {
+      if( !top_.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+         task = nullptr;
+      bottom_.store( b + 1, std::memory_order_relaxed );
+   }
+
+   return task;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Removes the oldest task from the top of the work queue.
+//
+// \return The removed task or \a nullptr in case the work queue is empty or the task was taken
+//         by a concurrent operation.
+//
+// This function can be called by any thread.
+*/
+inline InlineTask* WorkQueue::steal() noexcept
+{
+   Index t( top_.load( std::memory_order_acquire ) );
+   std::atomic_thread_fence( std::memory_order_seq_cst );
+   const Index b( bottom_.load( std::memory_order_acquire ) );
+
+   if( t >= b )
+      return nullptr;
+
+   InlineTask* task( tasks_[t & ( capacity - 1UL )].load( std::memory_order_relaxed ) );
+
+   if( !top_.compare_exchange_strong( t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed ) )
+      return nullptr;
+
+   return task;
+}
+//*************************************************************************************************
+
+} // namespace threadpool
+
+} // namespace blaze
+
+#endif
@@ -41,6 +41,7 @@
 #include <vector>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
 #include <blaze/util/Timing.h>
 #include <blazemark/blaze/CG.h>
 #include <blazemark/blaze/init/DynamicVector.h>
@@ -143,6 +144,83 @@ double cg( size_t N, size_t steps, size_t iterations )
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Blaze conjugate gradient solver kernel.
+//
+// \param N The number of rows and columns of the 2D discretized grid.
+// \param steps The number of solving steps to perform.
+// \param iterations The number of iterations to perform.
+// \return Minimum runtime of the kernel function.
+//
+// This kernel function solves the same system as the cg() kernel by means of the blaze::cg()
+// solver, which fuses the vector updates with the subsequent dot products. In order to perform
+// exactly the given number of iterations, the tolerance of the solver is set to zero.
+*/
+double cgSolver( size_t N, size_t steps, size_t iterations )
+{
+   using ::blazemark::element_t;
+   using ::blaze::columnVector;
+   using ::blaze::rowMajor;
+
+   ::blaze::setSeed( seed );
+
+   const size_t NN( N*N );
+
+   std::vector<size_t> nnz( NN, 5UL );
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i == 0UL || i == N-1UL ) --nnz[i*N+j];
+         if( j == 0UL || j == N-1UL ) --nnz[i*N+j];
+      }
+   }
+
+   ::blaze::CompressedMatrix<element_t,rowMajor> A( NN, NN, nnz );
+   ::blaze::DynamicVector<element_t,columnVector> x( NN ), b( NN );
+   ::blaze::SolverSettings settings;
+   ::blaze::timing::WcTimer timer;
+
+   for( size_t i=0UL; i<N; ++i ) {
+      for( size_t j=0UL; j<N; ++j ) {
+         if( i > 0UL   ) A.append( i*N+j, (i-1UL)*N+j, -1.0 );  // Top neighbor
+         if( j > 0UL   ) A.append( i*N+j, i*N+j-1UL  , -1.0 );  // Left neighbor
+         A.append( i*N+j, i*N+j, 4.0 );
+         if( j < N-1UL ) A.append( i*N+j, i*N+j+1UL  , -1.0 );  // Right neighbor
+         if( i < N-1UL ) A.append( i*N+j, (i+1UL)*N+j, -1.0 );  // Bottom neighbor
+      }
+   }
+
+   init( b );
+
+   settings.maxIterations = iterations;
+   settings.tolerance     = 0.0;
+
+   for( size_t rep=0UL; rep<reps; ++rep )
+   {
+      timer.start();
+      for( size_t step=0UL; step<steps; ++step ) {
+         reset( x );
+         ::blaze::cg( A, x, b, settings );
+      }
+      timer.end();
+
+      if( x.size() != NN )
+         std::cerr << " Line " << __LINE__ << ": ERROR detected!!!\n";
+
+      if( timer.last() > maxtime )
+         break;
+   }
+
+   const double minTime( timer.min()     );
+   const double avgTime( timer.average() );
+
+   if( minTime * ( 1.0 + deviation*0.01 ) < avgTime )
+      std::cerr << " Blaze kernel 'cgSolver': Time deviation too large!!!\n";
+
+   return minTime;
+}
+//*************************************************************************************************
+
 } // namespace blaze
 
 } // namespace blazemark
@@ -235,6 +235,17 @@ void cg( std::vector<Run>& runs, Benchmarks benchmarks )
                                 ( 19UL*N*N - 8UL*N ) * steps * iterations ) / run->getBlazeResult() / 1E6 );
          std::cout << "     " << std::setw(12) << N << mflops << std::endl;
       }
+
+      std::cout << "   Blaze solver [MFlop/s]:\n";
+      for( std::vector<Run>::iterator run=runs.begin(); run!=runs.end(); ++run ) {
+         const size_t N         ( run->getSize()  );
+         const size_t steps     ( run->getSteps() );
+         const size_t iterations( run->getIterations() );
+         const double time( blazemark::blaze::cgSolver( N, steps, iterations ) );
+         const double mflops( ( ( 13UL*N*N - 8UL*N - 1UL ) * steps +
+                                ( 19UL*N*N - 8UL*N ) * steps * iterations ) / time / 1E6 );
+         std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+      }
    }
 
 #if BLAZEMARK_BOOST_MODE
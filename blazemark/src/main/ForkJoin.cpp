@@ -0,0 +1,173 @@
+//=================================================================================================
+/*!
+//  \file src/main/ForkJoin.cpp
+//  \brief Source file for the Blaze fork/join benchmark
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <blaze/util/TaskScheduler.h>
+#include <blaze/util/ThreadPool.h>
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Task scheduler based on C++11 threads.
+*/
+using Scheduler = blaze::TaskScheduler< std::thread
+                                      , std::mutex
+                                      , std::unique_lock<std::mutex>
+                                      , std::condition_variable >;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Thread pool based on C++11 threads.
+*/
+using Pool = blaze::ThreadPool< std::thread
+                              , std::mutex
+                              , std::unique_lock<std::mutex>
+                              , std::condition_variable >;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the average latency of a fork/join operation.
+//
+// \param threads The total number of threads.
+// \param steps The number of fork/join operations.
+// \return The average latency of a single fork/join operation in microseconds.
+//
+// This function measures the time required to schedule one empty task per thread and to wait
+// for the completion of all tasks. The measurement is preceded by a short warm-up phase.
+*/
+template< typename Executor >
+double forkjoin( std::size_t threads, std::size_t steps )
+{
+   Executor executor( threads );
+
+   auto task = [](){};
+
+   for( std::size_t step=0UL; step<steps/10UL+1UL; ++step ) {
+      for( std::size_t i=0UL; i<threads; ++i )
+         executor.schedule( task );
+      executor.wait();
+   }
+
+   const auto start( std::chrono::steady_clock::now() );
+
+   for( std::size_t step=0UL; step<steps; ++step ) {
+      for( std::size_t i=0UL; i<threads; ++i )
+         executor.schedule( task );
+      executor.wait();
+   }
+
+   const auto end( std::chrono::steady_clock::now() );
+
+   return std::chrono::duration<double,std::micro>( end - start ).count() / steps;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze fork/join benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 3 ) {
+      std::cerr << " Invalid use of program 'ForkJoin'!\n"
+                << "   Use: ./forkjoin <max_number_of_threads> [<number_of_steps>]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t N( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t steps( ( argc == 3 )?( static_cast<std::size_t>( atoi( argv[2] ) ) ):( 10000UL ) );
+
+   if( N == 0UL || steps == 0UL ) {
+      std::cerr << " Invalid number of threads or steps!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   std::cout << "\n Fork/join latency of " << steps << " steps (in microseconds):\n"
+             << "   Threads   TaskScheduler   ThreadPool\n";
+
+   for( std::size_t threads=1UL; threads<=N; threads*=2UL )
+   {
+      const double scheduler( forkjoin<Scheduler>( threads, steps ) );
+      const double pool     ( forkjoin<Pool>     ( threads, steps ) );
+
+      std::cout << "   " << std::setw(7) << threads
+                << "   " << std::setw(13) << std::fixed << std::setprecision(3) << scheduler
+                << "   " << std::setw(10) << std::fixed << std::setprecision(3) << pool
+                << std::endl;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,168 @@
+//=================================================================================================
+/*!
+//  \file src/main/NumaBandwidth.cpp
+//  \brief Source file for the Blaze NUMA bandwidth benchmark
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/system/SMP.h>
+
+
+
+
+//=================================================================================================
+//
+//  BENCHMARK FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the memory bandwidth of the triad \f$ \vec{a} = \vec{b} + s \cdot \vec{c} \f$.
+//
+// \param N The size of the vectors.
+// \param steps The number of triad operations.
+// \param firstTouch \a true in case the vectors are initialized in parallel, \a false if not.
+// \return The memory bandwidth in GB/s.
+//
+// This function measures the memory bandwidth of the STREAM triad for the current number of
+// threads. In case \a firstTouch is \a true, the vectors are allocated and initialized by means
+// of the parallel first-touch initialization, i.e. every thread touches the part of the vectors
+// it later processes. Otherwise the vectors are initialized within a serial section and all
+// memory pages are placed on the NUMA node of the main thread. The measurement is preceded by
+// a single warm-up operation.
+*/
+double triad( std::size_t N, std::size_t steps, bool firstTouch )
+{
+   using Vector = blaze::DynamicVector<double,blaze::columnVector>;
+
+   Vector a, b, c;
+
+   if( firstTouch ) {
+      a.resize( N, false ); a = 0.0;
+      b.resize( N, false ); b = 1.0;
+      c.resize( N, false ); c = 2.0;
+   }
+   else {
+      BLAZE_SERIAL_SECTION {
+         a.resize( N, false ); a = 0.0;
+         b.resize( N, false ); b = 1.0;
+         c.resize( N, false ); c = 2.0;
+      }
+   }
+
+   const double s( 3.0 );
+
+   a = b + s * c;
+
+   const auto start( std::chrono::steady_clock::now() );
+
+   for( std::size_t step=0UL; step<steps; ++step ) {
+      a = b + s * c;
+   }
+
+   const auto end( std::chrono::steady_clock::now() );
+
+   const double seconds( std::chrono::duration<double>( end - start ).count() );
+   const double bytes  ( 3.0 * sizeof(double) * N * steps );
+
+   return bytes / seconds * 1E-9;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the Blaze NUMA bandwidth benchmark.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+*/
+int main( int argc, char** argv )
+{
+   if( argc < 2 || argc > 4 ) {
+      std::cerr << " Invalid use of program 'NumaBandwidth'!\n"
+                << "   Use: ./numabandwidth <max_number_of_threads> [<vector_size> [<number_of_steps>]]\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::size_t T( static_cast<std::size_t>( atoi( argv[1] ) ) );
+   const std::size_t N( ( argc >= 3 )?( static_cast<std::size_t>( atoi( argv[2] ) ) ):( 20000000UL ) );
+   const std::size_t steps( ( argc == 4 )?( static_cast<std::size_t>( atoi( argv[3] ) ) ):( 20UL ) );
+
+   if( T == 0UL || N == 0UL || steps == 0UL ) {
+      std::cerr << " Invalid number of threads, vector size or steps!\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   if( !BLAZE_FIRST_TOUCH_MODE ) {
+      std::cerr << " Warning: First-touch initialization is not active!\n";
+   }
+
+   std::cout << "\n Triad bandwidth for N=" << N << " (in GB/s):\n"
+             << "   Threads   Serial init   First touch\n";
+
+   for( std::size_t threads=1UL; threads<=T; threads*=2UL )
+   {
+      blaze::setNumThreads( threads );
+
+      const double serial( triad( N, steps, false ) );
+      const double touch ( triad( N, steps, true  ) );
+
+      std::cout << "   " << std::setw(7) << threads
+                << "   " << std::setw(11) << std::fixed << std::setprecision(2) << serial
+                << "   " << std::setw(11) << std::fixed << std::setprecision(2) << touch
+                << std::endl;
+   }
+
+   std::cout << std::endl;
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
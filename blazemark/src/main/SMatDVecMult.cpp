@@ -247,6 +247,23 @@ void smatdvecmult( std::vector<Run>& runs, Benchmarks benchmarks )
       }
    }
 
+   if( benchmarks.runBlaze ) {
+      std::vector<Run>::iterator run=runs.begin();
+      while( run != runs.end() ) {
+         const float fill( run->getFillingDegree() );
+         std::cout << "   Blaze SELL-C-sigma (" << fill << "% filled) [MFlop/s]:\n";
+         for( ; run!=runs.end(); ++run ) {
+            if( run->getFillingDegree() != fill ) break;
+            const size_t N    ( run->getSize()     );
+            const size_t F    ( run->getNonZeros() );
+            const size_t steps( run->getSteps()    );
+            const double time( blazemark::blaze::smatdvecmultSell( N, F, steps ) );
+            const double mflops( run->getFlops() * steps / time / 1E6 );
+            std::cout << "     " << std::setw(12) << N << mflops << std::endl;
+         }
+      }
+   }
+
 #if BLAZEMARK_BOOST_MODE
    if( benchmarks.runBoost ) {
       std::vector<Run>::iterator run=runs.begin();
@@ -0,0 +1,353 @@
+//=================================================================================================
+/*!
+//  \file src/main/TuneProbe.cpp
+//  \brief Source file for the measurement probe of the Blaze tuning tool
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/system/Blocking.h>
+#include <blaze/system/Thresholds.h>
+
+
+//*************************************************************************************************
+/*!\brief Compilation switch for the restriction of the probe to the matrix multiplication.
+//
+// This switch restricts the probe to the dense matrix/dense matrix multiplication, which is
+// used for the tuning of the block sizes. Since the block size tuning requires a recompilation
+// of the probe for every candidate, this considerably reduces the time spent for the tuning.
+*/
+#ifndef BLAZEMARK_TUNE_MMM_ONLY
+#define BLAZEMARK_TUNE_MMM_ONLY 0
+#endif
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TYPE DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Dense vector type of the probe.
+*/
+using Vec = blaze::DynamicVector<double>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Row-major dense matrix type of the probe.
+*/
+using Mat = blaze::DynamicMatrix<double,blaze::rowMajor>;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Column-major dense matrix type of the probe.
+*/
+using TMat = blaze::DynamicMatrix<double,blaze::columnMajor>;
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MEASUREMENT FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Sink for the results of reduction operations.
+*/
+volatile double sink = 0.0;
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures the runtime of a single execution of the given operation.
+//
+// \param op The operation to be measured.
+// \return The minimum runtime of a single execution of the operation in seconds.
+//
+// This function doubles the number of repetitions of the given operation until a single
+// measurement takes at least 20 milliseconds. Afterwards it returns the minimum runtime per
+// execution of three measurements.
+*/
+template< typename OP >
+double measure( OP op )
+{
+   using Clock = std::chrono::steady_clock;
+
+   const double minTime( 0.02 );
+
+   op();
+
+   std::size_t steps( 1UL );
+   double time( 0.0 );
+
+   while( true ) {
+      const auto start( Clock::now() );
+      for( std::size_t step=0UL; step<steps; ++step )
+         op();
+      time = std::chrono::duration<double>( Clock::now() - start ).count();
+      if( time >= minTime ) break;
+      steps *= 2UL;
+   }
+
+   double best( time / steps );
+
+   for( std::size_t rep=0UL; rep<2UL; ++rep ) {
+      const auto start( Clock::now() );
+      for( std::size_t step=0UL; step<steps; ++step )
+         op();
+      time = std::chrono::duration<double>( Clock::now() - start ).count();
+      best = std::min( best, time / steps );
+   }
+
+   return best;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures a dense vector operation.
+//
+// \param N The size of the dense vectors.
+// \param op The operation on the three given dense vectors.
+// \return The minimum runtime of a single execution of the operation in seconds.
+*/
+template< typename OP >
+double measureVector( std::size_t N, OP op )
+{
+   Vec a( N ), b( N ), c( N );
+   blaze::randomize( b );
+   blaze::randomize( c );
+   return measure( [&](){ op( a, b, c ); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures a dense matrix/dense vector operation.
+//
+// \param N The number of rows and columns of the dense matrix.
+// \param op The operation on the given dense matrix and the two given dense vectors.
+// \return The minimum runtime of a single execution of the operation in seconds.
+*/
+template< bool SO, typename OP >
+double measureMatVec( std::size_t N, OP op )
+{
+   blaze::DynamicMatrix<double,SO> A( N, N );
+   Vec a( N ), b( N );
+   blaze::randomize( A );
+   blaze::randomize( b );
+   return measure( [&](){ op( a, A, b ); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Measures a dense matrix/dense matrix operation.
+//
+// \param M The number of rows of the dense matrices.
+// \param N The number of columns of the dense matrices.
+// \param op The operation on the three given dense matrices.
+// \return The minimum runtime of a single execution of the operation in seconds.
+*/
+template< bool SO1, bool SO2, typename OP >
+double measureMatMat( std::size_t M, std::size_t N, OP op )
+{
+   Mat C( M, N );
+   blaze::DynamicMatrix<double,SO1> A( M, N );
+   blaze::DynamicMatrix<double,SO2> B( M, N );
+   blaze::randomize( A );
+   blaze::randomize( B );
+   return measure( [&](){ op( C, A, B ); } );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  OPERATIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Measures the given operation for the given size.
+//
+// \param op The name of the operation.
+// \param N The size of the operation.
+// \return The minimum runtime of a single execution of the operation in seconds.
+//
+// For vector operations \a N specifies the size of the vectors, for all matrix operations the
+// number of rows and columns of the (square) matrices. The only exception is the in-place
+// transposition, which works on a \f$ N \times 2N \f$ matrix. In case the given operation
+// is unknown, the function returns -1.
+*/
+double run( const std::string& op, std::size_t N )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   if( op == "dmatdmatmult" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& B ){ C = A * B; } );
+
+#if !BLAZEMARK_TUNE_MMM_ONLY
+   if( op == "dvecassign" )
+      return measureVector( N, []( Vec& a, const Vec& b, const Vec& ){ a = b; } );
+   if( op == "dvecscalarmult" )
+      return measureVector( N, []( Vec& a, const Vec& b, const Vec& ){ a = b * 1.1; } );
+   if( op == "dvecdvecadd" )
+      return measureVector( N, []( Vec& a, const Vec& b, const Vec& c ){ a = b + c; } );
+   if( op == "dvecdvecsub" )
+      return measureVector( N, []( Vec& a, const Vec& b, const Vec& c ){ a = b - c; } );
+   if( op == "dvecdvecmult" )
+      return measureVector( N, []( Vec& a, const Vec& b, const Vec& c ){ a = b * c; } );
+   if( op == "dvecdvecinner" )
+      return measureVector( N, []( Vec&, const Vec& b, const Vec& c ){ sink = sink + dot( b, c ); } );
+
+   if( op == "dmatdvecmult" )
+      return measureMatVec<rowMajor>( N, []( Vec& a, const Mat& A, const Vec& b ){ a = A * b; } );
+   if( op == "tdmatdvecmult" )
+      return measureMatVec<columnMajor>( N, []( Vec& a, const TMat& A, const Vec& b ){ a = A * b; } );
+   if( op == "tdvecdmatmult" )
+      return measureMatVec<rowMajor>( N, []( Vec& a, const Mat& A, const Vec& b ){ a = trans( trans( b ) * A ); } );
+   if( op == "tdvectdmatmult" )
+      return measureMatVec<columnMajor>( N, []( Vec& a, const TMat& A, const Vec& b ){ a = trans( trans( b ) * A ); } );
+
+   if( op == "dmatassign" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& ){ C = A; } );
+   if( op == "dmatscalarmult" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& ){ C = A * 1.1; } );
+   if( op == "dmatdmatadd" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& B ){ C = A + B; } );
+   if( op == "dmattdmatadd" )
+      return measureMatMat<rowMajor,columnMajor>( N, N, []( Mat& C, const Mat& A, const TMat& B ){ C = A + B; } );
+   if( op == "dmatdmatsub" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& B ){ C = A - B; } );
+   if( op == "dmattdmatsub" )
+      return measureMatMat<rowMajor,columnMajor>( N, N, []( Mat& C, const Mat& A, const TMat& B ){ C = A - B; } );
+   if( op == "dmatdmatschur" )
+      return measureMatMat<rowMajor,rowMajor>( N, N, []( Mat& C, const Mat& A, const Mat& B ){ C = A % B; } );
+   if( op == "dmattdmatschur" )
+      return measureMatMat<rowMajor,columnMajor>( N, N, []( Mat& C, const Mat& A, const TMat& B ){ C = A % B; } );
+
+   if( op == "dmattdmatmult" )
+      return measureMatMat<rowMajor,columnMajor>( N, N, []( Mat& C, const Mat& A, const TMat& B ){ C = A * B; } );
+   if( op == "tdmatdmatmult" )
+      return measureMatMat<columnMajor,rowMajor>( N, N, []( Mat& C, const TMat& A, const Mat& B ){ C = A * B; } );
+   if( op == "tdmattdmatmult" )
+      return measureMatMat<columnMajor,columnMajor>( N, N, []( Mat& C, const TMat& A, const TMat& B ){ C = A * B; } );
+
+   if( op == "dmattranspose" ) {
+      Mat A( N, 2UL*N );
+      blaze::randomize( A );
+      return measure( [&](){ A.transpose(); } );
+   }
+#endif
+
+   return -1.0;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief The main function for the measurement probe of the Blaze tuning tool.
+//
+// \param argc Number of command line arguments.
+// \param argv Array of command line arguments.
+// \return Success code for the execution.
+//
+// The probe measures the given operation for all given sizes and prints one line per size,
+// which contains the size and the runtime of a single execution in seconds. The thresholds
+// and block sizes of the probe are specified at compile time by the tuning tool.
+*/
+int main( int argc, char** argv )
+{
+   if( argc == 2 && std::string( argv[1] ) == "--info" ) {
+      std::cout << "threads " << blaze::getNumThreads() << "\n"
+                << "blas " << BLAZE_BLAS_MODE << "\n"
+                << "packed " << blaze::usePackedKernels << "\n";
+      return EXIT_SUCCESS;
+   }
+
+   if( argc < 3 ) {
+      std::cerr << " Invalid use of program 'TuneProbe'!\n"
+                << "   Use: ./tuneprobe <operation> <size>...\n"
+                << "        ./tuneprobe --info\n" << std::endl;
+      return EXIT_FAILURE;
+   }
+
+   const std::string op( argv[1] );
+
+   for( int i=2; i<argc; ++i )
+   {
+      const std::size_t N( static_cast<std::size_t>( atoi( argv[i] ) ) );
+      const double time( run( op, N ) );
+
+      if( time < 0.0 ) {
+         std::cerr << " Unknown operation '" << op << "'!\n" << std::endl;
+         return EXIT_FAILURE;
+      }
+
+      std::cout << N << " " << time << std::endl;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
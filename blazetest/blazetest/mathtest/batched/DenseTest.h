@@ -0,0 +1,493 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/batched/DenseTest.h
+//  \brief Header file for the batched dense matrix operation test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_BATCHED_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_BATCHED_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/DenseMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/IdentityMatrix.h>
+#include <blaze/math/StaticMatrix.h>
+#include <blaze/math/StaticVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batched {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all batched dense matrix operation tests.
+//
+// This class represents a test suite for the batched operations on arrays of small dense
+// matrices (batchInvert(), batchDet(), batchSolve(), and batchMult()). All results are compared
+// to the results of the according operations on the single matrices.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type, size_t N, bool SO >
+   void testRandom( size_t size );
+
+   template< typename Type, size_t N, bool SO >
+   void testSingular( size_t size );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type, size_t N, bool SO >
+   void initialize( blaze::StaticMatrix<Type,N,N,SO>& matrix );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the batched operations with random \f$ N \times N \f$ matrices.
+//
+// \param size The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched operations for a batch of random \f$ N \times N \f$ matrices.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void DenseTest::testRandom( size_t size )
+{
+   using MT = blaze::StaticMatrix<Type,N,N,SO>;
+   using VT = blaze::StaticVector<Type,N,blaze::columnVector>;
+
+   blaze::DynamicVector<MT> A( size );
+   blaze::DynamicVector<MT> B( size );
+   blaze::DynamicVector<VT> x( size );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      initialize( A[i] );
+      randomize( B[i] );
+      randomize( x[i] );
+   }
+
+
+   //=====================================================================================
+   // Batched matrix inversion
+   //=====================================================================================
+
+   {
+      test_ = "Batched matrix inversion";
+
+      blaze::DynamicVector<MT> C( A );
+      blaze::batchInvert( C.data(), C.size() );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( !isIdentity( A[i] * C[i] ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched matrix inversion failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Batch size: " << size << "\n"
+                << "   Index: " << i << "\n"
+                << "   Initial matrix (A):\n" << A[i] << "\n"
+                << "   Result (B):\n" << C[i] << "\n"
+                << "   A * B =\n" << ( A[i] * C[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched determinant computation
+   //=====================================================================================
+
+   {
+      test_ = "Batched determinant computation";
+
+      blaze::DynamicVector<Type> d( size );
+      blaze::batchDet( A.data(), d.data(), A.size() );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( !blaze::equal( d[i], det( A[i] ) ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched determinant computation failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Batch size: " << size << "\n"
+                << "   Index: " << i << "\n"
+                << "   Matrix:\n" << A[i] << "\n"
+                << "   Result: " << d[i] << "\n"
+                << "   Expected result: " << det( A[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched solution of linear systems
+   //=====================================================================================
+
+   {
+      test_ = "Batched solution of linear systems";
+
+      blaze::DynamicVector<VT> y( x );
+      blaze::batchSolve( A.data(), y.data(), A.size() );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( A[i] * y[i] != x[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched solution of linear systems failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Batch size: " << size << "\n"
+                << "   Index: " << i << "\n"
+                << "   System matrix (A):\n" << A[i] << "\n"
+                << "   Right-hand side (b):\n" << x[i] << "\n"
+                << "   Result (x):\n" << y[i] << "\n"
+                << "   A * x =\n" << ( A[i] * y[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched matrix/matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Batched matrix/matrix multiplication";
+
+      blaze::DynamicVector<MT> C( size );
+      blaze::batchMult( A.data(), B.data(), C.data(), A.size() );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( C[i] != A[i] * B[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched matrix/matrix multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Batch size: " << size << "\n"
+                << "   Index: " << i << "\n"
+                << "   Result:\n" << C[i] << "\n"
+                << "   Expected result:\n" << ( A[i] * B[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched matrix/vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Batched matrix/vector multiplication";
+
+      blaze::DynamicVector<VT> y( size );
+      blaze::batchMult( A.data(), x.data(), y.data(), A.size() );
+
+      for( size_t i=0UL; i<size; ++i ) {
+         if( y[i] != A[i] * x[i] ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Batched matrix/vector multiplication failed\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( MT ).name() << "\n"
+                << "   Batch size: " << size << "\n"
+                << "   Index: " << i << "\n"
+                << "   Result:\n" << y[i] << "\n"
+                << "   Expected result:\n" << ( A[i] * x[i] ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the batched operations with a singular \f$ N \times N \f$ matrix.
+//
+// \param size The number of matrices in the batch.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the batched operations for a batch of \f$ N \times N \f$ matrices that
+// contains a single singular matrix. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename Type  // Element type of the matrices
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void DenseTest::testSingular( size_t size )
+{
+   using MT = blaze::StaticMatrix<Type,N,N,SO>;
+   using VT = blaze::StaticVector<Type,N,blaze::columnVector>;
+
+   blaze::DynamicVector<MT> A( size );
+   blaze::DynamicVector<VT> x( size );
+
+   for( size_t i=0UL; i<size; ++i ) {
+      initialize( A[i] );
+      randomize( x[i] );
+   }
+
+   const size_t index( blaze::rand<size_t>( 0UL, size-1UL ) );
+   reset( A[index] );
+
+
+   //=====================================================================================
+   // Batched matrix inversion
+   //=====================================================================================
+
+   {
+      test_ = "Batched inversion of a singular matrix";
+
+      blaze::DynamicVector<MT> C( A );
+      bool thrown( false );
+
+      try {
+         blaze::batchInvert( C.data(), C.size() );
+      }
+      catch( std::runtime_error& ) {
+         thrown = true;
+      }
+
+      if( !thrown ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Inversion of a singular matrix succeeded\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Batch size: " << size << "\n"
+             << "   Index: " << index << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched determinant computation
+   //=====================================================================================
+
+   {
+      test_ = "Batched determinant of a singular matrix";
+
+      blaze::DynamicVector<Type> d( size );
+      blaze::batchDet( A.data(), d.data(), A.size() );
+
+      if( !blaze::isDefault( d[index] ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Non-zero determinant of a singular matrix\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Batch size: " << size << "\n"
+             << "   Index: " << index << "\n"
+             << "   Result: " << d[index] << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Batched solution of linear systems
+   //=====================================================================================
+
+   {
+      test_ = "Batched solution of a singular linear system";
+
+      bool thrown( false );
+
+      try {
+         blaze::batchSolve( A.data(), x.data(), A.size() );
+      }
+      catch( std::runtime_error& ) {
+         thrown = true;
+      }
+
+      if( !thrown ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solution of a singular linear system succeeded\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( MT ).name() << "\n"
+             << "   Batch size: " << size << "\n"
+             << "   Index: " << index << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix as a well-conditioned, non-singular matrix.
+//
+// \param matrix The matrix to be initialized.
+// \return void
+*/
+template< typename Type  // Element type of the matrix
+        , size_t N       // Number of rows and columns
+        , bool SO >      // Storage order
+void DenseTest::initialize( blaze::StaticMatrix<Type,N,N,SO>& matrix )
+{
+   randomize( matrix );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      matrix(i,i) += Type( 2*N );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the batched dense matrix operations.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the batched dense matrix operation test.
+*/
+#define RUN_BATCHED_DENSE_TEST \
+   blazetest::mathtest::batched::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace batched
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
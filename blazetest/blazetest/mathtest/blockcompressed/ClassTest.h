@@ -0,0 +1,687 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/blockcompressed/ClassTest.h
+//  \brief Header file for the block compressed matrix test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_BLOCKCOMPRESSED_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_BLOCKCOMPRESSED_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/BlockCompressedMatrix.h>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace blockcompressed {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the block compressed matrix.
+//
+// This class represents a test suite for the BlockCompressedMatrix class template. All results
+// are compared to the results of the according CompressedMatrix operations.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename BT, typename VT >
+   void testMatrix( size_t mb, size_t nb );
+
+   template< typename BT, typename RT >
+   void testConstruction( const RT& ref );
+
+   template< typename BT, typename RT >
+   void testAccess( const RT& ref );
+
+   template< typename BT, typename VT, typename RT >
+   void testOperations( const RT& ref );
+
+   void testInvalidSize();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected );
+
+   template< typename Type >
+   void checkIntact( const Type& object );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void initialize( blaze::CompressedMatrix<MT,SO>& matrix, size_t R, size_t C );
+
+   template< typename MT, bool SO >
+   void initialize( blaze::DynamicMatrix<MT,SO>& matrix );
+
+   template< typename VT, bool TF >
+   void initialize( blaze::DynamicVector<VT,TF>& vector );
+
+   template< typename MT, bool SO >
+   size_t countBlocks( const blaze::CompressedMatrix<MT,SO>& matrix, size_t R, size_t C );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;   //!< Label of the currently performed test.
+   std::string error_;  //!< Description of the current error type.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a block compressed matrix with \f$ MB \times NB \f$ blocks.
+//
+// \param mb The number of block rows of the matrix.
+// \param nb The number of block columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random reference matrix and tests the according block compressed
+// matrix of type \a BT. The dense vector and matrix operands of the products are of element
+// type \a VT. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename BT    // Type of the block compressed matrix
+        , typename VT >  // Element type of the dense operands
+void ClassTest::testMatrix( size_t mb, size_t nb )
+{
+   using RT = blaze::CompressedMatrix< blaze::ElementType_t<BT>, blaze::rowMajor >;
+
+   RT ref( mb*BT::blockHeight, nb*BT::blockWidth );
+   initialize( ref, BT::blockHeight, BT::blockWidth );
+
+   testConstruction<BT>( ref );
+   testAccess<BT>( ref );
+   testOperations<BT,VT>( ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction of a block compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion from sparse and dense matrices and the copy and move
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename BT    // Type of the block compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testConstruction( const RT& ref )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using ET = blaze::ElementType_t<RT>;
+
+   constexpr size_t R( BT::blockHeight );
+   constexpr size_t C( BT::blockWidth  );
+
+   {
+      test_  = "Conversion from a compressed matrix";
+      error_ = "Conversion failed";
+
+      BT mat( ref );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      const size_t blocks( countBlocks( ref, R, C ) );
+
+      if( mat.blockRows() != ref.rows() / R || mat.blockColumns() != ref.columns() / C ||
+          mat.nonZeroBlocks() != blocks || mat.nonZeros() != blocks*R*C ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix properties\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( BT ).name() << "\n"
+             << "   Number of block rows: " << mat.blockRows() << "\n"
+             << "   Number of block columns: " << mat.blockColumns() << "\n"
+             << "   Number of blocks: " << mat.nonZeroBlocks() << " (expected " << blocks << ")\n"
+             << "   Number of non-zeros: " << mat.nonZeros() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_  = "Conversion from a dense matrix";
+      error_ = "Conversion failed";
+
+      const blaze::DynamicMatrix<ET,columnMajor> dense( ref );
+      BT mat( dense );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion from a matrix expression";
+      error_ = "Conversion failed";
+
+      const blaze::CompressedMatrix<ET,columnMajor> opposite( ref );
+      BT mat( opposite + ref );
+
+      checkResult( mat, ref + ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion to a compressed matrix";
+      error_ = "Conversion failed";
+
+      const BT mat( ref );
+      const blaze::CompressedMatrix<ET,rowMajor> res( mat );
+
+      checkResult( res, ref );
+   }
+
+   {
+      test_  = "Copy and move operations";
+      error_ = "Copy or move failed";
+
+      const BT mat1( ref );
+      BT mat2( mat1 );
+      BT mat3( std::move( mat2 ) );
+      BT mat4;
+      mat4 = mat3;
+      BT mat5;
+      mat5 = std::move( mat4 );
+      BT mat6( ref );
+      mat6 = ref + ref;
+
+      checkResult( mat3, ref );
+      checkResult( mat5, ref );
+      checkResult( mat6, ref + ref );
+      checkIntact( mat5 );
+      checkIntact( mat6 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access functions of a block compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the iteration over the rows and the lookup functions of the block
+// compressed matrix. Since the iterators also traverse the zero elements of the stored blocks,
+// all elements are compared to the according elements of the reference matrix. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename BT    // Type of the block compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testAccess( const RT& ref )
+{
+   test_ = "Iteration and lookup";
+
+   const BT mat( ref );
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      bool valid( size_t( mat.end( i ) - mat.begin( i ) ) == mat.nonZeros( i ) &&
+                  mat.nonZeros( i ) == mat.capacity( i ) &&
+                  mat.nonZeros( i ) % BT::blockWidth == 0UL );
+
+      size_t nonzeros( 0UL );
+      size_t next( 0UL );
+
+      for( auto element=mat.cbegin( i ); valid && element!=mat.cend( i ); ++element ) {
+         valid = ( element->index() >= next && element->value() == ref(i,element->index()) );
+         next = element->index() + 1UL;
+         if( !blaze::isDefault( element->value() ) ) ++nonzeros;
+      }
+      valid = valid && ( nonzeros == ref.nonZeros( i ) );
+
+      for( size_t j=0UL; valid && j<ref.columns(); ++j )
+      {
+         const auto pos  ( mat.find( i, j ) );
+         const auto lower( mat.lowerBound( i, j ) );
+         const auto upper( mat.upperBound( i, j ) );
+
+         valid = ( pos == mat.end( i ) || ( pos->index() == j && pos->value() == ref(i,j) ) ) &&
+                 ( ref.find( i, j ) == ref.end( i ) || pos != mat.end( i ) ) &&
+                 ( lower == mat.end( i ) || lower->index() >= j ) &&
+                 ( lower == mat.begin( i ) || (lower-1)->index() < j ) &&
+                 ( upper == mat.end( i ) || upper->index() > j ) &&
+                 ( upper == mat.begin( i ) || (upper-1)->index() <= j ) &&
+                 ( mat(i,j) == ref(i,j) );
+      }
+
+      if( !valid ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid access to row " << i << "\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( BT ).name() << "\n"
+             << "   Reference:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplications with a block compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix/dense vector and sparse matrix/dense matrix products
+// with row-major and column-major dense matrices, including the according addition and
+// subtraction assignments. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename BT    // Type of the block compressed matrix
+        , typename VT    // Element type of the dense operands
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testOperations( const RT& ref )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   const size_t m( ref.rows() );
+   const size_t n( ref.columns() );
+
+   const BT mat( ref );
+
+   blaze::DynamicVector<VT,columnVector> x( n ), y( m );
+   initialize( x );
+   initialize( y );
+
+   blaze::DynamicMatrix<VT,columnMajor> B( n, 7UL );
+   initialize( B );
+   const blaze::DynamicMatrix<VT,rowMajor> Br( B );
+
+   {
+      test_  = "Matrix/vector multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicVector<VT,columnVector> res( mat * x );
+      checkResult( res, ref * x );
+
+      res = y;
+      res += mat * x;
+      checkResult( res, y + ref * x );
+
+      res -= mat * x;
+      checkResult( res, y );
+
+      res = mat * ( x + x );
+      checkResult( res, ref * ( x + x ) );
+
+      res = ( mat + mat ) * x;
+      checkResult( res, ( ref + ref ) * x );
+
+      if( m > 1UL ) {
+         res = y;
+         subvector( res, 1UL, m-1UL ) = submatrix( mat, 1UL, 0UL, m-1UL, n ) * x;
+         checkResult( subvector( res, 1UL, m-1UL ), submatrix( ref, 1UL, 0UL, m-1UL, n ) * x );
+      }
+
+      const blaze::DynamicVector<VT,rowVector> xt( trans( y ) );
+      blaze::DynamicVector<VT,rowVector> rest( xt * mat );
+      checkResult( rest, xt * ref );
+   }
+
+   {
+      test_  = "Matrix/row-major matrix multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicMatrix<VT,rowMajor> res1( mat * Br );
+      checkResult( res1, ref * B );
+
+      blaze::DynamicMatrix<VT,columnMajor> res2( mat * Br );
+      checkResult( res2, ref * B );
+
+      res1 += mat * Br;
+      res2 -= mat * Br;
+      checkResult( res1, 2 * ( ref * B ) );
+      checkResult( res2, blaze::DynamicMatrix<VT,columnMajor>( m, 7UL, VT() ) );
+
+      res1 = mat * submatrix( Br, 0UL, 2UL, n, 5UL );
+      checkResult( res1, ref * submatrix( B, 0UL, 2UL, n, 5UL ) );
+   }
+
+   {
+      test_  = "Matrix/column-major matrix multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicMatrix<VT,rowMajor> res( mat * B );
+      checkResult( res, ref * B );
+
+      res -= mat * B;
+      checkResult( res, blaze::DynamicMatrix<VT,rowMajor>( m, 7UL, VT() ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction with invalid matrix dimensions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the conversion of a matrix whose dimensions are not multiples of
+// the block size and the construction of a matrix whose number of block columns exceeds the
+// range of the index type fail. In case any construction succeeds, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testInvalidSize()
+{
+   test_ = "Construction with invalid matrix dimensions";
+
+   try {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref( 6UL, 5UL );
+      blaze::BlockCompressedMatrix<double,3UL,3UL> mat( ref );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction with a non-multiple of the block size succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      blaze::BlockCompressedMatrix<double,1UL,2UL,uint8_t> mat( 2UL, 1024UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction exceeding the range of the index type succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error_ << "\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants of a block compressed matrix.
+//
+// \param object The matrix to be checked.
+// \return void
+// \exception std::runtime_error Invariant violation detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkIntact( const Type& object )
+{
+   if( !isIntact( object ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Type:\n"
+          << "     " << typeid( Type ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix with random integral values.
+//
+// \param matrix The compressed matrix to be initialized.
+// \param R The number of rows per block.
+// \param C The number of columns per block.
+// \return void
+//
+// This function initializes the given matrix with a random selection of partially filled
+// \f$ R \times C \f$ blocks and random values without fractional part, which guarantees that
+// all results are computed exactly.
+*/
+template< typename MT  // Element type of the compressed matrix
+        , bool SO >    // Storage order
+void ClassTest::initialize( blaze::CompressedMatrix<MT,SO>& matrix, size_t R, size_t C )
+{
+   const size_t m( matrix.rows()    );
+   const size_t n( matrix.columns() );
+
+   matrix.reset();
+
+   for( size_t i=0UL; i<m; i+=R ) {
+      for( size_t j=0UL; j<n; j+=C ) {
+         if( blaze::rand<size_t>( 0UL, 3UL ) != 0UL )
+            continue;
+         for( size_t k=0UL; k<R*C; ++k ) {
+            if( blaze::rand<size_t>( 0UL, 2UL ) != 0UL )
+               matrix(i+k/C,j+k%C) = blaze::rand<int>( -9, 9 );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with random integral values.
+//
+// \param matrix The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Element type of the dense matrix
+        , bool SO >    // Storage order
+void ClassTest::initialize( blaze::DynamicMatrix<MT,SO>& matrix )
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; j<matrix.columns(); ++j ) {
+         matrix(i,j) = blaze::rand<int>( -9, 9 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector with random non-zero integral values.
+//
+// \param vector The dense vector to be initialized.
+// \return void
+*/
+template< typename VT  // Element type of the dense vector
+        , bool TF >    // Transpose flag
+void ClassTest::initialize( blaze::DynamicVector<VT,TF>& vector )
+{
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      vector[i] = blaze::rand<int>( 1, 9 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Counting the \f$ R \times C \f$ blocks of the given matrix that contain non-zero elements.
+//
+// \param matrix The compressed matrix to be examined.
+// \param R The number of rows per block.
+// \param C The number of columns per block.
+// \return The number of blocks containing at least one non-zero element.
+*/
+template< typename MT  // Element type of the compressed matrix
+        , bool SO >    // Storage order
+size_t ClassTest::countBlocks( const blaze::CompressedMatrix<MT,SO>& matrix, size_t R, size_t C )
+{
+   size_t blocks( 0UL );
+
+   for( size_t i=0UL; i<matrix.rows(); i+=R ) {
+      for( size_t j=0UL; j<matrix.columns(); j+=C ) {
+         if( nonZeros( submatrix( matrix, i, j, R, C ) ) > 0UL )
+            ++blocks;
+      }
+   }
+
+   return blocks;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the block compressed matrix.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the block compressed matrix test.
+*/
+#define RUN_BLOCKCOMPRESSED_CLASS_TEST \
+   blazetest::mathtest::blockcompressed::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace blockcompressed
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
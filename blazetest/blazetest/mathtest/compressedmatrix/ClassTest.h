@@ -111,6 +111,7 @@ class ClassTest
    void testSet         ();
    void testInsert      ();
    void testAppend      ();
+   void testAssemble    ();
    void testErase       ();
    void testFind        ();
    void testLowerBound  ();
@@ -0,0 +1,486 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedmatrix/SMPTest.h
+//  \brief Header file for the CompressedMatrix SMP assignment test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_SMPTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDMATRIX_SMPTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP assignment tests of the CompressedMatrix class template.
+//
+// This class represents a test suite for the parallel (compound) assignments to a compressed
+// matrix. All operands exceed the according SMP thresholds, such that the assignments are
+// performed by the two-pass algorithm (parallel evaluation of row/column blocks, restructuring
+// of the target, parallel transfer of the blocks). All results are compared to the results of
+// the according dense matrix operations.
+*/
+class SMPTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SMPTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO > void testAssign();
+   template< bool SO > void testAddAssign();
+   template< bool SO > void testSubAssign();
+   template< bool SO > void testMultiplication();
+   template< bool SO > void testRestructure();
+
+   template< typename MT1, typename MT2 >
+   void checkResult( const MT1& result, const MT2& expected ) const;
+
+   template< typename MT >
+   void checkCapacities( const MT& matrix, const std::vector<size_t>& capacities ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static blaze::DynamicMatrix<int,SO> random( size_t m, size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of dense matrices to a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel construction of a compressed matrix from a dense matrix and
+// the parallel assignment of dense matrices with both storage orders to a compressed matrix.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SMPTest::testAssign()
+{
+   const size_t m( 40UL );
+   const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD / m + 7UL );
+
+   {
+      test_ = "CompressedMatrix dense matrix construction";
+
+      const blaze::DynamicMatrix<int,SO> D( random<SO>( m, n ) );
+      const blaze::CompressedMatrix<int,SO> C( D );
+
+      checkResult( C, D );
+   }
+
+   {
+      test_ = "CompressedMatrix dense matrix assignment (same storage order)";
+
+      const blaze::DynamicMatrix<int,SO> D( random<SO>( m, n ) );
+      blaze::CompressedMatrix<int,SO> C( random<SO>( m, n ) );
+
+      C = D;
+
+      checkResult( C, D );
+   }
+
+   {
+      test_ = "CompressedMatrix dense matrix assignment (opposite storage order)";
+
+      const blaze::DynamicMatrix<int,!SO> D( random<!SO>( m, n ) );
+      blaze::CompressedMatrix<int,SO> C( 3UL, 5UL );
+
+      C = D;
+
+      checkResult( C, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel addition assignment to a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel addition assignment of dense matrices to a compressed matrix
+// that already contains non-zero elements. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SMPTest::testAddAssign()
+{
+   test_ = "CompressedMatrix dense matrix addition assignment";
+
+   const size_t m( 40UL );
+   const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD / m + 7UL );
+
+   blaze::DynamicMatrix<int,SO> D1( random<SO>( m, n ) );
+   const blaze::DynamicMatrix<int,SO> D2( random<SO>( m, n ) );
+   blaze::CompressedMatrix<int,SO> C( D1 );
+
+   C  += D2;
+   D1 += D2;
+
+   checkResult( C, D1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel subtraction assignment to a compressed matrix.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel subtraction assignment of dense matrices to a compressed
+// matrix that already contains non-zero elements, including the cancellation of elements. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SMPTest::testSubAssign()
+{
+   test_ = "CompressedMatrix dense matrix subtraction assignment";
+
+   const size_t m( 40UL );
+   const size_t n( blaze::SMP_DMATASSIGN_THRESHOLD / m + 7UL );
+
+   blaze::DynamicMatrix<int,SO> D1( random<SO>( m, n ) );
+   blaze::DynamicMatrix<int,SO> D2( random<SO>( m, n ) );
+   submatrix( D2, 0UL, 0UL, m/2UL, n ) = submatrix( D1, 0UL, 0UL, m/2UL, n );
+
+   blaze::CompressedMatrix<int,SO> C( D1 );
+
+   C  -= D2;
+   D1 -= D2;
+
+   checkResult( C, D1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of a sparse matrix multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of a sparse matrix/sparse matrix multiplication
+// to a compressed matrix. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SMPTest::testMultiplication()
+{
+   test_ = "CompressedMatrix sparse matrix multiplication assignment";
+
+   const size_t m( 40UL );
+   const size_t k( 23UL );
+   const size_t n( blaze::SMP_SMATSMATMULT_THRESHOLD / m + 7UL );
+
+   const blaze::DynamicMatrix<int,SO> D1( random<SO>( m, k ) );
+   const blaze::DynamicMatrix<int,SO> D2( random<SO>( k, n ) );
+   const blaze::CompressedMatrix<int,SO> A( D1 ), B( D2 );
+
+   blaze::CompressedMatrix<int,SO> C( m, n );
+
+   C = A * B;
+
+   const blaze::DynamicMatrix<int,SO> D3( D1 * D2 );
+
+   checkResult( C, D3 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the restructure() member function of the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the restructuring of the storage of a compressed matrix, both within the
+// current capacity and with a reallocation, and the subsequent concurrent appending of elements
+// to different rows/columns. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< bool SO >  // Storage order of the compressed matrix
+void SMPTest::testRestructure()
+{
+   test_ = "CompressedMatrix::restructure()";
+
+   blaze::CompressedMatrix<int,SO> C( random<SO>( SO ? 8UL : 6UL, SO ? 6UL : 8UL ) );
+
+   const std::vector< std::vector<size_t> > layouts{ { 3UL, 0UL, 2UL, 5UL, 1UL, 0UL },
+                                                     { 8UL, 8UL, 7UL, 8UL, 8UL, 8UL },
+                                                     { 0UL, 1UL, 0UL, 0UL, 0UL, 2UL } };
+
+   for( const std::vector<size_t>& capacities : layouts )
+   {
+      C.restructure( capacities.data() );
+
+      checkCapacities( C, capacities );
+
+      std::vector<std::thread> threads;
+
+      for( size_t i=0UL; i<capacities.size(); ++i ) {
+         threads.emplace_back( [&C,&capacities,i]() {
+            for( size_t j=0UL; j<capacities[i]; ++j ) {
+               C.append( SO ? j : i, SO ? i : j, int( 10UL*i + j + 1UL ) );
+            }
+         } );
+      }
+
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      blaze::DynamicMatrix<int,SO> D( C.rows(), C.columns(), 0 );
+
+      for( size_t i=0UL; i<capacities.size(); ++i ) {
+         for( size_t j=0UL; j<capacities[i]; ++j ) {
+            D( SO ? j : i, SO ? i : j ) = int( 10UL*i + j + 1UL );
+         }
+      }
+
+      checkResult( C, D );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a parallel assignment.
+//
+// \param result The compressed matrix resulting from the parallel assignment.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the values and the number of non-zero elements of the given compressed
+// matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename MT1    // Type of the compressed matrix
+        , typename MT2 >  // Type of the expected result
+void SMPTest::checkResult( const MT1& result, const MT2& expected ) const
+{
+   if( result != expected || result.nonZeros() != nonZeros( expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << result.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( expected ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the capacities of all rows/columns of a compressed matrix.
+//
+// \param matrix The compressed matrix to be checked.
+// \param capacities The expected capacities of all rows/columns.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename MT >  // Type of the compressed matrix
+void SMPTest::checkCapacities( const MT& matrix, const std::vector<size_t>& capacities ) const
+{
+   size_t total( 0UL );
+
+   for( size_t i=0UL; i<capacities.size(); ++i )
+   {
+      total += capacities[i];
+
+      if( matrix.capacity( i ) != capacities[i] || matrix.nonZeros( i ) != 0UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Row/column: " << i << "\n"
+             << "   Capacity: " << matrix.capacity( i ) << "\n"
+             << "   Expected capacity: " << capacities[i] << "\n"
+             << "   Number of non-zeros: " << matrix.nonZeros( i ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   if( matrix.capacity() < total || matrix.nonZeros() != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid total capacity detected\n"
+          << " Details:\n"
+          << "   Capacity: " << matrix.capacity() << "\n"
+          << "   Expected minimum capacity: " << total << "\n"
+          << "   Number of non-zeros: " << matrix.nonZeros() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random dense matrix with approximately one third non-zero elements.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return The random dense matrix.
+*/
+template< bool SO >  // Storage order of the matrix
+blaze::DynamicMatrix<int,SO> SMPTest::random( size_t m, size_t n )
+{
+   blaze::DynamicMatrix<int,SO> D( m, n, 0 );
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( blaze::rand<size_t>( 0UL, 2UL ) == 0UL )
+            D(i,j) = blaze::rand<int>( -9, 9 );
+      }
+   }
+
+   return D;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignments to the CompressedMatrix class template.
+//
+// \return void
+*/
+void runTest()
+{
+   SMPTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedMatrix SMP assignment test.
+*/
+#define RUN_COMPRESSEDMATRIX_SMP_TEST \
+   blazetest::mathtest::compressedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
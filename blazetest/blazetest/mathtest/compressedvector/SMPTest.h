@@ -0,0 +1,329 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/compressedvector/SMPTest.h
+//  \brief Header file for the CompressedVector SMP assignment test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_COMPRESSEDVECTOR_SMPTEST_H_
+#define _BLAZETEST_MATHTEST_COMPRESSEDVECTOR_SMPTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedvector {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP assignment tests of the CompressedVector class template.
+//
+// This class represents a test suite for the parallel (compound) assignments to a compressed
+// vector. All operands exceed the according SMP thresholds, such that the ranges of the target
+// are evaluated in parallel. All results are compared to the results of the according dense
+// vector operations.
+*/
+class SMPTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SMPTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool TF > void testAssign();
+   template< bool TF > void testAddAssign();
+   template< bool TF > void testSubAssign();
+                       void testMultiplication();
+
+   template< typename VT1, typename VT2 >
+   void checkResult( const VT1& result, const VT2& expected ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool TF >
+   static blaze::DynamicVector<int,TF> random( size_t n );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel assignment of dense vectors to a compressed vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel construction of a compressed vector from a dense vector and
+// the parallel assignment of a dense vector to a compressed vector. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool TF >  // Transpose flag of the compressed vector
+void SMPTest::testAssign()
+{
+   const size_t n( blaze::SMP_DVECASSIGN_THRESHOLD + 37UL );
+
+   {
+      test_ = "CompressedVector dense vector construction";
+
+      const blaze::DynamicVector<int,TF> d( random<TF>( n ) );
+      const blaze::CompressedVector<int,TF> c( d );
+
+      checkResult( c, d );
+   }
+
+   {
+      test_ = "CompressedVector dense vector assignment";
+
+      const blaze::DynamicVector<int,TF> d( random<TF>( n ) );
+      blaze::CompressedVector<int,TF> c( random<TF>( 7UL ) );
+
+      c = d;
+
+      checkResult( c, d );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel addition assignment to a compressed vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel addition assignment of a dense vector to a compressed vector
+// that already contains non-zero elements. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< bool TF >  // Transpose flag of the compressed vector
+void SMPTest::testAddAssign()
+{
+   test_ = "CompressedVector dense vector addition assignment";
+
+   const size_t n( blaze::SMP_DVECASSIGN_THRESHOLD + 37UL );
+
+   blaze::DynamicVector<int,TF> d1( random<TF>( n ) );
+   const blaze::DynamicVector<int,TF> d2( random<TF>( n ) );
+   blaze::CompressedVector<int,TF> c( d1 );
+
+   c  += d2;
+   d1 += d2;
+
+   checkResult( c, d1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel subtraction assignment to a compressed vector.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel subtraction assignment of a dense vector to a compressed
+// vector that already contains non-zero elements, including the cancellation of elements. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< bool TF >  // Transpose flag of the compressed vector
+void SMPTest::testSubAssign()
+{
+   test_ = "CompressedVector dense vector subtraction assignment";
+
+   const size_t n( blaze::SMP_DVECASSIGN_THRESHOLD + 37UL );
+
+   blaze::DynamicVector<int,TF> d1( random<TF>( n ) );
+   blaze::DynamicVector<int,TF> d2( random<TF>( n ) );
+   subvector( d2, 0UL, n/2UL ) = subvector( d1, 0UL, n/2UL );
+
+   blaze::CompressedVector<int,TF> c( d1 );
+
+   c  -= d2;
+   d1 -= d2;
+
+   checkResult( c, d1 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a parallel assignment.
+//
+// \param result The compressed vector resulting from the parallel assignment.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the values and the number of non-zero elements of the given compressed
+// vector. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename VT1    // Type of the compressed vector
+        , typename VT2 >  // Type of the expected result
+void SMPTest::checkResult( const VT1& result, const VT2& expected ) const
+{
+   if( result != expected || result.nonZeros() != nonZeros( expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result detected\n"
+          << " Details:\n"
+          << "   Number of non-zeros: " << result.nonZeros() << "\n"
+          << "   Expected number of non-zeros: " << nonZeros( expected ) << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random dense vector with approximately one third non-zero elements.
+//
+// \param n The size of the vector.
+// \return The random dense vector.
+*/
+template< bool TF >  // Transpose flag of the vector
+blaze::DynamicVector<int,TF> SMPTest::random( size_t n )
+{
+   blaze::DynamicVector<int,TF> d( n, 0 );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      if( blaze::rand<size_t>( 0UL, 2UL ) == 0UL )
+         d[i] = blaze::rand<int>( -9, 9 );
+   }
+
+   return d;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the SMP assignments to the CompressedVector class template.
+//
+// \return void
+*/
+void runTest()
+{
+   SMPTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the CompressedVector SMP assignment test.
+*/
+#define RUN_COMPRESSEDVECTOR_SMP_TEST \
+   blazetest::mathtest::compressedvector::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace compressedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
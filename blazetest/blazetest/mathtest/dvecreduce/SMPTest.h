@@ -0,0 +1,300 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/dvecreduce/SMPTest.h
+//  \brief Header file for the dense vector SMP reduction test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_DVECREDUCE_SMPTEST_H_
+#define _BLAZETEST_MATHTEST_DVECREDUCE_SMPTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cmath>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Functors.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/smp/SerialSection.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecreduce {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP tests of the dense vector reduction operations.
+//
+// This class represents a test suite for the parallel evaluation of the dense vector reduction
+// operations. All vectors exceed the SMP reduction threshold and every reduction is evaluated
+// repeatedly for one to four threads. For a fixed number of threads all results are required
+// to be bitwise identical and to match the result of the serial reduction.
+*/
+class SMPTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SMPTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   void testSum();
+   void testProd();
+   void testMinMax();
+   void testReduce();
+
+   template< typename T, typename OP >
+   void checkReduction( const blaze::DynamicVector<T>& vec, OP op );
+
+   template< typename T >
+   void checkResult( const T& result, const T& first, const T& reference,
+                     size_t threads, size_t run ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static blaze::DynamicVector<double> random( size_t n, int minExp, int maxExp );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Repeated parallel evaluation of a single reduction.
+//
+// \param vec The vector to be reduced.
+// \param op The reduction (a callable reducing the given vector).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function evaluates the given reduction repeatedly for one to four threads. The results
+// for a fixed number of threads have to be bitwise identical and have to match the result of
+// the serial reduction. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T     // Element type of the vector
+        , typename OP >  // Type of the reduction
+void SMPTest::checkReduction( const blaze::DynamicVector<T>& vec, OP op )
+{
+   T reference{};
+
+   BLAZE_SERIAL_SECTION
+   {
+      reference = op( vec );
+   }
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads );
+#endif
+
+      const T first( op( vec ) );
+
+      checkResult( first, first, reference, threads, 0UL );
+
+      for( size_t run=1UL; run<16UL; ++run ) {
+         checkResult( T( op( vec ) ), first, reference, threads, run );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a parallel reduction.
+//
+// \param result The result of the current evaluation.
+// \param first The result of the first evaluation with the same number of threads.
+// \param reference The result of the serial reduction.
+// \param threads The number of threads.
+// \param run The index of the current evaluation.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the result of the current evaluation is bitwise identical to the
+// result of the first evaluation and matches the result of the serial reduction. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Type of the result
+void SMPTest::checkResult( const T& result, const T& first, const T& reference,
+                           size_t threads, size_t run ) const
+{
+   if( result != first ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Non-deterministic result detected\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads << "\n"
+          << "   Evaluation: " << run << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Result of the first evaluation:\n" << first << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   if( !blaze::equal( result, reference ) ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid result detected\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << reference << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random vector with values of widely varying magnitude.
+//
+// \param n The size of the vector.
+// \param minExp The smallest decimal exponent of the values.
+// \param maxExp The largest decimal exponent of the values.
+// \return The random vector.
+//
+// This function creates a vector of positive random values in the range
+// \f$ [0.5 \cdot 10^{minExp} .. 1.5 \cdot 10^{maxExp}] \f$. Due to the varying magnitudes the
+// rounding errors of the reduction depend on the order of evaluation.
+*/
+inline blaze::DynamicVector<double> SMPTest::random( size_t n, int minExp, int maxExp )
+{
+   blaze::DynamicVector<double> vec( n );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      vec[i] = blaze::rand<double>( 0.5, 1.5 ) *
+               std::pow( 10.0, blaze::rand<int>( minExp, maxExp ) );
+   }
+
+   return vec;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel dense vector reduction operations.
+//
+// \return void
+*/
+void runTest()
+{
+   SMPTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the dense vector SMP reduction test.
+*/
+#define RUN_DVECREDUCE_SMP_TEST \
+   blazetest::mathtest::dvecreduce::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace dvecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
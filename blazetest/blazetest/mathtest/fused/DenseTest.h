@@ -0,0 +1,412 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/fused/DenseTest.h
+//  \brief Header file for the fused dense vector operation test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_FUSED_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_FUSED_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <typeinfo>
+#include <blaze/math/DenseVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/shims/Equal.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace fused {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all fused dense vector operation tests.
+//
+// This class represents a test suite for the fused evaluation of several dense vector statements
+// (see the fuse() function). All results are compared to the results of the according statements
+// evaluated one after another.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testRandom( size_t size );
+
+   void testAliasing();
+   void testExceptions();
+
+   template< typename VT1, typename VT2 >
+   void checkVectors( const VT1& result, const VT2& expected );
+
+   template< typename T1, typename T2 >
+   void checkScalars( const T1& result, const T2& expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the fused evaluation with random vectors.
+//
+// \param size The size of the vectors.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused evaluation of all kinds of statements with random vectors of
+// the given size. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the vectors
+void DenseTest::testRandom( size_t size )
+{
+   using VT = blaze::DynamicVector<Type,blaze::columnVector>;
+
+   VT x( size ), r( size ), d( size ), h( size );
+   randomize( x );
+   randomize( r );
+   randomize( d );
+   randomize( h );
+
+   const Type alpha( blaze::rand<Type>() );
+
+
+   //=====================================================================================
+   // Fused conjugate gradient update
+   //=====================================================================================
+
+   {
+      test_ = "Fused conjugate gradient update";
+
+      VT x1( x ), r1( r ), x2( x ), r2( r );
+
+      x1 += alpha * d;
+      r1 -= alpha * h;
+      const auto rr1( dot( r1, r1 ) );
+
+      const auto res( blaze::fuse( blaze::fusedAddAssign( x2, alpha * d ),
+                                   blaze::fusedSubAssign( r2, alpha * h ),
+                                   blaze::fusedDot( r2, r2 ) ) );
+
+      checkVectors( x2, x1 );
+      checkVectors( r2, r1 );
+      checkScalars( std::get<0>( res ), rr1 );
+   }
+
+
+   //=====================================================================================
+   // Fused assignments with aliased element-wise expressions
+   //=====================================================================================
+
+   {
+      test_ = "Fused assignments with aliased element-wise expressions";
+
+      VT x1( x ), d1( d ), x2( x ), d2( d );
+
+      d1 = r + alpha * d1;
+      x1 *= d1;
+      x1 = x1 - d1;
+      const auto sum1( sum( x1 ) );
+      const auto sqr1( sqrNorm( x1 + d1 ) );
+
+      const auto res( blaze::fuse( blaze::fusedAssign( d2, r + alpha * d2 ),
+                                   blaze::fusedMultAssign( x2, d2 ),
+                                   blaze::fusedAssign( x2, x2 - d2 ),
+                                   blaze::fusedSum( x2 ),
+                                   blaze::fusedSqrNorm( x2 + d2 ) ) );
+
+      checkVectors( x2, x1 );
+      checkVectors( d2, d1 );
+      checkScalars( std::get<0>( res ), sum1 );
+      checkScalars( std::get<1>( res ), sqr1 );
+   }
+
+
+   //=====================================================================================
+   // Fused reductions
+   //=====================================================================================
+
+   {
+      test_ = "Fused reductions";
+
+      const auto res( blaze::fuse( blaze::fusedDot( x, d ),
+                                   blaze::fusedDot( r + h, d ),
+                                   blaze::fusedSqrNorm( h ) ) );
+
+      checkScalars( std::get<0>( res ), dot( x, d ) );
+      checkScalars( std::get<1>( res ), dot( r + h, d ) );
+      checkScalars( std::get<2>( res ), sqrNorm( h ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the fused evaluation with expressions that require the complete operand.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the fused evaluation of statements containing matrix/vector products,
+// which refer to the target of another statement. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testAliasing()
+{
+   test_ = "Fused assignments with aliased matrix/vector products";
+
+   for( size_t size : { 1UL, 9UL, 100UL, 3000UL } )
+   {
+      blaze::DynamicMatrix<double> A( size, size );
+      blaze::DynamicVector<double> x( size ), y( size );
+      randomize( A );
+      randomize( x );
+      randomize( y );
+
+      blaze::DynamicVector<double> x1( x ), y1( y ), x2( x ), y2( y );
+
+      x1 += y1;
+      y1 = A * x1;
+      const double xy1( dot( x1, A * y1 ) );
+
+      const auto res( blaze::fuse( blaze::fusedAddAssign( x2, y2 ),
+                                   blaze::fusedAssign( y2, A * x2 ),
+                                   blaze::fusedDot( x2, A * y2 ) ) );
+
+      checkVectors( x2, x1 );
+      checkVectors( y2, y1 );
+      checkScalars( std::get<0>( res ), xy1 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the size checks of the fused evaluation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that statements with mismatching vector sizes are rejected. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+void DenseTest::testExceptions()
+{
+   blaze::DynamicVector<double> x( 10UL, 1.0 ), y( 11UL, 2.0 );
+
+   {
+      test_ = "Fused assignment with mismatching vector sizes";
+
+      try {
+         blaze::fuse( blaze::fusedAssign( x, y ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused assignment of vectors with mismatching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Fused statements with mismatching vector sizes";
+
+      try {
+         blaze::fuse( blaze::fusedAddAssign( x, x ), blaze::fusedSqrNorm( y ) );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Fused evaluation of statements with mismatching sizes succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+
+      if( x != 1.0 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Vector modified by failed fused evaluation\n"
+             << " Details:\n"
+             << "   Result:\n" << x << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result vector of a fused evaluation.
+//
+// \param result The result of the fused evaluation.
+// \param expected The result of the unfused evaluation.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename VT1    // Type of the result vector
+        , typename VT2 >  // Type of the expected vector
+void DenseTest::checkVectors( const VT1& result, const VT2& expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused evaluation failed\n"
+          << " Details:\n"
+          << "   Vector type:\n"
+          << "     " << typeid( VT1 ).name() << "\n"
+          << "   Size: " << result.size() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a fused reduction.
+//
+// \param result The result of the fused reduction.
+// \param expected The result of the unfused reduction.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+template< typename T1    // Type of the result
+        , typename T2 >  // Type of the expected result
+void DenseTest::checkScalars( const T1& result, const T2& expected )
+{
+   if( !blaze::equal( result, expected ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Fused reduction failed\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result: " << result << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the fused dense vector operations.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the fused dense vector operation test.
+*/
+#define RUN_FUSED_DENSE_TEST \
+   blazetest::mathtest::fused::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace fused
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
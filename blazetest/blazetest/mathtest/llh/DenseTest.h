@@ -45,6 +45,7 @@
 #include <string>
 #include <typeinfo>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/LowerMatrix.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/util/Complex.h>
@@ -92,6 +93,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testBlocked();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -100,6 +104,7 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testNative();
    //@}
    //**********************************************************************************************
 
@@ -176,6 +181,62 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition with a randomly initialized matrix of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native, blocked Cholesky decomposition kernel for a randomly
+// initialized positive definite matrix of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testBlocked()
+{
+   test_ = "Native LLH decomposition";
+
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t n( blaze::rand<size_t>( 20UL, 40UL ) );
+
+   Type B( n, n );
+   randomize( B );
+
+   Type A( B * ctrans( B ) );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += ET( n );
+   }
+
+   Type L( A );
+   blaze::nativePotrf( L );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=i+1UL; j<n; ++j ) {
+         blaze::reset( L(i,j) );
+      }
+   }
+
+   const Type LLH( L * ctrans( L ) );
+
+   if( LLH != A ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Native LLH decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Result:\n" << LLH << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
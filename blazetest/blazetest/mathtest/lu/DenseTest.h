@@ -44,7 +44,10 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/NativeDecomposition.h>
+#include <blaze/math/lapack/getrf.h>
 #include <blaze/math/typetraits/IsRowMajorMatrix.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
@@ -93,6 +96,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testBlocked();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -101,6 +107,7 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testNative();
    //@}
    //**********************************************************************************************
 
@@ -186,6 +193,56 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the native LU decomposition with a randomly initialized matrix of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the result of the native, blocked LU decomposition kernel for a randomly
+// initialized matrix of the given type with the result of the LAPACK kernel. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testBlocked()
+{
+#if BLAZETEST_MATHTEST_LAPACK_MODE
+
+   test_ = "Native LU decomposition";
+
+   const size_t m( blaze::rand<size_t>( 20UL, 40UL ) );
+   const size_t n( blaze::rand<size_t>( 20UL, 40UL ) );
+   const size_t k( blaze::min( m, n ) );
+
+   Type A( m, n );
+   randomize( A );
+
+   Type LU1( A ), LU2( A );
+   std::vector<int> ipiv1( k ), ipiv2( k );
+
+   blaze::nativeGetrf( LU1, ipiv1.data() );
+   blaze::getrf( LU2, ipiv2.data() );
+
+   if( LU1 != LU2 || ipiv1 != ipiv2 ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Native LU decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Result:\n" << LU1 << "\n"
+          << "   Expected result:\n" << LU2 << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+#endif
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
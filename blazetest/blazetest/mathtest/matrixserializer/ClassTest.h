@@ -46,7 +46,9 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/CompressedMatrix.h>
 #include <blaze/math/constraints/Matrix.h>
+#include <blaze/math/CustomMatrix.h>
 #include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/serialization/MappedArchive.h>
 #include <blaze/math/StaticMatrix.h>
 #include <blaze/math/Submatrix.h>
 #include <blaze/math/typetraits/IsDenseMatrix.h>
@@ -92,9 +94,11 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyMatrices ();
-   void testRandomMatrices();
-   void testFailures      ();
+   void testEmptyMatrices  ();
+   void testRandomMatrices ();
+   void testVersion1Archive();
+   void testMappedArchive  ();
+   void testFailures       ();
 
    template< size_t M, size_t N, typename MT >
    void runAllTests( const MT& src );
@@ -0,0 +1,626 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/packedmatrix/DenseTest.h
+//  \brief Header file for the packed matrix test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_PACKEDMATRIX_DENSETEST_H_
+#define _BLAZETEST_MATHTEST_PACKEDMATRIX_DENSETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/HermitianMatrix.h>
+#include <blaze/math/LowerMatrix.h>
+#include <blaze/math/Serialization.h>
+#include <blaze/math/SymmetricMatrix.h>
+#include <blaze/math/UpperMatrix.h>
+#include <blaze/math/dense/PackedMatrix.h>
+#include <blaze/math/typetraits/IsHermitian.h>
+#include <blaze/math/typetraits/IsLower.h>
+#include <blaze/math/typetraits/IsSymmetric.h>
+#include <blaze/math/typetraits/IsUpper.h>
+#include <blaze/util/Complex.h>
+#include <blaze/util/Random.h>
+#include <blaze/util/Unused.h>
+#include <blaze/util/serialization/Archive.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the packed storage of the matrix adaptors.
+//
+// This class represents a test suite for the SymmetricMatrix, HermitianMatrix, LowerMatrix, and
+// UpperMatrix adaptors with packed storage (see the PackedMatrix class template). All results
+// are compared to the results of the according adaptors with full storage.
+*/
+class DenseTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit DenseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename PT, typename FT >
+   void testMatrix( size_t n );
+
+   template< typename PT, typename FT >
+   void testElementAccess( const FT& full );
+
+   template< typename PT, typename FT >
+   void testMultiplication( const FT& full );
+
+   template< typename PT, typename FT >
+   void testSerialization( const FT& full );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename VT, bool TF >
+   void initialize( blaze::DenseVector<VT,TF>& vector );
+
+   template< typename MT, bool SO >
+   void initialize( blaze::DenseMatrix<MT,SO>& matrix );
+
+   inline void initialize( double& value, bool diagonal );
+   inline void initialize( blaze::complex<double>& value, bool diagonal );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;   //!< Label of the currently performed test.
+   std::string error_;  //!< Description of the current error type.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a packed matrix adaptor of size \f$ N \times N \f$.
+//
+// \param n The number of rows and columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random matrix with full storage of type \a FT and tests the
+// according packed matrix of type \a PT. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename PT    // Type of the packed matrix
+        , typename FT >  // Type of the matrix with full storage
+void DenseTest::testMatrix( size_t n )
+{
+   FT full( n );
+   initialize( full );
+
+   testElementAccess<PT>( full );
+   testMultiplication<PT>( full );
+   testSerialization<PT>( full );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access and of the memory requirements of a packed matrix.
+//
+// \param full The matrix with full storage.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction of a packed matrix from the given matrix with full
+// storage, the capacity of the packed matrix, and the access to its elements. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT    // Type of the packed matrix
+        , typename FT >  // Type of the matrix with full storage
+void DenseTest::testElementAccess( const FT& full )
+{
+   using ET = blaze::ElementType_t<PT>;
+
+   const size_t n( full.rows() );
+
+
+   //=====================================================================================
+   // Construction and capacity
+   //=====================================================================================
+
+   {
+      test_ = "Construction of a packed matrix";
+
+      PT packed( full );
+
+      checkResult( packed, full );
+
+      if( packed.capacity() != n*(n+1UL)/2UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid capacity detected\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( PT ).name() << "\n"
+             << "   Capacity: " << packed.capacity() << "\n"
+             << "   Expected capacity: " << n*(n+1UL)/2UL << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Access to the opposite triangle
+   //=====================================================================================
+
+   if( n > 1UL )
+   {
+      test_ = "Access to the opposite triangle of a packed matrix";
+
+      PT packed( full );
+      FT result( full );
+
+      ET value{};
+      initialize( value, false );
+
+      if( blaze::IsLower_v<PT> || blaze::IsUpper_v<PT> )
+      {
+         const size_t i( blaze::IsLower_v<PT> ? 0UL : n-1UL );
+         const size_t j( blaze::IsLower_v<PT> ? n-1UL : 0UL );
+
+         try {
+            packed(i,j) = ET( 1 );
+
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assignment to restricted element succeeded\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( PT ).name() << "\n"
+                << "   Result:\n" << packed << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+         catch( std::invalid_argument& ) {}
+
+         packed(j,i) = value;
+         result(j,i) = value;
+      }
+      else
+      {
+         packed(0UL,n-1UL) = value;
+         result(0UL,n-1UL) = value;
+      }
+
+      checkResult( packed, result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplication of a packed matrix with dense vectors and matrices.
+//
+// \param full The matrix with full storage.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the packed matrix/dense vector multiplication and the packed matrix/dense
+// matrix multiplication with both row-major and column-major operands. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT    // Type of the packed matrix
+        , typename FT >  // Type of the matrix with full storage
+void DenseTest::testMultiplication( const FT& full )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using ET = blaze::ElementType_t<PT>;
+
+   const size_t n( full.rows() );
+
+   const PT packed( full );
+
+   blaze::DynamicVector<ET> x( n );
+   blaze::DynamicMatrix<ET,rowMajor> A( n, 5UL );
+   blaze::DynamicMatrix<ET,columnMajor> B( n, 5UL );
+
+   initialize( x );
+   initialize( A );
+   initialize( B );
+
+
+   //=====================================================================================
+   // Packed matrix/dense vector multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Packed matrix/dense vector multiplication";
+
+      blaze::DynamicVector<ET> y1( n ), y2( n );
+
+      error_ = "Assignment";
+      y1 = packed * x;
+      y2 = full * x;
+      checkResult( y1, y2 );
+
+      error_ = "Addition assignment";
+      y1 += packed * x;
+      y2 += full * x;
+      checkResult( y1, y2 );
+
+      error_ = "Subtraction assignment";
+      y1 -= packed * x;
+      y2 -= full * x;
+      checkResult( y1, y2 );
+
+      error_ = "Assignment of a scaled product";
+      y1 = ET( 2 ) * ( packed * x );
+      y2 = ET( 2 ) * ( full * x );
+      checkResult( y1, y2 );
+
+      error_ = "Assignment to the right-hand side vector";
+      y1 = x;
+      y1 = packed * y1;
+      y2 = full * x;
+      checkResult( y1, y2 );
+   }
+
+
+   //=====================================================================================
+   // Packed matrix/dense matrix multiplication
+   //=====================================================================================
+
+   {
+      test_ = "Packed matrix/row-major dense matrix multiplication";
+
+      blaze::DynamicMatrix<ET,rowMajor> C1, C2;
+      blaze::DynamicMatrix<ET,columnMajor> D1, D2;
+
+      error_ = "Assignment to a row-major matrix";
+      C1 = packed * A;
+      C2 = full * A;
+      checkResult( C1, C2 );
+
+      error_ = "Assignment to a column-major matrix";
+      D1 = packed * A;
+      D2 = full * A;
+      checkResult( D1, D2 );
+
+      error_ = "Addition assignment";
+      C1 += packed * A;
+      C2 += full * A;
+      checkResult( C1, C2 );
+
+      error_ = "Subtraction assignment";
+      D1 -= packed * A;
+      D2 -= full * A;
+      checkResult( D1, D2 );
+   }
+
+   {
+      test_ = "Packed matrix/column-major dense matrix multiplication";
+
+      blaze::DynamicMatrix<ET,rowMajor> C1, C2;
+      blaze::DynamicMatrix<ET,columnMajor> D1, D2;
+
+      error_ = "Assignment to a row-major matrix";
+      C1 = packed * B;
+      C2 = full * B;
+      checkResult( C1, C2 );
+
+      error_ = "Assignment to a column-major matrix";
+      D1 = packed * B;
+      D2 = full * B;
+      checkResult( D1, D2 );
+
+      error_ = "Addition assignment";
+      D1 += packed * B;
+      D2 += full * B;
+      checkResult( D1, D2 );
+
+      error_ = "Subtraction assignment";
+      C1 -= packed * B;
+      C2 -= full * B;
+      checkResult( C1, C2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the (de-)serialization of a packed matrix.
+//
+// \param full The matrix with full storage.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function serializes a packed matrix and reconstitutes it as packed matrix, as dense
+// matrix, and as sparse matrix. Additionally, a matrix with full storage is reconstituted as
+// packed matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename PT    // Type of the packed matrix
+        , typename FT >  // Type of the matrix with full storage
+void DenseTest::testSerialization( const FT& full )
+{
+   using blaze::columnMajor;
+
+   using ET = blaze::ElementType_t<PT>;
+
+   const PT packed( full );
+
+   {
+      test_ = "Serialization of a packed matrix";
+
+      blaze::Archive<std::stringstream> archive;
+      archive << packed << packed << packed;
+
+      PT packed2;
+      blaze::DynamicMatrix<ET,columnMajor> dense;
+      blaze::CompressedMatrix<ET> sparse;
+
+      archive >> packed2 >> dense >> sparse;
+
+      error_ = "Reconstitution as packed matrix";
+      checkResult( packed2, full );
+
+      error_ = "Reconstitution as dense matrix";
+      checkResult( dense, full );
+
+      error_ = "Reconstitution as sparse matrix";
+      checkResult( sparse, full );
+   }
+
+   {
+      test_ = "Deserialization of a matrix with full storage";
+
+      blaze::Archive<std::stringstream> archive;
+      archive << full;
+
+      PT packed2;
+      archive >> packed2;
+
+      error_ = "Reconstitution as packed matrix";
+      checkResult( packed2, full );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a packed matrix operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void DenseTest::checkResult( const T1& result, const T2& expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error_ << "\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector with random integral values.
+//
+// \param vector The dense vector to be initialized.
+// \return void
+//
+// This function initializes the given vector with random values without fractional part, which
+// guarantees that all products are computed exactly.
+*/
+template< typename VT  // Type of the dense vector
+        , bool TF >    // Transpose flag
+void DenseTest::initialize( blaze::DenseVector<VT,TF>& vector )
+{
+   for( size_t i=0UL; i<(~vector).size(); ++i ) {
+      initialize( (~vector)[i], false );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with random integral values.
+//
+// \param matrix The dense matrix to be initialized.
+// \return void
+//
+// This function initializes the given matrix with random values without fractional part, which
+// guarantees that all products are computed exactly. Symmetric, Hermitian, and lower matrices
+// are initialized via their lower part, upper matrices via their upper part.
+*/
+template< typename MT  // Type of the dense matrix
+        , bool SO >    // Storage order
+void DenseTest::initialize( blaze::DenseMatrix<MT,SO>& matrix )
+{
+   using blaze::IsUpper_v;
+
+   const bool restricted( blaze::IsSymmetric_v<MT> || blaze::IsHermitian_v<MT> ||
+                          blaze::IsLower_v<MT> || IsUpper_v<MT> );
+
+   for( size_t i=0UL; i<(~matrix).rows(); ++i ) {
+      for( size_t j=0UL; j<(~matrix).columns(); ++j )
+      {
+         if( restricted && ( IsUpper_v<MT> ? ( i > j ) : ( j > i ) ) )
+            continue;
+
+         blaze::ElementType_t<MT> value{};
+         initialize( value, i == j && blaze::IsHermitian_v<MT> );
+         (~matrix)(i,j) = value;
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given value with a random integral value.
+//
+// \param value The value to be initialized.
+// \param diagonal \a true in case the value is a diagonal element of a Hermitian matrix.
+// \return void
+*/
+inline void DenseTest::initialize( double& value, bool diagonal )
+{
+   blaze::UNUSED_PARAMETER( diagonal );
+
+   value = blaze::rand<int>( -9, 9 );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given value with a random integral value.
+//
+// \param value The value to be initialized.
+// \param diagonal \a true in case the value is a diagonal element of a Hermitian matrix.
+// \return void
+*/
+inline void DenseTest::initialize( blaze::complex<double>& value, bool diagonal )
+{
+   value = blaze::complex<double>( blaze::rand<int>( -9, 9 ), diagonal ? 0 : blaze::rand<int>( -9, 9 ) );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the packed storage of the matrix adaptors.
+//
+// \return void
+*/
+void runTest()
+{
+   DenseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the packed matrix test.
+*/
+#define RUN_PACKEDMATRIX_DENSE_TEST \
+   blazetest::mathtest::packedmatrix::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
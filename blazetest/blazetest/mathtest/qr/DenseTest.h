@@ -44,7 +44,9 @@
 #include <stdexcept>
 #include <string>
 #include <typeinfo>
+#include <vector>
 #include <blaze/math/Aliases.h>
+#include <blaze/math/dense/NativeDecomposition.h>
 #include <blaze/math/typetraits/IsSquare.h>
 #include <blaze/math/typetraits/RemoveAdaptor.h>
 #include <blaze/util/Complex.h>
@@ -92,6 +94,9 @@ class DenseTest
    template< typename Type >
    void testRandom();
 
+   template< typename Type >
+   void testBlocked();
+
    void testGeneral();
    void testSymmetric();
    void testHermitian();
@@ -100,6 +105,7 @@ class DenseTest
    void testUpper();
    void testUniUpper();
    void testDiagonal();
+   void testNative();
    //@}
    //**********************************************************************************************
 
@@ -178,6 +184,63 @@ void DenseTest::testRandom()
 
 
 
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition with a randomly initialized matrix of the given type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native, blocked QR decomposition and Q reconstruction kernels for a
+// randomly initialized matrix of the given type. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename Type >
+void DenseTest::testBlocked()
+{
+   test_ = "Native QR decomposition";
+
+   using ET = blaze::ElementType_t<Type>;
+
+   const size_t m( blaze::rand<size_t>( 20UL, 40UL ) );
+   const size_t n( blaze::rand<size_t>( 20UL, m ) );
+
+   Type A( m, n );
+   randomize( A );
+
+   Type Q( A );
+   std::vector<ET> tau( n );
+
+   blaze::nativeGeqrf( Q, tau.data() );
+
+   Type R( n, n, ET(0) );
+   for( size_t i=0UL; i<n; ++i ) {
+      for( size_t j=i; j<n; ++j ) {
+         R(i,j) = Q(i,j);
+      }
+   }
+
+   blaze::nativeUngqr( Q, tau.data() );
+
+   const Type QR( Q*R );
+
+   if( QR != A || !blaze::isIdentity( ctrans( Q ) * Q ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Native QR decomposition failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( Type ).name() << "\n"
+          << "   Element type:\n"
+          << "     " << typeid( blaze::ElementType_t<Type> ).name() << "\n"
+          << "   Result:\n" << QR << "\n"
+          << "   Expected result:\n" << A << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
@@ -41,6 +41,10 @@
 //*************************************************************************************************
 
 #include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -106,6 +110,7 @@
 #include <blaze/math/typetraits/HasSIMDExp2.h>
 #include <blaze/math/typetraits/HasSIMDExp10.h>
 #include <blaze/math/typetraits/HasSIMDFloor.h>
+#include <blaze/math/typetraits/HasSIMDGather.h>
 #include <blaze/math/typetraits/HasSIMDHypot.h>
 #include <blaze/math/typetraits/HasSIMDInvCbrt.h>
 #include <blaze/math/typetraits/HasSIMDInvSqrt.h>
@@ -129,11 +134,14 @@
 #include <blaze/util/algorithms/Min.h>
 #include <blaze/util/constraints/Numeric.h>
 #include <blaze/util/FalseType.h>
+#include <blaze/util/IntegralConstant.h>
 #include <blaze/util/Memory.h>
 #include <blaze/util/NonCopyable.h>
 #include <blaze/util/policies/Deallocate.h>
 #include <blaze/util/Random.h>
+#include <blaze/util/StaticAssert.h>
 #include <blaze/util/TrueType.h>
+#include <blaze/util/typetraits/IsFloatingPoint.h>
 
 
 namespace blazetest {
@@ -192,6 +200,8 @@ class OperationTest : private blaze::NonCopyable
    void testStorea        ();
    void testStream        ();
    void testStoreu        ( size_t offset );
+   void testLoadm         ();
+   void testStorem        ();
 
    void testEquality      ( blaze::TrueType , blaze::TrueType  );
    void testEquality      ( blaze::TrueType , blaze::FalseType );
@@ -304,6 +314,18 @@ class OperationTest : private blaze::NonCopyable
    void testErfc          ( blaze::TrueType  );
    void testErfc          ( blaze::FalseType );
 
+   void testAccuracy      ( blaze::TrueType  );
+   void testAccuracy      ( blaze::FalseType );
+
+   template< typename OP, typename REF >
+   void checkAccuracy( OP op, REF ref, T min, T max,
+                       std::initializer_list<T> specials, size_t ulps );
+
+   void testGather        ( blaze::TrueType  );
+   void testGather        ( blaze::FalseType );
+   void testScatter       ( blaze::TrueType  );
+   void testScatter       ( blaze::FalseType );
+
    void testSum           ();
    void testProd          ();
    //@}
@@ -313,6 +335,7 @@ class OperationTest : private blaze::NonCopyable
    /*!\name Error detection functions */
    //@{
    void compare( const T* expected, const T* actual ) const;
+   void compare( const T* expected, const T* actual, size_t ulps ) const;
    //@}
    //**********************************************************************************************
 
@@ -375,6 +398,9 @@ OperationTest<T>::OperationTest()
       testStoreu( offset );
    }
 
+   testLoadm();
+   testStorem();
+
    testEquality      ( blaze::HasSIMDEqual<T,T>(), blaze::IsFloatingPoint<T>() );
    testInequality    ( blaze::HasSIMDEqual<T,T>(), blaze::IsFloatingPoint<T>() );
 
@@ -434,6 +460,13 @@ OperationTest<T>::OperationTest()
    testErf           ( blaze::HasSIMDErf < T >() );
    testErfc          ( blaze::HasSIMDErfc< T >() );
 
+   testAccuracy      ( blaze::BoolConstant< bool( BLAZE_SIMD_MATH_MODE ) &&
+                                            !bool( BLAZE_SVML_MODE ) &&
+                                            blaze::IsFloatingPoint_v<T> >() );
+
+   testGather        ( blaze::HasSIMDGather< T >() );
+   testScatter       ( blaze::HasSIMDGather< T >() );
+
    testSum           ();
    testProd          ();
 }
@@ -556,6 +589,75 @@ void OperationTest<T>::testStoreu( size_t offset )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the masked load operation.
+//
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked load operation by loading all possible numbers of elements
+// \f$[0..SIMDSIZE]\f$ via masked loads and by comparing the results with a scalar copy, where
+// all unselected elements are expected to be zero. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testLoadm()
+{
+   using blaze::loadm;
+   using blaze::storea;
+
+   test_  = "loadm() operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      const size_t n( ( i/SIMDSIZE ) % ( SIMDSIZE+1UL ) );
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         c_[i+j] = ( j < n )?( a_[i+j] ):( T() );
+      }
+      storea( d_+i, loadm( a_+i, n ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the masked store operation.
+//
+// \return void
+// \exception std::runtime_error Load/store error detected.
+//
+// This function tests the masked store operation by storing all possible numbers of elements
+// \f$[0..SIMDSIZE]\f$ via masked stores and by comparing the results with a scalar copy, where
+// all unselected elements are expected to remain unchanged. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testStorem()
+{
+   using blaze::loada;
+   using blaze::storem;
+
+   test_  = "storem() operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      const size_t n( ( i/SIMDSIZE ) % ( SIMDSIZE+1UL ) );
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         c_[i+j] = ( j < n )?( a_[i+j] ):( b_[i+j] );
+         d_[i+j] = b_[i+j];
+      }
+      storem( d_+i, n, loada( a_+i ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the equality comparison.
 //
@@ -3060,6 +3162,342 @@ void OperationTest<T>::testErfc( blaze::FalseType )
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Testing the accuracy of the vectorized elementary functions.
+//
+// \return void
+// \exception std::runtime_error Accuracy violation detected.
+//
+// This function tests the accuracy of the Blaze-native SIMD kernels for the elementary functions
+// by comparing their results to the results of the according functions of the standard library.
+// Each test covers random arguments as well as NaN, positive and negative infinity, signed
+// zeros, arguments resulting in overflow and underflow, and arguments outside the domain of the
+// function. Non-finite results have to match exactly, all other results have to be within the
+// given number of ulps. In case any error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testAccuracy( blaze::TrueType )
+{
+   using blaze::loada;
+   using blaze::storea;
+
+   constexpr bool dp( sizeof( T ) == sizeof( double ) );
+
+   const T inf ( std::numeric_limits<T>::infinity() );
+   const T nan ( std::numeric_limits<T>::quiet_NaN() );
+   const T tiny( std::numeric_limits<T>::denorm_min() );
+   const T huge( std::numeric_limits<T>::max() );
+   const T eps ( std::numeric_limits<T>::epsilon() );
+
+   test_ = "Accuracy of the exp() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::exp( x ); },
+                  []( T x ) { return std::exp( x ); },
+                  T( dp ? -700 : -85 ), T( dp ? 700 : 85 ),
+                  { T(0), -T(0), T(1), inf, -inf, nan, T(1000), T(-1000),
+                    T( dp ? 709.7 : 88.7 ), T( dp ? 710 : 89 ), T( dp ? -740 : -100 ),
+                    T( dp ? -745 : -103 ), tiny, -tiny },
+                  2UL );
+
+   test_ = "Accuracy of the exp2() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::exp2( x ); },
+                  []( T x ) { return std::exp2( x ); },
+                  T( dp ? -1000 : -125 ), T( dp ? 1000 : 125 ),
+                  { T(0), -T(0), T(1), T(-1), inf, -inf, nan, T(2000), T(-2000),
+                    T( dp ? 1024 : 128 ), T( dp ? -1060 : -140 ), T( dp ? -1074 : -149 ) },
+                  2UL );
+
+   test_ = "Accuracy of the exp10() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::exp10( x ); },
+                  []( T x ) { return std::pow( T(10), x ); },
+                  T( dp ? -300 : -37 ), T( dp ? 300 : 37 ),
+                  { T(0), -T(0), T(1), T(2), inf, -inf, nan, T(400), T(-400),
+                    T( dp ? 309 : 39 ), T( dp ? -310 : -40 ) },
+                  3UL );
+
+   test_ = "Accuracy of the log() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::log( x ); },
+                  []( T x ) { return std::log( x ); },
+                  T(0), T(1000),
+                  { T(0), -T(0), T(1), T(-1), -tiny, -huge, inf, -inf, nan,
+                    tiny, std::numeric_limits<T>::min(), huge, T(1)+eps, T(1)-eps },
+                  2UL );
+
+   test_ = "Accuracy of the log2() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::log2( x ); },
+                  []( T x ) { return std::log2( x ); },
+                  T(0), T(1000),
+                  { T(0), -T(0), T(1), T(2), T(-1), -huge, inf, -inf, nan, tiny, huge },
+                  3UL );
+
+   test_ = "Accuracy of the log10() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::log10( x ); },
+                  []( T x ) { return std::log10( x ); },
+                  T(0), T(1000),
+                  { T(0), -T(0), T(1), T(10), T(-1), -huge, inf, -inf, nan, tiny, huge },
+                  3UL );
+
+   test_ = "Accuracy of the sin() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::sin( x ); },
+                  []( T x ) { return std::sin( x ); },
+                  T(-1000), T(1000),
+                  { T(0), -T(0), tiny, inf, -inf, nan, T(1E6), T(2E6), T(-1E7), huge },
+                  2UL );
+
+   test_ = "Accuracy of the cos() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::cos( x ); },
+                  []( T x ) { return std::cos( x ); },
+                  T(-1000), T(1000),
+                  { T(0), -T(0), tiny, inf, -inf, nan, T(1E6), T(2E6), T(-1E7), huge },
+                  2UL );
+
+   test_ = "Accuracy of the tanh() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::tanh( x ); },
+                  []( T x ) { return std::tanh( x ); },
+                  T(-20), T(20),
+                  { T(0), -T(0), tiny, -tiny, T(1E-5), T(-1E-5), inf, -inf, nan, T(1000) },
+                  2UL );
+
+   test_ = "Accuracy of the erf() operation";
+   checkAccuracy( []( const SIMDType& x ) { return blaze::erf( x ); },
+                  []( T x ) { return std::erf( x ); },
+                  T(-6), T(6),
+                  { T(0), -T(0), tiny, -tiny, T(1E-5), inf, -inf, nan, T(10), T(-10) },
+                  2UL );
+
+   test_ = "Accuracy of the pow() operation";
+
+   const T specials[][2] = {
+      { T(0), T(-1) }, { -T(0), T(-1) }, { -T(0), T(-2) }, { T(0), T(3) }, { -T(0), T(3) },
+      { T(-2), T(3) }, { T(-2), T(-2) }, { T(-2), T(0.5) }, { T(-1), inf }, { T(-1), -inf },
+      { T(0.5), inf }, { T(0.5), -inf }, { T(2), inf }, { T(2), -inf }, { inf, T(-1) },
+      { inf, T(2) }, { -inf, T(3) }, { -inf, T(-3) }, { -inf, T(2) }, { T(1), nan },
+      { nan, T(0) }, { nan, T(1) }, { T(2), nan }, { T(2), T( dp ? 1024 : 128 ) },
+      { T(2), T( dp ? -1080 : -160 ) }, { T(10), T( dp ? -310 : -40 ) }, { huge, T(2) },
+      { tiny, T(0.5) }, { T(-8), T(1)/T(3) }
+   };
+
+   initialize( T(0), T(10) );
+
+   for( size_t i=0UL; i<N; ++i ) {
+      b_[i] = T( blaze::rand<int>( -200, 200 ) ) / T(10);
+   }
+
+   for( size_t k=0UL; k<sizeof( specials ) / sizeof( specials[0] ); ++k ) {
+      a_[3UL*k] = specials[k][0];
+      b_[3UL*k] = specials[k][1];
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = std::pow( a_[i], b_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, blaze::pow( loada( a_+i ), loada( b_+i ) ) );
+   }
+
+   compare( c_, d_, 2UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the accuracy test of the vectorized elementary functions.
+//
+// \return void
+//
+// This function is called in case the Blaze-native SIMD kernels for the elementary functions
+// are not used for the given data type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testAccuracy( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the accuracy of a single vectorized elementary function.
+//
+// \param op The vectorized elementary function.
+// \param ref The reference implementation of the standard library.
+// \param min The smallest random argument.
+// \param max The largest random argument.
+// \param specials The special arguments to be tested in addition to the random arguments.
+// \param ulps The maximum permitted error in ulps.
+// \return void
+// \exception std::runtime_error Accuracy violation detected.
+//
+// This function evaluates the given vectorized function for random arguments in the range
+// \f$ [min,max] \f$ and the given special arguments, which are interspersed among the random
+// arguments. In case any result differs by more than \a ulps from the reference result, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+template< typename OP     // Type of the vectorized function
+        , typename REF >  // Type of the reference function
+void OperationTest<T>::checkAccuracy( OP op, REF ref, T min, T max,
+                                      std::initializer_list<T> specials, size_t ulps )
+{
+   using blaze::loada;
+   using blaze::storea;
+
+   initialize( min, max );
+
+   size_t k( 0UL );
+   for( const T& special : specials ) {
+      a_[3UL*k] = special;
+      ++k;
+   }
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = ref( a_[i] );
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, op( loada( a_+i ) ) );
+   }
+
+   compare( c_, d_, ulps );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the gather operation.
+//
+// \return void
+// \exception std::runtime_error Error in gather operation detected.
+//
+// This function tests the index-based and the strided gather operation by comparing the results
+// of a vectorized and a scalar gather operation. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testGather( blaze::TrueType )
+{
+   using blaze::gather;
+   using blaze::storea;
+
+   constexpr size_t stride( N / SIMDSIZE );
+
+   size_t indices[N];
+   for( size_t i=0UL; i<N; ++i ) {
+      indices[i] = ( i*7UL ) % N;
+   }
+
+   test_ = "Gather operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[i] = a_[indices[i]];
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      storea( d_+i, gather( a_, indices+i ) );
+   }
+
+   compare( c_, d_ );
+
+   test_ = "Strided gather operation";
+
+   for( size_t k=0UL; k<stride; ++k ) {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         c_[k*SIMDSIZE+j] = a_[k+j*stride];
+      }
+   }
+
+   for( size_t k=0UL; k<stride; ++k ) {
+      storea( d_+k*SIMDSIZE, gather( a_+k, stride ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the gather operation.
+//
+// \return void
+//
+// This function is called in case the gather operation is not available for the given data
+// type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testGather( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Testing the scatter operation.
+//
+// \return void
+// \exception std::runtime_error Error in scatter operation detected.
+//
+// This function tests the index-based and the strided scatter operation by comparing the results
+// of a vectorized and a scalar scatter operation. In case any error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testScatter( blaze::TrueType )
+{
+   using blaze::loada;
+   using blaze::scatter;
+
+   constexpr size_t stride( N / SIMDSIZE );
+
+   size_t indices[N];
+   for( size_t i=0UL; i<N; ++i ) {
+      indices[i] = ( i*7UL ) % N;
+   }
+
+   test_ = "Scatter operation";
+
+   initialize();
+
+   for( size_t i=0UL; i<N; ++i ) {
+      c_[indices[i]] = a_[i];
+   }
+
+   for( size_t i=0UL; i<N; i+=SIMDSIZE ) {
+      scatter( d_, indices+i, loada( a_+i ) );
+   }
+
+   compare( c_, d_ );
+
+   test_ = "Strided scatter operation";
+
+   for( size_t k=0UL; k<stride; ++k ) {
+      for( size_t j=0UL; j<SIMDSIZE; ++j ) {
+         c_[k+j*stride] = a_[k*SIMDSIZE+j];
+      }
+   }
+
+   for( size_t k=0UL; k<stride; ++k ) {
+      scatter( d_+k, stride, loada( a_+k*SIMDSIZE ) );
+   }
+
+   compare( c_, d_ );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Skipping the test of the scatter operation.
+//
+// \return void
+//
+// This function is called in case the scatter operation is not available for the given data
+// type \a T.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::testScatter( blaze::FalseType )
+{}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Testing the addition reduction operation (\c sum).
 //
@@ -3194,6 +3632,62 @@ void OperationTest<T>::compare( const T* expected, const T* actual ) const
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Comparison of the first 256 elements of the two given arrays with an ulp tolerance.
+//
+// \param expected The array of expected values.
+// \param actual The array of actual values.
+// \param ulps The maximum permitted distance in units in the last place (ulps).
+// \return void
+// \exception std::runtime_error Value mismatch detected.
+//
+// This function compares the first 256 elements of the two given floating point arrays. NaN
+// and infinite values have to match exactly, whereas finite values may differ by at most
+// \a ulps units in the last place. In case any value exceeds this tolerance, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename T >  // Data type of the SIMD test
+void OperationTest<T>::compare( const T* expected, const T* actual, size_t ulps ) const
+{
+   using Bits = std::conditional_t< sizeof( T ) == sizeof( int32_t ), int32_t, int64_t >;
+
+   BLAZE_STATIC_ASSERT( sizeof( T ) == sizeof( Bits ) );
+
+   for( size_t i=0UL; i<N; ++i )
+   {
+      Bits e, a;
+      std::memcpy( &e, expected+i, sizeof( T ) );
+      std::memcpy( &a, actual+i, sizeof( T ) );
+
+      // Mapping the bit patterns to a monotonic integer sequence
+      if( e < 0 ) e = std::numeric_limits<Bits>::min() - e;
+      if( a < 0 ) a = std::numeric_limits<Bits>::min() - a;
+
+      const uint64_t distance( ( e > a )?( uint64_t( e ) - uint64_t( a ) )
+                                        :( uint64_t( a ) - uint64_t( e ) ) );
+
+      const bool valid( ( std::isnan( expected[i] ) || std::isnan( actual[i] ) )
+                        ?( std::isnan( expected[i] ) && std::isnan( actual[i] ) )
+                        :( ( std::isinf( expected[i] ) || std::isinf( actual[i] ) )
+                           ?( expected[i] == actual[i] )
+                           :( distance <= ulps ) ) );
+
+      if( !valid ) {
+         std::ostringstream oss;
+         oss.precision( 20 );
+         oss << " Test : " << test_ << "\n"
+             << " Error: Value mismatch detected at index " << i << "\n"
+             << " Details:\n"
+             << "   expected[" << i << "] = " << expected[i] << "\n"
+             << "   actual  [" << i << "] = " << actual[i] << "\n"
+             << "   Distance: " << distance << " ulps (tolerance " << ulps << " ulps)\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 
 
 //=================================================================================================
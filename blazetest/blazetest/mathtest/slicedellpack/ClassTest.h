@@ -0,0 +1,629 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/slicedellpack/ClassTest.h
+//  \brief Header file for the sliced ELLPACK matrix test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+#ifndef _BLAZETEST_MATHTEST_SLICEDELLPACK_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SLICEDELLPACK_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SlicedEllpackMatrix.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace slicedellpack {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the sliced ELLPACK matrix.
+//
+// This class represents a test suite for the SlicedEllpackMatrix class template. All results
+// are compared to the results of the according CompressedMatrix operations.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename ST, typename VT >
+   void testMatrix( size_t m, size_t n );
+
+   template< typename ST, typename RT >
+   void testConstruction( const RT& ref, size_t sigma );
+
+   template< typename ST, typename RT >
+   void testAccess( const RT& ref, size_t sigma );
+
+   template< typename ST, typename VT, typename RT >
+   void testOperations( const RT& ref, size_t sigma );
+
+   void testInvalidSigma();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected );
+
+   template< typename Type >
+   void checkIntact( const Type& object );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void initialize( blaze::CompressedMatrix<MT,SO>& matrix );
+
+   template< typename MT, bool SO >
+   void initialize( blaze::DynamicMatrix<MT,SO>& matrix );
+
+   template< typename VT, bool TF >
+   void initialize( blaze::DynamicVector<VT,TF>& vector );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;   //!< Label of the currently performed test.
+   std::string error_;  //!< Description of the current error type.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a sliced ELLPACK matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random reference matrix and tests the according sliced ELLPACK
+// matrix of type \a ST for several sorting scopes. The dense vector and matrix operands of the
+// products are of element type \a VT. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename ST    // Type of the sliced ELLPACK matrix
+        , typename VT >  // Element type of the dense operands
+void ClassTest::testMatrix( size_t m, size_t n )
+{
+   using RT = blaze::CompressedMatrix< blaze::ElementType_t<ST>, blaze::rowMajor >;
+
+   constexpr size_t C( ST::chunkSize );
+
+   RT ref( m, n );
+   initialize( ref );
+
+   for( size_t sigma : { 1UL, C, 4UL*C, ST::defaultSigma, 100000UL } ) {
+      testConstruction<ST>( ref, sigma );
+      testAccess<ST>( ref, sigma );
+      testOperations<ST,VT>( ref, sigma );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction of a sliced ELLPACK matrix.
+//
+// \param ref The reference matrix.
+// \param sigma The sorting scope of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion from sparse and dense matrices and the copy and move
+// operations. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the sliced ELLPACK matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testConstruction( const RT& ref, size_t sigma )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using ET = blaze::ElementType_t<RT>;
+
+   {
+      test_  = "Conversion from a compressed matrix";
+      error_ = "Conversion failed";
+
+      ST mat( ref, sigma );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      if( mat.sigma() != sigma || mat.nonZeros() != ref.nonZeros() ||
+          mat.chunks() != ( ref.rows() + ST::chunkSize - 1UL ) / ST::chunkSize ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid matrix properties\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( ST ).name() << "\n"
+             << "   Sorting scope: " << mat.sigma() << " (expected " << sigma << ")\n"
+             << "   Number of non-zeros: " << mat.nonZeros() << " (expected " << ref.nonZeros() << ")\n"
+             << "   Number of chunks: " << mat.chunks() << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_  = "Conversion from a dense matrix";
+      error_ = "Conversion failed";
+
+      const blaze::DynamicMatrix<ET,columnMajor> dense( ref );
+      ST mat( dense, sigma );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion from a matrix expression";
+      error_ = "Conversion failed";
+
+      const blaze::CompressedMatrix<ET,columnMajor> opposite( ref );
+      ST mat( opposite + ref, sigma );
+
+      checkResult( mat, ref + ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion to a compressed matrix";
+      error_ = "Conversion failed";
+
+      const ST mat( ref, sigma );
+      const blaze::CompressedMatrix<ET,rowMajor> res( mat );
+
+      checkResult( res, ref );
+   }
+
+   {
+      test_  = "Copy and move operations";
+      error_ = "Copy or move failed";
+
+      const ST mat1( ref, sigma );
+      ST mat2( mat1 );
+      ST mat3( std::move( mat2 ) );
+      ST mat4;
+      mat4 = mat3;
+      ST mat5;
+      mat5 = std::move( mat4 );
+      ST mat6( ref, sigma );
+      mat6 = ref + ref;
+
+      checkResult( mat3, ref );
+      checkResult( mat5, ref );
+      checkResult( mat6, ref + ref );
+      checkIntact( mat5 );
+      checkIntact( mat6 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the element access functions of a sliced ELLPACK matrix.
+//
+// \param ref The reference matrix.
+// \param sigma The sorting scope of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the iteration over the rows and the lookup functions of the sliced
+// ELLPACK matrix. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the sliced ELLPACK matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testAccess( const RT& ref, size_t sigma )
+{
+   test_ = "Iteration and lookup";
+
+   const ST mat( ref, sigma );
+
+   for( size_t i=0UL; i<ref.rows(); ++i )
+   {
+      bool valid( mat.nonZeros( i ) == ref.nonZeros( i ) &&
+                  size_t( mat.end( i ) - mat.begin( i ) ) == ref.nonZeros( i ) &&
+                  mat.nonZeros( i ) <= mat.capacity( i ) );
+
+      auto element( mat.cbegin( i ) );
+      for( auto it=ref.begin( i ); valid && it!=ref.end( i ); ++it, ++element ) {
+         valid = ( element->index() == it->index() && element->value() == it->value() );
+      }
+      valid = valid && ( element == mat.cend( i ) );
+
+      for( size_t j=0UL; valid && j<ref.columns(); ++j )
+      {
+         const auto pos  ( mat.find( i, j ) );
+         const auto lower( mat.lowerBound( i, j ) );
+         const auto upper( mat.upperBound( i, j ) );
+
+         valid = ( ( pos == mat.end( i ) ) == ( ref.find( i, j ) == ref.end( i ) ) ) &&
+                 ( pos == mat.end( i ) || pos->value() == ref(i,j) ) &&
+                 ( lower - mat.begin( i ) == ref.lowerBound( i, j ) - ref.begin( i ) ) &&
+                 ( upper - mat.begin( i ) == ref.upperBound( i, j ) - ref.begin( i ) );
+      }
+
+      if( !valid ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid access to row " << i << "\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( ST ).name() << "\n"
+             << "   Sorting scope: " << sigma << "\n"
+             << "   Reference:\n" << ref << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the multiplications with a sliced ELLPACK matrix.
+//
+// \param ref The reference matrix.
+// \param sigma The sorting scope of the sliced ELLPACK matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the sparse matrix/dense vector and sparse matrix/dense matrix products
+// with row-major and column-major dense matrices, including the according addition and
+// subtraction assignments. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+template< typename ST    // Type of the sliced ELLPACK matrix
+        , typename VT    // Element type of the dense operands
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testOperations( const RT& ref, size_t sigma )
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   const size_t m( ref.rows() );
+   const size_t n( ref.columns() );
+
+   const ST mat( ref, sigma );
+
+   blaze::DynamicVector<VT,columnVector> x( n ), y( m );
+   initialize( x );
+   initialize( y );
+
+   blaze::DynamicMatrix<VT,columnMajor> B( n, 7UL );
+   initialize( B );
+   const blaze::DynamicMatrix<VT,rowMajor> Br( B );
+
+   {
+      test_  = "Matrix/vector multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicVector<VT,columnVector> res( mat * x );
+      checkResult( res, ref * x );
+
+      res = y;
+      res += mat * x;
+      checkResult( res, y + ref * x );
+
+      res -= mat * x;
+      checkResult( res, y );
+
+      res = mat * ( x + x );
+      checkResult( res, ref * ( x + x ) );
+
+      res = ( mat + mat ) * x;
+      checkResult( res, ( ref + ref ) * x );
+
+      if( m > 1UL ) {
+         res = y;
+         subvector( res, 1UL, m-1UL ) = submatrix( mat, 1UL, 0UL, m-1UL, n ) * x;
+         checkResult( subvector( res, 1UL, m-1UL ), submatrix( ref, 1UL, 0UL, m-1UL, n ) * x );
+      }
+   }
+
+   {
+      test_  = "Matrix/column-major matrix multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicMatrix<VT,rowMajor> res1( mat * B );
+      checkResult( res1, ref * B );
+
+      blaze::DynamicMatrix<VT,columnMajor> res2( mat * B );
+      checkResult( res2, ref * B );
+
+      res1 += mat * B;
+      res2 -= mat * B;
+      checkResult( res1, 2 * ( ref * B ) );
+      checkResult( res2, blaze::DynamicMatrix<VT,columnMajor>( m, 7UL, VT() ) );
+
+      res2 = mat * submatrix( B, 0UL, 2UL, n, 5UL );
+      checkResult( res2, ref * submatrix( B, 0UL, 2UL, n, 5UL ) );
+   }
+
+   {
+      test_  = "Matrix/row-major matrix multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicMatrix<VT,rowMajor> res( mat * Br );
+      checkResult( res, ref * B );
+
+      res -= mat * Br;
+      checkResult( res, blaze::DynamicMatrix<VT,rowMajor>( m, 7UL, VT() ) );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction with an invalid sorting scope.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the conversion to a sliced ELLPACK matrix with a sorting scope of
+// zero fails. In case the conversion succeeds, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testInvalidSigma()
+{
+   test_ = "Construction with an invalid sorting scope";
+
+   try {
+      const blaze::CompressedMatrix<double,blaze::rowMajor> ref( 5UL, 5UL );
+      blaze::SlicedEllpackMatrix<double> mat( ref, 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction with a sorting scope of zero succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error_ << "\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants of a sliced ELLPACK matrix.
+//
+// \param object The matrix to be checked.
+// \return void
+// \exception std::runtime_error Invariant violation detected.
+*/
+template< typename Type >  // Type of the matrix
+void ClassTest::checkIntact( const Type& object )
+{
+   if( !isIntact( object ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Type:\n"
+          << "     " << typeid( Type ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix with random integral values.
+//
+// \param matrix The compressed matrix to be initialized.
+// \return void
+//
+// This function initializes the given matrix with rows of strongly varying length and random
+// values without fractional part, which guarantees that all results are computed exactly.
+*/
+template< typename MT  // Element type of the compressed matrix
+        , bool SO >    // Storage order
+void ClassTest::initialize( blaze::CompressedMatrix<MT,SO>& matrix )
+{
+   const size_t m( matrix.rows()    );
+   const size_t n( matrix.columns() );
+
+   matrix.reset();
+
+   for( size_t i=0UL; i<m; ++i ) {
+      const size_t fill( blaze::rand<size_t>( 0UL, 4UL ) );
+      for( size_t j=0UL; j<n; ++j ) {
+         if( blaze::rand<size_t>( 0UL, 4UL ) < fill )
+            matrix(i,j) = blaze::rand<int>( -9, 9 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense matrix with random integral values.
+//
+// \param matrix The dense matrix to be initialized.
+// \return void
+*/
+template< typename MT  // Element type of the dense matrix
+        , bool SO >    // Storage order
+void ClassTest::initialize( blaze::DynamicMatrix<MT,SO>& matrix )
+{
+   for( size_t i=0UL; i<matrix.rows(); ++i ) {
+      for( size_t j=0UL; j<matrix.columns(); ++j ) {
+         matrix(i,j) = blaze::rand<int>( -9, 9 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector with random non-zero integral values.
+//
+// \param vector The dense vector to be initialized.
+// \return void
+*/
+template< typename VT  // Element type of the dense vector
+        , bool TF >    // Transpose flag
+void ClassTest::initialize( blaze::DynamicVector<VT,TF>& vector )
+{
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      vector[i] = blaze::rand<int>( 1, 9 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the sliced ELLPACK matrix.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sliced ELLPACK matrix test.
+*/
+#define RUN_SLICEDELLPACK_CLASS_TEST \
+   blazetest::mathtest::slicedellpack::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace slicedellpack
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
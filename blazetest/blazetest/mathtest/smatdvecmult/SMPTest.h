@@ -0,0 +1,345 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatdvecmult/SMPTest.h
+//  \brief Header file for the sparse matrix/dense vector multiplication SMP test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATDVECMULT_SMPTEST_H_
+#define _BLAZETEST_MATHTEST_SMATDVECMULT_SMPTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/smp/Functions.h>
+#include <blaze/math/Subvector.h>
+#include <blaze/util/algorithms/Max.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatdvecmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the SMP tests of the sparse matrix/dense vector multiplication.
+//
+// This class represents a test suite for the parallel sparse matrix/dense vector multiplication
+// with row-major and column-major sparse matrices of highly skewed row or column lengths (i.e.
+// power law distributions, a single dense row/column among empty ones, and empty matrices). All
+// products exceed the according SMP thresholds and are evaluated for one to four threads. The
+// results are compared to the results of the according dense matrix/dense vector products.
+*/
+class SMPTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SMPTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Type definitions****************************************************************************
+   using DVec = blaze::DynamicVector<int>;  //!< Dense vector type of the tests.
+   //**********************************************************************************************
+
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< bool SO > void testMultiplication( size_t pattern );
+
+   void checkResult( const DVec& result, const DVec& expected,
+                     const std::string& operation, size_t threads ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< bool SO >
+   static blaze::DynamicMatrix<int> skewed( size_t m, size_t n, size_t pattern );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sparse matrix/dense vector multiplication for a skewed matrix.
+//
+// \param pattern The distribution of the non-zero elements (see the skewed() function).
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment, addition assignment, subtraction assignment,
+// and multiplication assignment of a sparse matrix/dense vector multiplication to a dense
+// vector and to a subvector for one to four threads. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< bool SO >  // Storage order of the sparse matrix
+void SMPTest::testMultiplication( size_t pattern )
+{
+   test_ = ( SO == blaze::rowMajor )
+           ?( "Row-major sparse matrix/dense vector multiplication" )
+           :( "Column-major sparse matrix/dense vector multiplication" );
+
+   const size_t threshold( blaze::max( blaze::SMP_SMATDVECMULT_THRESHOLD,
+                                       blaze::SMP_TSMATDVECMULT_THRESHOLD ) );
+   const size_t m( 8UL*threshold + 5UL );
+   const size_t n( 8UL*threshold + 11UL );
+
+   const blaze::DynamicMatrix<int> D( skewed<SO>( m, n, pattern ) );
+   const blaze::CompressedMatrix<int,SO> A( D );
+
+   DVec x( n );
+   randomize( x, -9, 9 );
+
+   DVec init( m );
+   randomize( init, 1, 9 );
+
+   const DVec ref( D * x );
+
+   for( size_t threads=1UL; threads<=4UL; ++threads )
+   {
+#if !BLAZE_HPX_PARALLEL_MODE
+      blaze::setNumThreads( threads );
+#endif
+
+      {
+         DVec y( init );
+         y = A * x;
+         checkResult( y, ref, "assignment", threads );
+      }
+
+      {
+         DVec y( init );
+         y += A * x;
+         checkResult( y, init + ref, "addition assignment", threads );
+      }
+
+      {
+         DVec y( init );
+         y -= A * x;
+         checkResult( y, init - ref, "subtraction assignment", threads );
+      }
+
+      {
+         DVec y( init );
+         y *= A * x;
+         checkResult( y, init * ref, "multiplication assignment", threads );
+      }
+
+      {
+         DVec y( m+7UL, 0 ), expected( m+7UL, 0 );
+         subvector( y, 3UL, m ) = A * x;
+         subvector( expected, 3UL, m ) = ref;
+         checkResult( y, expected, "subvector assignment", threads );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a parallel sparse matrix/dense vector multiplication.
+//
+// \param result The result of the parallel multiplication.
+// \param expected The expected result.
+// \param operation The performed (compound) assignment.
+// \param threads The number of threads.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function compares the given result to the expected result. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+inline void SMPTest::checkResult( const DVec& result, const DVec& expected,
+                                  const std::string& operation, size_t threads ) const
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid " << operation << " result detected\n"
+          << " Details:\n"
+          << "   Number of threads: " << threads << "\n"
+          << "   Result:\n" << trans( result ) << "\n"
+          << "   Expected result:\n" << trans( expected ) << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Creates a random matrix with highly skewed row or column lengths.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \param pattern The distribution of the non-zero elements.
+// \return The random matrix.
+//
+// This function creates a random matrix whose rows (in case \a SO is \a blaze::rowMajor) or
+// columns (in case \a SO is \a blaze::columnMajor) have highly skewed numbers of non-zero
+// elements. The following patterns are available:
+//
+//  - 0: Power law distribution with the longest lines at the beginning
+//  - 1: Power law distribution with the longest lines at the end
+//  - 2: A single dense line in the middle of the matrix, all other lines are empty
+//  - 3: A single dense line at the end of the matrix, all other lines are empty
+//  - 4: No non-zero elements at all
+*/
+template< bool SO >  // Storage order of the skewed lines
+blaze::DynamicMatrix<int> SMPTest::skewed( size_t m, size_t n, size_t pattern )
+{
+   const size_t lines ( SO == blaze::rowMajor ? m : n );
+   const size_t length( SO == blaze::rowMajor ? n : m );
+
+   blaze::DynamicMatrix<int> D( m, n, 0 );
+
+   for( size_t l=0UL; l<lines; ++l )
+   {
+      size_t nonzeros( 0UL );
+
+      switch( pattern ) {
+         case 0UL: nonzeros = length / ( 1UL + l*l ); break;
+         case 1UL: nonzeros = length / ( 1UL + ( lines-1UL-l )*( lines-1UL-l ) ); break;
+         case 2UL: nonzeros = ( l == lines/2UL )?( length ):( 0UL ); break;
+         case 3UL: nonzeros = ( l == lines-1UL )?( length ):( 0UL ); break;
+         default : break;
+      }
+
+      for( size_t k=0UL; k<nonzeros; ++k )
+      {
+         const size_t pos( blaze::rand<size_t>( 0UL, length-1UL ) );
+         const int value( blaze::rand<int>( 1, 9 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 ) );
+
+         if( SO == blaze::rowMajor )
+            D(l,pos) = value;
+         else
+            D(pos,l) = value;
+      }
+   }
+
+   return D;
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the parallel sparse matrix/dense vector multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   SMPTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the sparse matrix/dense vector multiplication SMP test.
+*/
+#define RUN_SMATDVECMULT_SMP_TEST \
+   blazetest::mathtest::smatdvecmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatdvecmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
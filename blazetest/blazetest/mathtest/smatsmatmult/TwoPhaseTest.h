@@ -0,0 +1,346 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/smatsmatmult/TwoPhaseTest.h
+//  \brief Header file for the sparse matrix/sparse matrix multiplication two-phase test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SMATSMATMULT_TWOPHASETEST_H_
+#define _BLAZETEST_MATHTEST_SMATSMATMULT_TWOPHASETEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <blaze/math/AccumulatorFlag.h>
+#include <blaze/math/CompressedMatrix.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for the two-phase sparse matrix/sparse matrix multiplication test.
+//
+// This class represents a test suite for the symbolicMult() and numericMult() functions. It
+// performs a series of runtime tests to assure that the symbolic phase computes the correct
+// sparsity pattern and that the numeric phase correctly refills the values of this pattern
+// for all accumulator types and all combinations of storage orders.
+*/
+class TwoPhaseTest
+{
+ private:
+   //**Type definitions****************************************************************************
+   using SMat  = blaze::CompressedMatrix<int,blaze::rowMajor>;     //!< Row-major sparse matrix type.
+   using TSMat = blaze::CompressedMatrix<int,blaze::columnMajor>;  //!< Column-major sparse matrix type.
+   //**********************************************************************************************
+
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit TwoPhaseTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< blaze::AccumulatorFlag AF >
+   void testMultiplication( const std::string& name );
+
+   void testPatternReuse();
+   void testAliasing    ();
+   void testErrors      ();
+
+   template< blaze::AccumulatorFlag AF, typename MT, typename MT1, typename MT2 >
+   void testProduct( const MT1& A, const MT2& B );
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& computedResult, const T2& expectedResult );
+
+   template< typename Type >
+   void checkNonZeros( const Type& matrix, size_t expectedNonZeros );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   void initialize();
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   SMat sA3x4_;    //!< The first row-major sparse matrix.
+                   /*!< The \f$ 3 \times 4 \f$ matrix is initialized as
+                        \f[\left(\begin{array}{*{4}{c}}
+                        -1 & 0 & -2 & 0 \\
+                         0 & 2 & -3 & 1 \\
+                         0 & 1 &  2 & 2 \\
+                        \end{array}\right)\f]. */
+   SMat sB4x3_;    //!< The second row-major sparse matrix.
+                   /*!< The \f$ 4 \times 3 \f$ matrix is initialized as
+                        \f[\left(\begin{array}{*{3}{c}}
+                        1 &  0 & -3 \\
+                        0 & -1 &  0 \\
+                        0 &  2 &  1 \\
+                        2 &  1 & -2 \\
+                        \end{array}\right)\f]. */
+   TSMat tsA3x4_;  //!< The first column-major sparse matrix.
+                   /*!< The \f$ 3 \times 4 \f$ matrix is initialized as
+                        \f[\left(\begin{array}{*{4}{c}}
+                        -1 & 0 & -2 & 0 \\
+                         0 & 2 & -3 & 1 \\
+                         0 & 1 &  2 & 2 \\
+                        \end{array}\right)\f]. */
+   TSMat tsB4x3_;  //!< The second column-major sparse matrix.
+                   /*!< The \f$ 4 \times 3 \f$ matrix is initialized as
+                        \f[\left(\begin{array}{*{3}{c}}
+                        1 &  0 & -3 \\
+                        0 & -1 &  0 \\
+                        0 &  2 &  1 \\
+                        2 &  1 & -2 \\
+                        \end{array}\right)\f]. */
+
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the two-phase multiplication with a specific accumulator.
+//
+// \param name The name of the tested accumulator.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symbolic and numeric phase of the sparse matrix/sparse matrix
+// multiplication with the given accumulator for all combinations of storage orders. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< blaze::AccumulatorFlag AF >  // Type of the accumulator
+void TwoPhaseTest::testMultiplication( const std::string& name )
+{
+   test_ = "Two-phase multiplication (" + name + ")";
+
+   initialize();
+
+   testProduct<AF,SMat >( sA3x4_ , sB4x3_  );
+   testProduct<AF,SMat >( sA3x4_ , tsB4x3_ );
+   testProduct<AF,SMat >( tsA3x4_, sB4x3_  );
+   testProduct<AF,SMat >( tsA3x4_, tsB4x3_ );
+   testProduct<AF,TSMat>( sA3x4_ , sB4x3_  );
+   testProduct<AF,TSMat>( sA3x4_ , tsB4x3_ );
+   testProduct<AF,TSMat>( tsA3x4_, sB4x3_  );
+   testProduct<AF,TSMat>( tsA3x4_, tsB4x3_ );
+
+   testProduct<AF,SMat >( trans( sB4x3_ ), trans( tsA3x4_ ) );
+   testProduct<AF,TSMat>( trans( tsB4x3_ ), trans( sA3x4_ ) );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the two-phase multiplication of the two given operands.
+//
+// \param A The left-hand side sparse matrix operand.
+// \param B The right-hand side sparse matrix operand.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function computes the sparsity pattern of the product of the two given operands via
+// symbolicMult(), fills in the values via numericMult() and compares the result to the
+// result of the default multiplication.
+*/
+template< blaze::AccumulatorFlag AF  // Type of the accumulator
+        , typename MT                // Type of the result matrix
+        , typename MT1               // Type of the left-hand side operand
+        , typename MT2 >             // Type of the right-hand side operand
+void TwoPhaseTest::testProduct( const MT1& A, const MT2& B )
+{
+   const MT result( A * B );
+
+   MT C;
+   blaze::symbolicMult<AF>( C, A, B );
+
+   if( !isIntact( C ) || C.rows() != A.rows() || C.columns() != B.columns() ) {
+      std::ostringstream oss;
+      oss << " Test : " << test_ << "\n"
+          << " Error: Invalid result of the symbolic phase detected\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   checkNonZeros( C, result.nonZeros() );
+
+   blaze::numericMult<AF>( C, A, B );
+
+   checkResult( C, result );
+   checkNonZeros( C, result.nonZeros() );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking and comparing the computed result.
+//
+// \param computedResult The computed result.
+// \param expectedResult The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+//
+// This function is called after each test case to check and compare the computed result.
+// In case the computed and the expected result differ in any way, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename T1    // Matrix type of the computed result
+        , typename T2 >  // Matrix type of the expected result
+void TwoPhaseTest::checkResult( const T1& computedResult, const T2& expectedResult )
+{
+   if( computedResult != expectedResult ) {
+      std::ostringstream oss;
+      oss.precision( 20 );
+      oss << " Test : " << test_ << "\n"
+          << " Error: Incorrect result detected\n"
+          << " Details:\n"
+          << "   Computed result:\n" << computedResult << "\n"
+          << "   Expected result:\n" << expectedResult << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of non-zero elements of the given matrix.
+//
+// \param matrix The matrix to be checked.
+// \param expectedNonZeros The expected number of non-zero elements of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the number of non-zero elements of the given matrix. In case the
+// actual number of non-zero elements does not correspond to the given expected number,
+// a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Type of the matrix
+void TwoPhaseTest::checkNonZeros( const Type& matrix, size_t expectedNonZeros )
+{
+   if( nonZeros( matrix ) != expectedNonZeros ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of non-zero elements\n"
+          << " Details:\n"
+          << "   Number of non-zeros         : " << nonZeros( matrix ) << "\n"
+          << "   Expected number of non-zeros: " << expectedNonZeros << "\n"
+          << "   Matrix:\n" << matrix << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the two-phase sparse matrix/sparse matrix multiplication.
+//
+// \return void
+*/
+void runTest()
+{
+   TwoPhaseTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the two-phase sparse matrix/sparse matrix multiplication test.
+*/
+#define RUN_SMATSMATMULT_TWOPHASE_TEST \
+   blazetest::mathtest::smatsmatmult::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -0,0 +1,1039 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/soacompressed/ClassTest.h
+//  \brief Header file for the structure-of-arrays compressed matrix and vector test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOACOMPRESSED_CLASSTEST_H_
+#define _BLAZETEST_MATHTEST_SOACOMPRESSED_CLASSTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/CompressedVector.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/SoACompressedMatrix.h>
+#include <blaze/math/SoACompressedVector.h>
+#include <blaze/math/Views.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace soacompressed {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all tests of the structure-of-arrays compressed matrix and vector.
+//
+// This class represents a test suite for the SoACompressedMatrix and SoACompressedVector class
+// templates. All results are compared to the results of the according CompressedMatrix and
+// CompressedVector operations.
+*/
+class ClassTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit ClassTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename ST, typename RT >
+   void testMatrix( size_t m, size_t n );
+
+   template< typename ST, typename RT >
+   void testMatrixConstruction( const RT& ref );
+
+   template< typename ST, typename RT >
+   void testMatrixModification( const RT& ref );
+
+   template< typename ST, typename RT >
+   void testMatrixOperations( const RT& ref );
+
+   template< typename ST, typename RT >
+   void testVector( size_t n );
+
+   template< typename ST, typename RT >
+   void testVectorModification( const RT& ref );
+
+   template< typename ST, typename RT >
+   void testVectorOperations( const RT& ref );
+
+   void testIndexRange();
+
+   template< typename T1, typename T2 >
+   void checkResult( const T1& result, const T2& expected );
+
+   template< typename Type >
+   void checkIntact( const Type& object );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename MT, bool SO >
+   void initialize( blaze::CompressedMatrix<MT,SO>& matrix );
+
+   template< typename VT, bool TF >
+   void initialize( blaze::CompressedVector<VT,TF>& vector );
+
+   template< typename VT, bool TF >
+   void initialize( blaze::DynamicVector<VT,TF>& vector );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;   //!< Label of the currently performed test.
+   std::string error_;  //!< Description of the current error type.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of a structure-of-arrays compressed matrix of size \f$ M \times N \f$.
+//
+// \param m The number of rows of the matrix.
+// \param n The number of columns of the matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random reference matrix of type \a RT and tests the according
+// structure-of-arrays compressed matrix of type \a ST. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testMatrix( size_t m, size_t n )
+{
+   RT ref( m, n );
+   initialize( ref );
+
+   testMatrixConstruction<ST>( ref );
+   testMatrixModification<ST>( ref );
+   testMatrixOperations<ST>( ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction of a structure-of-arrays compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the conversion from sparse and dense matrices, the copy and move
+// operations, and the construction via the append() and finalize() functions. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testMatrixConstruction( const RT& ref )
+{
+   using blaze::rowMajor;
+
+   const size_t m( ref.rows() );
+   const size_t n( ref.columns() );
+
+
+   //=====================================================================================
+   // Conversion and copy operations
+   //=====================================================================================
+
+   {
+      test_  = "Conversion from a compressed matrix";
+      error_ = "Conversion failed";
+
+      ST mat( ref );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion from a dense matrix";
+      error_ = "Conversion failed";
+
+      const blaze::DynamicMatrix<blaze::ElementType_t<RT>,rowMajor> dense( ref );
+      ST mat( dense );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Conversion from a matrix with opposite storage order";
+      error_ = "Conversion failed";
+
+      const blaze::OppositeType_t<RT> opposite( ref );
+      ST mat( opposite );
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+   }
+
+   {
+      test_  = "Copy and move operations";
+      error_ = "Copy or move failed";
+
+      const ST mat1( ref );
+      ST mat2( mat1 );
+      ST mat3( std::move( mat2 ) );
+      ST mat4( 2UL, 3UL );
+      mat4 = mat3;
+      ST mat5;
+      mat5 = std::move( mat4 );
+
+      checkResult( mat3, ref );
+      checkResult( mat5, ref );
+      checkIntact( mat5 );
+   }
+
+
+   //=====================================================================================
+   // Construction via append() and finalize()
+   //=====================================================================================
+
+   {
+      test_  = "Construction via append() and finalize()";
+      error_ = "Construction failed";
+
+      const bool SO( blaze::IsColumnMajorMatrix_v<RT> );
+      const size_t lines( SO ? n : m );
+
+      ST mat( m, n, ref.nonZeros() );
+
+      for( size_t l=0UL; l<lines; ++l ) {
+         for( auto element=ref.begin(l); element!=ref.end(l); ++element ) {
+            if( SO ) mat.append( element->index(), l, element->value() );
+            else     mat.append( l, element->index(), element->value() );
+         }
+         mat.finalize( l );
+      }
+
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      for( size_t l=0UL; l<lines; ++l )
+      {
+         if( mat.nonZeros( l ) != ref.nonZeros( l ) ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Invalid number of non-zero elements\n"
+                << " Details:\n"
+                << "   Matrix type:\n"
+                << "     " << typeid( ST ).name() << "\n"
+                << "   Line: " << l << "\n"
+                << "   Number of non-zeros: " << mat.nonZeros( l ) << "\n"
+                << "   Expected number of non-zeros: " << ref.nonZeros( l ) << "\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the modification of a structure-of-arrays compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the element access, insertion, erasure, resizing, and reserve functions
+// of the given structure-of-arrays compressed matrix. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testMatrixModification( const RT& ref )
+{
+   using blaze::rowMajor;
+
+   using ET = blaze::ElementType_t<RT>;
+
+   const size_t m( ref.rows() );
+   const size_t n( ref.columns() );
+
+   if( m == 0UL || n == 0UL ) return;
+
+
+   //=====================================================================================
+   // Element access and insertion
+   //=====================================================================================
+
+   {
+      test_  = "Element access and insertion";
+      error_ = "Modification failed";
+
+      ST  mat( ref );
+      blaze::DynamicMatrix<ET,rowMajor> res( ref );
+
+      for( size_t i=0UL; i<m; i+=2UL ) {
+         for( size_t j=i%3UL; j<n; j+=3UL ) {
+            mat(i,j) += ET( 2 );
+            res(i,j) += ET( 2 );
+         }
+      }
+
+      mat.set( m-1UL, n-1UL, ET( 7 ) );
+      res(m-1UL,n-1UL) = ET( 7 );
+
+      checkResult( mat, res );
+      checkIntact( mat );
+   }
+
+
+   //=====================================================================================
+   // Erasure
+   //=====================================================================================
+
+   {
+      test_  = "Erasure of elements";
+      error_ = "Erasure failed";
+
+      ST mat( ref );
+      RT res( ref );
+
+      mat.erase( 0UL, 0UL );
+      res.erase( 0UL, 0UL );
+
+      mat.erase( []( ET value ){ return value < ET( 0 ); } );
+      res.erase( []( ET value ){ return value < ET( 0 ); } );
+
+      checkResult( mat, res );
+      checkIntact( mat );
+   }
+
+
+   //=====================================================================================
+   // Resizing and reserving
+   //=====================================================================================
+
+   {
+      test_  = "Resizing of the matrix";
+      error_ = "Resizing failed";
+
+      ST mat( ref );
+
+      mat.reserve( 2UL*ref.nonZeros() + 5UL );
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      mat.reserve( 0UL, 11UL );
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      mat.trim();
+      mat.shrinkToFit();
+      checkResult( mat, ref );
+      checkIntact( mat );
+
+      mat.resize( m+2UL, n/2UL, true );
+
+      const ST& cmat( mat );
+
+      for( size_t i=0UL; i<m+2UL; ++i ) {
+         for( size_t j=0UL; j<n/2UL; ++j ) {
+            if( cmat(i,j) != ( i < m ? ref(i,j) : ET() ) ) {
+               std::ostringstream oss;
+               oss << " Test: " << test_ << "\n"
+                   << " Error: " << error_ << "\n"
+                   << " Details:\n"
+                   << "   Matrix type:\n"
+                   << "     " << typeid( ST ).name() << "\n"
+                   << "   Result:\n" << mat << "\n"
+                   << "   Original matrix:\n" << ref << "\n";
+               throw std::runtime_error( oss.str() );
+            }
+         }
+      }
+
+      checkIntact( mat );
+
+      for( size_t i=0UL; i<m+2UL; ++i ) {
+         for( size_t j=0UL; j<n/2UL; ++j ) {
+            mat(i,j) = ET( 1 );
+         }
+      }
+
+      if( mat.nonZeros() != (m+2UL)*(n/2UL) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Filling the resized matrix failed\n"
+             << " Details:\n"
+             << "   Matrix type:\n"
+             << "     " << typeid( ST ).name() << "\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      checkIntact( mat );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse kernels with a structure-of-arrays compressed matrix.
+//
+// \param ref The reference matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the additions, subtractions, Schur products, and multiplications of the
+// structure-of-arrays compressed matrix with sparse and dense matrices and vectors. In case an
+// error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed matrix
+        , typename RT >  // Type of the reference matrix
+void ClassTest::testMatrixOperations( const RT& ref )
+{
+   using blaze::rowMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+
+   using ET = blaze::ElementType_t<RT>;
+
+   const size_t m( ref.rows() );
+   const size_t n( ref.columns() );
+
+   RT ref2( m, n );
+   initialize( ref2 );
+
+   const ST mat ( ref  );
+   const ST mat2( ref2 );
+
+   blaze::DynamicVector<ET,columnVector> x( n );
+   blaze::DynamicVector<ET,rowVector> y( m );
+   initialize( x );
+   initialize( y );
+
+
+   //=====================================================================================
+   // Addition, subtraction, and Schur product
+   //=====================================================================================
+
+   {
+      test_  = "Addition and subtraction";
+      error_ = "Failed operation";
+
+      ST res( mat + mat2 );
+      checkResult( res, ref + ref2 );
+      checkIntact( res );
+
+      res -= mat;
+      checkResult( res, ref2 );
+      checkIntact( res );
+
+      res += blaze::DynamicMatrix<ET,rowMajor>( ref );
+      checkResult( res, ref + ref2 );
+      checkIntact( res );
+
+      res = mat - mat2;
+      checkResult( res, ref - ref2 );
+      checkIntact( res );
+   }
+
+   {
+      test_  = "Schur product";
+      error_ = "Failed operation";
+
+      ST res( mat );
+      res %= mat2;
+      checkResult( res, ref % ref2 );
+      checkIntact( res );
+
+      res = mat;
+      res %= blaze::DynamicMatrix<ET,rowMajor>( ref2 );
+      checkResult( res, ref % ref2 );
+      checkIntact( res );
+   }
+
+
+   //=====================================================================================
+   // Multiplications
+   //=====================================================================================
+
+   {
+      test_  = "Matrix/vector multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicVector<ET,columnVector> res( mat * x );
+      checkResult( res, ref * x );
+
+      res += mat * x;
+      checkResult( res, 2 * ( ref * x ) );
+
+      res -= mat * x;
+      checkResult( res, ref * x );
+
+      res = mat * subvector( x, 0UL, n );
+      checkResult( res, ref * x );
+   }
+
+   {
+      test_  = "Vector/matrix multiplication";
+      error_ = "Failed multiplication";
+
+      blaze::DynamicVector<ET,rowVector> res( y * mat );
+      checkResult( res, y * ref );
+   }
+
+   {
+      test_  = "Matrix/matrix multiplication";
+      error_ = "Failed multiplication";
+
+      ST res( mat * trans( mat2 ) );
+      checkResult( res, ref * trans( ref2 ) );
+      checkIntact( res );
+
+      blaze::DynamicMatrix<ET,rowMajor> dres( trans( mat ) * mat2 );
+      checkResult( dres, trans( ref ) * ref2 );
+   }
+
+   {
+      test_  = "Transpose operations";
+      error_ = "Failed transpose";
+
+      ST res( mat );
+      res.transpose();
+      checkResult( res, trans( ref ) );
+      checkIntact( res );
+
+      blaze::OppositeType_t<ST> tres( trans( mat ) );
+      checkResult( tres, trans( ref ) );
+      checkIntact( tres );
+   }
+
+   {
+      test_  = "Row and column views";
+      error_ = "Failed view operation";
+
+      if( m > 0UL && n > 0UL ) {
+         ST  res( mat );
+         RT  ref3( ref );
+         row( res, 0UL ) *= ET( 3 );
+         row( ref3, 0UL ) *= ET( 3 );
+         column( res, n-1UL ) = column( ref2, n-1UL );
+         column( ref3, n-1UL ) = column( ref2, n-1UL );
+         checkResult( res, ref3 );
+         checkIntact( res );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of a structure-of-arrays compressed vector of size \f$ N \f$.
+//
+// \param n The size of the vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes a random reference vector of type \a RT and tests the according
+// structure-of-arrays compressed vector of type \a ST. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed vector
+        , typename RT >  // Type of the reference vector
+void ClassTest::testVector( size_t n )
+{
+   RT ref( n );
+   initialize( ref );
+
+   testVectorModification<ST>( ref );
+   testVectorOperations<ST>( ref );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the construction and modification of a structure-of-arrays compressed vector.
+//
+// \param ref The reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the construction, element access, insertion, erasure, and resizing of
+// the given structure-of-arrays compressed vector. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed vector
+        , typename RT >  // Type of the reference vector
+void ClassTest::testVectorModification( const RT& ref )
+{
+   using ET = blaze::ElementType_t<RT>;
+
+   const size_t n( ref.size() );
+
+
+   //=====================================================================================
+   // Construction
+   //=====================================================================================
+
+   {
+      test_  = "Construction of a compressed vector";
+      error_ = "Construction failed";
+
+      ST vec1( ref );
+      checkResult( vec1, ref );
+      checkIntact( vec1 );
+
+      ST vec2( n, ref.nonZeros() );
+      for( auto element=ref.begin(); element!=ref.end(); ++element )
+         vec2.append( element->index(), element->value() );
+      checkResult( vec2, ref );
+      checkIntact( vec2 );
+
+      ST vec3( std::move( vec2 ) );
+      ST vec4;
+      vec4 = vec3;
+      checkResult( vec4, ref );
+      checkIntact( vec4 );
+   }
+
+   if( n == 0UL ) return;
+
+
+   //=====================================================================================
+   // Element access, insertion, and erasure
+   //=====================================================================================
+
+   {
+      test_  = "Element access, insertion, and erasure";
+      error_ = "Modification failed";
+
+      ST vec( ref );
+      RT res( ref );
+
+      for( size_t i=0UL; i<n; i+=3UL ) {
+         vec[i] += ET( 2 );
+         res[i] += ET( 2 );
+      }
+
+      vec.set( n-1UL, ET( 5 ) );
+      res.set( n-1UL, ET( 5 ) );
+
+      vec.erase( 0UL );
+      res.erase( 0UL );
+
+      vec.erase( []( ET value ){ return value < ET( 0 ); } );
+      res.erase( []( ET value ){ return value < ET( 0 ); } );
+
+      checkResult( vec, res );
+      checkIntact( vec );
+   }
+
+
+   //=====================================================================================
+   // Resizing and reserving
+   //=====================================================================================
+
+   {
+      test_  = "Resizing of the vector";
+      error_ = "Resizing failed";
+
+      ST vec( ref );
+      RT res( ref );
+
+      vec.reserve( 2UL*n );
+      checkResult( vec, res );
+
+      vec.resize( n/2UL );
+      res.resize( n/2UL );
+      checkResult( vec, res );
+
+      vec.shrinkToFit();
+      checkResult( vec, res );
+      checkIntact( vec );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the sparse kernels with a structure-of-arrays compressed vector.
+//
+// \param ref The reference vector.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the additions, subtractions, multiplications, and divisions of the
+// structure-of-arrays compressed vector with sparse and dense vectors. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename ST    // Type of the structure-of-arrays compressed vector
+        , typename RT >  // Type of the reference vector
+void ClassTest::testVectorOperations( const RT& ref )
+{
+   using ET = blaze::ElementType_t<RT>;
+
+   constexpr bool TF( blaze::IsRowVector_v<RT> );
+
+   const size_t n( ref.size() );
+
+   RT ref2( n );
+   initialize( ref2 );
+
+   blaze::DynamicVector<ET,TF> dense( n );
+   initialize( dense );
+
+   const ST vec ( ref  );
+   const ST vec2( ref2 );
+
+   {
+      test_  = "Addition and subtraction";
+      error_ = "Failed operation";
+
+      ST res( vec + vec2 );
+      checkResult( res, ref + ref2 );
+      checkIntact( res );
+
+      res -= vec2;
+      checkResult( res, ref );
+      checkIntact( res );
+
+      res += dense;
+      checkResult( res, ref + dense );
+      checkIntact( res );
+   }
+
+   {
+      test_  = "Multiplication and division";
+      error_ = "Failed operation";
+
+      ST res( vec );
+      res *= vec2;
+      checkResult( res, ref * ref2 );
+      checkIntact( res );
+
+      res = vec;
+      res *= dense;
+      checkResult( res, ref * dense );
+      checkIntact( res );
+
+      res = vec * ET( 3 );
+      res /= blaze::DynamicVector<ET,TF>( n, ET( 3 ) );
+      checkResult( res, ref );
+      checkIntact( res );
+   }
+
+   {
+      test_  = "Inner product";
+      error_ = "Failed operation";
+
+      if( dot( vec, vec2 ) != dot( ref, ref2 ) || dot( vec, dense ) != dot( ref, dense ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: " << error_ << "\n"
+             << " Details:\n"
+             << "   Vector type:\n"
+             << "     " << typeid( ST ).name() << "\n"
+             << "   Result: " << dot( vec, vec2 ) << "\n"
+             << "   Expected result: " << dot( ref, ref2 ) << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the range check of the index type.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that the construction and resizing of structure-of-arrays compressed
+// matrices and vectors with dimensions beyond the range of the index type fail with a
+// \a std::invalid_argument exception. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testIndexRange()
+{
+   using blaze::SoACompressedMatrix;
+   using blaze::SoACompressedVector;
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+
+   test_ = "Range check of the index type";
+
+   const size_t limit( 1UL << 32UL );
+
+   try {
+      SoACompressedVector<double,columnVector,uint32_t> vec( limit+1UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Construction of an oversized vector succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   try {
+      SoACompressedMatrix<double,rowMajor,uint32_t> mat( 3UL, 3UL );
+      mat.resize( 2UL, limit+1UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing to an oversized matrix succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   SoACompressedVector<double,columnVector,uint32_t> vec( limit );
+   SoACompressedMatrix<double,columnMajor,uint32_t> mat( limit, 2UL );
+   SoACompressedMatrix<double,rowMajor,uint64_t> mat64( 2UL, limit+1UL );
+
+   if( vec.size() != limit || mat.rows() != limit || mat64.columns() != limit+1UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid dimensions detected\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a structure-of-arrays compressed matrix or vector operation.
+//
+// \param result The computed result.
+// \param expected The expected result.
+// \return void
+// \exception std::runtime_error Incorrect result detected.
+*/
+template< typename T1    // Type of the computed result
+        , typename T2 >  // Type of the expected result
+void ClassTest::checkResult( const T1& result, const T2& expected )
+{
+   if( result != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error_ << "\n"
+          << " Details:\n"
+          << "   Result type:\n"
+          << "     " << typeid( T1 ).name() << "\n"
+          << "   Result:\n" << result << "\n"
+          << "   Expected result:\n" << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the invariants of a structure-of-arrays compressed matrix or vector.
+//
+// \param object The matrix or vector to be checked.
+// \return void
+// \exception std::runtime_error Invariant violation detected.
+*/
+template< typename Type >  // Type of the matrix or vector
+void ClassTest::checkIntact( const Type& object )
+{
+   if( !isIntact( object ) ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invariant violation detected\n"
+          << " Details:\n"
+          << "   Type:\n"
+          << "     " << typeid( Type ).name() << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed matrix with random integral values.
+//
+// \param matrix The compressed matrix to be initialized.
+// \return void
+//
+// This function initializes about a third of the elements of the given matrix with random
+// values without fractional part, which guarantees that all results are computed exactly.
+*/
+template< typename MT  // Element type of the compressed matrix
+        , bool SO >    // Storage order
+void ClassTest::initialize( blaze::CompressedMatrix<MT,SO>& matrix )
+{
+   const size_t m( matrix.rows()    );
+   const size_t n( matrix.columns() );
+
+   matrix.reset();
+
+   for( size_t i=0UL; i<m; ++i ) {
+      for( size_t j=0UL; j<n; ++j ) {
+         if( blaze::rand<size_t>( 0UL, 2UL ) == 0UL )
+            matrix(i,j) = blaze::rand<int>( -9, 9 );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given compressed vector with random integral values.
+//
+// \param vector The compressed vector to be initialized.
+// \return void
+//
+// This function initializes about a third of the elements of the given vector with random
+// values without fractional part, which guarantees that all results are computed exactly.
+*/
+template< typename VT  // Element type of the compressed vector
+        , bool TF >    // Transpose flag
+void ClassTest::initialize( blaze::CompressedVector<VT,TF>& vector )
+{
+   vector.reset();
+
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      if( blaze::rand<size_t>( 0UL, 2UL ) == 0UL )
+         vector[i] = blaze::rand<int>( -9, 9 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Initialization of the given dense vector with random non-zero integral values.
+//
+// \param vector The dense vector to be initialized.
+// \return void
+*/
+template< typename VT  // Element type of the dense vector
+        , bool TF >    // Transpose flag
+void ClassTest::initialize( blaze::DynamicVector<VT,TF>& vector )
+{
+   for( size_t i=0UL; i<vector.size(); ++i ) {
+      vector[i] = blaze::rand<int>( 1, 9 ) * ( blaze::rand<int>( 0, 1 ) ? 1 : -1 );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the structure-of-arrays compressed matrix and vector.
+//
+// \return void
+*/
+void runTest()
+{
+   ClassTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the structure-of-arrays compressed matrix and vector test.
+*/
+#define RUN_SOACOMPRESSED_CLASS_TEST \
+   blazetest::mathtest::soacompressed::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace soacompressed
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
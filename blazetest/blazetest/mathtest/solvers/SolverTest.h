@@ -0,0 +1,683 @@
+//=================================================================================================
+/*!
+//  \file blazetest/mathtest/solvers/SolverTest.h
+//  \brief Header file for the iterative solver test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+#ifndef _BLAZETEST_MATHTEST_SOLVERS_SOLVERTEST_H_
+#define _BLAZETEST_MATHTEST_SOLVERS_SOLVERTEST_H_
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <blaze/math/CompressedMatrix.h>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/math/DynamicVector.h>
+#include <blaze/math/Solvers.h>
+#include <blaze/util/Random.h>
+#include <blazetest/system/Types.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace solvers {
+
+//=================================================================================================
+//
+//  CLASS DEFINITION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary class for all iterative solver tests.
+//
+// This class represents a test suite for the iterative solvers (cg(), bicgstab(), and gmres())
+// and the available preconditioners. The solution of each solver is verified by means of the
+// residual of the linear system of equations.
+*/
+class SolverTest
+{
+ public:
+   //**Constructors********************************************************************************
+   /*!\name Constructors */
+   //@{
+   explicit SolverTest();
+   // No explicitly declared copy constructor.
+   //@}
+   //**********************************************************************************************
+
+   //**Destructor**********************************************************************************
+   // No explicitly declared destructor.
+   //**********************************************************************************************
+
+ private:
+   //**Test functions******************************************************************************
+   /*!\name Test functions */
+   //@{
+   template< typename Type >
+   void testSymmetric( size_t k );
+
+   template< typename Type >
+   void testNonSymmetric( size_t k );
+
+   template< typename Type >
+   void testDense( size_t n );
+
+   template< typename Type >
+   void testOperator( size_t k );
+
+   void testPreconditioners();
+   void testExceptions();
+
+   template< typename MT, typename VT1, typename VT2 >
+   void checkResult( const MT& A, const VT1& x, const VT2& b,
+                     const blaze::SolverResult& result, double tolerance );
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   template< typename Type >
+   void initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A, size_t k, Type convection );
+   //@}
+   //**********************************************************************************************
+
+   //**Member variables****************************************************************************
+   /*!\name Member variables */
+   //@{
+   std::string test_;  //!< Label of the currently performed test.
+   //@}
+   //**********************************************************************************************
+};
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the solvers for a symmetric positive definite sparse system.
+//
+// \param k The number of grid points in each dimension of the 2D Poisson problem.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all solvers and preconditioners for the 2D Poisson problem on a
+// \f$ k \times k \f$ grid. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Element type of the linear system
+void SolverTest::testSymmetric( size_t k )
+{
+   const size_t n( k*k );
+   const double tolerance( sizeof( Type ) == sizeof( float ) ? 1E-4 : 1E-10 );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   initialize( A, k, Type(0) );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+   randomize( b );
+
+   blaze::SolverSettings settings;
+   settings.tolerance     = tolerance;
+   settings.maxIterations = 10UL*n;
+
+   {
+      test_ = "CG (2D Poisson problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::cg( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "Jacobi preconditioned CG (2D Poisson problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(1) );
+      const blaze::JacobiPreconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::cg( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "ILU(0) preconditioned CG (2D Poisson problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::ILU0Preconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::cg( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab (2D Poisson problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "GMRES (2D Poisson problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::JacobiPreconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::gmres( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solvers for a non-symmetric sparse system.
+//
+// \param k The number of grid points in each dimension of the 2D convection-diffusion problem.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the BiCGStab and GMRES solvers for the 2D convection-diffusion problem
+// on a \f$ k \times k \f$ grid. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+template< typename Type >  // Element type of the linear system
+void SolverTest::testNonSymmetric( size_t k )
+{
+   const size_t n( k*k );
+   const double tolerance( sizeof( Type ) == sizeof( float ) ? 1E-4 : 1E-10 );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   initialize( A, k, Type(0.5) );
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+   randomize( b );
+
+   blaze::SolverSettings settings;
+   settings.tolerance     = tolerance;
+   settings.maxIterations = 10UL*n;
+
+   {
+      test_ = "BiCGStab (2D convection-diffusion problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "ILU(0) preconditioned BiCGStab (2D convection-diffusion problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::ILU0Preconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   for( size_t restart : { 5UL, 30UL } )
+   {
+      test_ = "GMRES (2D convection-diffusion problem)";
+
+      settings.restart = restart;
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::gmres( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "ILU(0) preconditioned GMRES (2D convection-diffusion problem)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::ILU0Preconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::gmres( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solvers for a dense system.
+//
+// \param n The number of rows and columns of the system matrix.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all solvers for a diagonally dominant, symmetric dense system. In case
+// an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the linear system
+void SolverTest::testDense( size_t n )
+{
+   const double tolerance( 1E-10 );
+
+   blaze::DynamicMatrix<Type,blaze::columnMajor> A( n, n );
+   randomize( A );
+   A = A + trans( A );
+   for( size_t i=0UL; i<n; ++i ) {
+      A(i,i) += Type( 2*n );
+   }
+
+   blaze::DynamicVector<Type,blaze::columnVector> b( n );
+   randomize( b );
+
+   blaze::SolverSettings settings;
+   settings.tolerance = tolerance;
+
+   {
+      test_ = "Jacobi preconditioned CG (dense system)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::JacobiPreconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::cg( A, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab (dense system)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::bicgstab( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "GMRES (dense system)";
+
+      blaze::DynamicVector<Type,blaze::columnVector> x( n, Type(0) );
+      const blaze::SolverResult result( blaze::gmres( A, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the solvers for a user-defined operator.
+//
+// \param k The number of grid points in each dimension of the 2D Poisson problem.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests all solvers for a matrix-free operator, which applies the 2D Poisson
+// stencil. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+template< typename Type >  // Element type of the linear system
+void SolverTest::testOperator( size_t k )
+{
+   using VT = blaze::DynamicVector<Type,blaze::columnVector>;
+
+   const size_t n( k*k );
+   const double tolerance( 1E-10 );
+
+   blaze::CompressedMatrix<Type,blaze::rowMajor> A;
+   initialize( A, k, Type(0) );
+
+   const auto op = [k]( const VT& x, VT& y )
+   {
+      for( size_t i=0UL; i<k; ++i ) {
+         for( size_t j=0UL; j<k; ++j ) {
+            const size_t row( i*k+j );
+            Type tmp( Type(4)*x[row] );
+            if( i > 0UL   ) tmp -= x[row-k];
+            if( i+1UL < k ) tmp -= x[row+k];
+            if( j > 0UL   ) tmp -= x[row-1UL];
+            if( j+1UL < k ) tmp -= x[row+1UL];
+            y[row] = tmp;
+         }
+      }
+   };
+
+   VT b( n );
+   randomize( b );
+
+   blaze::SolverSettings settings;
+   settings.tolerance     = tolerance;
+   settings.maxIterations = 10UL*n;
+
+   {
+      test_ = "CG (user-defined operator)";
+
+      VT x( n, Type(0) );
+      const blaze::SolverResult result( blaze::cg( op, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "BiCGStab (user-defined operator)";
+
+      VT x( n, Type(0) );
+      const blaze::ILU0Preconditioner<Type> P( A );
+      const blaze::SolverResult result( blaze::bicgstab( op, x, b, P, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+
+   {
+      test_ = "GMRES (user-defined operator)";
+
+      VT x( n, Type(0) );
+      const blaze::SolverResult result( blaze::gmres( op, x, b, settings ) );
+      checkResult( A, x, b, result, tolerance );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the setup of the Jacobi and ILU(0) preconditioners. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SolverTest::testPreconditioners()
+{
+   {
+      test_ = "Jacobi preconditioner";
+
+      const blaze::DynamicMatrix<double> A{ { 2.0, 1.0 }, { 1.0, 4.0 } };
+      const blaze::JacobiPreconditioner<double> P( A );
+
+      const blaze::DynamicVector<double> r{ 2.0, 2.0 };
+      blaze::DynamicVector<double> z( 2UL );
+      P.apply( r, z );
+
+      if( z[0] != 1.0 || z[1] != 0.5 ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Application of the preconditioner failed\n"
+             << " Details:\n"
+             << "   Result:\n" << z << "\n"
+             << "   Expected result:\n( 1 0.5 )\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+   {
+      test_ = "ILU(0) preconditioner";
+
+      // For a tridiagonal matrix the ILU(0) factorization coincides with the LU decomposition
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 5UL, 5UL, 13UL );
+      for( size_t i=0UL; i<5UL; ++i ) {
+         if( i > 0UL ) A.append( i, i-1UL, -1.0 );
+         A.append( i, i, 3.0 );
+         if( i < 4UL ) A.append( i, i+1UL, -2.0 );
+         A.finalize( i );
+      }
+
+      const blaze::ILU0Preconditioner<double> P( A );
+
+      const blaze::DynamicVector<double> b{ 1.0, 2.0, 3.0, 4.0, 5.0 };
+      blaze::DynamicVector<double> x( 5UL );
+      P.apply( b, x );
+
+      const blaze::DynamicVector<double> Ax( A * x );
+
+      if( Ax != b ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Application of the preconditioner failed\n"
+             << " Details:\n"
+             << "   Result:\n" << Ax << "\n"
+             << "   Expected result:\n" << b << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the solvers and preconditioners.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that invalid systems and preconditioner setups are reported by means of
+// exceptions. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SolverTest::testExceptions()
+{
+   {
+      test_ = "Non-square system matrix";
+
+      const blaze::DynamicMatrix<double> A( 3UL, 4UL, 1.0 );
+      const blaze::DynamicVector<double> b( 3UL, 1.0 );
+      blaze::DynamicVector<double> x( 3UL, 0.0 );
+
+      try {
+         blaze::cg( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a non-square system succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Mismatching right-hand side";
+
+      const blaze::DynamicMatrix<double> A( 3UL, 3UL, 1.0 );
+      const blaze::DynamicVector<double> b( 4UL, 1.0 );
+      blaze::DynamicVector<double> x( 4UL, 0.0 );
+
+      try {
+         blaze::gmres( A, x, b );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Solving a system with mismatching right-hand side succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Zero diagonal element";
+
+      const blaze::DynamicMatrix<double> A{ { 1.0, 1.0 }, { 1.0, 0.0 } };
+
+      try {
+         const blaze::JacobiPreconditioner<double> P( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of Jacobi preconditioner with zero diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+   {
+      test_ = "Missing diagonal element";
+
+      blaze::CompressedMatrix<double,blaze::rowMajor> A( 2UL, 2UL );
+      A(0,0) = 1.0;
+      A(1,0) = 1.0;
+
+      try {
+         const blaze::ILU0Preconditioner<double> P( A );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Setup of ILU(0) preconditioner with missing diagonal succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the result of a solver.
+//
+// \param A The system matrix.
+// \param x The computed solution.
+// \param b The right-hand side vector.
+// \param result The result information of the solver.
+// \param tolerance The requested relative tolerance.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks that the solver reported convergence and that the relative residual of
+// the computed solution does not exceed the requested tolerance (plus a safety margin for the
+// round-off errors of the residual update). In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+template< typename MT     // Type of the system matrix
+        , typename VT1    // Type of the solution vector
+        , typename VT2 >  // Type of the right-hand side vector
+void SolverTest::checkResult( const MT& A, const VT1& x, const VT2& b,
+                              const blaze::SolverResult& result, double tolerance )
+{
+   const double residual( norm( b - A*x ) / norm( b ) );
+
+   if( !result.converged || residual > 10.0*tolerance ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Solving the linear system failed\n"
+          << " Details:\n"
+          << "   Matrix type:\n"
+          << "     " << typeid( MT ).name() << "\n"
+          << "   System size: " << b.size() << "\n"
+          << "   Converged: " << result.converged << "\n"
+          << "   Iterations: " << result.iterations << "\n"
+          << "   Reported residual: " << result.residual << "\n"
+          << "   Actual residual  : " << residual << "\n"
+          << "   Tolerance        : " << tolerance << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of the given matrix with a 2D convection-diffusion stencil.
+//
+// \param A The matrix to be initialized.
+// \param k The number of grid points in each dimension.
+// \param convection The convection coefficient (0 results in the symmetric 2D Poisson stencil).
+// \return void
+*/
+template< typename Type >  // Element type of the matrix
+void SolverTest::initialize( blaze::CompressedMatrix<Type,blaze::rowMajor>& A, size_t k,
+                             Type convection )
+{
+   const size_t n( k*k );
+
+   A.resize( n, n, false );
+   A.reserve( 5UL*n );
+
+   for( size_t i=0UL; i<k; ++i ) {
+      for( size_t j=0UL; j<k; ++j ) {
+         const size_t row( i*k+j );
+         if( i > 0UL   ) A.append( row, row-k  , Type(-1) );
+         if( j > 0UL   ) A.append( row, row-1UL, Type(-1) - convection );
+         A.append( row, row, Type(4) );
+         if( j+1UL < k ) A.append( row, row+1UL, Type(-1) + convection );
+         if( i+1UL < k ) A.append( row, row+k  , Type(-1) );
+         A.finalize( row );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  GLOBAL TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Testing the iterative solvers.
+//
+// \return void
+*/
+void runTest()
+{
+   SolverTest();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  MACRO DEFINITIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*! \cond BLAZE_INTERNAL */
+/*!\brief Macro for the execution of the iterative solver test.
+*/
+#define RUN_SOLVERS_SOLVER_TEST \
+   blazetest::mathtest::solvers::runTest()
+/*! \endcond */
+//*************************************************************************************************
+
+} // namespace solvers
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+#endif
@@ -46,7 +46,9 @@
 #include <blaze/math/Aliases.h>
 #include <blaze/math/CompressedVector.h>
 #include <blaze/math/constraints/Vector.h>
+#include <blaze/math/CustomVector.h>
 #include <blaze/math/DynamicVector.h>
+#include <blaze/math/serialization/MappedArchive.h>
 #include <blaze/math/StaticVector.h>
 #include <blaze/math/Subvector.h>
 #include <blaze/math/typetraits/IsDenseVector.h>
@@ -92,9 +94,12 @@ class ClassTest
    //**Test functions******************************************************************************
    /*!\name Test functions */
    //@{
-   void testEmptyVectors ();
-   void testRandomVectors();
-   void testFailures     ();
+   void testEmptyVectors   ();
+   void testRandomVectors  ();
+   void testVersion2Archive();
+   void testVersion1Archive();
+   void testMappedArchive  ();
+   void testFailures       ();
 
    template< size_t N, typename VT >
    void runAllTests( const VT& src );
@@ -125,6 +130,15 @@ class ClassTest
 
    template< typename VT1, typename VT2 >
    void compareVectors( const VT1& src, const VT2& dst );
+
+   void checkLayout( const std::string& data, size_t size ) const;
+   //@}
+   //**********************************************************************************************
+
+   //**Utility functions***************************************************************************
+   /*!\name Utility functions */
+   //@{
+   static inline size_t padded( size_t bytes ) noexcept;
    //@}
    //**********************************************************************************************
 
@@ -484,6 +498,57 @@ void ClassTest::compareVectors( const VT1& src, const VT2& dst )
 
 
 
+//*************************************************************************************************
+/*!\brief Checking the layout of a version 2 archive.
+//
+// \param data The content of the archive.
+// \param size The expected size of the archive in bytes.
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function checks the version and the size of the given archive, which is expected to
+// contain a single vector in the version 2 format. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+inline void ClassTest::checkLayout( const std::string& data, size_t size ) const
+{
+   if( data.empty() || data[0] != 2 || data.size() != size || data.size() % 64UL != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid version 2 archive detected\n"
+          << " Details:\n"
+          << "   Version: " << ( data.empty() ? 0 : int( data[0] ) ) << "\n"
+          << "   Size of the archive: " << data.size() << "\n"
+          << "   Expected size: " << size << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the size of a block of the version 2 format including its padding.
+//
+// \param bytes The size of the block in bytes.
+// \return The size of the block padded to the next multiple of 64 bytes.
+*/
+inline size_t ClassTest::padded( size_t bytes ) noexcept
+{
+   return ( bytes + 63UL ) & ~size_t( 63UL );
+}
+//*************************************************************************************************
+
+
+
+
 //=================================================================================================
 //
 //  GLOBAL TEST FUNCTIONS
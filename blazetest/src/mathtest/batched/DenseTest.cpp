@@ -0,0 +1,138 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/batched/DenseTest.cpp
+//  \brief Source file for the batched dense matrix operation test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/util/Complex.h>
+#include <blazetest/mathtest/batched/DenseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace batched {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest batched test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+
+   using cdouble = blaze::complex<double>;
+
+
+   //=====================================================================================
+   // Random matrix tests
+   //=====================================================================================
+
+   for( size_t size : { 1UL, 7UL, 33UL, 100UL, 257UL } )
+   {
+      testRandom< double , 1UL, rowMajor    >( size );
+      testRandom< double , 2UL, rowMajor    >( size );
+      testRandom< double , 3UL, rowMajor    >( size );
+      testRandom< double , 3UL, columnMajor >( size );
+      testRandom< double , 4UL, columnMajor >( size );
+      testRandom< double , 5UL, rowMajor    >( size );
+      testRandom< double , 6UL, columnMajor >( size );
+      testRandom< double , 8UL, rowMajor    >( size );
+      testRandom< cdouble, 3UL, rowMajor    >( size );
+      testRandom< cdouble, 5UL, columnMajor >( size );
+      testRandom< cdouble, 7UL, rowMajor    >( size );
+   }
+
+
+   //=====================================================================================
+   // Singular matrix tests
+   //=====================================================================================
+
+   for( size_t size : { 1UL, 7UL, 33UL, 100UL } )
+   {
+      testSingular< double , 1UL, rowMajor    >( size );
+      testSingular< double , 3UL, columnMajor >( size );
+      testSingular< double , 6UL, rowMajor    >( size );
+      testSingular< double , 8UL, columnMajor >( size );
+      testSingular< cdouble, 5UL, rowMajor    >( size );
+   }
+}
+//*************************************************************************************************
+
+} // namespace batched
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running batched dense matrix operation test..." << std::endl;
+
+   try
+   {
+      RUN_BATCHED_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during batched dense matrix operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -37,8 +37,10 @@
 // Includes
 //*************************************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
 #include <iostream>
+#include <vector>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
 #include <blazetest/mathtest/compressedmatrix/ClassTest.h>
@@ -79,6 +81,7 @@ ClassTest::ClassTest()
    testSet();
    testInsert();
    testAppend();
+   testAssemble();
    testErase();
    testFind();
    testLowerBound();
@@ -4181,6 +4184,183 @@ void ClassTest::testAppend()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Test of the \c assemble() function for the CompressedMatrix class template.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function performs a test of the \c assemble() function for the CompressedMatrix class
+// template. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testAssemble()
+{
+   //=====================================================================================
+   // Row-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Row-major assemble()";
+
+      const std::vector<size_t> rows   { 3UL, 0UL, 2UL, 0UL, 3UL, 0UL };
+      const std::vector<size_t> columns{ 1UL, 3UL, 1UL, 0UL, 1UL, 3UL };
+      const std::vector<int>    values { 4, 3, 1, 2, 5, -1 };
+
+      // Assembly with summation of duplicate triplets
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat( 2UL, 3UL );
+         mat(1,2) = 7;
+
+         assemble( mat, 4UL, 4UL, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 0UL );
+         checkNonZeros( mat, 2UL, 1UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 2 || mat(2,1) != 1 || mat(3,1) != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 2 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 9 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with a custom combine operation
+      {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat;
+
+         assemble( mat, 4UL, 4UL, rows.begin(), columns.begin(), values.begin(), values.size(),
+                   []( int a, int b ){ return std::max( a, b ); } );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 2UL );
+         checkNonZeros( mat, 1UL, 0UL );
+         checkNonZeros( mat, 2UL, 1UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 3 || mat(2,1) != 1 || mat(3,1) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 3 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 5 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with an invalid triplet index
+      try {
+         blaze::CompressedMatrix<int,blaze::rowMajor> mat;
+
+         assemble( mat, 4UL, 3UL, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly with invalid triplet index succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+
+
+   //=====================================================================================
+   // Column-major matrix tests
+   //=====================================================================================
+
+   {
+      test_ = "Column-major assemble()";
+
+      const std::vector<size_t> rows   { 3UL, 0UL, 2UL, 0UL, 3UL, 0UL };
+      const std::vector<size_t> columns{ 1UL, 3UL, 1UL, 0UL, 1UL, 3UL };
+      const std::vector<int>    values { 4, 3, 1, 2, 5, -1 };
+
+      // Assembly with summation of duplicate triplets
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat( 2UL, 3UL );
+         mat(1,2) = 7;
+
+         assemble( mat, 4UL, 4UL, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 2UL );
+         checkNonZeros( mat, 2UL, 0UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 2 || mat(2,1) != 1 || mat(3,1) != 9 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 2 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 9 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with a custom combine operation
+      {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat;
+
+         assemble( mat, 4UL, 4UL, rows.begin(), columns.begin(), values.begin(), values.size(),
+                   []( int a, int b ){ return std::max( a, b ); } );
+
+         checkRows    ( mat, 4UL );
+         checkColumns ( mat, 4UL );
+         checkCapacity( mat, 4UL );
+         checkNonZeros( mat, 4UL );
+         checkNonZeros( mat, 0UL, 1UL );
+         checkNonZeros( mat, 1UL, 2UL );
+         checkNonZeros( mat, 2UL, 0UL );
+         checkNonZeros( mat, 3UL, 1UL );
+
+         if( mat(0,0) != 2 || mat(0,3) != 3 || mat(2,1) != 1 || mat(3,1) != 5 ) {
+            std::ostringstream oss;
+            oss << " Test: " << test_ << "\n"
+                << " Error: Assembly failed\n"
+                << " Details:\n"
+                << "   Result:\n" << mat << "\n"
+                << "   Expected result:\n( 2 0 0 3 )\n( 0 0 0 0 )\n( 0 1 0 0 )\n( 0 5 0 0 )\n";
+            throw std::runtime_error( oss.str() );
+         }
+      }
+
+      // Assembly with an invalid triplet index
+      try {
+         blaze::CompressedMatrix<int,blaze::columnMajor> mat;
+
+         assemble( mat, 4UL, 3UL, rows.begin(), columns.begin(), values.begin(), values.size() );
+
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Assembly with invalid triplet index succeeded\n"
+             << " Details:\n"
+             << "   Result:\n" << mat << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+      catch( std::invalid_argument& ) {}
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of the \c erase() member function of the CompressedMatrix class template.
 //
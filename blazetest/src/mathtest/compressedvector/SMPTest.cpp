@@ -0,0 +1,159 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/compressedvector/SMPTest.cpp
+//  \brief Source file for the CompressedVector SMP assignment test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#undef NDEBUG
+#define BLAZE_USE_DEBUG_MODE 1
+
+#include <cstdlib>
+#include <iostream>
+#include <blaze/math/smp/Functions.h>
+#include <blazetest/mathtest/compressedvector/SMPTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace compressedvector {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the CompressedVector SMP assignment test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SMPTest::SMPTest()
+{
+#if !BLAZE_HPX_PARALLEL_MODE
+   blaze::setNumThreads( 4UL );
+#endif
+
+   testAssign<blaze::columnVector>();
+   testAssign<blaze::rowVector>();
+   testAddAssign<blaze::columnVector>();
+   testAddAssign<blaze::rowVector>();
+   testSubAssign<blaze::columnVector>();
+   testSubAssign<blaze::rowVector>();
+   testMultiplication();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!rief Test of the parallel sparse matrix/sparse vector multiplication.
+//
+// 
+eturn void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel assignment of a sparse matrix/sparse vector multiplication
+// to a compressed vector. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void SMPTest::testMultiplication()
+{
+   test_ = "CompressedVector sparse matrix/sparse vector multiplication";
+
+   const size_t m( blaze::SMP_SMATSVECMULT_THRESHOLD + 37UL );
+   const size_t n( 23UL );
+
+   blaze::DynamicMatrix<int,blaze::rowMajor> D( m, n, 0 );
+   for( size_t i=0UL; i<m; ++i ) {
+      row( D, i ) = trans( random<blaze::columnVector>( n ) );
+   }
+
+   const blaze::CompressedMatrix<int,blaze::rowMajor> A( D );
+   const blaze::DynamicVector<int,blaze::columnVector> d( random<blaze::columnVector>( n ) );
+   const blaze::CompressedVector<int,blaze::columnVector> x( d );
+
+   blaze::CompressedVector<int,blaze::columnVector> c;
+   c = A * x;
+
+   const blaze::DynamicVector<int,blaze::columnVector> ref( D * d );
+
+   checkResult( c, ref );
+}
+//*************************************************************************************************
+
+} // namespace compressedvector
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running CompressedVector SMP assignment test..." << std::endl;
+
+   try
+   {
+      RUN_COMPRESSEDVECTOR_SMP_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during CompressedVector SMP assignment test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,207 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dvecdvecinner/SMPTest.cpp
+//  \brief Source file for the dense vector/dense vector SMP inner product test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#undef NDEBUG
+#define BLAZE_USE_DEBUG_MODE 1
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dvecdvecinner/SMPTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecdvecinner {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the dense vector/dense vector SMP inner product test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SMPTest::SMPTest()
+{
+   testInner();
+   testExpressions();
+   testComplex();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of two dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel inner product of two dense vectors of floating point and
+// integral values. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testInner()
+{
+   const size_t n( blaze::SMP_DVECDVECINNER_THRESHOLD * 8UL + 13UL );
+
+   {
+      test_ = "Inner product of floating point vectors";
+
+      const blaze::DynamicVector<double> a( random( n, -8, 8 ) );
+      const blaze::DynamicVector<double> b( random( n, -4, 4 ) );
+
+      checkProduct( a, b, []( const auto& x, const auto& y ) { return inner( x, y ); } );
+      checkProduct( a, b, []( const auto& x, const auto& y ) { return trans( x ) * y; } );
+      checkProduct( a, b, []( const auto& x, const auto& y ) { return dot( x, y ); } );
+   }
+
+   {
+      test_ = "Inner product of integral vectors";
+
+      blaze::DynamicVector<int> a( n ), b( n );
+      randomize( a, -10, 10 );
+      randomize( b, -10, 10 );
+
+      checkProduct( a, b, []( const auto& x, const auto& y ) { return inner( x, y ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of dense vector expressions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel inner product of dense vector expressions and views, which
+// are evaluated prior to the parallel reduction. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testExpressions()
+{
+   test_ = "Inner product of dense vector expressions";
+
+   const size_t n( blaze::SMP_DVECDVECINNER_THRESHOLD * 8UL + 13UL );
+
+   const blaze::DynamicVector<double> a( random( n+7UL, -8, 8 ) );
+   const blaze::DynamicVector<double> b( random( n, -4, 4 ) );
+   const blaze::DynamicVector<double> c( random( n, -4, 4 ) );
+
+   checkProduct( a, b, [&c]( const auto& x, const auto& y ) {
+      return inner( subvector( x, 7UL, y.size() ), y + c );
+   } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel inner product of complex dense vectors.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel inner product of two dense vectors of complex values. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testComplex()
+{
+   test_ = "Inner product of complex vectors";
+
+   const size_t n( blaze::SMP_DVECDVECINNER_THRESHOLD * 8UL + 13UL );
+
+   const blaze::DynamicVector<double> re( random( n, -8, 8 ) );
+   const blaze::DynamicVector<double> im( random( n, -8, 8 ) );
+
+   blaze::DynamicVector< std::complex<double> > a( n );
+   blaze::DynamicVector< std::complex<double> > b( random( n, -4, 4 ) );
+
+   for( size_t i=0UL; i<n; ++i ) {
+      a[i] = std::complex<double>( re[i], im[i] );
+   }
+
+   checkProduct( a, b, []( const auto& x, const auto& y ) { return inner( x, y ); } );
+}
+//*************************************************************************************************
+
+} // namespace dvecdvecinner
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense vector/dense vector SMP inner product test..." << std::endl;
+
+   try
+   {
+      RUN_DVECDVECINNER_SMP_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense vector/dense vector SMP inner product test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -0,0 +1,226 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/dvecreduce/SMPTest.cpp
+//  \brief Source file for the dense vector SMP reduction test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#undef NDEBUG
+#define BLAZE_USE_DEBUG_MODE 1
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/dvecreduce/SMPTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace dvecreduce {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the dense vector SMP reduction test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+SMPTest::SMPTest()
+{
+   testSum();
+   testProd();
+   testMinMax();
+   testReduce();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the parallel sum() operation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel sum() operation for vectors of floating point and integral
+// values. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testSum()
+{
+   const size_t n( blaze::SMP_DVECREDUCE_THRESHOLD * 8UL + 13UL );
+
+   {
+      test_ = "sum() of a floating point vector";
+
+      const blaze::DynamicVector<double> vec( random( n, -8, 8 ) );
+
+      checkReduction( vec, []( const auto& v ) { return sum( v ); } );
+   }
+
+   {
+      test_ = "sum() of an integral vector";
+
+      blaze::DynamicVector<int> vec( n );
+      randomize( vec, -100, 100 );
+
+      checkReduction( vec, []( const auto& v ) { return sum( v ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel prod() operation.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel prod() operation for a vector of floating point values. In
+// case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testProd()
+{
+   test_ = "prod() of a floating point vector";
+
+   const size_t n( blaze::SMP_DVECREDUCE_THRESHOLD * 8UL + 13UL );
+
+   const blaze::DynamicVector<double> vec( random( n, 0, 0 ) );
+
+   checkReduction( vec, []( const auto& v ) { return prod( v ); } );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel min() and max() operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel min() and max() operations, including vectors whose extremal
+// value is located in the first, the last, or an intermediate partition. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testMinMax()
+{
+   const size_t n( blaze::SMP_DVECREDUCE_THRESHOLD * 8UL + 13UL );
+
+   for( size_t pos : { size_t(0UL), n/3UL, n-1UL } )
+   {
+      blaze::DynamicVector<double> vec( random( n, -4, 4 ) );
+      vec[pos] = -1.0;
+
+      test_ = "min() of a floating point vector";
+      checkReduction( vec, []( const auto& v ) { return min( v ); } );
+
+      vec[pos] = 1E6;
+
+      test_ = "max() of a floating point vector";
+      checkReduction( vec, []( const auto& v ) { return max( v ); } );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the parallel reduce() operation with custom operations.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the parallel reduce() operation with a predefined and a custom reduction
+// operation. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void SMPTest::testReduce()
+{
+   const size_t n( blaze::SMP_DVECREDUCE_THRESHOLD * 8UL + 13UL );
+
+   const blaze::DynamicVector<double> vec( random( n, -8, 8 ) );
+
+   test_ = "reduce() with the Add operation";
+   checkReduction( vec, []( const auto& v ) { return reduce( v, blaze::Add() ); } );
+
+   test_ = "reduce() with a custom operation";
+   checkReduction( vec, []( const auto& v ) {
+      return reduce( v, []( double a, double b ) { return a + b; } );
+   } );
+}
+//*************************************************************************************************
+
+} // namespace dvecreduce
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running dense vector SMP reduction test..." << std::endl;
+
+   try
+   {
+      RUN_DVECREDUCE_SMP_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during dense vector SMP reduction test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
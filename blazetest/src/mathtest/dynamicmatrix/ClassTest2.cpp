@@ -5349,6 +5349,32 @@ void ClassTest::testTranspose()
       }
    }
 
+   {
+      test_ = "Row-major self-transpose of a large rectangular matrix (stress test)";
+
+      const size_t m( 16UL*blaze::rand<size_t>( 30UL, 40UL ) );
+      const size_t n( 16UL*blaze::rand<size_t>( 41UL, 50UL ) );
+
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat1( m, n, 0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<int,blaze::rowMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Rows of the original matrix   : " << m << "\n"
+             << "   Columns of the original matrix: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
 
    //=====================================================================================
    // Column-major matrix tests
@@ -5511,6 +5537,32 @@ void ClassTest::testTranspose()
          throw std::runtime_error( oss.str() );
       }
    }
+
+   {
+      test_ = "Column-major self-transpose of a large rectangular matrix (stress test)";
+
+      const size_t m( 16UL*blaze::rand<size_t>( 30UL, 40UL ) );
+      const size_t n( 16UL*blaze::rand<size_t>( 41UL, 50UL ) );
+
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat1( m, n, 0 );
+      randomize( mat1 );
+      blaze::DynamicMatrix<int,blaze::columnMajor> mat2( mat1 );
+
+      transpose( mat1 );
+
+      checkRows   ( mat1, n );
+      checkColumns( mat1, m );
+
+      if( mat1 != trans( mat2 ) ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Transpose operation failed\n"
+             << " Details:\n"
+             << "   Rows of the original matrix   : " << m << "\n"
+             << "   Columns of the original matrix: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
 }
 //*************************************************************************************************
 
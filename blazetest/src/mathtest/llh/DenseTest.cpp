@@ -76,6 +76,7 @@ DenseTest::DenseTest()
    testUpper();
    testUniUpper();
    testDiagonal();
+   testNative();
 }
 //*************************************************************************************************
 
@@ -295,6 +296,27 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the native Cholesky decomposition functionality.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native, blocked Cholesky decomposition kernels for matrices that are large
+// enough to be decomposed in several blocks. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void DenseTest::testNative()
+{
+   testBlocked< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testBlocked< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+
+   testBlocked< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testBlocked< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
 } // namespace llh
 
 } // namespace mathtest
@@ -38,6 +38,7 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <blaze/math/DynamicVector.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
@@ -45,6 +46,7 @@
 #include <blaze/math/StaticVector.h>
 #include <blaze/util/Complex.h>
 #include <blazetest/mathtest/matrixserializer/ClassTest.h>
+#include <blazetest/mathtest/TemporaryFile.h>
 
 
 namespace blazetest {
@@ -68,6 +70,8 @@ ClassTest::ClassTest()
 {
    testEmptyMatrices();
    testRandomMatrices();
+   testVersion1Archive();
+   testMappedArchive();
    testFailures();
 }
 //*************************************************************************************************
@@ -317,6 +321,106 @@ void ClassTest::testRandomMatrices()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Deserialization test with an archive in the version 1 format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of a sparse matrix from an archive in the version 1
+// format, in which all non-zero elements are written element by element. In case an error is
+// detected, i.e. in case the matrix cannot be reconstituted, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testVersion1Archive()
+{
+   test_ = "Version 1 archive";
+
+   blaze::CompressedMatrix<int,blaze::rowMajor> src( 3UL, 4UL );
+   src(0,1) =  1;
+   src(0,3) = -2;
+   src(2,0) =  3;
+
+   std::stringstream stream;
+
+   {
+      blaze::Archive<std::stringstream> archive( stream );
+
+      archive << uint8_t( 1U ) << uint8_t( 3U )
+              << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof( int ) )
+              << uint64_t( 3UL ) << uint64_t( 4UL ) << uint64_t( 3UL );
+
+      for( size_t i=0UL; i<src.rows(); ++i ) {
+         archive << uint64_t( src.nonZeros( i ) );
+         for( auto element=src.begin(i); element!=src.end(i); ++element ) {
+            archive << element->index() << element->value();
+         }
+      }
+   }
+
+   {
+      blaze::Archive<std::stringstream> archive( stream );
+      blaze::CompressedMatrix<int,blaze::columnMajor> dst;
+
+      archive >> dst;
+
+      compareMatrices( src, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy deserialization via a memory mapped archive.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reconstitution of dense and sparse matrices from a memory mapped
+// archive. In case an error is detected, i.e. in case a matrix cannot be reconstituted from
+// file, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMappedArchive()
+{
+   test_ = "Memory mapped archive";
+
+   const blazetest::TemporaryFile file( "matrixserializer_mapped.blaze" );
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> dense( 7UL, 13UL );
+   blaze::CompressedMatrix<blaze::complex<float>,blaze::columnMajor> sparse( 13UL, 7UL );
+
+   randomize( dense );
+   randomize( sparse, 30UL );
+
+   {
+      blaze::Archive<std::ofstream> archive( file.name(), std::ofstream::trunc );
+      archive << dense << sparse;
+   }
+
+   {
+      blaze::MappedArchive archive( file.name() );
+
+      blaze::CustomMatrix<const double,blaze::unaligned,blaze::unpadded,blaze::rowMajor> dst1;
+      blaze::MappedCompressedMatrix<blaze::complex<float>,blaze::columnMajor> dst2;
+
+      archive >> dst1 >> dst2;
+
+      compareMatrices( dense , dst1 );
+      compareMatrices( sparse, dst2 );
+
+      if( !isIntact( dst2 ) || !archive.eof() ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid memory mapped matrix\n"
+             << " Details:\n"
+             << "   Matrix:\n" << dst2 << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
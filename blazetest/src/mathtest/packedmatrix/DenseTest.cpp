@@ -0,0 +1,160 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/packedmatrix/DenseTest.cpp
+//  \brief Source file for the packed matrix test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/packedmatrix/DenseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace packedmatrix {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the DenseTest packed matrix test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+DenseTest::DenseTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::DynamicMatrix;
+   using blaze::PackedMatrix;
+   using blaze::SymmetricMatrix;
+   using blaze::HermitianMatrix;
+   using blaze::LowerMatrix;
+   using blaze::UpperMatrix;
+
+   using cdouble = blaze::complex<double>;
+
+
+   for( size_t n : { 0UL, 1UL, 2UL, 7UL, 16UL, 33UL } )
+   {
+      //=====================================================================================
+      // Symmetric matrices
+      //=====================================================================================
+
+      testMatrix< SymmetricMatrix< PackedMatrix<double,rowMajor> >
+                , SymmetricMatrix< DynamicMatrix<double,rowMajor> > >( n );
+      testMatrix< SymmetricMatrix< PackedMatrix<double,columnMajor> >
+                , SymmetricMatrix< DynamicMatrix<double,columnMajor> > >( n );
+      testMatrix< SymmetricMatrix< PackedMatrix<cdouble,rowMajor> >
+                , SymmetricMatrix< DynamicMatrix<cdouble,rowMajor> > >( n );
+
+
+      //=====================================================================================
+      // Hermitian matrices
+      //=====================================================================================
+
+      testMatrix< HermitianMatrix< PackedMatrix<double,rowMajor> >
+                , HermitianMatrix< DynamicMatrix<double,rowMajor> > >( n );
+      testMatrix< HermitianMatrix< PackedMatrix<cdouble,rowMajor> >
+                , HermitianMatrix< DynamicMatrix<cdouble,rowMajor> > >( n );
+      testMatrix< HermitianMatrix< PackedMatrix<cdouble,columnMajor> >
+                , HermitianMatrix< DynamicMatrix<cdouble,columnMajor> > >( n );
+
+
+      //=====================================================================================
+      // Lower matrices
+      //=====================================================================================
+
+      testMatrix< LowerMatrix< PackedMatrix<double,rowMajor> >
+                , LowerMatrix< DynamicMatrix<double,rowMajor> > >( n );
+      testMatrix< LowerMatrix< PackedMatrix<double,columnMajor> >
+                , LowerMatrix< DynamicMatrix<double,columnMajor> > >( n );
+      testMatrix< LowerMatrix< PackedMatrix<cdouble,rowMajor> >
+                , LowerMatrix< DynamicMatrix<cdouble,rowMajor> > >( n );
+
+
+      //=====================================================================================
+      // Upper matrices
+      //=====================================================================================
+
+      testMatrix< UpperMatrix< PackedMatrix<double,rowMajor> >
+                , UpperMatrix< DynamicMatrix<double,rowMajor> > >( n );
+      testMatrix< UpperMatrix< PackedMatrix<double,columnMajor> >
+                , UpperMatrix< DynamicMatrix<double,columnMajor> > >( n );
+      testMatrix< UpperMatrix< PackedMatrix<cdouble,columnMajor> >
+                , UpperMatrix< DynamicMatrix<cdouble,columnMajor> > >( n );
+   }
+}
+//*************************************************************************************************
+
+} // namespace packedmatrix
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running packed matrix test..." << std::endl;
+
+   try
+   {
+      RUN_PACKEDMATRIX_DENSE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during packed matrix test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
@@ -77,6 +77,7 @@ DenseTest::DenseTest()
    testUpper();
    testUniUpper();
    testDiagonal();
+   testNative();
 }
 //*************************************************************************************************
 
@@ -296,6 +297,27 @@ void DenseTest::testDiagonal()
 }
 //*************************************************************************************************
 
+
+//*************************************************************************************************
+/*!\brief Test of the native QR decomposition functionality.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the native, blocked QR decomposition kernels for matrices that are large
+// enough to be decomposed in several blocks. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void DenseTest::testNative()
+{
+   testBlocked< blaze::DynamicMatrix<double,blaze::rowMajor   > >();
+   testBlocked< blaze::DynamicMatrix<double,blaze::columnMajor> >();
+
+   testBlocked< blaze::DynamicMatrix<cdouble,blaze::rowMajor   > >();
+   testBlocked< blaze::DynamicMatrix<cdouble,blaze::columnMajor> >();
+}
+//*************************************************************************************************
+
 } // namespace qr
 
 } // namespace mathtest
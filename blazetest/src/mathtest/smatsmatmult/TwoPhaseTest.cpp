@@ -0,0 +1,335 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smatsmatmult/TwoPhaseTest.cpp
+//  \brief Source file for the sparse matrix/sparse matrix multiplication two-phase test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/smatsmatmult/TwoPhaseTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smatsmatmult {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the two-phase test class.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+TwoPhaseTest::TwoPhaseTest()
+   : sA3x4_ ( 3UL, 4UL )
+   , sB4x3_ ( 4UL, 3UL )
+   , tsA3x4_( 3UL, 4UL )
+   , tsB4x3_( 4UL, 3UL )
+{
+   testMultiplication<blaze::denseAccumulator   >( "dense accumulator"    );
+   testMultiplication<blaze::hashAccumulator    >( "hash accumulator"     );
+   testMultiplication<blaze::sortAccumulator    >( "sort accumulator"     );
+   testMultiplication<blaze::adaptiveAccumulator>( "adaptive accumulator" );
+   testPatternReuse();
+   testAliasing();
+   testErrors();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the reuse of a precomputed sparsity pattern.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the repeated refill of a sparsity pattern computed by symbolicMult()
+// via numericMult() after the values of the operands have changed. In case an error is
+// detected, a \a std::runtime_error exception is thrown.
+*/
+void TwoPhaseTest::testPatternReuse()
+{
+   test_ = "Two-phase multiplication - Pattern reuse";
+
+   initialize();
+
+   SMat C;
+   blaze::symbolicMult( C, sA3x4_, tsB4x3_ );
+
+   for( int factor=1; factor<4; ++factor )
+   {
+      sA3x4_  *= factor;
+      tsB4x3_ *= -factor;
+
+      blaze::numericMult( C, sA3x4_, tsB4x3_ );
+
+      const SMat result( sA3x4_ * tsB4x3_ );
+      checkResult( C, result );
+      checkNonZeros( C, result.nonZeros() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the two-phase multiplication in the presence of aliasing.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the symbolic and numeric phase in case the target matrix is also one
+// of the operands. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void TwoPhaseTest::testAliasing()
+{
+   // Assignment to left-hand side operand
+   {
+      test_ = "Two-phase multiplication - Assignment to left-hand side operand";
+
+      initialize();
+
+      const SMat result( sA3x4_ * sB4x3_ );
+      const SMat A( sA3x4_ );
+
+      blaze::symbolicMult( sA3x4_, sA3x4_, sB4x3_ );
+      blaze::numericMult( sA3x4_, A, sB4x3_ );
+
+      checkResult( sA3x4_, result );
+   }
+
+   // Assignment to right-hand side operand
+   {
+      test_ = "Two-phase multiplication - Assignment to right-hand side operand";
+
+      initialize();
+
+      const TSMat result( tsA3x4_ * tsB4x3_ );
+      const TSMat B( tsB4x3_ );
+
+      blaze::symbolicMult( tsB4x3_, tsA3x4_, tsB4x3_ );
+      blaze::numericMult( tsB4x3_, tsA3x4_, B );
+
+      checkResult( tsB4x3_, result );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the error handling of the two-phase multiplication.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that both phases of the multiplication reject operands with mismatching
+// sizes and that the numeric phase rejects a target matrix whose sparsity pattern does not
+// match the matrix product. In case an error is detected, a \a std::runtime_error exception
+// is thrown.
+*/
+void TwoPhaseTest::testErrors()
+{
+   // Symbolic phase with non-matching operands
+   try {
+      test_ = "Two-phase multiplication - Symbolic phase with non-matching operands";
+
+      initialize();
+
+      SMat C;
+      blaze::symbolicMult( C, sA3x4_, sA3x4_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Multiplication of non-matching matrices succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Numeric phase with non-matching target matrix
+   try {
+      test_ = "Two-phase multiplication - Numeric phase with non-matching target matrix";
+
+      initialize();
+
+      SMat C( 4UL, 4UL );
+      blaze::numericMult( C, sA3x4_, sB4x3_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Refill of a non-matching target matrix succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+
+   // Numeric phase with non-matching sparsity pattern
+   try {
+      test_ = "Two-phase multiplication - Numeric phase with non-matching sparsity pattern";
+
+      initialize();
+
+      SMat C( 3UL, 3UL );
+      blaze::numericMult( C, sA3x4_, sB4x3_ );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Refill of a non-matching sparsity pattern succeeded\n"
+          << " Details:\n"
+          << "   Result:\n" << C << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Initialization of all member matrices.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function initializes all member matrices to specific predetermined values.
+*/
+void TwoPhaseTest::initialize()
+{
+   // Initializing the first row-major sparse matrix
+   sA3x4_.resize( 3UL, 4UL, false );
+   sA3x4_.reset();
+   sA3x4_(0,0) = -1;
+   sA3x4_(0,2) = -2;
+   sA3x4_(1,1) =  2;
+   sA3x4_(1,2) = -3;
+   sA3x4_(1,3) =  1;
+   sA3x4_(2,1) =  1;
+   sA3x4_(2,2) =  2;
+   sA3x4_(2,3) =  2;
+
+   // Initializing the second row-major sparse matrix
+   sB4x3_.resize( 4UL, 3UL, false );
+   sB4x3_.reset();
+   sB4x3_(0,0) =  1;
+   sB4x3_(0,2) = -3;
+   sB4x3_(1,1) = -1;
+   sB4x3_(2,1) =  2;
+   sB4x3_(2,2) =  1;
+   sB4x3_(3,0) =  2;
+   sB4x3_(3,1) =  1;
+   sB4x3_(3,2) = -2;
+
+   // Initializing the first column-major sparse matrix
+   tsA3x4_.resize( 3UL, 4UL, false );
+   tsA3x4_.reset();
+   tsA3x4_(0,0) = -1;
+   tsA3x4_(0,2) = -2;
+   tsA3x4_(1,1) =  2;
+   tsA3x4_(1,2) = -3;
+   tsA3x4_(1,3) =  1;
+   tsA3x4_(2,1) =  1;
+   tsA3x4_(2,2) =  2;
+   tsA3x4_(2,3) =  2;
+
+   // Initializing the second column-major sparse matrix
+   tsB4x3_.resize( 4UL, 3UL, false );
+   tsB4x3_.reset();
+   tsB4x3_(0,0) =  1;
+   tsB4x3_(0,2) = -3;
+   tsB4x3_(1,1) = -1;
+   tsB4x3_(2,1) =  2;
+   tsB4x3_(2,2) =  1;
+   tsB4x3_(3,0) =  2;
+   tsB4x3_(3,1) =  1;
+   tsB4x3_(3,2) = -2;
+}
+//*************************************************************************************************
+
+} // namespace smatsmatmult
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running two-phase test..." << std::endl;
+
+   try
+   {
+      RUN_SMATSMATMULT_TWOPHASE_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during two-phase test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
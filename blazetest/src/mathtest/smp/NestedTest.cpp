@@ -0,0 +1,384 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/smp/NestedTest.cpp
+//  \brief Source file for the nested SMP operation test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#undef NDEBUG
+#define BLAZE_INTERNAL_ASSERTION 1
+#define BLAZE_USE_DEBUG_MODE 1
+
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <thread>
+#include <blaze/math/smp/Functions.h>
+#include <blazetest/mathtest/smp/NestedTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace smp {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the NestedTest SMP test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+NestedTest::NestedTest()
+{
+#if !BLAZE_HPX_PARALLEL_MODE
+   blaze::setNumThreads( 4UL );
+#endif
+
+   testAssign();
+   testFor();
+   testReduce();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of parallel and nested dense vector and matrix assignments.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests dense vector and matrix assignments exceeding the SMP thresholds, both
+// on their own and within the tasks of a parallel loop. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void NestedTest::testAssign()
+{
+   //=====================================================================================
+   // Parallel dense vector assignment
+   //=====================================================================================
+
+   {
+      test_ = "Parallel dense vector assignment";
+
+      const size_t n( blaze::SMP_DVECDVECADD_THRESHOLD + 17UL );
+
+      blaze::DynamicVector<int> a( n ), b( n ), c;
+      for( size_t i=0UL; i<n; ++i ) {
+         a[i] = int( i );
+         b[i] = int( 2UL*i );
+      }
+
+      c = a + b;
+
+      size_t errors( 0UL );
+      for( size_t i=0UL; i<n; ++i ) {
+         if( c[i] != int( 3UL*i ) ) ++errors;
+      }
+
+      checkErrors( errors, "Invalid result of the parallel dense vector addition" );
+   }
+
+
+   //=====================================================================================
+   // Parallel dense matrix assignment
+   //=====================================================================================
+
+   {
+      test_ = "Parallel dense matrix assignment";
+
+      const size_t m( 16UL );
+      const size_t n( blaze::SMP_DMATDMATADD_THRESHOLD / m + 5UL );
+
+      blaze::DynamicMatrix<int> A( m, n ), B( m, n ), C;
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            A(i,j) = int( i*n + j );
+            B(i,j) = int( 2UL*( i*n + j ) );
+         }
+      }
+
+      C = A + B;
+
+      size_t errors( 0UL );
+      for( size_t i=0UL; i<m; ++i ) {
+         for( size_t j=0UL; j<n; ++j ) {
+            if( C(i,j) != int( 3UL*( i*n + j ) ) ) ++errors;
+         }
+      }
+
+      checkErrors( errors, "Invalid result of the parallel dense matrix addition" );
+   }
+
+
+   //=====================================================================================
+   // Nested dense vector assignments
+   //=====================================================================================
+
+   {
+      test_ = "Nested dense vector assignments";
+
+      const size_t n( blaze::SMP_DVECDVECADD_THRESHOLD + 17UL );
+
+      std::atomic<size_t> errors( 0UL );
+
+      blaze::smpFor( 8UL, [&]( size_t task )
+      {
+         checkTask( errors );
+
+         blaze::DynamicVector<int> a( n, int( task ) ), b( n, 1 ), c;
+
+         c = a + b;
+
+         for( size_t i=0UL; i<n; ++i ) {
+            if( c[i] != int( task+1UL ) ) ++errors;
+         }
+      } );
+
+      checkErrors( errors, "Invalid result of the nested dense vector additions" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested parallel loops.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests parallel loops within the tasks of a parallel loop. All nested loops
+// have to be executed serially in ascending order by the thread executing the enclosing task.
+// In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void NestedTest::testFor()
+{
+   test_ = "Nested parallel loops";
+
+   std::atomic<size_t> errors( 0UL );
+
+   blaze::smpFor( 8UL, [&]( size_t )
+   {
+      // Giving the worker threads the chance to pick up the remaining tasks
+      std::this_thread::sleep_for( std::chrono::milliseconds( 1 ) );
+
+      checkTask( errors );
+
+      const std::thread::id id( std::this_thread::get_id() );
+      size_t next( 0UL );
+
+      blaze::smpFor( 16UL, [&]( size_t i )
+      {
+         if( std::this_thread::get_id() != id || i != next ) ++errors;
+         ++next;
+      } );
+
+      if( next != 16UL ) ++errors;
+   } );
+
+   checkErrors( errors, "Nested loop not executed serially by the enclosing task" );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of nested parallel reductions.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests parallel reductions within the tasks of a parallel loop and within the
+// kernel of a parallel reduction. All nested reductions have to be executed serially by the
+// thread executing the enclosing task. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void NestedTest::testReduce()
+{
+   //=====================================================================================
+   // Reductions within a parallel loop
+   //=====================================================================================
+
+   {
+      test_ = "Nested reductions within a parallel loop";
+
+      std::atomic<size_t> errors( 0UL );
+
+      blaze::smpFor( 8UL, [&]( size_t )
+      {
+         checkTask( errors );
+
+         const std::thread::id id( std::this_thread::get_id() );
+
+         const size_t sum = blaze::smpReduce( 1000UL, 1UL, [&]( size_t index, size_t n )
+         {
+            if( std::this_thread::get_id() != id ) ++errors;
+
+            size_t partial( 0UL );
+            for( size_t i=index; i<index+n; ++i )
+               partial += i;
+            return partial;
+         }, std::plus<size_t>() );
+
+         if( sum != 499500UL ) ++errors;
+      } );
+
+      checkErrors( errors, "Nested reduction not executed serially by the enclosing task" );
+   }
+
+
+   //=====================================================================================
+   // Reductions within a parallel reduction
+   //=====================================================================================
+
+   {
+      test_ = "Nested reductions within a parallel reduction";
+
+      std::atomic<size_t> errors( 0UL );
+
+      const size_t sum = blaze::smpReduce( 64UL, 1UL, [&]( size_t index, size_t n )
+      {
+         checkTask( errors );
+
+         const std::thread::id id( std::this_thread::get_id() );
+
+         size_t partial( 0UL );
+         for( size_t i=index; i<index+n; ++i ) {
+            partial += blaze::smpReduce( i+1UL, 1UL, [&]( size_t, size_t count )
+            {
+               if( std::this_thread::get_id() != id ) ++errors;
+               return count;
+            }, std::plus<size_t>() );
+         }
+         return partial;
+      }, std::plus<size_t>() );
+
+      if( sum != 2080UL ) ++errors;
+
+      checkErrors( errors, "Nested reduction not executed serially by the enclosing task" );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking that the calling task is executed within a parallel section.
+//
+// \param errors The error counter of the current test.
+// \return void
+//
+// In case the active SMP backend executes its tasks within parallel sections and the calling
+// task is executed outside a parallel section, the given error counter is incremented.
+*/
+void NestedTest::checkTask( std::atomic<size_t>& errors ) const
+{
+#if BLAZE_OPENMP_PARALLEL_MODE || BLAZE_CPP_THREADS_PARALLEL_MODE || BLAZE_BOOST_THREADS_PARALLEL_MODE
+   const bool active( blaze::isParallelSectionActive() );
+#else
+   const bool active( true );
+#endif
+
+   if( !active ) ++errors;
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Checking the number of errors detected by the current test.
+//
+// \param errors The number of detected errors.
+// \param error The error message in case errors have been detected.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void NestedTest::checkErrors( size_t errors, const std::string& error ) const
+{
+   if( errors != 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: " << error << "\n"
+          << " Details:\n"
+          << "   Number of errors: " << errors << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace smp
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running nested SMP operation test..." << std::endl;
+
+   try
+   {
+      RUN_SMP_NESTED_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during nested SMP operation test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
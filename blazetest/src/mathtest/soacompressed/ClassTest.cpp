@@ -0,0 +1,152 @@
+//=================================================================================================
+/*!
+//  \file src/mathtest/soacompressed/ClassTest.cpp
+//  \brief Source file for the structure-of-arrays compressed matrix and vector test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  This file is part of the Blaze library. You can redistribute it and/or modify it under
+//  the terms of the New (Revised) BSD License. Redistribution and use in source and binary
+//  forms, with or without modification, are permitted provided that the following conditions
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <cstdlib>
+#include <iostream>
+#include <blazetest/mathtest/soacompressed/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace mathtest {
+
+namespace soacompressed {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ClassTest structure-of-arrays compressed test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   using blaze::rowMajor;
+   using blaze::columnMajor;
+   using blaze::columnVector;
+   using blaze::rowVector;
+   using blaze::CompressedMatrix;
+   using blaze::CompressedVector;
+   using blaze::SoACompressedMatrix;
+   using blaze::SoACompressedVector;
+
+
+   for( size_t m : { 0UL, 1UL, 3UL, 17UL, 40UL } ) {
+      for( size_t n : { 0UL, 1UL, 5UL, 33UL } )
+      {
+         //=====================================================================================
+         // Row-major matrices
+         //=====================================================================================
+
+         testMatrix< SoACompressedMatrix<double,rowMajor,uint32_t>
+                   , CompressedMatrix<double,rowMajor> >( m, n );
+         testMatrix< SoACompressedMatrix<float,rowMajor,uint32_t>
+                   , CompressedMatrix<float,rowMajor> >( m, n );
+         testMatrix< SoACompressedMatrix<double,rowMajor,uint64_t>
+                   , CompressedMatrix<double,rowMajor> >( m, n );
+         testMatrix< SoACompressedMatrix<int,rowMajor,uint32_t>
+                   , CompressedMatrix<int,rowMajor> >( m, n );
+
+
+         //=====================================================================================
+         // Column-major matrices
+         //=====================================================================================
+
+         testMatrix< SoACompressedMatrix<double,columnMajor,uint32_t>
+                   , CompressedMatrix<double,columnMajor> >( m, n );
+         testMatrix< SoACompressedMatrix<float,columnMajor,uint64_t>
+                   , CompressedMatrix<float,columnMajor> >( m, n );
+      }
+   }
+
+   for( size_t n : { 0UL, 1UL, 7UL, 64UL } )
+   {
+      //=====================================================================================
+      // Vectors
+      //=====================================================================================
+
+      testVector< SoACompressedVector<double,columnVector,uint32_t>
+                , CompressedVector<double,columnVector> >( n );
+      testVector< SoACompressedVector<float,rowVector,uint32_t>
+                , CompressedVector<float,rowVector> >( n );
+      testVector< SoACompressedVector<double,rowVector,uint64_t>
+                , CompressedVector<double,rowVector> >( n );
+   }
+
+   testIndexRange();
+}
+//*************************************************************************************************
+
+} // namespace soacompressed
+
+} // namespace mathtest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running structure-of-arrays compressed matrix and vector test..." << std::endl;
+
+   try
+   {
+      RUN_SOACOMPRESSED_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during structure-of-arrays compressed matrix and vector test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
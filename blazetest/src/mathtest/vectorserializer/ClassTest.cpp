@@ -38,12 +38,14 @@
 //*************************************************************************************************
 
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 #include <blaze/math/DynamicMatrix.h>
 #include <blaze/math/serialization/MatrixSerializer.h>
 #include <blaze/math/serialization/VectorSerializer.h>
 #include <blaze/util/Complex.h>
 #include <blaze/util/Random.h>
+#include <blazetest/mathtest/TemporaryFile.h>
 #include <blazetest/mathtest/vectorserializer/ClassTest.h>
 
 
@@ -68,6 +70,9 @@ ClassTest::ClassTest()
 {
    testEmptyVectors();
    testRandomVectors();
+   testVersion2Archive();
+   testVersion1Archive();
+   testMappedArchive();
    testFailures();
 }
 //*************************************************************************************************
@@ -230,6 +235,281 @@ void ClassTest::testRandomVectors()
 //*************************************************************************************************
 
 
+//*************************************************************************************************
+/*!\brief Serialization test with the version 2 format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the bulk serialization of vectors with numeric elements in the version 2
+// format. It checks the version and the 64-byte aligned layout of the archive and round trips
+// vectors that exceed the size of the internal buffers. In case an error is detected, i.e. in
+// case a vector cannot be reconstituted, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testVersion2Archive()
+{
+   test_ = "Version 2 archive";
+
+   const size_t n( 3UL*4096UL + 5UL );
+
+
+   //=====================================================================================
+   // Dense vector layout
+   //=====================================================================================
+
+   {
+      blaze::DynamicVector<double> src( n );
+      randomize( src );
+
+      std::stringstream stream;
+
+      {
+         blaze::Archive<std::stringstream> archive( stream );
+         archive << src;
+      }
+
+      checkLayout( stream.str(), 64UL + padded( n*sizeof(double) ) );
+   }
+
+
+   //=====================================================================================
+   // Sparse vector layout
+   //=====================================================================================
+
+   {
+      blaze::CompressedVector<float> src( 2UL*n );
+      randomize( src, n );
+
+      std::stringstream stream;
+
+      {
+         blaze::Archive<std::stringstream> archive( stream );
+         archive << src;
+      }
+
+      checkLayout( stream.str(), 64UL + padded( src.nonZeros()*sizeof(uint64_t) ) +
+                                        padded( src.nonZeros()*sizeof(float) ) );
+   }
+
+
+   //=====================================================================================
+   // Large round trips
+   //=====================================================================================
+
+   {
+      blaze::DynamicVector<int> src( n );
+      randomize( src );
+
+      blaze::DynamicVector<int> dst1;
+      blaze::CompressedVector<int> dst2;
+
+      runTest( src, dst1 );
+      runTest( src, dst2 );
+   }
+
+   {
+      blaze::DynamicVector<double> src( n );
+      randomize( src );
+
+      blaze::DynamicVector<double> dst;
+      runTest( subvector( src, 3UL, n-7UL ), dst );
+   }
+
+   {
+      blaze::CompressedVector< blaze::complex<double>, blaze::rowVector > src( 2UL*n );
+      randomize( src, n );
+
+      blaze::CompressedVector< blaze::complex<double>, blaze::rowVector > dst1;
+      blaze::DynamicVector< blaze::complex<double>, blaze::columnVector > dst2;
+
+      runTest( src, dst1 );
+      runTest( src, dst2 );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Deserialization test with archives in the version 1 format.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the deserialization of dense and sparse vectors from archives in the
+// version 1 format, in which all elements are written element by element. In case an error is
+// detected, i.e. in case a vector cannot be reconstituted, a \a std::runtime_error exception
+// is thrown.
+*/
+void ClassTest::testVersion1Archive()
+{
+   test_ = "Version 1 archive";
+
+   const blaze::DynamicVector<int> dense{ 4, -1, 0, 7, 2 };
+
+   blaze::CompressedVector<int> sparse( 9UL );
+   sparse[1] =  3;
+   sparse[4] = -5;
+   sparse[8] =  1;
+
+
+   //=====================================================================================
+   // Dense vector
+   //=====================================================================================
+
+   {
+      std::stringstream stream;
+
+      {
+         blaze::Archive<std::stringstream> archive( stream );
+
+         archive << uint8_t( 1U ) << uint8_t( 0U )
+                 << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof( int ) )
+                 << uint64_t( dense.size() ) << uint64_t( dense.size() );
+
+         for( size_t i=0UL; i<dense.size(); ++i ) {
+            archive << dense[i];
+         }
+      }
+
+      blaze::Archive<std::stringstream> archive( stream );
+      blaze::CompressedVector<int,blaze::rowVector> dst;
+
+      testDeserialization( archive, dst );
+      compareVectors( dense, dst );
+   }
+
+
+   //=====================================================================================
+   // Sparse vector
+   //=====================================================================================
+
+   {
+      std::stringstream stream;
+
+      {
+         blaze::Archive<std::stringstream> archive( stream );
+
+         archive << uint8_t( 1U ) << uint8_t( 2U )
+                 << uint8_t( blaze::TypeValueMapping<int>::value ) << uint8_t( sizeof( int ) )
+                 << uint64_t( sparse.size() ) << uint64_t( sparse.nonZeros() );
+
+         for( auto element=sparse.begin(); element!=sparse.end(); ++element ) {
+            archive << element->index() << element->value();
+         }
+      }
+
+      blaze::Archive<std::stringstream> archive( stream );
+      blaze::DynamicVector<int> dst;
+
+      testDeserialization( archive, dst );
+      compareVectors( sparse, dst );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the zero-copy deserialization via a memory mapped archive.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the reconstitution of dense vectors from a memory mapped archive and
+// the rejection of sparse vectors and of vectors with a different element type. In case an
+// error is detected, i.e. in case a vector cannot be reconstituted from file, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testMappedArchive()
+{
+   test_ = "Memory mapped archive";
+
+   using DenseType1  = blaze::DynamicVector<double,blaze::columnVector>;
+   using DenseType2  = blaze::DynamicVector<blaze::complex<float>,blaze::rowVector>;
+   using SparseType  = blaze::CompressedVector<int,blaze::columnVector>;
+   using MappedType1 = blaze::CustomVector<const double,blaze::unaligned,blaze::unpadded>;
+   using MappedType2 = blaze::CustomVector<const blaze::complex<float>,blaze::unaligned,
+                                           blaze::unpadded,blaze::rowVector>;
+   using MappedType3 = blaze::CustomVector<const int,blaze::unaligned,blaze::unpadded>;
+   using MappedType4 = blaze::CustomVector<const float,blaze::unaligned,blaze::unpadded>;
+
+   const blazetest::TemporaryFile file( "vectorserializer_mapped.blaze" );
+
+   DenseType1 dense1( 4099UL );
+   DenseType2 dense2( 13UL );
+   SparseType sparse( 17UL );
+
+   randomize( dense1 );
+   randomize( dense2 );
+   randomize( sparse, 5UL );
+
+   {
+      blaze::Archive<std::ofstream> archive( file.name(), std::ofstream::trunc );
+      archive << dense1 << dense2 << sparse;
+   }
+
+
+   //=====================================================================================
+   // Dense vectors
+   //=====================================================================================
+
+   {
+      blaze::MappedArchive archive( file.name() );
+
+      MappedType1 dst1;
+      MappedType2 dst2;
+
+      archive >> dst1 >> dst2;
+
+      compareVectors( dense1, dst1 );
+      compareVectors( dense2, dst2 );
+
+      bool failed( false );
+
+      try {
+         MappedType3 dst3;
+         archive >> dst3;
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping a sparse vector succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+
+
+   //=====================================================================================
+   // Element type mismatch
+   //=====================================================================================
+
+   {
+      blaze::MappedArchive archive( file.name() );
+
+      bool failed( false );
+
+      try {
+         MappedType4 dst;
+         archive >> dst;
+      }
+      catch( std::runtime_error& ) {
+         failed = true;
+      }
+
+      if( !failed ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Mapping with a different element type succeeded\n";
+         throw std::runtime_error( oss.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
 //*************************************************************************************************
 /*!\brief Test of failing serialization attempts.
 //
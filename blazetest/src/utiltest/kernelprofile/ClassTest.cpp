@@ -0,0 +1,414 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/kernelprofile/ClassTest.cpp
+//  \brief Source file for the kernel profiling test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#define BLAZE_USE_KERNEL_PROFILING 1
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <blaze/math/DynamicMatrix.h>
+#include <blaze/util/KernelProfile.h>
+#include <blazetest/utiltest/kernelprofile/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace kernelprofile {
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Auxiliary function representing a profiled kernel.
+//
+// \param m The first problem size of the kernel.
+// \param n The second problem size of the kernel.
+// \return void
+*/
+void profiledKernel( size_t m, size_t n )
+{
+   BLAZE_KERNEL_PROFILE( "profiledKernel", m, n, 0UL, 2UL*m*n, 8UL*m*n, 1UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Auxiliary function representing a profiled kernel executed by several threads.
+//
+// \return void
+*/
+void threadedKernel()
+{
+   BLAZE_KERNEL_PROFILE( "threadedKernel", 10UL, 10UL, 10UL, 0UL, 0UL, 4UL );
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the ClassTest class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testRecording();
+   testThreads();
+   testReset();
+   testJSON();
+   testKernelSelection();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the recording of kernel calls.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the recording and aggregation of several calls of a single kernel within
+// a single thread. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testRecording()
+{
+   test_ = "Recording of kernel calls";
+
+   profiledKernel(  5UL, 10UL );
+   profiledKernel( 20UL,  3UL );
+   profiledKernel(  2UL,  7UL );
+
+   const blaze::KernelProfile* p( find( "profiledKernel" ) );
+
+   if( p == nullptr || p->calls != 3UL || p->threads != 1UL || p->maxThreads != 1UL ||
+       p->sumM != 27UL || p->sumN != 20UL || p->sumK != 0UL ||
+       p->maxM != 20UL || p->maxN != 10UL || p->maxK != 0UL ||
+       p->flops != 248UL || p->bytes != 992UL ||
+       p->time < 0.0 || p->minTime > p->maxTime || p->maxTime > p->time ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel profile detected\n";
+      if( p != nullptr ) {
+         oss << " Details:\n"
+             << "   Calls   = " << p->calls << " (expected 3)\n"
+             << "   Threads = " << p->threads << " (expected 1)\n"
+             << "   Sizes   = " << p->sumM << " " << p->sumN << " " << p->sumK << " (expected 27 20 0)\n"
+             << "   Flops   = " << p->flops << " (expected 248)\n"
+             << "   Bytes   = " << p->bytes << " (expected 992)\n";
+      }
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the aggregation of kernel calls of several threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the aggregation of the kernel calls of several threads. In case an error
+// is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testThreads()
+{
+   test_ = "Aggregation of kernel calls of several threads";
+
+   const auto work = []() {
+      for( size_t i=0UL; i<100UL; ++i )
+         threadedKernel();
+   };
+
+   std::thread t1( work );
+   std::thread t2( work );
+   t1.join();
+   t2.join();
+   work();
+
+   const blaze::KernelProfile* p( find( "threadedKernel" ) );
+
+   if( p == nullptr || p->calls != 300UL || p->threads != 3UL || p->maxThreads != 4UL ||
+       p->sumK != 3000UL || p->maxK != 10UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid kernel profile detected\n";
+      if( p != nullptr ) {
+         oss << " Details:\n"
+             << "   Calls       = " << p->calls << " (expected 300)\n"
+             << "   Threads     = " << p->threads << " (expected 3)\n"
+             << "   Max threads = " << p->maxThreads << " (expected 4)\n";
+      }
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the reset of all kernel profiles.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the resetKernelProfiles() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testReset()
+{
+   test_ = "Reset of all kernel profiles";
+
+   blaze::resetKernelProfiles();
+
+   if( !blaze::getKernelProfiles().empty() ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Reset operation failed\n"
+          << " Details:\n"
+          << "   Number of profiles = " << blaze::getKernelProfiles().size() << " (expected 0)\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   profiledKernel( 4UL, 4UL );
+
+   const blaze::KernelProfile* p( find( "profiledKernel" ) );
+
+   if( p == nullptr || p->calls != 1UL || p->sumM != 4UL || p->maxM != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Recording after reset failed\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the JSON output of all kernel profiles.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the writeKernelProfiles() function. In case an error is detected, a
+// \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testJSON()
+{
+   test_ = "JSON output of all kernel profiles";
+
+   blaze::resetKernelProfiles();
+
+   {
+      std::ostringstream oss;
+      blaze::writeKernelProfiles( oss );
+
+      if( oss.str() != "{\n  \"kernels\": []\n}\n" ) {
+         std::ostringstream error;
+         error << " Test: " << test_ << "\n"
+               << " Error: Invalid JSON output for empty profiles\n"
+               << " Details:\n"
+               << "   Result:\n" << oss.str() << "\n";
+         throw std::runtime_error( error.str() );
+      }
+   }
+
+   profiledKernel( 3UL, 5UL );
+   profiledKernel( 3UL, 5UL );
+
+   {
+      std::ostringstream oss;
+      blaze::writeKernelProfiles( oss );
+      const std::string json( oss.str() );
+
+      if( json.find( "\"name\": \"profiledKernel\"" ) == std::string::npos ||
+          json.find( "\"calls\": 2," ) == std::string::npos ||
+          json.find( "\"avgN\": 5," ) == std::string::npos ||
+          json.find( "\"flops\": 60," ) == std::string::npos ||
+          json.find( "\"bandwidth\": " ) == std::string::npos ||
+          json.find( "threadedKernel" ) != std::string::npos ) {
+         std::ostringstream error;
+         error << " Test: " << test_ << "\n"
+               << " Error: Invalid JSON output\n"
+               << " Details:\n"
+               << "   Result:\n" << json << "\n";
+         throw std::runtime_error( error.str() );
+      }
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the profiling of the Blaze kernel selection points.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the profiling of the kernel selection of a dense matrix/dense matrix
+// multiplication. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testKernelSelection()
+{
+   test_ = "Profiling of the kernel selection points";
+
+   blaze::resetKernelProfiles();
+
+   blaze::DynamicMatrix<double,blaze::rowMajor> A( 3UL, 4UL, 1.0 );
+   blaze::DynamicMatrix<double,blaze::rowMajor> B( 4UL, 5UL, 2.0 );
+   blaze::DynamicMatrix<double,blaze::rowMajor> C;
+
+   C = A * B;
+   C += A * B;
+
+   size_t multiplications( 0UL );
+
+   for( const blaze::KernelProfile& p : blaze::getKernelProfiles() )
+   {
+      if( p.name.compare( 0UL, 18UL, "DMatDMatMultExpr::" ) != 0 )
+         continue;
+
+      if( p.calls != 1UL || p.maxM != 3UL || p.maxN != 5UL || p.maxK != 4UL || p.flops != 120UL ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid kernel profile detected\n"
+             << " Details:\n"
+             << "   Kernel = " << p.name << "\n"
+             << "   Calls  = " << p.calls << " (expected 1)\n"
+             << "   Sizes  = " << p.maxM << " " << p.maxN << " " << p.maxK << " (expected 3 5 4)\n"
+             << "   Flops  = " << p.flops << " (expected 120)\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      ++multiplications;
+   }
+
+   if( multiplications != 2UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Missing kernel profiles\n"
+          << " Details:\n"
+          << "   Number of profiled multiplication kernels = " << multiplications << " (expected 2)\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Returns the profile of the kernel selection point with the given name.
+//
+// \param name The name of the kernel selection point.
+// \return Pointer to the profile, \a nullptr in case no profile is available.
+*/
+const blaze::KernelProfile* ClassTest::find( const std::string& name ) const
+{
+   static std::vector<blaze::KernelProfile> profiles;
+
+   profiles = blaze::getKernelProfiles();
+
+   for( const blaze::KernelProfile& p : profiles ) {
+      if( p.name == name ) return &p;
+   }
+
+   return nullptr;
+}
+//*************************************************************************************************
+
+} // namespace kernelprofile
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running kernel profiling class test..." << std::endl;
+
+   try
+   {
+      RUN_KERNELPROFILE_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during kernel profiling class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************
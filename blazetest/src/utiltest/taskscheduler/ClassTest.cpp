@@ -0,0 +1,404 @@
+//=================================================================================================
+/*!
+//  \file src/utiltest/taskscheduler/ClassTest.cpp
+//  \brief Source file for the task scheduler test
+//
+//  Copyright (C) 2012-2018 Klaus Iglberger - All Rights Reserved
+//
+//  are met:
+//
+//  1. Redistributions of source code must retain the above copyright notice, this list of
+//     conditions and the following disclaimer.
+//  2. Redistributions in binary form must reproduce the above copyright notice, this list
+//     of conditions and the following disclaimer in the documentation and/or other materials
+//     provided with the distribution.
+//  3. Neither the names of the Blaze development group nor the names of its contributors
+//     may be used to endorse or promote products derived from this software without specific
+//     prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY
+//  EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+//  OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT
+//  SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+//  TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR
+//  BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+//  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH
+//  DAMAGE.
+*/
+//=================================================================================================
+
+
+
+
+
+//*************************************************************************************************
+// Includes
+//*************************************************************************************************
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+#include <blazetest/utiltest/taskscheduler/ClassTest.h>
+
+
+namespace blazetest {
+
+namespace utiltest {
+
+namespace taskscheduler {
+
+//=================================================================================================
+//
+//  CONSTRUCTORS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Constructor for the TaskScheduler class test.
+//
+// \exception std::runtime_error Operation error detected.
+*/
+ClassTest::ClassTest()
+{
+   testSchedule();
+   testSteal();
+   testWait();
+   testResize();
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  TEST FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Test of the scheduling of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the scheduling of tasks by a single application thread, including more
+// tasks than task slots are available. In case an error is detected, a \a std::runtime_error
+// exception is thrown.
+*/
+void ClassTest::testSchedule()
+{
+   test_ = "Scheduling of tasks";
+
+   Scheduler scheduler( 4UL );
+
+   if( scheduler.size() != 4UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid size detected\n"
+          << " Details:\n"
+          << "   Result: " << scheduler.size() << "\n"
+          << "   Expected result: 4\n";
+      throw std::runtime_error( oss.str() );
+   }
+
+   std::atomic<size_t> count( 0UL );
+
+   for( size_t i=0UL; i<1000UL; ++i ) {
+      scheduler.schedule( [&count]() { ++count; } );
+   }
+
+   scheduler.wait();
+
+   checkCount( count.load(), 1000UL );
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the stealing of tasks by the worker threads.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests that tasks scheduled by an application thread are stolen and executed
+// by the worker threads. In case an error is detected, a \a std::runtime_error exception is
+// thrown.
+*/
+void ClassTest::testSteal()
+{
+   test_ = "Stealing of tasks";
+
+   Scheduler scheduler( 4UL );
+
+   std::atomic<size_t> count( 0UL );
+   std::atomic<size_t> stolen( 0UL );
+
+   for( size_t i=0UL; i<16UL; ++i ) {
+      scheduler.schedule( [&]() {
+         std::this_thread::sleep_for( std::chrono::milliseconds( 2 ) );
+         if( scheduler.index() != 0UL ) ++stolen;
+         ++count;
+      } );
+   }
+
+   scheduler.wait();
+
+   checkCount( count.load(), 16UL );
+
+   if( stolen.load() == 0UL ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: No task has been executed by a worker thread\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the joining of tasks.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the joining of nested tasks and of tasks scheduled concurrently by
+// several application threads, including more application threads than task slots are
+// available. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testWait()
+{
+   //=====================================================================================
+   // Joining nested tasks
+   //=====================================================================================
+
+   {
+      test_ = "Joining nested tasks";
+
+      Scheduler scheduler( 4UL );
+
+      std::atomic<size_t> count ( 0UL );
+      std::atomic<size_t> errors( 0UL );
+
+      for( size_t i=0UL; i<8UL; ++i ) {
+         scheduler.schedule( [&]() {
+            std::atomic<size_t> nested( 0UL );
+            for( size_t j=0UL; j<10UL; ++j ) {
+               scheduler.schedule( [&]() { ++nested; ++count; } );
+            }
+            scheduler.wait();
+            if( nested.load() != 10UL ) ++errors;
+         } );
+      }
+
+      scheduler.wait();
+
+      checkCount( count.load(), 80UL );
+      checkCount( errors.load(), 0UL );
+   }
+
+
+   //=====================================================================================
+   // Joining tasks of several application threads
+   //=====================================================================================
+
+   {
+      test_ = "Joining tasks of several application threads";
+
+      Scheduler scheduler( 4UL );
+
+      std::atomic<size_t> count ( 0UL );
+      std::atomic<size_t> errors( 0UL );
+
+      const auto work = [&]() {
+         std::atomic<size_t> local( 0UL );
+         for( size_t round=1UL; round<=50UL; ++round ) {
+            for( size_t i=0UL; i<20UL; ++i ) {
+               scheduler.schedule( [&]() { ++local; ++count; } );
+            }
+            scheduler.wait();
+            if( local.load() != 20UL*round ) ++errors;
+         }
+      };
+
+      std::vector<std::thread> threads;
+      for( size_t i=0UL; i<8UL; ++i ) {
+         threads.emplace_back( work );
+      }
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      checkCount( count.load(), 8000UL );
+      checkCount( errors.load(), 0UL );
+   }
+
+
+   //=====================================================================================
+   // Joining tasks of more application threads than task slots
+   //=====================================================================================
+
+   {
+      test_ = "Joining tasks of more application threads than task slots";
+
+      Scheduler scheduler( 2UL );
+
+      const size_t n( 80UL );
+
+      std::atomic<size_t> count  ( 0UL );
+      std::atomic<size_t> errors ( 0UL );
+      std::atomic<size_t> arrived( 0UL );
+
+      const auto work = [&]() {
+         std::atomic<size_t> local( 0UL );
+         scheduler.schedule( [&]() { ++local; ++count; } );
+         ++arrived;
+         while( arrived.load() < n ) {
+            std::this_thread::yield();
+         }
+         scheduler.wait();
+         if( local.load() != 1UL ) ++errors;
+      };
+
+      std::vector<std::thread> threads;
+      for( size_t i=0UL; i<n; ++i ) {
+         threads.emplace_back( work );
+      }
+      for( std::thread& thread : threads ) {
+         thread.join();
+      }
+
+      checkCount( count.load(), n );
+      checkCount( errors.load(), 0UL );
+   }
+}
+//*************************************************************************************************
+
+
+//*************************************************************************************************
+/*!\brief Test of the resize() member function.
+//
+// \return void
+// \exception std::runtime_error Error detected.
+//
+// This function tests the resizing of the task scheduler and the scheduling of tasks after
+// each resize. In case an error is detected, a \a std::runtime_error exception is thrown.
+*/
+void ClassTest::testResize()
+{
+   test_ = "Resizing the task scheduler";
+
+   Scheduler scheduler( 1UL );
+
+   std::atomic<size_t> count( 0UL );
+
+   scheduler.schedule( [&count]() { ++count; } );
+   checkCount( count.load(), 1UL );
+
+   for( size_t n : { 3UL, 2UL, 5UL, 1UL, 4UL } )
+   {
+      scheduler.resize( n );
+
+      if( scheduler.size() != n ) {
+         std::ostringstream oss;
+         oss << " Test: " << test_ << "\n"
+             << " Error: Invalid size detected\n"
+             << " Details:\n"
+             << "   Result: " << scheduler.size() << "\n"
+             << "   Expected result: " << n << "\n";
+         throw std::runtime_error( oss.str() );
+      }
+
+      count = 0UL;
+
+      for( size_t i=0UL; i<200UL; ++i ) {
+         scheduler.schedule( [&count]() { ++count; } );
+      }
+
+      scheduler.wait();
+
+      checkCount( count.load(), 200UL );
+   }
+
+   try {
+      scheduler.resize( 0UL );
+
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Resizing to zero threads succeeded\n";
+      throw std::runtime_error( oss.str() );
+   }
+   catch( std::invalid_argument& ) {}
+}
+//*************************************************************************************************
+
+
+
+
+//=================================================================================================
+//
+//  UTILITY FUNCTIONS
+//
+//=================================================================================================
+
+//*************************************************************************************************
+/*!\brief Checking the number of executed tasks.
+//
+// \param count The actual number of executed tasks.
+// \param expected The expected number of executed tasks.
+// \return void
+// \exception std::runtime_error Error detected.
+*/
+void ClassTest::checkCount( size_t count, size_t expected ) const
+{
+   if( count != expected ) {
+      std::ostringstream oss;
+      oss << " Test: " << test_ << "\n"
+          << " Error: Invalid number of executed tasks\n"
+          << " Details:\n"
+          << "   Result: " << count << "\n"
+          << "   Expected result: " << expected << "\n";
+      throw std::runtime_error( oss.str() );
+   }
+}
+//*************************************************************************************************
+
+} // namespace taskscheduler
+
+} // namespace utiltest
+
+} // namespace blazetest
+
+
+
+
+//=================================================================================================
+//
+//  MAIN FUNCTION
+//
+//=================================================================================================
+
+//*************************************************************************************************
+int main()
+{
+   std::cout << "   Running TaskScheduler class test..." << std::endl;
+
+   try
+   {
+      RUN_TASKSCHEDULER_CLASS_TEST;
+   }
+   catch( std::exception& ex ) {
+      std::cerr << "\n\n ERROR DETECTED during TaskScheduler class test:\n"
+                << ex.what() << "\n";
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
+//*************************************************************************************************